@@ -0,0 +1,115 @@
+/*
+ * Auto generated header file to be used with web2cam
+ *
+ * Source file: cam2web.png
+ */
+
+#ifndef cam2web_png_h
+#define cam2web_png_h
+
+#include "XWebServer.hpp"
+
+uint8_t cam2web_png_data[]
+{
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x20, 
+    0x00, 0x00, 0x00, 0x20, 0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7A, 0x7A, 0xF4, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4B, 0x47, 
+    0x44, 0x00, 0x5A, 0x00, 0x58, 0x00, 0xBB, 0xB5, 0xFC, 0x79, 0x19, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 
+    0x00, 0x46, 0xDE, 0x00, 0x00, 0x46, 0xDE, 0x01, 0x8E, 0x26, 0x32, 0x5B, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4D, 0x45, 
+    0x07, 0xE1, 0x06, 0x07, 0x15, 0x0B, 0x17, 0x79, 0x91, 0x92, 0x09, 0x00, 0x00, 0x06, 0x4B, 0x49, 0x44, 0x41, 0x54, 0x58, 
+    0xC3, 0xD5, 0x97, 0x5D, 0x8C, 0x94, 0x77, 0x15, 0xC6, 0x7F, 0xCF, 0x3B, 0x3B, 0xC3, 0xB2, 0x1F, 0xEC, 0x6E, 0x19, 0x81, 
+    0x9D, 0x59, 0x36, 0x4D, 0x6C, 0x29, 0x89, 0x17, 0x86, 0x12, 0x23, 0x68, 0xDA, 0x62, 0x48, 0x4D, 0xAA, 0xA4, 0xD1, 0xB4, 
+    0x64, 0x9B, 0x18, 0x5B, 0x3F, 0x23, 0x85, 0xA4, 0x15, 0x84, 0x6A, 0xD4, 0x5E, 0x14, 0x7B, 0xB1, 0x09, 0x1F, 0xC5, 0xAA, 
+    0x40, 0xA2, 0xAD, 0xA1, 0x55, 0x0B, 0xEA, 0x05, 0x69, 0xDA, 0x54, 0x40, 0x05, 0x25, 0x01, 0x24, 0x69, 0xFD, 0x48, 0x8C, 
+    0xD8, 0x4A, 0x4B, 0x97, 0x99, 0x59, 0xB0, 0xE5, 0x6B, 0xB7, 0xEC, 0x2E, 0x33, 0xEF, 0xFF, 0x1C, 0x2F, 0xE6, 0x63, 0x67, 
+    0x60, 0xBA, 0x0B, 0xE9, 0x95, 0x93, 0xBC, 0x79, 0xE7, 0x9D, 0xF9, 0xCF, 0xFF, 0x39, 0xFF, 0xE7, 0x3C, 0xE7, 0x39, 0x67, 
+    0xE0, 0xFF, 0xE9, 0xD5, 0x3B, 0xE3, 0x77, 0xD3, 0xAE, 0xC9, 0xB4, 0xED, 0xB9, 0xA1, 0x3D, 0x35, 0x2D, 0x68, 0xF2, 0x00, 
+    0xC8, 0x19, 0x2E, 0x7E, 0xBA, 0x1A, 0x44, 0x2F, 0xD8, 0xA7, 0x24, 0xFF, 0x08, 0x84, 0x34, 0x18, 0xC8, 0xDE, 0x05, 0xFB, 
+    0x27, 0xF8, 0xC1, 0xC2, 0xF8, 0xCA, 0x61, 0x80, 0x4C, 0xC7, 0xF3, 0x20, 0xA3, 0x30, 0xFA, 0xD0, 0x07, 0x0B, 0xA0, 0x16, 
+    0x48, 0x6A, 0xFF, 0x2D, 0xE0, 0x4F, 0x49, 0x76, 0x27, 0x58, 0x0A, 0x59, 0xD2, 0xB1, 0x84, 0x14, 0x00, 0x0F, 0x44, 0xA1, 
+    0x04, 0xA1, 0x08, 0xF6, 0x27, 0x64, 0xEB, 0x0A, 0xEF, 0x7D, 0xF1, 0x3F, 0x1F, 0x88, 0x81, 0xDE, 0xD4, 0x01, 0x86, 0x8B, 
+    0x77, 0xD3, 0x9B, 0x3A, 0xD0, 0x2A, 0xE7, 0xEB, 0xC8, 0x9F, 0x42, 0x21, 0x51, 0x39, 0x71, 0xF9, 0x22, 0x54, 0xEE, 0x8D, 
+    0xCF, 0x52, 0x08, 0x8E, 0xAD, 0x45, 0xF6, 0xD3, 0xC2, 0xC8, 0xD7, 0x26, 0xB2, 0x5D, 0xDB, 0xC9, 0x5F, 0x5A, 0xDD, 0x14, 
+    0x27, 0x31, 0x35, 0xF8, 0xEF, 0xDB, 0x80, 0xAD, 0x92, 0x3F, 0x8E, 0x42, 0x34, 0x09, 0xE8, 0xA0, 0x50, 0x07, 0xEA, 0x95, 
+    0x7B, 0x2D, 0xA0, 0x08, 0xD9, 0x3D, 0x28, 0xA4, 0xBB, 0x66, 0x7C, 0xE6, 0x60, 0x7E, 0x64, 0x75, 0x29, 0xDB, 0xFD, 0x34, 
+    0xA3, 0x13, 0xAF, 0x5C, 0x83, 0x15, 0x5D, 0x23, 0xA2, 0xD4, 0x7E, 0x86, 0x8B, 0x77, 0x57, 0x9E, 0xEC, 0x59, 0xC9, 0x56, 
+    0xA1, 0x30, 0x79, 0x5A, 0x59, 0x05, 0xA8, 0x0E, 0x50, 0xD5, 0x93, 0x5B, 0x2D, 0x10, 0x61, 0x08, 0x5B, 0xE5, 0x91, 0x3D, 
+    0x0B, 0x90, 0xBF, 0xF8, 0x08, 0x99, 0x9E, 0xAD, 0xD3, 0x07, 0x10, 0x13, 0x57, 0x73, 0xFE, 0x98, 0x64, 0xF7, 0x39, 0x75, 
+    0x54, 0x2B, 0x54, 0xE8, 0xAE, 0x3B, 0x7D, 0xE5, 0x92, 0x02, 0x4E, 0x40, 0x32, 0xD4, 0xB0, 0xC6, 0xEE, 0xCB, 0x76, 0x6F, 
+    0x7B, 0x0C, 0x80, 0x96, 0xF1, 0xEB, 0xD3, 0x40, 0x6F, 0x6A, 0xDF, 0x87, 0x85, 0xBF, 0xE4, 0xB2, 0x85, 0xAA, 0x81, 0x57, 
+    0x69, 0xB6, 0x22, 0xD8, 0x31, 0xB0, 0xAD, 0xC8, 0x8E, 0xA2, 0x18, 0x61, 0x4B, 0x91, 0xAF, 0x73, 0x85, 0x25, 0xC8, 0x52, 
+    0x6A, 0xD0, 0x44, 0x00, 0xEC, 0x84, 0xCB, 0x56, 0x14, 0xCE, 0x6F, 0x38, 0x39, 0x2D, 0x03, 0xF3, 0x66, 0xBE, 0x24, 0xB0, 
+    0xE5, 0xC8, 0x16, 0x4E, 0x0A, 0xAE, 0x96, 0xE3, 0x31, 0xB0, 0x47, 0x0B, 0x63, 0x03, 0x77, 0x11, 0x95, 0x4E, 0x10, 0x95, 
+    0x96, 0xA2, 0xB0, 0xD4, 0xA3, 0xF8, 0x44, 0x7E, 0xF4, 0x2B, 0x77, 0x81, 0x3D, 0x2A, 0x6C, 0xAC, 0x31, 0x3D, 0x46, 0x65, 
+    0xAF, 0xE5, 0xF3, 0xD3, 0x1B, 0x35, 0x6D, 0x00, 0xB2, 0xA8, 0x15, 0xD9, 0x0A, 0x64, 0x28, 0x0A, 0x57, 0x9D, 0xC4, 0x57, 
+    0x15, 0xC6, 0x06, 0x76, 0x66, 0x3A, 0x9E, 0x7F, 0x02, 0xFC, 0x8F, 0xE0, 0x7B, 0x91, 0xEF, 0x05, 0x0E, 0x67, 0xBA, 0x76, 
+    0x3E, 0x51, 0x18, 0xF9, 0xC6, 0x4E, 0x57, 0x58, 0x35, 0x59, 0x19, 0xA1, 0x56, 0x21, 0x92, 0xAD, 0x30, 0x12, 0xAD, 0x53, 
+    0xA6, 0xA0, 0xB7, 0xF5, 0x45, 0x84, 0x7A, 0x80, 0x37, 0xC0, 0x66, 0x37, 0xE6, 0xDD, 0x0F, 0x41, 0x74, 0x0F, 0x1A, 0x7F, 
+    0x00, 0xF8, 0x39, 0xAA, 0xE6, 0xDD, 0x4E, 0x0A, 0x3B, 0x8F, 0xEC, 0x63, 0xC8, 0xBE, 0x8C, 0x8A, 0xBB, 0x41, 0xAF, 0x20, 
+    0x5B, 0x76, 0x55, 0x99, 0x9E, 0x03, 0xBF, 0x55, 0x2A, 0x5D, 0xC8, 0xBD, 0xB3, 0xB1, 0x39, 0x03, 0xC3, 0x13, 0xF7, 0x02, 
+    0x96, 0x6A, 0x04, 0xF7, 0x2A, 0x0B, 0x2F, 0x17, 0x2E, 0xAF, 0x9C, 0x40, 0xBE, 0xA9, 0x0E, 0x1C, 0x6F, 0xF3, 0x05, 0xA6, 
+    0xD2, 0x00, 0x0A, 0x6F, 0xA1, 0xB0, 0x39, 0x7F, 0x61, 0xDD, 0x04, 0x0A, 0x2F, 0xD7, 0xD1, 0x5F, 0xAD, 0x98, 0xD9, 0x28, 
+    0xA4, 0xEA, 0xC1, 0x01, 0x5A, 0xAE, 0x95, 0xA5, 0x77, 0xD4, 0xEA, 0xBC, 0x5A, 0xE3, 0xE5, 0x40, 0x4E, 0x67, 0x66, 0x3D, 
+    0x97, 0xC0, 0xE3, 0x74, 0x59, 0x13, 0x86, 0x14, 0xD0, 0x44, 0xD8, 0x50, 0x5E, 0xE3, 0x69, 0x08, 0x9D, 0x73, 0x6E, 0x1A, 
+    0x4C, 0xA0, 0x70, 0xBA, 0x2E, 0x70, 0xAA, 0xEB, 0xC1, 0x3B, 0x80, 0xB3, 0x53, 0x6A, 0x00, 0x85, 0x62, 0x7D, 0xEE, 0x50, 
+    0x5C, 0xCD, 0x67, 0x47, 0x61, 0xE4, 0xC1, 0x80, 0x0C, 0xD5, 0x79, 0x82, 0xE3, 0x83, 0xE0, 0x83, 0x60, 0x9D, 0xC8, 0xF8, 
+    0xEF, 0xF9, 0xEF, 0x04, 0x64, 0x1D, 0x8D, 0x4E, 0x19, 0x57, 0x45, 0x59, 0x9C, 0x56, 0x84, 0x10, 0xC6, 0xC0, 0xAC, 0xA6, 
+    0xE4, 0x49, 0x36, 0x96, 0x54, 0xBE, 0xDF, 0x35, 0x99, 0x9E, 0x72, 0x2A, 0xEA, 0xCC, 0x68, 0x57, 0x65, 0xCD, 0x92, 0x7A, 
+    0xB3, 0x52, 0x99, 0x01, 0x2B, 0xEF, 0x3D, 0x8D, 0x0F, 0x64, 0xDA, 0x77, 0x77, 0x82, 0x1F, 0x42, 0x76, 0xFB, 0xE4, 0x09, 
+    0x02, 0xC8, 0x4A, 0x60, 0x0B, 0xA4, 0xD2, 0x45, 0xD0, 0x31, 0x64, 0xB7, 0x35, 0x30, 0x85, 0xFD, 0xDB, 0xF1, 0x25, 0x8A, 
+    0x8A, 0xDD, 0xC0, 0xEB, 0xC8, 0x92, 0x65, 0x47, 0x2C, 0x6B, 0x05, 0xF9, 0x6B, 0xC0, 0xB2, 0xFC, 0xD9, 0xC1, 0xD1, 0x69, 
+    0x18, 0xB0, 0x71, 0x14, 0xF6, 0x35, 0x58, 0xAA, 0x1C, 0x61, 0x49, 0x29, 0xBC, 0x80, 0xBC, 0x0D, 0x85, 0xC5, 0x28, 0x6C, 
+    0x02, 0xDB, 0x8F, 0x6C, 0x3F, 0xD8, 0x26, 0x3C, 0x5A, 0xAC, 0xA8, 0xD4, 0x86, 0xFC, 0x85, 0x2A, 0x78, 0xAD, 0x04, 0x23, 
+    0x03, 0xD9, 0x3E, 0x14, 0xC6, 0xAF, 0xCB, 0x09, 0x33, 0x1D, 0xBB, 0xEE, 0x40, 0xF6, 0x22, 0xF2, 0xEE, 0xAA, 0xD8, 0xEA, 
+    0xEC, 0xF8, 0xEF, 0xE0, 0x9B, 0xF2, 0x17, 0xBE, 0xF9, 0xCB, 0xFA, 0xDF, 0x64, 0xD3, 0x4F, 0x7E, 0x01, 0xD9, 0x06, 0xB0, 
+    0x8F, 0x56, 0x4B, 0x4F, 0x93, 0x41, 0x5C, 0x04, 0xBB, 0x37, 0x77, 0x66, 0xCB, 0xE1, 0xEB, 0x6E, 0xC7, 0x99, 0x59, 0xCF, 
+    0xEC, 0x06, 0x1B, 0x90, 0x9A, 0xF4, 0x02, 0xFC, 0x0A, 0x0A, 0xA3, 0x65, 0xB5, 0x1B, 0xC8, 0xE6, 0x23, 0xEB, 0x04, 0x9B, 
+    0x51, 0xD5, 0x8D, 0x14, 0xF0, 0x0A, 0x83, 0xE0, 0x7B, 0x72, 0x67, 0xB6, 0x3C, 0xD0, 0x0C, 0xE7, 0xDA, 0x6E, 0xD8, 0xF9, 
+    0x0C, 0x00, 0xEE, 0xB6, 0x5E, 0x0A, 0x85, 0xC9, 0x6A, 0xA8, 0xF3, 0x04, 0x85, 0x19, 0xC8, 0xD2, 0xC8, 0x16, 0x21, 0x5F, 
+    0x04, 0x96, 0x86, 0x30, 0xA3, 0x1A, 0x60, 0x19, 0xDC, 0xAA, 0xE0, 0x05, 0x88, 0xD7, 0x03, 0x64, 0xE7, 0xAD, 0xBD, 0xB1, 
+    0x89, 0x28, 0xDB, 0xB5, 0xFD, 0x13, 0xC8, 0xF6, 0xA0, 0xD0, 0x37, 0x69, 0xAD, 0xDE, 0xA4, 0x2B, 0xD6, 0xFB, 0x86, 0x55, 
+    0x54, 0x1F, 0x40, 0x96, 0x03, 0x1B, 0xC8, 0x0D, 0x6F, 0x3B, 0xF2, 0x7E, 0x18, 0xD1, 0x55, 0x80, 0x65, 0x16, 0xBA, 0xB7, 
+    0x2F, 0xCB, 0x74, 0xFF, 0x64, 0x47, 0xFE, 0xD2, 0xEA, 0x23, 0x60, 0x2B, 0xC0, 0x8E, 0x34, 0x34, 0x97, 0x86, 0xA9, 0xC8, 
+    0x1B, 0x66, 0x03, 0xC9, 0xF0, 0x32, 0xF8, 0x11, 0xC7, 0x57, 0xE4, 0x86, 0xB7, 0x1D, 0xE9, 0xCB, 0xAE, 0xD9, 0xD1, 0x97, 
+    0x7D, 0x78, 0x19, 0x40, 0x5F, 0xDF, 0x57, 0x9B, 0x33, 0x50, 0x1D, 0x9B, 0x32, 0x5D, 0xDB, 0x6F, 0x05, 0xFE, 0x2A, 0x85, 
+    0x76, 0x14, 0xFE, 0x42, 0x22, 0x71, 0x07, 0x21, 0x6E, 0x21, 0x2A, 0xAD, 0x85, 0xF0, 0x03, 0xE4, 0x51, 0xA3, 0x26, 0xBC, 
+    0x36, 0x88, 0x54, 0x72, 0x6E, 0xC8, 0xBF, 0xEF, 0xAE, 0x1F, 0x2A, 0x51, 0x2A, 0x41, 0x7C, 0x18, 0xFC, 0xE3, 0x28, 0x5C, 
+    0x06, 0x5B, 0x94, 0xCB, 0xFD, 0xEC, 0x8D, 0xBE, 0xFE, 0x87, 0xC8, 0x0D, 0xED, 0xBA, 0x36, 0x05, 0xD9, 0xF6, 0x1F, 0x89, 
+    0x96, 0x68, 0x08, 0x59, 0x5F, 0x5D, 0x19, 0x9D, 0x83, 0x30, 0x90, 0x3F, 0xFF, 0xED, 0x3F, 0x64, 0xE7, 0x3C, 0x99, 0xC2, 
+    0xFC, 0x61, 0xB0, 0xFB, 0x89, 0x6C, 0x21, 0x84, 0x44, 0x45, 0x70, 0x01, 0xD9, 0x09, 0xB0, 0xDF, 0x82, 0xEF, 0xC8, 0x9D, 
+    0xD9, 0x52, 0xEC, 0xCB, 0xAC, 0x59, 0x8E, 0x7C, 0xCF, 0x55, 0x4D, 0x2D, 0x47, 0xCF, 0xB1, 0xFE, 0xDC, 0x3F, 0xFE, 0xE5, 
+    0x4D, 0x35, 0x90, 0xED, 0xFA, 0xF1, 0xB7, 0x90, 0x6F, 0x0E, 0x16, 0xE3, 0x1E, 0xD3, 0x92, 0x54, 0xFD, 0xC0, 0xB9, 0x97, 
+    0x28, 0x3C, 0x07, 0xF1, 0xAB, 0xF9, 0x77, 0x36, 0x0E, 0x01, 0x64, 0x7A, 0xBE, 0xDB, 0xD2, 0x4A, 0x3B, 0x6F, 0x5E, 0xF8, 
+    0x5E, 0x0C, 0x90, 0xE9, 0x7D, 0xA4, 0x3F, 0x92, 0x2F, 0x06, 0x7F, 0x10, 0xD9, 0xE7, 0xE2, 0x50, 0x44, 0x72, 0xDC, 0x63, 
+    0x90, 0xD1, 0xD2, 0x22, 0x88, 0x6C, 0x7D, 0xEE, 0xED, 0x5F, 0x6C, 0x69, 0x1E, 0x40, 0xF7, 0xD3, 0xAF, 0x46, 0x09, 0x6E, 
+    0xBF, 0xE5, 0xB6, 0xB9, 0xCC, 0xEB, 0xFF, 0x10, 0x47, 0x0F, 0xFD, 0x8D, 0x52, 0xE9, 0x0A, 0xF5, 0x75, 0xED, 0xB2, 0xD7, 
+    0x85, 0x0D, 0xA1, 0x70, 0xD6, 0x15, 0x2E, 0x94, 0x3F, 0xB7, 0x1E, 0x64, 0x73, 0xC1, 0xFA, 0x91, 0x2D, 0x00, 0x23, 0x8E, 
+    0xAF, 0xF0, 0xC9, 0x3B, 0x97, 0x70, 0x79, 0xEC, 0x0A, 0xE9, 0x74, 0x0F, 0xC5, 0x38, 0xE6, 0xF8, 0xD1, 0x83, 0xC4, 0xA1, 
+    0xF8, 0x5A, 0xEE, 0xED, 0x5F, 0x2D, 0x6E, 0xDE, 0x0D, 0x65, 0x73, 0x91, 0x73, 0xA5, 0x58, 0x64, 0xE4, 0xD2, 0x28, 0xEE, 
+    0x0D, 0x56, 0x5C, 0xC9, 0xB1, 0x2F, 0x70, 0xD9, 0x82, 0xF2, 0xEC, 0x57, 0xEB, 0x72, 0x8D, 0xA3, 0x39, 0x8E, 0x13, 0x68, 
+    0x49, 0x46, 0xCC, 0x6C, 0x6B, 0xE5, 0xD2, 0xA5, 0x73, 0x8C, 0x4F, 0x14, 0xAB, 0xF3, 0xE3, 0xDC, 0xF7, 0x6F, 0xC7, 0x0A, 
+    0xC7, 0xCD, 0xEC, 0xF3, 0xA7, 0x4E, 0xE6, 0x79, 0xEB, 0xCD, 0x21, 0xA2, 0x88, 0xAB, 0x4D, 0xC8, 0x5C, 0x1E, 0x20, 0x58, 
+    0xF9, 0x7D, 0x70, 0x95, 0xAB, 0x40, 0xC8, 0x22, 0x08, 0x11, 0xB2, 0x04, 0x58, 0x94, 0x4C, 0x25, 0xF8, 0xF3, 0xA1, 0x43, 
+    0x65, 0x1B, 0xAE, 0xF8, 0x47, 0x22, 0xE1, 0x48, 0x76, 0x7C, 0x8A, 0x79, 0xC0, 0xD7, 0x54, 0xBA, 0x57, 0xBF, 0xE4, 0x49, 
+    0xF0, 0x12, 0xB2, 0xCB, 0x60, 0xA3, 0xE0, 0xE7, 0xC0, 0xCE, 0x08, 0x3B, 0xEB, 0xB2, 0x77, 0x21, 0xBC, 0x27, 0x7C, 0xDC, 
+    0x89, 0x11, 0x3E, 0x13, 0x42, 0x07, 0x78, 0x1A, 0x7C, 0x2E, 0xD8, 0x3C, 0x08, 0xB3, 0x13, 0x2D, 0xEA, 0x44, 0xB4, 0x03, 
+    0x49, 0xE4, 0x25, 0xC7, 0x86, 0x04, 0x6B, 0x9A, 0x97, 0xE1, 0x4D, 0x9B, 0xC9, 0x9F, 0x5F, 0x5F, 0xF5, 0xF5, 0x0C, 0x58, 
+    0x12, 0xAC, 0x84, 0xC2, 0x65, 0xAC, 0x34, 0x92, 0x3F, 0x37, 0xE8, 0x37, 0xF2, 0xA7, 0xB3, 0x6F, 0xE1, 0x67, 0xC5, 0x58, 
+    0xF7, 0x2C, 0x64, 0xED, 0xE0, 0x49, 0x64, 0xA5, 0xDC, 0xA9, 0x5F, 0x17, 0x00, 0xE6, 0xDF, 0xBC, 0x92, 0xD3, 0xA7, 0x7E, 
+    0xD3, 0xC4, 0xF9, 0x66, 0x0F, 0x4E, 0xB9, 0x69, 0x76, 0xCE, 0xE3, 0xD3, 0x03, 0xF7, 0x7F, 0x69, 0xCA, 0xEF, 0xE7, 0xDF, 
+    0x7C, 0x7F, 0xC3, 0xF3, 0xFF, 0x00, 0xEF, 0xA9, 0xA1, 0xC5, 0x63, 0x68, 0x10, 0x28, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 
+    0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82, 
+};
+
+XEmbeddedContent web_cam2web_png =
+{
+    1726,
+    "image/png",
+    cam2web_png_data,
+    "ae62675d1fdee934",
+    0,
+    nullptr,
+    0,
+    nullptr,
+};
+
+#endif
@@ -0,0 +1,145 @@
+/*
+ * Auto generated header file to be used with web2cam
+ *
+ * Source file: cam2web_white.png
+ */
+
+#ifndef cam2web_white_png_h
+#define cam2web_white_png_h
+
+#include "XWebServer.hpp"
+
+uint8_t cam2web_white_png_data[]
+{
+    0x89, 0x50, 0x4E, 0x47, 0x0D, 0x0A, 0x1A, 0x0A, 0x00, 0x00, 0x00, 0x0D, 0x49, 0x48, 0x44, 0x52, 0x00, 0x00, 0x00, 0x20, 
+    0x00, 0x00, 0x00, 0x20, 0x08, 0x06, 0x00, 0x00, 0x00, 0x73, 0x7A, 0x7A, 0xF4, 0x00, 0x00, 0x00, 0x06, 0x62, 0x4B, 0x47, 
+    0x44, 0x00, 0xD0, 0x00, 0xD0, 0x00, 0xD0, 0x7B, 0xEC, 0x23, 0xC2, 0x00, 0x00, 0x00, 0x09, 0x70, 0x48, 0x59, 0x73, 0x00, 
+    0x00, 0x46, 0xDE, 0x00, 0x00, 0x46, 0xDE, 0x01, 0x8E, 0x26, 0x32, 0x5B, 0x00, 0x00, 0x00, 0x07, 0x74, 0x49, 0x4D, 0x45, 
+    0x07, 0xE1, 0x06, 0x08, 0x0D, 0x31, 0x0D, 0xEB, 0x0C, 0x57, 0x94, 0x00, 0x00, 0x08, 0xAC, 0x49, 0x44, 0x41, 0x54, 0x58, 
+    0xC3, 0xAD, 0x57, 0x7B, 0x70, 0x54, 0x57, 0x19, 0xFF, 0x9D, 0x73, 0xEF, 0x6E, 0xB2, 0x21, 0xD9, 0x6C, 0x5E, 0x0D, 0x8F, 
+    0x84, 0xB6, 0x3C, 0xC2, 0x54, 0x62, 0x14, 0x68, 0x06, 0x49, 0x67, 0xD1, 0x51, 0xA0, 0xB4, 0x75, 0x9C, 0x11, 0x1D, 0xB0, 
+    0xD5, 0x71, 0x6C, 0x05, 0x43, 0xB5, 0xC8, 0x63, 0x0A, 0x66, 0x06, 0x3B, 0x23, 0xCE, 0xD4, 0x8E, 0x03, 0xD1, 0x96, 0xA0, 
+    0x03, 0xC3, 0x30, 0x63, 0x65, 0x2C, 0x2A, 0x50, 0x05, 0xC1, 0xA1, 0xEF, 0x34, 0x31, 0x08, 0x71, 0xC8, 0x83, 0x16, 0x12, 
+    0x92, 0x5D, 0x30, 0x25, 0xCD, 0x96, 0x7D, 0x84, 0x6C, 0x76, 0x73, 0x1F, 0x7B, 0xEF, 0x3D, 0x9F, 0x7F, 0xEC, 0xBD, 0xE1, 
+    0x26, 0x5D, 0xB1, 0x3A, 0x9E, 0x99, 0x33, 0x7B, 0x66, 0x77, 0xEF, 0x77, 0xBE, 0xC7, 0xEF, 0xF7, 0xFB, 0xBE, 0x0B, 0x7C, 
+    0xC2, 0xB5, 0x72, 0xE5, 0x4A, 0xE7, 0xC8, 0x5C, 0x9B, 0x03, 0x90, 0xEC, 0xCD, 0x01, 0x70, 0x8F, 0xC7, 0xE3, 0xFC, 0xF6, 
+    0x89, 0xD6, 0x27, 0xFE, 0xA3, 0xBD, 0xE4, 0xCB, 0xBD, 0x97, 0x17, 0x15, 0x16, 0x15, 0xCE, 0xE5, 0x9C, 0x57, 0x98, 0xA6, 
+    0xE5, 0x15, 0xC2, 0x82, 0x61, 0x18, 0x7A, 0x3C, 0x1E, 0xFF, 0xB0, 0xBF, 0xBF, 0xFF, 0x66, 0x63, 0x63, 0xE3, 0x75, 0x00, 
+    0xAC, 0xAC, 0xAC, 0x4C, 0x24, 0x12, 0x09, 0x02, 0x40, 0xF8, 0x7F, 0xAC, 0xA1, 0xA1, 0xA1, 0x2F, 0x29, 0x8A, 0xF2, 0x27, 
+    0x55, 0x55, 0xAF, 0x69, 0x9A, 0x9E, 0xD6, 0x75, 0x9D, 0x74, 0x5D, 0x23, 0x4D, 0xD3, 0x48, 0x51, 0x14, 0x4A, 0x26, 0x93, 
+    0xD1, 0x44, 0x22, 0xD1, 0x3B, 0x38, 0x38, 0xF8, 0xAB, 0x67, 0x9E, 0x79, 0xA6, 0x0E, 0x40, 0x1E, 0x00, 0x8F, 0x9D, 0x99, 
+    0xFF, 0x6D, 0x35, 0x34, 0x34, 0x70, 0x00, 0xDE, 0x74, 0x3A, 0x7D, 0xC4, 0x30, 0x8C, 0x8C, 0x91, 0xC9, 0x50, 0x26, 0x93, 
+    0x21, 0x5D, 0xD7, 0x49, 0x55, 0x55, 0x52, 0x55, 0x95, 0x14, 0x45, 0xA1, 0x89, 0x89, 0x09, 0x4A, 0x4F, 0xA4, 0x29, 0x95, 
+    0x4A, 0xD1, 0xF8, 0xF8, 0xB8, 0x48, 0xC4, 0x13, 0xD1, 0x13, 0x27, 0x4E, 0xFC, 0x00, 0x40, 0xA5, 0x24, 0x49, 0xF9, 0x77, 
+    0xCB, 0xF4, 0x5D, 0xBD, 0xAB, 0xAD, 0xAD, 0x9D, 0xA1, 0xA8, 0xEA, 0x9B, 0xF9, 0xF9, 0xF9, 0x4F, 0x11, 0xC8, 0x43, 0x00, 
+    0x88, 0x08, 0x82, 0x04, 0x88, 0xB2, 0x67, 0x22, 0x02, 0x81, 0x40, 0x22, 0x7B, 0x06, 0x11, 0x93, 0x3D, 0x72, 0xC5, 0xEA, 
+    0xD5, 0xAB, 0x0F, 0x1C, 0x7B, 0xE5, 0x95, 0x8D, 0x96, 0x65, 0x55, 0x02, 0xF0, 0x31, 0xC6, 0xFE, 0xBB, 0x4C, 0x9C, 0x3D, 
+    0x7B, 0xE6, 0x1E, 0x4D, 0xD3, 0xFE, 0x61, 0x98, 0x26, 0x65, 0x32, 0x19, 0xCA, 0xE8, 0xFA, 0x64, 0xE4, 0x8A, 0xE2, 0x8A, 
+    0x3C, 0x9D, 0x72, 0x22, 0xA7, 0x64, 0x32, 0x49, 0xC9, 0x64, 0x92, 0x6E, 0xDF, 0xBE, 0x4D, 0xA3, 0xA3, 0xA3, 0x34, 0x3E, 
+    0x3E, 0x4E, 0x27, 0x4F, 0x9E, 0xF8, 0x39, 0x80, 0xB9, 0x00, 0x0A, 0x72, 0x05, 0x2C, 0xE5, 0x02, 0xE6, 0x63, 0x8F, 0x3D, 
+    0x9A, 0xF7, 0xEC, 0xB3, 0xBB, 0xF6, 0x7B, 0xBD, 0xDE, 0x47, 0x49, 0x88, 0x6C, 0x64, 0x00, 0x88, 0xB2, 0x67, 0xC6, 0x18, 
+    0x64, 0x59, 0x06, 0xE7, 0x1C, 0x92, 0x24, 0x65, 0xB3, 0x22, 0x9C, 0xAC, 0x88, 0xC9, 0xCC, 0x58, 0x96, 0x85, 0xEA, 0xB9, 
+    0xD5, 0xCB, 0xE7, 0xDD, 0x3F, 0x2F, 0x7A, 0xF6, 0xEC, 0xD9, 0x3E, 0xCE, 0xB9, 0x41, 0x44, 0xE2, 0x3F, 0x3A, 0xF0, 0xF6, 
+    0xDB, 0x6F, 0xAF, 0x09, 0x04, 0x8A, 0x9F, 0x27, 0x22, 0xC9, 0x4E, 0x2B, 0x08, 0x80, 0x10, 0x04, 0xCE, 0x19, 0x26, 0xD2, 
+    0x13, 0xFA, 0x1F, 0x8F, 0x1F, 0x6F, 0x3B, 0x75, 0xEA, 0xD4, 0xDF, 0xCF, 0x9F, 0x3F, 0xDF, 0xE3, 0xF3, 0xF9, 0xA8, 0xB2, 
+    0xB2, 0x72, 0x26, 0x40, 0xAE, 0xB2, 0xC0, 0x71, 0x9C, 0x97, 0x57, 0x54, 0x54, 0x0F, 0x0E, 0x0E, 0x76, 0x87, 0xC3, 0xE1, 
+    0x38, 0x80, 0x8C, 0x9B, 0x19, 0xD3, 0x1D, 0x60, 0x47, 0x8E, 0x1C, 0x29, 0x5C, 0xF6, 0xE0, 0xB2, 0x9F, 0x48, 0xB2, 0xF4, 
+    0x69, 0xB7, 0x31, 0x64, 0xA3, 0xA4, 0xB6, 0xB6, 0xF6, 0x9E, 0xA5, 0xCB, 0x96, 0xFE, 0xBA, 0xB3, 0xF3, 0x62, 0xEF, 0xD0, 
+    0xD0, 0x50, 0xA8, 0xAF, 0xAF, 0x2F, 0xB4, 0x77, 0xEF, 0xDE, 0xD6, 0x91, 0x91, 0x91, 0xCB, 0xF5, 0xF5, 0x0F, 0xD6, 0xF8, 
+    0x7C, 0x3E, 0x3F, 0x5C, 0x99, 0x00, 0x00, 0x9F, 0xCF, 0x57, 0xAE, 0x69, 0xDA, 0xCD, 0xD7, 0x5E, 0x7B, 0xAD, 0x1F, 0x40, 
+    0x1A, 0x80, 0xC8, 0x09, 0xC2, 0xF9, 0xF3, 0xE7, 0x43, 0x08, 0x51, 0xE0, 0x91, 0x3D, 0x0F, 0x4F, 0x82, 0x0A, 0x04, 0x12, 
+    0x02, 0x8C, 0x31, 0x9C, 0x3A, 0x7D, 0xBA, 0x63, 0xED, 0xDA, 0xB5, 0x47, 0x4F, 0xFF, 0xE5, 0x74, 0xC3, 0xD5, 0xAB, 0x57, 
+    0xF7, 0x75, 0x76, 0x76, 0x1E, 0xBE, 0x70, 0xE1, 0xC2, 0x6F, 0x6E, 0xDC, 0xB8, 0xF1, 0x42, 0xED, 0xE2, 0xC5, 0x9E, 0xFA, 
+    0xFA, 0xE5, 0x3B, 0xD3, 0xA9, 0x54, 0x8C, 0x98, 0x03, 0xD0, 0xAC, 0x23, 0x9C, 0x73, 0x2C, 0x5C, 0xB8, 0xB0, 0xBE, 0xBC, 
+    0xBC, 0x7C, 0x16, 0x80, 0xBB, 0xB2, 0x02, 0xEF, 0xBD, 0xFF, 0xDE, 0x9A, 0x4C, 0x26, 0x43, 0x9A, 0xA6, 0x4D, 0xD2, 0x4C, 
+    0x55, 0x35, 0xEA, 0xE9, 0xE9, 0xFD, 0x00, 0xC0, 0x8E, 0x8E, 0x8E, 0x8E, 0x56, 0x45, 0x51, 0x29, 0x99, 0x4C, 0xD2, 0xD8, 
+    0xD8, 0x18, 0xC5, 0xE3, 0x71, 0x73, 0x74, 0x74, 0x94, 0x12, 0x89, 0x04, 0x6D, 0xDC, 0xB8, 0x71, 0x7B, 0x63, 0x63, 0xE3, 
+    0xF6, 0x58, 0x3C, 0x4E, 0xB7, 0xA2, 0x51, 0xBA, 0x75, 0xEB, 0x23, 0x8A, 0x44, 0x22, 0x14, 0x89, 0x44, 0xE8, 0xF2, 0xE5, 
+    0xCB, 0x91, 0x9A, 0x9A, 0x9A, 0xAF, 0x01, 0x98, 0x05, 0x40, 0xFE, 0xB7, 0x34, 0x0C, 0x14, 0x07, 0x96, 0x65, 0x41, 0x75, 
+    0xA7, 0x9E, 0x9C, 0x03, 0x6F, 0xBD, 0xF5, 0x46, 0xF7, 0x8A, 0x15, 0x2B, 0x50, 0x57, 0x57, 0xF7, 0xF9, 0x8C, 0xA1, 0x83, 
+    0x88, 0x20, 0x49, 0x12, 0xEA, 0xEB, 0xEB, 0xF7, 0x1F, 0x3C, 0x78, 0xF0, 0x38, 0x63, 0x40, 0x63, 0x63, 0xE3, 0xB7, 0x8F, 
+    0x1E, 0x3D, 0x3A, 0x14, 0x8F, 0xC5, 0xFA, 0x99, 0x8D, 0x19, 0xC7, 0x46, 0x51, 0x51, 0xD1, 0x3D, 0xB2, 0x2C, 0x07, 0xA6, 
+    0xB3, 0xE1, 0x63, 0x0E, 0x78, 0xBD, 0xDE, 0x79, 0x42, 0xD8, 0xC0, 0xB3, 0xB7, 0x61, 0x98, 0x18, 0x1E, 0xFE, 0x30, 0xB2, 
+    0x65, 0xCB, 0x96, 0x25, 0x04, 0x02, 0x04, 0x6C, 0xD4, 0x13, 0x96, 0x2F, 0x5F, 0x3E, 0x63, 0xC1, 0x82, 0x05, 0x45, 0x00, 
+    0xC3, 0x82, 0x05, 0x0B, 0x3E, 0xAB, 0x28, 0x4A, 0xDE, 0xF8, 0xF8, 0x78, 0x94, 0x5C, 0xCF, 0x13, 0x11, 0x0A, 0x0A, 0x0A, 
+    0xB8, 0x24, 0x49, 0x33, 0x6C, 0x85, 0xE4, 0x4E, 0x19, 0xE4, 0xE9, 0x7D, 0xC1, 0xB2, 0x4C, 0x0B, 0x24, 0xB2, 0xE2, 0xE2, 
+    0x02, 0xA1, 0x10, 0x64, 0xA6, 0xD3, 0xE9, 0x14, 0x08, 0x10, 0x24, 0x00, 0x22, 0x64, 0x32, 0x19, 0x1C, 0x3E, 0x7C, 0xF8, 
+    0x7B, 0x86, 0x61, 0xC0, 0x34, 0x4D, 0x08, 0x21, 0x00, 0x20, 0xDF, 0xB2, 0x2C, 0xCB, 0x79, 0x16, 0x44, 0x10, 0x36, 0x4D, 
+    0x2D, 0xCB, 0x92, 0x6D, 0xE0, 0xB3, 0x5C, 0x19, 0x20, 0x00, 0x6C, 0x6C, 0x2C, 0x19, 0x76, 0x2E, 0x77, 0xA2, 0x94, 0x38, 
+    0xC7, 0xD2, 0xA5, 0x4B, 0xAA, 0x9B, 0x9B, 0x9B, 0x2F, 0x58, 0x96, 0x65, 0xAB, 0x61, 0xD6, 0xB8, 0xAA, 0xAA, 0x30, 0x4D, 
+    0x03, 0x92, 0x24, 0xE1, 0xE2, 0xC5, 0x8B, 0x5D, 0x79, 0x79, 0x79, 0xAC, 0xA2, 0xA2, 0xA2, 0x26, 0xFB, 0xAC, 0xC8, 0xFE, 
+    0x0F, 0x40, 0x6A, 0x7C, 0xDC, 0xC8, 0xE8, 0xBA, 0xE9, 0x66, 0x40, 0xAE, 0x12, 0xB0, 0xAE, 0xEE, 0xEE, 0x0B, 0x44, 0x70, 
+    0xA2, 0x01, 0x09, 0x82, 0x69, 0x9A, 0x08, 0xAE, 0x0C, 0x3E, 0x74, 0xF3, 0xE6, 0x4D, 0xEB, 0x9D, 0x77, 0xDE, 0x39, 0x22, 
+    0x7B, 0xB2, 0x89, 0x13, 0xB6, 0x0C, 0x03, 0x0C, 0xAA, 0xAA, 0x52, 0xD3, 0x8F, 0x9A, 0x4E, 0x6F, 0xDF, 0xBE, 0x7D, 0x9E, 
+    0xDF, 0xEF, 0x9F, 0x63, 0x89, 0x3B, 0x72, 0x0D, 0x30, 0xDC, 0x8A, 0x46, 0x6F, 0xA9, 0x9A, 0xA6, 0xD8, 0x3A, 0x20, 0x1C, 
+    0x2D, 0x98, 0xE2, 0x80, 0x24, 0x49, 0xE8, 0xBA, 0x74, 0x69, 0x58, 0xD7, 0xF5, 0x51, 0xD8, 0x42, 0x42, 0x20, 0x08, 0x4B, 
+    0xA0, 0xBC, 0xB4, 0xBC, 0xEC, 0xDC, 0xB9, 0x73, 0x4F, 0x6F, 0xD8, 0xB0, 0xE1, 0xEC, 0xAB, 0x27, 0x5F, 0x3D, 0xA8, 0x28, 
+    0xCA, 0xB8, 0xAE, 0xEB, 0x6A, 0x46, 0xCB, 0xA8, 0xC3, 0xC3, 0xC3, 0xC3, 0x4F, 0x3D, 0xF9, 0x64, 0x33, 0x18, 0xE2, 0x5B, 
+    0xB7, 0xFE, 0x70, 0xB7, 0x61, 0x18, 0x53, 0x30, 0x04, 0x06, 0x84, 0x42, 0xE1, 0x7F, 0x26, 0x93, 0xC9, 0x31, 0x00, 0x9A, 
+    0x3B, 0x0B, 0x6E, 0x0C, 0xC0, 0xB2, 0x2C, 0xEA, 0xED, 0xED, 0x1D, 0x8B, 0x45, 0x63, 0x7F, 0x9E, 0x35, 0x6B, 0xE6, 0x53, 
+    0x59, 0x03, 0x02, 0x04, 0xC0, 0x30, 0x0D, 0xD4, 0xD5, 0xD5, 0x3D, 0xD4, 0xDE, 0xDE, 0xC6, 0xF7, 0xEF, 0x6F, 0x79, 0x65, 
+    0xE7, 0xCE, 0x9D, 0x4F, 0x07, 0x02, 0x81, 0x22, 0xCB, 0xB2, 0xA4, 0x54, 0x2A, 0x85, 0x1D, 0x3B, 0x76, 0x7C, 0x6A, 0xFD, 
+    0xFA, 0xF5, 0x7B, 0x2C, 0x6B, 0x2A, 0xF8, 0x40, 0x04, 0x4D, 0x55, 0xAD, 0x77, 0xDF, 0x6D, 0xED, 0x4D, 0xA7, 0xD3, 0x71, 
+    0x00, 0x8A, 0xDB, 0x01, 0x96, 0x63, 0x40, 0xF1, 0x1E, 0x3B, 0x76, 0x6C, 0xCD, 0xAA, 0x55, 0xAB, 0x5E, 0x96, 0x65, 0xB9, 
+    0x24, 0x0B, 0x38, 0x47, 0x58, 0x04, 0x18, 0x38, 0x34, 0x5D, 0x4B, 0xC7, 0x62, 0xB1, 0x7E, 0x55, 0x55, 0x27, 0x88, 0x88, 
+    0x15, 0x17, 0x17, 0xCF, 0x2C, 0x29, 0x29, 0x59, 0x48, 0x44, 0xCC, 0xC1, 0x06, 0x91, 0xDD, 0x21, 0x41, 0x18, 0x18, 0x18, 
+    0x18, 0x78, 0xE2, 0x89, 0x27, 0x9A, 0x13, 0x89, 0xC4, 0x79, 0x00, 0xD7, 0x01, 0xA8, 0x4E, 0x09, 0x72, 0x29, 0x92, 0x04, 
+    0x60, 0x46, 0x57, 0x57, 0xF7, 0xBE, 0x7B, 0xEF, 0x9D, 0xBB, 0xC9, 0x29, 0x45, 0x16, 0x13, 0xE4, 0xAA, 0x2B, 0x30, 0x9D, 
+    0x6A, 0x42, 0x08, 0xB7, 0x6C, 0x03, 0x00, 0x4C, 0xD3, 0xB4, 0x36, 0x6D, 0xDA, 0xB4, 0xAF, 0xB5, 0xB5, 0xF5, 0x0D, 0x00, 
+    0x57, 0x01, 0xC4, 0x00, 0x98, 0x77, 0x9B, 0x07, 0x44, 0x55, 0x55, 0x95, 0xB9, 0x74, 0xE9, 0x92, 0xE7, 0x23, 0x91, 0xC8, 
+    0xBB, 0x53, 0x9B, 0x0B, 0xA6, 0x5C, 0x26, 0x84, 0x00, 0x09, 0x01, 0x12, 0x77, 0xBA, 0xA1, 0x73, 0x39, 0x03, 0x83, 0x10, 
+    0x16, 0xED, 0xD9, 0xB3, 0xE7, 0xE5, 0xD6, 0xD6, 0xD6, 0x1E, 0x00, 0x11, 0x00, 0x29, 0x3B, 0xFD, 0x39, 0x69, 0x88, 0xC6, 
+    0xC6, 0x46, 0x06, 0x80, 0xB5, 0xB7, 0xB7, 0xAF, 0xBB, 0x74, 0xA9, 0xEB, 0xBB, 0xC1, 0x60, 0xF0, 0xA7, 0x57, 0xAE, 0x5C, 
+    0x79, 0x5D, 0x08, 0x02, 0xCB, 0x11, 0x31, 0x11, 0x41, 0x00, 0xF6, 0x80, 0x62, 0xF7, 0x0D, 0x22, 0x70, 0xCE, 0x91, 0x4A, 
+    0xA7, 0xD4, 0x9F, 0xBD, 0xF0, 0xC2, 0xCB, 0x7D, 0x7D, 0x7D, 0xA1, 0x33, 0x67, 0xCE, 0x7C, 0x75, 0xDB, 0xB6, 0x6D, 0x33, 
+    0x01, 0x78, 0x38, 0xE7, 0x3C, 0x67, 0x3B, 0xEE, 0xBC, 0xD8, 0x89, 0xCD, 0x9B, 0x37, 0x23, 0x14, 0x0A, 0x7D, 0xC7, 0x5F, 
+    0xEC, 0x3F, 0x1C, 0x08, 0x04, 0xBE, 0xB8, 0x76, 0xED, 0xDA, 0xF2, 0x60, 0x30, 0x78, 0x68, 0xEE, 0xDC, 0xEA, 0x68, 0x75, 
+    0x75, 0xF5, 0x7C, 0x9F, 0xAF, 0xA0, 0x00, 0x36, 0xB7, 0xA7, 0x4F, 0x42, 0x0C, 0x00, 0xE7, 0x1C, 0x9C, 0x73, 0x5C, 0xEA, 
+    0xBA, 0x74, 0x75, 0xF7, 0xEE, 0xDD, 0xBF, 0x25, 0xC2, 0xE8, 0x2F, 0x9A, 0x9B, 0x37, 0x57, 0x55, 0x55, 0x7D, 0x6E, 0xF1, 
+    0xE2, 0xC5, 0xC1, 0x8E, 0x8E, 0x8E, 0xB6, 0x68, 0x34, 0x9A, 0x06, 0x60, 0xE4, 0xC4, 0xC0, 0xF9, 0x8E, 0xF3, 0x9F, 0xA9, 
+    0x59, 0x54, 0xD3, 0x03, 0x42, 0x96, 0x7E, 0x42, 0xD0, 0xED, 0xB1, 0xDB, 0x1F, 0x3C, 0xF7, 0xE3, 0xE7, 0xF6, 0x1D, 0x3F, 
+    0x7E, 0x3C, 0xD2, 0xD2, 0xD2, 0xF2, 0xE5, 0x15, 0x2B, 0x56, 0x7C, 0x61, 0xD6, 0xEC, 0x59, 0xF7, 0x71, 0x30, 0x5B, 0x21, 
+    0x05, 0xC0, 0x18, 0xD2, 0xA9, 0x54, 0xE6, 0xDA, 0xB5, 0x81, 0xC1, 0x17, 0x5F, 0xFC, 0xE5, 0xEB, 0x6D, 0x6D, 0x6D, 0xA1, 
+    0xBD, 0x7B, 0xF7, 0xD6, 0x3F, 0xBC, 0x66, 0xCD, 0xD7, 0xBD, 0xDE, 0xBC, 0x42, 0x61, 0xCF, 0x20, 0xD1, 0x68, 0xB4, 0x37, 
+    0x18, 0x0C, 0x7E, 0x43, 0x92, 0xA4, 0x11, 0xCB, 0xB2, 0xD2, 0x00, 0xC4, 0x14, 0x07, 0x22, 0x91, 0xC8, 0x1B, 0xB2, 0x47, 
+    0x5E, 0x05, 0x71, 0x47, 0x6E, 0x29, 0x2B, 0xBD, 0x34, 0x30, 0x30, 0xF0, 0x66, 0x53, 0x53, 0xD3, 0xEF, 0xBA, 0xBB, 0xBB, 
+    0xF5, 0xC2, 0xC2, 0xC2, 0xA2, 0x60, 0x30, 0x58, 0xC5, 0x18, 0x3C, 0x44, 0x60, 0x89, 0x78, 0x42, 0x6F, 0xFF, 0x5B, 0x7B, 
+    0x2C, 0x10, 0x08, 0x58, 0x1B, 0x36, 0x6C, 0x98, 0xBD, 0x71, 0xD3, 0xA6, 0x6F, 0x96, 0x95, 0x96, 0xCE, 0x33, 0x4D, 0xD3, 
+    0x55, 0x2E, 0x01, 0xCE, 0x25, 0xB4, 0xB4, 0xB4, 0xEC, 0x3A, 0x70, 0xE0, 0xC0, 0xEF, 0x01, 0xDC, 0x02, 0x60, 0x4C, 0x3A, 
+    0xF0, 0xD2, 0x4B, 0x2F, 0x55, 0x3E, 0xFE, 0xF8, 0xE3, 0x21, 0xC6, 0x58, 0xA1, 0x23, 0xC1, 0xD9, 0xBE, 0x63, 0xD7, 0x95, 
+    0x31, 0x10, 0x11, 0x62, 0xB1, 0x58, 0xDF, 0xC8, 0xC8, 0xC8, 0x60, 0x28, 0x14, 0xBA, 0x31, 0x31, 0x31, 0xA1, 0x01, 0xE0, 
+    0x65, 0x65, 0x65, 0xC5, 0xF7, 0xDD, 0x7F, 0xDF, 0xC2, 0xAA, 0x39, 0x55, 0x4B, 0x0A, 0x0A, 0x7C, 0x01, 0xC3, 0x30, 0x27, 
+    0x65, 0x7C, 0x8A, 0x26, 0x00, 0xE8, 0xEF, 0xEF, 0x6F, 0x5F, 0xB7, 0x6E, 0xDD, 0xF7, 0x01, 0x0C, 0x01, 0x98, 0x98, 0x14, 
+    0xA2, 0x39, 0xB3, 0x67, 0x97, 0x10, 0x09, 0x41, 0xC4, 0xA6, 0x88, 0xC8, 0xE4, 0x7C, 0x67, 0x83, 0xB0, 0xB4, 0xB4, 0xF4, 
+    0x81, 0xD2, 0xD2, 0xD2, 0x07, 0x6A, 0x6B, 0x6B, 0xB3, 0x0C, 0x70, 0xD1, 0x54, 0x08, 0x01, 0x5D, 0xCF, 0x4C, 0x8E, 0x70, 
+    0xF6, 0xF7, 0x8C, 0xEE, 0xC8, 0x2A, 0x24, 0x59, 0xF6, 0x03, 0xF0, 0xDB, 0xEF, 0x0C, 0x77, 0x46, 0xE5, 0xEB, 0xE1, 0xB0, 
+    0x4A, 0x04, 0x3E, 0xBD, 0x8B, 0x39, 0x93, 0x8D, 0x10, 0xD9, 0x71, 0xDC, 0xD5, 0xD9, 0x1C, 0x9C, 0xC0, 0xB2, 0xAC, 0x49, 
+    0x26, 0x7C, 0x4C, 0x17, 0xEC, 0xCE, 0x26, 0x48, 0x00, 0x0C, 0xD0, 0x35, 0x35, 0xF3, 0xB1, 0x76, 0x1C, 0x08, 0x04, 0xF8, 
+    0xAE, 0xA6, 0xA6, 0xA1, 0x87, 0x1F, 0x79, 0xE4, 0x0F, 0x65, 0x65, 0x65, 0xDF, 0x22, 0x21, 0x98, 0x20, 0x62, 0x44, 0x04, 
+    0x61, 0x59, 0x42, 0x10, 0x09, 0xCB, 0xB2, 0x04, 0x18, 0x10, 0x1E, 0x08, 0x87, 0xB9, 0xC4, 0x21, 0xC9, 0x9C, 0xBD, 0xFF, 
+    0xFE, 0x95, 0x1B, 0x95, 0x95, 0x95, 0x81, 0x92, 0x92, 0x92, 0x62, 0xD3, 0x34, 0xC9, 0x5F, 0xEC, 0x0F, 0x94, 0x14, 0x97, 
+    0x94, 0x13, 0x88, 0x11, 0x11, 0x67, 0x9C, 0x4B, 0xB0, 0xED, 0x10, 0x11, 0x74, 0x5D, 0xD7, 0x0F, 0x1D, 0x3A, 0xF4, 0x57, 
+    0xBB, 0x21, 0x99, 0x00, 0x88, 0xB9, 0xE6, 0x41, 0x6F, 0x38, 0x1C, 0xCE, 0xDF, 0xB6, 0x75, 0xDB, 0x57, 0x4A, 0xCB, 0x4A, 
+    0x17, 0x2B, 0x8A, 0xE2, 0x25, 0x22, 0x1E, 0x0E, 0x87, 0x93, 0xA1, 0x50, 0xE8, 0x76, 0x4F, 0x4F, 0x4F, 0xD4, 0x1E, 0x28, 
+    0x4D, 0xDB, 0x80, 0x65, 0x53, 0xC9, 0xB4, 0xA3, 0x91, 0x9D, 0x4F, 0xBF, 0xDF, 0x5F, 0xBE, 0x68, 0xD1, 0xA2, 0x92, 0x86, 
+    0x86, 0x86, 0x6A, 0x00, 0x5E, 0x22, 0xE2, 0x86, 0x61, 0x88, 0x93, 0x27, 0x4F, 0x5E, 0x8B, 0x46, 0xA3, 0x21, 0xCE, 0xF9, 
+    0x75, 0x21, 0xC4, 0x47, 0x00, 0x74, 0x37, 0x0B, 0xB8, 0xC7, 0xE3, 0xF1, 0x1A, 0x86, 0x51, 0x68, 0xD7, 0x28, 0xDF, 0x4E, 
+    0x95, 0x73, 0x89, 0xB3, 0x0D, 0xFB, 0x72, 0xE1, 0x6A, 0xAB, 0xCC, 0x95, 0x56, 0x67, 0xE8, 0x90, 0x5D, 0x5B, 0x72, 0xEC, 
+    0x30, 0xC6, 0x52, 0x44, 0x94, 0xB4, 0xFB, 0x81, 0xC8, 0xD5, 0x8C, 0xDC, 0xAF, 0xDB, 0xCC, 0x75, 0xC9, 0xF4, 0x3D, 0x65, 
+    0x90, 0xC9, 0xF1, 0xC6, 0xCD, 0xA7, 0x39, 0x06, 0xDB, 0x96, 0xE5, 0x0A, 0x00, 0xFF, 0x02, 0xBD, 0xA5, 0x42, 0x06, 0x68, 
+    0x68, 0x77, 0x24, 0x00, 0x00, 0x00, 0x00, 0x49, 0x45, 0x4E, 0x44, 0xAE, 0x42, 0x60, 0x82, 
+};
+
+XEmbeddedContent web_cam2web_white_png =
+{
+    2335,
+    "image/png",
+    cam2web_white_png_data,
+    "43ac3572167ea808",
+    0,
+    nullptr,
+    0,
+    nullptr,
+};
+
+#endif
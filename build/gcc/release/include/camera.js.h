@@ -0,0 +1,396 @@
+/*
+ * Auto generated header file to be used with web2cam
+ *
+ * Source file: camera.js
+ */
+
+#ifndef camera_js_h
+#define camera_js_h
+
+#include "XWebServer.hpp"
+
+uint8_t camera_js_data[]
+{
+    0x76, 0x61, 0x72, 0x20, 0x43, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x3D, 0x20, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x28, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6A, 0x70, 0x65, 0x67, 
+    0x55, 0x72, 0x6C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x27, 0x2F, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 
+    0x2F, 0x6A, 0x70, 0x65, 0x67, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6D, 0x6A, 0x70, 0x65, 
+    0x67, 0x55, 0x72, 0x6C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x27, 0x2F, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 
+    0x2F, 0x6D, 0x6A, 0x70, 0x65, 0x67, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x77, 0x73, 0x55, 
+    0x72, 0x6C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x27, 0x2F, 0x63, 0x61, 0x6D, 0x65, 0x72, 
+    0x61, 0x2F, 0x77, 0x73, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x3B, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x27, 0x77, 0x73, 0x27, 0x2C, 0x20, 
+    0x27, 0x6D, 0x6A, 0x70, 0x65, 0x67, 0x27, 0x20, 0x6F, 0x72, 0x20, 0x27, 0x6A, 0x70, 0x65, 0x67, 0x27, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x3B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 
+    0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x53, 0x74, 0x61, 0x72, 0x74, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x53, 0x65, 0x71, 0x75, 0x65, 0x6E, 
+    0x63, 0x65, 0x20, 0x20, 0x3D, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x69, 0x6D, 0x61, 
+    0x67, 0x65, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x55, 0x72, 0x6C, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 
+    0x20, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x69, 0x6D, 0x61, 
+    0x67, 0x65, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x46, 0x72, 0x61, 0x6D, 0x65, 
+    0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x66, 0x72, 
+    0x65, 0x73, 0x68, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x28, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x27, 
+    0x77, 0x73, 0x27, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x53, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x28, 0x20, 
+    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x27, 
+    0x6D, 0x6A, 0x70, 0x65, 0x67, 0x27, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x45, 0x6C, 0x65, 0x6D, 
+    0x65, 0x6E, 0x74, 0x2E, 0x73, 0x72, 0x63, 0x20, 0x3D, 0x20, 0x6D, 0x6A, 0x70, 0x65, 0x67, 0x55, 0x72, 0x6C, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 
+    0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x4E, 0x65, 0x78, 0x74, 0x49, 0x6D, 0x61, 0x67, 
+    0x65, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x68, 0x6F, 0x77, 
+    0x49, 0x6D, 0x61, 0x67, 0x65, 0x28, 0x20, 0x62, 0x6C, 0x6F, 0x62, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x4F, 0x62, 
+    0x6A, 0x65, 0x63, 0x74, 0x55, 0x72, 0x6C, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x55, 0x52, 0x4C, 0x2E, 0x72, 0x65, 0x76, 0x6F, 
+    0x6B, 0x65, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x55, 0x52, 0x4C, 0x28, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x4F, 0x62, 
+    0x6A, 0x65, 0x63, 0x74, 0x55, 0x72, 0x6C, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x55, 0x72, 0x6C, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x55, 0x52, 0x4C, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x4F, 0x62, 
+    0x6A, 0x65, 0x63, 0x74, 0x55, 0x52, 0x4C, 0x28, 0x20, 0x62, 0x6C, 0x6F, 0x62, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x72, 
+    0x63, 0x20, 0x3D, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x55, 0x72, 0x6C, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x67, 0x65, 0x74, 0x20, 0x66, 0x72, 
+    0x61, 0x6D, 0x65, 0x73, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x20, 
+    0x2D, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x73, 0x65, 0x6E, 0x64, 0x73, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x6F, 
+    0x6E, 0x65, 0x73, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x61, 0x66, 0x74, 0x65, 0x72, 0x20, 0x77, 0x65, 0x20, 0x74, 0x65, 
+    0x6C, 0x6C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x77, 0x65, 0x72, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x6E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x70, 0x65, 0x6E, 0x53, 0x6F, 0x63, 
+    0x6B, 0x65, 0x74, 0x28, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x76, 0x61, 0x72, 0x20, 0x67, 0x6F, 0x74, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 
+    0x73, 0x65, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x20, 
+    0x3D, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x28, 0x20, 0x28, 0x20, 0x28, 
+    0x20, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x63, 0x6F, 0x6C, 0x20, 0x3D, 
+    0x3D, 0x20, 0x27, 0x68, 0x74, 0x74, 0x70, 0x73, 0x3A, 0x27, 0x20, 0x29, 0x20, 0x3F, 0x20, 0x27, 0x77, 0x73, 0x73, 0x3A, 
+    0x2F, 0x2F, 0x27, 0x20, 0x3A, 0x20, 0x27, 0x77, 0x73, 0x3A, 0x2F, 0x2F, 0x27, 0x20, 0x29, 0x20, 0x2B, 0x20, 0x6C, 0x6F, 
+    0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x68, 0x6F, 0x73, 0x74, 0x20, 0x2B, 0x20, 0x77, 0x73, 0x55, 0x72, 0x6C, 0x20, 
+    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x2E, 0x62, 0x69, 
+    0x6E, 0x61, 0x72, 0x79, 0x54, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x27, 0x61, 0x72, 0x72, 0x61, 0x79, 0x62, 0x75, 0x66, 
+    0x66, 0x65, 0x72, 0x27, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6F, 0x63, 0x6B, 0x65, 
+    0x74, 0x2E, 0x6F, 0x6E, 0x6D, 0x65, 0x73, 0x73, 0x61, 0x67, 0x65, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x6F, 0x66, 
+    0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 0x42, 0x75, 0x66, 0x66, 0x65, 0x72, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x76, 0x65, 0x72, 0x73, 
+    0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x20, 0x73, 0x69, 0x7A, 0x65, 0x2C, 0x20, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x2C, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2C, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 
+    0x64, 0x2C, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x2C, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x73, 0x74, 0x61, 
+    0x6D, 0x70, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x61, 0x72, 0x20, 0x76, 0x69, 0x65, 0x77, 0x20, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x61, 0x56, 
+    0x69, 0x65, 0x77, 0x28, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x20, 0x29, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x66, 
+    0x72, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x3A, 0x20, 0x76, 
+    0x69, 0x65, 0x77, 0x2E, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6E, 0x74, 0x33, 0x32, 0x28, 0x20, 0x38, 0x20, 0x29, 0x20, 0x2A, 
+    0x20, 0x34, 0x32, 0x39, 0x34, 0x39, 0x36, 0x37, 0x32, 0x39, 0x36, 0x20, 0x2B, 0x20, 0x76, 0x69, 0x65, 0x77, 0x2E, 0x67, 
+    0x65, 0x74, 0x55, 0x69, 0x6E, 0x74, 0x33, 0x32, 0x28, 0x20, 0x31, 0x32, 0x20, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6C, 0x6F, 0x62, 
+    0x3A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x42, 0x6C, 0x6F, 0x62, 0x28, 0x20, 0x5B, 0x20, 0x6E, 0x65, 
+    0x77, 0x20, 0x55, 0x69, 0x6E, 0x74, 0x38, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x20, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 
+    0x64, 0x61, 0x74, 0x61, 0x2C, 0x20, 0x76, 0x69, 0x65, 0x77, 0x2E, 0x67, 0x65, 0x74, 0x55, 0x69, 0x6E, 0x74, 0x38, 0x28, 
+    0x20, 0x31, 0x20, 0x29, 0x20, 0x29, 0x20, 0x5D, 0x2C, 0x20, 0x7B, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x20, 0x27, 0x69, 
+    0x6D, 0x61, 0x67, 0x65, 0x2F, 0x6A, 0x70, 0x65, 0x67, 0x27, 0x20, 0x7D, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x67, 0x6F, 0x74, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x73, 
+    0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x20, 0x6F, 0x6E, 0x6C, 0x79, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x6C, 0x61, 0x74, 0x65, 0x73, 0x74, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x69, 0x66, 0x20, 0x74, 
+    0x68, 0x65, 0x79, 0x20, 0x63, 0x6F, 0x6D, 0x65, 0x20, 0x66, 0x61, 0x73, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 
+    0x20, 0x62, 0x72, 0x6F, 0x77, 0x73, 0x65, 0x72, 0x20, 0x64, 0x65, 0x63, 0x6F, 0x64, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 
+    0x6D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x28, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x65, 0x6E, 0x64, 
+    0x69, 0x6E, 0x67, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x3B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x46, 
+    0x72, 0x61, 0x6D, 0x65, 0x28, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x3B, 0x0A, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x2E, 0x6F, 0x6E, 0x63, 0x6C, 0x6F, 0x73, 
+    0x65, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x6F, 
+    0x63, 0x6B, 0x65, 0x74, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x4C, 0x6F, 0x61, 0x64, 
+    0x69, 0x6E, 0x67, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 
+    0x6E, 0x75, 0x6C, 0x6C, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 
+    0x2F, 0x20, 0x66, 0x61, 0x6C, 0x6C, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x6F, 0x20, 0x4D, 0x4A, 0x50, 0x45, 0x47, 
+    0x20, 0x69, 0x66, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x20, 0x64, 0x6F, 0x65, 0x73, 0x20, 0x6E, 
+    0x6F, 0x74, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x20, 0x61, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x2C, 0x20, 0x6F, 0x74, 0x68, 0x65, 
+    0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x72, 0x65, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x21, 0x67, 0x6F, 0x74, 0x46, 0x72, 0x61, 
+    0x6D, 0x65, 0x73, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x6F, 0x64, 0x65, 
+    0x20, 0x3D, 0x20, 0x27, 0x6D, 0x6A, 0x70, 0x65, 0x67, 0x27, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 
+    0x74, 0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28, 0x20, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x49, 0x6D, 0x61, 
+    0x67, 0x65, 0x2C, 0x20, 0x31, 0x30, 0x30, 0x30, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x7D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x28, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6D, 0x61, 0x67, 
+    0x65, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x53, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x3D, 0x20, 
+    0x66, 0x72, 0x61, 0x6D, 0x65, 0x2E, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x28, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 
+    0x2E, 0x62, 0x6C, 0x6F, 0x62, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x2F, 0x2F, 0x20, 0x6C, 0x65, 0x74, 0x20, 0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x6B, 0x6E, 0x6F, 0x77, 0x20, 0x74, 
+    0x68, 0x65, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x77, 0x61, 0x73, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x6E, 0x2C, 0x20, 
+    0x73, 0x6F, 0x20, 0x69, 0x74, 0x20, 0x63, 0x61, 0x6E, 0x20, 0x73, 0x65, 0x6E, 0x64, 0x20, 0x6D, 0x6F, 0x72, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x61, 0x63, 0x6B, 0x6E, 0x6F, 0x77, 0x6C, 
+    0x65, 0x64, 0x67, 0x65, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x28, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x4C, 0x6F, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x20, 
+    0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x28, 0x20, 0x28, 0x20, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x20, 0x29, 0x20, 0x26, 0x26, 0x20, 0x28, 0x20, 0x73, 
+    0x6F, 0x63, 0x6B, 0x65, 0x74, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x20, 0x3D, 0x3D, 0x20, 
+    0x57, 0x65, 0x62, 0x53, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x2E, 0x4F, 0x50, 0x45, 0x4E, 0x20, 0x29, 0x20, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x2E, 0x73, 0x65, 0x6E, 0x64, 0x28, 0x20, 0x27, 0x61, 0x63, 0x6B, 0x20, 0x27, 
+    0x20, 0x2B, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x53, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x29, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x28, 0x20, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x76, 0x61, 0x72, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x46, 
+    0x72, 0x61, 0x6D, 0x65, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 
+    0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x3D, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x46, 0x72, 0x61, 0x6D, 
+    0x65, 0x28, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x61, 0x73, 0x6B, 0x20, 
+    0x66, 0x6F, 0x72, 0x20, 0x61, 0x6E, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x6E, 0x65, 0x77, 0x65, 0x72, 0x20, 0x74, 
+    0x68, 0x61, 0x6E, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6F, 0x6E, 0x65, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x6E, 0x20, 0x2D, 0x20, 
+    0x73, 0x65, 0x72, 0x76, 0x65, 0x72, 0x20, 0x68, 0x6F, 0x6C, 0x64, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x72, 0x65, 0x71, 
+    0x75, 0x65, 0x73, 0x74, 0x20, 0x74, 0x69, 0x6C, 0x6C, 0x20, 0x69, 0x74, 0x20, 0x67, 0x65, 0x74, 0x73, 0x20, 0x6F, 0x6E, 
+    0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 
+    0x73, 0x74, 0x4E, 0x65, 0x78, 0x74, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x28, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 
+    0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x58, 0x4D, 0x4C, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 
+    0x74, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x53, 
+    0x74, 0x61, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x65, 0x28, 0x20, 0x29, 0x2E, 0x67, 
+    0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x28, 0x20, 0x27, 0x47, 0x45, 0x54, 0x27, 0x2C, 
+    0x20, 0x6A, 0x70, 0x65, 0x67, 0x55, 0x72, 0x6C, 0x20, 0x2B, 0x20, 0x27, 0x3F, 0x61, 0x66, 0x74, 0x65, 0x72, 0x3D, 0x27, 
+    0x20, 0x2B, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x53, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x2B, 0x20, 0x27, 0x26, 
+    0x74, 0x3D, 0x27, 0x20, 0x2B, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x53, 0x74, 0x61, 0x72, 0x74, 0x20, 0x29, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2E, 0x72, 0x65, 0x73, 0x70, 0x6F, 
+    0x6E, 0x73, 0x65, 0x54, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x20, 0x27, 0x62, 0x6C, 0x6F, 0x62, 0x27, 0x3B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2E, 0x6F, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 
+    0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 
+    0x20, 0x73, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 
+    0x28, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 
+    0x65, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x28, 0x20, 0x27, 0x58, 0x2D, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x2D, 0x53, 0x65, 
+    0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x27, 0x20, 0x29, 0x20, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x21, 0x69, 0x73, 0x4E, 0x61, 0x4E, 0x28, 0x20, 0x73, 
+    0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x29, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x6C, 0x61, 0x73, 0x74, 0x53, 0x65, 0x71, 0x75, 0x65, 0x6E, 0x63, 0x65, 0x20, 0x3D, 0x20, 0x73, 0x65, 0x71, 
+    0x75, 0x65, 0x6E, 0x63, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 
+    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x72, 
+    0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x32, 0x30, 0x30, 
+    0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x49, 0x6D, 0x61, 
+    0x67, 0x65, 0x28, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2E, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 
+    0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 
+    0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x32, 0x30, 
+    0x34, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x6E, 0x6F, 0x20, 
+    0x6E, 0x65, 0x77, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x61, 0x20, 0x77, 0x68, 0x69, 0x6C, 
+    0x65, 0x20, 0x2D, 0x20, 0x73, 0x69, 0x6D, 0x70, 0x6C, 0x79, 0x20, 0x77, 0x61, 0x69, 0x74, 0x20, 0x61, 0x67, 0x61, 0x69, 
+    0x6E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 
+    0x71, 0x75, 0x65, 0x73, 0x74, 0x4E, 0x65, 0x78, 0x74, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x6F, 0x6E, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2E, 0x6F, 0x6E, 
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x6F, 0x6E, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x45, 0x72, 0x72, 0x6F, 0x72, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x2E, 0x73, 0x65, 
+    0x6E, 0x64, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 
+    0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 
+    0x28, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x77, 0x73, 0x27, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 
+    0x2F, 0x20, 0x73, 0x6B, 0x69, 0x70, 0x20, 0x62, 0x72, 0x6F, 0x6B, 0x65, 0x6E, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x63, 0x6B, 0x6E, 0x6F, 0x77, 0x6C, 0x65, 
+    0x64, 0x67, 0x65, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 
+    0x20, 0x74, 0x72, 0x79, 0x20, 0x72, 0x6F, 0x74, 0x61, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x62, 0x65, 0x74, 0x77, 0x65, 0x65, 
+    0x6E, 0x20, 0x4D, 0x4A, 0x50, 0x45, 0x47, 0x2F, 0x4A, 0x50, 0x45, 0x47, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x73, 0x20, 0x2D, 
+    0x20, 0x62, 0x72, 0x6F, 0x77, 0x73, 0x65, 0x72, 0x73, 0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x49, 0x45, 0x20, 0x64, 0x6F, 
+    0x6E, 0x27, 0x74, 0x20, 0x67, 0x65, 0x74, 0x20, 0x4D, 0x4A, 0x50, 0x45, 0x47, 0x20, 0x61, 0x74, 0x20, 0x61, 0x6C, 0x6C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 
+    0x28, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x6D, 0x6A, 0x70, 0x65, 0x67, 0x27, 0x20, 0x29, 0x20, 
+    0x3F, 0x20, 0x27, 0x6A, 0x70, 0x65, 0x67, 0x27, 0x20, 0x3A, 0x20, 0x27, 0x6D, 0x6A, 0x70, 0x65, 0x67, 0x27, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x61, 0x6C, 0x73, 0x6F, 0x20, 
+    0x67, 0x69, 0x76, 0x65, 0x20, 0x69, 0x74, 0x20, 0x61, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x20, 0x70, 0x61, 0x75, 0x73, 
+    0x65, 0x20, 0x6F, 0x6E, 0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28, 0x20, 0x72, 0x65, 0x66, 0x72, 0x65, 
+    0x73, 0x68, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x2C, 0x20, 0x31, 0x30, 0x30, 0x30, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x6E, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x4C, 0x6F, 0x61, 0x64, 0x65, 0x64, 
+    0x28, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 
+    0x20, 0x28, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x77, 0x73, 0x27, 0x20, 0x29, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x61, 0x63, 0x6B, 0x6E, 0x6F, 0x77, 0x6C, 0x65, 0x64, 0x67, 0x65, 0x46, 0x72, 0x61, 0x6D, 0x65, 0x28, 0x20, 0x29, 0x3B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x27, 0x6A, 0x70, 
+    0x65, 0x67, 0x27, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x54, 0x61, 0x6B, 0x65, 
+    0x6E, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x65, 0x28, 0x20, 0x29, 0x2E, 0x67, 0x65, 0x74, 0x54, 
+    0x69, 0x6D, 0x65, 0x28, 0x20, 0x29, 0x20, 0x2D, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x53, 0x74, 0x61, 0x72, 0x74, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x6F, 
+    0x75, 0x74, 0x28, 0x20, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x2C, 0x20, 0x28, 0x20, 
+    0x74, 0x69, 0x6D, 0x65, 0x54, 0x61, 0x6B, 0x65, 0x6E, 0x20, 0x3E, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x49, 0x6E, 0x74, 
+    0x65, 0x72, 0x76, 0x61, 0x6C, 0x20, 0x29, 0x20, 0x3F, 0x20, 0x30, 0x20, 0x3A, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x49, 
+    0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x20, 0x2D, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x54, 0x61, 0x6B, 0x65, 0x6E, 0x20, 
+    0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x3D, 0x20, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x20, 0x66, 0x70, 0x73, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x20, 0x3D, 
+    0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 
+    0x42, 0x79, 0x49, 0x64, 0x28, 0x20, 0x27, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x27, 0x20, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 
+    0x6F, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x20, 0x3D, 0x20, 0x6F, 0x6E, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x4C, 0x6F, 0x61, 
+    0x64, 0x65, 0x64, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x45, 0x6C, 
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x6F, 0x6E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x3D, 0x20, 0x6F, 0x6E, 0x49, 0x6D, 
+    0x61, 0x67, 0x65, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 
+    0x66, 0x20, 0x28, 0x20, 0x28, 0x20, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x66, 0x70, 0x73, 0x20, 0x3D, 0x3D, 0x20, 
+    0x27, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x27, 0x20, 0x29, 0x20, 0x26, 0x26, 0x20, 0x20, 0x28, 0x20, 0x66, 0x70, 0x73, 
+    0x20, 0x21, 0x3D, 0x20, 0x30, 0x20, 0x29, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x49, 0x6E, 0x74, 
+    0x65, 0x72, 0x76, 0x61, 0x6C, 0x20, 0x3D, 0x20, 0x31, 0x30, 0x30, 0x30, 0x20, 0x2F, 0x20, 0x66, 0x70, 0x73, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 
+    0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x20, 0x3D, 
+    0x20, 0x31, 0x30, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x2F, 0x2F, 0x20, 0x70, 0x72, 0x65, 0x66, 0x65, 0x72, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6F, 
+    0x63, 0x6B, 0x65, 0x74, 0x2C, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x20, 0x6C, 0x65, 0x74, 0x73, 0x20, 0x73, 0x65, 0x72, 
+    0x76, 0x65, 0x72, 0x20, 0x6B, 0x6E, 0x6F, 0x77, 0x20, 0x77, 0x68, 0x61, 0x74, 0x20, 0x77, 0x61, 0x73, 0x20, 0x73, 0x68, 
+    0x6F, 0x77, 0x6E, 0x3B, 0x20, 0x6F, 0x74, 0x68, 0x65, 0x72, 0x77, 0x69, 0x73, 0x65, 0x20, 0x74, 0x72, 0x79, 0x20, 0x63, 
+    0x61, 0x70, 0x74, 0x75, 0x72, 0x69, 0x6E, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x4D, 0x4A, 0x50, 0x45, 0x47, 0x20, 0x6D, 0x6F, 
+    0x64, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x6F, 0x64, 0x65, 0x20, 0x3D, 0x20, 0x28, 0x20, 
+    0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x57, 0x65, 0x62, 0x53, 0x6F, 0x63, 0x6B, 0x65, 0x74, 0x20, 0x21, 0x3D, 0x20, 
+    0x27, 0x75, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x27, 0x20, 0x29, 0x20, 0x3F, 0x20, 0x27, 0x77, 0x73, 0x27, 
+    0x20, 0x3A, 0x20, 0x27, 0x6D, 0x6A, 0x70, 0x65, 0x67, 0x27, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x49, 0x6D, 0x61, 0x67, 0x65, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x7D, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x7B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x53, 0x74, 0x61, 0x72, 0x74, 0x3A, 0x20, 0x73, 0x74, 0x61, 0x72, 0x74, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x20, 0x29, 0x28, 0x20, 0x29, 0x3B, 0x0A, 
+};
+
+uint8_t camera_js_gzip_data[]
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xA5, 0x58, 0xDB, 0x92, 0x13, 0x37, 0x10, 0x7D, 0xF7, 0x57, 
+    0x74, 0x5E, 0xB0, 0x1D, 0xBC, 0xF6, 0xB2, 0xA1, 0x08, 0xD8, 0xE5, 0x50, 0x21, 0x59, 0x60, 0x53, 0xCB, 0x42, 0x2D, 0x4B, 
+    0x42, 0x55, 0x2A, 0x0F, 0xF2, 0x8C, 0x6C, 0x0F, 0x1E, 0x4B, 0x13, 0x49, 0xF6, 0xC4, 0xA1, 0xF6, 0xDF, 0xD3, 0x2D, 0xCD, 
+    0x4D, 0x73, 0xB1, 0x81, 0xD8, 0x2F, 0x33, 0x9A, 0x56, 0xAB, 0xD5, 0x97, 0xD3, 0x47, 0xDA, 0x33, 0x05, 0xBF, 0xB0, 0x2D, 
+    0x57, 0x0C, 0xE6, 0x30, 0x58, 0xEE, 0x44, 0x60, 0x22, 0x29, 0x60, 0x30, 0xEC, 0x7D, 0xEE, 0x01, 0xFE, 0xF6, 0xF8, 0xFD, 
+    0x53, 0xC2, 0x57, 0x1F, 0x54, 0x0C, 0xEE, 0x37, 0x87, 0xFE, 0x24, 0xB0, 0x33, 0x26, 0xF4, 0xA1, 0x3F, 0x2B, 0xE4, 0xB6, 
+    0x9E, 0x60, 0x45, 0x6E, 0x5B, 0x13, 0x4C, 0x75, 0xA9, 0xCE, 0x13, 0x4C, 0x75, 0x55, 0x9D, 0x0C, 0xF9, 0x0C, 0xCA, 0xDF, 
+    0x64, 0x02, 0x7D, 0x14, 0x18, 0x41, 0xDF, 0xE9, 0x03, 0xA9, 0xA0, 0x6F, 0x9F, 0x8A, 0x29, 0x4B, 0x85, 0x7A, 0xAE, 0x84, 
+    0xE1, 0x6A, 0xCF, 0xE2, 0x52, 0x53, 0xB4, 0x65, 0x2B, 0x7E, 0x19, 0xF3, 0x2D, 0x17, 0xA6, 0x1C, 0x35, 0xD1, 0x96, 0xBF, 
+    0x37, 0x4C, 0x55, 0x86, 0x62, 0xA6, 0xCD, 0x7B, 0xFE, 0xF7, 0x8E, 0x8B, 0x80, 0x93, 0x61, 0xE7, 0x35, 0x1D, 0x6F, 0x17, 
+    0x9F, 0x78, 0x60, 0xD0, 0xF8, 0x72, 0x5C, 0xCB, 0x60, 0xC3, 0x4D, 0x4D, 0xEE, 0x5A, 0xB2, 0x30, 0x12, 0x2B, 0x52, 0xB1, 
+    0x64, 0xB1, 0xE6, 0xE5, 0xE7, 0x84, 0x0B, 0xFA, 0xF2, 0x92, 0x0C, 0x9D, 0xF5, 0xEC, 0x70, 0xE1, 0x74, 0xC5, 0x97, 0x8A, 
+    0xEB, 0xF5, 0x15, 0x69, 0x18, 0xC0, 0xD0, 0x7E, 0x74, 0x51, 0xA0, 0x5F, 0xB4, 0x84, 0x81, 0xF5, 0x09, 0xCC, 0xE7, 0xD6, 
+    0x11, 0x99, 0x84, 0x2F, 0x45, 0x3F, 0x89, 0x8B, 0xBC, 0xB7, 0x66, 0xA1, 0x96, 0x59, 0xF1, 0xE9, 0xBE, 0x78, 0xE2, 0x68, 
+    0x52, 0x4D, 0x5F, 0xE6, 0xD2, 0x2E, 0x95, 0x55, 0x0F, 0x8E, 0xB5, 0x0A, 0x70, 0x63, 0x79, 0xB4, 0xBB, 0x16, 0xE8, 0xD0, 
+    0xA4, 0xC8, 0xBD, 0xDA, 0xDC, 0xF0, 0x7F, 0x4C, 0xBE, 0xD1, 0xBA, 0x86, 0xFB, 0x9A, 0x5F, 0xF4, 0x5A, 0xA6, 0x99, 0xEC, 
+    0x22, 0x96, 0x8B, 0x76, 0xCF, 0xF8, 0xF1, 0xE9, 0xDC, 0xC8, 0x87, 0xDB, 0xEB, 0xB1, 0xE2, 0x7B, 0xB9, 0xC9, 0x65, 0x6F, 
+    0xAF, 0x9B, 0x73, 0xDB, 0xB6, 0x54, 0x93, 0xA1, 0xD0, 0x92, 0xAE, 0x40, 0x71, 0x66, 0xAA, 0xBA, 0x9C, 0x85, 0xB3, 0xDE, 
+    0x11, 0xCF, 0xB5, 0xA5, 0x52, 0xB6, 0x67, 0xCC, 0xF1, 0x15, 0x37, 0x2E, 0x8F, 0x35, 0xC8, 0x3D, 0x57, 0xF0, 0x07, 0x5F, 
+    0xB8, 0x60, 0xC2, 0x19, 0x68, 0x4C, 0x6C, 0x1C, 0xD2, 0x98, 0x44, 0x1A, 0x04, 0x4F, 0x41, 0x0A, 0x12, 0x13, 0xF1, 0x01, 
+    0xD8, 0x12, 0xB3, 0x1E, 0x52, 0x0E, 0x86, 0xC7, 0x31, 0xA4, 0xEB, 0x28, 0x58, 0xE3, 0x9B, 0xE2, 0xD6, 0x7B, 0xC2, 0x77, 
+    0xA8, 0x97, 0x20, 0x35, 0x67, 0x52, 0x92, 0xAE, 0xA4, 0x79, 0xE9, 0x2C, 0x28, 0xF2, 0xB7, 0xF8, 0xEE, 0xF2, 0x1D, 0x3F, 
+    0xD0, 0xF2, 0x85, 0x6D, 0x03, 0xA0, 0x7F, 0x2C, 0x03, 0x46, 0x0B, 0x8C, 0x13, 0x25, 0x8D, 0x0C, 0x64, 0x6C, 0x53, 0x6B, 
+    0x6D, 0x4C, 0xA2, 0xA7, 0x98, 0x5B, 0xF0, 0x9C, 0xF2, 0x56, 0x4F, 0x27, 0x93, 0x3E, 0x4C, 0xE9, 0xD1, 0x3E, 0x0D, 0xE1, 
+    0x61, 0x39, 0x71, 0x2D, 0xB5, 0xC1, 0x77, 0x07, 0x10, 0x15, 0x2F, 0xBA, 0x55, 0xC7, 0x8B, 0x48, 0x30, 0x75, 0xB8, 0x3B, 
+    0x24, 0x9C, 0x50, 0x83, 0x29, 0xC5, 0x0E, 0x8B, 0xDD, 0x72, 0xC9, 0x55, 0xBF, 0x61, 0xE1, 0x58, 0x0A, 0xDC, 0x80, 0x46, 
+    0x4F, 0xD3, 0x26, 0xB2, 0x9D, 0x0F, 0x80, 0xEF, 0x31, 0x0E, 0xDD, 0x69, 0x4E, 0x99, 0x64, 0x45, 0xC6, 0x21, 0x33, 0x0C, 
+    0x22, 0xA1, 0x0D, 0x43, 0x2C, 0x90, 0x4B, 0xF8, 0x99, 0x16, 0x7B, 0x61, 0x17, 0xAB, 0x4C, 0x6F, 0xAA, 0xC8, 0xA2, 0xB8, 
+    0xE6, 0x2C, 0xE4, 0x6A, 0x0A, 0x18, 0x2E, 0x8D, 0x0B, 0x8F, 0xB2, 0x01, 0xD0, 0xD1, 0xBF, 0x7C, 0x04, 0x69, 0x14, 0x9A, 
+    0x35, 0x8D, 0x45, 0xAB, 0xB5, 0x19, 0x61, 0x4D, 0xD8, 0xC0, 0x86, 0x23, 0x8C, 0xAC, 0x03, 0x9F, 0x91, 0x45, 0x27, 0x5C, 
+    0x7C, 0x9B, 0x34, 0xB4, 0x53, 0x84, 0xF6, 0x11, 0x7A, 0x3F, 0x0B, 0xC2, 0xAF, 0x68, 0xE9, 0xEF, 0xF8, 0xEE, 0x59, 0x5E, 
+    0xF1, 0x5D, 0x75, 0x9E, 0x4D, 0x2C, 0x9C, 0xD7, 0xB4, 0xD9, 0x7A, 0x2E, 0x5B, 0x7D, 0x6A, 0xF5, 0x8F, 0x31, 0x13, 0x3F, 
+    0x44, 0xC2, 0xFC, 0x70, 0x31, 0x80, 0xA7, 0x18, 0xA6, 0xEF, 0xE1, 0xF1, 0xC5, 0xB3, 0xC7, 0xCF, 0x9E, 0xFC, 0x78, 0xF1, 
+    0xEC, 0x09, 0xC6, 0xA8, 0x2E, 0xF2, 0xE8, 0x02, 0x86, 0xA3, 0x56, 0xB5, 0x54, 0x12, 0x53, 0xFB, 0x44, 0xE6, 0xBE, 0xC0, 
+    0xB7, 0x01, 0xFC, 0x69, 0x9F, 0x69, 0xEE, 0x53, 0xEB, 0xD9, 0xAA, 0xF1, 0x23, 0x4F, 0xF7, 0x53, 0x54, 0x8D, 0xAB, 0x0F, 
+    0xE1, 0xAF, 0x11, 0x7C, 0x06, 0x83, 0xB1, 0xC7, 0xDC, 0xB1, 0x25, 0xE4, 0xFA, 0x0F, 0xDC, 0xD7, 0xE2, 0x61, 0xCB, 0xA9, 
+    0x92, 0x0F, 0xF9, 0xAF, 0x9A, 0xD5, 0x46, 0xED, 0x78, 0x8B, 0x08, 0x06, 0x8E, 0xCA, 0xC5, 0x55, 0x94, 0x59, 0x73, 0x6C, 
+    0x08, 0x06, 0xA3, 0x90, 0xB9, 0x0D, 0xB3, 0x03, 0xC7, 0x0E, 0x10, 0x48, 0x7C, 0x59, 0x62, 0xAB, 0xC0, 0x78, 0x9A, 0x35, 
+    0x13, 0xB0, 0x50, 0x32, 0xC5, 0x08, 0x42, 0xC8, 0x03, 0xC4, 0x53, 0x4D, 0x52, 0xDB, 0x86, 0xEE, 0x12, 0xA5, 0xF2, 0xEE, 
+    0xD0, 0x34, 0xBB, 0x3D, 0x2C, 0xD5, 0x9E, 0x41, 0xC9, 0xEC, 0x7A, 0x47, 0x63, 0xCB, 0x8D, 0x11, 0x0F, 0x85, 0x8F, 0x2F, 
+    0x41, 0xBB, 0xB6, 0xFA, 0x07, 0xD9, 0x5E, 0x87, 0xA7, 0x16, 0x28, 0xDF, 0xEE, 0xDB, 0x6A, 0x2F, 0x88, 0xA5, 0xF6, 0x2B, 
+    0xAF, 0xAB, 0xE6, 0x32, 0x40, 0xC9, 0xB9, 0x80, 0xD8, 0xC5, 0xF1, 0xAC, 0xD9, 0x7B, 0x72, 0x9F, 0x79, 0x0D, 0xB5, 0xC3, 
+    0x41, 0x4E, 0x45, 0xAF, 0x16, 0x58, 0x9C, 0x17, 0xC3, 0x82, 0x05, 0x1B, 0x30, 0x12, 0xDE, 0xFC, 0xF6, 0xEE, 0xF2, 0x15, 
+    0x85, 0xA4, 0x44, 0xD7, 0x50, 0x62, 0xE4, 0x84, 0x34, 0x90, 0x4A, 0xB5, 0x01, 0x66, 0x00, 0xE5, 0x47, 0x20, 0x31, 0x96, 
+    0x2A, 0x8D, 0x70, 0x2F, 0x0A, 0x83, 0x2B, 0x04, 0x62, 0x76, 0x13, 0x31, 0xBE, 0x2B, 0x53, 0xEB, 0x14, 0x34, 0xB8, 0x86, 
+    0x9B, 0xF7, 0xDB, 0x59, 0xAF, 0xDB, 0xC1, 0x9A, 0x9B, 0x3B, 0xC4, 0x00, 0xB9, 0x43, 0x70, 0xAD, 0x32, 0x83, 0x11, 0x3C, 
+    0x3A, 0x3F, 0x3F, 0xF7, 0x9A, 0xD4, 0xAC, 0xB3, 0x6D, 0xFA, 0x31, 0xAD, 0xF7, 0x4D, 0xDF, 0xB1, 0xAE, 0x26, 0xF2, 0x8F, 
+    0x1E, 0x15, 0xCA, 0x92, 0x6E, 0x9C, 0x03, 0x44, 0x05, 0x98, 0xCB, 0xDE, 0xEC, 0x44, 0xAA, 0xFD, 0xAF, 0x6C, 0x6A, 0x31, 
+    0x3A, 0x38, 0x6B, 0x5E, 0x1B, 0x81, 0x05, 0x46, 0xB5, 0xE5, 0x8C, 0x4A, 0x99, 0x76, 0x2D, 0x0A, 0xC1, 0x4F, 0x42, 0x64, 
+    0x20, 0xC0, 0x82, 0xA2, 0x06, 0x87, 0xAE, 0x52, 0xDC, 0xDF, 0x11, 0x06, 0x0F, 0x27, 0xC7, 0x3C, 0x5C, 0xF1, 0x6C, 0x63, 
+    0x27, 0xB6, 0x54, 0x6F, 0x5E, 0x36, 0x5A, 0x83, 0x3C, 0xE5, 0x86, 0xF0, 0xE0, 0x41, 0xF1, 0x86, 0xAC, 0x80, 0x85, 0x07, 
+    0xE4, 0x83, 0xC6, 0x12, 0xA2, 0x22, 0x2F, 0xC6, 0x6F, 0xDF, 0x5D, 0xDE, 0x10, 0xFE, 0x1C, 0x4D, 0xDF, 0x31, 0x59, 0x3C, 
+    0xC0, 0x96, 0x84, 0xE9, 0xD5, 0xA7, 0x86, 0x56, 0xF5, 0x9E, 0xC7, 0x27, 0x7C, 0x5B, 0xBC, 0xCC, 0xED, 0x5A, 0xA2, 0x0A, 
+    0xDC, 0x2D, 0xFC, 0xF1, 0x68, 0x15, 0x7C, 0x69, 0x91, 0xDF, 0xD7, 0x02, 0xC6, 0xF4, 0x06, 0x96, 0x48, 0xB0, 0x31, 0x18, 
+    0xD6, 0xA7, 0x04, 0xD7, 0x39, 0xDC, 0x51, 0xF0, 0x90, 0x78, 0xB8, 0xB0, 0x95, 0xAC, 0x64, 0x2D, 0xE3, 0xD0, 0x62, 0x5F, 
+    0xCE, 0xF1, 0xB0, 0x87, 0x61, 0xC9, 0x61, 0x48, 0x11, 0xC9, 0x89, 0xA5, 0xF0, 0x3A, 0xDD, 0x6D, 0x30, 0xC1, 0x16, 0x2E, 
+    0x92, 0xEB, 0x72, 0xBD, 0xEE, 0xE3, 0x9B, 0xEB, 0xD7, 0x48, 0x27, 0x6E, 0xDD, 0xA0, 0xE5, 0x8E, 0x85, 0x74, 0xC1, 0xE7, 
+    0xCB, 0xBE, 0x48, 0x3A, 0xA9, 0x8F, 0x50, 0x21, 0xF9, 0xC2, 0x99, 0xDA, 0x31, 0x51, 0x21, 0x8C, 0xDB, 0xAB, 0xCB, 0x3B, 
+    0x3C, 0x58, 0xE4, 0xE7, 0x97, 0x87, 0xD0, 0x7F, 0x6E, 0xF9, 0xD4, 0xBC, 0x11, 0x4B, 0xFC, 0xF4, 0xC0, 0xD8, 0xE1, 0x72, 
+    0xB9, 0x8A, 0x1B, 0x73, 0xB5, 0x58, 0xAD, 0x89, 0x14, 0x9A, 0xE7, 0x54, 0x85, 0xAA, 0xA2, 0xDF, 0x14, 0xC3, 0x3E, 0x83, 
+    0xB9, 0xFA, 0x45, 0x30, 0x69, 0xCF, 0x1A, 0x65, 0x3D, 0x26, 0x4C, 0x69, 0x3A, 0xE9, 0x0C, 0x0A, 0x5D, 0xB8, 0xCD, 0xDB, 
+    0x6C, 0xD5, 0xD7, 0x96, 0x6B, 0xE0, 0xB6, 0x3E, 0x9E, 0xD9, 0x78, 0x9F, 0xE5, 0xE6, 0x13, 0xDB, 0x1A, 0xD6, 0xD2, 0xC6, 
+    0x21, 0x58, 0xA4, 0x6F, 0xD8, 0xCD, 0xA0, 0x5C, 0x61, 0x78, 0x12, 0xC9, 0x6A, 0x00, 0xD1, 0x84, 0x86, 0x5A, 0xBE, 0x17, 
+    0x6B, 0xE5, 0x06, 0x23, 0xBB, 0x31, 0x3B, 0x4D, 0xC5, 0x76, 0x41, 0x78, 0x76, 0x62, 0xB9, 0x0A, 0xD0, 0xD4, 0x9D, 0x5C, 
+    0x6F, 0x56, 0x3E, 0x8E, 0x96, 0x87, 0x9D, 0xB6, 0x85, 0x1F, 0x7F, 0x09, 0x99, 0x13, 0xD2, 0x26, 0x94, 0x2B, 0x04, 0x5B, 
+    0x15, 0x44, 0xB0, 0x63, 0x4E, 0xB9, 0x1F, 0x6D, 0x13, 0xE4, 0x0A, 0x29, 0xC3, 0x34, 0x67, 0x2B, 0x16, 0x89, 0xC6, 0xFC, 
+    0xA3, 0x07, 0x9E, 0x76, 0x73, 0x4F, 0x58, 0x24, 0x85, 0x55, 0x74, 0xA9, 0x94, 0x54, 0x47, 0xB4, 0xDD, 0xB7, 0xE5, 0x1B, 
+    0xA7, 0x49, 0x18, 0xAE, 0xAA, 0x8E, 0xA6, 0x9C, 0x43, 0xB3, 0x61, 0x7B, 0x5F, 0xA9, 0x2D, 0xFF, 0xCD, 0xC7, 0x54, 0x22, 
+    0x5B, 0x9B, 0x28, 0x21, 0xF6, 0xB4, 0xE1, 0xC2, 0x41, 0x92, 0x27, 0xD0, 0x02, 0xF7, 0x5F, 0x79, 0xD8, 0xC4, 0x25, 0x8C, 
+    0x3A, 0x00, 0x9E, 0x46, 0xF0, 0x78, 0x81, 0x1D, 0x61, 0xC1, 0x4D, 0xCA, 0x71, 0x2D, 0xDB, 0xFE, 0x27, 0x96, 0x03, 0x6C, 
+    0x2D, 0x63, 0x3B, 0xCB, 0x39, 0x9C, 0x86, 0x38, 0xDA, 0x70, 0xB8, 0xBA, 0x44, 0x3E, 0x20, 0xFA, 0x16, 0xBA, 0x32, 0xB2, 
+    0xE0, 0x18, 0x41, 0xAF, 0xA5, 0x99, 0xB7, 0x1C, 0xA3, 0xE9, 0xA8, 0xE3, 0x1E, 0xA7, 0xED, 0xBD, 0x9E, 0x20, 0x36, 0xC6, 
+    0x86, 0xB7, 0x8A, 0xF6, 0x9C, 0x20, 0x92, 0x81, 0xDE, 0x12, 0x41, 0x49, 0xD8, 0x4E, 0x13, 0xBA, 0x82, 0x0D, 0xD4, 0xB7, 
+    0x12, 0x82, 0x63, 0x71, 0xA3, 0xEE, 0xC8, 0xC3, 0xFF, 0x13, 0xB8, 0xAF, 0x88, 0x4B, 0x4D, 0xEB, 0xF1, 0x4B, 0x86, 0xFC, 
+    0x52, 0xE6, 0x8E, 0x51, 0x3E, 0x74, 0x81, 0x38, 0xC6, 0xAA, 0x76, 0x73, 0x73, 0xDA, 0x41, 0x83, 0x8A, 0xDE, 0x9F, 0xFC, 
+    0x5B, 0x22, 0x1B, 0xAB, 0x73, 0x0C, 0x93, 0x3F, 0x7A, 0x56, 0x99, 0xD1, 0xE5, 0x59, 0x0B, 0xC9, 0x59, 0xC3, 0x29, 0x01, 
+    0x7C, 0x99, 0xE8, 0x76, 0x5A, 0x92, 0x5D, 0x02, 0xA0, 0x70, 0x28, 0x83, 0x9D, 0xBD, 0x0F, 0xC0, 0x5D, 0x65, 0xA3, 0x2F, 
+    0x0E, 0x57, 0xC4, 0x1F, 0xDC, 0x3D, 0x58, 0xDF, 0x03, 0x69, 0xEF, 0x06, 0x21, 0xEB, 0x18, 0x65, 0x05, 0xBB, 0x70, 0xCE, 
+    0xBA, 0xA4, 0xDB, 0xEB, 0xBD, 0x4E, 0x88, 0xE8, 0x54, 0x85, 0x67, 0x5C, 0x32, 0x9D, 0xC2, 0x24, 0x76, 0xDB, 0x05, 0x9E, 
+    0xA9, 0x1D, 0x41, 0x02, 0xB7, 0xA5, 0xEF, 0xE6, 0xE8, 0xA5, 0x6E, 0x1A, 0xE4, 0x7B, 0x6F, 0xEE, 0x52, 0x72, 0x42, 0x33, 
+    0xBF, 0xB2, 0x64, 0x5B, 0x14, 0xB5, 0xD2, 0x27, 0x2C, 0xA0, 0x04, 0x83, 0x5C, 0xBD, 0x20, 0x19, 0x65, 0xD7, 0x1E, 0x31, 
+    0xD1, 0x8D, 0x2A, 0xDB, 0x4C, 0xD7, 0x58, 0xBC, 0x05, 0xD1, 0x9C, 0x55, 0x48, 0x3D, 0xA1, 0x43, 0xC0, 0x12, 0xB3, 0x53, 
+    0x04, 0x0F, 0x51, 0x86, 0x0C, 0x36, 0x61, 0x7B, 0x8D, 0x2A, 0xCF, 0xBC, 0x54, 0x1E, 0x19, 0xD0, 0x27, 0xFD, 0x9D, 0x08, 
+    0xF9, 0x32, 0x12, 0x3C, 0x2C, 0x2E, 0x38, 0xBC, 0x9A, 0xAF, 0x40, 0xAB, 0x77, 0xB9, 0x97, 0x41, 0x6B, 0x26, 0xA0, 0x38, 
+    0x5A, 0x20, 0x2A, 0x9E, 0xB0, 0xD9, 0x3D, 0x75, 0xD9, 0x95, 0xA5, 0x1C, 0x1E, 0x73, 0xED, 0xBC, 0xFF, 0x00, 0xFB, 0x19, 
+    0x74, 0xDF, 0xB2, 0x15, 0x00, 0x00, 
+};
+
+XEmbeddedContent web_camera_js =
+{
+    5554,
+    "application/x-javascript",
+    camera_js_data,
+    "43fa0292ef484f8c",
+    1706,
+    camera_js_gzip_data,
+    0,
+    nullptr,
+};
+
+#endif
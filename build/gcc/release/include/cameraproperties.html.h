@@ -0,0 +1,415 @@
+/*
+ * Auto generated header file to be used with web2cam
+ *
+ * Source file: cameraproperties.html
+ */
+
+#ifndef cameraproperties_html_h
+#define cameraproperties_html_h
+
+#include "XWebServer.hpp"
+
+uint8_t cameraproperties_html_data[]
+{
+    0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 
+    0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x6E, 0x6F, 0x6E, 
+    0x65, 0x3B, 0x22, 0x3E, 0x0A, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x70, 0x72, 0x6F, 0x70, 0x65, 
+    0x72, 0x74, 0x69, 0x65, 0x73, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x22, 0x3E, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 
+    0x0A, 0x3C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 
+    0x6E, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x72, 0x65, 0x73, 0x65, 0x74, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 
+    0x6B, 0x3D, 0x22, 0x72, 0x65, 0x73, 0x65, 0x74, 0x54, 0x6F, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x73, 0x28, 0x29, 
+    0x22, 0x3E, 0x52, 0x65, 0x73, 0x65, 0x74, 0x20, 0x74, 0x6F, 0x20, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x73, 0x3C, 
+    0x2F, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3E, 0x20, 0x0A, 0x20, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 
+    0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x7B, 0x20, 0x7D, 0x3B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x70, 
+    0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x3D, 0x20, 0x5B, 0x20, 0x5D, 0x3B, 0x0A, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x63, 
+    0x6F, 0x6E, 0x66, 0x69, 0x67, 0x4C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x66, 0x61, 
+    0x6C, 0x73, 0x65, 0x3B, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x4C, 
+    0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0A, 0x0A, 0x2F, 0x2F, 0x20, 0x52, 
+    0x65, 0x73, 0x65, 0x74, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x27, 0x73, 0x20, 0x70, 0x72, 
+    0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x74, 0x68, 0x65, 0x69, 0x72, 0x20, 0x64, 0x65, 
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x72, 0x65, 0x73, 0x65, 0x74, 0x54, 0x6F, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x73, 0x28, 0x20, 0x29, 
+    0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x4C, 0x6F, 
+    0x61, 0x64, 0x65, 0x64, 0x20, 0x26, 0x26, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x4C, 0x6F, 
+    0x61, 0x64, 0x65, 0x64, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 
+    0x20, 0x28, 0x20, 0x76, 0x61, 0x72, 0x20, 0x69, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 
+    0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x20, 0x69, 
+    0x20, 0x3C, 0x20, 0x6C, 0x65, 0x6E, 0x3B, 0x20, 0x69, 0x2B, 0x2B, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 
+    0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x5B, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 
+    0x5D, 0x5B, 0x30, 0x5D, 0x5D, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
+    0x72, 0x20, 0x6A, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x3D, 0x20, 0x24, 0x28, 0x20, 0x22, 0x23, 0x22, 0x20, 
+    0x2B, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x30, 0x5D, 0x20, 0x29, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 
+    0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x20, 0x20, 0x3D, 0x20, 0x6A, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 
+    0x6C, 0x5B, 0x30, 0x5D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 
+    0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x31, 0x5D, 0x2E, 0x74, 0x79, 0x70, 
+    0x65, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x69, 0x6E, 0x74, 0x22, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2E, 0x76, 
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 
+    0x5B, 0x31, 0x5D, 0x2E, 0x64, 0x65, 0x66, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2E, 0x6F, 0x6E, 0x63, 
+    0x68, 0x61, 0x6E, 0x67, 0x65, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6A, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2E, 
+    0x73, 0x6C, 0x69, 0x64, 0x65, 0x72, 0x28, 0x20, 0x22, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 0x68, 0x22, 0x20, 0x29, 0x3B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 
+    0x69, 0x66, 0x20, 0x28, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x31, 
+    0x5D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x62, 0x6F, 0x6F, 0x6C, 0x22, 0x20, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 
+    0x74, 0x72, 0x6F, 0x6C, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x28, 0x20, 0x70, 0x72, 0x6F, 
+    0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x31, 0x5D, 0x2E, 0x64, 0x65, 0x66, 0x20, 0x3D, 0x3D, 
+    0x20, 0x22, 0x31, 0x22, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2E, 0x6F, 0x6E, 0x63, 0x6C, 
+    0x69, 0x63, 0x6B, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x6A, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2E, 0x63, 0x68, 
+    0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x72, 0x61, 0x64, 0x69, 0x6F, 0x28, 0x20, 0x22, 0x72, 0x65, 0x66, 0x72, 0x65, 0x73, 
+    0x68, 0x22, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 
+    0x5B, 0x69, 0x5D, 0x5B, 0x31, 0x5D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x65, 0x6C, 0x65, 
+    0x63, 0x74, 0x22, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x3D, 0x20, 
+    0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x31, 0x5D, 0x2E, 0x64, 0x65, 0x66, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2E, 0x6F, 0x6E, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x28, 0x20, 
+    0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x6A, 0x43, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x2E, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x28, 
+    0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x24, 0x28, 0x20, 0x22, 0x23, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5F, 0x6C, 
+    0x69, 0x73, 0x74, 0x22, 0x20, 0x29, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x28, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 
+    0x69, 0x65, 0x73, 0x48, 0x74, 0x6D, 0x6C, 0x20, 0x29, 0x2E, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x28, 0x20, 0x27, 
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x27, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 
+    0x28, 0x20, 0x22, 0x23, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 0x20, 0x29, 0x2E, 0x73, 0x68, 
+    0x6F, 0x77, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x0A, 0x0A, 0x2F, 0x2F, 0x20, 0x42, 
+    0x75, 0x69, 0x6C, 0x64, 0x20, 0x48, 0x54, 0x4D, 0x4C, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 
+    0x27, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x20, 0x29, 0x0A, 0x7B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x4C, 0x6F, 0x61, 0x64, 
+    0x65, 0x64, 0x20, 0x26, 0x26, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x4C, 0x6F, 0x61, 0x64, 
+    0x65, 0x64, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 
+    0x61, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x48, 0x74, 0x6D, 0x6C, 0x20, 0x3D, 0x20, 
+    0x22, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x20, 0x76, 0x61, 0x72, 0x20, 0x69, 
+    0x20, 0x3D, 0x20, 0x30, 0x2C, 0x20, 0x6C, 0x65, 0x6E, 0x20, 0x3D, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 
+    0x65, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x20, 0x69, 0x20, 0x3C, 0x20, 0x6C, 0x65, 0x6E, 0x3B, 0x20, 
+    0x69, 0x2B, 0x2B, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x5B, 
+    0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x30, 0x5D, 0x5D, 0x20, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 
+    0x74, 0x79, 0x48, 0x74, 0x6D, 0x6C, 0x20, 0x3D, 0x20, 0x22, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x5C, 0x22, 
+    0x64, 0x69, 0x76, 0x5F, 0x22, 0x20, 0x2B, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 
+    0x5D, 0x5B, 0x30, 0x5D, 0x20, 0x2B, 0x20, 0x22, 0x5C, 0x22, 0x3E, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 
+    0x31, 0x5D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x69, 0x6E, 0x74, 0x22, 0x20, 0x29, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 
+    0x70, 0x65, 0x72, 0x74, 0x79, 0x48, 0x74, 0x6D, 0x6C, 0x20, 0x2B, 0x3D, 0x20, 0x22, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 
+    0x20, 0x66, 0x6F, 0x72, 0x3D, 0x5C, 0x22, 0x22, 0x20, 0x2B, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 
+    0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x30, 0x5D, 0x20, 0x2B, 0x20, 0x22, 0x5C, 0x22, 0x3E, 0x22, 0x20, 0x2B, 0x20, 0x70, 0x72, 
+    0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x31, 0x5D, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x20, 
+    0x2B, 0x20, 0x22, 0x3A, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 
+    0x72, 0x74, 0x79, 0x48, 0x74, 0x6D, 0x6C, 0x20, 0x2B, 0x3D, 0x20, 0x22, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 
+    0x79, 0x70, 0x65, 0x3D, 0x5C, 0x22, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x5C, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x5C, 0x22, 0x22, 
+    0x20, 0x2B, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x30, 0x5D, 0x20, 
+    0x2B, 0x20, 0x22, 0x5C, 0x22, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x5C, 0x22, 0x22, 0x20, 0x2B, 0x20, 0x63, 0x6F, 
+    0x6E, 0x66, 0x69, 0x67, 0x5B, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x30, 
+    0x5D, 0x5D, 0x20, 0x2B, 0x20, 0x22, 0x5C, 0x22, 0x20, 0x22, 0x20, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 
+    0x79, 0x48, 0x74, 0x6D, 0x6C, 0x20, 0x2B, 0x3D, 0x20, 0x22, 0x6D, 0x69, 0x6E, 0x3D, 0x5C, 0x22, 0x22, 0x20, 0x2B, 0x20, 
+    0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x31, 0x5D, 0x2E, 0x6D, 0x69, 0x6E, 
+    0x20, 0x2B, 0x20, 0x22, 0x5C, 0x22, 0x20, 0x6D, 0x61, 0x78, 0x3D, 0x5C, 0x22, 0x22, 0x20, 0x2B, 0x20, 0x70, 0x72, 0x6F, 
+    0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x31, 0x5D, 0x2E, 0x6D, 0x61, 0x78, 0x20, 0x2B, 0x20, 
+    0x22, 0x5C, 0x22, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x48, 0x74, 0x6D, 0x6C, 0x20, 0x2B, 
+    0x3D, 0x20, 0x22, 0x6F, 0x6E, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x3D, 0x5C, 0x22, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x52, 
+    0x61, 0x6E, 0x67, 0x65, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x5C, 0x22, 
+    0x20, 0x6F, 0x6E, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x5C, 0x22, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x52, 0x61, 
+    0x6E, 0x67, 0x65, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x5C, 0x22, 0x20, 
+    0x2F, 0x3E, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 
+    0x5B, 0x69, 0x5D, 0x5B, 0x31, 0x5D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x62, 0x6F, 0x6F, 0x6C, 
+    0x22, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x3D, 0x20, 0x28, 0x20, 0x63, 0x6F, 0x6E, 0x66, 
+    0x69, 0x67, 0x5B, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x30, 0x5D, 0x5D, 
+    0x20, 0x21, 0x3D, 0x20, 0x22, 0x30, 0x22, 0x20, 0x29, 0x20, 0x3F, 0x20, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 
+    0x20, 0x22, 0x20, 0x3A, 0x20, 0x22, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x48, 0x74, 
+    0x6D, 0x6C, 0x20, 0x2B, 0x3D, 0x20, 0x22, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x5C, 0x22, 0x22, 
+    0x20, 0x2B, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x30, 0x5D, 
+    0x20, 0x2B, 0x20, 0x22, 0x5C, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x5C, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 
+    0x6F, 0x78, 0x5C, 0x22, 0x20, 0x22, 0x20, 0x2B, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x20, 0x2B, 0x20, 0x22, 0x64, 0x61, 
+    0x74, 0x61, 0x2D, 0x6D, 0x69, 0x6E, 0x3D, 0x5C, 0x22, 0x74, 0x72, 0x75, 0x65, 0x5C, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x6C, 
+    0x69, 0x63, 0x6B, 0x3D, 0x5C, 0x22, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x42, 0x6F, 0x6F, 0x6C, 0x50, 0x72, 0x6F, 0x70, 
+    0x65, 0x72, 0x74, 0x79, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x3B, 0x5C, 0x22, 0x20, 0x2F, 0x3E, 0x22, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 
+    0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x48, 0x74, 0x6D, 0x6C, 0x20, 0x2B, 0x3D, 0x20, 0x22, 0x3C, 0x6C, 0x61, 0x62, 
+    0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 0x3D, 0x5C, 0x22, 0x22, 0x20, 0x2B, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 
+    0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x30, 0x5D, 0x20, 0x2B, 0x22, 0x5C, 0x22, 0x3E, 0x22, 0x20, 0x2B, 0x20, 0x70, 
+    0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x31, 0x5D, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 
+    0x20, 0x2B, 0x20, 0x22, 0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x70, 
+    0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x31, 0x5D, 0x2E, 0x74, 0x79, 0x70, 0x65, 
+    0x20, 0x3D, 0x3D, 0x20, 0x22, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x22, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 
+    0x79, 0x48, 0x74, 0x6D, 0x6C, 0x20, 0x2B, 0x3D, 0x20, 0x22, 0x3C, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x20, 0x66, 0x6F, 0x72, 
+    0x3D, 0x5C, 0x22, 0x22, 0x20, 0x2B, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 
+    0x5B, 0x30, 0x5D, 0x20, 0x2B, 0x20, 0x22, 0x5C, 0x22, 0x3E, 0x22, 0x20, 0x2B, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 
+    0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x31, 0x5D, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x20, 0x2B, 0x20, 0x22, 0x3A, 
+    0x3C, 0x2F, 0x6C, 0x61, 0x62, 0x65, 0x6C, 0x3E, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x48, 
+    0x74, 0x6D, 0x6C, 0x20, 0x2B, 0x3D, 0x20, 0x22, 0x3C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x69, 0x64, 0x3D, 0x5C, 
+    0x22, 0x22, 0x20, 0x2B, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x30, 
+    0x5D, 0x20, 0x2B, 0x20, 0x22, 0x5C, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x6D, 0x69, 0x6E, 0x69, 0x3D, 0x5C, 0x22, 
+    0x74, 0x72, 0x75, 0x65, 0x5C, 0x22, 0x20, 0x6F, 0x6E, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x5C, 0x22, 0x68, 0x61, 
+    0x6E, 0x64, 0x6C, 0x65, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 
+    0x79, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x5C, 0x22, 0x3E, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x20, 
+    0x76, 0x61, 0x72, 0x20, 0x6A, 0x20, 0x3D, 0x20, 0x30, 0x2C, 0x20, 0x63, 0x68, 0x6F, 0x69, 0x63, 0x65, 0x73, 0x43, 0x6F, 
+    0x75, 0x6E, 0x74, 0x20, 0x3D, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 
+    0x31, 0x5D, 0x2E, 0x63, 0x68, 0x6F, 0x69, 0x63, 0x65, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x20, 0x6A, 
+    0x20, 0x3C, 0x20, 0x63, 0x68, 0x6F, 0x69, 0x63, 0x65, 0x73, 0x43, 0x6F, 0x75, 0x6E, 0x74, 0x3B, 0x20, 0x6A, 0x2B, 0x2B, 
+    0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 
+    0x64, 0x20, 0x3D, 0x20, 0x28, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 
+    0x31, 0x5D, 0x2E, 0x63, 0x68, 0x6F, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x6A, 0x5D, 0x5B, 0x30, 0x5D, 0x20, 0x3D, 0x3D, 0x20, 
+    0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x5B, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 
+    0x5B, 0x30, 0x5D, 0x5D, 0x20, 0x29, 0x20, 0x3F, 0x20, 0x22, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 
+    0x20, 0x3A, 0x20, 0x22, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x70, 
+    0x65, 0x72, 0x74, 0x79, 0x48, 0x74, 0x6D, 0x6C, 0x20, 0x2B, 0x3D, 0x20, 0x22, 0x3C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x5C, 0x22, 0x22, 0x20, 0x2B, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 
+    0x69, 0x65, 0x73, 0x5B, 0x69, 0x5D, 0x5B, 0x31, 0x5D, 0x2E, 0x63, 0x68, 0x6F, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x6A, 0x5D, 
+    0x5B, 0x30, 0x5D, 0x20, 0x2B, 0x20, 0x22, 0x5C, 0x22, 0x22, 0x20, 0x2B, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 
+    0x64, 0x20, 0x2B, 0x20, 0x22, 0x3E, 0x22, 0x20, 0x2B, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 
+    0x5B, 0x69, 0x5D, 0x5B, 0x31, 0x5D, 0x2E, 0x63, 0x68, 0x6F, 0x69, 0x63, 0x65, 0x73, 0x5B, 0x6A, 0x5D, 0x5B, 0x31, 0x5D, 
+    0x20, 0x2B, 0x20, 0x22, 0x3C, 0x2F, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 
+    0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x48, 0x74, 0x6D, 0x6C, 0x20, 0x2B, 0x3D, 0x20, 0x22, 0x3C, 0x2F, 0x73, 0x65, 
+    0x6C, 0x65, 0x63, 0x74, 0x3E, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 
+    0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x48, 0x74, 0x6D, 0x6C, 0x20, 0x20, 0x20, 0x2B, 0x3D, 0x20, 0x22, 0x3C, 0x2F, 
+    0x64, 0x69, 0x76, 0x3E, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x48, 0x74, 0x6D, 0x6C, 0x20, 0x2B, 0x3D, 
+    0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x48, 0x74, 0x6D, 0x6C, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x20, 0x22, 
+    0x23, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x5F, 0x6C, 0x69, 0x73, 0x74, 0x22, 0x20, 0x29, 0x2E, 
+    0x68, 0x74, 0x6D, 0x6C, 0x28, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x48, 0x74, 0x6D, 0x6C, 
+    0x20, 0x29, 0x2E, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x28, 0x20, 0x27, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x27, 
+    0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x20, 0x22, 0x23, 0x70, 0x72, 0x6F, 
+    0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 0x20, 0x29, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x20, 0x29, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x7D, 0x0A, 0x0A, 0x2F, 0x2F, 0x20, 0x4C, 0x6F, 0x61, 0x64, 0x20, 0x63, 0x75, 0x72, 
+    0x72, 0x65, 0x6E, 0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x73, 0x20, 0x6F, 0x66, 0x20, 0x63, 0x61, 0x6D, 0x65, 0x72, 
+    0x61, 0x27, 0x73, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x53, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x28, 0x20, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x24, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x28, 
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x3A, 0x20, 0x22, 0x47, 0x45, 0x54, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x75, 0x72, 0x6C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x22, 0x2F, 0x63, 0x61, 0x6D, 0x65, 
+    0x72, 0x61, 0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x54, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x22, 0x61, 0x70, 0x70, 0x6C, 0x69, 
+    0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x3B, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 
+    0x3D, 0x75, 0x74, 0x66, 0x2D, 0x38, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 
+    0x6E, 0x63, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3A, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x64, 0x61, 
+    0x74, 0x61, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x22, 0x4F, 0x4B, 0x22, 0x20, 0x29, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x6C, 0x6F, 
+    0x67, 0x28, 0x20, 0x22, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x67, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x20, 0x63, 
+    0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 0x20, 0x29, 0x3B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x3D, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x63, 0x6F, 0x6E, 0x66, 
+    0x69, 0x67, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x4C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 
+    0x77, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x75, 0x72, 0x65, 0x3A, 0x20, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x20, 0x65, 0x72, 0x72, 0x4D, 0x73, 0x67, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 
+    0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x6C, 0x6F, 0x67, 0x28, 0x20, 0x65, 0x72, 0x72, 0x4D, 0x73, 0x67, 0x20, 0x29, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 
+    0x0A, 0x0A, 0x2F, 0x2F, 0x20, 0x4C, 0x6F, 0x61, 0x64, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x20, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x27, 0x73, 0x20, 0x70, 0x72, 0x6F, 
+    0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x2C, 0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 
+    0x74, 0x79, 0x70, 0x65, 0x2C, 0x20, 0x6D, 0x69, 0x6E, 0x2F, 0x6D, 0x61, 0x78, 0x2F, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 
+    0x74, 0x20, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x6F, 0x61, 
+    0x64, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x49, 0x6E, 0x66, 0x6F, 0x28, 0x20, 0x29, 0x0A, 0x7B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 
+    0x65, 0x28, 0x20, 0x61, 0x2C, 0x20, 0x62, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x61, 0x5B, 0x31, 0x5D, 0x2E, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 
+    0x3C, 0x20, 0x62, 0x5B, 0x31, 0x5D, 0x2E, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x2D, 0x31, 0x3B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x61, 0x5B, 0x31, 0x5D, 0x2E, 0x6F, 0x72, 0x64, 0x65, 
+    0x72, 0x20, 0x3E, 0x20, 0x62, 0x5B, 0x31, 0x5D, 0x2E, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x24, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x28, 0x20, 
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x3A, 0x20, 0x22, 0x47, 0x45, 0x54, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 
+    0x72, 0x6C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x22, 0x2F, 0x63, 0x61, 0x6D, 0x65, 0x72, 
+    0x61, 0x2F, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x54, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x22, 0x61, 0x70, 
+    0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x3B, 0x20, 0x63, 0x68, 0x61, 0x72, 
+    0x73, 0x65, 0x74, 0x3D, 0x75, 0x74, 0x66, 0x2D, 0x38, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3A, 0x20, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 
+    0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x22, 0x4F, 0x4B, 0x22, 
+    0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 
+    0x2E, 0x6C, 0x6F, 0x67, 0x28, 0x20, 0x22, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x67, 0x65, 0x74, 0x74, 0x69, 0x6E, 
+    0x67, 0x20, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 
+    0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6F, 0x72, 0x20, 0x28, 0x20, 0x76, 0x61, 0x72, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x69, 
+    0x6E, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 
+    0x74, 0x69, 0x65, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x20, 0x5B, 0x20, 0x6B, 0x65, 0x79, 0x2C, 0x20, 0x64, 0x61, 
+    0x74, 0x61, 0x2E, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x5B, 0x6B, 0x65, 0x79, 0x5D, 0x20, 0x5D, 0x20, 0x29, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x2E, 0x73, 0x6F, 
+    0x72, 0x74, 0x28, 0x20, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x4C, 0x6F, 
+    0x61, 0x64, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x73, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x61, 0x69, 0x6C, 0x75, 0x72, 0x65, 0x3A, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x20, 0x65, 0x72, 
+    0x72, 0x4D, 0x73, 0x67, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x6C, 0x6F, 0x67, 
+    0x28, 0x20, 0x65, 0x72, 0x72, 0x4D, 0x73, 0x67, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x67, 0x65, 0x74, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x20, 0x29, 0x0A, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x4C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 
+    0x74, 0x69, 0x65, 0x73, 0x4C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0A, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x43, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x53, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x50, 0x72, 0x6F, 
+    0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x49, 0x6E, 0x66, 0x6F, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x67, 
+    0x65, 0x74, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x3C, 0x2F, 0x73, 0x63, 0x72, 
+    0x69, 0x70, 0x74, 0x3E, 0x0A, 
+};
+
+uint8_t cameraproperties_html_gzip_data[]
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xED, 0x58, 0x5B, 0x6F, 0x1A, 0x39, 0x14, 0x7E, 0x9F, 0x5F, 
+    0x71, 0xD6, 0x5B, 0x35, 0x20, 0x08, 0x24, 0x6F, 0xAB, 0x0C, 0xB0, 0x52, 0xB3, 0x97, 0x56, 0xDB, 0x6A, 0xAB, 0x36, 0x6F, 
+    0x80, 0x2A, 0x33, 0x63, 0xC0, 0x64, 0x32, 0x46, 0xB6, 0x27, 0x1B, 0x14, 0xF1, 0xDF, 0xF7, 0xD8, 0x73, 0xBF, 0x01, 0x49, 
+    0x5B, 0x35, 0x2B, 0x2D, 0x2F, 0xCC, 0xD8, 0xE7, 0x1C, 0x9F, 0xCB, 0x77, 0x2E, 0x9E, 0x91, 0xCF, 0xEF, 0x81, 0xFB, 0x63, 
+    0xB2, 0x95, 0x62, 0xCB, 0xA4, 0xE6, 0x4C, 0x11, 0x50, 0x7A, 0x17, 0xB0, 0x31, 0xF1, 0xB9, 0xDA, 0x06, 0x74, 0x77, 0x05, 
+    0xA1, 0x08, 0x99, 0x4B, 0x26, 0x8E, 0x33, 0xAA, 0x53, 0x7F, 0x09, 0xB8, 0xD2, 0xB8, 0x37, 0x1A, 0xE2, 0x9E, 0x21, 0x59, 
+    0x44, 0x5A, 0x8B, 0x10, 0xF4, 0x6E, 0x8B, 0x22, 0xE2, 0x17, 0x62, 0x79, 0x24, 0x53, 0x4C, 0x13, 0x10, 0xA1, 0x17, 0x70, 
+    0xEF, 0x36, 0x79, 0xBF, 0x11, 0xBF, 0xB1, 0x25, 0x8D, 0x02, 0xAD, 0x3A, 0x5D, 0x32, 0xF9, 0x64, 0x96, 0x40, 0x0B, 0x48, 
+    0x17, 0x47, 0xC3, 0x58, 0xC2, 0x04, 0x1C, 0xC8, 0x8F, 0x50, 0x9E, 0xE4, 0x5B, 0x8D, 0x4F, 0xF7, 0x54, 0x82, 0x27, 0xC2, 
+    0x25, 0x5F, 0x81, 0xF9, 0x8D, 0xE1, 0x11, 0xF6, 0xAE, 0x5D, 0xCD, 0x15, 0xC4, 0xD5, 0x29, 0xCC, 0xDD, 0x22, 0xF1, 0x7B, 
+    0x41, 0x7D, 0xE6, 0x27, 0x2C, 0x4B, 0x1A, 0x28, 0x56, 0x65, 0x4A, 0x28, 0xB2, 0x5D, 0x67, 0x38, 0x84, 0x58, 0x39, 0x1A, 
+    0x04, 0xE0, 0xD1, 0x3B, 0x26, 0xE9, 0x99, 0x2A, 0x9E, 0x82, 0x4A, 0xEB, 0x35, 0xE3, 0x12, 0xFC, 0x58, 0x75, 0xB8, 0xA7, 
+    0x41, 0xC4, 0x94, 0xB3, 0x8C, 0x42, 0x4F, 0x73, 0x74, 0x48, 0xD5, 0x5C, 0xE8, 0x3A, 0x8F, 0x8E, 0x51, 0x81, 0x2F, 0xA1, 
+    0x53, 0x56, 0xEC, 0xF5, 0xEB, 0xBA, 0x2A, 0x5D, 0x4B, 0xFB, 0x08, 0x95, 0x9F, 0x93, 0x3E, 0x2C, 0x85, 0x44, 0x31, 0xC6, 
+    0x0A, 0x8E, 0x6A, 0x5F, 0xF4, 0x21, 0x60, 0x21, 0x3E, 0xE4, 0x72, 0x06, 0xB8, 0xB0, 0xD2, 0x6B, 0x17, 0xF7, 0x47, 0x66, 
+    0x13, 0x1F, 0x7A, 0xBD, 0x44, 0xAC, 0x15, 0xED, 0x14, 0xE5, 0x16, 0x94, 0x9A, 0xE6, 0x32, 0xA6, 0x7C, 0x3E, 0xBD, 0x98, 
+    0xCF, 0x0B, 0x5C, 0x75, 0x4E, 0xF3, 0x33, 0x6A, 0x6C, 0xAE, 0x45, 0xA8, 0xA5, 0x08, 0x50, 0x89, 0x57, 0x1D, 0x20, 0x3F, 
+    0x13, 0xE8, 0x41, 0x55, 0x12, 0x74, 0xDD, 0x46, 0x5E, 0x2F, 0x61, 0x45, 0xDE, 0x54, 0x0C, 0x52, 0x97, 0x69, 0x6B, 0x8C, 
+    0x56, 0xE5, 0xF2, 0x09, 0x97, 0xF3, 0x81, 0xC1, 0x21, 0x8C, 0xC7, 0x40, 0x78, 0x88, 0xE0, 0xEB, 0xD6, 0xB8, 0xEA, 0xCA, 
+    0x9B, 0x5F, 0xA2, 0xC0, 0xC0, 0x06, 0xB1, 0xE4, 0xC6, 0x44, 0x2C, 0x46, 0xD9, 0x3D, 0xC8, 0x89, 0x30, 0x5F, 0xD3, 0x70, 
+    0xC5, 0x3A, 0xC6, 0xC6, 0x46, 0xCA, 0xD4, 0xB2, 0x81, 0x0A, 0xB8, 0xCF, 0x24, 0xFA, 0x48, 0xB2, 0x25, 0xA2, 0x64, 0x4D, 
+    0x9A, 0xDC, 0xB2, 0xAF, 0xAD, 0x30, 0x44, 0xE6, 0x31, 0xA3, 0x17, 0x42, 0x04, 0x4F, 0xB7, 0xDA, 0x5B, 0x33, 0xEF, 0xD6, 
+    0xC2, 0xBF, 0xD3, 0x68, 0xB9, 0x15, 0x7D, 0xD9, 0xA8, 0x66, 0xC5, 0x05, 0x26, 0xD3, 0x3B, 0x6D, 0x74, 0x87, 0xBD, 0x62, 
+    0x95, 0x58, 0x88, 0x07, 0x49, 0x7D, 0x2E, 0xBE, 0x8B, 0x73, 0x14, 0x0B, 0x98, 0xF7, 0x52, 0x41, 0x51, 0x20, 0x3C, 0x6C, 
+    0x6D, 0xFE, 0x96, 0x3F, 0x65, 0x0F, 0x36, 0xF3, 0xAA, 0xC5, 0x1A, 0xBA, 0x83, 0xB5, 0xBE, 0x0B, 0x8A, 0xAE, 0x79, 0x8B, 
+    0xEF, 0xB8, 0xAC, 0x25, 0x5F, 0xAD, 0x0C, 0x14, 0xCF, 0x3C, 0xC9, 0xA8, 0x66, 0x67, 0xC5, 0xE3, 0x2B, 0xB2, 0x8C, 0x18, 
+    0xB5, 0x16, 0xFF, 0x64, 0x2A, 0xEE, 0x9D, 0xBD, 0xAD, 0x93, 0x6F, 0x22, 0x1E, 0xF8, 0xF0, 0xF6, 0xE6, 0xC3, 0x7B, 0x5B, 
+    0x94, 0x1A, 0x8A, 0x65, 0x5E, 0x14, 0x8D, 0x80, 0xCF, 0x4C, 0x6B, 0x1E, 0xAE, 0x9E, 0x5B, 0x11, 0x9D, 0x62, 0xE1, 0xA8, 
+    0x58, 0x84, 0x41, 0x26, 0x75, 0xFF, 0xBD, 0xDC, 0x9A, 0x99, 0x70, 0xED, 0x52, 0xE5, 0xD3, 0x7E, 0x3B, 0xC3, 0x5E, 0x7C, 
+    0xFF, 0xA5, 0xB1, 0x82, 0xF6, 0x80, 0xCC, 0xC8, 0xA4, 0x64, 0xE5, 0x77, 0xAD, 0x8C, 0x25, 0x15, 0x7B, 0x46, 0xC7, 0x80, 
+    0x2E, 0x58, 0x60, 0x7C, 0x89, 0x6A, 0x1E, 0x52, 0xB1, 0xB6, 0x85, 0x3A, 0x84, 0x08, 0x0E, 0xB3, 0x7F, 0x35, 0x1A, 0x5A, 
+    0x31, 0x13, 0xE2, 0x9E, 0x78, 0x2A, 0x0F, 0xB7, 0x91, 0x8E, 0xA7, 0x8C, 0x19, 0x91, 0x26, 0x57, 0x66, 0x24, 0x76, 0x55, 
+    0xBB, 0x0E, 0x71, 0x4F, 0x4E, 0x48, 0x5A, 0x03, 0x15, 0x93, 0x12, 0x38, 0x51, 0x93, 0x3B, 0x1E, 0x36, 0x1E, 0x8A, 0xD6, 
+    0xE1, 0x56, 0x22, 0xED, 0x8E, 0x3E, 0xB4, 0x12, 0xD1, 0x87, 0x98, 0xE8, 0x54, 0xD3, 0x45, 0x68, 0x6D, 0x47, 0x79, 0x58, 
+    0x22, 0xFC, 0x80, 0x7D, 0x32, 0xC6, 0x7F, 0x4C, 0xA8, 0x3A, 0x7A, 0xCD, 0x55, 0x77, 0x66, 0xC7, 0x2C, 0x5B, 0x41, 0x8E, 
+    0x90, 0x0D, 0xDB, 0x3C, 0xFE, 0x43, 0x1A, 0x90, 0xED, 0xFD, 0xA6, 0xEE, 0xDB, 0xD6, 0xD3, 0x1A, 0xA1, 0x9F, 0x50, 0xF0, 
+    0x05, 0x4A, 0x85, 0x5F, 0x81, 0xA4, 0xBD, 0x8A, 0xC0, 0x15, 0x10, 0xF2, 0x84, 0x46, 0xD3, 0x06, 0xA9, 0x0C, 0x43, 0x6D, 
+    0x20, 0x4A, 0x30, 0x97, 0xF6, 0x27, 0x8B, 0x95, 0x5E, 0xA2, 0x36, 0x52, 0xF8, 0x54, 0xD3, 0xF3, 0x18, 0x14, 0x5A, 0x46, 
+    0x6C, 0x96, 0x4F, 0xBC, 0x69, 0x24, 0xDE, 0xA0, 0x4F, 0xCA, 0x81, 0x70, 0x0F, 0x45, 0xE2, 0x39, 0x19, 0x77, 0x34, 0xE1, 
+    0x0E, 0xE4, 0xDB, 0x37, 0x6F, 0xA6, 0x5F, 0x11, 0x92, 0x1F, 0x53, 0x5B, 0x62, 0x5B, 0x8E, 0x56, 0x93, 0x34, 0xD2, 0xBC, 
+    0x14, 0xEA, 0x72, 0xD6, 0x7D, 0xB6, 0xA2, 0xB0, 0xD5, 0x55, 0x33, 0x6F, 0xF2, 0x14, 0xAC, 0xE6, 0x8D, 0x6A, 0x13, 0x37, 
+    0x2A, 0x6F, 0x2D, 0xB8, 0xC7, 0xD4, 0xB5, 0x88, 0x42, 0xDD, 0x34, 0x89, 0x24, 0xFB, 0x59, 0xFF, 0xDA, 0x60, 0xFF, 0x2A, 
+    0xF2, 0xE0, 0x4A, 0xA9, 0x91, 0x1D, 0x4F, 0xCD, 0x34, 0x3D, 0x63, 0xDF, 0xB4, 0x0D, 0x87, 0xC9, 0x19, 0xD3, 0x8D, 0x75, 
+    0x13, 0xE2, 0xA2, 0xBD, 0x1D, 0x9A, 0xE4, 0xCD, 0xA4, 0x1D, 0xCA, 0xDE, 0x56, 0xAF, 0x34, 0x07, 0x4F, 0x6C, 0xED, 0x64, 
+    0x51, 0x2C, 0xF5, 0x47, 0xD4, 0x8C, 0xAB, 0x2F, 0xFE, 0x65, 0xB6, 0xE1, 0xCA, 0xE4, 0x18, 0xE3, 0xE5, 0x3C, 0xCE, 0xA3, 
+    0xF8, 0xBC, 0xB6, 0x70, 0xEE, 0xBF, 0xA6, 0x20, 0x0D, 0x63, 0x85, 0x4E, 0x4B, 0x52, 0xE7, 0xA0, 0x3C, 0x48, 0x24, 0x9A, 
+    0x1B, 0x74, 0x83, 0xB8, 0xCA, 0xDC, 0xD4, 0x1B, 0x97, 0xB8, 0xDD, 0x97, 0x3D, 0x70, 0x9A, 0x79, 0x10, 0xBC, 0x48, 0x4A, 
+    0x16, 0xA6, 0xD7, 0x6E, 0x10, 0xCB, 0xC3, 0x83, 0x67, 0x80, 0x3C, 0xD7, 0x31, 0x4B, 0x7D, 0xFE, 0x7C, 0x35, 0xA0, 0x1B, 
+    0xFA, 0xD0, 0x29, 0x64, 0x82, 0x2D, 0x73, 0xC9, 0x0F, 0x91, 0xFA, 0xE7, 0xEF, 0x37, 0xA4, 0x9F, 0x6D, 0x46, 0x32, 0x80, 
+    0xC2, 0xE6, 0x30, 0x3E, 0x78, 0x18, 0x43, 0xBF, 0x40, 0x67, 0x6E, 0x01, 0x78, 0xDE, 0x8D, 0x91, 0x85, 0x74, 0x74, 0xBB, 
+    0xC5, 0xB6, 0x40, 0x8D, 0x3A, 0xC3, 0x8D, 0x12, 0x38, 0x5C, 0x62, 0xED, 0x90, 0x8A, 0xE9, 0x71, 0xA4, 0x97, 0xE7, 0xBF, 
+    0x14, 0x18, 0xA9, 0xDA, 0x85, 0x5E, 0x76, 0x80, 0x29, 0x35, 0xF9, 0x9E, 0x8A, 0x3C, 0x04, 0xA4, 0xBA, 0x82, 0xD4, 0xB4, 
+    0x8E, 0xAD, 0x4B, 0x87, 0x87, 0x54, 0x43, 0x31, 0x50, 0x9A, 0xEA, 0x48, 0xD9, 0x66, 0xFA, 0xF7, 0x5F, 0xE4, 0xE8, 0x7C, 
+    0x8A, 0xDA, 0x2B, 0x11, 0xB0, 0x41, 0x20, 0x56, 0x18, 0x97, 0x3F, 0x28, 0x0F, 0x30, 0x51, 0x56, 0xB1, 0xEF, 0x12, 0x5F, 
+    0x43, 0x29, 0x58, 0x6D, 0xA8, 0x49, 0x3B, 0xCA, 0xF1, 0xF3, 0xCC, 0x77, 0x9D, 0x71, 0xAC, 0x6C, 0xFC, 0xE6, 0xB6, 0x50, 
+    0x65, 0x9F, 0x6B, 0x8C, 0x6F, 0xEA, 0x44, 0x95, 0x5B, 0x46, 0x2B, 0x9C, 0x73, 0xAF, 0x2E, 0xD1, 0xBC, 0x48, 0xB2, 0xA2, 
+    0x57, 0x99, 0x94, 0x1F, 0xD4, 0xAA, 0xD5, 0xAF, 0x25, 0xF7, 0xA4, 0xB4, 0x6E, 0x25, 0x55, 0xF6, 0x66, 0xA9, 0x00, 0x5A, 
+    0x1E, 0x62, 0x65, 0xBF, 0xB3, 0x10, 0x00, 0xBA, 0x10, 0x38, 0x7D, 0x34, 0x80, 0x16, 0xAF, 0x25, 0xFC, 0x96, 0x81, 0x69, 
+    0x67, 0x7D, 0x0B, 0xC4, 0x3E, 0x60, 0xD3, 0x19, 0xE2, 0xDC, 0x38, 0x2C, 0x7D, 0x6B, 0x2A, 0x83, 0xFB, 0x63, 0xC6, 0xFF, 
+    0x0E, 0x0F, 0xC9, 0xB1, 0x9D, 0x11, 0x79, 0xE2, 0x6E, 0x4B, 0x25, 0xDE, 0x30, 0x69, 0x1F, 0x16, 0xB5, 0xCB, 0x94, 0x85, 
+    0x09, 0x35, 0x25, 0x4F, 0x48, 0x9F, 0x49, 0x6C, 0x1F, 0x8B, 0xFC, 0xA5, 0x0C, 0x15, 0xC9, 0x74, 0x24, 0x43, 0x38, 0xBF, 
+    0x74, 0x5B, 0xB9, 0x27, 0x47, 0xB9, 0x0B, 0xCC, 0xC9, 0xCA, 0x45, 0x9A, 0xE4, 0x59, 0x7D, 0xF9, 0x36, 0x69, 0x59, 0xC0, 
+    0xE8, 0xFF, 0xA9, 0xF9, 0xBC, 0xD4, 0xCC, 0xC7, 0x91, 0x5B, 0xB6, 0x43, 0x10, 0x17, 0x53, 0xF4, 0xA9, 0x17, 0x49, 0x73, 
+    0xCB, 0xDE, 0x46, 0x6A, 0xDD, 0x81, 0xA9, 0x91, 0xD6, 0x2F, 0xCA, 0x9A, 0xE2, 0xC2, 0x1C, 0xE6, 0xA7, 0x7D, 0xF1, 0x39, 
+    0xB5, 0x1F, 0x9A, 0x03, 0x95, 0x90, 0xBA, 0x93, 0x66, 0x40, 0x93, 0xF8, 0x03, 0xCC, 0xFF, 0xB5, 0x5A, 0x93, 0x25, 0x3C, 
+    0x02, 0xA2, 0xDE, 0xEA, 0xDA, 0x3F, 0x88, 0xB7, 0x58, 0x9D, 0x7E, 0x10, 0x37, 0xDB, 0xCD, 0x4D, 0xD4, 0xCD, 0xF6, 0x6A, 
+    0x35, 0xC8, 0x2A, 0x54, 0xD6, 0xC3, 0x75, 0x70, 0xCC, 0x49, 0xBE, 0xE7, 0xFF, 0x0B, 0xFF, 0x22, 0x63, 0xF3, 0x8D, 0x18, 
+    0x00, 0x00, 
+};
+
+XEmbeddedContent web_cameraproperties_html =
+{
+    6285,
+    "text/html",
+    cameraproperties_html_data,
+    "3097a9ffcfc32880",
+    1342,
+    cameraproperties_html_gzip_data,
+    0,
+    nullptr,
+};
+
+#endif
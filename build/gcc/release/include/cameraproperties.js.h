@@ -0,0 +1,115 @@
+/*
+ * Auto generated header file to be used with web2cam
+ *
+ * Source file: cameraproperties.js
+ */
+
+#ifndef cameraproperties_js_h
+#define cameraproperties_js_h
+
+#include "XWebServer.hpp"
+
+uint8_t cameraproperties_js_data[]
+{
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x43, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x50, 0x72, 
+    0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x20, 0x73, 0x74, 0x72, 0x56, 0x61, 0x72, 0x2C, 0x20, 0x73, 0x74, 0x72, 0x56, 
+    0x61, 0x6C, 0x75, 0x65, 0x20, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x76, 0x61, 0x72, 
+    0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x4D, 0x61, 0x70, 0x20, 0x3D, 0x20, 0x7B, 0x20, 0x7D, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x4D, 0x61, 0x70, 0x5B, 0x73, 0x74, 0x72, 0x56, 0x61, 0x72, 
+    0x5D, 0x20, 0x3D, 0x20, 0x73, 0x74, 0x72, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x65, 0x74, 0x43, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x28, 0x20, 
+    0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x4D, 0x61, 0x70, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x43, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x50, 0x72, 0x6F, 
+    0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x28, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x4D, 0x61, 
+    0x70, 0x20, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x24, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x28, 0x20, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x3A, 0x20, 0x22, 0x50, 0x4F, 0x53, 0x54, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x72, 
+    0x6C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x22, 0x2F, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 
+    0x2F, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x61, 
+    0x74, 0x61, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x73, 0x74, 0x72, 
+    0x69, 0x6E, 0x67, 0x69, 0x66, 0x79, 0x28, 0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x73, 0x4D, 0x61, 0x70, 
+    0x20, 0x29, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x54, 
+    0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x22, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 
+    0x73, 0x6F, 0x6E, 0x3B, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3D, 0x75, 0x74, 0x66, 0x2D, 0x38, 0x22, 0x2C, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x20, 0x20, 0x20, 
+    0x20, 0x3A, 0x20, 0x22, 0x6A, 0x73, 0x6F, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 
+    0x73, 0x79, 0x6E, 0x63, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3A, 0x20, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 
+    0x64, 0x61, 0x74, 0x61, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x21, 0x3D, 0x20, 0x22, 0x4F, 0x4B, 0x22, 0x20, 
+    0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 
+    0x6C, 0x6F, 0x67, 0x28, 0x20, 0x22, 0x46, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x20, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 
+    0x20, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x3A, 0x20, 0x22, 0x20, 
+    0x2B, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x64, 0x61, 
+    0x74, 0x61, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 
+    0x6C, 0x6F, 0x67, 0x28, 0x20, 0x22, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x3A, 0x20, 0x22, 0x20, 0x2B, 0x20, 
+    0x64, 0x61, 0x74, 0x61, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x75, 0x72, 0x65, 0x3A, 0x20, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x20, 0x65, 0x72, 0x72, 0x4D, 0x73, 0x67, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 
+    0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x6C, 0x6F, 0x67, 0x28, 0x20, 0x65, 0x72, 0x72, 0x4D, 0x73, 0x67, 0x20, 0x29, 0x3B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x20, 0x29, 0x3B, 0x0A, 
+    0x7D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x42, 0x6F, 
+    0x6F, 0x6C, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x20, 0x63, 0x62, 0x20, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x73, 0x65, 0x74, 0x43, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 
+    0x28, 0x20, 0x63, 0x62, 0x2E, 0x69, 0x64, 0x2C, 0x20, 0x28, 0x20, 0x63, 0x62, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 
+    0x64, 0x20, 0x29, 0x20, 0x3F, 0x20, 0x31, 0x20, 0x3A, 0x20, 0x30, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x52, 0x61, 0x6E, 0x67, 0x65, 0x50, 0x72, 
+    0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x73, 0x65, 0x74, 0x43, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 
+    0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x2E, 0x69, 0x64, 0x2C, 0x20, 0x72, 0x61, 0x6E, 0x67, 0x65, 0x2E, 0x76, 0x61, 0x6C, 
+    0x75, 0x65, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x61, 
+    0x6E, 0x64, 0x6C, 0x65, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 
+    0x79, 0x28, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x73, 0x65, 0x74, 0x43, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x20, 
+    0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x69, 0x64, 0x2C, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 
+};
+
+uint8_t cameraproperties_js_gzip_data[]
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x7D, 0x54, 0xC1, 0x6E, 0xA3, 0x30, 0x10, 0xBD, 0xF3, 0x15, 
+    0x53, 0xD4, 0x03, 0x68, 0xD3, 0x64, 0x7B, 0xAB, 0x8A, 0xA2, 0x4A, 0xAD, 0xD4, 0xC3, 0x56, 0xDD, 0x44, 0x9B, 0x68, 0x2F, 
+    0xAB, 0x3D, 0x4C, 0x9C, 0x81, 0xB8, 0xF5, 0x1A, 0x64, 0x9B, 0x6A, 0xA3, 0x8A, 0x7F, 0xAF, 0xC1, 0x01, 0x13, 0xA0, 0xB5, 
+    0x84, 0xF0, 0x30, 0x6F, 0xDE, 0x7B, 0x33, 0x18, 0xD2, 0x52, 0x32, 0xC3, 0x73, 0x09, 0x9A, 0xCC, 0x03, 0xFE, 0x23, 0x85, 
+    0x6B, 0x95, 0x17, 0xA4, 0xCC, 0x31, 0x02, 0x6D, 0xD4, 0x6F, 0x54, 0x33, 0x77, 0x17, 0x25, 0x41, 0x1C, 0xBC, 0x07, 0x60, 
+    0xD7, 0x1B, 0xAA, 0xFA, 0xE2, 0xB8, 0x13, 0xA4, 0x9F, 0xB1, 0x80, 0x25, 0xBC, 0x43, 0x95, 0xB4, 0xB9, 0xEE, 0xF9, 0x1F, 
+    0xC7, 0xF0, 0xD7, 0xE6, 0x5B, 0x8E, 0x24, 0x68, 0x50, 0x43, 0x35, 0x4E, 0x3A, 0x3A, 0xA7, 0x8C, 0x93, 0xA0, 0x0A, 0x82, 
+    0xF4, 0x33, 0x7B, 0x13, 0x05, 0x27, 0x73, 0x97, 0x73, 0x7C, 0xC1, 0xFF, 0x11, 0xB8, 0xA8, 0x5E, 0xE6, 0x58, 0x50, 0xBB, 
+    0xBF, 0x85, 0x70, 0xBD, 0xDA, 0x6C, 0xC3, 0x59, 0x97, 0x2D, 0x95, 0x80, 0x5E, 0x76, 0xC1, 0x1A, 0x99, 0x05, 0xCB, 0x65, 
+    0xCA, 0xB3, 0x1E, 0x6E, 0x8F, 0x06, 0x3D, 0xEE, 0xC7, 0x66, 0xF5, 0x73, 0x6E, 0x9B, 0xE2, 0x32, 0xE3, 0xE9, 0x71, 0x68, 
+    0xC5, 0x57, 0x59, 0x1A, 0x43, 0xD2, 0x6C, 0x6B, 0x0B, 0x96, 0x1D, 0x8B, 0x42, 0x70, 0x86, 0x75, 0x4B, 0x8B, 0x17, 0x9D, 
+    0xCB, 0x04, 0xD8, 0x01, 0x95, 0x6D, 0x6E, 0x59, 0x9A, 0xF4, 0xEA, 0x66, 0x20, 0xB7, 0x3D, 0x19, 0xB7, 0x85, 0x35, 0xB8, 
+    0x97, 0x45, 0x7D, 0x94, 0xAC, 0x33, 0x63, 0x54, 0x49, 0x3E, 0xA7, 0x4B, 0xC6, 0x48, 0xEB, 0x5B, 0x68, 0x87, 0x17, 0x39, 
+    0xEF, 0x71, 0x87, 0xF0, 0xA3, 0xA9, 0x17, 0x4F, 0xC1, 0x21, 0x6C, 0x3F, 0x68, 0x4A, 0x0D, 0x17, 0x4B, 0x08, 0x57, 0x4F, 
+    0x61, 0xAF, 0x60, 0x5C, 0x74, 0xEA, 0x4D, 0xE7, 0x82, 0xE6, 0x22, 0xCF, 0x22, 0x08, 0x1F, 0x91, 0x0B, 0xDA, 0xD7, 0x2F, 
+    0xCA, 0xD8, 0xA1, 0x80, 0x1B, 0x23, 0x14, 0xA7, 0xD3, 0x64, 0x5B, 0x80, 0x6F, 0x67, 0x2A, 0x71, 0x32, 0x22, 0xF4, 0x4E, 
+    0xDA, 0xB2, 0x81, 0x87, 0x69, 0x1F, 0x63, 0x2F, 0xEB, 0xB1, 0xAA, 0x67, 0x1C, 0xEB, 0x56, 0xC1, 0x74, 0x54, 0xF9, 0xA1, 
+    0xA6, 0xB6, 0xBB, 0x52, 0x51, 0x7F, 0xA8, 0xA4, 0xD4, 0xB3, 0xCE, 0x3E, 0x1D, 0xEB, 0x99, 0xA3, 0x16, 0xEB, 0xB5, 0x9D, 
+    0x4A, 0x35, 0x3C, 0xE7, 0x07, 0x94, 0x7B, 0x41, 0xF7, 0x79, 0x2E, 0xFC, 0x77, 0xC8, 0x76, 0xDD, 0xE1, 0x9E, 0xF8, 0x4A, 
+    0xD9, 0x6E, 0xCE, 0xF7, 0x33, 0x68, 0x36, 0xEC, 0x40, 0xEC, 0xD5, 0xBE, 0x84, 0x18, 0xEE, 0xE0, 0xDA, 0x1E, 0x8C, 0xEF, 
+    0xD3, 0xF4, 0xBF, 0x50, 0x66, 0xE4, 0x19, 0x54, 0x1D, 0x7E, 0x25, 0xD1, 0x00, 0x1A, 0x15, 0xB7, 0x7B, 0x73, 0x7F, 0x83, 
+    0x29, 0xEA, 0x0D, 0x09, 0x6A, 0xE2, 0xDE, 0x6F, 0xA4, 0x7D, 0xF4, 0x95, 0x44, 0x07, 0x6A, 0x64, 0x7C, 0xD4, 0x93, 0xFA, 
+    0x00, 0x52, 0x54, 0x51, 0x7C, 0xAB, 0x04, 0x00, 0x00, 
+};
+
+XEmbeddedContent web_cameraproperties_js =
+{
+    1195,
+    "application/x-javascript",
+    cameraproperties_js_data,
+    "d1ebcceaba7f250d",
+    449,
+    cameraproperties_js_gzip_data,
+    0,
+    nullptr,
+};
+
+#endif
@@ -0,0 +1,303 @@
+/*
+ * Auto generated header file to be used with web2cam
+ *
+ * Source file: index.html
+ */
+
+#ifndef index_html_h
+#define index_html_h
+
+#include "XWebServer.hpp"
+
+uint8_t index_html_data[]
+{
+    0x3C, 0x21, 0x44, 0x4F, 0x43, 0x54, 0x59, 0x50, 0x45, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x74, 0x6D, 
+    0x6C, 0x3E, 0x0A, 0x3C, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6D, 0x65, 0x74, 0x61, 0x20, 
+    0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3D, 0x22, 0x75, 0x74, 0x66, 0x2D, 0x38, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x68, 0x65, 
+    0x65, 0x74, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x63, 0x73, 0x73, 0x22, 0x20, 
+    0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x73, 0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2F, 0x3E, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x73, 0x74, 0x79, 0x6C, 
+    0x65, 0x73, 0x68, 0x65, 0x65, 0x74, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x63, 
+    0x73, 0x73, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x6A, 0x71, 0x75, 0x65, 0x72, 0x79, 0x2E, 0x6D, 0x6F, 0x62, 
+    0x69, 0x6C, 0x65, 0x2E, 0x63, 0x73, 0x73, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x6C, 0x69, 0x6E, 
+    0x6B, 0x20, 0x72, 0x65, 0x6C, 0x3D, 0x22, 0x69, 0x63, 0x6F, 0x6E, 0x22, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x69, 
+    0x6D, 0x61, 0x67, 0x65, 0x2F, 0x70, 0x6E, 0x67, 0x22, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x63, 0x61, 0x6D, 0x32, 
+    0x77, 0x65, 0x62, 0x2E, 0x70, 0x6E, 0x67, 0x22, 0x20, 0x2F, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x63, 0x72, 
+    0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x2E, 0x6A, 0x73, 0x22, 0x3E, 
+    0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 
+    0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 
+    0x69, 0x65, 0x73, 0x2E, 0x6A, 0x73, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x6A, 0x71, 0x75, 0x65, 0x72, 
+    0x79, 0x2E, 0x6A, 0x73, 0x22, 0x3E, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x64, 0x6F, 0x63, 0x75, 0x6D, 
+    0x65, 0x6E, 0x74, 0x29, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x28, 0x27, 0x6D, 0x6F, 0x62, 0x69, 0x6C, 0x65, 0x69, 0x6E, 0x69, 
+    0x74, 0x27, 0x2C, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x28, 0x29, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x2E, 0x6D, 0x6F, 0x62, 0x69, 0x6C, 0x65, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 
+    0x65, 0x42, 0x74, 0x6E, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x20, 0x3D, 0x20, 0x27, 0x75, 0x6E, 0x75, 0x73, 0x65, 0x64, 0x27, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x2F, 0x73, 0x63, 0x72, 0x69, 
+    0x70, 0x74, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x73, 0x72, 0x63, 0x3D, 
+    0x22, 0x6A, 0x71, 0x75, 0x65, 0x72, 0x79, 0x2E, 0x6D, 0x6F, 0x62, 0x69, 0x6C, 0x65, 0x2E, 0x6A, 0x73, 0x22, 0x3E, 0x3C, 
+    0x2F, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x65, 0x61, 0x64, 0x3E, 0x0A, 0x3C, 0x62, 0x6F, 
+    0x64, 0x79, 0x3E, 0x0A, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x72, 0x6F, 0x6C, 0x65, 0x3D, 
+    0x22, 0x70, 0x61, 0x67, 0x65, 0x22, 0x3E, 0x0A, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x72, 
+    0x6F, 0x6C, 0x65, 0x3D, 0x22, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x74, 0x68, 
+    0x65, 0x6D, 0x65, 0x3D, 0x22, 0x62, 0x22, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6D, 0x67, 0x20, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x3D, 0x22, 0x33, 0x32, 0x22, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x22, 0x33, 0x32, 0x22, 
+    0x20, 0x73, 0x72, 0x63, 0x3D, 0x22, 0x63, 0x61, 0x6D, 0x32, 0x77, 0x65, 0x62, 0x5F, 0x77, 0x68, 0x69, 0x74, 0x65, 0x2E, 
+    0x70, 0x6E, 0x67, 0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3A, 0x6C, 0x65, 
+    0x66, 0x74, 0x3B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x3B, 0x6D, 0x61, 
+    0x72, 0x67, 0x69, 0x6E, 0x2D, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x31, 0x30, 0x70, 0x78, 0x3B, 0x6D, 0x61, 0x72, 0x67, 0x69, 
+    0x6E, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x35, 0x70, 0x78, 0x22, 0x2F, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x68, 0x31, 
+    0x20, 0x69, 0x64, 0x3D, 0x22, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x22, 0x3E, 0x52, 0x65, 0x6D, 0x6F, 0x74, 0x65, 0x20, 0x43, 
+    0x61, 0x6D, 0x65, 0x72, 0x61, 0x3C, 0x2F, 0x68, 0x31, 0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x61, 0x20, 0x68, 0x72, 
+    0x65, 0x66, 0x3D, 0x22, 0x23, 0x22, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x42, 
+    0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x69, 0x63, 0x6F, 0x6E, 0x3D, 0x22, 0x67, 0x65, 
+    0x61, 0x72, 0x22, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x22, 0x75, 0x69, 0x2D, 0x62, 0x74, 0x6E, 0x2D, 0x72, 0x69, 
+    0x67, 0x68, 0x74, 0x22, 0x3E, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3C, 0x2F, 0x61, 0x3E, 0x0A, 0x3C, 0x2F, 
+    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x72, 0x6F, 0x6C, 0x65, 
+    0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x3E, 0x0A, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 
+    0x3D, 0x22, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x22, 0x3E, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x3C, 0x69, 0x6D, 0x67, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x22, 
+    0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x22, 0x36, 0x34, 0x30, 0x22, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 
+    0x22, 0x34, 0x38, 0x30, 0x22, 0x3E, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 
+    0x69, 0x64, 0x3D, 0x22, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 
+    0x22, 0x20, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x20, 0x6E, 0x6F, 
+    0x6E, 0x65, 0x3B, 0x22, 0x3E, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 
+    0x0A, 0x0A, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x72, 0x6F, 0x6C, 0x65, 0x3D, 0x22, 0x66, 0x6F, 
+    0x6F, 0x74, 0x65, 0x72, 0x22, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x74, 0x68, 0x65, 0x6D, 0x65, 0x3D, 0x22, 0x62, 0x22, 
+    0x3E, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x63, 0x6F, 0x70, 0x79, 0x72, 
+    0x69, 0x67, 0x68, 0x74, 0x22, 0x3E, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x68, 0x74, 0x74, 0x70, 0x73, 
+    0x3A, 0x2F, 0x2F, 0x67, 0x69, 0x74, 0x68, 0x75, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x2F, 0x63, 0x76, 0x73, 0x61, 0x6E, 0x64, 
+    0x62, 0x6F, 0x78, 0x2F, 0x63, 0x61, 0x6D, 0x32, 0x77, 0x65, 0x62, 0x22, 0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 
+    0x22, 0x5F, 0x62, 0x6C, 0x61, 0x6E, 0x6B, 0x22, 0x3E, 0x63, 0x61, 0x6D, 0x32, 0x77, 0x65, 0x62, 0x20, 0x2D, 0x20, 0x63, 
+    0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x77, 0x65, 0x62, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x65, 0x72, 0x3C, 0x2F, 
+    0x61, 0x3E, 0x3C, 0x73, 0x70, 0x61, 0x6E, 0x20, 0x69, 0x64, 0x3D, 0x22, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x22, 
+    0x3E, 0x3C, 0x2F, 0x73, 0x70, 0x61, 0x6E, 0x3E, 0x20, 0x3A, 0x3A, 0x20, 0x43, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 
+    0x74, 0x20, 0xC2, 0xA9, 0x20, 0x32, 0x30, 0x31, 0x37, 0x2D, 0x32, 0x30, 0x31, 0x38, 0x20, 0x63, 0x76, 0x73, 0x61, 0x6E, 
+    0x64, 0x62, 0x6F, 0x78, 0x3C, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x3C, 0x2F, 
+    0x64, 0x69, 0x76, 0x3E, 0x0A, 0x0A, 0x3C, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x67, 0x65, 0x74, 0x43, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x49, 0x6E, 0x66, 0x6F, 0x28, 0x20, 
+    0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x24, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x28, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 0x79, 0x70, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 
+    0x22, 0x47, 0x45, 0x54, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x72, 0x6C, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x22, 0x2F, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x2F, 0x69, 0x6E, 
+    0x66, 0x6F, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 
+    0x54, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x22, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 
+    0x6A, 0x73, 0x6F, 0x6E, 0x3B, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3D, 0x75, 0x74, 0x66, 0x2D, 0x38, 0x22, 
+    0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 
+    0x63, 0x63, 0x65, 0x73, 0x73, 0x3A, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x20, 0x64, 0x61, 0x74, 
+    0x61, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x73, 0x74, 0x61, 0x74, 
+    0x75, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x4F, 0x4B, 0x22, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3D, 
+    0x20, 0x22, 0x22, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x76, 0x61, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3D, 0x20, 0x64, 
+    0x61, 0x74, 0x61, 0x2E, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x57, 0x69, 
+    0x64, 0x74, 0x68, 0x20, 0x3D, 0x20, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x20, 0x63, 0x6F, 0x6E, 0x66, 
+    0x69, 0x67, 0x2E, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x28, 0x20, 0x63, 0x6F, 0x6E, 0x66, 
+    0x69, 0x67, 0x2E, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x20, 0x29, 0x20, 0x26, 0x26, 0x20, 0x28, 0x20, 0x63, 0x6F, 0x6E, 0x66, 
+    0x69, 0x67, 0x2E, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x21, 0x3D, 0x20, 0x30, 
+    0x20, 0x29, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x74, 0x69, 
+    0x74, 0x6C, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x65, 
+    0x6C, 0x73, 0x65, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x64, 0x65, 0x76, 
+    0x69, 0x63, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x24, 0x28, 0x27, 0x23, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x27, 0x29, 0x2E, 0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x20, 
+    0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 0x77, 0x69, 0x64, 0x74, 0x68, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x27, 0x23, 0x63, 0x61, 0x6D, 0x65, 
+    0x72, 0x61, 0x27, 0x29, 0x2E, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x28, 0x20, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 0x2E, 
+    0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x20, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x27, 0x23, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x63, 0x6F, 0x6E, 
+    0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x27, 0x29, 0x2E, 0x77, 0x69, 0x64, 0x74, 0x68, 0x28, 0x20, 0x63, 0x61, 0x6D, 0x65, 
+    0x72, 0x61, 0x57, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2B, 0x20, 0x32, 0x30, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x27, 0x23, 0x63, 0x61, 0x6D, 0x65, 
+    0x72, 0x61, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x27, 0x29, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x20, 
+    0x7B, 0x20, 0x27, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x6C, 0x65, 0x66, 0x74, 0x27, 0x20, 0x3A, 0x20, 0x63, 0x61, 
+    0x6D, 0x65, 0x72, 0x61, 0x57, 0x69, 0x64, 0x74, 0x68, 0x20, 0x2B, 0x20, 0x34, 0x30, 0x20, 0x7D, 0x20, 0x29, 0x3B, 0x0A, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x27, 
+    0x23, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x27, 0x29, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x28, 0x20, 0x74, 0x69, 0x74, 0x6C, 0x65, 
+    0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x20, 0x3D, 0x20, 0x27, 0x77, 0x65, 
+    0x62, 0x32, 0x63, 0x61, 0x6D, 0x20, 0x3A, 0x3A, 0x20, 0x27, 0x20, 0x2B, 0x20, 0x74, 0x69, 0x74, 0x6C, 0x65, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x7D, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x75, 0x72, 0x65, 
+    0x3A, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x20, 0x65, 0x72, 0x72, 0x4D, 0x73, 0x67, 0x20, 0x29, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x63, 0x6F, 0x6E, 0x73, 0x6F, 0x6C, 0x65, 0x2E, 0x6C, 0x6F, 0x67, 0x28, 0x20, 0x65, 0x72, 0x72, 0x4D, 
+    0x73, 0x67, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x7D, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x67, 0x65, 0x74, 
+    0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x49, 0x6E, 0x66, 0x6F, 0x28, 0x20, 0x29, 0x0A, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x24, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x28, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x74, 
+    0x79, 0x70, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x22, 0x47, 0x45, 0x54, 0x22, 0x2C, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x72, 0x6C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x3A, 0x20, 0x22, 0x2F, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x54, 0x79, 0x70, 0x65, 0x20, 0x3A, 0x20, 0x22, 0x61, 0x70, 0x70, 
+    0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x3B, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 
+    0x65, 0x74, 0x3D, 0x75, 0x74, 0x66, 0x2D, 0x38, 0x22, 0x2C, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x61, 
+    0x73, 0x79, 0x6E, 0x63, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x3A, 0x20, 0x74, 0x72, 0x75, 0x65, 0x2C, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3A, 0x20, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 
+    0x28, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x20, 0x3D, 0x3D, 0x20, 0x22, 0x4F, 0x4B, 
+    0x22, 0x20, 0x29, 0x20, 0x26, 0x26, 0x20, 0x28, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x63, 0x6F, 0x6E, 0x66, 0x69, 0x67, 
+    0x2E, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x29, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x24, 0x28, 0x27, 0x23, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x27, 0x29, 0x2E, 0x68, 0x74, 0x6D, 
+    0x6C, 0x28, 0x20, 0x22, 0x20, 0x3A, 0x3A, 0x20, 0x22, 0x20, 0x2B, 0x20, 0x64, 0x61, 0x74, 0x61, 0x2E, 0x63, 0x6F, 0x6E, 
+    0x66, 0x69, 0x67, 0x2E, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x7D, 0x20, 0x29, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x76, 0x61, 0x72, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x69, 
+    0x6E, 0x67, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0A, 
+    0x0A, 0x2F, 0x2F, 0x20, 0x4C, 0x6F, 0x61, 0x64, 0x20, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x73, 0x65, 0x74, 0x74, 
+    0x69, 0x6E, 0x67, 0x73, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x73, 0x0A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x28, 0x20, 0x29, 0x0A, 0x7B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x69, 0x66, 0x20, 0x28, 0x20, 0x21, 0x73, 0x68, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x53, 0x65, 
+    0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x76, 0x61, 0x72, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x4E, 0x6F, 0x77, 0x20, 0x3D, 0x20, 0x6E, 0x65, 0x77, 
+    0x20, 0x44, 0x61, 0x74, 0x65, 0x28, 0x20, 0x29, 0x2E, 0x67, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x28, 0x20, 0x29, 0x3B, 
+    0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x28, 0x7B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x75, 0x72, 0x6C, 0x3A, 0x20, 0x27, 0x2F, 0x63, 0x61, 
+    0x6D, 0x65, 0x72, 0x61, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x3F, 
+    0x3D, 0x27, 0x20, 0x2B, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x4E, 0x6F, 0x77, 0x2C, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3A, 0x20, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x64, 0x61, 0x74, 0x61, 0x29, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x24, 0x28, 0x20, 0x22, 0x23, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 
+    0x65, 0x73, 0x22, 0x20, 0x29, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x28, 0x20, 0x64, 0x61, 0x74, 0x61, 0x20, 0x29, 0x2E, 0x74, 
+    0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x28, 0x20, 0x27, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x27, 0x20, 0x29, 0x3B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x20, 0x22, 
+    0x23, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 0x20, 0x29, 
+    0x2E, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x20, 0x22, 0x23, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 
+    0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x20, 0x29, 0x2E, 0x61, 0x64, 0x64, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x28, 0x20, 
+    0x27, 0x75, 0x69, 0x2D, 0x62, 0x74, 0x6E, 0x2D, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x20, 0x29, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x69, 
+    0x6E, 0x67, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x74, 0x72, 0x75, 0x65, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 
+    0x20, 0x7D, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x65, 0x6C, 0x73, 0x65, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x20, 0x22, 0x23, 0x63, 
+    0x61, 0x6D, 0x65, 0x72, 0x61, 0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x22, 0x20, 0x29, 0x2E, 0x68, 
+    0x69, 0x64, 0x65, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x20, 0x22, 
+    0x23, 0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x20, 0x29, 0x2E, 0x72, 
+    0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x28, 0x20, 0x27, 0x75, 0x69, 0x2D, 0x62, 0x74, 0x6E, 0x2D, 
+    0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x27, 0x20, 0x29, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x73, 
+    0x68, 0x6F, 0x77, 0x69, 0x6E, 0x67, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x20, 0x3D, 0x20, 0x66, 0x61, 0x6C, 
+    0x73, 0x65, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x7D, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x24, 0x28, 0x20, 0x22, 0x23, 
+    0x73, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x20, 0x29, 0x2E, 0x62, 0x6C, 
+    0x75, 0x72, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 
+    0x61, 0x6C, 0x73, 0x65, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 
+    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x20, 0x27, 0x73, 0x65, 0x74, 0x74, 0x69, 
+    0x6E, 0x67, 0x73, 0x42, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x27, 0x20, 0x29, 0x2E, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 
+    0x20, 0x3D, 0x20, 0x73, 0x68, 0x6F, 0x77, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3B, 0x0A, 0x0A, 0x2F, 0x2F, 
+    0x20, 0x67, 0x65, 0x74, 0x20, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x69, 0x6E, 0x66, 0x6F, 0x72, 0x6D, 0x61, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x69, 0x6B, 0x65, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
+    0x2C, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x0A, 0x67, 0x65, 0x74, 0x43, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x49, 0x6E, 
+    0x66, 0x6F, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x2F, 0x2F, 0x20, 0x67, 0x65, 0x74, 0x20, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 
+    0x6E, 0x20, 0x6F, 0x66, 0x20, 0x74, 0x68, 0x65, 0x20, 0x73, 0x74, 0x72, 0x65, 0x61, 0x6D, 0x65, 0x72, 0x0A, 0x67, 0x65, 
+    0x74, 0x56, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 0x49, 0x6E, 0x66, 0x6F, 0x28, 0x20, 0x29, 0x3B, 0x0A, 0x2F, 0x2F, 0x20, 
+    0x73, 0x74, 0x61, 0x72, 0x74, 0x20, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x28, 0x69, 0x74, 0x20, 0x64, 0x65, 0x66, 
+    0x61, 0x75, 0x6C, 0x74, 0x73, 0x20, 0x74, 0x6F, 0x20, 0x4D, 0x4A, 0x50, 0x45, 0x47, 0x3B, 0x20, 0x62, 0x75, 0x74, 0x20, 
+    0x69, 0x66, 0x20, 0x69, 0x74, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x73, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x20, 0x74, 0x6F, 0x20, 
+    0x4A, 0x50, 0x45, 0x47, 0x2C, 0x20, 0x74, 0x68, 0x65, 0x6E, 0x20, 0x74, 0x72, 0x79, 0x20, 0x6B, 0x65, 0x65, 0x70, 0x69, 
+    0x6E, 0x67, 0x20, 0x33, 0x30, 0x20, 0x66, 0x70, 0x73, 0x20, 0x72, 0x61, 0x74, 0x65, 0x29, 0x0A, 0x43, 0x61, 0x6D, 0x65, 
+    0x72, 0x61, 0x2E, 0x53, 0x74, 0x61, 0x72, 0x74, 0x28, 0x20, 0x33, 0x30, 0x20, 0x29, 0x3B, 0x0A, 0x0A, 0x3C, 0x2F, 0x73, 
+    0x63, 0x72, 0x69, 0x70, 0x74, 0x3E, 0x0A, 0x3C, 0x2F, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x0A, 0x3C, 0x2F, 0x68, 0x74, 0x6D, 
+    0x6C, 0x3E, 0x0A, 
+};
+
+uint8_t index_html_gzip_data[]
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xCD, 0x57, 0xDD, 0x6E, 0xDB, 0x36, 0x14, 0xBE, 0xF7, 0x53, 
+    0x9C, 0xAA, 0x45, 0x2D, 0x63, 0xB1, 0xE4, 0xA4, 0xDD, 0x56, 0xF8, 0x6F, 0x40, 0xD3, 0xA0, 0xC8, 0xB6, 0xAE, 0xC5, 0x1A, 
+    0x6C, 0xD8, 0x55, 0x41, 0x4B, 0x94, 0xCC, 0x44, 0xA2, 0x54, 0x92, 0x72, 0x62, 0x14, 0x79, 0xA0, 0xBD, 0xC6, 0x9E, 0x6C, 
+    0x87, 0xA4, 0x28, 0xC9, 0x91, 0xD5, 0x00, 0xC5, 0x2E, 0xE6, 0x8B, 0xC4, 0xE2, 0xF9, 0xE3, 0xF9, 0xCE, 0x77, 0x8E, 0x8E, 
+    0x97, 0x4F, 0xDE, 0xBC, 0x3F, 0xBF, 0xFA, 0xEB, 0xC3, 0x05, 0x6C, 0x55, 0x9E, 0xAD, 0x47, 0x4B, 0xF7, 0x8F, 0x92, 0x78, 
+    0x3D, 0x02, 0xFC, 0x2C, 0x73, 0xAA, 0x08, 0x44, 0x5B, 0x22, 0x24, 0x55, 0x2B, 0xAF, 0x52, 0xC9, 0xF4, 0x95, 0x57, 0x8B, 
+    0x32, 0xC6, 0x6F, 0x40, 0xD0, 0x6C, 0xE5, 0x49, 0xB5, 0xCF, 0xA8, 0xDC, 0x52, 0xAA, 0x3C, 0x50, 0xFB, 0x92, 0xAE, 0x3C, 
+    0x45, 0xEF, 0x54, 0x18, 0x49, 0xE9, 0xC1, 0x56, 0xD0, 0xC4, 0x69, 0x04, 0xE6, 0x24, 0xFC, 0x06, 0xFB, 0xEB, 0xCF, 0x15, 
+    0x15, 0xFB, 0x20, 0x2F, 0x36, 0x2C, 0xA3, 0x43, 0x6E, 0x58, 0x54, 0x70, 0xE7, 0x80, 0xE5, 0x24, 0xA5, 0x61, 0xC9, 0x53, 
+    0xE7, 0x21, 0x22, 0xF9, 0xD9, 0x2D, 0xDD, 0x04, 0xE6, 0xC8, 0xD9, 0xCA, 0x48, 0xB0, 0x52, 0x81, 0x14, 0x91, 0x51, 0xA0, 
+    0x82, 0x04, 0xD7, 0xD2, 0x5B, 0x2F, 0x43, 0x2B, 0x18, 0xD4, 0x2A, 0x45, 0x51, 0x52, 0xA1, 0x18, 0xA6, 0xF4, 0x88, 0x7E, 
+    0x7D, 0xF1, 0x41, 0x2D, 0xFB, 0xF0, 0xCC, 0x8F, 0x8B, 0xA8, 0xCA, 0x29, 0x57, 0x93, 0x60, 0xC3, 0x78, 0xEC, 0x8F, 0x6D, 
+    0xA6, 0x8C, 0x33, 0x35, 0x3E, 0x81, 0xA4, 0xE2, 0x91, 0x62, 0x05, 0x07, 0x7F, 0x02, 0x5F, 0x8C, 0x81, 0x31, 0x72, 0x70, 
+    0x10, 0x14, 0xEE, 0xE8, 0x6B, 0xC5, 0xCF, 0x33, 0x22, 0x25, 0xAC, 0x60, 0x5C, 0xF1, 0x4A, 0xD2, 0x78, 0xBC, 0x30, 0xBA, 
+    0xF7, 0x13, 0xFB, 0xFF, 0xF1, 0x5B, 0xD6, 0xFE, 0x0E, 0x2F, 0xBB, 0x0C, 0x2D, 0x1D, 0x96, 0x9B, 0x22, 0xDE, 0xAF, 0x47, 
+    0xA3, 0x65, 0xCC, 0x76, 0x10, 0x13, 0x45, 0xA6, 0xA2, 0xC8, 0x10, 0xE9, 0x12, 0x81, 0xF6, 0x8E, 0x9C, 0x6B, 0x2B, 0x2A, 
+    0x3C, 0x7B, 0xA4, 0xB6, 0x34, 0xC7, 0xB3, 0x8D, 0xE3, 0x0E, 0xCB, 0x53, 0xB8, 0x65, 0xB1, 0xDA, 0xAE, 0xBC, 0x17, 0x67, 
+    0x58, 0x22, 0xCA, 0xD2, 0xAD, 0xB2, 0xDF, 0x1D, 0xCC, 0xBA, 0x5A, 0x9F, 0x6E, 0xB7, 0x4C, 0x51, 0x5B, 0x33, 0x43, 0x92, 
+    0x95, 0x97, 0x64, 0x05, 0x51, 0xF3, 0x8C, 0x26, 0x6A, 0x11, 0x33, 0x59, 0x66, 0x64, 0x3F, 0x67, 0x1C, 0x39, 0x40, 0x17, 
+    0x39, 0x11, 0x29, 0xE3, 0x53, 0x2D, 0x9A, 0x9F, 0xCE, 0xCA, 0x3B, 0x77, 0xA0, 0x8A, 0x72, 0xFE, 0x7D, 0x79, 0xE7, 0xB9, 
+    0xA2, 0x6F, 0x4F, 0x81, 0xC5, 0x48, 0x31, 0xA6, 0x32, 0xBC, 0xF8, 0xEF, 0x34, 0x2F, 0x14, 0x85, 0x73, 0x53, 0x57, 0xCC, 
+    0xF5, 0xB4, 0xD6, 0x22, 0x35, 0x6F, 0x9E, 0x7A, 0x46, 0x1B, 0xE9, 0xAF, 0x18, 0x4F, 0xE5, 0xEB, 0x4A, 0x29, 0xCD, 0x32, 
+    0x93, 0x95, 0x26, 0xDC, 0xCA, 0x4B, 0x29, 0xC1, 0x34, 0x23, 0x8D, 0x3D, 0x76, 0x08, 0x9B, 0x6E, 0x14, 0x9F, 0x0A, 0x9D, 
+    0x8F, 0xB7, 0xFE, 0x58, 0x5B, 0x2D, 0x43, 0xA2, 0x81, 0x44, 0x84, 0x8E, 0x00, 0x85, 0x4E, 0x14, 0x56, 0xBE, 0xC1, 0x50, 
+    0x87, 0xB3, 0x34, 0xD3, 0x12, 0x82, 0xA9, 0x89, 0x2E, 0x6C, 0xAD, 0xD8, 0x73, 0x10, 0xFE, 0xF0, 0x72, 0xD6, 0x62, 0xF8, 
+    0xF2, 0xD5, 0xCC, 0x7B, 0x10, 0xAC, 0x35, 0x69, 0x89, 0xDB, 0x00, 0xEA, 0x50, 0x04, 0x5E, 0x20, 0x88, 0x5D, 0xD3, 0x81, 
+    0xFB, 0x26, 0x05, 0x02, 0x36, 0x54, 0xD8, 0x26, 0x5C, 0x51, 0xEE, 0x6B, 0x10, 0x1A, 0x28, 0xB7, 0x4A, 0x95, 0x72, 0x1E, 
+    0x86, 0x29, 0x53, 0xDB, 0x6A, 0x13, 0x44, 0x45, 0x1E, 0x46, 0x3B, 0x49, 0x78, 0xBC, 0x29, 0xEE, 0xC2, 0xBA, 0xE2, 0xD8, 
+    0xBF, 0x58, 0x35, 0x3D, 0x6B, 0x3E, 0x6D, 0x32, 0xC2, 0x6F, 0xBC, 0x75, 0x2D, 0x80, 0x29, 0xD8, 0x14, 0x40, 0x3F, 0x48, 
+    0x25, 0xA8, 0x7E, 0xD2, 0xC0, 0x2E, 0x65, 0x49, 0xB8, 0x09, 0xBA, 0xA3, 0x42, 0x62, 0x9B, 0x18, 0xF6, 0xE2, 0xD9, 0x1A, 
+    0xE6, 0x73, 0x38, 0x77, 0x17, 0x81, 0x7F, 0xFE, 0x86, 0xB3, 0xD9, 0xE9, 0x8F, 0x53, 0xFC, 0xF3, 0x0A, 0x9A, 0xC0, 0x4B, 
+    0x93, 0x64, 0x2F, 0x67, 0xC7, 0xFE, 0x51, 0xD3, 0x7B, 0x78, 0x29, 0x4B, 0x92, 0x4B, 0x9E, 0x14, 0x3E, 0x4C, 0x46, 0xB6, 
+    0x13, 0x9F, 0x05, 0xE4, 0x9A, 0xDC, 0xF9, 0x9D, 0xBE, 0xD4, 0x03, 0xC8, 0x7D, 0x9F, 0x83, 0xF7, 0xF6, 0xE2, 0xCA, 0x3B, 
+    0x69, 0x84, 0x95, 0xC8, 0xA0, 0x23, 0x0C, 0x6D, 0x4E, 0x21, 0x43, 0x9F, 0x1D, 0xAD, 0x9A, 0x12, 0x57, 0xDA, 0x13, 0x6A, 
+    0x91, 0xB2, 0xCC, 0x58, 0x44, 0xF4, 0x35, 0xC2, 0x6B, 0x59, 0xF0, 0x45, 0x33, 0x91, 0xED, 0x40, 0x6E, 0x0D, 0x89, 0xDC, 
+    0xF3, 0xA8, 0x71, 0xAF, 0x44, 0x45, 0x5B, 0x99, 0xAC, 0xA2, 0x88, 0x4A, 0x39, 0x6F, 0xC6, 0x89, 0x6F, 0x4A, 0x88, 0x99, 
+    0x38, 0x8D, 0x36, 0x07, 0xFD, 0x61, 0x09, 0x58, 0x8D, 0x40, 0x2A, 0xA2, 0x2A, 0x1C, 0x2C, 0x2B, 0xF0, 0xDE, 0xFF, 0xE2, 
+    0x75, 0x0C, 0xFA, 0x46, 0xFA, 0xB3, 0x23, 0x02, 0x4C, 0x77, 0xD5, 0xCF, 0x68, 0xE6, 0x2D, 0x8E, 0x6A, 0x61, 0x9E, 0x09, 
+    0x4B, 0x9D, 0x96, 0x89, 0x65, 0x8F, 0x06, 0xD4, 0x0D, 0x58, 0x7F, 0x6A, 0xD2, 0xA3, 0x7A, 0xA9, 0x21, 0xB8, 0xE4, 0xCA, 
+    0xAF, 0xDD, 0x04, 0xA6, 0x1B, 0x00, 0xA7, 0x5D, 0xCF, 0xD8, 0xA4, 0xD2, 0xE8, 0xD9, 0xBB, 0x4D, 0xE0, 0xF9, 0xF3, 0x07, 
+    0x67, 0x41, 0x46, 0x79, 0x8A, 0x2E, 0x9E, 0xAC, 0x60, 0x86, 0xF2, 0x49, 0xCF, 0x4F, 0x3F, 0x57, 0x53, 0x70, 0xE3, 0x6F, 
+    0x75, 0xE0, 0xAA, 0x9F, 0xC0, 0x7D, 0xEF, 0x84, 0x66, 0x92, 0x7E, 0x5B, 0x88, 0x98, 0xEE, 0x58, 0x74, 0x34, 0x46, 0xEF, 
+    0xE8, 0x99, 0x3F, 0x7E, 0x6A, 0x71, 0x1B, 0x4F, 0x2C, 0x42, 0x7D, 0xBC, 0xBE, 0x6A, 0x63, 0xE7, 0x4A, 0x63, 0x64, 0x1F, 
+    0x8F, 0xA2, 0xDC, 0x9A, 0x35, 0x83, 0xAB, 0x13, 0xB3, 0x53, 0xBB, 0xEF, 0xB0, 0x11, 0xBF, 0x1E, 0xB7, 0x9D, 0x53, 0xE8, 
+    0x01, 0x5F, 0xF7, 0xD8, 0x5F, 0x30, 0xEE, 0x0C, 0xF8, 0x31, 0xB2, 0xFB, 0xD0, 0xE3, 0xCB, 0x19, 0xDC, 0x0F, 0xDE, 0xCA, 
+    0xC0, 0xA7, 0x73, 0xC1, 0xFD, 0xC6, 0xAF, 0xC1, 0x3C, 0x12, 0xDF, 0xBD, 0x84, 0x03, 0x07, 0xF7, 0x18, 0x67, 0xCD, 0x19, 
+    0xC6, 0xD1, 0x83, 0x64, 0x8C, 0x41, 0x8E, 0x94, 0xB6, 0x2D, 0xEB, 0x7D, 0xDB, 0x6A, 0x09, 0x61, 0x59, 0x25, 0x68, 0xB7, 
+    0xD5, 0xA8, 0x10, 0xEF, 0x64, 0x3A, 0xD8, 0x6C, 0x88, 0x98, 0x2C, 0x34, 0x03, 0x8B, 0xB4, 0xD5, 0x6D, 0x23, 0xD9, 0x28, 
+    0x26, 0xC1, 0xFB, 0xC3, 0x99, 0xF4, 0x87, 0x9D, 0x79, 0xFF, 0xE9, 0x50, 0x72, 0x73, 0xF4, 0xFF, 0x38, 0x90, 0x06, 0x46, 
+    0x92, 0x6D, 0xE6, 0xCE, 0x04, 0x09, 0xEA, 0x24, 0x7A, 0x7D, 0xFC, 0xE5, 0x28, 0x43, 0x6A, 0xED, 0x86, 0x23, 0x9E, 0x2E, 
+    0xB9, 0x87, 0x25, 0x3F, 0xEA, 0x72, 0x90, 0x02, 0x07, 0x65, 0xD2, 0x23, 0x4B, 0x6E, 0x8B, 0x5B, 0xDC, 0x00, 0xDC, 0x22, 
+    0x80, 0x9C, 0x4A, 0x08, 0xB6, 0x3D, 0xF2, 0x34, 0x0C, 0xE1, 0xD7, 0x82, 0xC4, 0xEE, 0xAD, 0xE6, 0x16, 0x0C, 0x03, 0x35, 
+    0xBE, 0x68, 0x65, 0x5B, 0x65, 0xED, 0xC3, 0x39, 0x68, 0x6B, 0x6C, 0xD0, 0x78, 0xF2, 0xD0, 0xBF, 0xCD, 0xB5, 0xCD, 0xD1, 
+    0xCE, 0xE2, 0x9C, 0xFE, 0x56, 0xDC, 0x62, 0x6C, 0x4E, 0x6F, 0xE1, 0x0D, 0x51, 0x14, 0xBD, 0x04, 0xC8, 0x9D, 0x2B, 0x14, 
+    0xF8, 0x07, 0x4D, 0x53, 0x13, 0xE7, 0x10, 0x23, 0xA4, 0x07, 0xD2, 0x3F, 0xEC, 0xAD, 0xBE, 0x1A, 0xA9, 0x9F, 0x56, 0xB6, 
+    0x2F, 0x4C, 0x84, 0x93, 0xC3, 0xEE, 0xEB, 0xD7, 0x57, 0x83, 0xF9, 0x78, 0x35, 0xC0, 0x7B, 0xDA, 0xDF, 0x56, 0x5C, 0x61, 
+    0x2C, 0x43, 0x02, 0x85, 0xEF, 0xF4, 0x94, 0x0A, 0x1F, 0xC6, 0x11, 0x6E, 0x02, 0x8A, 0x8E, 0x8F, 0xCF, 0x93, 0x01, 0x57, 
+    0x1A, 0x35, 0x7F, 0x60, 0x5A, 0xA0, 0xC9, 0xC3, 0x65, 0x6F, 0x12, 0x90, 0x38, 0x36, 0xCB, 0x35, 0xC6, 0xAB, 0x37, 0x3C, 
+    0xBB, 0x74, 0x1F, 0x0D, 0xDB, 0xAF, 0xB9, 0xE6, 0xFD, 0x20, 0x67, 0x6A, 0x0F, 0xF6, 0xA4, 0x79, 0x27, 0x74, 0xF6, 0xFC, 
+    0x41, 0x40, 0x58, 0x6C, 0xCB, 0xF7, 0xC8, 0xE5, 0x05, 0xAE, 0xB8, 0x3B, 0xFA, 0xF8, 0xFD, 0x07, 0xB9, 0xDA, 0x79, 0xB5, 
+    0x0C, 0x84, 0xD8, 0xE0, 0xB8, 0x6B, 0x01, 0x15, 0x54, 0x55, 0x82, 0x3B, 0x6B, 0xB4, 0x6C, 0x06, 0x2B, 0x92, 0xEE, 0x22, 
+    0xA3, 0xFA, 0xEB, 0xEB, 0xFD, 0x65, 0x8C, 0xB7, 0x39, 0x74, 0x85, 0xD7, 0x09, 0x0A, 0x1E, 0xE1, 0x6C, 0xB9, 0xC1, 0xE8, 
+    0x5D, 0xDE, 0xDB, 0x86, 0x41, 0x73, 0xD7, 0x2F, 0x7A, 0x63, 0x12, 0xB9, 0x19, 0x41, 0x90, 0xB1, 0x1B, 0x0A, 0x1C, 0xCF, 
+    0x4F, 0xEC, 0x46, 0x7C, 0x52, 0x2F, 0xC3, 0xA3, 0x87, 0x3B, 0xDB, 0xC2, 0x39, 0x71, 0x9D, 0x5C, 0x24, 0x80, 0x1B, 0x6C, 
+    0xB3, 0x4E, 0x8E, 0x7A, 0x03, 0xD5, 0x58, 0xE0, 0xB0, 0x11, 0x4D, 0x60, 0x9F, 0x29, 0x88, 0x69, 0x42, 0xAA, 0x4C, 0x49, 
+    0x50, 0x05, 0xBC, 0xFB, 0xF9, 0xC3, 0xC5, 0xDB, 0x05, 0x6C, 0x2A, 0xA5, 0x5B, 0x12, 0x85, 0x7A, 0xF8, 0x4B, 0xD8, 0x10, 
+    0xCC, 0x01, 0xC5, 0x5A, 0x7A, 0xA2, 0x83, 0x70, 0x64, 0xC1, 0x1E, 0x6E, 0x28, 0x2D, 0x31, 0x1F, 0x78, 0x31, 0x83, 0xA4, 
+    0x94, 0x20, 0x90, 0xBA, 0x93, 0x91, 0xBD, 0x63, 0xF0, 0x51, 0x87, 0xF1, 0xB5, 0x48, 0x03, 0xD9, 0xFD, 0x05, 0x66, 0x7F, 
+    0x7A, 0xE1, 0xAF, 0x13, 0xF3, 0xFB, 0xFC, 0x5F, 0x6C, 0x85, 0xB8, 0xDA, 0xB7, 0x0F, 0x00, 0x00, 
+};
+
+XEmbeddedContent web_index_html =
+{
+    4023,
+    "text/html",
+    index_html_data,
+    "ad93129199ab1c20",
+    1376,
+    index_html_gzip_data,
+    0,
+    nullptr,
+};
+
+#endif
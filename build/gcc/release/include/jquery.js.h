@@ -0,0 +1,6480 @@
+/*
+ * Auto generated header file to be used with web2cam
+ *
+ * Source file: jquery.js
+ */
+
+#ifndef jquery_js_h
+#define jquery_js_h
+
+#include "XWebServer.hpp"
+
+uint8_t jquery_js_data[]
+{
+    0x2F, 0x2A, 0x21, 0x20, 0x6A, 0x51, 0x75, 0x65, 0x72, 0x79, 0x20, 0x76, 0x31, 0x2E, 0x31, 0x31, 0x2E, 0x31, 0x20, 0x7C, 
+    0x20, 0x28, 0x63, 0x29, 0x20, 0x32, 0x30, 0x30, 0x35, 0x2C, 0x20, 0x32, 0x30, 0x31, 0x34, 0x20, 0x6A, 0x51, 0x75, 0x65, 
+    0x72, 0x79, 0x20, 0x46, 0x6F, 0x75, 0x6E, 0x64, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x20, 0x49, 0x6E, 0x63, 0x2E, 0x20, 
+    0x7C, 0x20, 0x6A, 0x71, 0x75, 0x65, 0x72, 0x79, 0x2E, 0x6F, 0x72, 0x67, 0x2F, 0x6C, 0x69, 0x63, 0x65, 0x6E, 0x73, 0x65, 
+    0x20, 0x2A, 0x2F, 0x0A, 0x21, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x22, 
+    0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x6D, 0x6F, 0x64, 0x75, 
+    0x6C, 0x65, 0x26, 0x26, 0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 
+    0x20, 0x6D, 0x6F, 0x64, 0x75, 0x6C, 0x65, 0x2E, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x3F, 0x6D, 0x6F, 0x64, 0x75, 
+    0x6C, 0x65, 0x2E, 0x65, 0x78, 0x70, 0x6F, 0x72, 0x74, 0x73, 0x3D, 0x61, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 
+    0x74, 0x3F, 0x62, 0x28, 0x61, 0x2C, 0x21, 0x30, 0x29, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x29, 0x7B, 0x69, 0x66, 0x28, 0x21, 0x61, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x29, 0x74, 0x68, 0x72, 
+    0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x6A, 0x51, 0x75, 0x65, 0x72, 0x79, 
+    0x20, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x73, 0x20, 0x61, 0x20, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x20, 0x77, 
+    0x69, 0x74, 0x68, 0x20, 0x61, 0x20, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x22, 0x29, 0x3B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x62, 0x28, 0x61, 0x29, 0x7D, 0x3A, 0x62, 0x28, 0x61, 0x29, 0x7D, 0x28, 0x22, 0x75, 0x6E, 0x64, 
+    0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x77, 0x69, 0x6E, 0x64, 
+    0x6F, 0x77, 0x3F, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x5B, 0x5D, 0x2C, 0x64, 0x3D, 
+    0x63, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x2C, 0x65, 0x3D, 0x63, 0x2E, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x2C, 0x66, 
+    0x3D, 0x63, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x2C, 0x67, 0x3D, 0x63, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x2C, 
+    0x68, 0x3D, 0x7B, 0x7D, 0x2C, 0x69, 0x3D, 0x68, 0x2E, 0x74, 0x6F, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2C, 0x6A, 0x3D, 
+    0x68, 0x2E, 0x68, 0x61, 0x73, 0x4F, 0x77, 0x6E, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x2C, 0x6B, 0x3D, 0x7B, 
+    0x7D, 0x2C, 0x6C, 0x3D, 0x22, 0x31, 0x2E, 0x31, 0x31, 0x2E, 0x31, 0x22, 0x2C, 0x6D, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x65, 0x77, 0x20, 
+    0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x69, 0x6E, 0x69, 0x74, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7D, 0x2C, 0x6E, 0x3D, 0x2F, 0x5E, 
+    0x5B, 0x5C, 0x73, 0x5C, 0x75, 0x46, 0x45, 0x46, 0x46, 0x5C, 0x78, 0x41, 0x30, 0x5D, 0x2B, 0x7C, 0x5B, 0x5C, 0x73, 0x5C, 
+    0x75, 0x46, 0x45, 0x46, 0x46, 0x5C, 0x78, 0x41, 0x30, 0x5D, 0x2B, 0x24, 0x2F, 0x67, 0x2C, 0x6F, 0x3D, 0x2F, 0x5E, 0x2D, 
+    0x6D, 0x73, 0x2D, 0x2F, 0x2C, 0x70, 0x3D, 0x2F, 0x2D, 0x28, 0x5B, 0x5C, 0x64, 0x61, 0x2D, 0x7A, 0x5D, 0x29, 0x2F, 0x67, 
+    0x69, 0x2C, 0x71, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x2E, 0x74, 0x6F, 0x55, 0x70, 0x70, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 
+    0x7D, 0x3B, 0x6D, 0x2E, 0x66, 0x6E, 0x3D, 0x6D, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x7B, 
+    0x6A, 0x71, 0x75, 0x65, 0x72, 0x79, 0x3A, 0x6C, 0x2C, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 
+    0x3A, 0x6D, 0x2C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x3A, 0x22, 0x22, 0x2C, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x3A, 0x30, 0x2C, 0x74, 0x6F, 0x41, 0x72, 0x72, 0x61, 0x79, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 0x69, 
+    0x73, 0x29, 0x7D, 0x2C, 0x67, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x61, 0x3F, 0x30, 0x3E, 0x61, 0x3F, 0x74, 
+    0x68, 0x69, 0x73, 0x5B, 0x61, 0x2B, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x5D, 0x3A, 0x74, 
+    0x68, 0x69, 0x73, 0x5B, 0x61, 0x5D, 0x3A, 0x64, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x7D, 
+    0x2C, 0x70, 0x75, 0x73, 0x68, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x6D, 0x2E, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x28, 0x74, 0x68, 0x69, 
+    0x73, 0x2E, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x28, 0x29, 0x2C, 0x61, 0x29, 0x3B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x3D, 0x74, 
+    0x68, 0x69, 0x73, 0x2C, 0x62, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 
+    0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x2C, 0x62, 0x7D, 0x2C, 0x65, 0x61, 0x63, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x65, 0x61, 
+    0x63, 0x68, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x2C, 0x62, 0x29, 0x7D, 0x2C, 0x6D, 0x61, 0x70, 0x3A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 
+    0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x28, 0x6D, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x74, 0x68, 
+    0x69, 0x73, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x62, 0x2C, 0x63, 0x2C, 0x62, 0x29, 0x7D, 0x29, 0x29, 
+    0x7D, 0x2C, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x53, 0x74, 0x61, 0x63, 0x6B, 
+    0x28, 0x64, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 
+    0x6E, 0x74, 0x73, 0x29, 0x29, 0x7D, 0x2C, 0x66, 0x69, 0x72, 0x73, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x71, 0x28, 0x30, 
+    0x29, 0x7D, 0x2C, 0x6C, 0x61, 0x73, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x71, 0x28, 0x2D, 0x31, 0x29, 0x7D, 0x2C, 0x65, 
+    0x71, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 
+    0x74, 0x68, 0x69, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x63, 0x3D, 0x2B, 0x61, 0x2B, 0x28, 0x30, 0x3E, 
+    0x61, 0x3F, 0x62, 0x3A, 0x30, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 
+    0x75, 0x73, 0x68, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x28, 0x63, 0x3E, 0x3D, 0x30, 0x26, 0x26, 0x62, 0x3E, 0x63, 0x3F, 0x5B, 
+    0x74, 0x68, 0x69, 0x73, 0x5B, 0x63, 0x5D, 0x5D, 0x3A, 0x5B, 0x5D, 0x29, 0x7D, 0x2C, 0x65, 0x6E, 0x64, 0x3A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x70, 0x72, 0x65, 0x76, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x7C, 0x7C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x6F, 
+    0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x7D, 0x2C, 0x70, 0x75, 0x73, 
+    0x68, 0x3A, 0x66, 0x2C, 0x73, 0x6F, 0x72, 0x74, 0x3A, 0x63, 0x2E, 0x73, 0x6F, 0x72, 0x74, 0x2C, 0x73, 0x70, 0x6C, 0x69, 
+    0x63, 0x65, 0x3A, 0x63, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x63, 0x65, 0x7D, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 
+    0x64, 0x3D, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 0x66, 
+    0x2C, 0x67, 0x3D, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x5B, 0x30, 0x5D, 0x7C, 0x7C, 0x7B, 0x7D, 0x2C, 
+    0x68, 0x3D, 0x31, 0x2C, 0x69, 0x3D, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 
+    0x74, 0x68, 0x2C, 0x6A, 0x3D, 0x21, 0x31, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x22, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 
+    0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x67, 0x26, 0x26, 0x28, 0x6A, 0x3D, 0x67, 0x2C, 0x67, 0x3D, 
+    0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x5B, 0x68, 0x5D, 0x7C, 0x7C, 0x7B, 0x7D, 0x2C, 0x68, 0x2B, 0x2B, 
+    0x29, 0x2C, 0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x67, 
+    0x7C, 0x7C, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x67, 0x29, 0x7C, 0x7C, 0x28, 
+    0x67, 0x3D, 0x7B, 0x7D, 0x29, 0x2C, 0x68, 0x3D, 0x3D, 0x3D, 0x69, 0x26, 0x26, 0x28, 0x67, 0x3D, 0x74, 0x68, 0x69, 0x73, 
+    0x2C, 0x68, 0x2D, 0x2D, 0x29, 0x3B, 0x69, 0x3E, 0x68, 0x3B, 0x68, 0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x6E, 0x75, 0x6C, 
+    0x6C, 0x21, 0x3D, 0x28, 0x65, 0x3D, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x5B, 0x68, 0x5D, 0x29, 0x29, 
+    0x66, 0x6F, 0x72, 0x28, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x65, 0x29, 0x61, 0x3D, 0x67, 0x5B, 0x64, 0x5D, 0x2C, 0x63, 0x3D, 
+    0x65, 0x5B, 0x64, 0x5D, 0x2C, 0x67, 0x21, 0x3D, 0x3D, 0x63, 0x26, 0x26, 0x28, 0x6A, 0x26, 0x26, 0x63, 0x26, 0x26, 0x28, 
+    0x6D, 0x2E, 0x69, 0x73, 0x50, 0x6C, 0x61, 0x69, 0x6E, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x63, 0x29, 0x7C, 0x7C, 
+    0x28, 0x62, 0x3D, 0x6D, 0x2E, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x63, 0x29, 0x29, 0x29, 0x3F, 0x28, 0x62, 
+    0x3F, 0x28, 0x62, 0x3D, 0x21, 0x31, 0x2C, 0x66, 0x3D, 0x61, 0x26, 0x26, 0x6D, 0x2E, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 
+    0x79, 0x28, 0x61, 0x29, 0x3F, 0x61, 0x3A, 0x5B, 0x5D, 0x29, 0x3A, 0x66, 0x3D, 0x61, 0x26, 0x26, 0x6D, 0x2E, 0x69, 0x73, 
+    0x50, 0x6C, 0x61, 0x69, 0x6E, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x61, 0x29, 0x3F, 0x61, 0x3A, 0x7B, 0x7D, 0x2C, 
+    0x67, 0x5B, 0x64, 0x5D, 0x3D, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x6A, 0x2C, 0x66, 0x2C, 0x63, 0x29, 
+    0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x63, 0x26, 0x26, 0x28, 0x67, 0x5B, 0x64, 0x5D, 0x3D, 
+    0x63, 0x29, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x67, 0x7D, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 
+    0x6E, 0x64, 0x28, 0x7B, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x3A, 0x22, 0x6A, 0x51, 0x75, 0x65, 0x72, 0x79, 0x22, 
+    0x2B, 0x28, 0x6C, 0x2B, 0x4D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 0x29, 0x2E, 0x72, 
+    0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x2F, 0x5C, 0x44, 0x2F, 0x67, 0x2C, 0x22, 0x22, 0x29, 0x2C, 0x69, 0x73, 0x52, 
+    0x65, 0x61, 0x64, 0x79, 0x3A, 0x21, 0x30, 0x2C, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6F, 
+    0x72, 0x28, 0x61, 0x29, 0x7D, 0x2C, 0x6E, 0x6F, 0x6F, 0x70, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x29, 0x7B, 0x7D, 0x2C, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x6D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x28, 0x61, 0x29, 0x7D, 0x2C, 0x69, 0x73, 0x41, 
+    0x72, 0x72, 0x61, 0x79, 0x3A, 0x41, 0x72, 0x72, 0x61, 0x79, 0x2E, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x7C, 0x7C, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x61, 
+    0x72, 0x72, 0x61, 0x79, 0x22, 0x3D, 0x3D, 0x3D, 0x6D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x28, 0x61, 0x29, 0x7D, 0x2C, 0x69, 
+    0x73, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x61, 0x26, 0x26, 0x61, 0x3D, 0x3D, 0x61, 
+    0x2E, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x7D, 0x2C, 0x69, 0x73, 0x4E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x3A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x6D, 0x2E, 
+    0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x61, 0x29, 0x26, 0x26, 0x61, 0x2D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 
+    0x6C, 0x6F, 0x61, 0x74, 0x28, 0x61, 0x29, 0x3E, 0x3D, 0x30, 0x7D, 0x2C, 0x69, 0x73, 0x45, 0x6D, 0x70, 0x74, 0x79, 0x4F, 
+    0x62, 0x6A, 0x65, 0x63, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x62, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x62, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x21, 0x31, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x30, 0x7D, 0x2C, 0x69, 0x73, 0x50, 0x6C, 0x61, 0x69, 
+    0x6E, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 
+    0x76, 0x61, 0x72, 0x20, 0x62, 0x3B, 0x69, 0x66, 0x28, 0x21, 0x61, 0x7C, 0x7C, 0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x22, 0x21, 0x3D, 0x3D, 0x6D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x28, 0x61, 0x29, 0x7C, 0x7C, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x6D, 0x2E, 0x69, 0x73, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x28, 0x61, 0x29, 
+    0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x31, 0x3B, 0x74, 0x72, 0x79, 0x7B, 0x69, 0x66, 0x28, 0x61, 0x2E, 0x63, 
+    0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x26, 0x26, 0x21, 0x6A, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 
+    0x61, 0x2C, 0x22, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x22, 0x29, 0x26, 0x26, 0x21, 0x6A, 
+    0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2E, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x2E, 
+    0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x2C, 0x22, 0x69, 0x73, 0x50, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 
+    0x70, 0x65, 0x4F, 0x66, 0x22, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x31, 0x7D, 0x63, 0x61, 0x74, 0x63, 
+    0x68, 0x28, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x31, 0x7D, 0x69, 0x66, 0x28, 0x6B, 0x2E, 0x6F, 
+    0x77, 0x6E, 0x4C, 0x61, 0x73, 0x74, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x62, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x29, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x6A, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x3B, 0x66, 0x6F, 0x72, 
+    0x28, 0x62, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x6F, 0x69, 0x64, 
+    0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x62, 0x7C, 0x7C, 0x6A, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7D, 
+    0x2C, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x61, 0x3F, 0x61, 0x2B, 0x22, 0x22, 0x3A, 0x22, 0x6F, 
+    0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x7C, 0x7C, 0x22, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x3F, 0x68, 
+    0x5B, 0x69, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x29, 0x5D, 0x7C, 0x7C, 0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x22, 0x3A, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x7D, 0x2C, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x45, 0x76, 
+    0x61, 0x6C, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x62, 0x26, 0x26, 0x6D, 0x2E, 
+    0x74, 0x72, 0x69, 0x6D, 0x28, 0x62, 0x29, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x53, 0x63, 0x72, 0x69, 
+    0x70, 0x74, 0x7C, 0x7C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x61, 0x2E, 0x65, 0x76, 
+    0x61, 0x6C, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7D, 0x29, 0x28, 0x62, 0x29, 0x7D, 0x2C, 0x63, 
+    0x61, 0x6D, 0x65, 0x6C, 0x43, 0x61, 0x73, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 
+    0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x6F, 0x2C, 
+    0x22, 0x6D, 0x73, 0x2D, 0x22, 0x29, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x70, 0x2C, 0x71, 0x29, 0x7D, 
+    0x2C, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 
+    0x65, 0x26, 0x26, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 
+    0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 
+    0x61, 0x73, 0x65, 0x28, 0x29, 0x7D, 0x2C, 0x65, 0x61, 0x63, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x3D, 0x30, 0x2C, 0x66, 0x3D, 
+    0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x67, 0x3D, 0x72, 0x28, 0x61, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x63, 
+    0x29, 0x7B, 0x69, 0x66, 0x28, 0x67, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x3B, 0x66, 0x3E, 0x65, 0x3B, 0x65, 0x2B, 0x2B, 
+    0x29, 0x69, 0x66, 0x28, 0x64, 0x3D, 0x62, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x61, 0x5B, 0x65, 0x5D, 0x2C, 0x63, 
+    0x29, 0x2C, 0x64, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x29, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x7D, 0x65, 0x6C, 0x73, 0x65, 0x20, 
+    0x66, 0x6F, 0x72, 0x28, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x29, 0x69, 0x66, 0x28, 0x64, 0x3D, 0x62, 0x2E, 0x61, 0x70, 
+    0x70, 0x6C, 0x79, 0x28, 0x61, 0x5B, 0x65, 0x5D, 0x2C, 0x63, 0x29, 0x2C, 0x64, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x29, 0x62, 
+    0x72, 0x65, 0x61, 0x6B, 0x7D, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x28, 0x67, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 
+    0x3B, 0x66, 0x3E, 0x65, 0x3B, 0x65, 0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x64, 0x3D, 0x62, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 
+    0x28, 0x61, 0x5B, 0x65, 0x5D, 0x2C, 0x65, 0x2C, 0x61, 0x5B, 0x65, 0x5D, 0x29, 0x2C, 0x64, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 
+    0x29, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x7D, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x28, 0x65, 0x20, 0x69, 0x6E, 
+    0x20, 0x61, 0x29, 0x69, 0x66, 0x28, 0x64, 0x3D, 0x62, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x5B, 0x65, 0x5D, 0x2C, 
+    0x65, 0x2C, 0x61, 0x5B, 0x65, 0x5D, 0x29, 0x2C, 0x64, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x29, 0x62, 0x72, 0x65, 0x61, 0x6B, 
+    0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x7D, 0x2C, 0x74, 0x72, 0x69, 0x6D, 0x3A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 
+    0x3D, 0x61, 0x3F, 0x22, 0x22, 0x3A, 0x28, 0x61, 0x2B, 0x22, 0x22, 0x29, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 
+    0x28, 0x6E, 0x2C, 0x22, 0x22, 0x29, 0x7D, 0x2C, 0x6D, 0x61, 0x6B, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x3A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x62, 0x7C, 
+    0x7C, 0x5B, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x61, 0x26, 0x26, 
+    0x28, 0x72, 0x28, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x61, 0x29, 0x29, 0x3F, 0x6D, 0x2E, 0x6D, 0x65, 0x72, 0x67, 
+    0x65, 0x28, 0x63, 0x2C, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 
+    0x20, 0x61, 0x3F, 0x5B, 0x61, 0x5D, 0x3A, 0x61, 0x29, 0x3A, 0x66, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x63, 0x2C, 0x61, 
+    0x29, 0x29, 0x2C, 0x63, 0x7D, 0x2C, 0x69, 0x6E, 0x41, 0x72, 0x72, 0x61, 0x79, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3B, 0x69, 0x66, 0x28, 0x62, 
+    0x29, 0x7B, 0x69, 0x66, 0x28, 0x67, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x67, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 
+    0x28, 0x62, 0x2C, 0x61, 0x2C, 0x63, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x64, 0x3D, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 
+    0x74, 0x68, 0x2C, 0x63, 0x3D, 0x63, 0x3F, 0x30, 0x3E, 0x63, 0x3F, 0x4D, 0x61, 0x74, 0x68, 0x2E, 0x6D, 0x61, 0x78, 0x28, 
+    0x30, 0x2C, 0x64, 0x2B, 0x63, 0x29, 0x3A, 0x63, 0x3A, 0x30, 0x3B, 0x64, 0x3E, 0x63, 0x3B, 0x63, 0x2B, 0x2B, 0x29, 0x69, 
+    0x66, 0x28, 0x63, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x26, 0x26, 0x62, 0x5B, 0x63, 0x5D, 0x3D, 0x3D, 0x3D, 0x61, 0x29, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x2D, 0x31, 0x7D, 0x2C, 0x6D, 0x65, 
+    0x72, 0x67, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x63, 0x3D, 0x2B, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x64, 0x3D, 0x30, 0x2C, 0x65, 0x3D, 
+    0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x63, 0x3E, 0x64, 0x29, 0x61, 
+    0x5B, 0x65, 0x2B, 0x2B, 0x5D, 0x3D, 0x62, 0x5B, 0x64, 0x2B, 0x2B, 0x5D, 0x3B, 0x69, 0x66, 0x28, 0x63, 0x21, 0x3D, 0x3D, 
+    0x63, 0x29, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x62, 0x5B, 0x64, 
+    0x5D, 0x29, 0x61, 0x5B, 0x65, 0x2B, 0x2B, 0x5D, 0x3D, 0x62, 0x5B, 0x64, 0x2B, 0x2B, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3D, 0x65, 0x2C, 0x61, 0x7D, 0x2C, 0x67, 0x72, 0x65, 
+    0x70, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x66, 0x6F, 
+    0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x3D, 0x5B, 0x5D, 0x2C, 0x66, 0x3D, 0x30, 0x2C, 0x67, 0x3D, 0x61, 
+    0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x68, 0x3D, 0x21, 0x63, 0x3B, 0x67, 0x3E, 0x66, 0x3B, 0x66, 0x2B, 0x2B, 
+    0x29, 0x64, 0x3D, 0x21, 0x62, 0x28, 0x61, 0x5B, 0x66, 0x5D, 0x2C, 0x66, 0x29, 0x2C, 0x64, 0x21, 0x3D, 0x3D, 0x68, 0x26, 
+    0x26, 0x65, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x61, 0x5B, 0x66, 0x5D, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x65, 0x7D, 0x2C, 0x6D, 0x61, 0x70, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 
+    0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x66, 0x3D, 0x30, 0x2C, 0x67, 0x3D, 0x61, 0x2E, 0x6C, 0x65, 
+    0x6E, 0x67, 0x74, 0x68, 0x2C, 0x68, 0x3D, 0x72, 0x28, 0x61, 0x29, 0x2C, 0x69, 0x3D, 0x5B, 0x5D, 0x3B, 0x69, 0x66, 0x28, 
+    0x68, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x3B, 0x67, 0x3E, 0x66, 0x3B, 0x66, 0x2B, 0x2B, 0x29, 0x64, 0x3D, 0x62, 0x28, 0x61, 
+    0x5B, 0x66, 0x5D, 0x2C, 0x66, 0x2C, 0x63, 0x29, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x64, 0x26, 0x26, 0x69, 0x2E, 
+    0x70, 0x75, 0x73, 0x68, 0x28, 0x64, 0x29, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x28, 0x66, 0x20, 0x69, 
+    0x6E, 0x20, 0x61, 0x29, 0x64, 0x3D, 0x62, 0x28, 0x61, 0x5B, 0x66, 0x5D, 0x2C, 0x66, 0x2C, 0x63, 0x29, 0x2C, 0x6E, 0x75, 
+    0x6C, 0x6C, 0x21, 0x3D, 0x64, 0x26, 0x26, 0x69, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x64, 0x29, 0x3B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x65, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x5B, 0x5D, 0x2C, 0x69, 0x29, 0x7D, 0x2C, 0x67, 
+    0x75, 0x69, 0x64, 0x3A, 0x31, 0x2C, 0x70, 0x72, 0x6F, 0x78, 0x79, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x65, 0x2C, 0x66, 0x3B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 
+    0x26, 0x26, 0x28, 0x66, 0x3D, 0x61, 0x5B, 0x62, 0x5D, 0x2C, 0x62, 0x3D, 0x61, 0x2C, 0x61, 0x3D, 0x66, 0x29, 0x2C, 0x6D, 
+    0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x3F, 0x28, 0x63, 0x3D, 0x64, 0x2E, 
+    0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 0x32, 0x29, 0x2C, 0x65, 0x3D, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 
+    0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x62, 0x7C, 0x7C, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x63, 0x2E, 0x63, 0x6F, 0x6E, 0x63, 
+    0x61, 0x74, 0x28, 0x64, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x29, 
+    0x29, 0x29, 0x7D, 0x2C, 0x65, 0x2E, 0x67, 0x75, 0x69, 0x64, 0x3D, 0x61, 0x2E, 0x67, 0x75, 0x69, 0x64, 0x3D, 0x61, 0x2E, 
+    0x67, 0x75, 0x69, 0x64, 0x7C, 0x7C, 0x6D, 0x2E, 0x67, 0x75, 0x69, 0x64, 0x2B, 0x2B, 0x2C, 0x65, 0x29, 0x3A, 0x76, 0x6F, 
+    0x69, 0x64, 0x20, 0x30, 0x7D, 0x2C, 0x6E, 0x6F, 0x77, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 
+    0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x2B, 0x6E, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x65, 0x7D, 0x2C, 0x73, 0x75, 
+    0x70, 0x70, 0x6F, 0x72, 0x74, 0x3A, 0x6B, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x22, 0x42, 0x6F, 
+    0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x20, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x20, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x20, 
+    0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 0x20, 0x44, 0x61, 0x74, 0x65, 0x20, 
+    0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x20, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x22, 
+    0x2E, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x28, 0x22, 0x20, 0x22, 0x29, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x68, 0x5B, 0x22, 0x5B, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x22, 0x2B, 0x62, 
+    0x2B, 0x22, 0x5D, 0x22, 0x5D, 0x3D, 0x62, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 
+    0x29, 0x7D, 0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x62, 0x3D, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x63, 0x3D, 0x6D, 0x2E, 0x74, 0x79, 0x70, 
+    0x65, 0x28, 0x61, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x7C, 0x7C, 0x6D, 0x2E, 0x69, 0x73, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x28, 0x61, 0x29, 
+    0x3F, 0x21, 0x31, 0x3A, 0x31, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 
+    0x62, 0x3F, 0x21, 0x30, 0x3A, 0x22, 0x61, 0x72, 0x72, 0x61, 0x79, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x7C, 0x7C, 0x30, 0x3D, 
+    0x3D, 0x3D, 0x62, 0x7C, 0x7C, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 
+    0x66, 0x20, 0x62, 0x26, 0x26, 0x62, 0x3E, 0x30, 0x26, 0x26, 0x62, 0x2D, 0x31, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x7D, 0x76, 
+    0x61, 0x72, 0x20, 0x73, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 
+    0x20, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x2C, 0x69, 0x2C, 0x6A, 0x2C, 0x6B, 
+    0x2C, 0x6C, 0x2C, 0x6D, 0x2C, 0x6E, 0x2C, 0x6F, 0x2C, 0x70, 0x2C, 0x71, 0x2C, 0x72, 0x2C, 0x73, 0x2C, 0x74, 0x2C, 0x75, 
+    0x3D, 0x22, 0x73, 0x69, 0x7A, 0x7A, 0x6C, 0x65, 0x22, 0x2B, 0x2D, 0x6E, 0x65, 0x77, 0x20, 0x44, 0x61, 0x74, 0x65, 0x2C, 
+    0x76, 0x3D, 0x61, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x77, 0x3D, 0x30, 0x2C, 0x78, 0x3D, 0x30, 
+    0x2C, 0x79, 0x3D, 0x67, 0x62, 0x28, 0x29, 0x2C, 0x7A, 0x3D, 0x67, 0x62, 0x28, 0x29, 0x2C, 0x41, 0x3D, 0x67, 0x62, 0x28, 
+    0x29, 0x2C, 0x42, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3D, 0x3D, 0x3D, 0x62, 0x26, 0x26, 0x28, 0x6C, 0x3D, 0x21, 0x30, 0x29, 0x2C, 0x30, 
+    0x7D, 0x2C, 0x43, 0x3D, 0x22, 0x75, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x22, 0x2C, 0x44, 0x3D, 0x31, 0x3C, 
+    0x3C, 0x33, 0x31, 0x2C, 0x45, 0x3D, 0x7B, 0x7D, 0x2E, 0x68, 0x61, 0x73, 0x4F, 0x77, 0x6E, 0x50, 0x72, 0x6F, 0x70, 0x65, 
+    0x72, 0x74, 0x79, 0x2C, 0x46, 0x3D, 0x5B, 0x5D, 0x2C, 0x47, 0x3D, 0x46, 0x2E, 0x70, 0x6F, 0x70, 0x2C, 0x48, 0x3D, 0x46, 
+    0x2E, 0x70, 0x75, 0x73, 0x68, 0x2C, 0x49, 0x3D, 0x46, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x2C, 0x4A, 0x3D, 0x46, 0x2E, 0x73, 
+    0x6C, 0x69, 0x63, 0x65, 0x2C, 0x4B, 0x3D, 0x46, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x7C, 0x7C, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 
+    0x30, 0x2C, 0x63, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x63, 0x3E, 0x62, 0x3B, 
+    0x62, 0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x62, 0x5D, 0x3D, 0x3D, 0x3D, 0x61, 0x29, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x2D, 0x31, 0x7D, 0x2C, 0x4C, 0x3D, 
+    0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x7C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x7C, 0x61, 0x73, 
+    0x79, 0x6E, 0x63, 0x7C, 0x61, 0x75, 0x74, 0x6F, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x7C, 0x61, 0x75, 0x74, 0x6F, 0x70, 0x6C, 
+    0x61, 0x79, 0x7C, 0x63, 0x6F, 0x6E, 0x74, 0x72, 0x6F, 0x6C, 0x73, 0x7C, 0x64, 0x65, 0x66, 0x65, 0x72, 0x7C, 0x64, 0x69, 
+    0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x7C, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x7C, 0x69, 0x73, 0x6D, 0x61, 0x70, 0x7C, 
+    0x6C, 0x6F, 0x6F, 0x70, 0x7C, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x7C, 0x6F, 0x70, 0x65, 0x6E, 0x7C, 0x72, 
+    0x65, 0x61, 0x64, 0x6F, 0x6E, 0x6C, 0x79, 0x7C, 0x72, 0x65, 0x71, 0x75, 0x69, 0x72, 0x65, 0x64, 0x7C, 0x73, 0x63, 0x6F, 
+    0x70, 0x65, 0x64, 0x22, 0x2C, 0x4D, 0x3D, 0x22, 0x5B, 0x5C, 0x5C, 0x78, 0x32, 0x30, 0x5C, 0x5C, 0x74, 0x5C, 0x5C, 0x72, 
+    0x5C, 0x5C, 0x6E, 0x5C, 0x5C, 0x66, 0x5D, 0x22, 0x2C, 0x4E, 0x3D, 0x22, 0x28, 0x3F, 0x3A, 0x5C, 0x5C, 0x5C, 0x5C, 0x2E, 
+    0x7C, 0x5B, 0x5C, 0x5C, 0x77, 0x2D, 0x5D, 0x7C, 0x5B, 0x5E, 0x5C, 0x5C, 0x78, 0x30, 0x30, 0x2D, 0x5C, 0x5C, 0x78, 0x61, 
+    0x30, 0x5D, 0x29, 0x2B, 0x22, 0x2C, 0x4F, 0x3D, 0x4E, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x22, 0x77, 
+    0x22, 0x2C, 0x22, 0x77, 0x23, 0x22, 0x29, 0x2C, 0x50, 0x3D, 0x22, 0x5C, 0x5C, 0x5B, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 
+    0x28, 0x22, 0x2B, 0x4E, 0x2B, 0x22, 0x29, 0x28, 0x3F, 0x3A, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x28, 0x5B, 0x2A, 0x5E, 
+    0x24, 0x7C, 0x21, 0x7E, 0x5D, 0x3F, 0x3D, 0x29, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x28, 0x3F, 0x3A, 0x27, 0x28, 0x28, 
+    0x3F, 0x3A, 0x5C, 0x5C, 0x5C, 0x5C, 0x2E, 0x7C, 0x5B, 0x5E, 0x5C, 0x5C, 0x5C, 0x5C, 0x27, 0x5D, 0x29, 0x2A, 0x29, 0x27, 
+    0x7C, 0x5C, 0x22, 0x28, 0x28, 0x3F, 0x3A, 0x5C, 0x5C, 0x5C, 0x5C, 0x2E, 0x7C, 0x5B, 0x5E, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 
+    0x22, 0x5D, 0x29, 0x2A, 0x29, 0x5C, 0x22, 0x7C, 0x28, 0x22, 0x2B, 0x4F, 0x2B, 0x22, 0x29, 0x29, 0x7C, 0x29, 0x22, 0x2B, 
+    0x4D, 0x2B, 0x22, 0x2A, 0x5C, 0x5C, 0x5D, 0x22, 0x2C, 0x51, 0x3D, 0x22, 0x3A, 0x28, 0x22, 0x2B, 0x4E, 0x2B, 0x22, 0x29, 
+    0x28, 0x3F, 0x3A, 0x5C, 0x5C, 0x28, 0x28, 0x28, 0x27, 0x28, 0x28, 0x3F, 0x3A, 0x5C, 0x5C, 0x5C, 0x5C, 0x2E, 0x7C, 0x5B, 
+    0x5E, 0x5C, 0x5C, 0x5C, 0x5C, 0x27, 0x5D, 0x29, 0x2A, 0x29, 0x27, 0x7C, 0x5C, 0x22, 0x28, 0x28, 0x3F, 0x3A, 0x5C, 0x5C, 
+    0x5C, 0x5C, 0x2E, 0x7C, 0x5B, 0x5E, 0x5C, 0x5C, 0x5C, 0x5C, 0x5C, 0x22, 0x5D, 0x29, 0x2A, 0x29, 0x5C, 0x22, 0x29, 0x7C, 
+    0x28, 0x28, 0x3F, 0x3A, 0x5C, 0x5C, 0x5C, 0x5C, 0x2E, 0x7C, 0x5B, 0x5E, 0x5C, 0x5C, 0x5C, 0x5C, 0x28, 0x29, 0x5B, 0x5C, 
+    0x5C, 0x5D, 0x5D, 0x7C, 0x22, 0x2B, 0x50, 0x2B, 0x22, 0x29, 0x2A, 0x29, 0x7C, 0x2E, 0x2A, 0x29, 0x5C, 0x5C, 0x29, 0x7C, 
+    0x29, 0x22, 0x2C, 0x52, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x22, 0x2B, 
+    0x4D, 0x2B, 0x22, 0x2B, 0x7C, 0x28, 0x28, 0x3F, 0x3A, 0x5E, 0x7C, 0x5B, 0x5E, 0x5C, 0x5C, 0x5C, 0x5C, 0x5D, 0x29, 0x28, 
+    0x3F, 0x3A, 0x5C, 0x5C, 0x5C, 0x5C, 0x2E, 0x29, 0x2A, 0x29, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2B, 0x24, 0x22, 0x2C, 0x22, 
+    0x67, 0x22, 0x29, 0x2C, 0x53, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x22, 
+    0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x2C, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x22, 0x29, 0x2C, 0x54, 0x3D, 0x6E, 0x65, 0x77, 
+    0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x28, 0x5B, 0x3E, 0x2B, 
+    0x7E, 0x5D, 0x7C, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x29, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x22, 0x29, 0x2C, 0x55, 0x3D, 
+    0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x3D, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x28, 
+    0x5B, 0x5E, 0x5C, 0x5C, 0x5D, 0x27, 0x5C, 0x22, 0x5D, 0x2A, 0x3F, 0x29, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x5C, 0x5C, 
+    0x5D, 0x22, 0x2C, 0x22, 0x67, 0x22, 0x29, 0x2C, 0x56, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 
+    0x28, 0x51, 0x29, 0x2C, 0x57, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x22, 
+    0x2B, 0x4F, 0x2B, 0x22, 0x24, 0x22, 0x29, 0x2C, 0x58, 0x3D, 0x7B, 0x49, 0x44, 0x3A, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 
+    0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x23, 0x28, 0x22, 0x2B, 0x4E, 0x2B, 0x22, 0x29, 0x22, 0x29, 0x2C, 0x43, 0x4C, 
+    0x41, 0x53, 0x53, 0x3A, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x5C, 0x5C, 0x2E, 
+    0x28, 0x22, 0x2B, 0x4E, 0x2B, 0x22, 0x29, 0x22, 0x29, 0x2C, 0x54, 0x41, 0x47, 0x3A, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 
+    0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x28, 0x22, 0x2B, 0x4E, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 
+    0x22, 0x77, 0x22, 0x2C, 0x22, 0x77, 0x2A, 0x22, 0x29, 0x2B, 0x22, 0x29, 0x22, 0x29, 0x2C, 0x41, 0x54, 0x54, 0x52, 0x3A, 
+    0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x22, 0x2B, 0x50, 0x29, 0x2C, 0x50, 0x53, 
+    0x45, 0x55, 0x44, 0x4F, 0x3A, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x22, 0x2B, 
+    0x51, 0x29, 0x2C, 0x43, 0x48, 0x49, 0x4C, 0x44, 0x3A, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 
+    0x22, 0x5E, 0x3A, 0x28, 0x6F, 0x6E, 0x6C, 0x79, 0x7C, 0x66, 0x69, 0x72, 0x73, 0x74, 0x7C, 0x6C, 0x61, 0x73, 0x74, 0x7C, 
+    0x6E, 0x74, 0x68, 0x7C, 0x6E, 0x74, 0x68, 0x2D, 0x6C, 0x61, 0x73, 0x74, 0x29, 0x2D, 0x28, 0x63, 0x68, 0x69, 0x6C, 0x64, 
+    0x7C, 0x6F, 0x66, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x29, 0x28, 0x3F, 0x3A, 0x5C, 0x5C, 0x28, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 
+    0x2A, 0x28, 0x65, 0x76, 0x65, 0x6E, 0x7C, 0x6F, 0x64, 0x64, 0x7C, 0x28, 0x28, 0x5B, 0x2B, 0x2D, 0x5D, 0x7C, 0x29, 0x28, 
+    0x5C, 0x5C, 0x64, 0x2A, 0x29, 0x6E, 0x7C, 0x29, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x28, 0x3F, 0x3A, 0x28, 0x5B, 0x2B, 
+    0x2D, 0x5D, 0x7C, 0x29, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x28, 0x5C, 0x5C, 0x64, 0x2B, 0x29, 0x7C, 0x29, 0x29, 0x22, 
+    0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x5C, 0x5C, 0x29, 0x7C, 0x29, 0x22, 0x2C, 0x22, 0x69, 0x22, 0x29, 0x2C, 0x62, 0x6F, 0x6F, 
+    0x6C, 0x3A, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x28, 0x3F, 0x3A, 0x22, 0x2B, 
+    0x4C, 0x2B, 0x22, 0x29, 0x24, 0x22, 0x2C, 0x22, 0x69, 0x22, 0x29, 0x2C, 0x6E, 0x65, 0x65, 0x64, 0x73, 0x43, 0x6F, 0x6E, 
+    0x74, 0x65, 0x78, 0x74, 0x3A, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x22, 0x2B, 
+    0x4D, 0x2B, 0x22, 0x2A, 0x5B, 0x3E, 0x2B, 0x7E, 0x5D, 0x7C, 0x3A, 0x28, 0x65, 0x76, 0x65, 0x6E, 0x7C, 0x6F, 0x64, 0x64, 
+    0x7C, 0x65, 0x71, 0x7C, 0x67, 0x74, 0x7C, 0x6C, 0x74, 0x7C, 0x6E, 0x74, 0x68, 0x7C, 0x66, 0x69, 0x72, 0x73, 0x74, 0x7C, 
+    0x6C, 0x61, 0x73, 0x74, 0x29, 0x28, 0x3F, 0x3A, 0x5C, 0x5C, 0x28, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x28, 0x28, 0x3F, 
+    0x3A, 0x2D, 0x5C, 0x5C, 0x64, 0x29, 0x3F, 0x5C, 0x5C, 0x64, 0x2A, 0x29, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x5C, 0x5C, 
+    0x29, 0x7C, 0x29, 0x28, 0x3F, 0x3D, 0x5B, 0x5E, 0x2D, 0x5D, 0x7C, 0x24, 0x29, 0x22, 0x2C, 0x22, 0x69, 0x22, 0x29, 0x7D, 
+    0x2C, 0x59, 0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x7C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 
+    0x7C, 0x74, 0x65, 0x78, 0x74, 0x61, 0x72, 0x65, 0x61, 0x7C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x29, 0x24, 0x2F, 0x69, 
+    0x2C, 0x5A, 0x3D, 0x2F, 0x5E, 0x68, 0x5C, 0x64, 0x24, 0x2F, 0x69, 0x2C, 0x24, 0x3D, 0x2F, 0x5E, 0x5B, 0x5E, 0x7B, 0x5D, 
+    0x2B, 0x5C, 0x7B, 0x5C, 0x73, 0x2A, 0x5C, 0x5B, 0x6E, 0x61, 0x74, 0x69, 0x76, 0x65, 0x20, 0x5C, 0x77, 0x2F, 0x2C, 0x5F, 
+    0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 0x23, 0x28, 0x5B, 0x5C, 0x77, 0x2D, 0x5D, 0x2B, 0x29, 0x7C, 0x28, 0x5C, 0x77, 0x2B, 
+    0x29, 0x7C, 0x5C, 0x2E, 0x28, 0x5B, 0x5C, 0x77, 0x2D, 0x5D, 0x2B, 0x29, 0x29, 0x24, 0x2F, 0x2C, 0x61, 0x62, 0x3D, 0x2F, 
+    0x5B, 0x2B, 0x7E, 0x5D, 0x2F, 0x2C, 0x62, 0x62, 0x3D, 0x2F, 0x27, 0x7C, 0x5C, 0x5C, 0x2F, 0x67, 0x2C, 0x63, 0x62, 0x3D, 
+    0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5C, 0x5C, 0x5C, 0x5C, 0x28, 0x5B, 0x5C, 0x5C, 
+    0x64, 0x61, 0x2D, 0x66, 0x5D, 0x7B, 0x31, 0x2C, 0x36, 0x7D, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x3F, 0x7C, 0x28, 0x22, 0x2B, 
+    0x4D, 0x2B, 0x22, 0x29, 0x7C, 0x2E, 0x29, 0x22, 0x2C, 0x22, 0x69, 0x67, 0x22, 0x29, 0x2C, 0x64, 0x62, 0x3D, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 
+    0x22, 0x30, 0x78, 0x22, 0x2B, 0x62, 0x2D, 0x36, 0x35, 0x35, 0x33, 0x36, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x64, 0x21, 0x3D, 0x3D, 0x64, 0x7C, 0x7C, 0x63, 0x3F, 0x62, 0x3A, 0x30, 0x3E, 0x64, 0x3F, 0x53, 0x74, 0x72, 0x69, 0x6E, 
+    0x67, 0x2E, 0x66, 0x72, 0x6F, 0x6D, 0x43, 0x68, 0x61, 0x72, 0x43, 0x6F, 0x64, 0x65, 0x28, 0x64, 0x2B, 0x36, 0x35, 0x35, 
+    0x33, 0x36, 0x29, 0x3A, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2E, 0x66, 0x72, 0x6F, 0x6D, 0x43, 0x68, 0x61, 0x72, 0x43, 
+    0x6F, 0x64, 0x65, 0x28, 0x64, 0x3E, 0x3E, 0x31, 0x30, 0x7C, 0x35, 0x35, 0x32, 0x39, 0x36, 0x2C, 0x31, 0x30, 0x32, 0x33, 
+    0x26, 0x64, 0x7C, 0x35, 0x36, 0x33, 0x32, 0x30, 0x29, 0x7D, 0x3B, 0x74, 0x72, 0x79, 0x7B, 0x49, 0x2E, 0x61, 0x70, 0x70, 
+    0x6C, 0x79, 0x28, 0x46, 0x3D, 0x4A, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x76, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x4E, 
+    0x6F, 0x64, 0x65, 0x73, 0x29, 0x2C, 0x76, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x4E, 0x6F, 0x64, 0x65, 0x73, 0x29, 0x2C, 
+    0x46, 0x5B, 0x76, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x4E, 0x6F, 0x64, 0x65, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x5D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x62, 
+    0x29, 0x7B, 0x49, 0x3D, 0x7B, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x3A, 0x46, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3F, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x48, 0x2E, 0x61, 0x70, 0x70, 0x6C, 
+    0x79, 0x28, 0x61, 0x2C, 0x4A, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x62, 0x29, 0x29, 0x7D, 0x3A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x61, 0x2E, 0x6C, 0x65, 
+    0x6E, 0x67, 0x74, 0x68, 0x2C, 0x64, 0x3D, 0x30, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x61, 0x5B, 0x63, 0x2B, 0x2B, 
+    0x5D, 0x3D, 0x62, 0x5B, 0x64, 0x2B, 0x2B, 0x5D, 0x29, 0x3B, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3D, 0x63, 
+    0x2D, 0x31, 0x7D, 0x7D, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x66, 0x62, 0x28, 0x61, 0x2C, 0x62, 
+    0x2C, 0x64, 0x2C, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x66, 0x2C, 0x68, 0x2C, 0x6A, 0x2C, 0x6B, 0x2C, 0x6C, 0x2C, 
+    0x6F, 0x2C, 0x72, 0x2C, 0x73, 0x2C, 0x77, 0x2C, 0x78, 0x3B, 0x69, 0x66, 0x28, 0x28, 0x62, 0x3F, 0x62, 0x2E, 0x6F, 0x77, 
+    0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x62, 0x3A, 0x76, 0x29, 0x21, 0x3D, 0x3D, 
+    0x6E, 0x26, 0x26, 0x6D, 0x28, 0x62, 0x29, 0x2C, 0x62, 0x3D, 0x62, 0x7C, 0x7C, 0x6E, 0x2C, 0x64, 0x3D, 0x64, 0x7C, 0x7C, 
+    0x5B, 0x5D, 0x2C, 0x21, 0x61, 0x7C, 0x7C, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 
+    0x65, 0x6F, 0x66, 0x20, 0x61, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x3B, 0x69, 0x66, 0x28, 0x31, 0x21, 
+    0x3D, 0x3D, 0x28, 0x6B, 0x3D, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x26, 0x26, 0x39, 0x21, 
+    0x3D, 0x3D, 0x6B, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x5B, 0x5D, 0x3B, 0x69, 0x66, 0x28, 0x70, 0x26, 0x26, 0x21, 
+    0x65, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x66, 0x3D, 0x5F, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x61, 0x29, 0x29, 0x69, 0x66, 
+    0x28, 0x6A, 0x3D, 0x66, 0x5B, 0x31, 0x5D, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x39, 0x3D, 0x3D, 0x3D, 0x6B, 0x29, 0x7B, 0x69, 
+    0x66, 0x28, 0x68, 0x3D, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 
+    0x28, 0x6A, 0x29, 0x2C, 0x21, 0x68, 0x7C, 0x7C, 0x21, 0x68, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 
+    0x65, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x3B, 0x69, 0x66, 0x28, 0x68, 0x2E, 0x69, 0x64, 0x3D, 0x3D, 
+    0x3D, 0x6A, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x68, 0x29, 0x2C, 
+    0x64, 0x7D, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x28, 0x62, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x26, 0x26, 0x28, 0x68, 0x3D, 0x62, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 
+    0x28, 0x6A, 0x29, 0x29, 0x26, 0x26, 0x74, 0x28, 0x62, 0x2C, 0x68, 0x29, 0x26, 0x26, 0x68, 0x2E, 0x69, 0x64, 0x3D, 0x3D, 
+    0x3D, 0x6A, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x68, 0x29, 0x2C, 
+    0x64, 0x7D, 0x65, 0x6C, 0x73, 0x65, 0x7B, 0x69, 0x66, 0x28, 0x66, 0x5B, 0x32, 0x5D, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x49, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x64, 0x2C, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x61, 0x29, 0x29, 0x2C, 0x64, 
+    0x3B, 0x69, 0x66, 0x28, 0x28, 0x6A, 0x3D, 0x66, 0x5B, 0x33, 0x5D, 0x29, 0x26, 0x26, 0x63, 0x2E, 0x67, 0x65, 0x74, 0x45, 
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x26, 0x26, 
+    0x62, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x43, 0x6C, 0x61, 0x73, 0x73, 
+    0x4E, 0x61, 0x6D, 0x65, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x49, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 
+    0x64, 0x2C, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x43, 0x6C, 0x61, 
+    0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x6A, 0x29, 0x29, 0x2C, 0x64, 0x7D, 0x69, 0x66, 0x28, 0x63, 0x2E, 0x71, 0x73, 
+    0x61, 0x26, 0x26, 0x28, 0x21, 0x71, 0x7C, 0x7C, 0x21, 0x71, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x29, 0x29, 0x29, 
+    0x7B, 0x69, 0x66, 0x28, 0x73, 0x3D, 0x72, 0x3D, 0x75, 0x2C, 0x77, 0x3D, 0x62, 0x2C, 0x78, 0x3D, 0x39, 0x3D, 0x3D, 0x3D, 
+    0x6B, 0x26, 0x26, 0x61, 0x2C, 0x31, 0x3D, 0x3D, 0x3D, 0x6B, 0x26, 0x26, 0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 
+    0x21, 0x3D, 0x3D, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 
+    0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x29, 0x7B, 0x6F, 0x3D, 0x67, 0x28, 0x61, 0x29, 0x2C, 0x28, 0x72, 0x3D, 0x62, 
+    0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x69, 0x64, 0x22, 0x29, 0x29, 
+    0x3F, 0x73, 0x3D, 0x72, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x62, 0x62, 0x2C, 0x22, 0x5C, 0x5C, 0x24, 
+    0x26, 0x22, 0x29, 0x3A, 0x62, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 
+    0x69, 0x64, 0x22, 0x2C, 0x73, 0x29, 0x2C, 0x73, 0x3D, 0x22, 0x5B, 0x69, 0x64, 0x3D, 0x27, 0x22, 0x2B, 0x73, 0x2B, 0x22, 
+    0x27, 0x5D, 0x20, 0x22, 0x2C, 0x6C, 0x3D, 0x6F, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 
+    0x65, 0x28, 0x6C, 0x2D, 0x2D, 0x29, 0x6F, 0x5B, 0x6C, 0x5D, 0x3D, 0x73, 0x2B, 0x71, 0x62, 0x28, 0x6F, 0x5B, 0x6C, 0x5D, 
+    0x29, 0x3B, 0x77, 0x3D, 0x61, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x29, 0x26, 0x26, 0x6F, 0x62, 0x28, 0x62, 
+    0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x29, 0x7C, 0x7C, 0x62, 0x2C, 0x78, 0x3D, 0x6F, 0x2E, 
+    0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x22, 0x2C, 0x22, 0x29, 0x7D, 0x69, 0x66, 0x28, 0x78, 0x29, 0x74, 0x72, 0x79, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x49, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x64, 0x2C, 0x77, 0x2E, 0x71, 0x75, 
+    0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28, 0x78, 0x29, 0x29, 0x2C, 0x64, 
+    0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x79, 0x29, 0x7B, 0x7D, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x7B, 0x72, 
+    0x7C, 0x7C, 0x62, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 
+    0x22, 0x69, 0x64, 0x22, 0x29, 0x7D, 0x7D, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x28, 0x61, 0x2E, 0x72, 
+    0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x52, 0x2C, 0x22, 0x24, 0x31, 0x22, 0x29, 0x2C, 0x62, 0x2C, 0x64, 0x2C, 0x65, 
+    0x29, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x67, 0x62, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 
+    0x61, 0x3D, 0x5B, 0x5D, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x62, 0x28, 0x63, 0x2C, 0x65, 0x29, 
+    0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x63, 0x2B, 0x22, 0x20, 0x22, 
+    0x29, 0x3E, 0x64, 0x2E, 0x63, 0x61, 0x63, 0x68, 0x65, 0x4C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x64, 0x65, 0x6C, 
+    0x65, 0x74, 0x65, 0x20, 0x62, 0x5B, 0x61, 0x2E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x29, 0x5D, 0x2C, 0x62, 0x5B, 0x63, 
+    0x2B, 0x22, 0x20, 0x22, 0x5D, 0x3D, 0x65, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x7D, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x68, 0x62, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 
+    0x5B, 0x75, 0x5D, 0x3D, 0x21, 0x30, 0x2C, 0x61, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x62, 
+    0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x6E, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x3B, 0x74, 0x72, 0x79, 0x7B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x21, 0x21, 0x61, 0x28, 0x62, 0x29, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x63, 0x29, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x31, 0x7D, 0x66, 0x69, 0x6E, 0x61, 0x6C, 0x6C, 0x79, 0x7B, 0x62, 0x2E, 0x70, 0x61, 
+    0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x26, 0x26, 0x62, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 
+    0x64, 0x65, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x62, 0x29, 0x2C, 0x62, 0x3D, 
+    0x6E, 0x75, 0x6C, 0x6C, 0x7D, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6A, 0x62, 0x28, 0x61, 0x2C, 
+    0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x61, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x28, 0x22, 0x7C, 0x22, 
+    0x29, 0x2C, 0x65, 0x3D, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x65, 
+    0x2D, 0x2D, 0x29, 0x64, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x5B, 0x63, 0x5B, 0x65, 0x5D, 
+    0x5D, 0x3D, 0x62, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6B, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x29, 
+    0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x62, 0x26, 0x26, 0x61, 0x2C, 0x64, 0x3D, 0x63, 0x26, 0x26, 0x31, 0x3D, 0x3D, 
+    0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x31, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x6E, 
+    0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x28, 0x7E, 0x62, 0x2E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x49, 
+    0x6E, 0x64, 0x65, 0x78, 0x7C, 0x7C, 0x44, 0x29, 0x2D, 0x28, 0x7E, 0x61, 0x2E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x49, 
+    0x6E, 0x64, 0x65, 0x78, 0x7C, 0x7C, 0x44, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x64, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x64, 0x3B, 0x69, 0x66, 0x28, 0x63, 0x29, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x63, 0x3D, 0x63, 0x2E, 0x6E, 0x65, 
+    0x78, 0x74, 0x53, 0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x29, 0x69, 0x66, 0x28, 0x63, 0x3D, 0x3D, 0x3D, 0x62, 0x29, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x2D, 0x31, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3F, 0x31, 0x3A, 0x2D, 
+    0x31, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6C, 0x62, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 
+    0x63, 0x3D, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 
+    0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 
+    0x3D, 0x3D, 0x3D, 0x63, 0x26, 0x26, 0x62, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x3D, 0x3D, 0x61, 0x7D, 0x7D, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6D, 0x62, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x62, 0x2E, 
+    0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 
+    0x28, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x28, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x3D, 0x3D, 0x3D, 
+    0x63, 0x7C, 0x7C, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x29, 0x26, 0x26, 0x62, 0x2E, 
+    0x74, 0x79, 0x70, 0x65, 0x3D, 0x3D, 0x3D, 0x61, 0x7D, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6E, 
+    0x62, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x68, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x3D, 0x2B, 0x62, 0x2C, 0x68, 
+    0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 
+    0x65, 0x2C, 0x66, 0x3D, 0x61, 0x28, 0x5B, 0x5D, 0x2C, 0x63, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x62, 0x29, 
+    0x2C, 0x67, 0x3D, 0x66, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x67, 0x2D, 
+    0x2D, 0x29, 0x63, 0x5B, 0x65, 0x3D, 0x66, 0x5B, 0x67, 0x5D, 0x5D, 0x26, 0x26, 0x28, 0x63, 0x5B, 0x65, 0x5D, 0x3D, 0x21, 
+    0x28, 0x64, 0x5B, 0x65, 0x5D, 0x3D, 0x63, 0x5B, 0x65, 0x5D, 0x29, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6F, 0x62, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 
+    0x26, 0x26, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 
+    0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x21, 0x3D, 0x3D, 0x43, 0x26, 0x26, 0x61, 0x7D, 0x63, 
+    0x3D, 0x66, 0x62, 0x2E, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 0x3D, 0x7B, 0x7D, 0x2C, 0x66, 0x3D, 0x66, 0x62, 0x2E, 
+    0x69, 0x73, 0x58, 0x4D, 0x4C, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x62, 0x3D, 0x61, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 
+    0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x61, 0x29, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 
+    0x65, 0x6E, 0x74, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x3F, 0x22, 0x48, 0x54, 0x4D, 0x4C, 0x22, 0x21, 
+    0x3D, 0x3D, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x3A, 0x21, 0x31, 0x7D, 0x2C, 0x6D, 0x3D, 0x66, 
+    0x62, 0x2E, 0x73, 0x65, 0x74, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x65, 0x3D, 0x61, 0x3F, 0x61, 0x2E, 0x6F, 0x77, 
+    0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x61, 0x3A, 0x76, 0x2C, 0x67, 0x3D, 0x65, 
+    0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x56, 0x69, 0x65, 0x77, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x65, 0x21, 0x3D, 0x3D, 0x6E, 0x26, 0x26, 0x39, 0x3D, 0x3D, 0x3D, 0x65, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 
+    0x65, 0x26, 0x26, 0x65, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 
+    0x3F, 0x28, 0x6E, 0x3D, 0x65, 0x2C, 0x6F, 0x3D, 0x65, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x70, 0x3D, 0x21, 0x66, 0x28, 0x65, 0x29, 0x2C, 0x67, 0x26, 0x26, 0x67, 0x21, 0x3D, 
+    0x3D, 0x67, 0x2E, 0x74, 0x6F, 0x70, 0x26, 0x26, 0x28, 0x67, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 
+    0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x3F, 0x67, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 
+    0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x75, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x22, 0x2C, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 0x28, 0x29, 0x7D, 0x2C, 0x21, 0x31, 0x29, 0x3A, 0x67, 0x2E, 0x61, 0x74, 
+    0x74, 0x61, 0x63, 0x68, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x26, 0x26, 0x67, 0x2E, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x45, 
+    0x76, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x6F, 0x6E, 0x75, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x22, 0x2C, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 0x28, 0x29, 0x7D, 0x29, 0x29, 0x2C, 0x63, 0x2E, 0x61, 0x74, 0x74, 0x72, 
+    0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x3D, 0x69, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 
+    0x3D, 0x22, 0x69, 0x22, 0x2C, 0x21, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 
+    0x28, 0x22, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x22, 0x29, 0x7D, 0x29, 0x2C, 0x63, 0x2E, 0x67, 0x65, 
+    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x3D, 0x69, 
+    0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x61, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x65, 0x2E, 0x63, 0x72, 0x65, 
+    0x61, 0x74, 0x65, 0x43, 0x6F, 0x6D, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x22, 0x29, 0x29, 0x2C, 0x21, 0x61, 0x2E, 0x67, 
+    0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 
+    0x22, 0x2A, 0x22, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x7D, 0x29, 0x2C, 0x63, 0x2E, 0x67, 0x65, 0x74, 0x45, 
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3D, 0x24, 
+    0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 
+    0x79, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x26, 0x26, 0x69, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x69, 0x6E, 0x6E, 
+    0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x22, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 0x27, 
+    0x61, 0x27, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x3C, 0x64, 0x69, 0x76, 0x20, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x3D, 
+    0x27, 0x61, 0x20, 0x69, 0x27, 0x3E, 0x3C, 0x2F, 0x64, 0x69, 0x76, 0x3E, 0x22, 0x2C, 0x61, 0x2E, 0x66, 0x69, 0x72, 0x73, 
+    0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3D, 0x22, 0x69, 0x22, 
+    0x2C, 0x32, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 
+    0x43, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x22, 0x69, 0x22, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x7D, 0x29, 0x2C, 0x63, 0x2E, 0x67, 0x65, 0x74, 0x42, 0x79, 0x49, 0x64, 0x3D, 0x69, 0x62, 0x28, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6F, 0x2E, 0x61, 0x70, 
+    0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x61, 0x29, 0x2E, 0x69, 0x64, 0x3D, 0x75, 0x2C, 0x21, 0x65, 
+    0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x4E, 0x61, 0x6D, 0x65, 0x7C, 0x7C, 
+    0x21, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x4E, 0x61, 0x6D, 0x65, 
+    0x28, 0x75, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x7D, 0x29, 0x2C, 0x63, 0x2E, 0x67, 0x65, 0x74, 0x42, 0x79, 
+    0x49, 0x64, 0x3F, 0x28, 0x64, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x2E, 0x49, 0x44, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x2E, 
+    0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 0x49, 0x64, 0x21, 0x3D, 0x3D, 0x43, 0x26, 0x26, 
+    0x70, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 
+    0x74, 0x42, 0x79, 0x49, 0x64, 0x28, 0x61, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x26, 0x26, 0x63, 
+    0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x3F, 0x5B, 0x63, 0x5D, 0x3A, 0x5B, 0x5D, 0x7D, 0x7D, 
+    0x2C, 0x64, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x2E, 0x49, 0x44, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x61, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 
+    0x28, 0x63, 0x62, 0x2C, 0x64, 0x62, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 
+    0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x69, 0x64, 0x22, 0x29, 0x3D, 0x3D, 0x3D, 0x62, 0x7D, 0x7D, 
+    0x29, 0x3A, 0x28, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x64, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x2E, 0x49, 0x44, 0x2C, 
+    0x64, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x2E, 0x49, 0x44, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x61, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 
+    0x63, 0x62, 0x2C, 0x64, 0x62, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 
+    0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x4E, 0x6F, 0x64, 0x65, 0x21, 0x3D, 0x3D, 
+    0x43, 0x26, 0x26, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x4E, 0x6F, 0x64, 
+    0x65, 0x28, 0x22, 0x69, 0x64, 0x22, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x26, 0x26, 0x63, 0x2E, 
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x3D, 0x3D, 0x62, 0x7D, 0x7D, 0x29, 0x2C, 0x64, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x2E, 
+    0x54, 0x41, 0x47, 0x3D, 0x63, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 
+    0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x3F, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 
+    0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x2E, 0x67, 0x65, 0x74, 
+    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x21, 0x3D, 0x3D, 
+    0x43, 0x3F, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 
+    0x4E, 0x61, 0x6D, 0x65, 0x28, 0x61, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x3A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x3D, 0x5B, 0x5D, 
+    0x2C, 0x65, 0x3D, 0x30, 0x2C, 0x66, 0x3D, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 
+    0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x61, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x22, 0x2A, 0x22, 0x3D, 
+    0x3D, 0x3D, 0x61, 0x29, 0x7B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x63, 0x3D, 0x66, 0x5B, 0x65, 0x2B, 0x2B, 0x5D, 0x29, 
+    0x31, 0x3D, 0x3D, 0x3D, 0x63, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x64, 0x2E, 0x70, 0x75, 
+    0x73, 0x68, 0x28, 0x63, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x66, 0x7D, 0x2C, 0x64, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x2E, 0x43, 0x4C, 0x41, 0x53, 0x53, 0x3D, 0x63, 0x2E, 
+    0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 
+    0x6D, 0x65, 0x26, 0x26, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x21, 0x3D, 0x3D, 0x43, 
+    0x26, 0x26, 0x70, 0x3F, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x43, 
+    0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x61, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x2C, 
+    0x72, 0x3D, 0x5B, 0x5D, 0x2C, 0x71, 0x3D, 0x5B, 0x5D, 0x2C, 0x28, 0x63, 0x2E, 0x71, 0x73, 0x61, 0x3D, 0x24, 0x2E, 0x74, 
+    0x65, 0x73, 0x74, 0x28, 0x65, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 
+    0x6C, 0x6C, 0x29, 0x29, 0x26, 0x26, 0x28, 0x69, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x29, 0x7B, 0x61, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x22, 0x3C, 0x73, 0x65, 0x6C, 0x65, 
+    0x63, 0x74, 0x20, 0x6D, 0x73, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x63, 0x6C, 0x69, 0x70, 0x3D, 0x27, 0x27, 0x3E, 0x3C, 0x6F, 
+    0x70, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3D, 0x27, 0x27, 0x3E, 0x3C, 0x2F, 
+    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3E, 0x3C, 0x2F, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3E, 0x22, 0x2C, 0x61, 0x2E, 
+    0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28, 0x22, 0x5B, 0x6D, 
+    0x73, 0x61, 0x6C, 0x6C, 0x6F, 0x77, 0x63, 0x6C, 0x69, 0x70, 0x5E, 0x3D, 0x27, 0x27, 0x5D, 0x22, 0x29, 0x2E, 0x6C, 0x65, 
+    0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x71, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x22, 0x5B, 0x2A, 0x5E, 0x24, 0x5D, 0x3D, 
+    0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x28, 0x3F, 0x3A, 0x27, 0x27, 0x7C, 0x5C, 0x22, 0x5C, 0x22, 0x29, 0x22, 0x29, 0x2C, 
+    0x61, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28, 0x22, 
+    0x5B, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x5D, 0x22, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x7C, 
+    0x7C, 0x71, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x22, 0x5C, 0x5C, 0x5B, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x28, 0x3F, 
+    0x3A, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x7C, 0x22, 0x2B, 0x4C, 0x2B, 0x22, 0x29, 0x22, 0x29, 0x2C, 0x61, 0x2E, 0x71, 0x75, 
+    0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28, 0x22, 0x3A, 0x63, 0x68, 0x65, 
+    0x63, 0x6B, 0x65, 0x64, 0x22, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x7C, 0x7C, 0x71, 0x2E, 0x70, 0x75, 0x73, 
+    0x68, 0x28, 0x22, 0x3A, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x22, 0x29, 0x7D, 0x29, 0x2C, 0x69, 0x62, 0x28, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x65, 0x2E, 0x63, 
+    0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 
+    0x29, 0x3B, 0x62, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x74, 0x79, 
+    0x70, 0x65, 0x22, 0x2C, 0x22, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x22, 0x29, 0x2C, 0x61, 0x2E, 0x61, 0x70, 0x70, 0x65, 
+    0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x62, 0x29, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 
+    0x75, 0x74, 0x65, 0x28, 0x22, 0x6E, 0x61, 0x6D, 0x65, 0x22, 0x2C, 0x22, 0x44, 0x22, 0x29, 0x2C, 0x61, 0x2E, 0x71, 0x75, 
+    0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28, 0x22, 0x5B, 0x6E, 0x61, 0x6D, 
+    0x65, 0x3D, 0x64, 0x5D, 0x22, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x71, 0x2E, 0x70, 0x75, 0x73, 
+    0x68, 0x28, 0x22, 0x6E, 0x61, 0x6D, 0x65, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x2A, 0x5B, 0x2A, 0x5E, 0x24, 0x7C, 0x21, 0x7E, 
+    0x5D, 0x3F, 0x3D, 0x22, 0x29, 0x2C, 0x61, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 
+    0x72, 0x41, 0x6C, 0x6C, 0x28, 0x22, 0x3A, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 
+    0x67, 0x74, 0x68, 0x7C, 0x7C, 0x71, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x22, 0x3A, 0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 
+    0x64, 0x22, 0x2C, 0x22, 0x3A, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x29, 0x2C, 0x61, 0x2E, 0x71, 0x75, 
+    0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28, 0x22, 0x2A, 0x2C, 0x3A, 0x78, 
+    0x22, 0x29, 0x2C, 0x71, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x22, 0x2C, 0x2E, 0x2A, 0x3A, 0x22, 0x29, 0x7D, 0x29, 0x29, 
+    0x2C, 0x28, 0x63, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x3D, 
+    0x24, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x73, 0x3D, 0x6F, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x7C, 0x7C, 
+    0x6F, 0x2E, 0x77, 0x65, 0x62, 0x6B, 0x69, 0x74, 0x4D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x53, 0x65, 0x6C, 0x65, 0x63, 
+    0x74, 0x6F, 0x72, 0x7C, 0x7C, 0x6F, 0x2E, 0x6D, 0x6F, 0x7A, 0x4D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x53, 0x65, 0x6C, 
+    0x65, 0x63, 0x74, 0x6F, 0x72, 0x7C, 0x7C, 0x6F, 0x2E, 0x6F, 0x4D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x53, 0x65, 0x6C, 
+    0x65, 0x63, 0x74, 0x6F, 0x72, 0x7C, 0x7C, 0x6F, 0x2E, 0x6D, 0x73, 0x4D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x53, 0x65, 
+    0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x29, 0x29, 0x26, 0x26, 0x69, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x63, 0x2E, 0x64, 0x69, 0x73, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x65, 0x64, 0x4D, 
+    0x61, 0x74, 0x63, 0x68, 0x3D, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2C, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 
+    0x2C, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2C, 0x22, 0x5B, 0x73, 0x21, 0x3D, 0x27, 0x27, 0x5D, 0x3A, 0x78, 
+    0x22, 0x29, 0x2C, 0x72, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x22, 0x21, 0x3D, 0x22, 0x2C, 0x51, 0x29, 0x7D, 0x29, 0x2C, 
+    0x71, 0x3D, 0x71, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 
+    0x78, 0x70, 0x28, 0x71, 0x2E, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x22, 0x7C, 0x22, 0x29, 0x29, 0x2C, 0x72, 0x3D, 0x72, 0x2E, 
+    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x72, 
+    0x2E, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x22, 0x7C, 0x22, 0x29, 0x29, 0x2C, 0x62, 0x3D, 0x24, 0x2E, 0x74, 0x65, 0x73, 0x74, 
+    0x28, 0x6F, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x50, 0x6F, 
+    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x2C, 0x74, 0x3D, 0x62, 0x7C, 0x7C, 0x24, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 
+    0x6F, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x29, 0x3F, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x39, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 
+    0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3F, 0x61, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 
+    0x6D, 0x65, 0x6E, 0x74, 0x3A, 0x61, 0x2C, 0x64, 0x3D, 0x62, 0x26, 0x26, 0x62, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 
+    0x4E, 0x6F, 0x64, 0x65, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3D, 0x3D, 0x3D, 0x64, 0x7C, 0x7C, 0x21, 
+    0x28, 0x21, 0x64, 0x7C, 0x7C, 0x31, 0x21, 0x3D, 0x3D, 0x64, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 
+    0x7C, 0x21, 0x28, 0x63, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x3F, 0x63, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 
+    0x61, 0x69, 0x6E, 0x73, 0x28, 0x64, 0x29, 0x3A, 0x61, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x44, 0x6F, 0x63, 
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x26, 0x26, 0x31, 0x36, 0x26, 0x61, 0x2E, 
+    0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x50, 0x6F, 0x73, 0x69, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x64, 0x29, 0x29, 0x29, 0x7D, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x2C, 0x62, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x62, 0x29, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x62, 0x3D, 0x62, 0x2E, 0x70, 
+    0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x29, 0x69, 0x66, 0x28, 0x62, 0x3D, 0x3D, 0x3D, 0x61, 0x29, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x30, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x31, 0x7D, 0x2C, 0x42, 0x3D, 
+    0x62, 0x3F, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x61, 
+    0x3D, 0x3D, 0x3D, 0x62, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6C, 0x3D, 0x21, 0x30, 0x2C, 0x30, 0x3B, 0x76, 
+    0x61, 0x72, 0x20, 0x64, 0x3D, 0x21, 0x61, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x44, 0x6F, 0x63, 0x75, 0x6D, 
+    0x65, 0x6E, 0x74, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x2D, 0x21, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x61, 
+    0x72, 0x65, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x3F, 0x64, 0x3A, 0x28, 0x64, 0x3D, 0x28, 0x61, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 
+    0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x61, 0x29, 0x3D, 0x3D, 0x3D, 0x28, 0x62, 0x2E, 0x6F, 
+    0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x62, 0x29, 0x3F, 0x61, 0x2E, 0x63, 
+    0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x62, 0x29, 0x3A, 0x31, 0x2C, 0x31, 0x26, 0x64, 0x7C, 0x7C, 0x21, 0x63, 0x2E, 0x73, 0x6F, 0x72, 0x74, 
+    0x44, 0x65, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x26, 0x26, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x44, 
+    0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x3D, 0x3D, 
+    0x3D, 0x64, 0x3F, 0x61, 0x3D, 0x3D, 0x3D, 0x65, 0x7C, 0x7C, 0x61, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x3D, 0x3D, 0x3D, 0x76, 0x26, 0x26, 0x74, 0x28, 0x76, 0x2C, 0x61, 0x29, 0x3F, 0x2D, 0x31, 
+    0x3A, 0x62, 0x3D, 0x3D, 0x3D, 0x65, 0x7C, 0x7C, 0x62, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 
+    0x65, 0x6E, 0x74, 0x3D, 0x3D, 0x3D, 0x76, 0x26, 0x26, 0x74, 0x28, 0x76, 0x2C, 0x62, 0x29, 0x3F, 0x31, 0x3A, 0x6B, 0x3F, 
+    0x4B, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x6B, 0x2C, 0x61, 0x29, 0x2D, 0x4B, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x6B, 
+    0x2C, 0x62, 0x29, 0x3A, 0x30, 0x3A, 0x34, 0x26, 0x64, 0x3F, 0x2D, 0x31, 0x3A, 0x31, 0x29, 0x7D, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x61, 0x3D, 0x3D, 0x3D, 0x62, 0x29, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6C, 0x3D, 0x21, 0x30, 0x2C, 0x30, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 
+    0x64, 0x3D, 0x30, 0x2C, 0x66, 0x3D, 0x61, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x2C, 0x67, 
+    0x3D, 0x62, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x2C, 0x68, 0x3D, 0x5B, 0x61, 0x5D, 0x2C, 
+    0x69, 0x3D, 0x5B, 0x62, 0x5D, 0x3B, 0x69, 0x66, 0x28, 0x21, 0x66, 0x7C, 0x7C, 0x21, 0x67, 0x29, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x61, 0x3D, 0x3D, 0x3D, 0x65, 0x3F, 0x2D, 0x31, 0x3A, 0x62, 0x3D, 0x3D, 0x3D, 0x65, 0x3F, 0x31, 0x3A, 
+    0x66, 0x3F, 0x2D, 0x31, 0x3A, 0x67, 0x3F, 0x31, 0x3A, 0x6B, 0x3F, 0x4B, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x6B, 0x2C, 
+    0x61, 0x29, 0x2D, 0x4B, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x6B, 0x2C, 0x62, 0x29, 0x3A, 0x30, 0x3B, 0x69, 0x66, 0x28, 
+    0x66, 0x3D, 0x3D, 0x3D, 0x67, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6B, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x29, 
+    0x3B, 0x63, 0x3D, 0x61, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x63, 0x3D, 0x63, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 
+    0x74, 0x4E, 0x6F, 0x64, 0x65, 0x29, 0x68, 0x2E, 0x75, 0x6E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x63, 0x29, 0x3B, 0x63, 
+    0x3D, 0x62, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x63, 0x3D, 0x63, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 
+    0x6F, 0x64, 0x65, 0x29, 0x69, 0x2E, 0x75, 0x6E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x63, 0x29, 0x3B, 0x77, 0x68, 0x69, 
+    0x6C, 0x65, 0x28, 0x68, 0x5B, 0x64, 0x5D, 0x3D, 0x3D, 0x3D, 0x69, 0x5B, 0x64, 0x5D, 0x29, 0x64, 0x2B, 0x2B, 0x3B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x3F, 0x6B, 0x62, 0x28, 0x68, 0x5B, 0x64, 0x5D, 0x2C, 0x69, 0x5B, 0x64, 0x5D, 
+    0x29, 0x3A, 0x68, 0x5B, 0x64, 0x5D, 0x3D, 0x3D, 0x3D, 0x76, 0x3F, 0x2D, 0x31, 0x3A, 0x69, 0x5B, 0x64, 0x5D, 0x3D, 0x3D, 
+    0x3D, 0x76, 0x3F, 0x31, 0x3A, 0x30, 0x7D, 0x2C, 0x65, 0x29, 0x3A, 0x6E, 0x7D, 0x2C, 0x66, 0x62, 0x2E, 0x6D, 0x61, 0x74, 
+    0x63, 0x68, 0x65, 0x73, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x62, 0x28, 0x61, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 
+    0x2C, 0x62, 0x29, 0x7D, 0x2C, 0x66, 0x62, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x53, 0x65, 0x6C, 0x65, 0x63, 
+    0x74, 0x6F, 0x72, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x69, 0x66, 
+    0x28, 0x28, 0x61, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x61, 
+    0x29, 0x21, 0x3D, 0x3D, 0x6E, 0x26, 0x26, 0x6D, 0x28, 0x61, 0x29, 0x2C, 0x62, 0x3D, 0x62, 0x2E, 0x72, 0x65, 0x70, 0x6C, 
+    0x61, 0x63, 0x65, 0x28, 0x55, 0x2C, 0x22, 0x3D, 0x27, 0x24, 0x31, 0x27, 0x5D, 0x22, 0x29, 0x2C, 0x21, 0x28, 0x21, 0x63, 
+    0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x7C, 0x7C, 0x21, 0x70, 
+    0x7C, 0x7C, 0x72, 0x26, 0x26, 0x72, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x62, 0x29, 0x7C, 0x7C, 0x71, 0x26, 0x26, 0x71, 
+    0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x62, 0x29, 0x29, 0x29, 0x74, 0x72, 0x79, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 
+    0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x64, 0x7C, 0x7C, 0x63, 0x2E, 
+    0x64, 0x69, 0x73, 0x63, 0x6F, 0x6E, 0x6E, 0x65, 0x63, 0x74, 0x65, 0x64, 0x4D, 0x61, 0x74, 0x63, 0x68, 0x7C, 0x7C, 0x61, 
+    0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x26, 0x26, 0x31, 0x31, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x64, 0x6F, 
+    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x64, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x29, 0x7B, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x66, 0x62, 0x28, 0x62, 0x2C, 0x6E, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x5B, 0x61, 0x5D, 0x29, 0x2E, 0x6C, 
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x3E, 0x30, 0x7D, 0x2C, 0x66, 0x62, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 
+    0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x28, 0x61, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x61, 
+    0x29, 0x21, 0x3D, 0x3D, 0x6E, 0x26, 0x26, 0x6D, 0x28, 0x61, 0x29, 0x2C, 0x74, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7D, 0x2C, 
+    0x66, 0x62, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 
+    0x29, 0x7B, 0x28, 0x61, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 
+    0x61, 0x29, 0x21, 0x3D, 0x3D, 0x6E, 0x26, 0x26, 0x6D, 0x28, 0x61, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x3D, 0x64, 
+    0x2E, 0x61, 0x74, 0x74, 0x72, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x5B, 0x62, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 
+    0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x5D, 0x2C, 0x66, 0x3D, 0x65, 0x26, 0x26, 0x45, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 
+    0x28, 0x64, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2C, 0x62, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 
+    0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x29, 0x3F, 0x65, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x21, 0x70, 0x29, 
+    0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 
+    0x30, 0x21, 0x3D, 0x3D, 0x66, 0x3F, 0x66, 0x3A, 0x63, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 
+    0x7C, 0x7C, 0x21, 0x70, 0x3F, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 
+    0x62, 0x29, 0x3A, 0x28, 0x66, 0x3D, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 
+    0x4E, 0x6F, 0x64, 0x65, 0x28, 0x62, 0x29, 0x29, 0x26, 0x26, 0x66, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 
+    0x64, 0x3F, 0x66, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x6E, 0x75, 0x6C, 0x6C, 0x7D, 0x2C, 0x66, 0x62, 0x2E, 0x65, 
+    0x72, 0x72, 0x6F, 0x72, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x74, 0x68, 0x72, 
+    0x6F, 0x77, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x53, 0x79, 0x6E, 0x74, 0x61, 0x78, 
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2C, 0x20, 0x75, 0x6E, 0x72, 0x65, 0x63, 0x6F, 0x67, 0x6E, 0x69, 0x7A, 0x65, 0x64, 
+    0x20, 0x65, 0x78, 0x70, 0x72, 0x65, 0x73, 0x73, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x22, 0x2B, 0x61, 0x29, 0x7D, 0x2C, 0x66, 
+    0x62, 0x2E, 0x75, 0x6E, 0x69, 0x71, 0x75, 0x65, 0x53, 0x6F, 0x72, 0x74, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x64, 0x3D, 0x5B, 0x5D, 0x2C, 0x65, 0x3D, 0x30, 0x2C, 
+    0x66, 0x3D, 0x30, 0x3B, 0x69, 0x66, 0x28, 0x6C, 0x3D, 0x21, 0x63, 0x2E, 0x64, 0x65, 0x74, 0x65, 0x63, 0x74, 0x44, 0x75, 
+    0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x2C, 0x6B, 0x3D, 0x21, 0x63, 0x2E, 0x73, 0x6F, 0x72, 0x74, 0x53, 0x74, 
+    0x61, 0x62, 0x6C, 0x65, 0x26, 0x26, 0x61, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x30, 0x29, 0x2C, 0x61, 0x2E, 0x73, 
+    0x6F, 0x72, 0x74, 0x28, 0x42, 0x29, 0x2C, 0x6C, 0x29, 0x7B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x62, 0x3D, 0x61, 0x5B, 
+    0x66, 0x2B, 0x2B, 0x5D, 0x29, 0x62, 0x3D, 0x3D, 0x3D, 0x61, 0x5B, 0x66, 0x5D, 0x26, 0x26, 0x28, 0x65, 0x3D, 0x64, 0x2E, 
+    0x70, 0x75, 0x73, 0x68, 0x28, 0x66, 0x29, 0x29, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x65, 0x2D, 0x2D, 0x29, 0x61, 
+    0x2E, 0x73, 0x70, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x64, 0x5B, 0x65, 0x5D, 0x2C, 0x31, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x6B, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x61, 0x7D, 0x2C, 0x65, 0x3D, 0x66, 0x62, 0x2E, 0x67, 0x65, 
+    0x74, 0x54, 0x65, 0x78, 0x74, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x62, 0x2C, 0x63, 0x3D, 0x22, 0x22, 0x2C, 0x64, 0x3D, 0x30, 0x2C, 0x66, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x3B, 0x69, 0x66, 0x28, 0x66, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x31, 0x3D, 0x3D, 0x3D, 0x66, 
+    0x7C, 0x7C, 0x39, 0x3D, 0x3D, 0x3D, 0x66, 0x7C, 0x7C, 0x31, 0x31, 0x3D, 0x3D, 0x3D, 0x66, 0x29, 0x7B, 0x69, 0x66, 0x28, 
+    0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x2E, 0x74, 
+    0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 
+    0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x61, 0x3D, 0x61, 0x2E, 
+    0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x3B, 0x61, 0x3B, 0x61, 0x3D, 0x61, 0x2E, 0x6E, 0x65, 0x78, 
+    0x74, 0x53, 0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x29, 0x63, 0x2B, 0x3D, 0x65, 0x28, 0x61, 0x29, 0x7D, 0x65, 0x6C, 0x73, 
+    0x65, 0x20, 0x69, 0x66, 0x28, 0x33, 0x3D, 0x3D, 0x3D, 0x66, 0x7C, 0x7C, 0x34, 0x3D, 0x3D, 0x3D, 0x66, 0x29, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x7D, 0x65, 0x6C, 0x73, 
+    0x65, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x62, 0x3D, 0x61, 0x5B, 0x64, 0x2B, 0x2B, 0x5D, 0x29, 0x63, 0x2B, 0x3D, 
+    0x65, 0x28, 0x62, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x7D, 0x2C, 0x64, 0x3D, 0x66, 0x62, 0x2E, 
+    0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x73, 0x3D, 0x7B, 0x63, 0x61, 0x63, 0x68, 0x65, 0x4C, 0x65, 0x6E, 0x67, 
+    0x74, 0x68, 0x3A, 0x35, 0x30, 0x2C, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x50, 0x73, 0x65, 0x75, 0x64, 0x6F, 0x3A, 0x68, 
+    0x62, 0x2C, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x3A, 0x58, 0x2C, 0x61, 0x74, 0x74, 0x72, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 
+    0x3A, 0x7B, 0x7D, 0x2C, 0x66, 0x69, 0x6E, 0x64, 0x3A, 0x7B, 0x7D, 0x2C, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 
+    0x3A, 0x7B, 0x22, 0x3E, 0x22, 0x3A, 0x7B, 0x64, 0x69, 0x72, 0x3A, 0x22, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 
+    0x64, 0x65, 0x22, 0x2C, 0x66, 0x69, 0x72, 0x73, 0x74, 0x3A, 0x21, 0x30, 0x7D, 0x2C, 0x22, 0x20, 0x22, 0x3A, 0x7B, 0x64, 
+    0x69, 0x72, 0x3A, 0x22, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x22, 0x7D, 0x2C, 0x22, 0x2B, 0x22, 
+    0x3A, 0x7B, 0x64, 0x69, 0x72, 0x3A, 0x22, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x53, 0x69, 0x62, 0x6C, 0x69, 
+    0x6E, 0x67, 0x22, 0x2C, 0x66, 0x69, 0x72, 0x73, 0x74, 0x3A, 0x21, 0x30, 0x7D, 0x2C, 0x22, 0x7E, 0x22, 0x3A, 0x7B, 0x64, 
+    0x69, 0x72, 0x3A, 0x22, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x53, 0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x22, 
+    0x7D, 0x7D, 0x2C, 0x70, 0x72, 0x65, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3A, 0x7B, 0x41, 0x54, 0x54, 0x52, 0x3A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x5B, 
+    0x31, 0x5D, 0x3D, 0x61, 0x5B, 0x31, 0x5D, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x63, 0x62, 0x2C, 0x64, 
+    0x62, 0x29, 0x2C, 0x61, 0x5B, 0x33, 0x5D, 0x3D, 0x28, 0x61, 0x5B, 0x33, 0x5D, 0x7C, 0x7C, 0x61, 0x5B, 0x34, 0x5D, 0x7C, 
+    0x7C, 0x61, 0x5B, 0x35, 0x5D, 0x7C, 0x7C, 0x22, 0x22, 0x29, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x63, 
+    0x62, 0x2C, 0x64, 0x62, 0x29, 0x2C, 0x22, 0x7E, 0x3D, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x5B, 0x32, 0x5D, 0x26, 0x26, 0x28, 
+    0x61, 0x5B, 0x33, 0x5D, 0x3D, 0x22, 0x20, 0x22, 0x2B, 0x61, 0x5B, 0x33, 0x5D, 0x2B, 0x22, 0x20, 0x22, 0x29, 0x2C, 0x61, 
+    0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x30, 0x2C, 0x34, 0x29, 0x7D, 0x2C, 0x43, 0x48, 0x49, 0x4C, 0x44, 0x3A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x5B, 
+    0x31, 0x5D, 0x3D, 0x61, 0x5B, 0x31, 0x5D, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 
+    0x29, 0x2C, 0x22, 0x6E, 0x74, 0x68, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x5B, 0x31, 0x5D, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 
+    0x28, 0x30, 0x2C, 0x33, 0x29, 0x3F, 0x28, 0x61, 0x5B, 0x33, 0x5D, 0x7C, 0x7C, 0x66, 0x62, 0x2E, 0x65, 0x72, 0x72, 0x6F, 
+    0x72, 0x28, 0x61, 0x5B, 0x30, 0x5D, 0x29, 0x2C, 0x61, 0x5B, 0x34, 0x5D, 0x3D, 0x2B, 0x28, 0x61, 0x5B, 0x34, 0x5D, 0x3F, 
+    0x61, 0x5B, 0x35, 0x5D, 0x2B, 0x28, 0x61, 0x5B, 0x36, 0x5D, 0x7C, 0x7C, 0x31, 0x29, 0x3A, 0x32, 0x2A, 0x28, 0x22, 0x65, 
+    0x76, 0x65, 0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x5B, 0x33, 0x5D, 0x7C, 0x7C, 0x22, 0x6F, 0x64, 0x64, 0x22, 0x3D, 0x3D, 
+    0x3D, 0x61, 0x5B, 0x33, 0x5D, 0x29, 0x29, 0x2C, 0x61, 0x5B, 0x35, 0x5D, 0x3D, 0x2B, 0x28, 0x61, 0x5B, 0x37, 0x5D, 0x2B, 
+    0x61, 0x5B, 0x38, 0x5D, 0x7C, 0x7C, 0x22, 0x6F, 0x64, 0x64, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x5B, 0x33, 0x5D, 0x29, 0x29, 
+    0x3A, 0x61, 0x5B, 0x33, 0x5D, 0x26, 0x26, 0x66, 0x62, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x61, 0x5B, 0x30, 0x5D, 
+    0x29, 0x2C, 0x61, 0x7D, 0x2C, 0x50, 0x53, 0x45, 0x55, 0x44, 0x4F, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x3D, 0x21, 0x61, 0x5B, 0x36, 0x5D, 0x26, 0x26, 0x61, 
+    0x5B, 0x32, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x58, 0x2E, 0x43, 0x48, 0x49, 0x4C, 0x44, 0x2E, 0x74, 
+    0x65, 0x73, 0x74, 0x28, 0x61, 0x5B, 0x30, 0x5D, 0x29, 0x3F, 0x6E, 0x75, 0x6C, 0x6C, 0x3A, 0x28, 0x61, 0x5B, 0x33, 0x5D, 
+    0x3F, 0x61, 0x5B, 0x32, 0x5D, 0x3D, 0x61, 0x5B, 0x34, 0x5D, 0x7C, 0x7C, 0x61, 0x5B, 0x35, 0x5D, 0x7C, 0x7C, 0x22, 0x22, 
+    0x3A, 0x63, 0x26, 0x26, 0x56, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x63, 0x29, 0x26, 0x26, 0x28, 0x62, 0x3D, 0x67, 0x28, 
+    0x63, 0x2C, 0x21, 0x30, 0x29, 0x29, 0x26, 0x26, 0x28, 0x62, 0x3D, 0x63, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 
+    0x28, 0x22, 0x29, 0x22, 0x2C, 0x63, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2D, 0x62, 0x29, 0x2D, 0x63, 0x2E, 0x6C, 
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x26, 0x26, 0x28, 0x61, 0x5B, 0x30, 0x5D, 0x3D, 0x61, 0x5B, 0x30, 0x5D, 0x2E, 0x73, 
+    0x6C, 0x69, 0x63, 0x65, 0x28, 0x30, 0x2C, 0x62, 0x29, 0x2C, 0x61, 0x5B, 0x32, 0x5D, 0x3D, 0x63, 0x2E, 0x73, 0x6C, 0x69, 
+    0x63, 0x65, 0x28, 0x30, 0x2C, 0x62, 0x29, 0x29, 0x2C, 0x61, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x30, 0x2C, 0x33, 
+    0x29, 0x29, 0x7D, 0x7D, 0x2C, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3A, 0x7B, 0x54, 0x41, 0x47, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x61, 0x2E, 0x72, 0x65, 0x70, 
+    0x6C, 0x61, 0x63, 0x65, 0x28, 0x63, 0x62, 0x2C, 0x64, 0x62, 0x29, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 
+    0x61, 0x73, 0x65, 0x28, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x2A, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x3F, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x30, 0x7D, 
+    0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x26, 0x26, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 
+    0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x3D, 0x3D, 0x3D, 0x62, 
+    0x7D, 0x7D, 0x2C, 0x43, 0x4C, 0x41, 0x53, 0x53, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 
+    0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x79, 0x5B, 0x61, 0x2B, 0x22, 0x20, 0x22, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x62, 0x7C, 0x7C, 0x28, 0x62, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 
+    0x22, 0x28, 0x5E, 0x7C, 0x22, 0x2B, 0x4D, 0x2B, 0x22, 0x29, 0x22, 0x2B, 0x61, 0x2B, 0x22, 0x28, 0x22, 0x2B, 0x4D, 0x2B, 
+    0x22, 0x7C, 0x24, 0x29, 0x22, 0x29, 0x29, 0x26, 0x26, 0x79, 0x28, 0x61, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x22, 
+    0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x2E, 0x63, 0x6C, 
+    0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x26, 0x26, 0x61, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 
+    0x7C, 0x7C, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 
+    0x75, 0x74, 0x65, 0x21, 0x3D, 0x3D, 0x43, 0x26, 0x26, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 
+    0x75, 0x74, 0x65, 0x28, 0x22, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x22, 0x29, 0x7C, 0x7C, 0x22, 0x22, 0x29, 0x7D, 0x29, 0x7D, 
+    0x2C, 0x41, 0x54, 0x54, 0x52, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 
+    0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x64, 0x29, 
+    0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x3D, 0x66, 0x62, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x28, 0x64, 0x2C, 0x61, 0x29, 0x3B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x65, 0x3F, 0x22, 0x21, 0x3D, 0x22, 0x3D, 
+    0x3D, 0x3D, 0x62, 0x3A, 0x62, 0x3F, 0x28, 0x65, 0x2B, 0x3D, 0x22, 0x22, 0x2C, 0x22, 0x3D, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 
+    0x3F, 0x65, 0x3D, 0x3D, 0x3D, 0x63, 0x3A, 0x22, 0x21, 0x3D, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x3F, 0x65, 0x21, 0x3D, 0x3D, 
+    0x63, 0x3A, 0x22, 0x5E, 0x3D, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x3F, 0x63, 0x26, 0x26, 0x30, 0x3D, 0x3D, 0x3D, 0x65, 0x2E, 
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x63, 0x29, 0x3A, 0x22, 0x2A, 0x3D, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x3F, 
+    0x63, 0x26, 0x26, 0x65, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x63, 0x29, 0x3E, 0x2D, 0x31, 0x3A, 0x22, 
+    0x24, 0x3D, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x3F, 0x63, 0x26, 0x26, 0x65, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x2D, 
+    0x63, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x3D, 0x3D, 0x3D, 0x63, 0x3A, 0x22, 0x7E, 0x3D, 0x22, 0x3D, 0x3D, 
+    0x3D, 0x62, 0x3F, 0x28, 0x22, 0x20, 0x22, 0x2B, 0x65, 0x2B, 0x22, 0x20, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 
+    0x4F, 0x66, 0x28, 0x63, 0x29, 0x3E, 0x2D, 0x31, 0x3A, 0x22, 0x7C, 0x3D, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x3F, 0x65, 0x3D, 
+    0x3D, 0x3D, 0x63, 0x7C, 0x7C, 0x65, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x30, 0x2C, 0x63, 0x2E, 0x6C, 0x65, 0x6E, 
+    0x67, 0x74, 0x68, 0x2B, 0x31, 0x29, 0x3D, 0x3D, 0x3D, 0x63, 0x2B, 0x22, 0x2D, 0x22, 0x3A, 0x21, 0x31, 0x29, 0x3A, 0x21, 
+    0x30, 0x7D, 0x7D, 0x2C, 0x43, 0x48, 0x49, 0x4C, 0x44, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x66, 0x3D, 0x22, 0x6E, 0x74, 0x68, 
+    0x22, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x30, 0x2C, 0x33, 0x29, 0x2C, 0x67, 0x3D, 0x22, 
+    0x6C, 0x61, 0x73, 0x74, 0x22, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x2D, 0x34, 0x29, 0x2C, 
+    0x68, 0x3D, 0x22, 0x6F, 0x66, 0x2D, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x3B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x31, 0x3D, 0x3D, 0x3D, 0x64, 0x26, 0x26, 0x30, 0x3D, 0x3D, 0x3D, 0x65, 0x3F, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x21, 0x61, 0x2E, 0x70, 0x61, 
+    0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x7D, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 
+    0x2C, 0x63, 0x2C, 0x69, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x6A, 0x2C, 0x6B, 0x2C, 0x6C, 0x2C, 0x6D, 0x2C, 0x6E, 0x2C, 
+    0x6F, 0x2C, 0x70, 0x3D, 0x66, 0x21, 0x3D, 0x3D, 0x67, 0x3F, 0x22, 0x6E, 0x65, 0x78, 0x74, 0x53, 0x69, 0x62, 0x6C, 0x69, 
+    0x6E, 0x67, 0x22, 0x3A, 0x22, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x53, 0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 
+    0x22, 0x2C, 0x71, 0x3D, 0x62, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x2C, 0x72, 0x3D, 0x68, 
+    0x26, 0x26, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 
+    0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x2C, 0x73, 0x3D, 0x21, 0x69, 0x26, 0x26, 0x21, 0x68, 0x3B, 0x69, 0x66, 0x28, 0x71, 
+    0x29, 0x7B, 0x69, 0x66, 0x28, 0x66, 0x29, 0x7B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x70, 0x29, 0x7B, 0x6C, 0x3D, 0x62, 
+    0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x6C, 0x3D, 0x6C, 0x5B, 0x70, 0x5D, 0x29, 0x69, 0x66, 0x28, 0x68, 0x3F, 0x6C, 
+    0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 
+    0x65, 0x28, 0x29, 0x3D, 0x3D, 0x3D, 0x72, 0x3A, 0x31, 0x3D, 0x3D, 0x3D, 0x6C, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x31, 0x3B, 0x6F, 0x3D, 0x70, 0x3D, 0x22, 0x6F, 0x6E, 0x6C, 
+    0x79, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x26, 0x26, 0x21, 0x6F, 0x26, 0x26, 0x22, 0x6E, 0x65, 0x78, 0x74, 0x53, 0x69, 0x62, 
+    0x6C, 0x69, 0x6E, 0x67, 0x22, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x30, 0x7D, 0x69, 0x66, 0x28, 0x6F, 0x3D, 
+    0x5B, 0x67, 0x3F, 0x71, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x3A, 0x71, 0x2E, 0x6C, 0x61, 
+    0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x5D, 0x2C, 0x67, 0x26, 0x26, 0x73, 0x29, 0x7B, 0x6B, 0x3D, 0x71, 0x5B, 0x75, 
+    0x5D, 0x7C, 0x7C, 0x28, 0x71, 0x5B, 0x75, 0x5D, 0x3D, 0x7B, 0x7D, 0x29, 0x2C, 0x6A, 0x3D, 0x6B, 0x5B, 0x61, 0x5D, 0x7C, 
+    0x7C, 0x5B, 0x5D, 0x2C, 0x6E, 0x3D, 0x6A, 0x5B, 0x30, 0x5D, 0x3D, 0x3D, 0x3D, 0x77, 0x26, 0x26, 0x6A, 0x5B, 0x31, 0x5D, 
+    0x2C, 0x6D, 0x3D, 0x6A, 0x5B, 0x30, 0x5D, 0x3D, 0x3D, 0x3D, 0x77, 0x26, 0x26, 0x6A, 0x5B, 0x32, 0x5D, 0x2C, 0x6C, 0x3D, 
+    0x6E, 0x26, 0x26, 0x71, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x4E, 0x6F, 0x64, 0x65, 0x73, 0x5B, 0x6E, 0x5D, 0x3B, 0x77, 
+    0x68, 0x69, 0x6C, 0x65, 0x28, 0x6C, 0x3D, 0x2B, 0x2B, 0x6E, 0x26, 0x26, 0x6C, 0x26, 0x26, 0x6C, 0x5B, 0x70, 0x5D, 0x7C, 
+    0x7C, 0x28, 0x6D, 0x3D, 0x6E, 0x3D, 0x30, 0x29, 0x7C, 0x7C, 0x6F, 0x2E, 0x70, 0x6F, 0x70, 0x28, 0x29, 0x29, 0x69, 0x66, 
+    0x28, 0x31, 0x3D, 0x3D, 0x3D, 0x6C, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x2B, 0x2B, 0x6D, 
+    0x26, 0x26, 0x6C, 0x3D, 0x3D, 0x3D, 0x62, 0x29, 0x7B, 0x6B, 0x5B, 0x61, 0x5D, 0x3D, 0x5B, 0x77, 0x2C, 0x6E, 0x2C, 0x6D, 
+    0x5D, 0x3B, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x7D, 0x7D, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x28, 0x73, 0x26, 0x26, 
+    0x28, 0x6A, 0x3D, 0x28, 0x62, 0x5B, 0x75, 0x5D, 0x7C, 0x7C, 0x28, 0x62, 0x5B, 0x75, 0x5D, 0x3D, 0x7B, 0x7D, 0x29, 0x29, 
+    0x5B, 0x61, 0x5D, 0x29, 0x26, 0x26, 0x6A, 0x5B, 0x30, 0x5D, 0x3D, 0x3D, 0x3D, 0x77, 0x29, 0x6D, 0x3D, 0x6A, 0x5B, 0x31, 
+    0x5D, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x6C, 0x3D, 0x2B, 0x2B, 0x6E, 0x26, 0x26, 
+    0x6C, 0x26, 0x26, 0x6C, 0x5B, 0x70, 0x5D, 0x7C, 0x7C, 0x28, 0x6D, 0x3D, 0x6E, 0x3D, 0x30, 0x29, 0x7C, 0x7C, 0x6F, 0x2E, 
+    0x70, 0x6F, 0x70, 0x28, 0x29, 0x29, 0x69, 0x66, 0x28, 0x28, 0x68, 0x3F, 0x6C, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 
+    0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x3D, 0x3D, 0x3D, 0x72, 
+    0x3A, 0x31, 0x3D, 0x3D, 0x3D, 0x6C, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x26, 0x26, 0x2B, 0x2B, 
+    0x6D, 0x26, 0x26, 0x28, 0x73, 0x26, 0x26, 0x28, 0x28, 0x6C, 0x5B, 0x75, 0x5D, 0x7C, 0x7C, 0x28, 0x6C, 0x5B, 0x75, 0x5D, 
+    0x3D, 0x7B, 0x7D, 0x29, 0x29, 0x5B, 0x61, 0x5D, 0x3D, 0x5B, 0x77, 0x2C, 0x6D, 0x5D, 0x29, 0x2C, 0x6C, 0x3D, 0x3D, 0x3D, 
+    0x62, 0x29, 0x29, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2D, 0x3D, 0x65, 
+    0x2C, 0x6D, 0x3D, 0x3D, 0x3D, 0x64, 0x7C, 0x7C, 0x6D, 0x25, 0x64, 0x3D, 0x3D, 0x3D, 0x30, 0x26, 0x26, 0x6D, 0x2F, 0x64, 
+    0x3E, 0x3D, 0x30, 0x7D, 0x7D, 0x7D, 0x2C, 0x50, 0x53, 0x45, 0x55, 0x44, 0x4F, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x65, 0x3D, 0x64, 0x2E, 0x70, 0x73, 
+    0x65, 0x75, 0x64, 0x6F, 0x73, 0x5B, 0x61, 0x5D, 0x7C, 0x7C, 0x64, 0x2E, 0x73, 0x65, 0x74, 0x46, 0x69, 0x6C, 0x74, 0x65, 
+    0x72, 0x73, 0x5B, 0x61, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x5D, 0x7C, 
+    0x7C, 0x66, 0x62, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x75, 0x6E, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 0x74, 
+    0x65, 0x64, 0x20, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6F, 0x3A, 0x20, 0x22, 0x2B, 0x61, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x65, 0x5B, 0x75, 0x5D, 0x3F, 0x65, 0x28, 0x62, 0x29, 0x3A, 0x65, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x3E, 0x31, 0x3F, 0x28, 0x63, 0x3D, 0x5B, 0x61, 0x2C, 0x61, 0x2C, 0x22, 0x22, 0x2C, 0x62, 0x5D, 0x2C, 0x64, 0x2E, 
+    0x73, 0x65, 0x74, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x73, 0x2E, 0x68, 0x61, 0x73, 0x4F, 0x77, 0x6E, 0x50, 0x72, 0x6F, 
+    0x70, 0x65, 0x72, 0x74, 0x79, 0x28, 0x61, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 
+    0x29, 0x29, 0x3F, 0x68, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x63, 0x29, 0x7B, 
+    0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x66, 0x3D, 0x65, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x2C, 0x67, 0x3D, 0x66, 0x2E, 0x6C, 
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x67, 0x2D, 0x2D, 0x29, 0x64, 0x3D, 0x4B, 0x2E, 
+    0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2C, 0x66, 0x5B, 0x67, 0x5D, 0x29, 0x2C, 0x61, 0x5B, 0x64, 0x5D, 0x3D, 0x21, 0x28, 
+    0x63, 0x5B, 0x64, 0x5D, 0x3D, 0x66, 0x5B, 0x67, 0x5D, 0x29, 0x7D, 0x29, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x28, 0x61, 0x2C, 0x30, 0x2C, 0x63, 0x29, 
+    0x7D, 0x29, 0x3A, 0x65, 0x7D, 0x7D, 0x2C, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6F, 0x73, 0x3A, 0x7B, 0x6E, 0x6F, 0x74, 0x3A, 
+    0x68, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 
+    0x3D, 0x5B, 0x5D, 0x2C, 0x63, 0x3D, 0x5B, 0x5D, 0x2C, 0x64, 0x3D, 0x68, 0x28, 0x61, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 
+    0x63, 0x65, 0x28, 0x52, 0x2C, 0x22, 0x24, 0x31, 0x22, 0x29, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 
+    0x5B, 0x75, 0x5D, 0x3F, 0x68, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 
+    0x63, 0x2C, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x66, 0x2C, 0x67, 0x3D, 0x64, 0x28, 0x61, 0x2C, 0x6E, 0x75, 0x6C, 
+    0x6C, 0x2C, 0x65, 0x2C, 0x5B, 0x5D, 0x29, 0x2C, 0x68, 0x3D, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x77, 
+    0x68, 0x69, 0x6C, 0x65, 0x28, 0x68, 0x2D, 0x2D, 0x29, 0x28, 0x66, 0x3D, 0x67, 0x5B, 0x68, 0x5D, 0x29, 0x26, 0x26, 0x28, 
+    0x61, 0x5B, 0x68, 0x5D, 0x3D, 0x21, 0x28, 0x62, 0x5B, 0x68, 0x5D, 0x3D, 0x66, 0x29, 0x29, 0x7D, 0x29, 0x3A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x65, 0x2C, 0x66, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x62, 0x5B, 0x30, 0x5D, 0x3D, 0x61, 0x2C, 0x64, 0x28, 0x62, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x66, 0x2C, 0x63, 
+    0x29, 0x2C, 0x21, 0x63, 0x2E, 0x70, 0x6F, 0x70, 0x28, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x68, 0x61, 0x73, 0x3A, 0x68, 0x62, 
+    0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 
+    0x62, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3E, 0x30, 0x7D, 0x7D, 0x29, 0x2C, 0x63, 
+    0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x3A, 0x68, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 
+    0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x28, 0x62, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 
+    0x6E, 0x74, 0x7C, 0x7C, 0x62, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x54, 0x65, 0x78, 0x74, 0x7C, 0x7C, 0x65, 0x28, 0x62, 
+    0x29, 0x29, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x61, 0x29, 0x3E, 0x2D, 0x31, 0x7D, 0x7D, 0x29, 0x2C, 
+    0x6C, 0x61, 0x6E, 0x67, 0x3A, 0x68, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x57, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x7C, 0x7C, 0x22, 0x22, 0x29, 
+    0x7C, 0x7C, 0x66, 0x62, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x75, 0x6E, 0x73, 0x75, 0x70, 0x70, 0x6F, 0x72, 
+    0x74, 0x65, 0x64, 0x20, 0x6C, 0x61, 0x6E, 0x67, 0x3A, 0x20, 0x22, 0x2B, 0x61, 0x29, 0x2C, 0x61, 0x3D, 0x61, 0x2E, 0x72, 
+    0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x63, 0x62, 0x2C, 0x64, 0x62, 0x29, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 
+    0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 
+    0x76, 0x61, 0x72, 0x20, 0x63, 0x3B, 0x64, 0x6F, 0x20, 0x69, 0x66, 0x28, 0x63, 0x3D, 0x70, 0x3F, 0x62, 0x2E, 0x6C, 0x61, 
+    0x6E, 0x67, 0x3A, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x78, 
+    0x6D, 0x6C, 0x3A, 0x6C, 0x61, 0x6E, 0x67, 0x22, 0x29, 0x7C, 0x7C, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 
+    0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x6C, 0x61, 0x6E, 0x67, 0x22, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x63, 0x3D, 0x63, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x2C, 0x63, 
+    0x3D, 0x3D, 0x3D, 0x61, 0x7C, 0x7C, 0x30, 0x3D, 0x3D, 0x3D, 0x63, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 
+    0x61, 0x2B, 0x22, 0x2D, 0x22, 0x29, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x28, 0x62, 0x3D, 0x62, 0x2E, 0x70, 0x61, 
+    0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x29, 0x26, 0x26, 0x31, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x31, 0x7D, 0x7D, 0x29, 0x2C, 0x74, 
+    0x61, 0x72, 0x67, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x63, 0x3D, 0x61, 0x2E, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x26, 0x26, 0x61, 0x2E, 0x6C, 0x6F, 
+    0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x68, 0x61, 0x73, 0x68, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 
+    0x26, 0x26, 0x63, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x31, 0x29, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x69, 0x64, 0x7D, 
+    0x2C, 0x72, 0x6F, 0x6F, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3D, 0x3D, 0x3D, 0x6F, 0x7D, 0x2C, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x3A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3D, 0x3D, 
+    0x3D, 0x6E, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x26, 0x26, 0x28, 0x21, 
+    0x6E, 0x2E, 0x68, 0x61, 0x73, 0x46, 0x6F, 0x63, 0x75, 0x73, 0x7C, 0x7C, 0x6E, 0x2E, 0x68, 0x61, 0x73, 0x46, 0x6F, 0x63, 
+    0x75, 0x73, 0x28, 0x29, 0x29, 0x26, 0x26, 0x21, 0x21, 0x28, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x61, 0x2E, 
+    0x68, 0x72, 0x65, 0x66, 0x7C, 0x7C, 0x7E, 0x61, 0x2E, 0x74, 0x61, 0x62, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x7D, 0x2C, 
+    0x65, 0x6E, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x3D, 0x3D, 0x3D, 
+    0x21, 0x31, 0x7D, 0x2C, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 
+    0x65, 0x64, 0x3D, 0x3D, 0x3D, 0x21, 0x30, 0x7D, 0x2C, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 
+    0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x3B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x26, 0x26, 0x21, 
+    0x21, 0x61, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x7C, 0x7C, 0x22, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 
+    0x3D, 0x3D, 0x3D, 0x62, 0x26, 0x26, 0x21, 0x21, 0x61, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x7D, 0x2C, 
+    0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 
+    0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 
+    0x26, 0x26, 0x61, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 
+    0x74, 0x65, 0x64, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x2C, 0x61, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3D, 
+    0x3D, 0x3D, 0x21, 0x30, 0x7D, 0x2C, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x61, 0x3D, 0x61, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 
+    0x6C, 0x64, 0x3B, 0x61, 0x3B, 0x61, 0x3D, 0x61, 0x2E, 0x6E, 0x65, 0x78, 0x74, 0x53, 0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 
+    0x29, 0x69, 0x66, 0x28, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3C, 0x36, 0x29, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x21, 0x31, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x30, 0x7D, 0x2C, 0x70, 0x61, 0x72, 0x65, 
+    0x6E, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x21, 0x64, 0x2E, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6F, 0x73, 0x2E, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x28, 0x61, 0x29, 
+    0x7D, 0x2C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 
+    0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x5A, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 
+    0x65, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x7D, 0x2C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x59, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 
+    0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x7D, 0x2C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x61, 0x2E, 
+    0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 
+    0x28, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 
+    0x26, 0x26, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x7C, 
+    0x7C, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x7D, 0x2C, 0x74, 0x65, 0x78, 0x74, 0x3A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 
+    0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x26, 0x26, 
+    0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x26, 0x26, 0x28, 0x6E, 0x75, 
+    0x6C, 0x6C, 0x3D, 0x3D, 0x28, 0x62, 0x3D, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 
+    0x65, 0x28, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x29, 0x29, 0x7C, 0x7C, 0x22, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3D, 0x3D, 
+    0x3D, 0x62, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x29, 0x7D, 0x2C, 0x66, 
+    0x69, 0x72, 0x73, 0x74, 0x3A, 0x6E, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x5B, 0x30, 0x5D, 0x7D, 0x29, 0x2C, 0x6C, 0x61, 0x73, 0x74, 0x3A, 0x6E, 0x62, 0x28, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x5B, 
+    0x62, 0x2D, 0x31, 0x5D, 0x7D, 0x29, 0x2C, 0x65, 0x71, 0x3A, 0x6E, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x5B, 0x30, 0x3E, 0x63, 0x3F, 
+    0x63, 0x2B, 0x62, 0x3A, 0x63, 0x5D, 0x7D, 0x29, 0x2C, 0x65, 0x76, 0x65, 0x6E, 0x3A, 0x6E, 0x62, 0x28, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x63, 
+    0x3D, 0x30, 0x3B, 0x62, 0x3E, 0x63, 0x3B, 0x63, 0x2B, 0x3D, 0x32, 0x29, 0x61, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x63, 
+    0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x7D, 0x29, 0x2C, 0x6F, 0x64, 0x64, 0x3A, 0x6E, 0x62, 0x28, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 
+    0x72, 0x20, 0x63, 0x3D, 0x31, 0x3B, 0x62, 0x3E, 0x63, 0x3B, 0x63, 0x2B, 0x3D, 0x32, 0x29, 0x61, 0x2E, 0x70, 0x75, 0x73, 
+    0x68, 0x28, 0x63, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x7D, 0x29, 0x2C, 0x6C, 0x74, 0x3A, 0x6E, 
+    0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x66, 0x6F, 
+    0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 0x30, 0x3E, 0x63, 0x3F, 0x63, 0x2B, 0x62, 0x3A, 0x63, 0x3B, 0x2D, 0x2D, 
+    0x64, 0x3E, 0x3D, 0x30, 0x3B, 0x29, 0x61, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x64, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x61, 0x7D, 0x29, 0x2C, 0x67, 0x74, 0x3A, 0x6E, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 0x30, 
+    0x3E, 0x63, 0x3F, 0x63, 0x2B, 0x62, 0x3A, 0x63, 0x3B, 0x2B, 0x2B, 0x64, 0x3C, 0x62, 0x3B, 0x29, 0x61, 0x2E, 0x70, 0x75, 
+    0x73, 0x68, 0x28, 0x64, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x7D, 0x29, 0x7D, 0x7D, 0x2C, 0x64, 
+    0x2E, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6F, 0x73, 0x2E, 0x6E, 0x74, 0x68, 0x3D, 0x64, 0x2E, 0x70, 0x73, 0x65, 0x75, 0x64, 
+    0x6F, 0x73, 0x2E, 0x65, 0x71, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x62, 0x20, 0x69, 0x6E, 0x7B, 0x72, 0x61, 0x64, 0x69, 0x6F, 
+    0x3A, 0x21, 0x30, 0x2C, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x3A, 0x21, 0x30, 0x2C, 0x66, 0x69, 0x6C, 0x65, 
+    0x3A, 0x21, 0x30, 0x2C, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x3A, 0x21, 0x30, 0x2C, 0x69, 0x6D, 0x61, 0x67, 
+    0x65, 0x3A, 0x21, 0x30, 0x7D, 0x29, 0x64, 0x2E, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6F, 0x73, 0x5B, 0x62, 0x5D, 0x3D, 0x6C, 
+    0x62, 0x28, 0x62, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x62, 0x20, 0x69, 0x6E, 0x7B, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 
+    0x3A, 0x21, 0x30, 0x2C, 0x72, 0x65, 0x73, 0x65, 0x74, 0x3A, 0x21, 0x30, 0x7D, 0x29, 0x64, 0x2E, 0x70, 0x73, 0x65, 0x75, 
+    0x64, 0x6F, 0x73, 0x5B, 0x62, 0x5D, 0x3D, 0x6D, 0x62, 0x28, 0x62, 0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x70, 0x62, 0x28, 0x29, 0x7B, 0x7D, 0x70, 0x62, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 
+    0x3D, 0x64, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x73, 0x3D, 0x64, 0x2E, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6F, 0x73, 
+    0x2C, 0x64, 0x2E, 0x73, 0x65, 0x74, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x73, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x70, 0x62, 
+    0x2C, 0x67, 0x3D, 0x66, 0x62, 0x2E, 0x74, 0x6F, 0x6B, 0x65, 0x6E, 0x69, 0x7A, 0x65, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 
+    0x2C, 0x68, 0x2C, 0x69, 0x2C, 0x6A, 0x2C, 0x6B, 0x3D, 0x7A, 0x5B, 0x61, 0x2B, 0x22, 0x20, 0x22, 0x5D, 0x3B, 0x69, 0x66, 
+    0x28, 0x6B, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x3F, 0x30, 0x3A, 0x6B, 0x2E, 0x73, 0x6C, 0x69, 0x63, 
+    0x65, 0x28, 0x30, 0x29, 0x3B, 0x68, 0x3D, 0x61, 0x2C, 0x69, 0x3D, 0x5B, 0x5D, 0x2C, 0x6A, 0x3D, 0x64, 0x2E, 0x70, 0x72, 
+    0x65, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x68, 0x29, 0x7B, 0x28, 0x21, 0x63, 
+    0x7C, 0x7C, 0x28, 0x65, 0x3D, 0x53, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x68, 0x29, 0x29, 0x29, 0x26, 0x26, 0x28, 0x65, 
+    0x26, 0x26, 0x28, 0x68, 0x3D, 0x68, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x65, 0x5B, 0x30, 0x5D, 0x2E, 0x6C, 0x65, 
+    0x6E, 0x67, 0x74, 0x68, 0x29, 0x7C, 0x7C, 0x68, 0x29, 0x2C, 0x69, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x66, 0x3D, 0x5B, 
+    0x5D, 0x29, 0x29, 0x2C, 0x63, 0x3D, 0x21, 0x31, 0x2C, 0x28, 0x65, 0x3D, 0x54, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x68, 
+    0x29, 0x29, 0x26, 0x26, 0x28, 0x63, 0x3D, 0x65, 0x2E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x29, 0x2C, 0x66, 0x2E, 0x70, 
+    0x75, 0x73, 0x68, 0x28, 0x7B, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x63, 0x2C, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x65, 0x5B, 
+    0x30, 0x5D, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x52, 0x2C, 0x22, 0x20, 0x22, 0x29, 0x7D, 0x29, 0x2C, 
+    0x68, 0x3D, 0x68, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x63, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x29, 
+    0x3B, 0x66, 0x6F, 0x72, 0x28, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x64, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x29, 0x21, 
+    0x28, 0x65, 0x3D, 0x58, 0x5B, 0x67, 0x5D, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x68, 0x29, 0x29, 0x7C, 0x7C, 0x6A, 0x5B, 
+    0x67, 0x5D, 0x26, 0x26, 0x21, 0x28, 0x65, 0x3D, 0x6A, 0x5B, 0x67, 0x5D, 0x28, 0x65, 0x29, 0x29, 0x7C, 0x7C, 0x28, 0x63, 
+    0x3D, 0x65, 0x2E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x29, 0x2C, 0x66, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x7B, 0x76, 
+    0x61, 0x6C, 0x75, 0x65, 0x3A, 0x63, 0x2C, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x67, 0x2C, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 
+    0x73, 0x3A, 0x65, 0x7D, 0x29, 0x2C, 0x68, 0x3D, 0x68, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x63, 0x2E, 0x6C, 0x65, 
+    0x6E, 0x67, 0x74, 0x68, 0x29, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x21, 0x63, 0x29, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x7D, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x3F, 0x68, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3A, 0x68, 0x3F, 0x66, 
+    0x62, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x61, 0x29, 0x3A, 0x7A, 0x28, 0x61, 0x2C, 0x69, 0x29, 0x2E, 0x73, 0x6C, 
+    0x69, 0x63, 0x65, 0x28, 0x30, 0x29, 0x7D, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x71, 0x62, 0x28, 
+    0x61, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x30, 0x2C, 0x63, 0x3D, 0x61, 0x2E, 0x6C, 
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x64, 0x3D, 0x22, 0x22, 0x3B, 0x63, 0x3E, 0x62, 0x3B, 0x62, 0x2B, 0x2B, 0x29, 0x64, 
+    0x2B, 0x3D, 0x61, 0x5B, 0x62, 0x5D, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x64, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x72, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 
+    0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 0x62, 0x2E, 0x64, 0x69, 0x72, 0x2C, 0x65, 0x3D, 0x63, 0x26, 0x26, 0x22, 0x70, 
+    0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x64, 0x2C, 0x66, 0x3D, 0x78, 0x2B, 0x2B, 
+    0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x3F, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x2C, 0x63, 0x2C, 0x66, 0x29, 0x7B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x62, 0x3D, 
+    0x62, 0x5B, 0x64, 0x5D, 0x29, 0x69, 0x66, 0x28, 0x31, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x7C, 0x7C, 0x65, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x28, 0x62, 0x2C, 0x63, 0x2C, 0x66, 
+    0x29, 0x7D, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x2C, 0x63, 0x2C, 0x67, 0x29, 0x7B, 0x76, 
+    0x61, 0x72, 0x20, 0x68, 0x2C, 0x69, 0x2C, 0x6A, 0x3D, 0x5B, 0x77, 0x2C, 0x66, 0x5D, 0x3B, 0x69, 0x66, 0x28, 0x67, 0x29, 
+    0x7B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x62, 0x3D, 0x62, 0x5B, 0x64, 0x5D, 0x29, 0x69, 0x66, 0x28, 0x28, 0x31, 0x3D, 
+    0x3D, 0x3D, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x65, 0x29, 0x26, 0x26, 0x61, 0x28, 
+    0x62, 0x2C, 0x63, 0x2C, 0x67, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x30, 0x7D, 0x65, 0x6C, 0x73, 0x65, 
+    0x20, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x62, 0x3D, 0x62, 0x5B, 0x64, 0x5D, 0x29, 0x69, 0x66, 0x28, 0x31, 0x3D, 0x3D, 
+    0x3D, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x65, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x69, 
+    0x3D, 0x62, 0x5B, 0x75, 0x5D, 0x7C, 0x7C, 0x28, 0x62, 0x5B, 0x75, 0x5D, 0x3D, 0x7B, 0x7D, 0x29, 0x2C, 0x28, 0x68, 0x3D, 
+    0x69, 0x5B, 0x64, 0x5D, 0x29, 0x26, 0x26, 0x68, 0x5B, 0x30, 0x5D, 0x3D, 0x3D, 0x3D, 0x77, 0x26, 0x26, 0x68, 0x5B, 0x31, 
+    0x5D, 0x3D, 0x3D, 0x3D, 0x66, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6A, 0x5B, 0x32, 0x5D, 0x3D, 0x68, 0x5B, 
+    0x32, 0x5D, 0x3B, 0x69, 0x66, 0x28, 0x69, 0x5B, 0x64, 0x5D, 0x3D, 0x6A, 0x2C, 0x6A, 0x5B, 0x32, 0x5D, 0x3D, 0x61, 0x28, 
+    0x62, 0x2C, 0x63, 0x2C, 0x67, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x30, 0x7D, 0x7D, 0x7D, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x73, 0x62, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3E, 0x31, 0x3F, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x62, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x3D, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x65, 0x2D, 0x2D, 0x29, 0x69, 0x66, 0x28, 0x21, 0x61, 0x5B, 0x65, 0x5D, 
+    0x28, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x31, 0x3B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x21, 0x30, 0x7D, 0x3A, 0x61, 0x5B, 0x30, 0x5D, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x74, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x64, 
+    0x3D, 0x30, 0x2C, 0x65, 0x3D, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x65, 0x3E, 0x64, 0x3B, 0x64, 0x2B, 
+    0x2B, 0x29, 0x66, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x5B, 0x64, 0x5D, 0x2C, 0x63, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x63, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x75, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x2C, 
+    0x63, 0x2C, 0x64, 0x2C, 0x65, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x66, 0x2C, 0x67, 0x3D, 0x5B, 
+    0x5D, 0x2C, 0x68, 0x3D, 0x30, 0x2C, 0x69, 0x3D, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x6A, 0x3D, 0x6E, 
+    0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x62, 0x3B, 0x69, 0x3E, 0x68, 0x3B, 0x68, 0x2B, 0x2B, 0x29, 0x28, 0x66, 0x3D, 0x61, 0x5B, 
+    0x68, 0x5D, 0x29, 0x26, 0x26, 0x28, 0x21, 0x63, 0x7C, 0x7C, 0x63, 0x28, 0x66, 0x2C, 0x64, 0x2C, 0x65, 0x29, 0x29, 0x26, 
+    0x26, 0x28, 0x67, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x66, 0x29, 0x2C, 0x6A, 0x26, 0x26, 0x62, 0x2E, 0x70, 0x75, 0x73, 
+    0x68, 0x28, 0x68, 0x29, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x67, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x76, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x26, 0x26, 0x21, 0x64, 0x5B, 0x75, 0x5D, 0x26, 0x26, 0x28, 0x64, 0x3D, 
+    0x76, 0x62, 0x28, 0x64, 0x29, 0x29, 0x2C, 0x65, 0x26, 0x26, 0x21, 0x65, 0x5B, 0x75, 0x5D, 0x26, 0x26, 0x28, 0x65, 0x3D, 
+    0x76, 0x62, 0x28, 0x65, 0x2C, 0x66, 0x29, 0x29, 0x2C, 0x68, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x2C, 0x69, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x6A, 0x2C, 0x6B, 0x2C, 0x6C, 0x2C, 
+    0x6D, 0x3D, 0x5B, 0x5D, 0x2C, 0x6E, 0x3D, 0x5B, 0x5D, 0x2C, 0x6F, 0x3D, 0x67, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 
+    0x2C, 0x70, 0x3D, 0x66, 0x7C, 0x7C, 0x74, 0x62, 0x28, 0x62, 0x7C, 0x7C, 0x22, 0x2A, 0x22, 0x2C, 0x68, 0x2E, 0x6E, 0x6F, 
+    0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3F, 0x5B, 0x68, 0x5D, 0x3A, 0x68, 0x2C, 0x5B, 0x5D, 0x29, 0x2C, 0x71, 0x3D, 0x21, 
+    0x61, 0x7C, 0x7C, 0x21, 0x66, 0x26, 0x26, 0x62, 0x3F, 0x70, 0x3A, 0x75, 0x62, 0x28, 0x70, 0x2C, 0x6D, 0x2C, 0x61, 0x2C, 
+    0x68, 0x2C, 0x69, 0x29, 0x2C, 0x72, 0x3D, 0x63, 0x3F, 0x65, 0x7C, 0x7C, 0x28, 0x66, 0x3F, 0x61, 0x3A, 0x6F, 0x7C, 0x7C, 
+    0x64, 0x29, 0x3F, 0x5B, 0x5D, 0x3A, 0x67, 0x3A, 0x71, 0x3B, 0x69, 0x66, 0x28, 0x63, 0x26, 0x26, 0x63, 0x28, 0x71, 0x2C, 
+    0x72, 0x2C, 0x68, 0x2C, 0x69, 0x29, 0x2C, 0x64, 0x29, 0x7B, 0x6A, 0x3D, 0x75, 0x62, 0x28, 0x72, 0x2C, 0x6E, 0x29, 0x2C, 
+    0x64, 0x28, 0x6A, 0x2C, 0x5B, 0x5D, 0x2C, 0x68, 0x2C, 0x69, 0x29, 0x2C, 0x6B, 0x3D, 0x6A, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 
+    0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x6B, 0x2D, 0x2D, 0x29, 0x28, 0x6C, 0x3D, 0x6A, 0x5B, 0x6B, 0x5D, 
+    0x29, 0x26, 0x26, 0x28, 0x72, 0x5B, 0x6E, 0x5B, 0x6B, 0x5D, 0x5D, 0x3D, 0x21, 0x28, 0x71, 0x5B, 0x6E, 0x5B, 0x6B, 0x5D, 
+    0x5D, 0x3D, 0x6C, 0x29, 0x29, 0x7D, 0x69, 0x66, 0x28, 0x66, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x65, 0x7C, 0x7C, 0x61, 0x29, 
+    0x7B, 0x69, 0x66, 0x28, 0x65, 0x29, 0x7B, 0x6A, 0x3D, 0x5B, 0x5D, 0x2C, 0x6B, 0x3D, 0x72, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 
+    0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x6B, 0x2D, 0x2D, 0x29, 0x28, 0x6C, 0x3D, 0x72, 0x5B, 0x6B, 0x5D, 
+    0x29, 0x26, 0x26, 0x6A, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x71, 0x5B, 0x6B, 0x5D, 0x3D, 0x6C, 0x29, 0x3B, 0x65, 0x28, 
+    0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x72, 0x3D, 0x5B, 0x5D, 0x2C, 0x6A, 0x2C, 0x69, 0x29, 0x7D, 0x6B, 0x3D, 0x72, 0x2E, 0x6C, 
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x6B, 0x2D, 0x2D, 0x29, 0x28, 0x6C, 0x3D, 0x72, 
+    0x5B, 0x6B, 0x5D, 0x29, 0x26, 0x26, 0x28, 0x6A, 0x3D, 0x65, 0x3F, 0x4B, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x66, 0x2C, 
+    0x6C, 0x29, 0x3A, 0x6D, 0x5B, 0x6B, 0x5D, 0x29, 0x3E, 0x2D, 0x31, 0x26, 0x26, 0x28, 0x66, 0x5B, 0x6A, 0x5D, 0x3D, 0x21, 
+    0x28, 0x67, 0x5B, 0x6A, 0x5D, 0x3D, 0x6C, 0x29, 0x29, 0x7D, 0x7D, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x72, 0x3D, 0x75, 0x62, 
+    0x28, 0x72, 0x3D, 0x3D, 0x3D, 0x67, 0x3F, 0x72, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x6F, 0x2C, 0x72, 0x2E, 
+    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x3A, 0x72, 0x29, 0x2C, 0x65, 0x3F, 0x65, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 
+    0x67, 0x2C, 0x72, 0x2C, 0x69, 0x29, 0x3A, 0x49, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x67, 0x2C, 0x72, 0x29, 0x7D, 
+    0x29, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x62, 0x28, 0x61, 0x29, 0x7B, 0x66, 0x6F, 0x72, 
+    0x28, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x2C, 0x65, 0x2C, 0x66, 0x3D, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x2C, 0x67, 0x3D, 0x64, 0x2E, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5B, 0x61, 0x5B, 0x30, 0x5D, 0x2E, 
+    0x74, 0x79, 0x70, 0x65, 0x5D, 0x2C, 0x68, 0x3D, 0x67, 0x7C, 0x7C, 0x64, 0x2E, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 
+    0x65, 0x5B, 0x22, 0x20, 0x22, 0x5D, 0x2C, 0x69, 0x3D, 0x67, 0x3F, 0x31, 0x3A, 0x30, 0x2C, 0x6B, 0x3D, 0x72, 0x62, 0x28, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 
+    0x3D, 0x3D, 0x3D, 0x62, 0x7D, 0x2C, 0x68, 0x2C, 0x21, 0x30, 0x29, 0x2C, 0x6C, 0x3D, 0x72, 0x62, 0x28, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x4B, 0x2E, 0x63, 0x61, 
+    0x6C, 0x6C, 0x28, 0x62, 0x2C, 0x61, 0x29, 0x3E, 0x2D, 0x31, 0x7D, 0x2C, 0x68, 0x2C, 0x21, 0x30, 0x29, 0x2C, 0x6D, 0x3D, 
+    0x5B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x21, 0x67, 0x26, 0x26, 0x28, 0x64, 0x7C, 0x7C, 0x63, 0x21, 0x3D, 0x3D, 0x6A, 0x29, 0x7C, 0x7C, 0x28, 
+    0x28, 0x62, 0x3D, 0x63, 0x29, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3F, 0x6B, 0x28, 0x61, 0x2C, 0x63, 
+    0x2C, 0x64, 0x29, 0x3A, 0x6C, 0x28, 0x61, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x29, 0x7D, 0x5D, 0x3B, 0x66, 0x3E, 0x69, 0x3B, 
+    0x69, 0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x63, 0x3D, 0x64, 0x2E, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5B, 
+    0x61, 0x5B, 0x69, 0x5D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x5D, 0x29, 0x6D, 0x3D, 0x5B, 0x72, 0x62, 0x28, 0x73, 0x62, 0x28, 
+    0x6D, 0x29, 0x2C, 0x63, 0x29, 0x5D, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x7B, 0x69, 0x66, 0x28, 0x63, 0x3D, 0x64, 0x2E, 0x66, 
+    0x69, 0x6C, 0x74, 0x65, 0x72, 0x5B, 0x61, 0x5B, 0x69, 0x5D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x5D, 0x2E, 0x61, 0x70, 0x70, 
+    0x6C, 0x79, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x61, 0x5B, 0x69, 0x5D, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 
+    0x29, 0x2C, 0x63, 0x5B, 0x75, 0x5D, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x65, 0x3D, 0x2B, 0x2B, 0x69, 0x3B, 0x66, 0x3E, 
+    0x65, 0x3B, 0x65, 0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x64, 0x2E, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5B, 
+    0x61, 0x5B, 0x65, 0x5D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x5D, 0x29, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x3B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x76, 0x62, 0x28, 0x69, 0x3E, 0x31, 0x26, 0x26, 0x73, 0x62, 0x28, 0x6D, 0x29, 0x2C, 0x69, 0x3E, 
+    0x31, 0x26, 0x26, 0x71, 0x62, 0x28, 0x61, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x30, 0x2C, 0x69, 0x2D, 0x31, 0x29, 
+    0x2E, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x28, 0x7B, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x22, 0x20, 0x22, 0x3D, 0x3D, 
+    0x3D, 0x61, 0x5B, 0x69, 0x2D, 0x32, 0x5D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x3F, 0x22, 0x2A, 0x22, 0x3A, 0x22, 0x22, 0x7D, 
+    0x29, 0x29, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x52, 0x2C, 0x22, 0x24, 0x31, 0x22, 0x29, 0x2C, 0x63, 
+    0x2C, 0x65, 0x3E, 0x69, 0x26, 0x26, 0x77, 0x62, 0x28, 0x61, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x69, 0x2C, 0x65, 
+    0x29, 0x29, 0x2C, 0x66, 0x3E, 0x65, 0x26, 0x26, 0x77, 0x62, 0x28, 0x61, 0x3D, 0x61, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 
+    0x28, 0x65, 0x29, 0x29, 0x2C, 0x66, 0x3E, 0x65, 0x26, 0x26, 0x71, 0x62, 0x28, 0x61, 0x29, 0x29, 0x7D, 0x6D, 0x2E, 0x70, 
+    0x75, 0x73, 0x68, 0x28, 0x63, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x62, 0x28, 0x6D, 0x29, 0x7D, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x78, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 
+    0x20, 0x63, 0x3D, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3E, 0x30, 0x2C, 0x65, 0x3D, 0x61, 0x2E, 0x6C, 0x65, 
+    0x6E, 0x67, 0x74, 0x68, 0x3E, 0x30, 0x2C, 0x66, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x66, 0x2C, 
+    0x67, 0x2C, 0x68, 0x2C, 0x69, 0x2C, 0x6B, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x6C, 0x2C, 0x6D, 0x2C, 0x6F, 0x2C, 0x70, 
+    0x3D, 0x30, 0x2C, 0x71, 0x3D, 0x22, 0x30, 0x22, 0x2C, 0x72, 0x3D, 0x66, 0x26, 0x26, 0x5B, 0x5D, 0x2C, 0x73, 0x3D, 0x5B, 
+    0x5D, 0x2C, 0x74, 0x3D, 0x6A, 0x2C, 0x75, 0x3D, 0x66, 0x7C, 0x7C, 0x65, 0x26, 0x26, 0x64, 0x2E, 0x66, 0x69, 0x6E, 0x64, 
+    0x2E, 0x54, 0x41, 0x47, 0x28, 0x22, 0x2A, 0x22, 0x2C, 0x6B, 0x29, 0x2C, 0x76, 0x3D, 0x77, 0x2B, 0x3D, 0x6E, 0x75, 0x6C, 
+    0x6C, 0x3D, 0x3D, 0x74, 0x3F, 0x31, 0x3A, 0x4D, 0x61, 0x74, 0x68, 0x2E, 0x72, 0x61, 0x6E, 0x64, 0x6F, 0x6D, 0x28, 0x29, 
+    0x7C, 0x7C, 0x2E, 0x31, 0x2C, 0x78, 0x3D, 0x75, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x66, 0x6F, 0x72, 0x28, 
+    0x6B, 0x26, 0x26, 0x28, 0x6A, 0x3D, 0x67, 0x21, 0x3D, 0x3D, 0x6E, 0x26, 0x26, 0x67, 0x29, 0x3B, 0x71, 0x21, 0x3D, 0x3D, 
+    0x78, 0x26, 0x26, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x28, 0x6C, 0x3D, 0x75, 0x5B, 0x71, 0x5D, 0x29, 0x3B, 0x71, 0x2B, 
+    0x2B, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x65, 0x26, 0x26, 0x6C, 0x29, 0x7B, 0x6D, 0x3D, 0x30, 0x3B, 0x77, 0x68, 0x69, 0x6C, 
+    0x65, 0x28, 0x6F, 0x3D, 0x61, 0x5B, 0x6D, 0x2B, 0x2B, 0x5D, 0x29, 0x69, 0x66, 0x28, 0x6F, 0x28, 0x6C, 0x2C, 0x67, 0x2C, 
+    0x68, 0x29, 0x29, 0x7B, 0x69, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x6C, 0x29, 0x3B, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x7D, 
+    0x6B, 0x26, 0x26, 0x28, 0x77, 0x3D, 0x76, 0x29, 0x7D, 0x63, 0x26, 0x26, 0x28, 0x28, 0x6C, 0x3D, 0x21, 0x6F, 0x26, 0x26, 
+    0x6C, 0x29, 0x26, 0x26, 0x70, 0x2D, 0x2D, 0x2C, 0x66, 0x26, 0x26, 0x72, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x6C, 0x29, 
+    0x29, 0x7D, 0x69, 0x66, 0x28, 0x70, 0x2B, 0x3D, 0x71, 0x2C, 0x63, 0x26, 0x26, 0x71, 0x21, 0x3D, 0x3D, 0x70, 0x29, 0x7B, 
+    0x6D, 0x3D, 0x30, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x6F, 0x3D, 0x62, 0x5B, 0x6D, 0x2B, 0x2B, 0x5D, 0x29, 0x6F, 
+    0x28, 0x72, 0x2C, 0x73, 0x2C, 0x67, 0x2C, 0x68, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x66, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x70, 
+    0x3E, 0x30, 0x29, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x71, 0x2D, 0x2D, 0x29, 0x72, 0x5B, 0x71, 0x5D, 0x7C, 0x7C, 0x73, 
+    0x5B, 0x71, 0x5D, 0x7C, 0x7C, 0x28, 0x73, 0x5B, 0x71, 0x5D, 0x3D, 0x47, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x69, 0x29, 
+    0x29, 0x3B, 0x73, 0x3D, 0x75, 0x62, 0x28, 0x73, 0x29, 0x7D, 0x49, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x69, 0x2C, 
+    0x73, 0x29, 0x2C, 0x6B, 0x26, 0x26, 0x21, 0x66, 0x26, 0x26, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3E, 0x30, 
+    0x26, 0x26, 0x70, 0x2B, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3E, 0x31, 0x26, 0x26, 0x66, 0x62, 0x2E, 0x75, 
+    0x6E, 0x69, 0x71, 0x75, 0x65, 0x53, 0x6F, 0x72, 0x74, 0x28, 0x69, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x6B, 0x26, 0x26, 0x28, 0x77, 0x3D, 0x76, 0x2C, 0x6A, 0x3D, 0x74, 0x29, 0x2C, 0x72, 0x7D, 0x3B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x63, 0x3F, 0x68, 0x62, 0x28, 0x66, 0x29, 0x3A, 0x66, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x68, 0x3D, 0x66, 0x62, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x69, 0x6C, 0x65, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x3D, 0x5B, 0x5D, 0x2C, 0x65, 0x3D, 
+    0x5B, 0x5D, 0x2C, 0x66, 0x3D, 0x41, 0x5B, 0x61, 0x2B, 0x22, 0x20, 0x22, 0x5D, 0x3B, 0x69, 0x66, 0x28, 0x21, 0x66, 0x29, 
+    0x7B, 0x62, 0x7C, 0x7C, 0x28, 0x62, 0x3D, 0x67, 0x28, 0x61, 0x29, 0x29, 0x2C, 0x63, 0x3D, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 
+    0x67, 0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x63, 0x2D, 0x2D, 0x29, 0x66, 0x3D, 0x77, 0x62, 0x28, 0x62, 
+    0x5B, 0x63, 0x5D, 0x29, 0x2C, 0x66, 0x5B, 0x75, 0x5D, 0x3F, 0x64, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x66, 0x29, 0x3A, 
+    0x65, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x66, 0x29, 0x3B, 0x66, 0x3D, 0x41, 0x28, 0x61, 0x2C, 0x78, 0x62, 0x28, 0x65, 
+    0x2C, 0x64, 0x29, 0x29, 0x2C, 0x66, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x3D, 0x61, 0x7D, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x7D, 0x2C, 0x69, 0x3D, 0x66, 0x62, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3D, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x65, 0x2C, 0x66, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x69, 0x2C, 0x6A, 0x2C, 0x6B, 0x2C, 0x6C, 0x2C, 0x6D, 0x2C, 0x6E, 0x3D, 0x22, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x26, 0x26, 0x61, 0x2C, 0x6F, 0x3D, 
+    0x21, 0x66, 0x26, 0x26, 0x67, 0x28, 0x61, 0x3D, 0x6E, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x7C, 0x7C, 
+    0x61, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x65, 0x3D, 0x65, 0x7C, 0x7C, 0x5B, 0x5D, 0x2C, 0x31, 0x3D, 0x3D, 0x3D, 0x6F, 0x2E, 
+    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x6A, 0x3D, 0x6F, 0x5B, 0x30, 0x5D, 0x3D, 0x6F, 0x5B, 
+    0x30, 0x5D, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x30, 0x29, 0x2C, 0x6A, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 
+    0x3E, 0x32, 0x26, 0x26, 0x22, 0x49, 0x44, 0x22, 0x3D, 0x3D, 0x3D, 0x28, 0x6B, 0x3D, 0x6A, 0x5B, 0x30, 0x5D, 0x29, 0x2E, 
+    0x74, 0x79, 0x70, 0x65, 0x26, 0x26, 0x63, 0x2E, 0x67, 0x65, 0x74, 0x42, 0x79, 0x49, 0x64, 0x26, 0x26, 0x39, 0x3D, 0x3D, 
+    0x3D, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x70, 0x26, 0x26, 0x64, 0x2E, 0x72, 0x65, 
+    0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5B, 0x6A, 0x5B, 0x31, 0x5D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x5D, 0x29, 0x7B, 0x69, 
+    0x66, 0x28, 0x62, 0x3D, 0x28, 0x64, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x2E, 0x49, 0x44, 0x28, 0x6B, 0x2E, 0x6D, 0x61, 0x74, 
+    0x63, 0x68, 0x65, 0x73, 0x5B, 0x30, 0x5D, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x63, 0x62, 0x2C, 0x64, 
+    0x62, 0x29, 0x2C, 0x62, 0x29, 0x7C, 0x7C, 0x5B, 0x5D, 0x29, 0x5B, 0x30, 0x5D, 0x2C, 0x21, 0x62, 0x29, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x65, 0x3B, 0x6E, 0x26, 0x26, 0x28, 0x62, 0x3D, 0x62, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 
+    0x4E, 0x6F, 0x64, 0x65, 0x29, 0x2C, 0x61, 0x3D, 0x61, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x6A, 0x2E, 0x73, 0x68, 
+    0x69, 0x66, 0x74, 0x28, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x7D, 
+    0x69, 0x3D, 0x58, 0x2E, 0x6E, 0x65, 0x65, 0x64, 0x73, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x2E, 0x74, 0x65, 0x73, 
+    0x74, 0x28, 0x61, 0x29, 0x3F, 0x30, 0x3A, 0x6A, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 
+    0x65, 0x28, 0x69, 0x2D, 0x2D, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x6B, 0x3D, 0x6A, 0x5B, 0x69, 0x5D, 0x2C, 0x64, 0x2E, 0x72, 
+    0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x5B, 0x6C, 0x3D, 0x6B, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x5D, 0x29, 0x62, 0x72, 
+    0x65, 0x61, 0x6B, 0x3B, 0x69, 0x66, 0x28, 0x28, 0x6D, 0x3D, 0x64, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x5B, 0x6C, 0x5D, 0x29, 
+    0x26, 0x26, 0x28, 0x66, 0x3D, 0x6D, 0x28, 0x6B, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x5B, 0x30, 0x5D, 0x2E, 
+    0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x63, 0x62, 0x2C, 0x64, 0x62, 0x29, 0x2C, 0x61, 0x62, 0x2E, 0x74, 0x65, 
+    0x73, 0x74, 0x28, 0x6A, 0x5B, 0x30, 0x5D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x29, 0x26, 0x26, 0x6F, 0x62, 0x28, 0x62, 0x2E, 
+    0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x29, 0x7C, 0x7C, 0x62, 0x29, 0x29, 0x29, 0x7B, 0x69, 0x66, 
+    0x28, 0x6A, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x69, 0x2C, 0x31, 0x29, 0x2C, 0x61, 0x3D, 0x66, 0x2E, 0x6C, 
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x71, 0x62, 0x28, 0x6A, 0x29, 0x2C, 0x21, 0x61, 0x29, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x49, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x65, 0x2C, 0x66, 0x29, 0x2C, 0x65, 0x3B, 0x62, 0x72, 
+    0x65, 0x61, 0x6B, 0x7D, 0x7D, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x28, 0x6E, 0x7C, 0x7C, 0x68, 0x28, 0x61, 0x2C, 
+    0x6F, 0x29, 0x29, 0x28, 0x66, 0x2C, 0x62, 0x2C, 0x21, 0x70, 0x2C, 0x65, 0x2C, 0x61, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 
+    0x28, 0x61, 0x29, 0x26, 0x26, 0x6F, 0x62, 0x28, 0x62, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 
+    0x29, 0x7C, 0x7C, 0x62, 0x29, 0x2C, 0x65, 0x7D, 0x2C, 0x63, 0x2E, 0x73, 0x6F, 0x72, 0x74, 0x53, 0x74, 0x61, 0x62, 0x6C, 
+    0x65, 0x3D, 0x75, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x28, 0x22, 0x22, 0x29, 0x2E, 0x73, 0x6F, 0x72, 0x74, 0x28, 0x42, 
+    0x29, 0x2E, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x22, 0x22, 0x29, 0x3D, 0x3D, 0x3D, 0x75, 0x2C, 0x63, 0x2E, 0x64, 0x65, 0x74, 
+    0x65, 0x63, 0x74, 0x44, 0x75, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x65, 0x73, 0x3D, 0x21, 0x21, 0x6C, 0x2C, 0x6D, 0x28, 
+    0x29, 0x2C, 0x63, 0x2E, 0x73, 0x6F, 0x72, 0x74, 0x44, 0x65, 0x74, 0x61, 0x63, 0x68, 0x65, 0x64, 0x3D, 0x69, 0x62, 0x28, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 
+    0x26, 0x61, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x61, 0x72, 0x65, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x50, 0x6F, 
+    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6E, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 
+    0x6E, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x29, 0x7D, 0x29, 0x2C, 0x69, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x69, 0x6E, 0x6E, 
+    0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x22, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x27, 0x23, 0x27, 0x3E, 
+    0x3C, 0x2F, 0x61, 0x3E, 0x22, 0x2C, 0x22, 0x23, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 
+    0x68, 0x69, 0x6C, 0x64, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x68, 
+    0x72, 0x65, 0x66, 0x22, 0x29, 0x7D, 0x29, 0x7C, 0x7C, 0x6A, 0x62, 0x28, 0x22, 0x74, 0x79, 0x70, 0x65, 0x7C, 0x68, 0x72, 
+    0x65, 0x66, 0x7C, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x7C, 0x77, 0x69, 0x64, 0x74, 0x68, 0x22, 0x2C, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x63, 0x3F, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3A, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 
+    0x75, 0x74, 0x65, 0x28, 0x62, 0x2C, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x74, 0x6F, 0x4C, 
+    0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x3F, 0x31, 0x3A, 0x32, 0x29, 0x7D, 0x29, 0x2C, 0x63, 0x2E, 
+    0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x26, 0x26, 0x69, 0x62, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 
+    0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x22, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x2F, 0x3E, 0x22, 0x2C, 0x61, 0x2E, 0x66, 
+    0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 
+    0x74, 0x65, 0x28, 0x22, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x2C, 0x22, 0x22, 0x29, 0x2C, 0x22, 0x22, 0x3D, 0x3D, 0x3D, 
+    0x61, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 
+    0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x29, 0x7D, 0x29, 0x7C, 0x7C, 0x6A, 0x62, 
+    0x28, 0x22, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 
+    0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x7C, 0x7C, 0x22, 0x69, 0x6E, 0x70, 0x75, 
+    0x74, 0x22, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 
+    0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x3F, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3A, 0x61, 0x2E, 0x64, 
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x7D, 0x29, 0x2C, 0x69, 0x62, 0x28, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 
+    0x3D, 0x3D, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x64, 0x69, 
+    0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x29, 0x7D, 0x29, 0x7C, 0x7C, 0x6A, 0x62, 0x28, 0x4C, 0x2C, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x3F, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3A, 0x61, 0x5B, 0x62, 0x5D, 0x3D, 
+    0x3D, 0x3D, 0x21, 0x30, 0x3F, 0x62, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 
+    0x3A, 0x28, 0x64, 0x3D, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x4E, 0x6F, 
+    0x64, 0x65, 0x28, 0x62, 0x29, 0x29, 0x26, 0x26, 0x64, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 0x65, 0x64, 0x3F, 
+    0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x6E, 0x75, 0x6C, 0x6C, 0x7D, 0x29, 0x2C, 0x66, 0x62, 0x7D, 0x28, 0x61, 
+    0x29, 0x3B, 0x6D, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x3D, 0x73, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x72, 0x3D, 0x73, 0x2E, 
+    0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x73, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x72, 0x5B, 0x22, 0x3A, 0x22, 
+    0x5D, 0x3D, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x72, 0x2E, 0x70, 0x73, 0x65, 0x75, 0x64, 0x6F, 0x73, 0x2C, 0x6D, 0x2E, 0x75, 
+    0x6E, 0x69, 0x71, 0x75, 0x65, 0x3D, 0x73, 0x2E, 0x75, 0x6E, 0x69, 0x71, 0x75, 0x65, 0x53, 0x6F, 0x72, 0x74, 0x2C, 0x6D, 
+    0x2E, 0x74, 0x65, 0x78, 0x74, 0x3D, 0x73, 0x2E, 0x67, 0x65, 0x74, 0x54, 0x65, 0x78, 0x74, 0x2C, 0x6D, 0x2E, 0x69, 0x73, 
+    0x58, 0x4D, 0x4C, 0x44, 0x6F, 0x63, 0x3D, 0x73, 0x2E, 0x69, 0x73, 0x58, 0x4D, 0x4C, 0x2C, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 
+    0x74, 0x61, 0x69, 0x6E, 0x73, 0x3D, 0x73, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x3B, 0x76, 0x61, 0x72, 
+    0x20, 0x74, 0x3D, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x72, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x2E, 0x6E, 0x65, 0x65, 0x64, 
+    0x73, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x2C, 0x75, 0x3D, 0x2F, 0x5E, 0x3C, 0x28, 0x5C, 0x77, 0x2B, 0x29, 0x5C, 
+    0x73, 0x2A, 0x5C, 0x2F, 0x3F, 0x3E, 0x28, 0x3F, 0x3A, 0x3C, 0x5C, 0x2F, 0x5C, 0x31, 0x3E, 0x7C, 0x29, 0x24, 0x2F, 0x2C, 
+    0x76, 0x3D, 0x2F, 0x5E, 0x2E, 0x5B, 0x5E, 0x3A, 0x23, 0x5C, 0x5B, 0x5C, 0x2E, 0x2C, 0x5D, 0x2A, 0x24, 0x2F, 0x3B, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x69, 0x66, 0x28, 
+    0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x67, 0x72, 0x65, 0x70, 0x28, 0x61, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x2C, 0x64, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x21, 0x62, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 
+    0x28, 0x61, 0x2C, 0x64, 0x2C, 0x61, 0x29, 0x21, 0x3D, 0x3D, 0x63, 0x7D, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x62, 0x2E, 0x6E, 
+    0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x67, 0x72, 0x65, 
+    0x70, 0x28, 0x61, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x61, 0x3D, 0x3D, 0x3D, 0x62, 0x21, 0x3D, 0x3D, 0x63, 0x7D, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x22, 0x73, 
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x29, 0x7B, 0x69, 0x66, 
+    0x28, 0x76, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x62, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 
+    0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x62, 0x2C, 0x61, 0x2C, 0x63, 0x29, 0x3B, 0x62, 0x3D, 0x6D, 0x2E, 0x66, 0x69, 
+    0x6C, 0x74, 0x65, 0x72, 0x28, 0x62, 0x2C, 0x61, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x67, 
+    0x72, 0x65, 0x70, 0x28, 0x61, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x69, 0x6E, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x3E, 
+    0x3D, 0x30, 0x21, 0x3D, 0x3D, 0x63, 0x7D, 0x29, 0x7D, 0x6D, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3D, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 
+    0x62, 0x5B, 0x30, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x26, 0x26, 0x28, 0x61, 0x3D, 0x22, 0x3A, 
+    0x6E, 0x6F, 0x74, 0x28, 0x22, 0x2B, 0x61, 0x2B, 0x22, 0x29, 0x22, 0x29, 0x2C, 0x31, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x6C, 
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x31, 0x3D, 0x3D, 0x3D, 0x64, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 
+    0x65, 0x3F, 0x6D, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x53, 0x65, 0x6C, 0x65, 
+    0x63, 0x74, 0x6F, 0x72, 0x28, 0x64, 0x2C, 0x61, 0x29, 0x3F, 0x5B, 0x64, 0x5D, 0x3A, 0x5B, 0x5D, 0x3A, 0x6D, 0x2E, 0x66, 
+    0x69, 0x6E, 0x64, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x65, 0x73, 0x28, 0x61, 0x2C, 0x6D, 0x2E, 0x67, 0x72, 0x65, 0x70, 
+    0x28, 0x62, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x31, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x7D, 0x29, 0x29, 0x7D, 
+    0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x66, 0x69, 0x6E, 0x64, 0x3A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x3D, 0x5B, 
+    0x5D, 0x2C, 0x64, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x65, 0x3D, 0x64, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 
+    0x69, 0x66, 0x28, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 
+    0x61, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x53, 0x74, 
+    0x61, 0x63, 0x6B, 0x28, 0x6D, 0x28, 0x61, 0x29, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x62, 0x3D, 0x30, 0x3B, 0x65, 0x3E, 0x62, 0x3B, 0x62, 
+    0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x28, 0x64, 0x5B, 0x62, 
+    0x5D, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x30, 0x7D, 0x29, 0x29, 0x3B, 
+    0x66, 0x6F, 0x72, 0x28, 0x62, 0x3D, 0x30, 0x3B, 0x65, 0x3E, 0x62, 0x3B, 0x62, 0x2B, 0x2B, 0x29, 0x6D, 0x2E, 0x66, 0x69, 
+    0x6E, 0x64, 0x28, 0x61, 0x2C, 0x64, 0x5B, 0x62, 0x5D, 0x2C, 0x63, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x63, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x28, 0x65, 0x3E, 0x31, 
+    0x3F, 0x6D, 0x2E, 0x75, 0x6E, 0x69, 0x71, 0x75, 0x65, 0x28, 0x63, 0x29, 0x3A, 0x63, 0x29, 0x2C, 0x63, 0x2E, 0x73, 0x65, 
+    0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 
+    0x3F, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x2B, 0x22, 0x20, 0x22, 0x2B, 0x61, 
+    0x3A, 0x61, 0x2C, 0x63, 0x7D, 0x2C, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x75, 0x73, 
+    0x68, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x28, 0x77, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x7C, 0x7C, 0x5B, 0x5D, 0x2C, 
+    0x21, 0x31, 0x29, 0x29, 0x7D, 0x2C, 0x6E, 0x6F, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x53, 0x74, 
+    0x61, 0x63, 0x6B, 0x28, 0x77, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x7C, 0x7C, 0x5B, 0x5D, 0x2C, 0x21, 0x30, 0x29, 
+    0x29, 0x7D, 0x2C, 0x69, 0x73, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x21, 0x21, 0x77, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 
+    0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x26, 0x26, 0x74, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 
+    0x61, 0x29, 0x3F, 0x6D, 0x28, 0x61, 0x29, 0x3A, 0x61, 0x7C, 0x7C, 0x5B, 0x5D, 0x2C, 0x21, 0x31, 0x29, 0x2E, 0x6C, 0x65, 
+    0x6E, 0x67, 0x74, 0x68, 0x7D, 0x7D, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x78, 0x2C, 0x79, 0x3D, 0x61, 0x2E, 0x64, 0x6F, 
+    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x7A, 0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 0x5C, 0x73, 0x2A, 0x28, 0x3C, 0x5B, 
+    0x5C, 0x77, 0x5C, 0x57, 0x5D, 0x2B, 0x3E, 0x29, 0x5B, 0x5E, 0x3E, 0x5D, 0x2A, 0x7C, 0x23, 0x28, 0x5B, 0x5C, 0x77, 0x2D, 
+    0x5D, 0x2A, 0x29, 0x29, 0x24, 0x2F, 0x2C, 0x41, 0x3D, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x69, 0x6E, 0x69, 0x74, 0x3D, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 
+    0x3B, 0x69, 0x66, 0x28, 0x21, 0x61, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x3B, 0x69, 
+    0x66, 0x28, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 
+    0x29, 0x7B, 0x69, 0x66, 0x28, 0x63, 0x3D, 0x22, 0x3C, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x63, 0x68, 0x61, 0x72, 0x41, 
+    0x74, 0x28, 0x30, 0x29, 0x26, 0x26, 0x22, 0x3E, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x63, 0x68, 0x61, 0x72, 0x41, 0x74, 
+    0x28, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2D, 0x31, 0x29, 0x26, 0x26, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 
+    0x74, 0x68, 0x3E, 0x3D, 0x33, 0x3F, 0x5B, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x61, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x5D, 0x3A, 
+    0x7A, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x61, 0x29, 0x2C, 0x21, 0x63, 0x7C, 0x7C, 0x21, 0x63, 0x5B, 0x31, 0x5D, 0x26, 
+    0x26, 0x62, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x62, 0x7C, 0x7C, 0x62, 0x2E, 0x6A, 0x71, 0x75, 0x65, 0x72, 
+    0x79, 0x3F, 0x28, 0x62, 0x7C, 0x7C, 0x78, 0x29, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x28, 0x61, 0x29, 0x3A, 0x74, 0x68, 0x69, 
+    0x73, 0x2E, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 0x74, 0x6F, 0x72, 0x28, 0x62, 0x29, 0x2E, 0x66, 0x69, 0x6E, 
+    0x64, 0x28, 0x61, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x63, 0x5B, 0x31, 0x5D, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x62, 0x3D, 0x62, 
+    0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x6F, 0x66, 0x20, 0x6D, 0x3F, 0x62, 0x5B, 0x30, 0x5D, 0x3A, 0x62, 
+    0x2C, 0x6D, 0x2E, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x6D, 0x2E, 0x70, 0x61, 0x72, 0x73, 
+    0x65, 0x48, 0x54, 0x4D, 0x4C, 0x28, 0x63, 0x5B, 0x31, 0x5D, 0x2C, 0x62, 0x26, 0x26, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 
+    0x54, 0x79, 0x70, 0x65, 0x3F, 0x62, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 
+    0x7C, 0x7C, 0x62, 0x3A, 0x79, 0x2C, 0x21, 0x30, 0x29, 0x29, 0x2C, 0x75, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x63, 0x5B, 
+    0x31, 0x5D, 0x29, 0x26, 0x26, 0x6D, 0x2E, 0x69, 0x73, 0x50, 0x6C, 0x61, 0x69, 0x6E, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x28, 0x62, 0x29, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x63, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x29, 0x6D, 0x2E, 0x69, 0x73, 0x46, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x63, 0x5D, 0x29, 0x3F, 0x74, 0x68, 0x69, 
+    0x73, 0x5B, 0x63, 0x5D, 0x28, 0x62, 0x5B, 0x63, 0x5D, 0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x61, 0x74, 0x74, 0x72, 
+    0x28, 0x63, 0x2C, 0x62, 0x5B, 0x63, 0x5D, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x7D, 0x69, 0x66, 0x28, 0x64, 0x3D, 0x79, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x42, 0x79, 
+    0x49, 0x64, 0x28, 0x63, 0x5B, 0x32, 0x5D, 0x29, 0x2C, 0x64, 0x26, 0x26, 0x64, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 
+    0x4E, 0x6F, 0x64, 0x65, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x64, 0x2E, 0x69, 0x64, 0x21, 0x3D, 0x3D, 0x63, 0x5B, 0x32, 0x5D, 
+    0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x78, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x28, 0x61, 0x29, 0x3B, 0x74, 0x68, 
+    0x69, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3D, 0x31, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x3D, 
+    0x64, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 
+    0x74, 0x3D, 0x79, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x3D, 0x61, 0x2C, 
+    0x74, 0x68, 0x69, 0x73, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x3F, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x3D, 0x74, 0x68, 0x69, 
+    0x73, 0x5B, 0x30, 0x5D, 0x3D, 0x61, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3D, 0x31, 
+    0x2C, 0x74, 0x68, 0x69, 0x73, 0x29, 0x3A, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x3F, 0x22, 0x75, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 
+    0x6F, 0x66, 0x20, 0x78, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x3F, 0x78, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x28, 0x61, 
+    0x29, 0x3A, 0x61, 0x28, 0x6D, 0x29, 0x3A, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x73, 
+    0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x26, 0x26, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 
+    0x74, 0x6F, 0x72, 0x3D, 0x61, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x3D, 0x61, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x29, 0x2C, 0x6D, 
+    0x2E, 0x6D, 0x61, 0x6B, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x61, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x29, 0x29, 0x7D, 
+    0x3B, 0x41, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x6D, 0x2E, 0x66, 0x6E, 0x2C, 0x78, 0x3D, 
+    0x6D, 0x28, 0x79, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x42, 0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 0x70, 0x61, 0x72, 0x65, 
+    0x6E, 0x74, 0x73, 0x7C, 0x70, 0x72, 0x65, 0x76, 0x28, 0x3F, 0x3A, 0x55, 0x6E, 0x74, 0x69, 0x6C, 0x7C, 0x41, 0x6C, 0x6C, 
+    0x29, 0x29, 0x2F, 0x2C, 0x43, 0x3D, 0x7B, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x21, 0x30, 0x2C, 0x63, 
+    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73, 0x3A, 0x21, 0x30, 0x2C, 0x6E, 0x65, 0x78, 0x74, 0x3A, 0x21, 0x30, 0x2C, 0x70, 
+    0x72, 0x65, 0x76, 0x3A, 0x21, 0x30, 0x7D, 0x3B, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x64, 0x69, 
+    0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x64, 0x3D, 0x5B, 0x5D, 0x2C, 0x65, 0x3D, 0x61, 0x5B, 0x62, 0x5D, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 
+    0x65, 0x26, 0x26, 0x39, 0x21, 0x3D, 0x3D, 0x65, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x28, 
+    0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x63, 0x7C, 0x7C, 0x31, 0x21, 0x3D, 0x3D, 0x65, 0x2E, 0x6E, 0x6F, 
+    0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x21, 0x6D, 0x28, 0x65, 0x29, 0x2E, 0x69, 0x73, 0x28, 0x63, 0x29, 0x29, 
+    0x29, 0x31, 0x3D, 0x3D, 0x3D, 0x65, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x64, 0x2E, 0x70, 
+    0x75, 0x73, 0x68, 0x28, 0x65, 0x29, 0x2C, 0x65, 0x3D, 0x65, 0x5B, 0x62, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x64, 0x7D, 0x2C, 0x73, 0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x5B, 0x5D, 0x3B, 0x61, 
+    0x3B, 0x61, 0x3D, 0x61, 0x2E, 0x6E, 0x65, 0x78, 0x74, 0x53, 0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x29, 0x31, 0x3D, 0x3D, 
+    0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x61, 0x21, 0x3D, 0x3D, 0x62, 0x26, 0x26, 
+    0x63, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x61, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x7D, 0x7D, 
+    0x29, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x68, 0x61, 0x73, 0x3A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x3D, 0x6D, 
+    0x28, 0x61, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2C, 0x64, 0x3D, 0x63, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x62, 0x3D, 0x30, 0x3B, 0x64, 0x3E, 
+    0x62, 0x3B, 0x62, 0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x28, 
+    0x74, 0x68, 0x69, 0x73, 0x2C, 0x63, 0x5B, 0x62, 0x5D, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x30, 0x7D, 
+    0x29, 0x7D, 0x2C, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x73, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x2C, 0x62, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x3D, 0x30, 0x2C, 0x65, 
+    0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x66, 0x3D, 0x5B, 0x5D, 0x2C, 0x67, 0x3D, 
+    0x74, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x29, 0x7C, 0x7C, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 
+    0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x3F, 0x6D, 0x28, 0x61, 0x2C, 0x62, 0x7C, 0x7C, 0x74, 0x68, 0x69, 
+    0x73, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x29, 0x3A, 0x30, 0x3B, 0x65, 0x3E, 0x64, 0x3B, 0x64, 0x2B, 0x2B, 
+    0x29, 0x66, 0x6F, 0x72, 0x28, 0x63, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x64, 0x5D, 0x3B, 0x63, 0x26, 0x26, 0x63, 0x21, 
+    0x3D, 0x3D, 0x62, 0x3B, 0x63, 0x3D, 0x63, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x29, 0x69, 
+    0x66, 0x28, 0x63, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3C, 0x31, 0x31, 0x26, 0x26, 0x28, 0x67, 0x3F, 
+    0x67, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x28, 0x63, 0x29, 0x3E, 0x2D, 0x31, 0x3A, 0x31, 0x3D, 0x3D, 0x3D, 0x63, 0x2E, 
+    0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x6D, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x2E, 0x6D, 0x61, 0x74, 
+    0x63, 0x68, 0x65, 0x73, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x28, 0x63, 0x2C, 0x61, 0x29, 0x29, 0x29, 0x7B, 
+    0x66, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x63, 0x29, 0x3B, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x7D, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x28, 0x66, 0x2E, 
+    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3E, 0x31, 0x3F, 0x6D, 0x2E, 0x75, 0x6E, 0x69, 0x71, 0x75, 0x65, 0x28, 0x66, 0x29, 
+    0x3A, 0x66, 0x29, 0x7D, 0x2C, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3F, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 
+    0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x3F, 0x6D, 0x2E, 0x69, 0x6E, 0x41, 0x72, 0x72, 0x61, 0x79, 
+    0x28, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x2C, 0x6D, 0x28, 0x61, 0x29, 0x29, 0x3A, 0x6D, 0x2E, 0x69, 0x6E, 0x41, 
+    0x72, 0x72, 0x61, 0x79, 0x28, 0x61, 0x2E, 0x6A, 0x71, 0x75, 0x65, 0x72, 0x79, 0x3F, 0x61, 0x5B, 0x30, 0x5D, 0x3A, 0x61, 
+    0x2C, 0x74, 0x68, 0x69, 0x73, 0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 
+    0x5B, 0x30, 0x5D, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x3F, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x66, 0x69, 0x72, 0x73, 0x74, 0x28, 0x29, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x41, 0x6C, 0x6C, 0x28, 0x29, 0x2E, 0x6C, 0x65, 
+    0x6E, 0x67, 0x74, 0x68, 0x3A, 0x2D, 0x31, 0x7D, 0x2C, 0x61, 0x64, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 
+    0x75, 0x73, 0x68, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x28, 0x6D, 0x2E, 0x75, 0x6E, 0x69, 0x71, 0x75, 0x65, 0x28, 0x6D, 0x2E, 
+    0x6D, 0x65, 0x72, 0x67, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x67, 0x65, 0x74, 0x28, 0x29, 0x2C, 0x6D, 0x28, 0x61, 
+    0x2C, 0x62, 0x29, 0x29, 0x29, 0x29, 0x7D, 0x2C, 0x61, 0x64, 0x64, 0x42, 0x61, 0x63, 0x6B, 0x3A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x61, 0x64, 0x64, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x61, 0x3F, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x72, 0x65, 
+    0x76, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x4F, 0x62, 0x6A, 
+    0x65, 0x63, 0x74, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x61, 0x29, 0x29, 0x7D, 0x7D, 0x29, 0x3B, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x44, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x64, 0x6F, 0x20, 0x61, 0x3D, 0x61, 
+    0x5B, 0x62, 0x5D, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x61, 0x26, 0x26, 0x31, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 
+    0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x7D, 0x6D, 0x2E, 
+    0x65, 0x61, 0x63, 0x68, 0x28, 0x7B, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x61, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 
+    0x6F, 0x64, 0x65, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x26, 0x26, 0x31, 0x31, 0x21, 0x3D, 0x3D, 0x62, 
+    0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3F, 0x62, 0x3A, 0x6E, 0x75, 0x6C, 0x6C, 0x7D, 0x2C, 0x70, 0x61, 
+    0x72, 0x65, 0x6E, 0x74, 0x73, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x64, 0x69, 0x72, 0x28, 0x61, 0x2C, 0x22, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 
+    0x4E, 0x6F, 0x64, 0x65, 0x22, 0x29, 0x7D, 0x2C, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x73, 0x55, 0x6E, 0x74, 0x69, 0x6C, 
+    0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x64, 0x69, 0x72, 0x28, 0x61, 0x2C, 0x22, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 
+    0x6F, 0x64, 0x65, 0x22, 0x2C, 0x63, 0x29, 0x7D, 0x2C, 0x6E, 0x65, 0x78, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x44, 0x28, 0x61, 0x2C, 0x22, 0x6E, 0x65, 
+    0x78, 0x74, 0x53, 0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x22, 0x29, 0x7D, 0x2C, 0x70, 0x72, 0x65, 0x76, 0x3A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x44, 0x28, 0x61, 
+    0x2C, 0x22, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x53, 0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x22, 0x29, 0x7D, 
+    0x2C, 0x6E, 0x65, 0x78, 0x74, 0x41, 0x6C, 0x6C, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 
+    0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x64, 0x69, 0x72, 0x28, 0x61, 0x2C, 0x22, 0x6E, 0x65, 0x78, 
+    0x74, 0x53, 0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x22, 0x29, 0x7D, 0x2C, 0x70, 0x72, 0x65, 0x76, 0x41, 0x6C, 0x6C, 0x3A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 
+    0x2E, 0x64, 0x69, 0x72, 0x28, 0x61, 0x2C, 0x22, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x53, 0x69, 0x62, 0x6C, 
+    0x69, 0x6E, 0x67, 0x22, 0x29, 0x7D, 0x2C, 0x6E, 0x65, 0x78, 0x74, 0x55, 0x6E, 0x74, 0x69, 0x6C, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x6D, 0x2E, 0x64, 0x69, 0x72, 0x28, 0x61, 0x2C, 0x22, 0x6E, 0x65, 0x78, 0x74, 0x53, 0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 
+    0x22, 0x2C, 0x63, 0x29, 0x7D, 0x2C, 0x70, 0x72, 0x65, 0x76, 0x55, 0x6E, 0x74, 0x69, 0x6C, 0x3A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 
+    0x2E, 0x64, 0x69, 0x72, 0x28, 0x61, 0x2C, 0x22, 0x70, 0x72, 0x65, 0x76, 0x69, 0x6F, 0x75, 0x73, 0x53, 0x69, 0x62, 0x6C, 
+    0x69, 0x6E, 0x67, 0x22, 0x2C, 0x63, 0x29, 0x7D, 0x2C, 0x73, 0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x73, 0x3A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x73, 
+    0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x28, 0x28, 0x61, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 
+    0x7C, 0x7C, 0x7B, 0x7D, 0x29, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x2C, 0x61, 0x29, 0x7D, 
+    0x2C, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x72, 0x65, 0x6E, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x73, 0x69, 0x62, 0x6C, 0x69, 0x6E, 0x67, 0x28, 0x61, 
+    0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x29, 0x7D, 0x2C, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 
+    0x74, 0x73, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x61, 0x2C, 0x22, 0x69, 0x66, 0x72, 0x61, 
+    0x6D, 0x65, 0x22, 0x29, 0x3F, 0x61, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 
+    0x6E, 0x74, 0x7C, 0x7C, 0x61, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x2E, 
+    0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x3A, 0x6D, 0x2E, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x28, 0x5B, 0x5D, 0x2C, 
+    0x61, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x4E, 0x6F, 0x64, 0x65, 0x73, 0x29, 0x7D, 0x7D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x66, 0x6E, 0x5B, 0x61, 0x5D, 0x3D, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x3D, 0x6D, 0x2E, 
+    0x6D, 0x61, 0x70, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x22, 0x55, 0x6E, 0x74, 0x69, 0x6C, 0x22, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x2D, 0x35, 
+    0x29, 0x26, 0x26, 0x28, 0x64, 0x3D, 0x63, 0x29, 0x2C, 0x64, 0x26, 0x26, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 
+    0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x64, 0x26, 0x26, 0x28, 0x65, 0x3D, 0x6D, 0x2E, 0x66, 0x69, 0x6C, 
+    0x74, 0x65, 0x72, 0x28, 0x64, 0x2C, 0x65, 0x29, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x3E, 0x31, 0x26, 0x26, 0x28, 0x43, 0x5B, 0x61, 0x5D, 0x7C, 0x7C, 0x28, 0x65, 0x3D, 0x6D, 0x2E, 0x75, 0x6E, 0x69, 
+    0x71, 0x75, 0x65, 0x28, 0x65, 0x29, 0x29, 0x2C, 0x42, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x29, 0x26, 0x26, 0x28, 
+    0x65, 0x3D, 0x65, 0x2E, 0x72, 0x65, 0x76, 0x65, 0x72, 0x73, 0x65, 0x28, 0x29, 0x29, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x70, 0x75, 0x73, 0x68, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x28, 0x65, 0x29, 0x7D, 0x7D, 0x29, 0x3B, 0x76, 0x61, 0x72, 
+    0x20, 0x45, 0x3D, 0x2F, 0x5C, 0x53, 0x2B, 0x2F, 0x67, 0x2C, 0x46, 0x3D, 0x7B, 0x7D, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x47, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x46, 0x5B, 0x61, 0x5D, 0x3D, 
+    0x7B, 0x7D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x61, 0x2E, 0x6D, 
+    0x61, 0x74, 0x63, 0x68, 0x28, 0x45, 0x29, 0x7C, 0x7C, 0x5B, 0x5D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x2C, 0x63, 0x29, 0x7B, 0x62, 0x5B, 0x63, 0x5D, 0x3D, 0x21, 0x30, 0x7D, 0x29, 0x2C, 0x62, 0x7D, 0x6D, 0x2E, 
+    0x43, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x29, 0x7B, 0x61, 0x3D, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 
+    0x20, 0x61, 0x3F, 0x46, 0x5B, 0x61, 0x5D, 0x7C, 0x7C, 0x47, 0x28, 0x61, 0x29, 0x3A, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 
+    0x6E, 0x64, 0x28, 0x7B, 0x7D, 0x2C, 0x61, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 
+    0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x3D, 0x5B, 0x5D, 0x2C, 0x69, 0x3D, 0x21, 0x61, 0x2E, 0x6F, 0x6E, 0x63, 0x65, 0x26, 
+    0x26, 0x5B, 0x5D, 0x2C, 0x6A, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x6C, 0x29, 0x7B, 0x66, 0x6F, 
+    0x72, 0x28, 0x63, 0x3D, 0x61, 0x2E, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x26, 0x26, 0x6C, 0x2C, 0x64, 0x3D, 0x21, 0x30, 
+    0x2C, 0x66, 0x3D, 0x67, 0x7C, 0x7C, 0x30, 0x2C, 0x67, 0x3D, 0x30, 0x2C, 0x65, 0x3D, 0x68, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 
+    0x74, 0x68, 0x2C, 0x62, 0x3D, 0x21, 0x30, 0x3B, 0x68, 0x26, 0x26, 0x65, 0x3E, 0x66, 0x3B, 0x66, 0x2B, 0x2B, 0x29, 0x69, 
+    0x66, 0x28, 0x68, 0x5B, 0x66, 0x5D, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x6C, 0x5B, 0x30, 0x5D, 0x2C, 0x6C, 0x5B, 
+    0x31, 0x5D, 0x29, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x26, 0x26, 0x61, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x4F, 0x6E, 0x46, 0x61, 
+    0x6C, 0x73, 0x65, 0x29, 0x7B, 0x63, 0x3D, 0x21, 0x31, 0x3B, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x7D, 0x62, 0x3D, 0x21, 0x31, 
+    0x2C, 0x68, 0x26, 0x26, 0x28, 0x69, 0x3F, 0x69, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x6A, 0x28, 0x69, 
+    0x2E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x29, 0x29, 0x3A, 0x63, 0x3F, 0x68, 0x3D, 0x5B, 0x5D, 0x3A, 0x6B, 0x2E, 0x64, 
+    0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x29, 0x29, 0x7D, 0x2C, 0x6B, 0x3D, 0x7B, 0x61, 0x64, 0x64, 0x3A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x68, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 
+    0x3D, 0x68, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x21, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x66, 0x28, 0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x62, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 0x6D, 0x2E, 0x74, 0x79, 0x70, 0x65, 
+    0x28, 0x63, 0x29, 0x3B, 0x22, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x64, 0x3F, 0x61, 
+    0x2E, 0x75, 0x6E, 0x69, 0x71, 0x75, 0x65, 0x26, 0x26, 0x6B, 0x2E, 0x68, 0x61, 0x73, 0x28, 0x63, 0x29, 0x7C, 0x7C, 0x68, 
+    0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x63, 0x29, 0x3A, 0x63, 0x26, 0x26, 0x63, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 
+    0x26, 0x26, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 0x3D, 0x64, 0x26, 0x26, 0x66, 0x28, 0x63, 0x29, 
+    0x7D, 0x29, 0x7D, 0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x2C, 0x62, 0x3F, 0x65, 0x3D, 0x68, 
+    0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3A, 0x63, 0x26, 0x26, 0x28, 0x67, 0x3D, 0x64, 0x2C, 0x6A, 0x28, 0x63, 0x29, 
+    0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x72, 0x65, 0x6D, 0x6F, 0x76, 
+    0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x68, 0x26, 0x26, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3B, 
+    0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x28, 0x64, 0x3D, 0x6D, 0x2E, 0x69, 0x6E, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x63, 
+    0x2C, 0x68, 0x2C, 0x64, 0x29, 0x29, 0x3E, 0x2D, 0x31, 0x29, 0x68, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x64, 
+    0x2C, 0x31, 0x29, 0x2C, 0x62, 0x26, 0x26, 0x28, 0x65, 0x3E, 0x3D, 0x64, 0x26, 0x26, 0x65, 0x2D, 0x2D, 0x2C, 0x66, 0x3E, 
+    0x3D, 0x64, 0x26, 0x26, 0x66, 0x2D, 0x2D, 0x29, 0x7D, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x68, 0x61, 0x73, 
+    0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x61, 0x3F, 0x6D, 0x2E, 0x69, 0x6E, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x61, 0x2C, 0x68, 0x29, 0x3E, 0x2D, 0x31, 0x3A, 
+    0x21, 0x28, 0x21, 0x68, 0x7C, 0x7C, 0x21, 0x68, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x7D, 0x2C, 0x65, 0x6D, 
+    0x70, 0x74, 0x79, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x68, 0x3D, 0x5B, 0x5D, 0x2C, 0x65, 0x3D, 0x30, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x64, 0x69, 0x73, 
+    0x61, 0x62, 0x6C, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x68, 0x3D, 0x69, 0x3D, 0x63, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x74, 0x68, 0x69, 0x73, 
+    0x7D, 0x2C, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x68, 0x7D, 0x2C, 0x6C, 0x6F, 0x63, 0x6B, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x3D, 0x76, 0x6F, 0x69, 
+    0x64, 0x20, 0x30, 0x2C, 0x63, 0x7C, 0x7C, 0x6B, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x29, 0x2C, 0x74, 
+    0x68, 0x69, 0x73, 0x7D, 0x2C, 0x6C, 0x6F, 0x63, 0x6B, 0x65, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x69, 0x7D, 0x2C, 0x66, 0x69, 0x72, 0x65, 0x57, 0x69, 0x74, 
+    0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x21, 0x68, 0x7C, 0x7C, 0x64, 0x26, 0x26, 0x21, 0x69, 0x7C, 0x7C, 0x28, 0x63, 0x3D, 0x63, 0x7C, 0x7C, 0x5B, 
+    0x5D, 0x2C, 0x63, 0x3D, 0x5B, 0x61, 0x2C, 0x63, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x3F, 0x63, 0x2E, 0x73, 0x6C, 0x69, 
+    0x63, 0x65, 0x28, 0x29, 0x3A, 0x63, 0x5D, 0x2C, 0x62, 0x3F, 0x69, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x63, 0x29, 0x3A, 
+    0x6A, 0x28, 0x63, 0x29, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x66, 0x69, 0x72, 0x65, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6B, 0x2E, 0x66, 0x69, 0x72, 
+    0x65, 0x57, 0x69, 0x74, 0x68, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 
+    0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x66, 0x69, 0x72, 0x65, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x21, 0x64, 0x7D, 0x7D, 0x3B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x6B, 0x7D, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x44, 0x65, 0x66, 
+    0x65, 0x72, 0x72, 0x65, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x62, 0x3D, 0x5B, 0x5B, 0x22, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x22, 0x2C, 0x22, 0x64, 0x6F, 0x6E, 
+    0x65, 0x22, 0x2C, 0x6D, 0x2E, 0x43, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x28, 0x22, 0x6F, 0x6E, 0x63, 0x65, 
+    0x20, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x22, 0x29, 0x2C, 0x22, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x64, 0x22, 
+    0x5D, 0x2C, 0x5B, 0x22, 0x72, 0x65, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x2C, 0x22, 0x66, 0x61, 0x69, 0x6C, 0x22, 0x2C, 0x6D, 
+    0x2E, 0x43, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x28, 0x22, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x6D, 0x65, 0x6D, 
+    0x6F, 0x72, 0x79, 0x22, 0x29, 0x2C, 0x22, 0x72, 0x65, 0x6A, 0x65, 0x63, 0x74, 0x65, 0x64, 0x22, 0x5D, 0x2C, 0x5B, 0x22, 
+    0x6E, 0x6F, 0x74, 0x69, 0x66, 0x79, 0x22, 0x2C, 0x22, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x22, 0x2C, 0x6D, 
+    0x2E, 0x43, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x28, 0x22, 0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x22, 0x29, 
+    0x5D, 0x5D, 0x2C, 0x63, 0x3D, 0x22, 0x70, 0x65, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x22, 0x2C, 0x64, 0x3D, 0x7B, 0x73, 0x74, 
+    0x61, 0x74, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x63, 0x7D, 0x2C, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x2E, 0x64, 0x6F, 0x6E, 0x65, 0x28, 0x61, 0x72, 0x67, 
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x2E, 0x66, 0x61, 0x69, 0x6C, 0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 
+    0x74, 0x73, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x74, 0x68, 0x65, 0x6E, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 
+    0x73, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x44, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x28, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x63, 0x29, 0x7B, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x62, 
+    0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x2C, 0x66, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x67, 
+    0x3D, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x5B, 0x62, 0x5D, 0x29, 0x26, 
+    0x26, 0x61, 0x5B, 0x62, 0x5D, 0x3B, 0x65, 0x5B, 0x66, 0x5B, 0x31, 0x5D, 0x5D, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x67, 0x26, 0x26, 0x67, 0x2E, 0x61, 0x70, 0x70, 0x6C, 
+    0x79, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x3B, 0x61, 0x26, 
+    0x26, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2E, 0x70, 0x72, 0x6F, 0x6D, 
+    0x69, 0x73, 0x65, 0x29, 0x3F, 0x61, 0x2E, 0x70, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x28, 0x29, 0x2E, 0x64, 0x6F, 0x6E, 
+    0x65, 0x28, 0x63, 0x2E, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x29, 0x2E, 0x66, 0x61, 0x69, 0x6C, 0x28, 0x63, 0x2E, 
+    0x72, 0x65, 0x6A, 0x65, 0x63, 0x74, 0x29, 0x2E, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x28, 0x63, 0x2E, 0x6E, 
+    0x6F, 0x74, 0x69, 0x66, 0x79, 0x29, 0x3A, 0x63, 0x5B, 0x66, 0x5B, 0x30, 0x5D, 0x2B, 0x22, 0x57, 0x69, 0x74, 0x68, 0x22, 
+    0x5D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x3D, 0x3D, 0x3D, 0x64, 0x3F, 0x63, 0x2E, 0x70, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 
+    0x28, 0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x67, 0x3F, 0x5B, 0x61, 0x5D, 0x3A, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 
+    0x6E, 0x74, 0x73, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x61, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x7D, 0x29, 0x2E, 0x70, 0x72, 
+    0x6F, 0x6D, 0x69, 0x73, 0x65, 0x28, 0x29, 0x7D, 0x2C, 0x70, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 
+    0x21, 0x3D, 0x61, 0x3F, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x61, 0x2C, 0x64, 0x29, 0x3A, 0x64, 0x7D, 
+    0x7D, 0x2C, 0x65, 0x3D, 0x7B, 0x7D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x2E, 0x70, 0x69, 0x70, 0x65, 
+    0x3D, 0x64, 0x2E, 0x74, 0x68, 0x65, 0x6E, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x62, 0x2C, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x66, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x67, 0x3D, 0x66, 0x5B, 0x32, 
+    0x5D, 0x2C, 0x68, 0x3D, 0x66, 0x5B, 0x33, 0x5D, 0x3B, 0x64, 0x5B, 0x66, 0x5B, 0x31, 0x5D, 0x5D, 0x3D, 0x67, 0x2E, 0x61, 
+    0x64, 0x64, 0x2C, 0x68, 0x26, 0x26, 0x67, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x29, 0x7B, 0x63, 0x3D, 0x68, 0x7D, 0x2C, 0x62, 0x5B, 0x31, 0x5E, 0x61, 0x5D, 0x5B, 0x32, 0x5D, 0x2E, 0x64, 0x69, 
+    0x73, 0x61, 0x62, 0x6C, 0x65, 0x2C, 0x62, 0x5B, 0x32, 0x5D, 0x5B, 0x32, 0x5D, 0x2E, 0x6C, 0x6F, 0x63, 0x6B, 0x29, 0x2C, 
+    0x65, 0x5B, 0x66, 0x5B, 0x30, 0x5D, 0x5D, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x5B, 0x66, 0x5B, 0x30, 0x5D, 0x2B, 0x22, 0x57, 0x69, 0x74, 0x68, 0x22, 0x5D, 
+    0x28, 0x74, 0x68, 0x69, 0x73, 0x3D, 0x3D, 0x3D, 0x65, 0x3F, 0x64, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x72, 0x67, 
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x65, 0x5B, 0x66, 0x5B, 0x30, 0x5D, 
+    0x2B, 0x22, 0x57, 0x69, 0x74, 0x68, 0x22, 0x5D, 0x3D, 0x67, 0x2E, 0x66, 0x69, 0x72, 0x65, 0x57, 0x69, 0x74, 0x68, 0x7D, 
+    0x29, 0x2C, 0x64, 0x2E, 0x70, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x28, 0x65, 0x29, 0x2C, 0x61, 0x26, 0x26, 0x61, 0x2E, 
+    0x63, 0x61, 0x6C, 0x6C, 0x28, 0x65, 0x2C, 0x65, 0x29, 0x2C, 0x65, 0x7D, 0x2C, 0x77, 0x68, 0x65, 0x6E, 0x3A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x30, 0x2C, 0x63, 0x3D, 
+    0x64, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x2C, 0x65, 0x3D, 
+    0x63, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x66, 0x3D, 0x31, 0x21, 0x3D, 0x3D, 0x65, 0x7C, 0x7C, 0x61, 0x26, 
+    0x26, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2E, 0x70, 0x72, 0x6F, 0x6D, 
+    0x69, 0x73, 0x65, 0x29, 0x3F, 0x65, 0x3A, 0x30, 0x2C, 0x67, 0x3D, 0x31, 0x3D, 0x3D, 0x3D, 0x66, 0x3F, 0x61, 0x3A, 0x6D, 
+    0x2E, 0x44, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x28, 0x29, 0x2C, 0x68, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x65, 0x29, 0x7B, 0x62, 0x5B, 0x61, 0x5D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x63, 
+    0x5B, 0x61, 0x5D, 0x3D, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 
+    0x3E, 0x31, 0x3F, 0x64, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x29, 
+    0x3A, 0x65, 0x2C, 0x63, 0x3D, 0x3D, 0x3D, 0x69, 0x3F, 0x67, 0x2E, 0x6E, 0x6F, 0x74, 0x69, 0x66, 0x79, 0x57, 0x69, 0x74, 
+    0x68, 0x28, 0x62, 0x2C, 0x63, 0x29, 0x3A, 0x2D, 0x2D, 0x66, 0x7C, 0x7C, 0x67, 0x2E, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 
+    0x65, 0x57, 0x69, 0x74, 0x68, 0x28, 0x62, 0x2C, 0x63, 0x29, 0x7D, 0x7D, 0x2C, 0x69, 0x2C, 0x6A, 0x2C, 0x6B, 0x3B, 0x69, 
+    0x66, 0x28, 0x65, 0x3E, 0x31, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x69, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x41, 0x72, 0x72, 0x61, 
+    0x79, 0x28, 0x65, 0x29, 0x2C, 0x6A, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x65, 0x29, 0x2C, 
+    0x6B, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x65, 0x29, 0x3B, 0x65, 0x3E, 0x62, 0x3B, 0x62, 
+    0x2B, 0x2B, 0x29, 0x63, 0x5B, 0x62, 0x5D, 0x26, 0x26, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x63, 0x5B, 0x62, 0x5D, 0x2E, 0x70, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x29, 0x3F, 0x63, 0x5B, 0x62, 0x5D, 
+    0x2E, 0x70, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x28, 0x29, 0x2E, 0x64, 0x6F, 0x6E, 0x65, 0x28, 0x68, 0x28, 0x62, 0x2C, 
+    0x6B, 0x2C, 0x63, 0x29, 0x29, 0x2E, 0x66, 0x61, 0x69, 0x6C, 0x28, 0x67, 0x2E, 0x72, 0x65, 0x6A, 0x65, 0x63, 0x74, 0x29, 
+    0x2E, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x28, 0x68, 0x28, 0x62, 0x2C, 0x6A, 0x2C, 0x69, 0x29, 0x29, 0x3A, 
+    0x2D, 0x2D, 0x66, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x7C, 0x7C, 0x67, 0x2E, 0x72, 0x65, 0x73, 0x6F, 
+    0x6C, 0x76, 0x65, 0x57, 0x69, 0x74, 0x68, 0x28, 0x6B, 0x2C, 0x63, 0x29, 0x2C, 0x67, 0x2E, 0x70, 0x72, 0x6F, 0x6D, 0x69, 
+    0x73, 0x65, 0x28, 0x29, 0x7D, 0x7D, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x48, 0x3B, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x72, 
+    0x65, 0x61, 0x64, 0x79, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x2E, 0x70, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x28, 
+    0x29, 0x2E, 0x64, 0x6F, 0x6E, 0x65, 0x28, 0x61, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 
+    0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x69, 0x73, 0x52, 0x65, 0x61, 0x64, 0x79, 0x3A, 0x21, 0x31, 0x2C, 0x72, 0x65, 0x61, 
+    0x64, 0x79, 0x57, 0x61, 0x69, 0x74, 0x3A, 0x31, 0x2C, 0x68, 0x6F, 0x6C, 0x64, 0x52, 0x65, 0x61, 0x64, 0x79, 0x3A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x61, 0x3F, 0x6D, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 
+    0x57, 0x61, 0x69, 0x74, 0x2B, 0x2B, 0x3A, 0x6D, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x28, 0x21, 0x30, 0x29, 0x7D, 0x2C, 
+    0x72, 0x65, 0x61, 0x64, 0x79, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x69, 0x66, 
+    0x28, 0x61, 0x3D, 0x3D, 0x3D, 0x21, 0x30, 0x3F, 0x21, 0x2D, 0x2D, 0x6D, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x57, 0x61, 
+    0x69, 0x74, 0x3A, 0x21, 0x6D, 0x2E, 0x69, 0x73, 0x52, 0x65, 0x61, 0x64, 0x79, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x21, 0x79, 
+    0x2E, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 
+    0x6F, 0x75, 0x74, 0x28, 0x6D, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x29, 0x3B, 0x6D, 0x2E, 0x69, 0x73, 0x52, 0x65, 0x61, 
+    0x64, 0x79, 0x3D, 0x21, 0x30, 0x2C, 0x61, 0x21, 0x3D, 0x3D, 0x21, 0x30, 0x26, 0x26, 0x2D, 0x2D, 0x6D, 0x2E, 0x72, 0x65, 
+    0x61, 0x64, 0x79, 0x57, 0x61, 0x69, 0x74, 0x3E, 0x30, 0x7C, 0x7C, 0x28, 0x48, 0x2E, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 
+    0x65, 0x57, 0x69, 0x74, 0x68, 0x28, 0x79, 0x2C, 0x5B, 0x6D, 0x5D, 0x29, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x74, 0x72, 
+    0x69, 0x67, 0x67, 0x65, 0x72, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x26, 0x26, 0x28, 0x6D, 0x28, 0x79, 0x29, 0x2E, 
+    0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x28, 0x22, 0x72, 0x65, 0x61, 0x64, 
+    0x79, 0x22, 0x29, 0x2C, 0x6D, 0x28, 0x79, 0x29, 0x2E, 0x6F, 0x66, 0x66, 0x28, 0x22, 0x72, 0x65, 0x61, 0x64, 0x79, 0x22, 
+    0x29, 0x29, 0x29, 0x7D, 0x7D, 0x7D, 0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x49, 0x28, 0x29, 
+    0x7B, 0x79, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x3F, 
+    0x28, 0x79, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 
+    0x65, 0x72, 0x28, 0x22, 0x44, 0x4F, 0x4D, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x4C, 0x6F, 0x61, 0x64, 0x65, 0x64, 
+    0x22, 0x2C, 0x4A, 0x2C, 0x21, 0x31, 0x29, 0x2C, 0x61, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x45, 0x76, 0x65, 0x6E, 
+    0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x6C, 0x6F, 0x61, 0x64, 0x22, 0x2C, 0x4A, 0x2C, 0x21, 
+    0x31, 0x29, 0x29, 0x3A, 0x28, 0x79, 0x2E, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x22, 
+    0x6F, 0x6E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73, 0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x22, 0x2C, 
+    0x4A, 0x29, 0x2C, 0x61, 0x2E, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x6F, 0x6E, 
+    0x6C, 0x6F, 0x61, 0x64, 0x22, 0x2C, 0x4A, 0x29, 0x29, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x4A, 
+    0x28, 0x29, 0x7B, 0x28, 0x79, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 
+    0x65, 0x72, 0x7C, 0x7C, 0x22, 0x6C, 0x6F, 0x61, 0x64, 0x22, 0x3D, 0x3D, 0x3D, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x74, 
+    0x79, 0x70, 0x65, 0x7C, 0x7C, 0x22, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x79, 0x2E, 
+    0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x26, 0x26, 0x28, 0x49, 0x28, 0x29, 0x2C, 0x6D, 0x2E, 
+    0x72, 0x65, 0x61, 0x64, 0x79, 0x28, 0x29, 0x29, 0x7D, 0x6D, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x2E, 0x70, 0x72, 0x6F, 
+    0x6D, 0x69, 0x73, 0x65, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x69, 0x66, 0x28, 
+    0x21, 0x48, 0x29, 0x69, 0x66, 0x28, 0x48, 0x3D, 0x6D, 0x2E, 0x44, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x28, 0x29, 
+    0x2C, 0x22, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x79, 0x2E, 0x72, 0x65, 0x61, 0x64, 
+    0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28, 0x6D, 0x2E, 
+    0x72, 0x65, 0x61, 0x64, 0x79, 0x29, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x28, 0x79, 0x2E, 0x61, 0x64, 0x64, 
+    0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x29, 0x79, 0x2E, 0x61, 0x64, 0x64, 0x45, 
+    0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x44, 0x4F, 0x4D, 0x43, 0x6F, 0x6E, 
+    0x74, 0x65, 0x6E, 0x74, 0x4C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x22, 0x2C, 0x4A, 0x2C, 0x21, 0x31, 0x29, 0x2C, 0x61, 0x2E, 
+    0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x22, 0x6C, 0x6F, 
+    0x61, 0x64, 0x22, 0x2C, 0x4A, 0x2C, 0x21, 0x31, 0x29, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x7B, 0x79, 0x2E, 0x61, 0x74, 0x74, 
+    0x61, 0x63, 0x68, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x6F, 0x6E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73, 0x74, 0x61, 
+    0x74, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x22, 0x2C, 0x4A, 0x29, 0x2C, 0x61, 0x2E, 0x61, 0x74, 0x74, 0x61, 0x63, 
+    0x68, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x6F, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x22, 0x2C, 0x4A, 0x29, 0x3B, 0x76, 
+    0x61, 0x72, 0x20, 0x63, 0x3D, 0x21, 0x31, 0x3B, 0x74, 0x72, 0x79, 0x7B, 0x63, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 
+    0x61, 0x2E, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x26, 0x26, 0x79, 0x2E, 0x64, 0x6F, 
+    0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 
+    0x64, 0x29, 0x7B, 0x7D, 0x63, 0x26, 0x26, 0x63, 0x2E, 0x64, 0x6F, 0x53, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x26, 0x26, 0x21, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x65, 0x28, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x21, 0x6D, 0x2E, 0x69, 
+    0x73, 0x52, 0x65, 0x61, 0x64, 0x79, 0x29, 0x7B, 0x74, 0x72, 0x79, 0x7B, 0x63, 0x2E, 0x64, 0x6F, 0x53, 0x63, 0x72, 0x6F, 
+    0x6C, 0x6C, 0x28, 0x22, 0x6C, 0x65, 0x66, 0x74, 0x22, 0x29, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x61, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28, 0x65, 0x2C, 
+    0x35, 0x30, 0x29, 0x7D, 0x49, 0x28, 0x29, 0x2C, 0x6D, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x28, 0x29, 0x7D, 0x7D, 0x28, 
+    0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x48, 0x2E, 0x70, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x28, 0x62, 
+    0x29, 0x7D, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x4B, 0x3D, 0x22, 0x75, 0x6E, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x64, 0x22, 
+    0x2C, 0x4C, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x4C, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x28, 0x6B, 0x29, 0x29, 0x62, 0x72, 0x65, 
+    0x61, 0x6B, 0x3B, 0x6B, 0x2E, 0x6F, 0x77, 0x6E, 0x4C, 0x61, 0x73, 0x74, 0x3D, 0x22, 0x30, 0x22, 0x21, 0x3D, 0x3D, 0x4C, 
+    0x2C, 0x6B, 0x2E, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x4E, 0x65, 0x65, 0x64, 0x73, 0x4C, 
+    0x61, 0x79, 0x6F, 0x75, 0x74, 0x3D, 0x21, 0x31, 0x2C, 0x6D, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x3B, 0x63, 0x3D, 0x79, 0x2E, 0x67, 0x65, 
+    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x22, 
+    0x62, 0x6F, 0x64, 0x79, 0x22, 0x29, 0x5B, 0x30, 0x5D, 0x2C, 0x63, 0x26, 0x26, 0x63, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 
+    0x26, 0x26, 0x28, 0x62, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 
+    0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x2C, 0x64, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x2C, 0x64, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 
+    0x2E, 0x63, 0x73, 0x73, 0x54, 0x65, 0x78, 0x74, 0x3D, 0x22, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x61, 
+    0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x3B, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x30, 0x3B, 0x77, 0x69, 0x64, 
+    0x74, 0x68, 0x3A, 0x30, 0x3B, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x30, 0x3B, 0x74, 0x6F, 0x70, 0x3A, 0x30, 0x3B, 
+    0x6C, 0x65, 0x66, 0x74, 0x3A, 0x2D, 0x39, 0x39, 0x39, 0x39, 0x70, 0x78, 0x22, 0x2C, 0x63, 0x2E, 0x61, 0x70, 0x70, 0x65, 
+    0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x64, 0x29, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 
+    0x6C, 0x64, 0x28, 0x62, 0x29, 0x2C, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 
+    0x2E, 0x7A, 0x6F, 0x6F, 0x6D, 0x21, 0x3D, 0x3D, 0x4B, 0x26, 0x26, 0x28, 0x62, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 
+    0x63, 0x73, 0x73, 0x54, 0x65, 0x78, 0x74, 0x3D, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x69, 0x6E, 0x6C, 
+    0x69, 0x6E, 0x65, 0x3B, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x30, 0x3B, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 
+    0x30, 0x3B, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x70, 0x78, 0x3B, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 
+    0x31, 0x70, 0x78, 0x3B, 0x7A, 0x6F, 0x6F, 0x6D, 0x3A, 0x31, 0x22, 0x2C, 0x6B, 0x2E, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 
+    0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x4E, 0x65, 0x65, 0x64, 0x73, 0x4C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x3D, 0x61, 0x3D, 0x33, 
+    0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x57, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x61, 0x26, 0x26, 
+    0x28, 0x63, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x7A, 0x6F, 0x6F, 0x6D, 0x3D, 0x31, 0x29, 0x29, 0x2C, 0x63, 0x2E, 
+    0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x64, 0x29, 0x29, 0x7D, 0x29, 0x2C, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 
+    0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x3B, 0x69, 0x66, 
+    0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x6B, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x45, 0x78, 0x70, 0x61, 0x6E, 
+    0x64, 0x6F, 0x29, 0x7B, 0x6B, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x45, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x3D, 
+    0x21, 0x30, 0x3B, 0x74, 0x72, 0x79, 0x7B, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x61, 0x2E, 0x74, 0x65, 0x73, 0x74, 
+    0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x62, 0x29, 0x7B, 0x6B, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x45, 0x78, 
+    0x70, 0x61, 0x6E, 0x64, 0x6F, 0x3D, 0x21, 0x31, 0x7D, 0x7D, 0x61, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x7D, 0x28, 0x29, 0x2C, 
+    0x6D, 0x2E, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x44, 0x61, 0x74, 0x61, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x6D, 0x2E, 0x6E, 0x6F, 0x44, 0x61, 0x74, 0x61, 0x5B, 
+    0x28, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2B, 0x22, 0x20, 0x22, 0x29, 0x2E, 0x74, 0x6F, 0x4C, 
+    0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x5D, 0x2C, 0x63, 0x3D, 0x2B, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x31, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x21, 0x3D, 0x3D, 
+    0x63, 0x26, 0x26, 0x39, 0x21, 0x3D, 0x3D, 0x63, 0x3F, 0x21, 0x31, 0x3A, 0x21, 0x62, 0x7C, 0x7C, 0x62, 0x21, 0x3D, 0x3D, 
+    0x21, 0x30, 0x26, 0x26, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 
+    0x63, 0x6C, 0x61, 0x73, 0x73, 0x69, 0x64, 0x22, 0x29, 0x3D, 0x3D, 0x3D, 0x62, 0x7D, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x4D, 
+    0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 0x5C, 0x7B, 0x5B, 0x5C, 0x77, 0x5C, 0x57, 0x5D, 0x2A, 0x5C, 0x7D, 0x7C, 0x5C, 0x5B, 
+    0x5B, 0x5C, 0x77, 0x5C, 0x57, 0x5D, 0x2A, 0x5C, 0x5D, 0x29, 0x24, 0x2F, 0x2C, 0x4E, 0x3D, 0x2F, 0x28, 0x5B, 0x41, 0x2D, 
+    0x5A, 0x5D, 0x29, 0x2F, 0x67, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x4F, 0x28, 0x61, 0x2C, 0x62, 
+    0x2C, 0x63, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x63, 0x26, 0x26, 0x31, 
+    0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 
+    0x3D, 0x22, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x22, 0x2B, 0x62, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x4E, 
+    0x2C, 0x22, 0x2D, 0x24, 0x31, 0x22, 0x29, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 
+    0x29, 0x3B, 0x69, 0x66, 0x28, 0x63, 0x3D, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 
+    0x65, 0x28, 0x64, 0x29, 0x2C, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 
+    0x66, 0x20, 0x63, 0x29, 0x7B, 0x74, 0x72, 0x79, 0x7B, 0x63, 0x3D, 0x22, 0x74, 0x72, 0x75, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 
+    0x63, 0x3F, 0x21, 0x30, 0x3A, 0x22, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x3F, 0x21, 0x31, 0x3A, 
+    0x22, 0x6E, 0x75, 0x6C, 0x6C, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x3F, 0x6E, 0x75, 0x6C, 0x6C, 0x3A, 0x2B, 0x63, 0x2B, 0x22, 
+    0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x3F, 0x2B, 0x63, 0x3A, 0x4D, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x63, 0x29, 0x3F, 0x6D, 
+    0x2E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x4A, 0x53, 0x4F, 0x4E, 0x28, 0x63, 0x29, 0x3A, 0x63, 0x7D, 0x63, 0x61, 0x74, 0x63, 
+    0x68, 0x28, 0x65, 0x29, 0x7B, 0x7D, 0x6D, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7D, 
+    0x65, 0x6C, 0x73, 0x65, 0x20, 0x63, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x63, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x50, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 
+    0x20, 0x62, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x62, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x29, 0x69, 0x66, 0x28, 0x28, 0x22, 0x64, 
+    0x61, 0x74, 0x61, 0x22, 0x21, 0x3D, 0x3D, 0x62, 0x7C, 0x7C, 0x21, 0x6D, 0x2E, 0x69, 0x73, 0x45, 0x6D, 0x70, 0x74, 0x79, 
+    0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x61, 0x5B, 0x62, 0x5D, 0x29, 0x29, 0x26, 0x26, 0x22, 0x74, 0x6F, 0x4A, 0x53, 
+    0x4F, 0x4E, 0x22, 0x21, 0x3D, 0x3D, 0x62, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x31, 0x3B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x21, 0x30, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x51, 0x28, 0x61, 0x2C, 0x62, 
+    0x2C, 0x64, 0x2C, 0x65, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x6D, 0x2E, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x44, 0x61, 0x74, 
+    0x61, 0x28, 0x61, 0x29, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x3D, 0x6D, 0x2E, 0x65, 0x78, 
+    0x70, 0x61, 0x6E, 0x64, 0x6F, 0x2C, 0x69, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x2C, 0x6A, 
+    0x3D, 0x69, 0x3F, 0x6D, 0x2E, 0x63, 0x61, 0x63, 0x68, 0x65, 0x3A, 0x61, 0x2C, 0x6B, 0x3D, 0x69, 0x3F, 0x61, 0x5B, 0x68, 
+    0x5D, 0x3A, 0x61, 0x5B, 0x68, 0x5D, 0x26, 0x26, 0x68, 0x3B, 0x0A, 0x69, 0x66, 0x28, 0x6B, 0x26, 0x26, 0x6A, 0x5B, 0x6B, 
+    0x5D, 0x26, 0x26, 0x28, 0x65, 0x7C, 0x7C, 0x6A, 0x5B, 0x6B, 0x5D, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x29, 0x7C, 0x7C, 0x76, 
+    0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x64, 0x7C, 0x7C, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 
+    0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6B, 0x7C, 0x7C, 
+    0x28, 0x6B, 0x3D, 0x69, 0x3F, 0x61, 0x5B, 0x68, 0x5D, 0x3D, 0x63, 0x2E, 0x70, 0x6F, 0x70, 0x28, 0x29, 0x7C, 0x7C, 0x6D, 
+    0x2E, 0x67, 0x75, 0x69, 0x64, 0x2B, 0x2B, 0x3A, 0x68, 0x29, 0x2C, 0x6A, 0x5B, 0x6B, 0x5D, 0x7C, 0x7C, 0x28, 0x6A, 0x5B, 
+    0x6B, 0x5D, 0x3D, 0x69, 0x3F, 0x7B, 0x7D, 0x3A, 0x7B, 0x74, 0x6F, 0x4A, 0x53, 0x4F, 0x4E, 0x3A, 0x6D, 0x2E, 0x6E, 0x6F, 
+    0x6F, 0x70, 0x7D, 0x29, 0x2C, 0x28, 0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 
+    0x6F, 0x66, 0x20, 0x62, 0x7C, 0x7C, 0x22, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x74, 0x79, 
+    0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x29, 0x26, 0x26, 0x28, 0x65, 0x3F, 0x6A, 0x5B, 0x6B, 0x5D, 0x3D, 0x6D, 0x2E, 0x65, 
+    0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x6A, 0x5B, 0x6B, 0x5D, 0x2C, 0x62, 0x29, 0x3A, 0x6A, 0x5B, 0x6B, 0x5D, 0x2E, 0x64, 
+    0x61, 0x74, 0x61, 0x3D, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x6A, 0x5B, 0x6B, 0x5D, 0x2E, 0x64, 0x61, 
+    0x74, 0x61, 0x2C, 0x62, 0x29, 0x29, 0x2C, 0x67, 0x3D, 0x6A, 0x5B, 0x6B, 0x5D, 0x2C, 0x65, 0x7C, 0x7C, 0x28, 0x67, 0x2E, 
+    0x64, 0x61, 0x74, 0x61, 0x7C, 0x7C, 0x28, 0x67, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x3D, 0x7B, 0x7D, 0x29, 0x2C, 0x67, 0x3D, 
+    0x67, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x29, 0x2C, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x64, 0x26, 0x26, 
+    0x28, 0x67, 0x5B, 0x6D, 0x2E, 0x63, 0x61, 0x6D, 0x65, 0x6C, 0x43, 0x61, 0x73, 0x65, 0x28, 0x62, 0x29, 0x5D, 0x3D, 0x64, 
+    0x29, 0x2C, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 
+    0x3F, 0x28, 0x66, 0x3D, 0x67, 0x5B, 0x62, 0x5D, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x66, 0x26, 0x26, 0x28, 0x66, 
+    0x3D, 0x67, 0x5B, 0x6D, 0x2E, 0x63, 0x61, 0x6D, 0x65, 0x6C, 0x43, 0x61, 0x73, 0x65, 0x28, 0x62, 0x29, 0x5D, 0x29, 0x29, 
+    0x3A, 0x66, 0x3D, 0x67, 0x2C, 0x66, 0x7D, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x52, 0x28, 0x61, 
+    0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x6D, 0x2E, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x44, 0x61, 0x74, 
+    0x61, 0x28, 0x61, 0x29, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 
+    0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x2C, 0x67, 0x3D, 0x66, 0x3F, 0x6D, 0x2E, 0x63, 0x61, 0x63, 0x68, 0x65, 0x3A, 0x61, 
+    0x2C, 0x68, 0x3D, 0x66, 0x3F, 0x61, 0x5B, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x5D, 0x3A, 0x6D, 0x2E, 
+    0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x3B, 0x69, 0x66, 0x28, 0x67, 0x5B, 0x68, 0x5D, 0x29, 0x7B, 0x69, 0x66, 0x28, 
+    0x62, 0x26, 0x26, 0x28, 0x64, 0x3D, 0x63, 0x3F, 0x67, 0x5B, 0x68, 0x5D, 0x3A, 0x67, 0x5B, 0x68, 0x5D, 0x2E, 0x64, 0x61, 
+    0x74, 0x61, 0x29, 0x29, 0x7B, 0x6D, 0x2E, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x62, 0x29, 0x3F, 0x62, 0x3D, 
+    0x62, 0x2E, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x28, 0x6D, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x62, 0x2C, 0x6D, 0x2E, 0x63, 
+    0x61, 0x6D, 0x65, 0x6C, 0x43, 0x61, 0x73, 0x65, 0x29, 0x29, 0x3A, 0x62, 0x20, 0x69, 0x6E, 0x20, 0x64, 0x3F, 0x62, 0x3D, 
+    0x5B, 0x62, 0x5D, 0x3A, 0x28, 0x62, 0x3D, 0x6D, 0x2E, 0x63, 0x61, 0x6D, 0x65, 0x6C, 0x43, 0x61, 0x73, 0x65, 0x28, 0x62, 
+    0x29, 0x2C, 0x62, 0x3D, 0x62, 0x20, 0x69, 0x6E, 0x20, 0x64, 0x3F, 0x5B, 0x62, 0x5D, 0x3A, 0x62, 0x2E, 0x73, 0x70, 0x6C, 
+    0x69, 0x74, 0x28, 0x22, 0x20, 0x22, 0x29, 0x29, 0x2C, 0x65, 0x3D, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 
+    0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x65, 0x2D, 0x2D, 0x29, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x64, 0x5B, 0x62, 
+    0x5B, 0x65, 0x5D, 0x5D, 0x3B, 0x69, 0x66, 0x28, 0x63, 0x3F, 0x21, 0x50, 0x28, 0x64, 0x29, 0x3A, 0x21, 0x6D, 0x2E, 0x69, 
+    0x73, 0x45, 0x6D, 0x70, 0x74, 0x79, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x64, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x7D, 0x28, 0x63, 0x7C, 0x7C, 0x28, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x67, 0x5B, 0x68, 0x5D, 0x2E, 
+    0x64, 0x61, 0x74, 0x61, 0x2C, 0x50, 0x28, 0x67, 0x5B, 0x68, 0x5D, 0x29, 0x29, 0x29, 0x26, 0x26, 0x28, 0x66, 0x3F, 0x6D, 
+    0x2E, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x44, 0x61, 0x74, 0x61, 0x28, 0x5B, 0x61, 0x5D, 0x2C, 0x21, 0x30, 0x29, 0x3A, 0x6B, 
+    0x2E, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x45, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x7C, 0x7C, 0x67, 0x21, 0x3D, 0x67, 
+    0x2E, 0x77, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x3F, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x67, 0x5B, 0x68, 0x5D, 0x3A, 
+    0x67, 0x5B, 0x68, 0x5D, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x7D, 0x7D, 0x7D, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 
+    0x64, 0x28, 0x7B, 0x63, 0x61, 0x63, 0x68, 0x65, 0x3A, 0x7B, 0x7D, 0x2C, 0x6E, 0x6F, 0x44, 0x61, 0x74, 0x61, 0x3A, 0x7B, 
+    0x22, 0x61, 0x70, 0x70, 0x6C, 0x65, 0x74, 0x20, 0x22, 0x3A, 0x21, 0x30, 0x2C, 0x22, 0x65, 0x6D, 0x62, 0x65, 0x64, 0x20, 
+    0x22, 0x3A, 0x21, 0x30, 0x2C, 0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x20, 0x22, 0x3A, 0x22, 0x63, 0x6C, 0x73, 0x69, 
+    0x64, 0x3A, 0x44, 0x32, 0x37, 0x43, 0x44, 0x42, 0x36, 0x45, 0x2D, 0x41, 0x45, 0x36, 0x44, 0x2D, 0x31, 0x31, 0x63, 0x66, 
+    0x2D, 0x39, 0x36, 0x42, 0x38, 0x2D, 0x34, 0x34, 0x34, 0x35, 0x35, 0x33, 0x35, 0x34, 0x30, 0x30, 0x30, 0x30, 0x22, 0x7D, 
+    0x2C, 0x68, 0x61, 0x73, 0x44, 0x61, 0x74, 0x61, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 
+    0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 
+    0x3F, 0x6D, 0x2E, 0x63, 0x61, 0x63, 0x68, 0x65, 0x5B, 0x61, 0x5B, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 
+    0x5D, 0x5D, 0x3A, 0x61, 0x5B, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x5D, 0x2C, 0x21, 0x21, 0x61, 0x26, 
+    0x26, 0x21, 0x50, 0x28, 0x61, 0x29, 0x7D, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x51, 0x28, 0x61, 0x2C, 
+    0x62, 0x2C, 0x63, 0x29, 0x7D, 0x2C, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x44, 0x61, 0x74, 0x61, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x52, 0x28, 
+    0x61, 0x2C, 0x62, 0x29, 0x7D, 0x2C, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x51, 0x28, 0x61, 0x2C, 0x62, 
+    0x2C, 0x63, 0x2C, 0x21, 0x30, 0x29, 0x7D, 0x2C, 0x5F, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x44, 0x61, 0x74, 0x61, 0x3A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x52, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x21, 0x30, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 
+    0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x3D, 0x74, 0x68, 
+    0x69, 0x73, 0x5B, 0x30, 0x5D, 0x2C, 0x67, 0x3D, 0x66, 0x26, 0x26, 0x66, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 
+    0x74, 0x65, 0x73, 0x3B, 0x69, 0x66, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x61, 0x29, 0x7B, 0x69, 
+    0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x28, 0x65, 0x3D, 0x6D, 0x2E, 
+    0x64, 0x61, 0x74, 0x61, 0x28, 0x66, 0x29, 0x2C, 0x31, 0x3D, 0x3D, 0x3D, 0x66, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x26, 0x26, 0x21, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x66, 0x2C, 0x22, 0x70, 0x61, 0x72, 0x73, 
+    0x65, 0x64, 0x41, 0x74, 0x74, 0x72, 0x73, 0x22, 0x29, 0x29, 0x29, 0x7B, 0x63, 0x3D, 0x67, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 
+    0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x63, 0x2D, 0x2D, 0x29, 0x67, 0x5B, 0x63, 0x5D, 0x26, 0x26, 0x28, 
+    0x64, 0x3D, 0x67, 0x5B, 0x63, 0x5D, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x30, 0x3D, 0x3D, 0x3D, 0x64, 0x2E, 0x69, 0x6E, 
+    0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x22, 0x29, 0x26, 0x26, 0x28, 0x64, 0x3D, 0x6D, 
+    0x2E, 0x63, 0x61, 0x6D, 0x65, 0x6C, 0x43, 0x61, 0x73, 0x65, 0x28, 0x64, 0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x35, 
+    0x29, 0x29, 0x2C, 0x4F, 0x28, 0x66, 0x2C, 0x64, 0x2C, 0x65, 0x5B, 0x64, 0x5D, 0x29, 0x29, 0x29, 0x3B, 0x6D, 0x2E, 0x5F, 
+    0x64, 0x61, 0x74, 0x61, 0x28, 0x66, 0x2C, 0x22, 0x70, 0x61, 0x72, 0x73, 0x65, 0x64, 0x41, 0x74, 0x74, 0x72, 0x73, 0x22, 
+    0x2C, 0x21, 0x30, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x3F, 0x74, 
+    0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 
+    0x6D, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x29, 0x7D, 0x29, 0x3A, 0x61, 0x72, 0x67, 
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3E, 0x31, 0x3F, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 0x2E, 0x64, 
+    0x61, 0x74, 0x61, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x2C, 0x62, 0x29, 0x7D, 0x29, 0x3A, 0x66, 0x3F, 0x4F, 0x28, 
+    0x66, 0x2C, 0x61, 0x2C, 0x6D, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x28, 0x66, 0x2C, 0x61, 0x29, 0x29, 0x3A, 0x76, 0x6F, 0x69, 
+    0x64, 0x20, 0x30, 0x7D, 0x2C, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x44, 0x61, 0x74, 0x61, 0x3A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 0x2E, 0x72, 0x65, 
+    0x6D, 0x6F, 0x76, 0x65, 0x44, 0x61, 0x74, 0x61, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x29, 0x7D, 0x29, 0x7D, 0x7D, 
+    0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x71, 0x75, 0x65, 0x75, 0x65, 0x3A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3F, 0x28, 0x62, 0x3D, 0x28, 0x62, 0x7C, 0x7C, 0x22, 0x66, 0x78, 0x22, 
+    0x29, 0x2B, 0x22, 0x71, 0x75, 0x65, 0x75, 0x65, 0x22, 0x2C, 0x64, 0x3D, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 
+    0x61, 0x2C, 0x62, 0x29, 0x2C, 0x63, 0x26, 0x26, 0x28, 0x21, 0x64, 0x7C, 0x7C, 0x6D, 0x2E, 0x69, 0x73, 0x41, 0x72, 0x72, 
+    0x61, 0x79, 0x28, 0x63, 0x29, 0x3F, 0x64, 0x3D, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x61, 0x2C, 0x62, 0x2C, 
+    0x6D, 0x2E, 0x6D, 0x61, 0x6B, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x63, 0x29, 0x29, 0x3A, 0x64, 0x2E, 0x70, 0x75, 
+    0x73, 0x68, 0x28, 0x63, 0x29, 0x29, 0x2C, 0x64, 0x7C, 0x7C, 0x5B, 0x5D, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 
+    0x7D, 0x2C, 0x64, 0x65, 0x71, 0x75, 0x65, 0x75, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x2C, 0x62, 0x29, 0x7B, 0x62, 0x3D, 0x62, 0x7C, 0x7C, 0x22, 0x66, 0x78, 0x22, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 
+    0x6D, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x2C, 0x64, 0x3D, 0x63, 0x2E, 0x6C, 0x65, 0x6E, 
+    0x67, 0x74, 0x68, 0x2C, 0x65, 0x3D, 0x63, 0x2E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x29, 0x2C, 0x66, 0x3D, 0x6D, 0x2E, 
+    0x5F, 0x71, 0x75, 0x65, 0x75, 0x65, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x2C, 0x67, 0x3D, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 0x2E, 0x64, 0x65, 0x71, 0x75, 0x65, 0x75, 0x65, 0x28, 
+    0x61, 0x2C, 0x62, 0x29, 0x7D, 0x3B, 0x22, 0x69, 0x6E, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x22, 0x3D, 0x3D, 
+    0x3D, 0x65, 0x26, 0x26, 0x28, 0x65, 0x3D, 0x63, 0x2E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x29, 0x2C, 0x64, 0x2D, 0x2D, 
+    0x29, 0x2C, 0x65, 0x26, 0x26, 0x28, 0x22, 0x66, 0x78, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x26, 0x26, 0x63, 0x2E, 0x75, 0x6E, 
+    0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x22, 0x69, 0x6E, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x22, 0x29, 0x2C, 
+    0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x66, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x2C, 0x65, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 
+    0x28, 0x61, 0x2C, 0x67, 0x2C, 0x66, 0x29, 0x29, 0x2C, 0x21, 0x64, 0x26, 0x26, 0x66, 0x26, 0x26, 0x66, 0x2E, 0x65, 0x6D, 
+    0x70, 0x74, 0x79, 0x2E, 0x66, 0x69, 0x72, 0x65, 0x28, 0x29, 0x7D, 0x2C, 0x5F, 0x71, 0x75, 0x65, 0x75, 0x65, 0x48, 0x6F, 
+    0x6F, 0x6B, 0x73, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x63, 0x3D, 0x62, 0x2B, 0x22, 0x71, 0x75, 0x65, 0x75, 0x65, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x22, 0x3B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x61, 0x2C, 0x63, 0x29, 0x7C, 0x7C, 
+    0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x61, 0x2C, 0x63, 0x2C, 0x7B, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x3A, 0x6D, 
+    0x2E, 0x43, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x28, 0x22, 0x6F, 0x6E, 0x63, 0x65, 0x20, 0x6D, 0x65, 0x6D, 
+    0x6F, 0x72, 0x79, 0x22, 0x29, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 
+    0x7B, 0x6D, 0x2E, 0x5F, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x44, 0x61, 0x74, 0x61, 0x28, 0x61, 0x2C, 0x62, 0x2B, 0x22, 
+    0x71, 0x75, 0x65, 0x75, 0x65, 0x22, 0x29, 0x2C, 0x6D, 0x2E, 0x5F, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x44, 0x61, 0x74, 
+    0x61, 0x28, 0x61, 0x2C, 0x63, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 
+    0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x71, 0x75, 0x65, 0x75, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x32, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x26, 
+    0x26, 0x28, 0x62, 0x3D, 0x61, 0x2C, 0x61, 0x3D, 0x22, 0x66, 0x78, 0x22, 0x2C, 0x63, 0x2D, 0x2D, 0x29, 0x2C, 0x61, 0x72, 
+    0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3C, 0x63, 0x3F, 0x6D, 0x2E, 0x71, 
+    0x75, 0x65, 0x75, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x2C, 0x61, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 
+    0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x62, 0x3F, 0x74, 0x68, 0x69, 0x73, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 
+    0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x6D, 
+    0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x2C, 0x62, 0x29, 0x3B, 0x6D, 0x2E, 0x5F, 
+    0x71, 0x75, 0x65, 0x75, 0x65, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x29, 0x2C, 0x22, 
+    0x66, 0x78, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x26, 0x26, 0x22, 0x69, 0x6E, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 
+    0x22, 0x21, 0x3D, 0x3D, 0x63, 0x5B, 0x30, 0x5D, 0x26, 0x26, 0x6D, 0x2E, 0x64, 0x65, 0x71, 0x75, 0x65, 0x75, 0x65, 0x28, 
+    0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x64, 0x65, 0x71, 0x75, 0x65, 0x75, 0x65, 0x3A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 
+    0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 
+    0x2E, 0x64, 0x65, 0x71, 0x75, 0x65, 0x75, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 
+    0x63, 0x6C, 0x65, 0x61, 0x72, 0x51, 0x75, 0x65, 0x75, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 
+    0x28, 0x61, 0x7C, 0x7C, 0x22, 0x66, 0x78, 0x22, 0x2C, 0x5B, 0x5D, 0x29, 0x7D, 0x2C, 0x70, 0x72, 0x6F, 0x6D, 0x69, 0x73, 
+    0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 
+    0x63, 0x2C, 0x64, 0x3D, 0x31, 0x2C, 0x65, 0x3D, 0x6D, 0x2E, 0x44, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x28, 0x29, 
+    0x2C, 0x66, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x67, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x2C, 0x68, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x2D, 0x2D, 0x64, 0x7C, 0x7C, 
+    0x65, 0x2E, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x57, 0x69, 0x74, 0x68, 0x28, 0x66, 0x2C, 0x5B, 0x66, 0x5D, 0x29, 
+    0x7D, 0x3B, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 
+    0x26, 0x26, 0x28, 0x62, 0x3D, 0x61, 0x2C, 0x61, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x29, 0x2C, 0x61, 0x3D, 0x61, 
+    0x7C, 0x7C, 0x22, 0x66, 0x78, 0x22, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x67, 0x2D, 0x2D, 0x29, 0x63, 0x3D, 0x6D, 
+    0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x66, 0x5B, 0x67, 0x5D, 0x2C, 0x61, 0x2B, 0x22, 0x71, 0x75, 0x65, 0x75, 0x65, 
+    0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x22, 0x29, 0x2C, 0x63, 0x26, 0x26, 0x63, 0x2E, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x26, 0x26, 
+    0x28, 0x64, 0x2B, 0x2B, 0x2C, 0x63, 0x2E, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x68, 0x29, 0x29, 
+    0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x68, 0x28, 0x29, 0x2C, 0x65, 0x2E, 0x70, 0x72, 0x6F, 0x6D, 0x69, 0x73, 
+    0x65, 0x28, 0x62, 0x29, 0x7D, 0x7D, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x53, 0x3D, 0x2F, 0x5B, 0x2B, 0x2D, 0x5D, 0x3F, 
+    0x28, 0x3F, 0x3A, 0x5C, 0x64, 0x2A, 0x5C, 0x2E, 0x7C, 0x29, 0x5C, 0x64, 0x2B, 0x28, 0x3F, 0x3A, 0x5B, 0x65, 0x45, 0x5D, 
+    0x5B, 0x2B, 0x2D, 0x5D, 0x3F, 0x5C, 0x64, 0x2B, 0x7C, 0x29, 0x2F, 0x2E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2C, 0x54, 
+    0x3D, 0x5B, 0x22, 0x54, 0x6F, 0x70, 0x22, 0x2C, 0x22, 0x52, 0x69, 0x67, 0x68, 0x74, 0x22, 0x2C, 0x22, 0x42, 0x6F, 0x74, 
+    0x74, 0x6F, 0x6D, 0x22, 0x2C, 0x22, 0x4C, 0x65, 0x66, 0x74, 0x22, 0x5D, 0x2C, 0x55, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3D, 0x62, 0x7C, 
+    0x7C, 0x61, 0x2C, 0x22, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 
+    0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x22, 0x29, 0x7C, 0x7C, 0x21, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 
+    0x69, 0x6E, 0x73, 0x28, 0x61, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 
+    0x61, 0x29, 0x7D, 0x2C, 0x56, 0x3D, 0x6D, 0x2E, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x29, 0x7B, 0x76, 
+    0x61, 0x72, 0x20, 0x68, 0x3D, 0x30, 0x2C, 0x69, 0x3D, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x6A, 0x3D, 
+    0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x63, 0x3B, 0x69, 0x66, 0x28, 0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 
+    0x3D, 0x3D, 0x6D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x28, 0x63, 0x29, 0x29, 0x7B, 0x65, 0x3D, 0x21, 0x30, 0x3B, 0x66, 0x6F, 
+    0x72, 0x28, 0x68, 0x20, 0x69, 0x6E, 0x20, 0x63, 0x29, 0x6D, 0x2E, 0x61, 0x63, 0x63, 0x65, 0x73, 0x73, 0x28, 0x61, 0x2C, 
+    0x62, 0x2C, 0x68, 0x2C, 0x63, 0x5B, 0x68, 0x5D, 0x2C, 0x21, 0x30, 0x2C, 0x66, 0x2C, 0x67, 0x29, 0x7D, 0x65, 0x6C, 0x73, 
+    0x65, 0x20, 0x69, 0x66, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x64, 0x26, 0x26, 0x28, 0x65, 0x3D, 
+    0x21, 0x30, 0x2C, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x64, 0x29, 0x7C, 0x7C, 
+    0x28, 0x67, 0x3D, 0x21, 0x30, 0x29, 0x2C, 0x6A, 0x26, 0x26, 0x28, 0x67, 0x3F, 0x28, 0x62, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 
+    0x28, 0x61, 0x2C, 0x64, 0x29, 0x2C, 0x62, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x3A, 0x28, 0x6A, 0x3D, 0x62, 0x2C, 0x62, 
+    0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x6A, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x6D, 0x28, 0x61, 0x29, 0x2C, 0x63, 0x29, 0x7D, 0x29, 
+    0x29, 0x2C, 0x62, 0x29, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x3B, 0x69, 0x3E, 0x68, 0x3B, 0x68, 0x2B, 0x2B, 0x29, 0x62, 0x28, 
+    0x61, 0x5B, 0x68, 0x5D, 0x2C, 0x63, 0x2C, 0x67, 0x3F, 0x64, 0x3A, 0x64, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x5B, 
+    0x68, 0x5D, 0x2C, 0x68, 0x2C, 0x62, 0x28, 0x61, 0x5B, 0x68, 0x5D, 0x2C, 0x63, 0x29, 0x29, 0x29, 0x3B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x65, 0x3F, 0x61, 0x3A, 0x6A, 0x3F, 0x62, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x29, 0x3A, 
+    0x69, 0x3F, 0x62, 0x28, 0x61, 0x5B, 0x30, 0x5D, 0x2C, 0x63, 0x29, 0x3A, 0x66, 0x7D, 0x2C, 0x57, 0x3D, 0x2F, 0x5E, 0x28, 
+    0x3F, 0x3A, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x7C, 0x72, 0x61, 0x64, 0x69, 0x6F, 0x29, 0x24, 0x2F, 0x69, 
+    0x3B, 0x21, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x79, 
+    0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x69, 0x6E, 0x70, 0x75, 
+    0x74, 0x22, 0x29, 0x2C, 0x62, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 
+    0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x2C, 0x63, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x44, 
+    0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x46, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x29, 0x3B, 0x69, 0x66, 
+    0x28, 0x62, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x22, 0x20, 0x20, 0x3C, 0x6C, 0x69, 0x6E, 
+    0x6B, 0x2F, 0x3E, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x61, 
+    0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x27, 0x2F, 0x61, 0x27, 0x3E, 0x61, 0x3C, 0x2F, 0x61, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 
+    0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x27, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x27, 0x2F, 0x3E, 
+    0x22, 0x2C, 0x6B, 0x2E, 0x6C, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x57, 0x68, 0x69, 0x74, 0x65, 0x73, 0x70, 0x61, 0x63, 
+    0x65, 0x3D, 0x33, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x2E, 0x6E, 
+    0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x2C, 0x6B, 0x2E, 0x74, 0x62, 0x6F, 0x64, 0x79, 0x3D, 0x21, 0x62, 0x2E, 0x67, 
+    0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 
+    0x22, 0x74, 0x62, 0x6F, 0x64, 0x79, 0x22, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x6B, 0x2E, 0x68, 0x74, 
+    0x6D, 0x6C, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x3D, 0x21, 0x21, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x45, 
+    0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x22, 0x6C, 0x69, 
+    0x6E, 0x6B, 0x22, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x6B, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x35, 0x43, 
+    0x6C, 0x6F, 0x6E, 0x65, 0x3D, 0x22, 0x3C, 0x3A, 0x6E, 0x61, 0x76, 0x3E, 0x3C, 0x2F, 0x3A, 0x6E, 0x61, 0x76, 0x3E, 0x22, 
+    0x21, 0x3D, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 
+    0x6E, 0x61, 0x76, 0x22, 0x29, 0x2E, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x4E, 0x6F, 0x64, 0x65, 0x28, 0x21, 0x30, 0x29, 0x2E, 
+    0x6F, 0x75, 0x74, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x2C, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x63, 0x68, 
+    0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x2C, 0x61, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x3D, 0x21, 0x30, 
+    0x2C, 0x63, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x61, 0x29, 0x2C, 0x6B, 0x2E, 
+    0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x3D, 0x61, 0x2E, 0x63, 0x68, 0x65, 0x63, 
+    0x6B, 0x65, 0x64, 0x2C, 0x62, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x22, 0x3C, 0x74, 0x65, 
+    0x78, 0x74, 0x61, 0x72, 0x65, 0x61, 0x3E, 0x78, 0x3C, 0x2F, 0x74, 0x65, 0x78, 0x74, 0x61, 0x72, 0x65, 0x61, 0x3E, 0x22, 
+    0x2C, 0x6B, 0x2E, 0x6E, 0x6F, 0x43, 0x6C, 0x6F, 0x6E, 0x65, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x3D, 0x21, 0x21, 
+    0x62, 0x2E, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x4E, 0x6F, 0x64, 0x65, 0x28, 0x21, 0x30, 0x29, 0x2E, 0x6C, 0x61, 0x73, 0x74, 
+    0x43, 0x68, 0x69, 0x6C, 0x64, 0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x63, 
+    0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x62, 0x29, 0x2C, 0x62, 0x2E, 0x69, 0x6E, 
+    0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x22, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 
+    0x3D, 0x27, 0x72, 0x61, 0x64, 0x69, 0x6F, 0x27, 0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x3D, 0x27, 0x63, 0x68, 
+    0x65, 0x63, 0x6B, 0x65, 0x64, 0x27, 0x20, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x27, 0x74, 0x27, 0x2F, 0x3E, 0x22, 0x2C, 0x6B, 
+    0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x43, 0x6C, 0x6F, 0x6E, 0x65, 0x3D, 0x62, 0x2E, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x4E, 
+    0x6F, 0x64, 0x65, 0x28, 0x21, 0x30, 0x29, 0x2E, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x4E, 0x6F, 0x64, 0x65, 0x28, 0x21, 0x30, 
+    0x29, 0x2E, 0x6C, 0x61, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x2C, 
+    0x6B, 0x2E, 0x6E, 0x6F, 0x43, 0x6C, 0x6F, 0x6E, 0x65, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x3D, 0x21, 0x30, 0x2C, 0x62, 0x2E, 
+    0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x26, 0x26, 0x28, 0x62, 0x2E, 0x61, 0x74, 0x74, 0x61, 
+    0x63, 0x68, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x6F, 0x6E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x22, 0x2C, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6B, 0x2E, 0x6E, 0x6F, 0x43, 0x6C, 0x6F, 0x6E, 0x65, 0x45, 0x76, 
+    0x65, 0x6E, 0x74, 0x3D, 0x21, 0x31, 0x7D, 0x29, 0x2C, 0x62, 0x2E, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x4E, 0x6F, 0x64, 0x65, 
+    0x28, 0x21, 0x30, 0x29, 0x2E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x28, 0x29, 0x29, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 
+    0x6B, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x45, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x29, 0x7B, 0x6B, 0x2E, 0x64, 
+    0x65, 0x6C, 0x65, 0x74, 0x65, 0x45, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x3D, 0x21, 0x30, 0x3B, 0x74, 0x72, 0x79, 0x7B, 
+    0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 
+    0x64, 0x29, 0x7B, 0x6B, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x45, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x3D, 0x21, 
+    0x31, 0x7D, 0x7D, 0x7D, 0x28, 0x29, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 
+    0x65, 0x6E, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x62, 0x20, 0x69, 0x6E, 0x7B, 
+    0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x3A, 0x21, 0x30, 0x2C, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3A, 0x21, 0x30, 0x2C, 
+    0x66, 0x6F, 0x63, 0x75, 0x73, 0x69, 0x6E, 0x3A, 0x21, 0x30, 0x7D, 0x29, 0x63, 0x3D, 0x22, 0x6F, 0x6E, 0x22, 0x2B, 0x62, 
+    0x2C, 0x28, 0x6B, 0x5B, 0x62, 0x2B, 0x22, 0x42, 0x75, 0x62, 0x62, 0x6C, 0x65, 0x73, 0x22, 0x5D, 0x3D, 0x63, 0x20, 0x69, 
+    0x6E, 0x20, 0x61, 0x29, 0x7C, 0x7C, 0x28, 0x64, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 
+    0x65, 0x28, 0x63, 0x2C, 0x22, 0x74, 0x22, 0x29, 0x2C, 0x6B, 0x5B, 0x62, 0x2B, 0x22, 0x42, 0x75, 0x62, 0x62, 0x6C, 0x65, 
+    0x73, 0x22, 0x5D, 0x3D, 0x64, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x73, 0x5B, 0x63, 0x5D, 0x2E, 
+    0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x29, 0x3B, 0x64, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 
+    0x7D, 0x28, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x58, 0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 0x69, 0x6E, 0x70, 0x75, 0x74, 
+    0x7C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x7C, 0x74, 0x65, 0x78, 0x74, 0x61, 0x72, 0x65, 0x61, 0x29, 0x24, 0x2F, 0x69, 
+    0x2C, 0x59, 0x3D, 0x2F, 0x5E, 0x6B, 0x65, 0x79, 0x2F, 0x2C, 0x5A, 0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 0x6D, 0x6F, 0x75, 
+    0x73, 0x65, 0x7C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x7C, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x6D, 0x65, 
+    0x6E, 0x75, 0x29, 0x7C, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x2F, 0x2C, 0x24, 0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 0x66, 0x6F, 
+    0x63, 0x75, 0x73, 0x69, 0x6E, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x7C, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x6F, 0x75, 0x74, 0x62, 
+    0x6C, 0x75, 0x72, 0x29, 0x24, 0x2F, 0x2C, 0x5F, 0x3D, 0x2F, 0x5E, 0x28, 0x5B, 0x5E, 0x2E, 0x5D, 0x2A, 0x29, 0x28, 0x3F, 
+    0x3A, 0x5C, 0x2E, 0x28, 0x2E, 0x2B, 0x29, 0x7C, 0x29, 0x24, 0x2F, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x61, 0x62, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x30, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x62, 0x62, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x31, 0x7D, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x63, 0x62, 0x28, 0x29, 0x7B, 0x74, 0x72, 0x79, 0x7B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x79, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x7D, 0x63, 
+    0x61, 0x74, 0x63, 0x68, 0x28, 0x61, 0x29, 0x7B, 0x7D, 0x7D, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x3D, 0x7B, 0x67, 
+    0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x3A, 0x7B, 0x7D, 0x2C, 0x61, 0x64, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x66, 0x2C, 0x67, 
+    0x2C, 0x68, 0x2C, 0x69, 0x2C, 0x6A, 0x2C, 0x6B, 0x2C, 0x6C, 0x2C, 0x6E, 0x2C, 0x6F, 0x2C, 0x70, 0x2C, 0x71, 0x2C, 0x72, 
+    0x3D, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x61, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x72, 0x29, 0x7B, 0x63, 0x2E, 
+    0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x26, 0x26, 0x28, 0x69, 0x3D, 0x63, 0x2C, 0x63, 0x3D, 0x69, 0x2E, 0x68, 0x61, 
+    0x6E, 0x64, 0x6C, 0x65, 0x72, 0x2C, 0x65, 0x3D, 0x69, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x29, 0x2C, 
+    0x63, 0x2E, 0x67, 0x75, 0x69, 0x64, 0x7C, 0x7C, 0x28, 0x63, 0x2E, 0x67, 0x75, 0x69, 0x64, 0x3D, 0x6D, 0x2E, 0x67, 0x75, 
+    0x69, 0x64, 0x2B, 0x2B, 0x29, 0x2C, 0x28, 0x67, 0x3D, 0x72, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x7C, 0x7C, 
+    0x28, 0x67, 0x3D, 0x72, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x3D, 0x7B, 0x7D, 0x29, 0x2C, 0x28, 0x6B, 0x3D, 0x72, 
+    0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x29, 0x7C, 0x7C, 0x28, 0x6B, 0x3D, 0x72, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 
+    0x65, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x6D, 0x3D, 0x3D, 0x3D, 0x4B, 0x7C, 0x7C, 0x61, 0x26, 0x26, 0x6D, 0x2E, 
+    0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x65, 0x64, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 
+    0x74, 0x79, 0x70, 0x65, 0x3F, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3A, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 
+    0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x6B, 0x2E, 0x65, 0x6C, 0x65, 
+    0x6D, 0x2C, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x7D, 0x2C, 0x6B, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 
+    0x3D, 0x61, 0x29, 0x2C, 0x62, 0x3D, 0x28, 0x62, 0x7C, 0x7C, 0x22, 0x22, 0x29, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x28, 
+    0x45, 0x29, 0x7C, 0x7C, 0x5B, 0x22, 0x22, 0x5D, 0x2C, 0x68, 0x3D, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 
+    0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x68, 0x2D, 0x2D, 0x29, 0x66, 0x3D, 0x5F, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x62, 
+    0x5B, 0x68, 0x5D, 0x29, 0x7C, 0x7C, 0x5B, 0x5D, 0x2C, 0x6F, 0x3D, 0x71, 0x3D, 0x66, 0x5B, 0x31, 0x5D, 0x2C, 0x70, 0x3D, 
+    0x28, 0x66, 0x5B, 0x32, 0x5D, 0x7C, 0x7C, 0x22, 0x22, 0x29, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x28, 0x22, 0x2E, 0x22, 
+    0x29, 0x2E, 0x73, 0x6F, 0x72, 0x74, 0x28, 0x29, 0x2C, 0x6F, 0x26, 0x26, 0x28, 0x6A, 0x3D, 0x6D, 0x2E, 0x65, 0x76, 0x65, 
+    0x6E, 0x74, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x5B, 0x6F, 0x5D, 0x7C, 0x7C, 0x7B, 0x7D, 0x2C, 0x6F, 0x3D, 
+    0x28, 0x65, 0x3F, 0x6A, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x67, 0x61, 0x74, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3A, 0x6A, 0x2E, 
+    0x62, 0x69, 0x6E, 0x64, 0x54, 0x79, 0x70, 0x65, 0x29, 0x7C, 0x7C, 0x6F, 0x2C, 0x6A, 0x3D, 0x6D, 0x2E, 0x65, 0x76, 0x65, 
+    0x6E, 0x74, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x5B, 0x6F, 0x5D, 0x7C, 0x7C, 0x7B, 0x7D, 0x2C, 0x6C, 0x3D, 
+    0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x6F, 0x2C, 0x6F, 0x72, 0x69, 
+    0x67, 0x54, 0x79, 0x70, 0x65, 0x3A, 0x71, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x64, 0x2C, 0x68, 0x61, 0x6E, 0x64, 0x6C, 
+    0x65, 0x72, 0x3A, 0x63, 0x2C, 0x67, 0x75, 0x69, 0x64, 0x3A, 0x63, 0x2E, 0x67, 0x75, 0x69, 0x64, 0x2C, 0x73, 0x65, 0x6C, 
+    0x65, 0x63, 0x74, 0x6F, 0x72, 0x3A, 0x65, 0x2C, 0x6E, 0x65, 0x65, 0x64, 0x73, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 
+    0x3A, 0x65, 0x26, 0x26, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x72, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x2E, 0x6E, 0x65, 0x65, 
+    0x64, 0x73, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x65, 0x29, 0x2C, 0x6E, 0x61, 
+    0x6D, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3A, 0x70, 0x2E, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x22, 0x2E, 0x22, 0x29, 0x7D, 
+    0x2C, 0x69, 0x29, 0x2C, 0x28, 0x6E, 0x3D, 0x67, 0x5B, 0x6F, 0x5D, 0x29, 0x7C, 0x7C, 0x28, 0x6E, 0x3D, 0x67, 0x5B, 0x6F, 
+    0x5D, 0x3D, 0x5B, 0x5D, 0x2C, 0x6E, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x67, 0x61, 0x74, 0x65, 0x43, 0x6F, 0x75, 0x6E, 0x74, 
+    0x3D, 0x30, 0x2C, 0x6A, 0x2E, 0x73, 0x65, 0x74, 0x75, 0x70, 0x26, 0x26, 0x6A, 0x2E, 0x73, 0x65, 0x74, 0x75, 0x70, 0x2E, 
+    0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2C, 0x64, 0x2C, 0x70, 0x2C, 0x6B, 0x29, 0x21, 0x3D, 0x3D, 0x21, 0x31, 0x7C, 0x7C, 
+    0x28, 0x61, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x3F, 
+    0x61, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x6F, 
+    0x2C, 0x6B, 0x2C, 0x21, 0x31, 0x29, 0x3A, 0x61, 0x2E, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x45, 0x76, 0x65, 0x6E, 0x74, 
+    0x26, 0x26, 0x61, 0x2E, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x6F, 0x6E, 0x22, 
+    0x2B, 0x6F, 0x2C, 0x6B, 0x29, 0x29, 0x29, 0x2C, 0x6A, 0x2E, 0x61, 0x64, 0x64, 0x26, 0x26, 0x28, 0x6A, 0x2E, 0x61, 0x64, 
+    0x64, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2C, 0x6C, 0x29, 0x2C, 0x6C, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 
+    0x72, 0x2E, 0x67, 0x75, 0x69, 0x64, 0x7C, 0x7C, 0x28, 0x6C, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x2E, 0x67, 
+    0x75, 0x69, 0x64, 0x3D, 0x63, 0x2E, 0x67, 0x75, 0x69, 0x64, 0x29, 0x29, 0x2C, 0x65, 0x3F, 0x6E, 0x2E, 0x73, 0x70, 0x6C, 
+    0x69, 0x63, 0x65, 0x28, 0x6E, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x67, 0x61, 0x74, 0x65, 0x43, 0x6F, 0x75, 0x6E, 0x74, 0x2B, 
+    0x2B, 0x2C, 0x30, 0x2C, 0x6C, 0x29, 0x3A, 0x6E, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x6C, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x2E, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x5B, 0x6F, 0x5D, 0x3D, 0x21, 0x30, 0x29, 0x3B, 0x61, 
+    0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x7D, 0x7D, 0x2C, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x66, 
+    0x2C, 0x67, 0x2C, 0x68, 0x2C, 0x69, 0x2C, 0x6A, 0x2C, 0x6B, 0x2C, 0x6C, 0x2C, 0x6E, 0x2C, 0x6F, 0x2C, 0x70, 0x2C, 0x71, 
+    0x2C, 0x72, 0x3D, 0x6D, 0x2E, 0x68, 0x61, 0x73, 0x44, 0x61, 0x74, 0x61, 0x28, 0x61, 0x29, 0x26, 0x26, 0x6D, 0x2E, 0x5F, 
+    0x64, 0x61, 0x74, 0x61, 0x28, 0x61, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x72, 0x26, 0x26, 0x28, 0x6B, 0x3D, 0x72, 0x2E, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x29, 0x7B, 0x62, 0x3D, 0x28, 0x62, 0x7C, 0x7C, 0x22, 0x22, 0x29, 0x2E, 0x6D, 0x61, 
+    0x74, 0x63, 0x68, 0x28, 0x45, 0x29, 0x7C, 0x7C, 0x5B, 0x22, 0x22, 0x5D, 0x2C, 0x6A, 0x3D, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 
+    0x67, 0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x6A, 0x2D, 0x2D, 0x29, 0x69, 0x66, 0x28, 0x68, 0x3D, 0x5F, 
+    0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x62, 0x5B, 0x6A, 0x5D, 0x29, 0x7C, 0x7C, 0x5B, 0x5D, 0x2C, 0x6F, 0x3D, 0x71, 0x3D, 
+    0x68, 0x5B, 0x31, 0x5D, 0x2C, 0x70, 0x3D, 0x28, 0x68, 0x5B, 0x32, 0x5D, 0x7C, 0x7C, 0x22, 0x22, 0x29, 0x2E, 0x73, 0x70, 
+    0x6C, 0x69, 0x74, 0x28, 0x22, 0x2E, 0x22, 0x29, 0x2E, 0x73, 0x6F, 0x72, 0x74, 0x28, 0x29, 0x2C, 0x6F, 0x29, 0x7B, 0x6C, 
+    0x3D, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x5B, 0x6F, 0x5D, 0x7C, 
+    0x7C, 0x7B, 0x7D, 0x2C, 0x6F, 0x3D, 0x28, 0x64, 0x3F, 0x6C, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x67, 0x61, 0x74, 0x65, 0x54, 
+    0x79, 0x70, 0x65, 0x3A, 0x6C, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x54, 0x79, 0x70, 0x65, 0x29, 0x7C, 0x7C, 0x6F, 0x2C, 0x6E, 
+    0x3D, 0x6B, 0x5B, 0x6F, 0x5D, 0x7C, 0x7C, 0x5B, 0x5D, 0x2C, 0x68, 0x3D, 0x68, 0x5B, 0x32, 0x5D, 0x26, 0x26, 0x6E, 0x65, 
+    0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x28, 0x5E, 0x7C, 0x5C, 0x5C, 0x2E, 0x29, 0x22, 0x2B, 0x70, 
+    0x2E, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x22, 0x5C, 0x5C, 0x2E, 0x28, 0x3F, 0x3A, 0x2E, 0x2A, 0x5C, 0x5C, 0x2E, 0x7C, 0x29, 
+    0x22, 0x29, 0x2B, 0x22, 0x28, 0x5C, 0x5C, 0x2E, 0x7C, 0x24, 0x29, 0x22, 0x29, 0x2C, 0x69, 0x3D, 0x66, 0x3D, 0x6E, 0x2E, 
+    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x66, 0x2D, 0x2D, 0x29, 0x67, 0x3D, 0x6E, 
+    0x5B, 0x66, 0x5D, 0x2C, 0x21, 0x65, 0x26, 0x26, 0x71, 0x21, 0x3D, 0x3D, 0x67, 0x2E, 0x6F, 0x72, 0x69, 0x67, 0x54, 0x79, 
+    0x70, 0x65, 0x7C, 0x7C, 0x63, 0x26, 0x26, 0x63, 0x2E, 0x67, 0x75, 0x69, 0x64, 0x21, 0x3D, 0x3D, 0x67, 0x2E, 0x67, 0x75, 
+    0x69, 0x64, 0x7C, 0x7C, 0x68, 0x26, 0x26, 0x21, 0x68, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x67, 0x2E, 0x6E, 0x61, 0x6D, 
+    0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x29, 0x7C, 0x7C, 0x64, 0x26, 0x26, 0x64, 0x21, 0x3D, 0x3D, 0x67, 0x2E, 0x73, 0x65, 
+    0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x26, 0x26, 0x28, 0x22, 0x2A, 0x2A, 0x22, 0x21, 0x3D, 0x3D, 0x64, 0x7C, 0x7C, 0x21, 
+    0x67, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x29, 0x7C, 0x7C, 0x28, 0x6E, 0x2E, 0x73, 0x70, 0x6C, 0x69, 
+    0x63, 0x65, 0x28, 0x66, 0x2C, 0x31, 0x29, 0x2C, 0x67, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x26, 0x26, 
+    0x6E, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x67, 0x61, 0x74, 0x65, 0x43, 0x6F, 0x75, 0x6E, 0x74, 0x2D, 0x2D, 0x2C, 0x6C, 0x2E, 
+    0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x26, 0x26, 0x6C, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x2E, 0x63, 0x61, 0x6C, 
+    0x6C, 0x28, 0x61, 0x2C, 0x67, 0x29, 0x29, 0x3B, 0x69, 0x26, 0x26, 0x21, 0x6E, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 
+    0x26, 0x26, 0x28, 0x6C, 0x2E, 0x74, 0x65, 0x61, 0x72, 0x64, 0x6F, 0x77, 0x6E, 0x26, 0x26, 0x6C, 0x2E, 0x74, 0x65, 0x61, 
+    0x72, 0x64, 0x6F, 0x77, 0x6E, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2C, 0x70, 0x2C, 0x72, 0x2E, 0x68, 0x61, 0x6E, 
+    0x64, 0x6C, 0x65, 0x29, 0x21, 0x3D, 0x3D, 0x21, 0x31, 0x7C, 0x7C, 0x6D, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x45, 
+    0x76, 0x65, 0x6E, 0x74, 0x28, 0x61, 0x2C, 0x6F, 0x2C, 0x72, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x29, 0x2C, 0x64, 
+    0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x6B, 0x5B, 0x6F, 0x5D, 0x29, 0x7D, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x66, 0x6F, 0x72, 
+    0x28, 0x6F, 0x20, 0x69, 0x6E, 0x20, 0x6B, 0x29, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 
+    0x76, 0x65, 0x28, 0x61, 0x2C, 0x6F, 0x2B, 0x62, 0x5B, 0x6A, 0x5D, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x21, 0x30, 0x29, 0x3B, 
+    0x6D, 0x2E, 0x69, 0x73, 0x45, 0x6D, 0x70, 0x74, 0x79, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6B, 0x29, 0x26, 0x26, 
+    0x28, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x72, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2C, 0x6D, 0x2E, 0x5F, 
+    0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x44, 0x61, 0x74, 0x61, 0x28, 0x61, 0x2C, 0x22, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 
+    0x22, 0x29, 0x29, 0x7D, 0x7D, 0x2C, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x66, 0x2C, 0x67, 0x2C, 
+    0x68, 0x2C, 0x69, 0x2C, 0x6B, 0x2C, 0x6C, 0x2C, 0x6E, 0x2C, 0x6F, 0x3D, 0x5B, 0x64, 0x7C, 0x7C, 0x79, 0x5D, 0x2C, 0x70, 
+    0x3D, 0x6A, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x62, 0x2C, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x29, 0x3F, 0x62, 0x2E, 
+    0x74, 0x79, 0x70, 0x65, 0x3A, 0x62, 0x2C, 0x71, 0x3D, 0x6A, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x62, 0x2C, 0x22, 0x6E, 
+    0x61, 0x6D, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x22, 0x29, 0x3F, 0x62, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x70, 0x61, 
+    0x63, 0x65, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x28, 0x22, 0x2E, 0x22, 0x29, 0x3A, 0x5B, 0x5D, 0x3B, 0x69, 0x66, 0x28, 
+    0x68, 0x3D, 0x6C, 0x3D, 0x64, 0x3D, 0x64, 0x7C, 0x7C, 0x79, 0x2C, 0x33, 0x21, 0x3D, 0x3D, 0x64, 0x2E, 0x6E, 0x6F, 0x64, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x38, 0x21, 0x3D, 0x3D, 0x64, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 
+    0x65, 0x26, 0x26, 0x21, 0x24, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x70, 0x2B, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 
+    0x2E, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x65, 0x64, 0x29, 0x26, 0x26, 0x28, 0x70, 0x2E, 0x69, 0x6E, 0x64, 0x65, 
+    0x78, 0x4F, 0x66, 0x28, 0x22, 0x2E, 0x22, 0x29, 0x3E, 0x3D, 0x30, 0x26, 0x26, 0x28, 0x71, 0x3D, 0x70, 0x2E, 0x73, 0x70, 
+    0x6C, 0x69, 0x74, 0x28, 0x22, 0x2E, 0x22, 0x29, 0x2C, 0x70, 0x3D, 0x71, 0x2E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x29, 
+    0x2C, 0x71, 0x2E, 0x73, 0x6F, 0x72, 0x74, 0x28, 0x29, 0x29, 0x2C, 0x67, 0x3D, 0x70, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 
+    0x4F, 0x66, 0x28, 0x22, 0x3A, 0x22, 0x29, 0x3C, 0x30, 0x26, 0x26, 0x22, 0x6F, 0x6E, 0x22, 0x2B, 0x70, 0x2C, 0x62, 0x3D, 
+    0x62, 0x5B, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x5D, 0x3F, 0x62, 0x3A, 0x6E, 0x65, 0x77, 0x20, 0x6D, 
+    0x2E, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x70, 0x2C, 0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 
+    0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x26, 0x26, 0x62, 0x29, 0x2C, 0x62, 0x2E, 0x69, 0x73, 0x54, 0x72, 0x69, 0x67, 
+    0x67, 0x65, 0x72, 0x3D, 0x65, 0x3F, 0x32, 0x3A, 0x33, 0x2C, 0x62, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x70, 0x61, 0x63, 
+    0x65, 0x3D, 0x71, 0x2E, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x22, 0x2E, 0x22, 0x29, 0x2C, 0x62, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 
+    0x73, 0x70, 0x61, 0x63, 0x65, 0x5F, 0x72, 0x65, 0x3D, 0x62, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 
+    0x3F, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x28, 0x5E, 0x7C, 0x5C, 0x5C, 0x2E, 0x29, 
+    0x22, 0x2B, 0x71, 0x2E, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 0x22, 0x5C, 0x5C, 0x2E, 0x28, 0x3F, 0x3A, 0x2E, 0x2A, 0x5C, 0x5C, 
+    0x2E, 0x7C, 0x29, 0x22, 0x29, 0x2B, 0x22, 0x28, 0x5C, 0x5C, 0x2E, 0x7C, 0x24, 0x29, 0x22, 0x29, 0x3A, 0x6E, 0x75, 0x6C, 
+    0x6C, 0x2C, 0x62, 0x2E, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x62, 0x2E, 
+    0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x7C, 0x7C, 0x28, 0x62, 0x2E, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x64, 0x29, 
+    0x2C, 0x63, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x63, 0x3F, 0x5B, 0x62, 0x5D, 0x3A, 0x6D, 0x2E, 0x6D, 0x61, 0x6B, 
+    0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x63, 0x2C, 0x5B, 0x62, 0x5D, 0x29, 0x2C, 0x6B, 0x3D, 0x6D, 0x2E, 0x65, 0x76, 
+    0x65, 0x6E, 0x74, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x5B, 0x70, 0x5D, 0x7C, 0x7C, 0x7B, 0x7D, 0x2C, 0x65, 
+    0x7C, 0x7C, 0x21, 0x6B, 0x2E, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x7C, 0x7C, 0x6B, 0x2E, 0x74, 0x72, 0x69, 0x67, 
+    0x67, 0x65, 0x72, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x64, 0x2C, 0x63, 0x29, 0x21, 0x3D, 0x3D, 0x21, 0x31, 0x29, 
+    0x29, 0x7B, 0x69, 0x66, 0x28, 0x21, 0x65, 0x26, 0x26, 0x21, 0x6B, 0x2E, 0x6E, 0x6F, 0x42, 0x75, 0x62, 0x62, 0x6C, 0x65, 
+    0x26, 0x26, 0x21, 0x6D, 0x2E, 0x69, 0x73, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x28, 0x64, 0x29, 0x29, 0x7B, 0x66, 0x6F, 
+    0x72, 0x28, 0x69, 0x3D, 0x6B, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x67, 0x61, 0x74, 0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 
+    0x70, 0x2C, 0x24, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x69, 0x2B, 0x70, 0x29, 0x7C, 0x7C, 0x28, 0x68, 0x3D, 0x68, 0x2E, 
+    0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x29, 0x3B, 0x68, 0x3B, 0x68, 0x3D, 0x68, 0x2E, 0x70, 0x61, 
+    0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x29, 0x6F, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x68, 0x29, 0x2C, 0x6C, 
+    0x3D, 0x68, 0x3B, 0x6C, 0x3D, 0x3D, 0x3D, 0x28, 0x64, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 
+    0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x79, 0x29, 0x26, 0x26, 0x6F, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x6C, 0x2E, 0x64, 0x65, 
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x56, 0x69, 0x65, 0x77, 0x7C, 0x7C, 0x6C, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x57, 
+    0x69, 0x6E, 0x64, 0x6F, 0x77, 0x7C, 0x7C, 0x61, 0x29, 0x7D, 0x6E, 0x3D, 0x30, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 
+    0x28, 0x68, 0x3D, 0x6F, 0x5B, 0x6E, 0x2B, 0x2B, 0x5D, 0x29, 0x26, 0x26, 0x21, 0x62, 0x2E, 0x69, 0x73, 0x50, 0x72, 0x6F, 
+    0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x6F, 0x70, 0x70, 0x65, 0x64, 0x28, 0x29, 0x29, 0x62, 0x2E, 
+    0x74, 0x79, 0x70, 0x65, 0x3D, 0x6E, 0x3E, 0x31, 0x3F, 0x69, 0x3A, 0x6B, 0x2E, 0x62, 0x69, 0x6E, 0x64, 0x54, 0x79, 0x70, 
+    0x65, 0x7C, 0x7C, 0x70, 0x2C, 0x66, 0x3D, 0x28, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x68, 0x2C, 0x22, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x73, 0x22, 0x29, 0x7C, 0x7C, 0x7B, 0x7D, 0x29, 0x5B, 0x62, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x5D, 
+    0x26, 0x26, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x68, 0x2C, 0x22, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x22, 
+    0x29, 0x2C, 0x66, 0x26, 0x26, 0x66, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x68, 0x2C, 0x63, 0x29, 0x2C, 0x66, 0x3D, 
+    0x67, 0x26, 0x26, 0x68, 0x5B, 0x67, 0x5D, 0x2C, 0x66, 0x26, 0x26, 0x66, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x26, 0x26, 
+    0x6D, 0x2E, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x44, 0x61, 0x74, 0x61, 0x28, 0x68, 0x29, 0x26, 0x26, 0x28, 0x62, 0x2E, 
+    0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x3D, 0x66, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x68, 0x2C, 0x63, 0x29, 0x2C, 
+    0x62, 0x2E, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x26, 0x26, 0x62, 0x2E, 0x70, 0x72, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x28, 0x29, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x62, 0x2E, 
+    0x74, 0x79, 0x70, 0x65, 0x3D, 0x70, 0x2C, 0x21, 0x65, 0x26, 0x26, 0x21, 0x62, 0x2E, 0x69, 0x73, 0x44, 0x65, 0x66, 0x61, 
+    0x75, 0x6C, 0x74, 0x50, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x65, 0x64, 0x28, 0x29, 0x26, 0x26, 0x28, 0x21, 0x6B, 0x2E, 
+    0x5F, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x7C, 0x7C, 0x6B, 0x2E, 0x5F, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 
+    0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x6F, 0x2E, 0x70, 0x6F, 0x70, 0x28, 0x29, 0x2C, 0x63, 0x29, 0x3D, 0x3D, 0x3D, 
+    0x21, 0x31, 0x29, 0x26, 0x26, 0x6D, 0x2E, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x44, 0x61, 0x74, 0x61, 0x28, 0x64, 0x29, 
+    0x26, 0x26, 0x67, 0x26, 0x26, 0x64, 0x5B, 0x70, 0x5D, 0x26, 0x26, 0x21, 0x6D, 0x2E, 0x69, 0x73, 0x57, 0x69, 0x6E, 0x64, 
+    0x6F, 0x77, 0x28, 0x64, 0x29, 0x29, 0x7B, 0x6C, 0x3D, 0x64, 0x5B, 0x67, 0x5D, 0x2C, 0x6C, 0x26, 0x26, 0x28, 0x64, 0x5B, 
+    0x67, 0x5D, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x74, 0x72, 0x69, 
+    0x67, 0x67, 0x65, 0x72, 0x65, 0x64, 0x3D, 0x70, 0x3B, 0x74, 0x72, 0x79, 0x7B, 0x64, 0x5B, 0x70, 0x5D, 0x28, 0x29, 0x7D, 
+    0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x72, 0x29, 0x7B, 0x7D, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x74, 0x72, 
+    0x69, 0x67, 0x67, 0x65, 0x72, 0x65, 0x64, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x6C, 0x26, 0x26, 0x28, 0x64, 
+    0x5B, 0x67, 0x5D, 0x3D, 0x6C, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x2E, 0x72, 0x65, 0x73, 0x75, 
+    0x6C, 0x74, 0x7D, 0x7D, 0x2C, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x61, 0x3D, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x66, 0x69, 0x78, 0x28, 
+    0x61, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x3D, 0x5B, 
+    0x5D, 0x2C, 0x69, 0x3D, 0x64, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 
+    0x29, 0x2C, 0x6A, 0x3D, 0x28, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x73, 0x22, 0x29, 0x7C, 0x7C, 0x7B, 0x7D, 0x29, 0x5B, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x5D, 
+    0x7C, 0x7C, 0x5B, 0x5D, 0x2C, 0x6B, 0x3D, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 
+    0x61, 0x6C, 0x5B, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x5D, 0x7C, 0x7C, 0x7B, 0x7D, 0x3B, 0x69, 0x66, 0x28, 0x69, 0x5B, 
+    0x30, 0x5D, 0x3D, 0x61, 0x2C, 0x61, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x67, 0x61, 0x74, 0x65, 0x54, 0x61, 0x72, 0x67, 0x65, 
+    0x74, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x21, 0x6B, 0x2E, 0x70, 0x72, 0x65, 0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 
+    0x68, 0x7C, 0x7C, 0x6B, 0x2E, 0x70, 0x72, 0x65, 0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x2E, 0x63, 0x61, 0x6C, 
+    0x6C, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x29, 0x21, 0x3D, 0x3D, 0x21, 0x31, 0x29, 0x7B, 0x68, 0x3D, 0x6D, 0x2E, 
+    0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x73, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 
+    0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x2C, 0x6A, 0x29, 0x2C, 0x62, 0x3D, 0x30, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 
+    0x28, 0x66, 0x3D, 0x68, 0x5B, 0x62, 0x2B, 0x2B, 0x5D, 0x29, 0x26, 0x26, 0x21, 0x61, 0x2E, 0x69, 0x73, 0x50, 0x72, 0x6F, 
+    0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x6F, 0x70, 0x70, 0x65, 0x64, 0x28, 0x29, 0x29, 0x7B, 0x61, 
+    0x2E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x66, 0x2E, 0x65, 0x6C, 0x65, 
+    0x6D, 0x2C, 0x67, 0x3D, 0x30, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x28, 0x65, 0x3D, 0x66, 0x2E, 0x68, 0x61, 0x6E, 
+    0x64, 0x6C, 0x65, 0x72, 0x73, 0x5B, 0x67, 0x2B, 0x2B, 0x5D, 0x29, 0x26, 0x26, 0x21, 0x61, 0x2E, 0x69, 0x73, 0x49, 0x6D, 
+    0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x50, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 
+    0x6F, 0x70, 0x70, 0x65, 0x64, 0x28, 0x29, 0x29, 0x28, 0x21, 0x61, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x70, 0x61, 0x63, 
+    0x65, 0x5F, 0x72, 0x65, 0x7C, 0x7C, 0x61, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x5F, 0x72, 0x65, 
+    0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x65, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x29, 0x29, 0x26, 
+    0x26, 0x28, 0x61, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x4F, 0x62, 0x6A, 0x3D, 0x65, 0x2C, 0x61, 0x2E, 0x64, 0x61, 
+    0x74, 0x61, 0x3D, 0x65, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x2C, 0x63, 0x3D, 0x28, 0x28, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 
+    0x74, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x5B, 0x65, 0x2E, 0x6F, 0x72, 0x69, 0x67, 0x54, 0x79, 0x70, 0x65, 
+    0x5D, 0x7C, 0x7C, 0x7B, 0x7D, 0x29, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x7C, 0x7C, 0x65, 0x2E, 0x68, 0x61, 0x6E, 
+    0x64, 0x6C, 0x65, 0x72, 0x29, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x66, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x2C, 0x69, 
+    0x29, 0x2C, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x63, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x72, 0x65, 0x73, 
+    0x75, 0x6C, 0x74, 0x3D, 0x63, 0x29, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x70, 0x72, 0x65, 0x76, 
+    0x65, 0x6E, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x28, 0x29, 0x2C, 0x61, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x50, 
+    0x72, 0x6F, 0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x29, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x6B, 0x2E, 0x70, 0x6F, 0x73, 0x74, 0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x26, 0x26, 0x6B, 0x2E, 
+    0x70, 0x6F, 0x73, 0x74, 0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 
+    0x69, 0x73, 0x2C, 0x61, 0x29, 0x2C, 0x61, 0x2E, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x7D, 0x7D, 0x2C, 0x68, 0x61, 0x6E, 
+    0x64, 0x6C, 0x65, 0x72, 0x73, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 
+    0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x3D, 0x5B, 0x5D, 0x2C, 0x68, 0x3D, 0x62, 
+    0x2E, 0x64, 0x65, 0x6C, 0x65, 0x67, 0x61, 0x74, 0x65, 0x43, 0x6F, 0x75, 0x6E, 0x74, 0x2C, 0x69, 0x3D, 0x61, 0x2E, 0x74, 
+    0x61, 0x72, 0x67, 0x65, 0x74, 0x3B, 0x69, 0x66, 0x28, 0x68, 0x26, 0x26, 0x69, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x26, 0x26, 0x28, 0x21, 0x61, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x7C, 0x7C, 0x22, 0x63, 0x6C, 0x69, 
+    0x63, 0x6B, 0x22, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x29, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x3B, 0x69, 
+    0x21, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x3B, 0x69, 0x3D, 0x69, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 
+    0x65, 0x7C, 0x7C, 0x74, 0x68, 0x69, 0x73, 0x29, 0x69, 0x66, 0x28, 0x31, 0x3D, 0x3D, 0x3D, 0x69, 0x2E, 0x6E, 0x6F, 0x64, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x28, 0x69, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x21, 0x3D, 
+    0x3D, 0x21, 0x30, 0x7C, 0x7C, 0x22, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x22, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x74, 0x79, 0x70, 
+    0x65, 0x29, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x65, 0x3D, 0x5B, 0x5D, 0x2C, 0x66, 0x3D, 0x30, 0x3B, 0x68, 0x3E, 0x66, 
+    0x3B, 0x66, 0x2B, 0x2B, 0x29, 0x64, 0x3D, 0x62, 0x5B, 0x66, 0x5D, 0x2C, 0x63, 0x3D, 0x64, 0x2E, 0x73, 0x65, 0x6C, 0x65, 
+    0x63, 0x74, 0x6F, 0x72, 0x2B, 0x22, 0x20, 0x22, 0x2C, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x65, 0x5B, 
+    0x63, 0x5D, 0x26, 0x26, 0x28, 0x65, 0x5B, 0x63, 0x5D, 0x3D, 0x64, 0x2E, 0x6E, 0x65, 0x65, 0x64, 0x73, 0x43, 0x6F, 0x6E, 
+    0x74, 0x65, 0x78, 0x74, 0x3F, 0x6D, 0x28, 0x63, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 
+    0x28, 0x69, 0x29, 0x3E, 0x3D, 0x30, 0x3A, 0x6D, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x28, 0x63, 0x2C, 0x74, 0x68, 0x69, 0x73, 
+    0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x5B, 0x69, 0x5D, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x2C, 0x65, 
+    0x5B, 0x63, 0x5D, 0x26, 0x26, 0x65, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x64, 0x29, 0x3B, 0x65, 0x2E, 0x6C, 0x65, 0x6E, 
+    0x67, 0x74, 0x68, 0x26, 0x26, 0x67, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x7B, 0x65, 0x6C, 0x65, 0x6D, 0x3A, 0x69, 0x2C, 
+    0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x73, 0x3A, 0x65, 0x7D, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x68, 0x3C, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x67, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x7B, 
+    0x65, 0x6C, 0x65, 0x6D, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x73, 0x3A, 0x62, 
+    0x2E, 0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x68, 0x29, 0x7D, 0x29, 0x2C, 0x67, 0x7D, 0x2C, 0x66, 0x69, 0x78, 0x3A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x61, 0x5B, 0x6D, 0x2E, 0x65, 0x78, 
+    0x70, 0x61, 0x6E, 0x64, 0x6F, 0x5D, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3B, 0x76, 0x61, 0x72, 0x20, 
+    0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x3D, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x2C, 0x66, 0x3D, 0x61, 0x2C, 0x67, 
+    0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x66, 0x69, 0x78, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x65, 0x5D, 0x3B, 0x67, 0x7C, 
+    0x7C, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x66, 0x69, 0x78, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x65, 0x5D, 0x3D, 0x67, 
+    0x3D, 0x5A, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x65, 0x29, 0x3F, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6D, 0x6F, 0x75, 0x73, 
+    0x65, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x3A, 0x59, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x65, 0x29, 0x3F, 0x74, 0x68, 0x69, 
+    0x73, 0x2E, 0x6B, 0x65, 0x79, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x3A, 0x7B, 0x7D, 0x29, 0x2C, 0x64, 0x3D, 0x67, 0x2E, 0x70, 
+    0x72, 0x6F, 0x70, 0x73, 0x3F, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x73, 0x2E, 0x63, 0x6F, 0x6E, 0x63, 
+    0x61, 0x74, 0x28, 0x67, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x73, 0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x72, 0x6F, 
+    0x70, 0x73, 0x2C, 0x61, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x6D, 0x2E, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x66, 0x29, 0x2C, 
+    0x62, 0x3D, 0x64, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x62, 0x2D, 0x2D, 
+    0x29, 0x63, 0x3D, 0x64, 0x5B, 0x62, 0x5D, 0x2C, 0x61, 0x5B, 0x63, 0x5D, 0x3D, 0x66, 0x5B, 0x63, 0x5D, 0x3B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x7C, 0x7C, 0x28, 0x61, 0x2E, 0x74, 0x61, 
+    0x72, 0x67, 0x65, 0x74, 0x3D, 0x66, 0x2E, 0x73, 0x72, 0x63, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x79, 
+    0x29, 0x2C, 0x33, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 
+    0x79, 0x70, 0x65, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x61, 0x2E, 0x74, 0x61, 0x72, 
+    0x67, 0x65, 0x74, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x29, 0x2C, 0x61, 0x2E, 0x6D, 0x65, 
+    0x74, 0x61, 0x4B, 0x65, 0x79, 0x3D, 0x21, 0x21, 0x61, 0x2E, 0x6D, 0x65, 0x74, 0x61, 0x4B, 0x65, 0x79, 0x2C, 0x67, 0x2E, 
+    0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3F, 0x67, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x61, 0x2C, 0x66, 0x29, 
+    0x3A, 0x61, 0x7D, 0x2C, 0x70, 0x72, 0x6F, 0x70, 0x73, 0x3A, 0x22, 0x61, 0x6C, 0x74, 0x4B, 0x65, 0x79, 0x20, 0x62, 0x75, 
+    0x62, 0x62, 0x6C, 0x65, 0x73, 0x20, 0x63, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x61, 0x62, 0x6C, 0x65, 0x20, 0x63, 0x74, 0x72, 
+    0x6C, 0x4B, 0x65, 0x79, 0x20, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x50, 0x68, 0x61, 0x73, 0x65, 0x20, 0x6D, 0x65, 0x74, 0x61, 0x4B, 0x65, 0x79, 0x20, 0x72, 0x65, 
+    0x6C, 0x61, 0x74, 0x65, 0x64, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x73, 0x68, 0x69, 0x66, 0x74, 0x4B, 0x65, 0x79, 
+    0x20, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x20, 0x74, 0x69, 0x6D, 0x65, 0x53, 0x74, 0x61, 0x6D, 0x70, 0x20, 0x76, 0x69, 
+    0x65, 0x77, 0x20, 0x77, 0x68, 0x69, 0x63, 0x68, 0x22, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x28, 0x22, 0x20, 0x22, 0x29, 
+    0x2C, 0x66, 0x69, 0x78, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x3A, 0x7B, 0x7D, 0x2C, 0x6B, 0x65, 0x79, 0x48, 0x6F, 0x6F, 0x6B, 
+    0x73, 0x3A, 0x7B, 0x70, 0x72, 0x6F, 0x70, 0x73, 0x3A, 0x22, 0x63, 0x68, 0x61, 0x72, 0x20, 0x63, 0x68, 0x61, 0x72, 0x43, 
+    0x6F, 0x64, 0x65, 0x20, 0x6B, 0x65, 0x79, 0x20, 0x6B, 0x65, 0x79, 0x43, 0x6F, 0x64, 0x65, 0x22, 0x2E, 0x73, 0x70, 0x6C, 
+    0x69, 0x74, 0x28, 0x22, 0x20, 0x22, 0x29, 0x2C, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 
+    0x3D, 0x3D, 0x61, 0x2E, 0x77, 0x68, 0x69, 0x63, 0x68, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x77, 0x68, 0x69, 0x63, 0x68, 0x3D, 
+    0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x62, 0x2E, 0x63, 0x68, 0x61, 0x72, 0x43, 0x6F, 0x64, 0x65, 0x3F, 0x62, 0x2E, 0x63, 
+    0x68, 0x61, 0x72, 0x43, 0x6F, 0x64, 0x65, 0x3A, 0x62, 0x2E, 0x6B, 0x65, 0x79, 0x43, 0x6F, 0x64, 0x65, 0x29, 0x2C, 0x61, 
+    0x7D, 0x7D, 0x2C, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x3A, 0x7B, 0x70, 0x72, 0x6F, 0x70, 0x73, 
+    0x3A, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x20, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x73, 0x20, 0x63, 0x6C, 0x69, 
+    0x65, 0x6E, 0x74, 0x58, 0x20, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x59, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x45, 0x6C, 0x65, 
+    0x6D, 0x65, 0x6E, 0x74, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x58, 0x20, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x59, 
+    0x20, 0x70, 0x61, 0x67, 0x65, 0x58, 0x20, 0x70, 0x61, 0x67, 0x65, 0x59, 0x20, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6E, 0x58, 
+    0x20, 0x73, 0x63, 0x72, 0x65, 0x65, 0x6E, 0x59, 0x20, 0x74, 0x6F, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x22, 0x2E, 
+    0x73, 0x70, 0x6C, 0x69, 0x74, 0x28, 0x22, 0x20, 0x22, 0x29, 0x2C, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x2C, 
+    0x65, 0x2C, 0x66, 0x3D, 0x62, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x2C, 0x67, 0x3D, 0x62, 0x2E, 0x66, 0x72, 0x6F, 
+    0x6D, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 
+    0x3D, 0x3D, 0x61, 0x2E, 0x70, 0x61, 0x67, 0x65, 0x58, 0x26, 0x26, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x62, 0x2E, 0x63, 
+    0x6C, 0x69, 0x65, 0x6E, 0x74, 0x58, 0x26, 0x26, 0x28, 0x64, 0x3D, 0x61, 0x2E, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2E, 
+    0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x79, 0x2C, 0x65, 0x3D, 0x64, 
+    0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x63, 0x3D, 0x64, 
+    0x2E, 0x62, 0x6F, 0x64, 0x79, 0x2C, 0x61, 0x2E, 0x70, 0x61, 0x67, 0x65, 0x58, 0x3D, 0x62, 0x2E, 0x63, 0x6C, 0x69, 0x65, 
+    0x6E, 0x74, 0x58, 0x2B, 0x28, 0x65, 0x26, 0x26, 0x65, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x4C, 0x65, 0x66, 0x74, 
+    0x7C, 0x7C, 0x63, 0x26, 0x26, 0x63, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x4C, 0x65, 0x66, 0x74, 0x7C, 0x7C, 0x30, 
+    0x29, 0x2D, 0x28, 0x65, 0x26, 0x26, 0x65, 0x2E, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x4C, 0x65, 0x66, 0x74, 0x7C, 0x7C, 
+    0x63, 0x26, 0x26, 0x63, 0x2E, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x4C, 0x65, 0x66, 0x74, 0x7C, 0x7C, 0x30, 0x29, 0x2C, 
+    0x61, 0x2E, 0x70, 0x61, 0x67, 0x65, 0x59, 0x3D, 0x62, 0x2E, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x59, 0x2B, 0x28, 0x65, 
+    0x26, 0x26, 0x65, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x54, 0x6F, 0x70, 0x7C, 0x7C, 0x63, 0x26, 0x26, 0x63, 0x2E, 
+    0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x54, 0x6F, 0x70, 0x7C, 0x7C, 0x30, 0x29, 0x2D, 0x28, 0x65, 0x26, 0x26, 0x65, 0x2E, 
+    0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x54, 0x6F, 0x70, 0x7C, 0x7C, 0x63, 0x26, 0x26, 0x63, 0x2E, 0x63, 0x6C, 0x69, 0x65, 
+    0x6E, 0x74, 0x54, 0x6F, 0x70, 0x7C, 0x7C, 0x30, 0x29, 0x29, 0x2C, 0x21, 0x61, 0x2E, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x65, 
+    0x64, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x26, 0x26, 0x67, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x72, 0x65, 0x6C, 0x61, 0x74, 
+    0x65, 0x64, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3D, 0x67, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x74, 0x61, 0x72, 0x67, 0x65, 
+    0x74, 0x3F, 0x62, 0x2E, 0x74, 0x6F, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x3A, 0x67, 0x29, 0x2C, 0x61, 0x2E, 0x77, 
+    0x68, 0x69, 0x63, 0x68, 0x7C, 0x7C, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x66, 0x7C, 0x7C, 0x28, 0x61, 
+    0x2E, 0x77, 0x68, 0x69, 0x63, 0x68, 0x3D, 0x31, 0x26, 0x66, 0x3F, 0x31, 0x3A, 0x32, 0x26, 0x66, 0x3F, 0x33, 0x3A, 0x34, 
+    0x26, 0x66, 0x3F, 0x32, 0x3A, 0x30, 0x29, 0x2C, 0x61, 0x7D, 0x7D, 0x2C, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x3A, 
+    0x7B, 0x6C, 0x6F, 0x61, 0x64, 0x3A, 0x7B, 0x6E, 0x6F, 0x42, 0x75, 0x62, 0x62, 0x6C, 0x65, 0x3A, 0x21, 0x30, 0x7D, 0x2C, 
+    0x66, 0x6F, 0x63, 0x75, 0x73, 0x3A, 0x7B, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x21, 0x3D, 0x3D, 0x63, 0x62, 0x28, 0x29, 
+    0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x29, 0x74, 0x72, 0x79, 0x7B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x28, 0x29, 0x2C, 0x21, 0x31, 0x7D, 
+    0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x61, 0x29, 0x7B, 0x7D, 0x7D, 0x2C, 0x64, 0x65, 0x6C, 0x65, 0x67, 0x61, 0x74, 0x65, 
+    0x54, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x69, 0x6E, 0x22, 0x7D, 0x2C, 0x62, 0x6C, 0x75, 0x72, 
+    0x3A, 0x7B, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 
+    0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x3D, 0x3D, 0x3D, 0x63, 0x62, 0x28, 0x29, 0x26, 
+    0x26, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x62, 0x6C, 0x75, 0x72, 0x3F, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x62, 0x6C, 0x75, 
+    0x72, 0x28, 0x29, 0x2C, 0x21, 0x31, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x2C, 0x64, 0x65, 0x6C, 0x65, 
+    0x67, 0x61, 0x74, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x6F, 0x75, 0x74, 0x22, 0x7D, 
+    0x2C, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3A, 0x7B, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 
+    0x4E, 0x61, 0x6D, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x29, 0x26, 0x26, 
+    0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x3D, 0x3D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x74, 0x79, 
+    0x70, 0x65, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x3F, 0x28, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x28, 0x29, 0x2C, 0x21, 0x31, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 
+    0x2C, 0x5F, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x28, 
+    0x61, 0x2E, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2C, 0x22, 0x61, 0x22, 0x29, 0x7D, 0x7D, 0x2C, 0x62, 0x65, 0x66, 0x6F, 
+    0x72, 0x65, 0x75, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x3A, 0x7B, 0x70, 0x6F, 0x73, 0x74, 0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 
+    0x63, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x6F, 0x69, 0x64, 0x20, 
+    0x30, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x26, 0x26, 0x61, 0x2E, 0x6F, 0x72, 0x69, 0x67, 
+    0x69, 0x6E, 0x61, 0x6C, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 
+    0x61, 0x6C, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x3D, 
+    0x61, 0x2E, 0x72, 0x65, 0x73, 0x75, 0x6C, 0x74, 0x29, 0x7D, 0x7D, 0x7D, 0x2C, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 
+    0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 
+    0x76, 0x61, 0x72, 0x20, 0x65, 0x3D, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x6E, 0x65, 0x77, 0x20, 0x6D, 
+    0x2E, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x2C, 0x63, 0x2C, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x61, 0x2C, 0x69, 0x73, 0x53, 
+    0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x64, 0x3A, 0x21, 0x30, 0x2C, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 
+    0x45, 0x76, 0x65, 0x6E, 0x74, 0x3A, 0x7B, 0x7D, 0x7D, 0x29, 0x3B, 0x64, 0x3F, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 
+    0x2E, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x28, 0x65, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x62, 0x29, 0x3A, 0x6D, 
+    0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 
+    0x28, 0x62, 0x2C, 0x65, 0x29, 0x2C, 0x65, 0x2E, 0x69, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x50, 0x72, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x65, 0x64, 0x28, 0x29, 0x26, 0x26, 0x63, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x44, 
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x28, 0x29, 0x7D, 0x7D, 0x2C, 0x6D, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x45, 
+    0x76, 0x65, 0x6E, 0x74, 0x3D, 0x79, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 
+    0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x3F, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 
+    0x63, 0x29, 0x7B, 0x61, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 
+    0x65, 0x6E, 0x65, 0x72, 0x26, 0x26, 0x61, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 
+    0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x62, 0x2C, 0x63, 0x2C, 0x21, 0x31, 0x29, 0x7D, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 0x22, 
+    0x6F, 0x6E, 0x22, 0x2B, 0x62, 0x3B, 0x61, 0x2E, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x26, 
+    0x26, 0x28, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x5B, 0x64, 0x5D, 0x3D, 0x3D, 0x3D, 0x4B, 0x26, 0x26, 0x28, 
+    0x61, 0x5B, 0x64, 0x5D, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x2C, 0x61, 0x2E, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x45, 
+    0x76, 0x65, 0x6E, 0x74, 0x28, 0x64, 0x2C, 0x63, 0x29, 0x29, 0x7D, 0x2C, 0x6D, 0x2E, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x3D, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x69, 0x6E, 0x73, 0x74, 0x61, 0x6E, 0x63, 0x65, 0x6F, 0x66, 0x20, 0x6D, 0x2E, 0x45, 
+    0x76, 0x65, 0x6E, 0x74, 0x3F, 0x28, 0x61, 0x26, 0x26, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x3F, 0x28, 0x74, 0x68, 0x69, 
+    0x73, 0x2E, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x3D, 0x61, 0x2C, 0x74, 0x68, 
+    0x69, 0x73, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x69, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x50, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x65, 0x64, 0x3D, 0x61, 
+    0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x50, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x65, 0x64, 0x7C, 0x7C, 0x76, 
+    0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x50, 0x72, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x65, 0x64, 0x26, 0x26, 0x61, 0x2E, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x56, 0x61, 0x6C, 0x75, 
+    0x65, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x3F, 0x61, 0x62, 0x3A, 0x62, 0x62, 0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x74, 
+    0x79, 0x70, 0x65, 0x3D, 0x61, 0x2C, 0x62, 0x26, 0x26, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x74, 0x68, 
+    0x69, 0x73, 0x2C, 0x62, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x53, 0x74, 0x61, 0x6D, 0x70, 
+    0x3D, 0x61, 0x26, 0x26, 0x61, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x53, 0x74, 0x61, 0x6D, 0x70, 0x7C, 0x7C, 0x6D, 0x2E, 0x6E, 
+    0x6F, 0x77, 0x28, 0x29, 0x2C, 0x76, 0x6F, 0x69, 0x64, 0x28, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x6D, 0x2E, 0x65, 0x78, 0x70, 
+    0x61, 0x6E, 0x64, 0x6F, 0x5D, 0x3D, 0x21, 0x30, 0x29, 0x29, 0x3A, 0x6E, 0x65, 0x77, 0x20, 0x6D, 0x2E, 0x45, 0x76, 0x65, 
+    0x6E, 0x74, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7D, 0x2C, 0x6D, 0x2E, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x70, 0x72, 0x6F, 
+    0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x7B, 0x69, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x50, 0x72, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x65, 0x64, 0x3A, 0x62, 0x62, 0x2C, 0x69, 0x73, 0x50, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x61, 0x74, 
+    0x69, 0x6F, 0x6E, 0x53, 0x74, 0x6F, 0x70, 0x70, 0x65, 0x64, 0x3A, 0x62, 0x62, 0x2C, 0x69, 0x73, 0x49, 0x6D, 0x6D, 0x65, 
+    0x64, 0x69, 0x61, 0x74, 0x65, 0x50, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x6F, 0x70, 
+    0x70, 0x65, 0x64, 0x3A, 0x62, 0x62, 0x2C, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 
+    0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x74, 
+    0x68, 0x69, 0x73, 0x2E, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x3B, 0x74, 0x68, 
+    0x69, 0x73, 0x2E, 0x69, 0x73, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x50, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x65, 
+    0x64, 0x3D, 0x61, 0x62, 0x2C, 0x61, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x44, 0x65, 
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x3F, 0x61, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 
+    0x6C, 0x74, 0x28, 0x29, 0x3A, 0x61, 0x2E, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x21, 
+    0x31, 0x29, 0x7D, 0x2C, 0x73, 0x74, 0x6F, 0x70, 0x50, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x74, 0x68, 0x69, 
+    0x73, 0x2E, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x3B, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x69, 0x73, 0x50, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x6F, 0x70, 0x70, 0x65, 
+    0x64, 0x3D, 0x61, 0x62, 0x2C, 0x61, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x50, 0x72, 0x6F, 0x70, 0x61, 
+    0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x26, 0x26, 0x61, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x50, 0x72, 0x6F, 0x70, 0x61, 0x67, 
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x2C, 0x61, 0x2E, 0x63, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x42, 0x75, 0x62, 0x62, 
+    0x6C, 0x65, 0x3D, 0x21, 0x30, 0x29, 0x7D, 0x2C, 0x73, 0x74, 0x6F, 0x70, 0x49, 0x6D, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 
+    0x65, 0x50, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x72, 0x69, 0x67, 0x69, 
+    0x6E, 0x61, 0x6C, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x3B, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x69, 0x73, 0x49, 0x6D, 0x6D, 0x65, 
+    0x64, 0x69, 0x61, 0x74, 0x65, 0x50, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x53, 0x74, 0x6F, 0x70, 
+    0x70, 0x65, 0x64, 0x3D, 0x61, 0x62, 0x2C, 0x61, 0x26, 0x26, 0x61, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x49, 0x6D, 0x6D, 0x65, 
+    0x64, 0x69, 0x61, 0x74, 0x65, 0x50, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x26, 0x26, 0x61, 0x2E, 
+    0x73, 0x74, 0x6F, 0x70, 0x49, 0x6D, 0x6D, 0x65, 0x64, 0x69, 0x61, 0x74, 0x65, 0x50, 0x72, 0x6F, 0x70, 0x61, 0x67, 0x61, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x50, 0x72, 0x6F, 0x70, 
+    0x61, 0x67, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7D, 0x7D, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x7B, 
+    0x6D, 0x6F, 0x75, 0x73, 0x65, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3A, 0x22, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x6F, 0x76, 0x65, 
+    0x72, 0x22, 0x2C, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x6C, 0x65, 0x61, 0x76, 0x65, 0x3A, 0x22, 0x6D, 0x6F, 0x75, 0x73, 0x65, 
+    0x6F, 0x75, 0x74, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x3A, 0x22, 0x70, 
+    0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6F, 0x76, 0x65, 0x72, 0x22, 0x2C, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6C, 
+    0x65, 0x61, 0x76, 0x65, 0x3A, 0x22, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x6F, 0x75, 0x74, 0x22, 0x7D, 0x2C, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 
+    0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x5B, 0x61, 0x5D, 0x3D, 0x7B, 0x64, 0x65, 0x6C, 0x65, 0x67, 0x61, 0x74, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x3A, 0x62, 0x2C, 0x62, 0x69, 0x6E, 0x64, 0x54, 0x79, 0x70, 0x65, 0x3A, 0x62, 0x2C, 0x68, 
+    0x61, 0x6E, 0x64, 0x6C, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x63, 0x2C, 0x64, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x65, 0x3D, 0x61, 0x2E, 0x72, 0x65, 0x6C, 0x61, 0x74, 
+    0x65, 0x64, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2C, 0x66, 0x3D, 0x61, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x4F, 
+    0x62, 0x6A, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x28, 0x21, 0x65, 0x7C, 0x7C, 0x65, 0x21, 0x3D, 0x3D, 0x64, 0x26, 
+    0x26, 0x21, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x28, 0x64, 0x2C, 0x65, 0x29, 0x29, 0x26, 0x26, 
+    0x28, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x66, 0x2E, 0x6F, 0x72, 0x69, 0x67, 0x54, 0x79, 0x70, 0x65, 0x2C, 0x63, 
+    0x3D, 0x66, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x74, 0x68, 0x69, 
+    0x73, 0x2C, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x2C, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x3D, 
+    0x62, 0x29, 0x2C, 0x63, 0x7D, 0x7D, 0x7D, 0x29, 0x2C, 0x6B, 0x2E, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x42, 0x75, 0x62, 
+    0x62, 0x6C, 0x65, 0x73, 0x7C, 0x7C, 0x28, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 
+    0x61, 0x6C, 0x2E, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x3D, 0x7B, 0x73, 0x65, 0x74, 0x75, 0x70, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 
+    0x65, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x22, 0x29, 0x3F, 0x21, 
+    0x31, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x74, 
+    0x68, 0x69, 0x73, 0x2C, 0x22, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x2E, 0x5F, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x20, 0x6B, 
+    0x65, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x2E, 0x5F, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x22, 0x2C, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x61, 0x2E, 0x74, 0x61, 0x72, 
+    0x67, 0x65, 0x74, 0x2C, 0x63, 0x3D, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x62, 0x2C, 0x22, 
+    0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x29, 0x7C, 0x7C, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x28, 
+    0x62, 0x2C, 0x22, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x22, 0x29, 0x3F, 0x62, 0x2E, 0x66, 0x6F, 0x72, 0x6D, 0x3A, 0x76, 
+    0x6F, 0x69, 0x64, 0x20, 0x30, 0x3B, 0x63, 0x26, 0x26, 0x21, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x63, 0x2C, 
+    0x22, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x42, 0x75, 0x62, 0x62, 0x6C, 0x65, 0x73, 0x22, 0x29, 0x26, 0x26, 0x28, 0x6D, 
+    0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x63, 0x2C, 0x22, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 
+    0x2E, 0x5F, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x22, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x29, 0x7B, 0x61, 0x2E, 0x5F, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x5F, 0x62, 0x75, 0x62, 0x62, 0x6C, 0x65, 0x3D, 0x21, 
+    0x30, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x63, 0x2C, 0x22, 0x73, 0x75, 0x62, 0x6D, 0x69, 
+    0x74, 0x42, 0x75, 0x62, 0x62, 0x6C, 0x65, 0x73, 0x22, 0x2C, 0x21, 0x30, 0x29, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x70, 0x6F, 
+    0x73, 0x74, 0x44, 0x69, 0x73, 0x70, 0x61, 0x74, 0x63, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x7B, 0x61, 0x2E, 0x5F, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x5F, 0x62, 0x75, 0x62, 0x62, 0x6C, 0x65, 0x26, 
+    0x26, 0x28, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x61, 0x2E, 0x5F, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x5F, 0x62, 
+    0x75, 0x62, 0x62, 0x6C, 0x65, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 
+    0x65, 0x26, 0x26, 0x21, 0x61, 0x2E, 0x69, 0x73, 0x54, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x26, 0x26, 0x6D, 0x2E, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x22, 0x73, 0x75, 0x62, 0x6D, 0x69, 
+    0x74, 0x22, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x2C, 0x61, 
+    0x2C, 0x21, 0x30, 0x29, 0x29, 0x7D, 0x2C, 0x74, 0x65, 0x61, 0x72, 0x64, 0x6F, 0x77, 0x6E, 0x3A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 
+    0x4E, 0x61, 0x6D, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x66, 0x6F, 0x72, 0x6D, 0x22, 0x29, 0x3F, 0x21, 0x31, 
+    0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 
+    0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x2E, 0x5F, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x22, 0x29, 0x7D, 0x7D, 0x29, 
+    0x2C, 0x6B, 0x2E, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x42, 0x75, 0x62, 0x62, 0x6C, 0x65, 0x73, 0x7C, 0x7C, 0x28, 0x6D, 
+    0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x2E, 0x63, 0x68, 0x61, 0x6E, 0x67, 
+    0x65, 0x3D, 0x7B, 0x73, 0x65, 0x74, 0x75, 0x70, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x58, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6E, 
+    0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x3F, 0x28, 0x28, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 
+    0x22, 0x3D, 0x3D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x22, 0x72, 0x61, 0x64, 0x69, 
+    0x6F, 0x22, 0x3D, 0x3D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x29, 0x26, 0x26, 0x28, 0x6D, 0x2E, 
+    0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x70, 0x72, 0x6F, 0x70, 
+    0x65, 0x72, 0x74, 0x79, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x2E, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x22, 0x2C, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 
+    0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x2E, 
+    0x70, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x4E, 0x61, 0x6D, 0x65, 0x26, 0x26, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x5F, 0x6A, 0x75, 0x73, 0x74, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x3D, 0x21, 0x30, 0x29, 0x7D, 0x29, 0x2C, 
+    0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x63, 0x6C, 
+    0x69, 0x63, 0x6B, 0x2E, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x22, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x5F, 0x6A, 0x75, 0x73, 0x74, 0x5F, 0x63, 0x68, 0x61, 0x6E, 
+    0x67, 0x65, 0x64, 0x26, 0x26, 0x21, 0x61, 0x2E, 0x69, 0x73, 0x54, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x26, 0x26, 0x28, 
+    0x74, 0x68, 0x69, 0x73, 0x2E, 0x5F, 0x6A, 0x75, 0x73, 0x74, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x3D, 0x21, 
+    0x31, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x28, 
+    0x22, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x22, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x2C, 0x21, 0x30, 0x29, 0x7D, 
+    0x29, 0x29, 0x2C, 0x21, 0x31, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 
+    0x61, 0x64, 0x64, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x61, 0x63, 0x74, 0x69, 
+    0x76, 0x61, 0x74, 0x65, 0x2E, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x22, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x61, 0x2E, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 
+    0x3B, 0x58, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x26, 
+    0x26, 0x21, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x62, 0x2C, 0x22, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x42, 
+    0x75, 0x62, 0x62, 0x6C, 0x65, 0x73, 0x22, 0x29, 0x26, 0x26, 0x28, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x61, 
+    0x64, 0x64, 0x28, 0x62, 0x2C, 0x22, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x2E, 0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 
+    0x22, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x21, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x7C, 0x7C, 0x61, 0x2E, 0x69, 0x73, 0x53, 0x69, 0x6D, 0x75, 
+    0x6C, 0x61, 0x74, 0x65, 0x64, 0x7C, 0x7C, 0x61, 0x2E, 0x69, 0x73, 0x54, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x7C, 0x7C, 
+    0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x28, 0x22, 0x63, 0x68, 
+    0x61, 0x6E, 0x67, 0x65, 0x22, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 
+    0x65, 0x2C, 0x61, 0x2C, 0x21, 0x30, 0x29, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x62, 0x2C, 
+    0x22, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x42, 0x75, 0x62, 0x62, 0x6C, 0x65, 0x73, 0x22, 0x2C, 0x21, 0x30, 0x29, 0x29, 
+    0x7D, 0x29, 0x7D, 0x2C, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x61, 0x2E, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x3B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x21, 0x3D, 0x3D, 0x62, 0x7C, 0x7C, 0x61, 0x2E, 0x69, 0x73, 0x53, 
+    0x69, 0x6D, 0x75, 0x6C, 0x61, 0x74, 0x65, 0x64, 0x7C, 0x7C, 0x61, 0x2E, 0x69, 0x73, 0x54, 0x72, 0x69, 0x67, 0x67, 0x65, 
+    0x72, 0x7C, 0x7C, 0x22, 0x72, 0x61, 0x64, 0x69, 0x6F, 0x22, 0x21, 0x3D, 0x3D, 0x62, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x26, 
+    0x26, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x21, 0x3D, 0x3D, 0x62, 0x2E, 0x74, 0x79, 0x70, 0x65, 
+    0x3F, 0x61, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x4F, 0x62, 0x6A, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 
+    0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 
+    0x73, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x2C, 0x74, 0x65, 0x61, 0x72, 0x64, 0x6F, 0x77, 0x6E, 0x3A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 
+    0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x2E, 
+    0x5F, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x22, 0x29, 0x2C, 0x21, 0x58, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x74, 0x68, 
+    0x69, 0x73, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6B, 0x2E, 0x66, 0x6F, 
+    0x63, 0x75, 0x73, 0x69, 0x6E, 0x42, 0x75, 0x62, 0x62, 0x6C, 0x65, 0x73, 0x7C, 0x7C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 
+    0x28, 0x7B, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x3A, 0x22, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x69, 0x6E, 0x22, 0x2C, 0x62, 0x6C, 
+    0x75, 0x72, 0x3A, 0x22, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x6F, 0x75, 0x74, 0x22, 0x7D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x69, 0x6D, 0x75, 0x6C, 
+    0x61, 0x74, 0x65, 0x28, 0x62, 0x2C, 0x61, 0x2E, 0x74, 0x61, 0x72, 0x67, 0x65, 0x74, 0x2C, 0x6D, 0x2E, 0x65, 0x76, 0x65, 
+    0x6E, 0x74, 0x2E, 0x66, 0x69, 0x78, 0x28, 0x61, 0x29, 0x2C, 0x21, 0x30, 0x29, 0x7D, 0x3B, 0x6D, 0x2E, 0x65, 0x76, 0x65, 
+    0x6E, 0x74, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x5B, 0x62, 0x5D, 0x3D, 0x7B, 0x73, 0x65, 0x74, 0x75, 0x70, 
+    0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 0x74, 0x68, 
+    0x69, 0x73, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x74, 0x68, 
+    0x69, 0x73, 0x2C, 0x65, 0x3D, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x64, 0x2C, 0x62, 0x29, 0x3B, 0x65, 0x7C, 
+    0x7C, 0x64, 0x2E, 0x61, 0x64, 0x64, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 
+    0x61, 0x2C, 0x63, 0x2C, 0x21, 0x30, 0x29, 0x2C, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x64, 0x2C, 0x62, 0x2C, 
+    0x28, 0x65, 0x7C, 0x7C, 0x30, 0x29, 0x2B, 0x31, 0x29, 0x7D, 0x2C, 0x74, 0x65, 0x61, 0x72, 0x64, 0x6F, 0x77, 0x6E, 0x3A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 0x74, 0x68, 0x69, 
+    0x73, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x74, 0x68, 0x69, 
+    0x73, 0x2C, 0x65, 0x3D, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x64, 0x2C, 0x62, 0x29, 0x2D, 0x31, 0x3B, 0x65, 
+    0x3F, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x64, 0x2C, 0x62, 0x2C, 0x65, 0x29, 0x3A, 0x28, 0x64, 0x2E, 0x72, 
+    0x65, 0x6D, 0x6F, 0x76, 0x65, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x4C, 0x69, 0x73, 0x74, 0x65, 0x6E, 0x65, 0x72, 0x28, 0x61, 
+    0x2C, 0x63, 0x2C, 0x21, 0x30, 0x29, 0x2C, 0x6D, 0x2E, 0x5F, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x44, 0x61, 0x74, 0x61, 
+    0x28, 0x64, 0x2C, 0x62, 0x29, 0x29, 0x7D, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 0x74, 0x65, 
+    0x6E, 0x64, 0x28, 0x7B, 0x6F, 0x6E, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 
+    0x63, 0x2C, 0x64, 0x2C, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x66, 0x2C, 0x67, 0x3B, 0x69, 0x66, 0x28, 0x22, 0x6F, 
+    0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x29, 0x7B, 0x22, 0x73, 
+    0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x26, 0x26, 0x28, 0x63, 
+    0x3D, 0x63, 0x7C, 0x7C, 0x62, 0x2C, 0x62, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 
+    0x66, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x29, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x6E, 0x28, 0x66, 0x2C, 0x62, 0x2C, 0x63, 
+    0x2C, 0x61, 0x5B, 0x66, 0x5D, 0x2C, 0x65, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x7D, 0x69, 0x66, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x63, 0x26, 0x26, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x64, 
+    0x3F, 0x28, 0x64, 0x3D, 0x62, 0x2C, 0x63, 0x3D, 0x62, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x29, 0x3A, 0x6E, 0x75, 
+    0x6C, 0x6C, 0x3D, 0x3D, 0x64, 0x26, 0x26, 0x28, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 
+    0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x3F, 0x28, 0x64, 0x3D, 0x63, 0x2C, 0x63, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 
+    0x29, 0x3A, 0x28, 0x64, 0x3D, 0x63, 0x2C, 0x63, 0x3D, 0x62, 0x2C, 0x62, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x29, 
+    0x29, 0x2C, 0x64, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x29, 0x64, 0x3D, 0x62, 0x62, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 
+    0x66, 0x28, 0x21, 0x64, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x3B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x31, 0x3D, 0x3D, 0x3D, 0x65, 0x26, 0x26, 0x28, 0x67, 0x3D, 0x64, 0x2C, 0x64, 0x3D, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x28, 0x29, 
+    0x2E, 0x6F, 0x66, 0x66, 0x28, 0x61, 0x29, 0x2C, 0x67, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x74, 0x68, 0x69, 0x73, 
+    0x2C, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x7D, 0x2C, 0x64, 0x2E, 0x67, 0x75, 0x69, 0x64, 0x3D, 
+    0x67, 0x2E, 0x67, 0x75, 0x69, 0x64, 0x7C, 0x7C, 0x28, 0x67, 0x2E, 0x67, 0x75, 0x69, 0x64, 0x3D, 0x6D, 0x2E, 0x67, 0x75, 
+    0x69, 0x64, 0x2B, 0x2B, 0x29, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 
+    0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x2C, 0x64, 0x2C, 0x63, 0x2C, 0x62, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x6F, 0x6E, 0x65, 
+    0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 
+    0x64, 0x2C, 0x31, 0x29, 0x7D, 0x2C, 0x6F, 0x66, 0x66, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x3B, 0x69, 0x66, 0x28, 0x61, 0x26, 0x26, 
+    0x61, 0x2E, 0x70, 0x72, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x26, 0x26, 0x61, 0x2E, 
+    0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x4F, 0x62, 0x6A, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x3D, 0x61, 
+    0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x4F, 0x62, 0x6A, 0x2C, 0x6D, 0x28, 0x61, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x67, 
+    0x61, 0x74, 0x65, 0x54, 0x61, 0x72, 0x67, 0x65, 0x74, 0x29, 0x2E, 0x6F, 0x66, 0x66, 0x28, 0x64, 0x2E, 0x6E, 0x61, 0x6D, 
+    0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3F, 0x64, 0x2E, 0x6F, 0x72, 0x69, 0x67, 0x54, 0x79, 0x70, 0x65, 0x2B, 0x22, 0x2E, 
+    0x22, 0x2B, 0x64, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x73, 0x70, 0x61, 0x63, 0x65, 0x3A, 0x64, 0x2E, 0x6F, 0x72, 0x69, 0x67, 
+    0x54, 0x79, 0x70, 0x65, 0x2C, 0x64, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 0x2C, 0x64, 0x2E, 0x68, 0x61, 
+    0x6E, 0x64, 0x6C, 0x65, 0x72, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x3B, 0x69, 0x66, 0x28, 0x22, 0x6F, 0x62, 0x6A, 0x65, 
+    0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x65, 
+    0x20, 0x69, 0x6E, 0x20, 0x61, 0x29, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x66, 0x66, 0x28, 0x65, 0x2C, 0x62, 0x2C, 0x61, 
+    0x5B, 0x65, 0x5D, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x28, 0x62, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x7C, 0x7C, 0x22, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x29, 0x26, 0x26, 0x28, 0x63, 0x3D, 0x62, 0x2C, 
+    0x62, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x29, 0x2C, 0x63, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x26, 0x26, 0x28, 0x63, 
+    0x3D, 0x62, 0x62, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 
+    0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x2C, 0x63, 0x2C, 0x62, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x74, 0x72, 0x69, 0x67, 
+    0x67, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 
+    0x72, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x74, 0x72, 0x69, 0x67, 0x67, 
+    0x65, 0x72, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x3B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x3F, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x74, 0x72, 0x69, 0x67, 0x67, 
+    0x65, 0x72, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x21, 0x30, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 
+    0x7D, 0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x62, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x62, 0x3D, 0x65, 0x62, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x28, 0x22, 0x7C, 0x22, 0x29, 0x2C, 0x63, 0x3D, 
+    0x61, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x46, 0x72, 0x61, 0x67, 
+    0x6D, 0x65, 0x6E, 0x74, 0x28, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x63, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x29, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 
+    0x29, 0x63, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x62, 0x2E, 0x70, 
+    0x6F, 0x70, 0x28, 0x29, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x7D, 0x76, 0x61, 0x72, 0x20, 0x65, 
+    0x62, 0x3D, 0x22, 0x61, 0x62, 0x62, 0x72, 0x7C, 0x61, 0x72, 0x74, 0x69, 0x63, 0x6C, 0x65, 0x7C, 0x61, 0x73, 0x69, 0x64, 
+    0x65, 0x7C, 0x61, 0x75, 0x64, 0x69, 0x6F, 0x7C, 0x62, 0x64, 0x69, 0x7C, 0x63, 0x61, 0x6E, 0x76, 0x61, 0x73, 0x7C, 0x64, 
+    0x61, 0x74, 0x61, 0x7C, 0x64, 0x61, 0x74, 0x61, 0x6C, 0x69, 0x73, 0x74, 0x7C, 0x64, 0x65, 0x74, 0x61, 0x69, 0x6C, 0x73, 
+    0x7C, 0x66, 0x69, 0x67, 0x63, 0x61, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x7C, 0x66, 0x69, 0x67, 0x75, 0x72, 0x65, 0x7C, 0x66, 
+    0x6F, 0x6F, 0x74, 0x65, 0x72, 0x7C, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x7C, 0x68, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x7C, 
+    0x6D, 0x61, 0x72, 0x6B, 0x7C, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x7C, 0x6E, 0x61, 0x76, 0x7C, 0x6F, 0x75, 0x74, 0x70, 0x75, 
+    0x74, 0x7C, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x7C, 0x73, 0x65, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x7C, 0x73, 
+    0x75, 0x6D, 0x6D, 0x61, 0x72, 0x79, 0x7C, 0x74, 0x69, 0x6D, 0x65, 0x7C, 0x76, 0x69, 0x64, 0x65, 0x6F, 0x22, 0x2C, 0x66, 
+    0x62, 0x3D, 0x2F, 0x20, 0x6A, 0x51, 0x75, 0x65, 0x72, 0x79, 0x5C, 0x64, 0x2B, 0x3D, 0x22, 0x28, 0x3F, 0x3A, 0x6E, 0x75, 
+    0x6C, 0x6C, 0x7C, 0x5C, 0x64, 0x2B, 0x29, 0x22, 0x2F, 0x67, 0x2C, 0x67, 0x62, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 
+    0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x3C, 0x28, 0x3F, 0x3A, 0x22, 0x2B, 0x65, 0x62, 0x2B, 0x22, 0x29, 0x5B, 0x5C, 0x5C, 
+    0x73, 0x2F, 0x3E, 0x5D, 0x22, 0x2C, 0x22, 0x69, 0x22, 0x29, 0x2C, 0x68, 0x62, 0x3D, 0x2F, 0x5E, 0x5C, 0x73, 0x2B, 0x2F, 
+    0x2C, 0x69, 0x62, 0x3D, 0x2F, 0x3C, 0x28, 0x3F, 0x21, 0x61, 0x72, 0x65, 0x61, 0x7C, 0x62, 0x72, 0x7C, 0x63, 0x6F, 0x6C, 
+    0x7C, 0x65, 0x6D, 0x62, 0x65, 0x64, 0x7C, 0x68, 0x72, 0x7C, 0x69, 0x6D, 0x67, 0x7C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x7C, 
+    0x6C, 0x69, 0x6E, 0x6B, 0x7C, 0x6D, 0x65, 0x74, 0x61, 0x7C, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x29, 0x28, 0x28, 0x5B, 0x5C, 
+    0x77, 0x3A, 0x5D, 0x2B, 0x29, 0x5B, 0x5E, 0x3E, 0x5D, 0x2A, 0x29, 0x5C, 0x2F, 0x3E, 0x2F, 0x67, 0x69, 0x2C, 0x6A, 0x62, 
+    0x3D, 0x2F, 0x3C, 0x28, 0x5B, 0x5C, 0x77, 0x3A, 0x5D, 0x2B, 0x29, 0x2F, 0x2C, 0x6B, 0x62, 0x3D, 0x2F, 0x3C, 0x74, 0x62, 
+    0x6F, 0x64, 0x79, 0x2F, 0x69, 0x2C, 0x6C, 0x62, 0x3D, 0x2F, 0x3C, 0x7C, 0x26, 0x23, 0x3F, 0x5C, 0x77, 0x2B, 0x3B, 0x2F, 
+    0x2C, 0x6D, 0x62, 0x3D, 0x2F, 0x3C, 0x28, 0x3F, 0x3A, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x7C, 0x73, 0x74, 0x79, 0x6C, 
+    0x65, 0x7C, 0x6C, 0x69, 0x6E, 0x6B, 0x29, 0x2F, 0x69, 0x2C, 0x6E, 0x62, 0x3D, 0x2F, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 
+    0x64, 0x5C, 0x73, 0x2A, 0x28, 0x3F, 0x3A, 0x5B, 0x5E, 0x3D, 0x5D, 0x7C, 0x3D, 0x5C, 0x73, 0x2A, 0x2E, 0x63, 0x68, 0x65, 
+    0x63, 0x6B, 0x65, 0x64, 0x2E, 0x29, 0x2F, 0x69, 0x2C, 0x6F, 0x62, 0x3D, 0x2F, 0x5E, 0x24, 0x7C, 0x5C, 0x2F, 0x28, 0x3F, 
+    0x3A, 0x6A, 0x61, 0x76, 0x61, 0x7C, 0x65, 0x63, 0x6D, 0x61, 0x29, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x2F, 0x69, 0x2C, 
+    0x70, 0x62, 0x3D, 0x2F, 0x5E, 0x74, 0x72, 0x75, 0x65, 0x5C, 0x2F, 0x28, 0x2E, 0x2A, 0x29, 0x2F, 0x2C, 0x71, 0x62, 0x3D, 
+    0x2F, 0x5E, 0x5C, 0x73, 0x2A, 0x3C, 0x21, 0x28, 0x3F, 0x3A, 0x5C, 0x5B, 0x43, 0x44, 0x41, 0x54, 0x41, 0x5C, 0x5B, 0x7C, 
+    0x2D, 0x2D, 0x29, 0x7C, 0x28, 0x3F, 0x3A, 0x5C, 0x5D, 0x5C, 0x5D, 0x7C, 0x2D, 0x2D, 0x29, 0x3E, 0x5C, 0x73, 0x2A, 0x24, 
+    0x2F, 0x67, 0x2C, 0x72, 0x62, 0x3D, 0x7B, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x5B, 0x31, 0x2C, 0x22, 0x3C, 0x73, 
+    0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x6D, 0x75, 0x6C, 0x74, 0x69, 0x70, 0x6C, 0x65, 0x3D, 0x27, 0x6D, 0x75, 0x6C, 0x74, 
+    0x69, 0x70, 0x6C, 0x65, 0x27, 0x3E, 0x22, 0x2C, 0x22, 0x3C, 0x2F, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3E, 0x22, 0x5D, 
+    0x2C, 0x6C, 0x65, 0x67, 0x65, 0x6E, 0x64, 0x3A, 0x5B, 0x31, 0x2C, 0x22, 0x3C, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x65, 
+    0x74, 0x3E, 0x22, 0x2C, 0x22, 0x3C, 0x2F, 0x66, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x65, 0x74, 0x3E, 0x22, 0x5D, 0x2C, 0x61, 
+    0x72, 0x65, 0x61, 0x3A, 0x5B, 0x31, 0x2C, 0x22, 0x3C, 0x6D, 0x61, 0x70, 0x3E, 0x22, 0x2C, 0x22, 0x3C, 0x2F, 0x6D, 0x61, 
+    0x70, 0x3E, 0x22, 0x5D, 0x2C, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x3A, 0x5B, 0x31, 0x2C, 0x22, 0x3C, 0x6F, 0x62, 0x6A, 0x65, 
+    0x63, 0x74, 0x3E, 0x22, 0x2C, 0x22, 0x3C, 0x2F, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x3E, 0x22, 0x5D, 0x2C, 0x74, 0x68, 
+    0x65, 0x61, 0x64, 0x3A, 0x5B, 0x31, 0x2C, 0x22, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x22, 0x2C, 0x22, 0x3C, 0x2F, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x22, 0x5D, 0x2C, 0x74, 0x72, 0x3A, 0x5B, 0x32, 0x2C, 0x22, 0x3C, 0x74, 0x61, 0x62, 
+    0x6C, 0x65, 0x3E, 0x3C, 0x74, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x22, 0x2C, 0x22, 0x3C, 0x2F, 0x74, 0x62, 0x6F, 0x64, 0x79, 
+    0x3E, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x22, 0x5D, 0x2C, 0x63, 0x6F, 0x6C, 0x3A, 0x5B, 0x32, 0x2C, 0x22, 
+    0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x74, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x3C, 0x2F, 0x74, 0x62, 0x6F, 0x64, 
+    0x79, 0x3E, 0x3C, 0x63, 0x6F, 0x6C, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x3E, 0x22, 0x2C, 0x22, 0x3C, 0x2F, 0x63, 0x6F, 0x6C, 
+    0x67, 0x72, 0x6F, 0x75, 0x70, 0x3E, 0x3C, 0x2F, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x22, 0x5D, 0x2C, 0x74, 0x64, 0x3A, 
+    0x5B, 0x33, 0x2C, 0x22, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x74, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x3C, 0x74, 
+    0x72, 0x3E, 0x22, 0x2C, 0x22, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x3C, 0x2F, 0x74, 0x62, 0x6F, 0x64, 0x79, 0x3E, 0x3C, 0x2F, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x22, 0x5D, 0x2C, 0x5F, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x3A, 0x6B, 0x2E, 
+    0x68, 0x74, 0x6D, 0x6C, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x3F, 0x5B, 0x30, 0x2C, 0x22, 0x22, 0x2C, 
+    0x22, 0x22, 0x5D, 0x3A, 0x5B, 0x31, 0x2C, 0x22, 0x58, 0x3C, 0x64, 0x69, 0x76, 0x3E, 0x22, 0x2C, 0x22, 0x3C, 0x2F, 0x64, 
+    0x69, 0x76, 0x3E, 0x22, 0x5D, 0x7D, 0x2C, 0x73, 0x62, 0x3D, 0x64, 0x62, 0x28, 0x79, 0x29, 0x2C, 0x74, 0x62, 0x3D, 0x73, 
+    0x62, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 
+    0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x29, 0x3B, 0x72, 0x62, 
+    0x2E, 0x6F, 0x70, 0x74, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x3D, 0x72, 0x62, 0x2E, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 
+    0x72, 0x62, 0x2E, 0x74, 0x62, 0x6F, 0x64, 0x79, 0x3D, 0x72, 0x62, 0x2E, 0x74, 0x66, 0x6F, 0x6F, 0x74, 0x3D, 0x72, 0x62, 
+    0x2E, 0x63, 0x6F, 0x6C, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x3D, 0x72, 0x62, 0x2E, 0x63, 0x61, 0x70, 0x74, 0x69, 0x6F, 0x6E, 
+    0x3D, 0x72, 0x62, 0x2E, 0x74, 0x68, 0x65, 0x61, 0x64, 0x2C, 0x72, 0x62, 0x2E, 0x74, 0x68, 0x3D, 0x72, 0x62, 0x2E, 0x74, 
+    0x64, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x75, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 
+    0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x3D, 0x30, 0x2C, 0x66, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 
+    0x61, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 
+    0x6D, 0x65, 0x21, 0x3D, 0x3D, 0x4B, 0x3F, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 
+    0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x62, 0x7C, 0x7C, 0x22, 0x2A, 0x22, 0x29, 0x3A, 0x74, 0x79, 
+    0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x6F, 0x72, 
+    0x41, 0x6C, 0x6C, 0x21, 0x3D, 0x3D, 0x4B, 0x3F, 0x61, 0x2E, 0x71, 0x75, 0x65, 0x72, 0x79, 0x53, 0x65, 0x6C, 0x65, 0x63, 
+    0x74, 0x6F, 0x72, 0x41, 0x6C, 0x6C, 0x28, 0x62, 0x7C, 0x7C, 0x22, 0x2A, 0x22, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 
+    0x30, 0x3B, 0x69, 0x66, 0x28, 0x21, 0x66, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x66, 0x3D, 0x5B, 0x5D, 0x2C, 0x63, 0x3D, 0x61, 
+    0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x4E, 0x6F, 0x64, 0x65, 0x73, 0x7C, 0x7C, 0x61, 0x3B, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 
+    0x3D, 0x28, 0x64, 0x3D, 0x63, 0x5B, 0x65, 0x5D, 0x29, 0x3B, 0x65, 0x2B, 0x2B, 0x29, 0x21, 0x62, 0x7C, 0x7C, 0x6D, 0x2E, 
+    0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x64, 0x2C, 0x62, 0x29, 0x3F, 0x66, 0x2E, 0x70, 0x75, 0x73, 0x68, 
+    0x28, 0x64, 0x29, 0x3A, 0x6D, 0x2E, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x28, 0x66, 0x2C, 0x75, 0x62, 0x28, 0x64, 0x2C, 0x62, 
+    0x29, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x62, 
+    0x7C, 0x7C, 0x62, 0x26, 0x26, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x61, 0x2C, 0x62, 0x29, 
+    0x3F, 0x6D, 0x2E, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x28, 0x5B, 0x61, 0x5D, 0x2C, 0x66, 0x29, 0x3A, 0x66, 0x7D, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x76, 0x62, 0x28, 0x61, 0x29, 0x7B, 0x57, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 
+    0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x29, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x43, 
+    0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x3D, 0x61, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x29, 0x7D, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x77, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x61, 0x2C, 0x22, 0x74, 0x61, 0x62, 0x6C, 
+    0x65, 0x22, 0x29, 0x26, 0x26, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x31, 0x31, 0x21, 0x3D, 
+    0x3D, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3F, 0x62, 0x3A, 0x62, 0x2E, 0x66, 0x69, 0x72, 0x73, 
+    0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x2C, 0x22, 0x74, 0x72, 0x22, 0x29, 0x3F, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 
+    0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x22, 0x74, 0x62, 0x6F, 
+    0x64, 0x79, 0x22, 0x29, 0x5B, 0x30, 0x5D, 0x7C, 0x7C, 0x61, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 
+    0x6C, 0x64, 0x28, 0x61, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 
+    0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x74, 0x62, 0x6F, 0x64, 0x79, 0x22, 
+    0x29, 0x29, 0x3A, 0x61, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x78, 0x62, 0x28, 0x61, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 
+    0x3D, 0x3D, 0x6D, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x28, 0x61, 0x2C, 0x22, 0x74, 0x79, 0x70, 
+    0x65, 0x22, 0x29, 0x29, 0x2B, 0x22, 0x2F, 0x22, 0x2B, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x2C, 0x61, 0x7D, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x79, 0x62, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x70, 
+    0x62, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x62, 0x3F, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x62, 0x5B, 0x31, 0x5D, 0x3A, 0x61, 0x2E, 0x72, 0x65, 
+    0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 
+    0x29, 0x2C, 0x61, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x7A, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x29, 
+    0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x3D, 0x30, 0x3B, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 
+    0x3D, 0x28, 0x63, 0x3D, 0x61, 0x5B, 0x64, 0x5D, 0x29, 0x3B, 0x64, 0x2B, 0x2B, 0x29, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 
+    0x61, 0x28, 0x63, 0x2C, 0x22, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x45, 0x76, 0x61, 0x6C, 0x22, 0x2C, 0x21, 0x62, 0x7C, 
+    0x7C, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x62, 0x5B, 0x64, 0x5D, 0x2C, 0x22, 0x67, 0x6C, 0x6F, 0x62, 0x61, 
+    0x6C, 0x45, 0x76, 0x61, 0x6C, 0x22, 0x29, 0x29, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x41, 0x62, 
+    0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x31, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 
+    0x79, 0x70, 0x65, 0x26, 0x26, 0x6D, 0x2E, 0x68, 0x61, 0x73, 0x44, 0x61, 0x74, 0x61, 0x28, 0x61, 0x29, 0x29, 0x7B, 0x76, 
+    0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x3D, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x61, 
+    0x29, 0x2C, 0x67, 0x3D, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x62, 0x2C, 0x66, 0x29, 0x2C, 0x68, 0x3D, 0x66, 
+    0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x3B, 0x69, 0x66, 0x28, 0x68, 0x29, 0x7B, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 
+    0x20, 0x67, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2C, 0x67, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x3D, 0x7B, 
+    0x7D, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x63, 0x20, 0x69, 0x6E, 0x20, 0x68, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x64, 0x3D, 0x30, 
+    0x2C, 0x65, 0x3D, 0x68, 0x5B, 0x63, 0x5D, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x65, 0x3E, 0x64, 0x3B, 0x64, 
+    0x2B, 0x2B, 0x29, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x61, 0x64, 0x64, 0x28, 0x62, 0x2C, 0x63, 0x2C, 0x68, 
+    0x5B, 0x63, 0x5D, 0x5B, 0x64, 0x5D, 0x29, 0x7D, 0x67, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x26, 0x26, 0x28, 0x67, 0x2E, 0x64, 
+    0x61, 0x74, 0x61, 0x3D, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x7D, 0x2C, 0x67, 0x2E, 0x64, 0x61, 
+    0x74, 0x61, 0x29, 0x29, 0x7D, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x42, 0x62, 0x28, 0x61, 0x2C, 
+    0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x3B, 0x69, 0x66, 0x28, 0x31, 0x3D, 0x3D, 0x3D, 
+    0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x63, 0x3D, 0x62, 0x2E, 0x6E, 
+    0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 
+    0x29, 0x2C, 0x21, 0x6B, 0x2E, 0x6E, 0x6F, 0x43, 0x6C, 0x6F, 0x6E, 0x65, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x26, 0x26, 0x62, 
+    0x5B, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x5D, 0x29, 0x7B, 0x65, 0x3D, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 
+    0x74, 0x61, 0x28, 0x62, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x65, 0x2E, 0x65, 0x76, 0x65, 
+    0x6E, 0x74, 0x73, 0x29, 0x6D, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x62, 0x2C, 
+    0x64, 0x2C, 0x65, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x29, 0x3B, 0x62, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 
+    0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x29, 
+    0x7D, 0x22, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x26, 0x26, 0x62, 0x2E, 0x74, 0x65, 0x78, 
+    0x74, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x3F, 0x28, 0x78, 0x62, 0x28, 0x62, 0x29, 0x2E, 0x74, 0x65, 
+    0x78, 0x74, 0x3D, 0x61, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x2C, 0x79, 0x62, 0x28, 0x62, 0x29, 0x29, 0x3A, 0x22, 0x6F, 0x62, 
+    0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x3F, 0x28, 0x62, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 
+    0x6F, 0x64, 0x65, 0x26, 0x26, 0x28, 0x62, 0x2E, 0x6F, 0x75, 0x74, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x61, 0x2E, 
+    0x6F, 0x75, 0x74, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x29, 0x2C, 0x6B, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x35, 0x43, 0x6C, 
+    0x6F, 0x6E, 0x65, 0x26, 0x26, 0x61, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x26, 0x26, 0x21, 0x6D, 
+    0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x62, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x29, 0x26, 0x26, 
+    0x28, 0x62, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x61, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 
+    0x48, 0x54, 0x4D, 0x4C, 0x29, 0x29, 0x3A, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x26, 0x26, 
+    0x57, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x29, 0x3F, 0x28, 0x62, 0x2E, 0x64, 0x65, 
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x3D, 0x62, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 
+    0x65, 0x64, 0x3D, 0x61, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x2C, 0x62, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 
+    0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x26, 0x26, 0x28, 0x62, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 
+    0x3D, 0x61, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x29, 0x3A, 0x22, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3D, 
+    0x3D, 0x3D, 0x63, 0x3F, 0x62, 0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 
+    0x64, 0x3D, 0x62, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3D, 0x61, 0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 
+    0x6C, 0x74, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3A, 0x28, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x3D, 
+    0x3D, 0x3D, 0x63, 0x7C, 0x7C, 0x22, 0x74, 0x65, 0x78, 0x74, 0x61, 0x72, 0x65, 0x61, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x29, 
+    0x26, 0x26, 0x28, 0x62, 0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x61, 0x2E, 
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x7D, 0x7D, 0x6D, 0x2E, 0x65, 0x78, 0x74, 
+    0x65, 0x6E, 0x64, 0x28, 0x7B, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 
+    0x2C, 0x69, 0x3D, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x28, 0x61, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 
+    0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x61, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x6B, 0x2E, 0x68, 0x74, 
+    0x6D, 0x6C, 0x35, 0x43, 0x6C, 0x6F, 0x6E, 0x65, 0x7C, 0x7C, 0x6D, 0x2E, 0x69, 0x73, 0x58, 0x4D, 0x4C, 0x44, 0x6F, 0x63, 
+    0x28, 0x61, 0x29, 0x7C, 0x7C, 0x21, 0x67, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x22, 0x3C, 0x22, 0x2B, 0x61, 0x2E, 
+    0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2B, 0x22, 0x3E, 0x22, 0x29, 0x3F, 0x66, 0x3D, 0x61, 0x2E, 0x63, 0x6C, 
+    0x6F, 0x6E, 0x65, 0x4E, 0x6F, 0x64, 0x65, 0x28, 0x21, 0x30, 0x29, 0x3A, 0x28, 0x74, 0x62, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 
+    0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x61, 0x2E, 0x6F, 0x75, 0x74, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x2C, 0x74, 0x62, 
+    0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x66, 0x3D, 0x74, 0x62, 0x2E, 0x66, 0x69, 
+    0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x29, 0x29, 0x2C, 0x21, 0x28, 0x6B, 0x2E, 0x6E, 0x6F, 0x43, 0x6C, 0x6F, 
+    0x6E, 0x65, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x26, 0x26, 0x6B, 0x2E, 0x6E, 0x6F, 0x43, 0x6C, 0x6F, 0x6E, 0x65, 0x43, 0x68, 
+    0x65, 0x63, 0x6B, 0x65, 0x64, 0x7C, 0x7C, 0x31, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 
+    0x65, 0x26, 0x26, 0x31, 0x31, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 
+    0x6D, 0x2E, 0x69, 0x73, 0x58, 0x4D, 0x4C, 0x44, 0x6F, 0x63, 0x28, 0x61, 0x29, 0x29, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x64, 
+    0x3D, 0x75, 0x62, 0x28, 0x66, 0x29, 0x2C, 0x68, 0x3D, 0x75, 0x62, 0x28, 0x61, 0x29, 0x2C, 0x67, 0x3D, 0x30, 0x3B, 0x6E, 
+    0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x28, 0x65, 0x3D, 0x68, 0x5B, 0x67, 0x5D, 0x29, 0x3B, 0x2B, 0x2B, 0x67, 0x29, 0x64, 0x5B, 
+    0x67, 0x5D, 0x26, 0x26, 0x42, 0x62, 0x28, 0x65, 0x2C, 0x64, 0x5B, 0x67, 0x5D, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x62, 0x29, 
+    0x69, 0x66, 0x28, 0x63, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x68, 0x3D, 0x68, 0x7C, 0x7C, 0x75, 0x62, 0x28, 0x61, 0x29, 0x2C, 
+    0x64, 0x3D, 0x64, 0x7C, 0x7C, 0x75, 0x62, 0x28, 0x66, 0x29, 0x2C, 0x67, 0x3D, 0x30, 0x3B, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 
+    0x3D, 0x28, 0x65, 0x3D, 0x68, 0x5B, 0x67, 0x5D, 0x29, 0x3B, 0x67, 0x2B, 0x2B, 0x29, 0x41, 0x62, 0x28, 0x65, 0x2C, 0x64, 
+    0x5B, 0x67, 0x5D, 0x29, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x41, 0x62, 0x28, 0x61, 0x2C, 0x66, 0x29, 0x3B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x3D, 0x75, 0x62, 0x28, 0x66, 0x2C, 0x22, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 
+    0x29, 0x2C, 0x64, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3E, 0x30, 0x26, 0x26, 0x7A, 0x62, 0x28, 0x64, 0x2C, 0x21, 
+    0x69, 0x26, 0x26, 0x75, 0x62, 0x28, 0x61, 0x2C, 0x22, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x29, 0x29, 0x2C, 0x64, 
+    0x3D, 0x68, 0x3D, 0x65, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x66, 0x7D, 0x2C, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x46, 0x72, 
+    0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 
+    0x63, 0x2C, 0x64, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 
+    0x2C, 0x69, 0x2C, 0x6A, 0x2C, 0x6C, 0x2C, 0x6E, 0x3D, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x6F, 0x3D, 
+    0x64, 0x62, 0x28, 0x62, 0x29, 0x2C, 0x70, 0x3D, 0x5B, 0x5D, 0x2C, 0x71, 0x3D, 0x30, 0x3B, 0x6E, 0x3E, 0x71, 0x3B, 0x71, 
+    0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x66, 0x3D, 0x61, 0x5B, 0x71, 0x5D, 0x2C, 0x66, 0x7C, 0x7C, 0x30, 0x3D, 0x3D, 0x3D, 
+    0x66, 0x29, 0x69, 0x66, 0x28, 0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 0x3D, 0x3D, 0x6D, 0x2E, 0x74, 0x79, 
+    0x70, 0x65, 0x28, 0x66, 0x29, 0x29, 0x6D, 0x2E, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x28, 0x70, 0x2C, 0x66, 0x2E, 0x6E, 0x6F, 
+    0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3F, 0x5B, 0x66, 0x5D, 0x3A, 0x66, 0x29, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 
+    0x66, 0x28, 0x6C, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x66, 0x29, 0x29, 0x7B, 0x68, 0x3D, 0x68, 0x7C, 0x7C, 0x6F, 
+    0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x62, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 
+    0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x29, 0x2C, 0x69, 0x3D, 0x28, 
+    0x6A, 0x62, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x66, 0x29, 0x7C, 0x7C, 0x5B, 0x22, 0x22, 0x2C, 0x22, 0x22, 0x5D, 0x29, 
+    0x5B, 0x31, 0x5D, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x2C, 0x6C, 0x3D, 
+    0x72, 0x62, 0x5B, 0x69, 0x5D, 0x7C, 0x7C, 0x72, 0x62, 0x2E, 0x5F, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2C, 0x68, 
+    0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x6C, 0x5B, 0x31, 0x5D, 0x2B, 0x66, 0x2E, 0x72, 0x65, 
+    0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x69, 0x62, 0x2C, 0x22, 0x3C, 0x24, 0x31, 0x3E, 0x3C, 0x2F, 0x24, 0x32, 0x3E, 0x22, 
+    0x29, 0x2B, 0x6C, 0x5B, 0x32, 0x5D, 0x2C, 0x65, 0x3D, 0x6C, 0x5B, 0x30, 0x5D, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 
+    0x65, 0x2D, 0x2D, 0x29, 0x68, 0x3D, 0x68, 0x2E, 0x6C, 0x61, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x3B, 0x69, 0x66, 
+    0x28, 0x21, 0x6B, 0x2E, 0x6C, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x57, 0x68, 0x69, 0x74, 0x65, 0x73, 0x70, 0x61, 0x63, 
+    0x65, 0x26, 0x26, 0x68, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x66, 0x29, 0x26, 0x26, 0x70, 0x2E, 0x70, 0x75, 0x73, 
+    0x68, 0x28, 0x62, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x54, 0x65, 0x78, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x28, 0x68, 
+    0x62, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x66, 0x29, 0x5B, 0x30, 0x5D, 0x29, 0x29, 0x2C, 0x21, 0x6B, 0x2E, 0x74, 0x62, 
+    0x6F, 0x64, 0x79, 0x29, 0x7B, 0x66, 0x3D, 0x22, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x21, 0x3D, 0x3D, 0x69, 0x7C, 0x7C, 
+    0x6B, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x66, 0x29, 0x3F, 0x22, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x22, 
+    0x21, 0x3D, 0x3D, 0x6C, 0x5B, 0x31, 0x5D, 0x7C, 0x7C, 0x6B, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x66, 0x29, 0x3F, 
+    0x30, 0x3A, 0x68, 0x3A, 0x68, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x2C, 0x65, 0x3D, 0x66, 
+    0x26, 0x26, 0x66, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x4E, 0x6F, 0x64, 0x65, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x65, 0x2D, 0x2D, 0x29, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 
+    0x6D, 0x65, 0x28, 0x6A, 0x3D, 0x66, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x4E, 0x6F, 0x64, 0x65, 0x73, 0x5B, 0x65, 0x5D, 
+    0x2C, 0x22, 0x74, 0x62, 0x6F, 0x64, 0x79, 0x22, 0x29, 0x26, 0x26, 0x21, 0x6A, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x4E, 
+    0x6F, 0x64, 0x65, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x66, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 
+    0x65, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x6A, 0x29, 0x7D, 0x6D, 0x2E, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x28, 0x70, 0x2C, 
+    0x68, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x4E, 0x6F, 0x64, 0x65, 0x73, 0x29, 0x2C, 0x68, 0x2E, 0x74, 0x65, 0x78, 0x74, 
+    0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3D, 0x22, 0x22, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x68, 0x2E, 0x66, 
+    0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x29, 0x68, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x68, 
+    0x69, 0x6C, 0x64, 0x28, 0x68, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x29, 0x3B, 0x68, 0x3D, 
+    0x6F, 0x2E, 0x6C, 0x61, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x7D, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x70, 0x2E, 0x70, 
+    0x75, 0x73, 0x68, 0x28, 0x62, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x54, 0x65, 0x78, 0x74, 0x4E, 0x6F, 0x64, 0x65, 
+    0x28, 0x66, 0x29, 0x29, 0x3B, 0x68, 0x26, 0x26, 0x6F, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x68, 0x69, 0x6C, 
+    0x64, 0x28, 0x68, 0x29, 0x2C, 0x6B, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 
+    0x7C, 0x7C, 0x6D, 0x2E, 0x67, 0x72, 0x65, 0x70, 0x28, 0x75, 0x62, 0x28, 0x70, 0x2C, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 
+    0x22, 0x29, 0x2C, 0x76, 0x62, 0x29, 0x2C, 0x71, 0x3D, 0x30, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x66, 0x3D, 0x70, 
+    0x5B, 0x71, 0x2B, 0x2B, 0x5D, 0x29, 0x69, 0x66, 0x28, 0x28, 0x21, 0x64, 0x7C, 0x7C, 0x2D, 0x31, 0x3D, 0x3D, 0x3D, 0x6D, 
+    0x2E, 0x69, 0x6E, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x66, 0x2C, 0x64, 0x29, 0x29, 0x26, 0x26, 0x28, 0x67, 0x3D, 0x6D, 
+    0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x28, 0x66, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x66, 0x29, 0x2C, 0x68, 0x3D, 0x75, 0x62, 0x28, 0x6F, 0x2E, 0x61, 0x70, 0x70, 0x65, 
+    0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x66, 0x29, 0x2C, 0x22, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x29, 
+    0x2C, 0x67, 0x26, 0x26, 0x7A, 0x62, 0x28, 0x68, 0x29, 0x2C, 0x63, 0x29, 0x29, 0x7B, 0x65, 0x3D, 0x30, 0x3B, 0x77, 0x68, 
+    0x69, 0x6C, 0x65, 0x28, 0x66, 0x3D, 0x68, 0x5B, 0x65, 0x2B, 0x2B, 0x5D, 0x29, 0x6F, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 
+    0x28, 0x66, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x22, 0x22, 0x29, 0x26, 0x26, 0x63, 0x2E, 0x70, 0x75, 0x73, 0x68, 
+    0x28, 0x66, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x68, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x6F, 0x7D, 
+    0x2C, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x44, 0x61, 0x74, 0x61, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x2C, 0x62, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 
+    0x2C, 0x68, 0x3D, 0x30, 0x2C, 0x69, 0x3D, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x2C, 0x6A, 0x3D, 0x6D, 
+    0x2E, 0x63, 0x61, 0x63, 0x68, 0x65, 0x2C, 0x6C, 0x3D, 0x6B, 0x2E, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x45, 0x78, 0x70, 
+    0x61, 0x6E, 0x64, 0x6F, 0x2C, 0x6E, 0x3D, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 
+    0x61, 0x6C, 0x3B, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x28, 0x64, 0x3D, 0x61, 0x5B, 0x68, 0x5D, 0x29, 0x3B, 0x68, 0x2B, 
+    0x2B, 0x29, 0x69, 0x66, 0x28, 0x28, 0x62, 0x7C, 0x7C, 0x6D, 0x2E, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x44, 0x61, 0x74, 
+    0x61, 0x28, 0x64, 0x29, 0x29, 0x26, 0x26, 0x28, 0x66, 0x3D, 0x64, 0x5B, 0x69, 0x5D, 0x2C, 0x67, 0x3D, 0x66, 0x26, 0x26, 
+    0x6A, 0x5B, 0x66, 0x5D, 0x29, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x67, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x66, 
+    0x6F, 0x72, 0x28, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x67, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x6E, 0x5B, 0x65, 
+    0x5D, 0x3F, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x64, 0x2C, 0x65, 
+    0x29, 0x3A, 0x6D, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x45, 0x76, 0x65, 0x6E, 0x74, 0x28, 0x64, 0x2C, 0x65, 0x2C, 
+    0x67, 0x2E, 0x68, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x29, 0x3B, 0x6A, 0x5B, 0x66, 0x5D, 0x26, 0x26, 0x28, 0x64, 0x65, 0x6C, 
+    0x65, 0x74, 0x65, 0x20, 0x6A, 0x5B, 0x66, 0x5D, 0x2C, 0x6C, 0x3F, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x64, 0x5B, 
+    0x69, 0x5D, 0x3A, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x64, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 
+    0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x21, 0x3D, 0x3D, 0x4B, 0x3F, 0x64, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 
+    0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x69, 0x29, 0x3A, 0x64, 0x5B, 0x69, 0x5D, 0x3D, 0x6E, 0x75, 
+    0x6C, 0x6C, 0x2C, 0x63, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x66, 0x29, 0x29, 0x7D, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 
+    0x66, 0x6E, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x74, 0x65, 0x78, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x56, 0x28, 0x74, 0x68, 0x69, 
+    0x73, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x61, 0x3F, 0x6D, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x28, 0x74, 
+    0x68, 0x69, 0x73, 0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x28, 0x29, 0x2E, 0x61, 0x70, 
+    0x70, 0x65, 0x6E, 0x64, 0x28, 0x28, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x5B, 
+    0x30, 0x5D, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x79, 0x29, 
+    0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x54, 0x65, 0x78, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x28, 0x61, 0x29, 0x29, 0x7D, 
+    0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x61, 0x2C, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 
+    0x6E, 0x67, 0x74, 0x68, 0x29, 0x7D, 0x2C, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x64, 0x6F, 0x6D, 
+    0x4D, 0x61, 0x6E, 0x69, 0x70, 0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x31, 0x3D, 0x3D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x31, 0x31, 0x3D, 0x3D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x39, 0x3D, 0x3D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6E, 
+    0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x77, 0x62, 0x28, 0x74, 0x68, 
+    0x69, 0x73, 0x2C, 0x61, 0x29, 0x3B, 0x62, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 
+    0x61, 0x29, 0x7D, 0x7D, 0x29, 0x7D, 0x2C, 0x70, 0x72, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x64, 0x6F, 
+    0x6D, 0x4D, 0x61, 0x6E, 0x69, 0x70, 0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x31, 0x3D, 0x3D, 0x3D, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x31, 0x31, 0x3D, 0x3D, 0x3D, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x39, 0x3D, 0x3D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x77, 0x62, 0x28, 0x74, 
+    0x68, 0x69, 0x73, 0x2C, 0x61, 0x29, 0x3B, 0x62, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x42, 0x65, 0x66, 0x6F, 0x72, 
+    0x65, 0x28, 0x61, 0x2C, 0x62, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x29, 0x7D, 0x7D, 0x29, 
+    0x7D, 0x2C, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x64, 0x6F, 0x6D, 0x4D, 0x61, 0x6E, 0x69, 0x70, 
+    0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x7B, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x26, 0x26, 
+    0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 
+    0x72, 0x74, 0x42, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x28, 0x61, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 
+    0x61, 0x66, 0x74, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x64, 0x6F, 0x6D, 0x4D, 0x61, 0x6E, 0x69, 0x70, 0x28, 0x61, 0x72, 
+    0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 
+    0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x26, 0x26, 0x74, 0x68, 0x69, 
+    0x73, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x42, 
+    0x65, 0x66, 0x6F, 0x72, 0x65, 0x28, 0x61, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6E, 0x65, 0x78, 0x74, 0x53, 0x69, 0x62, 
+    0x6C, 0x69, 0x6E, 0x67, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 
+    0x64, 0x3D, 0x61, 0x3F, 0x6D, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x61, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x29, 
+    0x3A, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x65, 0x3D, 0x30, 0x3B, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x28, 0x63, 0x3D, 0x64, 
+    0x5B, 0x65, 0x5D, 0x29, 0x3B, 0x65, 0x2B, 0x2B, 0x29, 0x62, 0x7C, 0x7C, 0x31, 0x21, 0x3D, 0x3D, 0x63, 0x2E, 0x6E, 0x6F, 
+    0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x6D, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x44, 0x61, 0x74, 0x61, 0x28, 
+    0x75, 0x62, 0x28, 0x63, 0x29, 0x29, 0x2C, 0x63, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x26, 
+    0x26, 0x28, 0x62, 0x26, 0x26, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x28, 0x63, 0x2E, 0x6F, 0x77, 
+    0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x63, 0x29, 0x26, 0x26, 0x7A, 0x62, 0x28, 0x75, 
+    0x62, 0x28, 0x63, 0x2C, 0x22, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x29, 0x29, 0x2C, 0x63, 0x2E, 0x70, 0x61, 0x72, 
+    0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 
+    0x63, 0x29, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x65, 0x6D, 0x70, 
+    0x74, 0x79, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 
+    0x72, 0x20, 0x61, 0x2C, 0x62, 0x3D, 0x30, 0x3B, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x28, 0x61, 0x3D, 0x74, 0x68, 0x69, 
+    0x73, 0x5B, 0x62, 0x5D, 0x29, 0x3B, 0x62, 0x2B, 0x2B, 0x29, 0x7B, 0x31, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x6D, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x44, 0x61, 0x74, 0x61, 0x28, 0x75, 
+    0x62, 0x28, 0x61, 0x2C, 0x21, 0x31, 0x29, 0x29, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x61, 0x2E, 0x66, 0x69, 0x72, 
+    0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x29, 0x61, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x68, 0x69, 0x6C, 
+    0x64, 0x28, 0x61, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x29, 0x3B, 0x61, 0x2E, 0x6F, 0x70, 
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x26, 0x26, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x61, 0x2C, 
+    0x22, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x22, 0x29, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 
+    0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3D, 0x30, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x7D, 0x2C, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 
+    0x61, 0x3F, 0x21, 0x31, 0x3A, 0x61, 0x2C, 0x62, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x62, 0x3F, 0x61, 0x3A, 0x62, 
+    0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 
+    0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 
+    0x2C, 0x61, 0x2C, 0x62, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x68, 0x74, 0x6D, 0x6C, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x56, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x74, 0x68, 
+    0x69, 0x73, 0x5B, 0x30, 0x5D, 0x7C, 0x7C, 0x7B, 0x7D, 0x2C, 0x63, 0x3D, 0x30, 0x2C, 0x64, 0x3D, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x69, 0x66, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 
+    0x61, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 
+    0x79, 0x70, 0x65, 0x3F, 0x62, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x2E, 0x72, 0x65, 0x70, 0x6C, 
+    0x61, 0x63, 0x65, 0x28, 0x66, 0x62, 0x2C, 0x22, 0x22, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3B, 0x69, 0x66, 
+    0x28, 0x21, 0x28, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 
+    0x61, 0x7C, 0x7C, 0x6D, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x29, 0x7C, 0x7C, 0x21, 0x6B, 0x2E, 0x68, 0x74, 
+    0x6D, 0x6C, 0x53, 0x65, 0x72, 0x69, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x26, 0x26, 0x67, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 
+    0x28, 0x61, 0x29, 0x7C, 0x7C, 0x21, 0x6B, 0x2E, 0x6C, 0x65, 0x61, 0x64, 0x69, 0x6E, 0x67, 0x57, 0x68, 0x69, 0x74, 0x65, 
+    0x73, 0x70, 0x61, 0x63, 0x65, 0x26, 0x26, 0x68, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x29, 0x7C, 0x7C, 0x72, 
+    0x62, 0x5B, 0x28, 0x6A, 0x62, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x61, 0x29, 0x7C, 0x7C, 0x5B, 0x22, 0x22, 0x2C, 0x22, 
+    0x22, 0x5D, 0x29, 0x5B, 0x31, 0x5D, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 
+    0x5D, 0x29, 0x29, 0x7B, 0x61, 0x3D, 0x61, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x69, 0x62, 0x2C, 0x22, 
+    0x3C, 0x24, 0x31, 0x3E, 0x3C, 0x2F, 0x24, 0x32, 0x3E, 0x22, 0x29, 0x3B, 0x74, 0x72, 0x79, 0x7B, 0x66, 0x6F, 0x72, 0x28, 
+    0x3B, 0x64, 0x3E, 0x63, 0x3B, 0x63, 0x2B, 0x2B, 0x29, 0x62, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x63, 0x5D, 0x7C, 0x7C, 
+    0x7B, 0x7D, 0x2C, 0x31, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x28, 
+    0x6D, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x44, 0x61, 0x74, 0x61, 0x28, 0x75, 0x62, 0x28, 0x62, 0x2C, 0x21, 0x31, 0x29, 
+    0x29, 0x2C, 0x62, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x61, 0x29, 0x3B, 0x62, 0x3D, 0x30, 
+    0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x65, 0x29, 0x7B, 0x7D, 0x7D, 0x62, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x65, 0x6D, 0x70, 0x74, 0x79, 0x28, 0x29, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x28, 0x61, 0x29, 0x7D, 0x2C, 0x6E, 
+    0x75, 0x6C, 0x6C, 0x2C, 0x61, 0x2C, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 
+    0x74, 0x68, 0x29, 0x7D, 0x2C, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x57, 0x69, 0x74, 0x68, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 
+    0x6E, 0x74, 0x73, 0x5B, 0x30, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x64, 
+    0x6F, 0x6D, 0x4D, 0x61, 0x6E, 0x69, 0x70, 0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2C, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x61, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x61, 0x72, 
+    0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x2C, 0x6D, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x6E, 0x44, 0x61, 0x74, 0x61, 0x28, 
+    0x75, 0x62, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x29, 0x2C, 0x61, 0x26, 0x26, 0x61, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 
+    0x63, 0x65, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x62, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x29, 0x7D, 0x29, 0x2C, 0x61, 0x26, 
+    0x26, 0x28, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x7C, 0x7C, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x29, 0x3F, 0x74, 0x68, 0x69, 0x73, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 
+    0x28, 0x29, 0x7D, 0x2C, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 
+    0x65, 0x28, 0x61, 0x2C, 0x21, 0x30, 0x29, 0x7D, 0x2C, 0x64, 0x6F, 0x6D, 0x4D, 0x61, 0x6E, 0x69, 0x70, 0x3A, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x61, 0x3D, 0x65, 0x2E, 0x61, 0x70, 0x70, 0x6C, 
+    0x79, 0x28, 0x5B, 0x5D, 0x2C, 0x61, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 
+    0x68, 0x2C, 0x69, 0x2C, 0x6A, 0x3D, 0x30, 0x2C, 0x6C, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x2C, 0x6E, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x6F, 0x3D, 0x6C, 0x2D, 0x31, 0x2C, 0x70, 0x3D, 0x61, 0x5B, 0x30, 
+    0x5D, 0x2C, 0x71, 0x3D, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x70, 0x29, 0x3B, 
+    0x69, 0x66, 0x28, 0x71, 0x7C, 0x7C, 0x6C, 0x3E, 0x31, 0x26, 0x26, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 
+    0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x70, 0x26, 0x26, 0x21, 0x6B, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x43, 
+    0x6C, 0x6F, 0x6E, 0x65, 0x26, 0x26, 0x6E, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x70, 0x29, 0x29, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 0x6E, 0x2E, 0x65, 0x71, 0x28, 0x63, 0x29, 0x3B, 
+    0x71, 0x26, 0x26, 0x28, 0x61, 0x5B, 0x30, 0x5D, 0x3D, 0x70, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 0x69, 0x73, 
+    0x2C, 0x63, 0x2C, 0x64, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x28, 0x29, 0x29, 0x29, 0x2C, 0x64, 0x2E, 0x64, 0x6F, 0x6D, 0x4D, 
+    0x61, 0x6E, 0x69, 0x70, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7D, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x6C, 0x26, 0x26, 0x28, 0x69, 
+    0x3D, 0x6D, 0x2E, 0x62, 0x75, 0x69, 0x6C, 0x64, 0x46, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x61, 0x2C, 0x74, 
+    0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 
+    0x2C, 0x21, 0x31, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2C, 0x63, 0x3D, 0x69, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 
+    0x68, 0x69, 0x6C, 0x64, 0x2C, 0x31, 0x3D, 0x3D, 0x3D, 0x69, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x4E, 0x6F, 0x64, 0x65, 
+    0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x28, 0x69, 0x3D, 0x63, 0x29, 0x2C, 0x63, 0x29, 0x29, 0x7B, 
+    0x66, 0x6F, 0x72, 0x28, 0x67, 0x3D, 0x6D, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x75, 0x62, 0x28, 0x69, 0x2C, 0x22, 0x73, 0x63, 
+    0x72, 0x69, 0x70, 0x74, 0x22, 0x29, 0x2C, 0x78, 0x62, 0x29, 0x2C, 0x66, 0x3D, 0x67, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x3B, 0x6C, 0x3E, 0x6A, 0x3B, 0x6A, 0x2B, 0x2B, 0x29, 0x64, 0x3D, 0x69, 0x2C, 0x6A, 0x21, 0x3D, 0x3D, 0x6F, 0x26, 
+    0x26, 0x28, 0x64, 0x3D, 0x6D, 0x2E, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x28, 0x64, 0x2C, 0x21, 0x30, 0x2C, 0x21, 0x30, 0x29, 
+    0x2C, 0x66, 0x26, 0x26, 0x6D, 0x2E, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x28, 0x67, 0x2C, 0x75, 0x62, 0x28, 0x64, 0x2C, 0x22, 
+    0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x29, 0x29, 0x29, 0x2C, 0x62, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 
+    0x69, 0x73, 0x5B, 0x6A, 0x5D, 0x2C, 0x64, 0x2C, 0x6A, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x66, 0x29, 0x66, 0x6F, 0x72, 0x28, 
+    0x68, 0x3D, 0x67, 0x5B, 0x67, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2D, 0x31, 0x5D, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 
+    0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x6D, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x67, 0x2C, 0x79, 0x62, 
+    0x29, 0x2C, 0x6A, 0x3D, 0x30, 0x3B, 0x66, 0x3E, 0x6A, 0x3B, 0x6A, 0x2B, 0x2B, 0x29, 0x64, 0x3D, 0x67, 0x5B, 0x6A, 0x5D, 
+    0x2C, 0x6F, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x64, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x22, 0x22, 0x29, 
+    0x26, 0x26, 0x21, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x64, 0x2C, 0x22, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 
+    0x45, 0x76, 0x61, 0x6C, 0x22, 0x29, 0x26, 0x26, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x28, 0x68, 
+    0x2C, 0x64, 0x29, 0x26, 0x26, 0x28, 0x64, 0x2E, 0x73, 0x72, 0x63, 0x3F, 0x6D, 0x2E, 0x5F, 0x65, 0x76, 0x61, 0x6C, 0x55, 
+    0x72, 0x6C, 0x26, 0x26, 0x6D, 0x2E, 0x5F, 0x65, 0x76, 0x61, 0x6C, 0x55, 0x72, 0x6C, 0x28, 0x64, 0x2E, 0x73, 0x72, 0x63, 
+    0x29, 0x3A, 0x6D, 0x2E, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x45, 0x76, 0x61, 0x6C, 0x28, 0x28, 0x64, 0x2E, 0x74, 0x65, 
+    0x78, 0x74, 0x7C, 0x7C, 0x64, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x64, 
+    0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x7C, 0x7C, 0x22, 0x22, 0x29, 0x2E, 0x72, 0x65, 0x70, 0x6C, 
+    0x61, 0x63, 0x65, 0x28, 0x71, 0x62, 0x2C, 0x22, 0x22, 0x29, 0x29, 0x29, 0x3B, 0x69, 0x3D, 0x63, 0x3D, 0x6E, 0x75, 0x6C, 
+    0x6C, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 
+    0x61, 0x63, 0x68, 0x28, 0x7B, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x54, 0x6F, 0x3A, 0x22, 0x61, 0x70, 0x70, 0x65, 0x6E, 
+    0x64, 0x22, 0x2C, 0x70, 0x72, 0x65, 0x70, 0x65, 0x6E, 0x64, 0x54, 0x6F, 0x3A, 0x22, 0x70, 0x72, 0x65, 0x70, 0x65, 0x6E, 
+    0x64, 0x22, 0x2C, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x42, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x3A, 0x22, 0x62, 0x65, 0x66, 
+    0x6F, 0x72, 0x65, 0x22, 0x2C, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x41, 0x66, 0x74, 0x65, 0x72, 0x3A, 0x22, 0x61, 0x66, 
+    0x74, 0x65, 0x72, 0x22, 0x2C, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x41, 0x6C, 0x6C, 0x3A, 0x22, 0x72, 0x65, 0x70, 
+    0x6C, 0x61, 0x63, 0x65, 0x57, 0x69, 0x74, 0x68, 0x22, 0x7D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x2C, 0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x66, 0x6E, 0x5B, 0x61, 0x5D, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x3D, 0x30, 0x2C, 0x65, 
+    0x3D, 0x5B, 0x5D, 0x2C, 0x67, 0x3D, 0x6D, 0x28, 0x61, 0x29, 0x2C, 0x68, 0x3D, 0x67, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x2D, 0x31, 0x3B, 0x68, 0x3E, 0x3D, 0x64, 0x3B, 0x64, 0x2B, 0x2B, 0x29, 0x63, 0x3D, 0x64, 0x3D, 0x3D, 0x3D, 0x68, 
+    0x3F, 0x74, 0x68, 0x69, 0x73, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x28, 0x21, 0x30, 0x29, 
+    0x2C, 0x6D, 0x28, 0x67, 0x5B, 0x64, 0x5D, 0x29, 0x5B, 0x62, 0x5D, 0x28, 0x63, 0x29, 0x2C, 0x66, 0x2E, 0x61, 0x70, 0x70, 
+    0x6C, 0x79, 0x28, 0x65, 0x2C, 0x63, 0x2E, 0x67, 0x65, 0x74, 0x28, 0x29, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x53, 0x74, 0x61, 0x63, 0x6B, 0x28, 0x65, 0x29, 0x7D, 0x7D, 
+    0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x43, 0x62, 0x2C, 0x44, 0x62, 0x3D, 0x7B, 0x7D, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x45, 0x62, 0x28, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x3D, 
+    0x6D, 0x28, 0x63, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x62, 0x29, 
+    0x29, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x54, 0x6F, 0x28, 0x63, 0x2E, 0x62, 0x6F, 0x64, 0x79, 0x29, 0x2C, 0x66, 
+    0x3D, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x44, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 
+    0x64, 0x53, 0x74, 0x79, 0x6C, 0x65, 0x26, 0x26, 0x28, 0x64, 0x3D, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x44, 0x65, 0x66, 0x61, 
+    0x75, 0x6C, 0x74, 0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x64, 0x53, 0x74, 0x79, 0x6C, 0x65, 0x28, 0x65, 0x5B, 0x30, 
+    0x5D, 0x29, 0x29, 0x3F, 0x64, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 
+    0x65, 0x5B, 0x30, 0x5D, 0x2C, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x22, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x65, 0x2E, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x28, 0x29, 0x2C, 0x66, 0x7D, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x46, 0x62, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x79, 0x2C, 0x63, 
+    0x3D, 0x44, 0x62, 0x5B, 0x61, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x7C, 0x7C, 0x28, 0x63, 0x3D, 
+    0x45, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x2C, 0x22, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x21, 0x3D, 0x3D, 0x63, 0x26, 0x26, 
+    0x63, 0x7C, 0x7C, 0x28, 0x43, 0x62, 0x3D, 0x28, 0x43, 0x62, 0x7C, 0x7C, 0x6D, 0x28, 0x22, 0x3C, 0x69, 0x66, 0x72, 0x61, 
+    0x6D, 0x65, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3D, 0x27, 0x30, 0x27, 0x20, 0x77, 
+    0x69, 0x64, 0x74, 0x68, 0x3D, 0x27, 0x30, 0x27, 0x20, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x27, 0x30, 0x27, 0x2F, 
+    0x3E, 0x22, 0x29, 0x29, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x54, 0x6F, 0x28, 0x62, 0x2E, 0x64, 0x6F, 0x63, 0x75, 
+    0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x29, 0x2C, 0x62, 0x3D, 0x28, 0x43, 0x62, 0x5B, 0x30, 
+    0x5D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x7C, 0x7C, 0x43, 0x62, 0x5B, 
+    0x30, 0x5D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x29, 0x2E, 
+    0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x62, 0x2E, 0x77, 0x72, 0x69, 0x74, 0x65, 0x28, 0x29, 0x2C, 0x62, 
+    0x2E, 0x63, 0x6C, 0x6F, 0x73, 0x65, 0x28, 0x29, 0x2C, 0x63, 0x3D, 0x45, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x2C, 0x43, 
+    0x62, 0x2E, 0x64, 0x65, 0x74, 0x61, 0x63, 0x68, 0x28, 0x29, 0x29, 0x2C, 0x44, 0x62, 0x5B, 0x61, 0x5D, 0x3D, 0x63, 0x29, 
+    0x2C, 0x63, 0x7D, 0x21, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 
+    0x3B, 0x6B, 0x2E, 0x73, 0x68, 0x72, 0x69, 0x6E, 0x6B, 0x57, 0x72, 0x61, 0x70, 0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x3D, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 
+    0x61, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3B, 0x61, 0x3D, 0x21, 0x31, 0x3B, 0x76, 0x61, 0x72, 0x20, 
+    0x62, 0x2C, 0x63, 0x2C, 0x64, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x3D, 0x79, 0x2E, 0x67, 0x65, 0x74, 
+    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x22, 0x62, 
+    0x6F, 0x64, 0x79, 0x22, 0x29, 0x5B, 0x30, 0x5D, 0x2C, 0x63, 0x26, 0x26, 0x63, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3F, 
+    0x28, 0x62, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 
+    0x64, 0x69, 0x76, 0x22, 0x29, 0x2C, 0x64, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 
+    0x65, 0x6E, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x2C, 0x64, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x63, 
+    0x73, 0x73, 0x54, 0x65, 0x78, 0x74, 0x3D, 0x22, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x61, 0x62, 0x73, 
+    0x6F, 0x6C, 0x75, 0x74, 0x65, 0x3B, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x30, 0x3B, 0x77, 0x69, 0x64, 0x74, 0x68, 
+    0x3A, 0x30, 0x3B, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x30, 0x3B, 0x74, 0x6F, 0x70, 0x3A, 0x30, 0x3B, 0x6C, 0x65, 
+    0x66, 0x74, 0x3A, 0x2D, 0x39, 0x39, 0x39, 0x39, 0x70, 0x78, 0x22, 0x2C, 0x63, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 
+    0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x64, 0x29, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 
+    0x28, 0x62, 0x29, 0x2C, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x7A, 
+    0x6F, 0x6F, 0x6D, 0x21, 0x3D, 0x3D, 0x4B, 0x26, 0x26, 0x28, 0x62, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x63, 0x73, 
+    0x73, 0x54, 0x65, 0x78, 0x74, 0x3D, 0x22, 0x2D, 0x77, 0x65, 0x62, 0x6B, 0x69, 0x74, 0x2D, 0x62, 0x6F, 0x78, 0x2D, 0x73, 
+    0x69, 0x7A, 0x69, 0x6E, 0x67, 0x3A, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x62, 0x6F, 0x78, 0x3B, 0x2D, 0x6D, 
+    0x6F, 0x7A, 0x2D, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x3A, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 
+    0x74, 0x2D, 0x62, 0x6F, 0x78, 0x3B, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x3A, 0x63, 0x6F, 0x6E, 
+    0x74, 0x65, 0x6E, 0x74, 0x2D, 0x62, 0x6F, 0x78, 0x3B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x62, 0x6C, 0x6F, 
+    0x63, 0x6B, 0x3B, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x30, 0x3B, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x30, 
+    0x3B, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x31, 0x70, 0x78, 0x3B, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 
+    0x70, 0x78, 0x3B, 0x7A, 0x6F, 0x6F, 0x6D, 0x3A, 0x31, 0x22, 0x2C, 0x62, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 
+    0x68, 0x69, 0x6C, 0x64, 0x28, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 
+    0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x29, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x77, 0x69, 0x64, 0x74, 0x68, 
+    0x3D, 0x22, 0x35, 0x70, 0x78, 0x22, 0x2C, 0x61, 0x3D, 0x33, 0x21, 0x3D, 0x3D, 0x62, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 
+    0x74, 0x57, 0x69, 0x64, 0x74, 0x68, 0x29, 0x2C, 0x63, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x68, 0x69, 0x6C, 
+    0x64, 0x28, 0x64, 0x29, 0x2C, 0x61, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x7D, 0x28, 0x29, 0x3B, 0x76, 
+    0x61, 0x72, 0x20, 0x47, 0x62, 0x3D, 0x2F, 0x5E, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2F, 0x2C, 0x48, 0x62, 0x3D, 0x6E, 
+    0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x28, 0x22, 0x2B, 0x53, 0x2B, 0x22, 0x29, 0x28, 
+    0x3F, 0x21, 0x70, 0x78, 0x29, 0x5B, 0x61, 0x2D, 0x7A, 0x25, 0x5D, 0x2B, 0x24, 0x22, 0x2C, 0x22, 0x69, 0x22, 0x29, 0x2C, 
+    0x49, 0x62, 0x2C, 0x4A, 0x62, 0x2C, 0x4B, 0x62, 0x3D, 0x2F, 0x5E, 0x28, 0x74, 0x6F, 0x70, 0x7C, 0x72, 0x69, 0x67, 0x68, 
+    0x74, 0x7C, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x7C, 0x6C, 0x65, 0x66, 0x74, 0x29, 0x24, 0x2F, 0x3B, 0x61, 0x2E, 0x67, 
+    0x65, 0x74, 0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x64, 0x53, 0x74, 0x79, 0x6C, 0x65, 0x3F, 0x28, 0x49, 0x62, 0x3D, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 
+    0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x65, 0x66, 0x61, 0x75, 
+    0x6C, 0x74, 0x56, 0x69, 0x65, 0x77, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x64, 0x53, 0x74, 
+    0x79, 0x6C, 0x65, 0x28, 0x61, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x7D, 0x2C, 0x4A, 0x62, 0x3D, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x2C, 
+    0x66, 0x2C, 0x67, 0x2C, 0x68, 0x3D, 0x61, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x63, 0x3D, 0x63, 0x7C, 0x7C, 0x49, 0x62, 0x28, 0x61, 0x29, 0x2C, 0x67, 0x3D, 0x63, 0x3F, 0x63, 0x2E, 0x67, 0x65, 
+    0x74, 0x50, 0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x79, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x28, 0x62, 0x29, 0x7C, 0x7C, 0x63, 
+    0x5B, 0x62, 0x5D, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x63, 0x26, 0x26, 0x28, 0x22, 0x22, 0x21, 0x3D, 0x3D, 
+    0x67, 0x7C, 0x7C, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x28, 0x61, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 
+    0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x61, 0x29, 0x7C, 0x7C, 0x28, 0x67, 0x3D, 0x6D, 0x2E, 0x73, 
+    0x74, 0x79, 0x6C, 0x65, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x29, 0x2C, 0x48, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x67, 
+    0x29, 0x26, 0x26, 0x47, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x62, 0x29, 0x26, 0x26, 0x28, 0x64, 0x3D, 0x68, 0x2E, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x65, 0x3D, 0x68, 0x2E, 0x6D, 0x69, 0x6E, 0x57, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x66, 
+    0x3D, 0x68, 0x2E, 0x6D, 0x61, 0x78, 0x57, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x68, 0x2E, 0x6D, 0x69, 0x6E, 0x57, 0x69, 0x64, 
+    0x74, 0x68, 0x3D, 0x68, 0x2E, 0x6D, 0x61, 0x78, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x68, 0x2E, 0x77, 0x69, 0x64, 0x74, 
+    0x68, 0x3D, 0x67, 0x2C, 0x67, 0x3D, 0x63, 0x2E, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x68, 0x2E, 0x77, 0x69, 0x64, 0x74, 
+    0x68, 0x3D, 0x64, 0x2C, 0x68, 0x2E, 0x6D, 0x69, 0x6E, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x65, 0x2C, 0x68, 0x2E, 0x6D, 
+    0x61, 0x78, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x66, 0x29, 0x29, 0x2C, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 
+    0x3D, 0x67, 0x3F, 0x67, 0x3A, 0x67, 0x2B, 0x22, 0x22, 0x7D, 0x29, 0x3A, 0x79, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 
+    0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x53, 0x74, 0x79, 
+    0x6C, 0x65, 0x26, 0x26, 0x28, 0x49, 0x62, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x53, 0x74, 0x79, 0x6C, 
+    0x65, 0x7D, 0x2C, 0x4A, 0x62, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 
+    0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x3D, 0x61, 0x2E, 0x73, 0x74, 
+    0x79, 0x6C, 0x65, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x3D, 0x63, 0x7C, 0x7C, 0x49, 0x62, 0x28, 0x61, 
+    0x29, 0x2C, 0x67, 0x3D, 0x63, 0x3F, 0x63, 0x5B, 0x62, 0x5D, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x6E, 0x75, 
+    0x6C, 0x6C, 0x3D, 0x3D, 0x67, 0x26, 0x26, 0x68, 0x26, 0x26, 0x68, 0x5B, 0x62, 0x5D, 0x26, 0x26, 0x28, 0x67, 0x3D, 0x68, 
+    0x5B, 0x62, 0x5D, 0x29, 0x2C, 0x48, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x67, 0x29, 0x26, 0x26, 0x21, 0x4B, 0x62, 
+    0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x62, 0x29, 0x26, 0x26, 0x28, 0x64, 0x3D, 0x68, 0x2E, 0x6C, 0x65, 0x66, 0x74, 0x2C, 
+    0x65, 0x3D, 0x61, 0x2E, 0x72, 0x75, 0x6E, 0x74, 0x69, 0x6D, 0x65, 0x53, 0x74, 0x79, 0x6C, 0x65, 0x2C, 0x66, 0x3D, 0x65, 
+    0x26, 0x26, 0x65, 0x2E, 0x6C, 0x65, 0x66, 0x74, 0x2C, 0x66, 0x26, 0x26, 0x28, 0x65, 0x2E, 0x6C, 0x65, 0x66, 0x74, 0x3D, 
+    0x61, 0x2E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x53, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x6C, 0x65, 0x66, 0x74, 0x29, 
+    0x2C, 0x68, 0x2E, 0x6C, 0x65, 0x66, 0x74, 0x3D, 0x22, 0x66, 0x6F, 0x6E, 0x74, 0x53, 0x69, 0x7A, 0x65, 0x22, 0x3D, 0x3D, 
+    0x3D, 0x62, 0x3F, 0x22, 0x31, 0x65, 0x6D, 0x22, 0x3A, 0x67, 0x2C, 0x67, 0x3D, 0x68, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 
+    0x4C, 0x65, 0x66, 0x74, 0x2B, 0x22, 0x70, 0x78, 0x22, 0x2C, 0x68, 0x2E, 0x6C, 0x65, 0x66, 0x74, 0x3D, 0x64, 0x2C, 0x66, 
+    0x26, 0x26, 0x28, 0x65, 0x2E, 0x6C, 0x65, 0x66, 0x74, 0x3D, 0x66, 0x29, 0x29, 0x2C, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 
+    0x3D, 0x3D, 0x3D, 0x67, 0x3F, 0x67, 0x3A, 0x67, 0x2B, 0x22, 0x22, 0x7C, 0x7C, 0x22, 0x61, 0x75, 0x74, 0x6F, 0x22, 0x7D, 
+    0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x4C, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x7B, 0x67, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 
+    0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x61, 0x28, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 
+    0x63, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x3F, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x64, 0x65, 0x6C, 0x65, 
+    0x74, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x67, 0x65, 0x74, 0x3A, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x67, 0x65, 
+    0x74, 0x3D, 0x62, 0x29, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x72, 0x67, 0x75, 
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x7D, 0x7D, 0x7D, 0x21, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 
+    0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x3B, 0x69, 
+    0x66, 0x28, 0x62, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 
+    0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x2C, 0x62, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 0x3D, 0x22, 
+    0x20, 0x20, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x2F, 0x3E, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x2F, 0x74, 0x61, 
+    0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x27, 0x2F, 0x61, 0x27, 0x3E, 0x61, 0x3C, 0x2F, 
+    0x61, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x27, 0x63, 0x68, 0x65, 0x63, 0x6B, 
+    0x62, 0x6F, 0x78, 0x27, 0x2F, 0x3E, 0x22, 0x2C, 0x64, 0x3D, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 
+    0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x22, 0x61, 0x22, 0x29, 0x5B, 0x30, 0x5D, 
+    0x2C, 0x63, 0x3D, 0x64, 0x26, 0x26, 0x64, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x29, 0x7B, 0x63, 0x2E, 0x63, 0x73, 0x73, 
+    0x54, 0x65, 0x78, 0x74, 0x3D, 0x22, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3A, 0x6C, 0x65, 0x66, 0x74, 0x3B, 0x6F, 0x70, 0x61, 
+    0x63, 0x69, 0x74, 0x79, 0x3A, 0x2E, 0x35, 0x22, 0x2C, 0x6B, 0x2E, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3D, 0x22, 
+    0x30, 0x2E, 0x35, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x2E, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x2C, 0x6B, 0x2E, 0x63, 
+    0x73, 0x73, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x3D, 0x21, 0x21, 0x63, 0x2E, 0x63, 0x73, 0x73, 0x46, 0x6C, 0x6F, 0x61, 0x74, 
+    0x2C, 0x62, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 
+    0x6C, 0x69, 0x70, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x62, 0x6F, 0x78, 0x22, 0x2C, 0x62, 0x2E, 
+    0x63, 0x6C, 0x6F, 0x6E, 0x65, 0x4E, 0x6F, 0x64, 0x65, 0x28, 0x21, 0x30, 0x29, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 
+    0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6C, 0x69, 0x70, 0x3D, 0x22, 0x22, 0x2C, 0x6B, 0x2E, 
+    0x63, 0x6C, 0x65, 0x61, 0x72, 0x43, 0x6C, 0x6F, 0x6E, 0x65, 0x53, 0x74, 0x79, 0x6C, 0x65, 0x3D, 0x22, 0x63, 0x6F, 0x6E, 
+    0x74, 0x65, 0x6E, 0x74, 0x2D, 0x62, 0x6F, 0x78, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 
+    0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x43, 0x6C, 0x69, 0x70, 0x2C, 0x6B, 0x2E, 0x62, 0x6F, 0x78, 
+    0x53, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x3D, 0x22, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x2E, 0x62, 0x6F, 0x78, 0x53, 0x69, 0x7A, 
+    0x69, 0x6E, 0x67, 0x7C, 0x7C, 0x22, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x2E, 0x4D, 0x6F, 0x7A, 0x42, 0x6F, 0x78, 0x53, 0x69, 
+    0x7A, 0x69, 0x6E, 0x67, 0x7C, 0x7C, 0x22, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x2E, 0x57, 0x65, 0x62, 0x6B, 0x69, 0x74, 0x42, 
+    0x6F, 0x78, 0x53, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x6B, 0x2C, 
+    0x7B, 0x72, 0x65, 0x6C, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x48, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x4F, 0x66, 0x66, 0x73, 0x65, 
+    0x74, 0x73, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x67, 0x26, 0x26, 0x69, 0x28, 0x29, 0x2C, 0x67, 0x7D, 0x2C, 0x62, 0x6F, 0x78, 
+    0x53, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x52, 0x65, 0x6C, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x66, 
+    0x26, 0x26, 0x69, 0x28, 0x29, 0x2C, 0x66, 0x7D, 0x2C, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x50, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x65, 0x26, 0x26, 0x69, 0x28, 0x29, 0x2C, 0x65, 0x7D, 0x2C, 0x72, 0x65, 0x6C, 
+    0x69, 0x61, 0x62, 0x6C, 0x65, 0x4D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x52, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 
+    0x3D, 0x68, 0x26, 0x26, 0x69, 0x28, 0x29, 0x2C, 0x68, 0x7D, 0x7D, 0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x69, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x69, 0x3B, 0x63, 0x3D, 
+    0x79, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 
+    0x6D, 0x65, 0x28, 0x22, 0x62, 0x6F, 0x64, 0x79, 0x22, 0x29, 0x5B, 0x30, 0x5D, 0x2C, 0x63, 0x26, 0x26, 0x63, 0x2E, 0x73, 
+    0x74, 0x79, 0x6C, 0x65, 0x26, 0x26, 0x28, 0x62, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 
+    0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x2C, 0x64, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 
+    0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x2C, 0x64, 0x2E, 0x73, 
+    0x74, 0x79, 0x6C, 0x65, 0x2E, 0x63, 0x73, 0x73, 0x54, 0x65, 0x78, 0x74, 0x3D, 0x22, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x3A, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x3B, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x30, 
+    0x3B, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x30, 0x3B, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x30, 0x3B, 0x74, 0x6F, 
+    0x70, 0x3A, 0x30, 0x3B, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x2D, 0x39, 0x39, 0x39, 0x39, 0x70, 0x78, 0x22, 0x2C, 0x63, 0x2E, 
+    0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x64, 0x29, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 
+    0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x62, 0x29, 0x2C, 0x62, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x63, 0x73, 
+    0x73, 0x54, 0x65, 0x78, 0x74, 0x3D, 0x22, 0x2D, 0x77, 0x65, 0x62, 0x6B, 0x69, 0x74, 0x2D, 0x62, 0x6F, 0x78, 0x2D, 0x73, 
+    0x69, 0x7A, 0x69, 0x6E, 0x67, 0x3A, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x62, 0x6F, 0x78, 0x3B, 0x2D, 0x6D, 0x6F, 
+    0x7A, 0x2D, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x3A, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 
+    0x62, 0x6F, 0x78, 0x3B, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x3A, 0x62, 0x6F, 0x72, 0x64, 0x65, 
+    0x72, 0x2D, 0x62, 0x6F, 0x78, 0x3B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x3B, 
+    0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x74, 0x6F, 0x70, 0x3A, 0x31, 0x25, 0x3B, 0x74, 0x6F, 0x70, 0x3A, 0x31, 0x25, 
+    0x3B, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x31, 0x70, 0x78, 0x3B, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 
+    0x31, 0x70, 0x78, 0x3B, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x34, 0x70, 0x78, 0x3B, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x3A, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x22, 0x2C, 0x65, 0x3D, 0x66, 0x3D, 0x21, 0x31, 0x2C, 
+    0x68, 0x3D, 0x21, 0x30, 0x2C, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x64, 0x53, 0x74, 
+    0x79, 0x6C, 0x65, 0x26, 0x26, 0x28, 0x65, 0x3D, 0x22, 0x31, 0x25, 0x22, 0x21, 0x3D, 0x3D, 0x28, 0x61, 0x2E, 0x67, 0x65, 
+    0x74, 0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x64, 0x53, 0x74, 0x79, 0x6C, 0x65, 0x28, 0x62, 0x2C, 0x6E, 0x75, 0x6C, 
+    0x6C, 0x29, 0x7C, 0x7C, 0x7B, 0x7D, 0x29, 0x2E, 0x74, 0x6F, 0x70, 0x2C, 0x66, 0x3D, 0x22, 0x34, 0x70, 0x78, 0x22, 0x3D, 
+    0x3D, 0x3D, 0x28, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x64, 0x53, 0x74, 0x79, 0x6C, 
+    0x65, 0x28, 0x62, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x7C, 0x7C, 0x7B, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x22, 0x34, 
+    0x70, 0x78, 0x22, 0x7D, 0x29, 0x2E, 0x77, 0x69, 0x64, 0x74, 0x68, 0x2C, 0x69, 0x3D, 0x62, 0x2E, 0x61, 0x70, 0x70, 0x65, 
+    0x6E, 0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 
+    0x65, 0x6E, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x29, 0x2C, 0x69, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 
+    0x63, 0x73, 0x73, 0x54, 0x65, 0x78, 0x74, 0x3D, 0x62, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x63, 0x73, 0x73, 0x54, 
+    0x65, 0x78, 0x74, 0x3D, 0x22, 0x2D, 0x77, 0x65, 0x62, 0x6B, 0x69, 0x74, 0x2D, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x69, 0x7A, 
+    0x69, 0x6E, 0x67, 0x3A, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x62, 0x6F, 0x78, 0x3B, 0x2D, 0x6D, 0x6F, 0x7A, 
+    0x2D, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x3A, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 
+    0x62, 0x6F, 0x78, 0x3B, 0x62, 0x6F, 0x78, 0x2D, 0x73, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x3A, 0x63, 0x6F, 0x6E, 0x74, 0x65, 
+    0x6E, 0x74, 0x2D, 0x62, 0x6F, 0x78, 0x3B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 
+    0x3B, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x3A, 0x30, 0x3B, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x30, 0x3B, 0x70, 
+    0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x30, 0x22, 0x2C, 0x69, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x6D, 0x61, 
+    0x72, 0x67, 0x69, 0x6E, 0x52, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x69, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x3D, 0x22, 0x30, 0x22, 0x2C, 0x62, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x77, 0x69, 0x64, 0x74, 
+    0x68, 0x3D, 0x22, 0x31, 0x70, 0x78, 0x22, 0x2C, 0x68, 0x3D, 0x21, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6C, 0x6F, 0x61, 
+    0x74, 0x28, 0x28, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x43, 0x6F, 0x6D, 0x70, 0x75, 0x74, 0x65, 0x64, 0x53, 0x74, 0x79, 0x6C, 
+    0x65, 0x28, 0x69, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x7C, 0x7C, 0x7B, 0x7D, 0x29, 0x2E, 0x6D, 0x61, 0x72, 0x67, 0x69, 
+    0x6E, 0x52, 0x69, 0x67, 0x68, 0x74, 0x29, 0x29, 0x2C, 0x62, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 
+    0x3D, 0x22, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x74, 0x72, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x3C, 0x2F, 0x74, 
+    0x64, 0x3E, 0x3C, 0x74, 0x64, 0x3E, 0x74, 0x3C, 0x2F, 0x74, 0x64, 0x3E, 0x3C, 0x2F, 0x74, 0x72, 0x3E, 0x3C, 0x2F, 0x74, 
+    0x61, 0x62, 0x6C, 0x65, 0x3E, 0x22, 0x2C, 0x69, 0x3D, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 
+    0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x22, 0x74, 0x64, 0x22, 0x29, 0x2C, 0x69, 0x5B, 
+    0x30, 0x5D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x63, 0x73, 0x73, 0x54, 0x65, 0x78, 0x74, 0x3D, 0x22, 0x6D, 0x61, 
+    0x72, 0x67, 0x69, 0x6E, 0x3A, 0x30, 0x3B, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x30, 0x3B, 0x70, 0x61, 0x64, 0x64, 
+    0x69, 0x6E, 0x67, 0x3A, 0x30, 0x3B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x2C, 
+    0x67, 0x3D, 0x30, 0x3D, 0x3D, 0x3D, 0x69, 0x5B, 0x30, 0x5D, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x48, 0x65, 0x69, 
+    0x67, 0x68, 0x74, 0x2C, 0x67, 0x26, 0x26, 0x28, 0x69, 0x5B, 0x30, 0x5D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x64, 
+    0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3D, 0x22, 0x22, 0x2C, 0x69, 0x5B, 0x31, 0x5D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 
+    0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3D, 0x22, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x2C, 0x67, 0x3D, 0x30, 0x3D, 
+    0x3D, 0x3D, 0x69, 0x5B, 0x30, 0x5D, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 0x29, 
+    0x2C, 0x63, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x64, 0x29, 0x29, 0x7D, 0x7D, 
+    0x7D, 0x28, 0x29, 0x2C, 0x6D, 0x2E, 0x73, 0x77, 0x61, 0x70, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x3D, 0x7B, 
+    0x7D, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x66, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x29, 0x67, 0x5B, 0x66, 0x5D, 0x3D, 0x61, 0x2E, 
+    0x73, 0x74, 0x79, 0x6C, 0x65, 0x5B, 0x66, 0x5D, 0x2C, 0x61, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x5B, 0x66, 0x5D, 0x3D, 
+    0x62, 0x5B, 0x66, 0x5D, 0x3B, 0x65, 0x3D, 0x63, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x61, 0x2C, 0x64, 0x7C, 0x7C, 
+    0x5B, 0x5D, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x66, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x29, 0x61, 0x2E, 0x73, 0x74, 0x79, 
+    0x6C, 0x65, 0x5B, 0x66, 0x5D, 0x3D, 0x67, 0x5B, 0x66, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x7D, 
+    0x3B, 0x76, 0x61, 0x72, 0x20, 0x4D, 0x62, 0x3D, 0x2F, 0x61, 0x6C, 0x70, 0x68, 0x61, 0x5C, 0x28, 0x5B, 0x5E, 0x29, 0x5D, 
+    0x2A, 0x5C, 0x29, 0x2F, 0x69, 0x2C, 0x4E, 0x62, 0x3D, 0x2F, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x5C, 0x73, 0x2A, 
+    0x3D, 0x5C, 0x73, 0x2A, 0x28, 0x5B, 0x5E, 0x29, 0x5D, 0x2A, 0x29, 0x2F, 0x2C, 0x4F, 0x62, 0x3D, 0x2F, 0x5E, 0x28, 0x6E, 
+    0x6F, 0x6E, 0x65, 0x7C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x28, 0x3F, 0x21, 0x2D, 0x63, 0x5B, 0x65, 0x61, 0x5D, 0x29, 0x2E, 
+    0x2B, 0x29, 0x2F, 0x2C, 0x50, 0x62, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 
+    0x28, 0x22, 0x2B, 0x53, 0x2B, 0x22, 0x29, 0x28, 0x2E, 0x2A, 0x29, 0x24, 0x22, 0x2C, 0x22, 0x69, 0x22, 0x29, 0x2C, 0x51, 
+    0x62, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x28, 0x5B, 0x2B, 0x2D, 0x5D, 
+    0x29, 0x3D, 0x28, 0x22, 0x2B, 0x53, 0x2B, 0x22, 0x29, 0x22, 0x2C, 0x22, 0x69, 0x22, 0x29, 0x2C, 0x52, 0x62, 0x3D, 0x7B, 
+    0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x22, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x22, 0x2C, 
+    0x76, 0x69, 0x73, 0x69, 0x62, 0x69, 0x6C, 0x69, 0x74, 0x79, 0x3A, 0x22, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x22, 0x2C, 
+    0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3A, 0x22, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x22, 0x7D, 0x2C, 0x53, 0x62, 0x3D, 
+    0x7B, 0x6C, 0x65, 0x74, 0x74, 0x65, 0x72, 0x53, 0x70, 0x61, 0x63, 0x69, 0x6E, 0x67, 0x3A, 0x22, 0x30, 0x22, 0x2C, 0x66, 
+    0x6F, 0x6E, 0x74, 0x57, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x22, 0x34, 0x30, 0x30, 0x22, 0x7D, 0x2C, 0x54, 0x62, 0x3D, 
+    0x5B, 0x22, 0x57, 0x65, 0x62, 0x6B, 0x69, 0x74, 0x22, 0x2C, 0x22, 0x4F, 0x22, 0x2C, 0x22, 0x4D, 0x6F, 0x7A, 0x22, 0x2C, 
+    0x22, 0x6D, 0x73, 0x22, 0x5D, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x55, 0x62, 0x28, 0x61, 0x2C, 
+    0x62, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x62, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x62, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x62, 0x2E, 0x63, 0x68, 0x61, 0x72, 0x41, 0x74, 0x28, 0x30, 0x29, 0x2E, 
+    0x74, 0x6F, 0x55, 0x70, 0x70, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x2B, 0x62, 0x2E, 0x73, 0x6C, 0x69, 0x63, 
+    0x65, 0x28, 0x31, 0x29, 0x2C, 0x64, 0x3D, 0x62, 0x2C, 0x65, 0x3D, 0x54, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 
+    0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x65, 0x2D, 0x2D, 0x29, 0x69, 0x66, 0x28, 0x62, 0x3D, 0x54, 0x62, 0x5B, 0x65, 
+    0x5D, 0x2B, 0x63, 0x2C, 0x62, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x3B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x56, 0x62, 
+    0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 
+    0x66, 0x3D, 0x5B, 0x5D, 0x2C, 0x67, 0x3D, 0x30, 0x2C, 0x68, 0x3D, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 
+    0x68, 0x3E, 0x67, 0x3B, 0x67, 0x2B, 0x2B, 0x29, 0x64, 0x3D, 0x61, 0x5B, 0x67, 0x5D, 0x2C, 0x64, 0x2E, 0x73, 0x74, 0x79, 
+    0x6C, 0x65, 0x26, 0x26, 0x28, 0x66, 0x5B, 0x67, 0x5D, 0x3D, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x64, 0x2C, 
+    0x22, 0x6F, 0x6C, 0x64, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x22, 0x29, 0x2C, 0x63, 0x3D, 0x64, 0x2E, 0x73, 0x74, 
+    0x79, 0x6C, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x2C, 0x62, 0x3F, 0x28, 0x66, 0x5B, 0x67, 0x5D, 0x7C, 
+    0x7C, 0x22, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x21, 0x3D, 0x3D, 0x63, 0x7C, 0x7C, 0x28, 0x64, 0x2E, 0x73, 0x74, 0x79, 0x6C, 
+    0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3D, 0x22, 0x22, 0x29, 0x2C, 0x22, 0x22, 0x3D, 0x3D, 0x3D, 0x64, 
+    0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x26, 0x26, 0x55, 0x28, 0x64, 0x29, 
+    0x26, 0x26, 0x28, 0x66, 0x5B, 0x67, 0x5D, 0x3D, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x64, 0x2C, 0x22, 0x6F, 
+    0x6C, 0x64, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x22, 0x2C, 0x46, 0x62, 0x28, 0x64, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 
+    0x4E, 0x61, 0x6D, 0x65, 0x29, 0x29, 0x29, 0x29, 0x3A, 0x28, 0x65, 0x3D, 0x55, 0x28, 0x64, 0x29, 0x2C, 0x28, 0x63, 0x26, 
+    0x26, 0x22, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x21, 0x3D, 0x3D, 0x63, 0x7C, 0x7C, 0x21, 0x65, 0x29, 0x26, 0x26, 0x6D, 0x2E, 
+    0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x64, 0x2C, 0x22, 0x6F, 0x6C, 0x64, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x22, 
+    0x2C, 0x65, 0x3F, 0x63, 0x3A, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x64, 0x2C, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 
+    0x79, 0x22, 0x29, 0x29, 0x29, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x67, 0x3D, 0x30, 0x3B, 0x68, 0x3E, 0x67, 0x3B, 0x67, 
+    0x2B, 0x2B, 0x29, 0x64, 0x3D, 0x61, 0x5B, 0x67, 0x5D, 0x2C, 0x64, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x26, 0x26, 0x28, 
+    0x62, 0x26, 0x26, 0x22, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x21, 0x3D, 0x3D, 0x64, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 
+    0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x26, 0x26, 0x22, 0x22, 0x21, 0x3D, 0x3D, 0x64, 0x2E, 0x73, 0x74, 0x79, 0x6C, 
+    0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x7C, 0x7C, 0x28, 0x64, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 
+    0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3D, 0x62, 0x3F, 0x66, 0x5B, 0x67, 0x5D, 0x7C, 0x7C, 0x22, 0x22, 0x3A, 0x22, 
+    0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x29, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x7D, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x57, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 
+    0x64, 0x3D, 0x50, 0x62, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x62, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x64, 0x3F, 0x4D, 0x61, 0x74, 0x68, 0x2E, 0x6D, 0x61, 0x78, 0x28, 0x30, 0x2C, 0x64, 0x5B, 0x31, 0x5D, 0x2D, 0x28, 0x63, 
+    0x7C, 0x7C, 0x30, 0x29, 0x29, 0x2B, 0x28, 0x64, 0x5B, 0x32, 0x5D, 0x7C, 0x7C, 0x22, 0x70, 0x78, 0x22, 0x29, 0x3A, 0x62, 
+    0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x58, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 
+    0x2C, 0x65, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x66, 0x3D, 0x63, 0x3D, 0x3D, 0x3D, 0x28, 0x64, 
+    0x3F, 0x22, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x22, 0x3A, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 0x29, 
+    0x3F, 0x34, 0x3A, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x3F, 0x31, 0x3A, 0x30, 0x2C, 0x67, 
+    0x3D, 0x30, 0x3B, 0x34, 0x3E, 0x66, 0x3B, 0x66, 0x2B, 0x3D, 0x32, 0x29, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x22, 
+    0x3D, 0x3D, 0x3D, 0x63, 0x26, 0x26, 0x28, 0x67, 0x2B, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 0x63, 0x2B, 
+    0x54, 0x5B, 0x66, 0x5D, 0x2C, 0x21, 0x30, 0x2C, 0x65, 0x29, 0x29, 0x2C, 0x64, 0x3F, 0x28, 0x22, 0x63, 0x6F, 0x6E, 0x74, 
+    0x65, 0x6E, 0x74, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x26, 0x26, 0x28, 0x67, 0x2D, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 
+    0x61, 0x2C, 0x22, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x22, 0x2B, 0x54, 0x5B, 0x66, 0x5D, 0x2C, 0x21, 0x30, 0x2C, 
+    0x65, 0x29, 0x29, 0x2C, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x22, 0x21, 0x3D, 0x3D, 0x63, 0x26, 0x26, 0x28, 0x67, 
+    0x2D, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 0x22, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x22, 0x2B, 0x54, 
+    0x5B, 0x66, 0x5D, 0x2B, 0x22, 0x57, 0x69, 0x64, 0x74, 0x68, 0x22, 0x2C, 0x21, 0x30, 0x2C, 0x65, 0x29, 0x29, 0x29, 0x3A, 
+    0x28, 0x67, 0x2B, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 0x22, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 
+    0x22, 0x2B, 0x54, 0x5B, 0x66, 0x5D, 0x2C, 0x21, 0x30, 0x2C, 0x65, 0x29, 0x2C, 0x22, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 
+    0x67, 0x22, 0x21, 0x3D, 0x3D, 0x63, 0x26, 0x26, 0x28, 0x67, 0x2B, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 
+    0x22, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x22, 0x2B, 0x54, 0x5B, 0x66, 0x5D, 0x2B, 0x22, 0x57, 0x69, 0x64, 0x74, 0x68, 
+    0x22, 0x2C, 0x21, 0x30, 0x2C, 0x65, 0x29, 0x29, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x67, 0x7D, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x59, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x64, 0x3D, 0x21, 0x30, 0x2C, 0x65, 0x3D, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 
+    0x3F, 0x61, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x61, 0x2E, 0x6F, 0x66, 0x66, 
+    0x73, 0x65, 0x74, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 0x2C, 0x66, 0x3D, 0x49, 0x62, 0x28, 0x61, 0x29, 0x2C, 0x67, 0x3D, 
+    0x6B, 0x2E, 0x62, 0x6F, 0x78, 0x53, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x26, 0x26, 0x22, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 
+    0x2D, 0x62, 0x6F, 0x78, 0x22, 0x3D, 0x3D, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 0x22, 0x62, 0x6F, 0x78, 
+    0x53, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x22, 0x2C, 0x21, 0x31, 0x2C, 0x66, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x30, 0x3E, 0x3D, 
+    0x65, 0x7C, 0x7C, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x65, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x65, 0x3D, 0x4A, 0x62, 0x28, 
+    0x61, 0x2C, 0x62, 0x2C, 0x66, 0x29, 0x2C, 0x28, 0x30, 0x3E, 0x65, 0x7C, 0x7C, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x65, 
+    0x29, 0x26, 0x26, 0x28, 0x65, 0x3D, 0x61, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x5B, 0x62, 0x5D, 0x29, 0x2C, 0x48, 0x62, 
+    0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x65, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x3B, 0x64, 0x3D, 
+    0x67, 0x26, 0x26, 0x28, 0x6B, 0x2E, 0x62, 0x6F, 0x78, 0x53, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x52, 0x65, 0x6C, 0x69, 0x61, 
+    0x62, 0x6C, 0x65, 0x28, 0x29, 0x7C, 0x7C, 0x65, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x5B, 0x62, 
+    0x5D, 0x29, 0x2C, 0x65, 0x3D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x28, 0x65, 0x29, 0x7C, 0x7C, 
+    0x30, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x2B, 0x58, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x7C, 
+    0x7C, 0x28, 0x67, 0x3F, 0x22, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x22, 0x3A, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 
+    0x74, 0x22, 0x29, 0x2C, 0x64, 0x2C, 0x66, 0x29, 0x2B, 0x22, 0x70, 0x78, 0x22, 0x7D, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 
+    0x6E, 0x64, 0x28, 0x7B, 0x63, 0x73, 0x73, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x3A, 0x7B, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 
+    0x79, 0x3A, 0x7B, 0x67, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 
+    0x7B, 0x69, 0x66, 0x28, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x4A, 0x62, 0x28, 0x61, 0x2C, 0x22, 0x6F, 
+    0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x22, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x22, 0x3D, 0x3D, 0x3D, 
+    0x63, 0x3F, 0x22, 0x31, 0x22, 0x3A, 0x63, 0x7D, 0x7D, 0x7D, 0x7D, 0x2C, 0x63, 0x73, 0x73, 0x4E, 0x75, 0x6D, 0x62, 0x65, 
+    0x72, 0x3A, 0x7B, 0x63, 0x6F, 0x6C, 0x75, 0x6D, 0x6E, 0x43, 0x6F, 0x75, 0x6E, 0x74, 0x3A, 0x21, 0x30, 0x2C, 0x66, 0x69, 
+    0x6C, 0x6C, 0x4F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x21, 0x30, 0x2C, 0x66, 0x6C, 0x65, 0x78, 0x47, 0x72, 0x6F, 
+    0x77, 0x3A, 0x21, 0x30, 0x2C, 0x66, 0x6C, 0x65, 0x78, 0x53, 0x68, 0x72, 0x69, 0x6E, 0x6B, 0x3A, 0x21, 0x30, 0x2C, 0x66, 
+    0x6F, 0x6E, 0x74, 0x57, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x21, 0x30, 0x2C, 0x6C, 0x69, 0x6E, 0x65, 0x48, 0x65, 0x69, 
+    0x67, 0x68, 0x74, 0x3A, 0x21, 0x30, 0x2C, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x21, 0x30, 0x2C, 0x6F, 0x72, 
+    0x64, 0x65, 0x72, 0x3A, 0x21, 0x30, 0x2C, 0x6F, 0x72, 0x70, 0x68, 0x61, 0x6E, 0x73, 0x3A, 0x21, 0x30, 0x2C, 0x77, 0x69, 
+    0x64, 0x6F, 0x77, 0x73, 0x3A, 0x21, 0x30, 0x2C, 0x7A, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x3A, 0x21, 0x30, 0x2C, 0x7A, 0x6F, 
+    0x6F, 0x6D, 0x3A, 0x21, 0x30, 0x7D, 0x2C, 0x63, 0x73, 0x73, 0x50, 0x72, 0x6F, 0x70, 0x73, 0x3A, 0x7B, 0x22, 0x66, 0x6C, 
+    0x6F, 0x61, 0x74, 0x22, 0x3A, 0x6B, 0x2E, 0x63, 0x73, 0x73, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x3F, 0x22, 0x63, 0x73, 0x73, 
+    0x46, 0x6C, 0x6F, 0x61, 0x74, 0x22, 0x3A, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x22, 0x7D, 
+    0x2C, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 
+    0x63, 0x2C, 0x64, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x61, 0x26, 0x26, 0x33, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x38, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 
+    0x65, 0x26, 0x26, 0x61, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x2C, 0x66, 0x2C, 
+    0x67, 0x2C, 0x68, 0x3D, 0x6D, 0x2E, 0x63, 0x61, 0x6D, 0x65, 0x6C, 0x43, 0x61, 0x73, 0x65, 0x28, 0x62, 0x29, 0x2C, 0x69, 
+    0x3D, 0x61, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x3B, 0x69, 0x66, 0x28, 0x62, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x50, 
+    0x72, 0x6F, 0x70, 0x73, 0x5B, 0x68, 0x5D, 0x7C, 0x7C, 0x28, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x50, 0x72, 0x6F, 0x70, 0x73, 
+    0x5B, 0x68, 0x5D, 0x3D, 0x55, 0x62, 0x28, 0x69, 0x2C, 0x68, 0x29, 0x29, 0x2C, 0x67, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 
+    0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x62, 0x5D, 0x7C, 0x7C, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 
+    0x5B, 0x68, 0x5D, 0x2C, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x63, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x67, 0x26, 0x26, 0x22, 0x67, 0x65, 0x74, 0x22, 0x69, 0x6E, 0x20, 0x67, 0x26, 0x26, 0x76, 0x6F, 0x69, 0x64, 
+    0x20, 0x30, 0x21, 0x3D, 0x3D, 0x28, 0x65, 0x3D, 0x67, 0x2E, 0x67, 0x65, 0x74, 0x28, 0x61, 0x2C, 0x21, 0x31, 0x2C, 0x64, 
+    0x29, 0x29, 0x3F, 0x65, 0x3A, 0x69, 0x5B, 0x62, 0x5D, 0x3B, 0x69, 0x66, 0x28, 0x66, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 
+    0x66, 0x20, 0x63, 0x2C, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x3D, 0x66, 0x26, 0x26, 0x28, 0x65, 
+    0x3D, 0x51, 0x62, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x63, 0x29, 0x29, 0x26, 0x26, 0x28, 0x63, 0x3D, 0x28, 0x65, 0x5B, 
+    0x31, 0x5D, 0x2B, 0x31, 0x29, 0x2A, 0x65, 0x5B, 0x32, 0x5D, 0x2B, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6C, 0x6F, 0x61, 
+    0x74, 0x28, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x29, 0x2C, 0x66, 0x3D, 0x22, 0x6E, 0x75, 0x6D, 
+    0x62, 0x65, 0x72, 0x22, 0x29, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x63, 0x26, 0x26, 0x63, 0x3D, 0x3D, 0x3D, 0x63, 
+    0x26, 0x26, 0x28, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x21, 0x3D, 0x3D, 0x66, 0x7C, 0x7C, 0x6D, 0x2E, 0x63, 
+    0x73, 0x73, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x5B, 0x68, 0x5D, 0x7C, 0x7C, 0x28, 0x63, 0x2B, 0x3D, 0x22, 0x70, 0x78, 
+    0x22, 0x29, 0x2C, 0x6B, 0x2E, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x43, 0x6C, 0x6F, 0x6E, 0x65, 0x53, 0x74, 0x79, 0x6C, 0x65, 
+    0x7C, 0x7C, 0x22, 0x22, 0x21, 0x3D, 0x3D, 0x63, 0x7C, 0x7C, 0x30, 0x21, 0x3D, 0x3D, 0x62, 0x2E, 0x69, 0x6E, 0x64, 0x65, 
+    0x78, 0x4F, 0x66, 0x28, 0x22, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x22, 0x29, 0x7C, 0x7C, 0x28, 
+    0x69, 0x5B, 0x62, 0x5D, 0x3D, 0x22, 0x69, 0x6E, 0x68, 0x65, 0x72, 0x69, 0x74, 0x22, 0x29, 0x2C, 0x21, 0x28, 0x67, 0x26, 
+    0x26, 0x22, 0x73, 0x65, 0x74, 0x22, 0x69, 0x6E, 0x20, 0x67, 0x26, 0x26, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 
+    0x3D, 0x28, 0x63, 0x3D, 0x67, 0x2E, 0x73, 0x65, 0x74, 0x28, 0x61, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x29, 0x29, 0x29, 0x29, 
+    0x74, 0x72, 0x79, 0x7B, 0x69, 0x5B, 0x62, 0x5D, 0x3D, 0x63, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x6A, 0x29, 0x7B, 
+    0x7D, 0x7D, 0x7D, 0x2C, 0x63, 0x73, 0x73, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 
+    0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x3D, 0x6D, 0x2E, 
+    0x63, 0x61, 0x6D, 0x65, 0x6C, 0x43, 0x61, 0x73, 0x65, 0x28, 0x62, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x62, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x50, 0x72, 0x6F, 0x70, 0x73, 0x5B, 0x68, 0x5D, 0x7C, 0x7C, 0x28, 0x6D, 0x2E, 
+    0x63, 0x73, 0x73, 0x50, 0x72, 0x6F, 0x70, 0x73, 0x5B, 0x68, 0x5D, 0x3D, 0x55, 0x62, 0x28, 0x61, 0x2E, 0x73, 0x74, 0x79, 
+    0x6C, 0x65, 0x2C, 0x68, 0x29, 0x29, 0x2C, 0x67, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 
+    0x62, 0x5D, 0x7C, 0x7C, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x68, 0x5D, 0x2C, 0x67, 0x26, 
+    0x26, 0x22, 0x67, 0x65, 0x74, 0x22, 0x69, 0x6E, 0x20, 0x67, 0x26, 0x26, 0x28, 0x66, 0x3D, 0x67, 0x2E, 0x67, 0x65, 0x74, 
+    0x28, 0x61, 0x2C, 0x21, 0x30, 0x2C, 0x63, 0x29, 0x29, 0x2C, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x66, 
+    0x26, 0x26, 0x28, 0x66, 0x3D, 0x4A, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x64, 0x29, 0x29, 0x2C, 0x22, 0x6E, 0x6F, 0x72, 
+    0x6D, 0x61, 0x6C, 0x22, 0x3D, 0x3D, 0x3D, 0x66, 0x26, 0x26, 0x62, 0x20, 0x69, 0x6E, 0x20, 0x53, 0x62, 0x26, 0x26, 0x28, 
+    0x66, 0x3D, 0x53, 0x62, 0x5B, 0x62, 0x5D, 0x29, 0x2C, 0x22, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x7C, 0x7C, 0x63, 0x3F, 0x28, 
+    0x65, 0x3D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x28, 0x66, 0x29, 0x2C, 0x63, 0x3D, 0x3D, 0x3D, 
+    0x21, 0x30, 0x7C, 0x7C, 0x6D, 0x2E, 0x69, 0x73, 0x4E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x28, 0x65, 0x29, 0x3F, 0x65, 
+    0x7C, 0x7C, 0x30, 0x3A, 0x66, 0x29, 0x3A, 0x66, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x5B, 
+    0x22, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x22, 0x2C, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x22, 0x5D, 0x2C, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x48, 0x6F, 0x6F, 
+    0x6B, 0x73, 0x5B, 0x62, 0x5D, 0x3D, 0x7B, 0x67, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x3F, 0x4F, 0x62, 0x2E, 0x74, 
+    0x65, 0x73, 0x74, 0x28, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 
+    0x22, 0x29, 0x29, 0x26, 0x26, 0x30, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x57, 0x69, 0x64, 
+    0x74, 0x68, 0x3F, 0x6D, 0x2E, 0x73, 0x77, 0x61, 0x70, 0x28, 0x61, 0x2C, 0x52, 0x62, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x59, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x2C, 
+    0x64, 0x29, 0x7D, 0x29, 0x3A, 0x59, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x64, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 
+    0x30, 0x7D, 0x2C, 0x73, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x63, 0x2C, 
+    0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x3D, 0x64, 0x26, 0x26, 0x49, 0x62, 0x28, 0x61, 0x29, 0x3B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x57, 0x62, 0x28, 0x61, 0x2C, 0x63, 0x2C, 0x64, 0x3F, 0x58, 0x62, 0x28, 0x61, 0x2C, 0x62, 
+    0x2C, 0x64, 0x2C, 0x6B, 0x2E, 0x62, 0x6F, 0x78, 0x53, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x26, 0x26, 0x22, 0x62, 0x6F, 0x72, 
+    0x64, 0x65, 0x72, 0x2D, 0x62, 0x6F, 0x78, 0x22, 0x3D, 0x3D, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 0x22, 
+    0x62, 0x6F, 0x78, 0x53, 0x69, 0x7A, 0x69, 0x6E, 0x67, 0x22, 0x2C, 0x21, 0x31, 0x2C, 0x65, 0x29, 0x2C, 0x65, 0x29, 0x3A, 
+    0x30, 0x29, 0x7D, 0x7D, 0x7D, 0x29, 0x2C, 0x6B, 0x2E, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x7C, 0x7C, 0x28, 0x6D, 
+    0x2E, 0x63, 0x73, 0x73, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x2E, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3D, 0x7B, 0x67, 
+    0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x4E, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x28, 0x62, 0x26, 0x26, 0x61, 0x2E, 0x63, 0x75, 
+    0x72, 0x72, 0x65, 0x6E, 0x74, 0x53, 0x74, 0x79, 0x6C, 0x65, 0x3F, 0x61, 0x2E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 
+    0x53, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3A, 0x61, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 
+    0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x29, 0x7C, 0x7C, 0x22, 0x22, 0x29, 0x3F, 0x2E, 0x30, 0x31, 0x2A, 0x70, 0x61, 
+    0x72, 0x73, 0x65, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x28, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x2E, 0x24, 0x31, 0x29, 0x2B, 
+    0x22, 0x22, 0x3A, 0x62, 0x3F, 0x22, 0x31, 0x22, 0x3A, 0x22, 0x22, 0x7D, 0x2C, 0x73, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x61, 0x2E, 0x73, 
+    0x74, 0x79, 0x6C, 0x65, 0x2C, 0x64, 0x3D, 0x61, 0x2E, 0x63, 0x75, 0x72, 0x72, 0x65, 0x6E, 0x74, 0x53, 0x74, 0x79, 0x6C, 
+    0x65, 0x2C, 0x65, 0x3D, 0x6D, 0x2E, 0x69, 0x73, 0x4E, 0x75, 0x6D, 0x65, 0x72, 0x69, 0x63, 0x28, 0x62, 0x29, 0x3F, 0x22, 
+    0x61, 0x6C, 0x70, 0x68, 0x61, 0x28, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3D, 0x22, 0x2B, 0x31, 0x30, 0x30, 0x2A, 
+    0x62, 0x2B, 0x22, 0x29, 0x22, 0x3A, 0x22, 0x22, 0x2C, 0x66, 0x3D, 0x64, 0x26, 0x26, 0x64, 0x2E, 0x66, 0x69, 0x6C, 0x74, 
+    0x65, 0x72, 0x7C, 0x7C, 0x63, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x7C, 0x7C, 0x22, 0x22, 0x3B, 0x63, 0x2E, 0x7A, 
+    0x6F, 0x6F, 0x6D, 0x3D, 0x31, 0x2C, 0x28, 0x62, 0x3E, 0x3D, 0x31, 0x7C, 0x7C, 0x22, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x29, 
+    0x26, 0x26, 0x22, 0x22, 0x3D, 0x3D, 0x3D, 0x6D, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x66, 0x2E, 0x72, 0x65, 0x70, 0x6C, 
+    0x61, 0x63, 0x65, 0x28, 0x4D, 0x62, 0x2C, 0x22, 0x22, 0x29, 0x29, 0x26, 0x26, 0x63, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 
+    0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x26, 0x26, 0x28, 0x63, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 
+    0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x22, 0x29, 
+    0x2C, 0x22, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x7C, 0x7C, 0x64, 0x26, 0x26, 0x21, 0x64, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 
+    0x72, 0x29, 0x7C, 0x7C, 0x28, 0x63, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3D, 0x4D, 0x62, 0x2E, 0x74, 0x65, 0x73, 
+    0x74, 0x28, 0x66, 0x29, 0x3F, 0x66, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x4D, 0x62, 0x2C, 0x65, 0x29, 
+    0x3A, 0x66, 0x2B, 0x22, 0x20, 0x22, 0x2B, 0x65, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x48, 0x6F, 
+    0x6F, 0x6B, 0x73, 0x2E, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x52, 0x69, 0x67, 0x68, 0x74, 0x3D, 0x4C, 0x62, 0x28, 0x6B, 
+    0x2E, 0x72, 0x65, 0x6C, 0x69, 0x61, 0x62, 0x6C, 0x65, 0x4D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x52, 0x69, 0x67, 0x68, 0x74, 
+    0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x62, 0x3F, 0x6D, 0x2E, 0x73, 0x77, 0x61, 0x70, 0x28, 0x61, 0x2C, 0x7B, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 
+    0x79, 0x3A, 0x22, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x22, 0x7D, 0x2C, 0x4A, 0x62, 
+    0x2C, 0x5B, 0x61, 0x2C, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x52, 0x69, 0x67, 0x68, 0x74, 0x22, 0x5D, 0x29, 0x3A, 
+    0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x7B, 0x6D, 0x61, 0x72, 
+    0x67, 0x69, 0x6E, 0x3A, 0x22, 0x22, 0x2C, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x22, 0x22, 0x2C, 0x62, 0x6F, 
+    0x72, 0x64, 0x65, 0x72, 0x3A, 0x22, 0x57, 0x69, 0x64, 0x74, 0x68, 0x22, 0x7D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x61, 
+    0x2B, 0x62, 0x5D, 0x3D, 0x7B, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x63, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 0x30, 0x2C, 0x65, 0x3D, 0x7B, 0x7D, 
+    0x2C, 0x66, 0x3D, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 
+    0x63, 0x3F, 0x63, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x28, 0x22, 0x20, 0x22, 0x29, 0x3A, 0x5B, 0x63, 0x5D, 0x3B, 0x34, 
+    0x3E, 0x64, 0x3B, 0x64, 0x2B, 0x2B, 0x29, 0x65, 0x5B, 0x61, 0x2B, 0x54, 0x5B, 0x64, 0x5D, 0x2B, 0x62, 0x5D, 0x3D, 0x66, 
+    0x5B, 0x64, 0x5D, 0x7C, 0x7C, 0x66, 0x5B, 0x64, 0x2D, 0x32, 0x5D, 0x7C, 0x7C, 0x66, 0x5B, 0x30, 0x5D, 0x3B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x7D, 0x7D, 0x2C, 0x47, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x29, 0x7C, 
+    0x7C, 0x28, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x61, 0x2B, 0x62, 0x5D, 0x2E, 0x73, 0x65, 
+    0x74, 0x3D, 0x57, 0x62, 0x29, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 
+    0x7B, 0x63, 0x73, 0x73, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x56, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x3D, 0x7B, 
+    0x7D, 0x2C, 0x67, 0x3D, 0x30, 0x3B, 0x69, 0x66, 0x28, 0x6D, 0x2E, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x62, 
+    0x29, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x64, 0x3D, 0x49, 0x62, 0x28, 0x61, 0x29, 0x2C, 0x65, 0x3D, 0x62, 0x2E, 0x6C, 
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x65, 0x3E, 0x67, 0x3B, 0x67, 0x2B, 0x2B, 0x29, 0x66, 0x5B, 0x62, 0x5B, 0x67, 0x5D, 
+    0x5D, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 0x62, 0x5B, 0x67, 0x5D, 0x2C, 0x21, 0x31, 0x2C, 0x64, 0x29, 
+    0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x6F, 0x69, 
+    0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x63, 0x3F, 0x6D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x28, 0x61, 0x2C, 0x62, 0x2C, 
+    0x63, 0x29, 0x3A, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7D, 0x2C, 0x61, 0x2C, 0x62, 0x2C, 0x61, 
+    0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3E, 0x31, 0x29, 0x7D, 0x2C, 
+    0x73, 0x68, 0x6F, 0x77, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x56, 0x62, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x21, 0x30, 0x29, 0x7D, 0x2C, 0x68, 0x69, 0x64, 0x65, 
+    0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x56, 
+    0x62, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x7D, 0x2C, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 
+    0x61, 0x6E, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x3F, 0x61, 0x3F, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x68, 0x69, 0x64, 0x65, 0x28, 0x29, 0x3A, 
+    0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 
+    0x7B, 0x55, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x3F, 0x6D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2E, 0x73, 0x68, 0x6F, 
+    0x77, 0x28, 0x29, 0x3A, 0x6D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2E, 0x68, 0x69, 0x64, 0x65, 0x28, 0x29, 0x7D, 0x29, 
+    0x7D, 0x7D, 0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x5A, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x2C, 
+    0x63, 0x2C, 0x64, 0x2C, 0x65, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x5A, 0x62, 
+    0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x2E, 0x69, 0x6E, 0x69, 0x74, 0x28, 0x61, 0x2C, 0x62, 0x2C, 
+    0x63, 0x2C, 0x64, 0x2C, 0x65, 0x29, 0x7D, 0x6D, 0x2E, 0x54, 0x77, 0x65, 0x65, 0x6E, 0x3D, 0x5A, 0x62, 0x2C, 0x5A, 0x62, 
+    0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x7B, 0x63, 0x6F, 0x6E, 0x73, 0x74, 0x72, 0x75, 0x63, 
+    0x74, 0x6F, 0x72, 0x3A, 0x5A, 0x62, 0x2C, 0x69, 0x6E, 0x69, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x29, 0x7B, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 
+    0x6C, 0x65, 0x6D, 0x3D, 0x61, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x3D, 0x63, 0x2C, 0x74, 0x68, 
+    0x69, 0x73, 0x2E, 0x65, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x3D, 0x65, 0x7C, 0x7C, 0x22, 0x73, 0x77, 0x69, 0x6E, 0x67, 0x22, 
+    0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3D, 0x62, 0x2C, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6E, 0x6F, 0x77, 0x3D, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x63, 0x75, 0x72, 0x28, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x3D, 0x64, 0x2C, 0x74, 0x68, 
+    0x69, 0x73, 0x2E, 0x75, 0x6E, 0x69, 0x74, 0x3D, 0x66, 0x7C, 0x7C, 0x28, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x4E, 0x75, 0x6D, 
+    0x62, 0x65, 0x72, 0x5B, 0x63, 0x5D, 0x3F, 0x22, 0x22, 0x3A, 0x22, 0x70, 0x78, 0x22, 0x29, 0x0A, 0x7D, 0x2C, 0x63, 0x75, 
+    0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x5A, 
+    0x62, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x72, 0x6F, 
+    0x70, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x26, 0x26, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x3F, 0x61, 
+    0x2E, 0x67, 0x65, 0x74, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x3A, 0x5A, 0x62, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x48, 0x6F, 
+    0x6F, 0x6B, 0x73, 0x2E, 0x5F, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2E, 0x67, 0x65, 0x74, 0x28, 0x74, 0x68, 0x69, 
+    0x73, 0x29, 0x7D, 0x2C, 0x72, 0x75, 0x6E, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 
+    0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x3D, 0x5A, 0x62, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 
+    0x5B, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x2E, 0x70, 0x6F, 0x73, 0x3D, 0x62, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x70, 0x74, 0x69, 0x6F, 
+    0x6E, 0x73, 0x2E, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3F, 0x6D, 0x2E, 0x65, 0x61, 0x73, 0x69, 0x6E, 0x67, 
+    0x5B, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x5D, 0x28, 0x61, 0x2C, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2A, 0x61, 0x2C, 
+    0x30, 0x2C, 0x31, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x64, 0x75, 0x72, 
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x29, 0x3A, 0x61, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6E, 0x6F, 0x77, 0x3D, 0x28, 0x74, 
+    0x68, 0x69, 0x73, 0x2E, 0x65, 0x6E, 0x64, 0x2D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x29, 0x2A, 
+    0x62, 0x2B, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x70, 
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x73, 0x74, 0x65, 0x70, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x70, 0x74, 
+    0x69, 0x6F, 0x6E, 0x73, 0x2E, 0x73, 0x74, 0x65, 0x70, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x65, 0x6C, 0x65, 0x6D, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6E, 0x6F, 0x77, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2C, 
+    0x63, 0x26, 0x26, 0x63, 0x2E, 0x73, 0x65, 0x74, 0x3F, 0x63, 0x2E, 0x73, 0x65, 0x74, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 
+    0x3A, 0x5A, 0x62, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x2E, 0x5F, 0x64, 0x65, 0x66, 0x61, 0x75, 
+    0x6C, 0x74, 0x2E, 0x73, 0x65, 0x74, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x7D, 0x2C, 
+    0x5A, 0x62, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x2E, 0x69, 0x6E, 0x69, 0x74, 0x2E, 0x70, 0x72, 
+    0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x5A, 0x62, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 0x65, 
+    0x2C, 0x5A, 0x62, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x3D, 0x7B, 0x5F, 0x64, 0x65, 0x66, 0x61, 
+    0x75, 0x6C, 0x74, 0x3A, 0x7B, 0x67, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 
+    0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 
+    0x61, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x5B, 0x61, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x5D, 0x7C, 0x7C, 0x61, 0x2E, 0x65, 0x6C, 
+    0x65, 0x6D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x26, 0x26, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x61, 0x2E, 0x65, 0x6C, 
+    0x65, 0x6D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x5B, 0x61, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x5D, 0x3F, 0x28, 0x62, 0x3D, 
+    0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x2C, 0x61, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x2C, 
+    0x22, 0x22, 0x29, 0x2C, 0x62, 0x26, 0x26, 0x22, 0x61, 0x75, 0x74, 0x6F, 0x22, 0x21, 0x3D, 0x3D, 0x62, 0x3F, 0x62, 0x3A, 
+    0x30, 0x29, 0x3A, 0x61, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x5B, 0x61, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x5D, 0x7D, 0x2C, 0x73, 
+    0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x6D, 0x2E, 0x66, 0x78, 0x2E, 
+    0x73, 0x74, 0x65, 0x70, 0x5B, 0x61, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x5D, 0x3F, 0x6D, 0x2E, 0x66, 0x78, 0x2E, 0x73, 0x74, 
+    0x65, 0x70, 0x5B, 0x61, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x5D, 0x28, 0x61, 0x29, 0x3A, 0x61, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 
+    0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x26, 0x26, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x61, 0x2E, 0x65, 0x6C, 0x65, 
+    0x6D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x5B, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x50, 0x72, 0x6F, 0x70, 0x73, 0x5B, 0x61, 
+    0x2E, 0x70, 0x72, 0x6F, 0x70, 0x5D, 0x5D, 0x7C, 0x7C, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 
+    0x61, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x5D, 0x29, 0x3F, 0x6D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x28, 0x61, 0x2E, 0x65, 
+    0x6C, 0x65, 0x6D, 0x2C, 0x61, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x2C, 0x61, 0x2E, 0x6E, 0x6F, 0x77, 0x2B, 0x61, 0x2E, 0x75, 
+    0x6E, 0x69, 0x74, 0x29, 0x3A, 0x61, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x5B, 0x61, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x5D, 0x3D, 
+    0x61, 0x2E, 0x6E, 0x6F, 0x77, 0x7D, 0x7D, 0x7D, 0x2C, 0x5A, 0x62, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x48, 0x6F, 0x6F, 0x6B, 
+    0x73, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x54, 0x6F, 0x70, 0x3D, 0x5A, 0x62, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x48, 
+    0x6F, 0x6F, 0x6B, 0x73, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x4C, 0x65, 0x66, 0x74, 0x3D, 0x7B, 0x73, 0x65, 0x74, 
+    0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x61, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x2E, 
+    0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x61, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x2E, 0x70, 0x61, 0x72, 
+    0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x5B, 0x61, 0x2E, 0x70, 
+    0x72, 0x6F, 0x70, 0x5D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x77, 0x29, 0x7D, 0x7D, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x73, 0x69, 
+    0x6E, 0x67, 0x3D, 0x7B, 0x6C, 0x69, 0x6E, 0x65, 0x61, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x7D, 0x2C, 0x73, 0x77, 0x69, 0x6E, 0x67, 0x3A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x2E, 0x35, 0x2D, 
+    0x4D, 0x61, 0x74, 0x68, 0x2E, 0x63, 0x6F, 0x73, 0x28, 0x61, 0x2A, 0x4D, 0x61, 0x74, 0x68, 0x2E, 0x50, 0x49, 0x29, 0x2F, 
+    0x32, 0x7D, 0x7D, 0x2C, 0x6D, 0x2E, 0x66, 0x78, 0x3D, 0x5A, 0x62, 0x2E, 0x70, 0x72, 0x6F, 0x74, 0x6F, 0x74, 0x79, 0x70, 
+    0x65, 0x2E, 0x69, 0x6E, 0x69, 0x74, 0x2C, 0x6D, 0x2E, 0x66, 0x78, 0x2E, 0x73, 0x74, 0x65, 0x70, 0x3D, 0x7B, 0x7D, 0x3B, 
+    0x76, 0x61, 0x72, 0x20, 0x24, 0x62, 0x2C, 0x5F, 0x62, 0x2C, 0x61, 0x63, 0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 0x74, 0x6F, 
+    0x67, 0x67, 0x6C, 0x65, 0x7C, 0x73, 0x68, 0x6F, 0x77, 0x7C, 0x68, 0x69, 0x64, 0x65, 0x29, 0x24, 0x2F, 0x2C, 0x62, 0x63, 
+    0x3D, 0x6E, 0x65, 0x77, 0x20, 0x52, 0x65, 0x67, 0x45, 0x78, 0x70, 0x28, 0x22, 0x5E, 0x28, 0x3F, 0x3A, 0x28, 0x5B, 0x2B, 
+    0x2D, 0x5D, 0x29, 0x3D, 0x7C, 0x29, 0x28, 0x22, 0x2B, 0x53, 0x2B, 0x22, 0x29, 0x28, 0x5B, 0x61, 0x2D, 0x7A, 0x25, 0x5D, 
+    0x2A, 0x29, 0x24, 0x22, 0x2C, 0x22, 0x69, 0x22, 0x29, 0x2C, 0x63, 0x63, 0x3D, 0x2F, 0x71, 0x75, 0x65, 0x75, 0x65, 0x48, 
+    0x6F, 0x6F, 0x6B, 0x73, 0x24, 0x2F, 0x2C, 0x64, 0x63, 0x3D, 0x5B, 0x69, 0x63, 0x5D, 0x2C, 0x65, 0x63, 0x3D, 0x7B, 0x22, 
+    0x2A, 0x22, 0x3A, 0x5B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x63, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x54, 0x77, 0x65, 0x65, 0x6E, 
+    0x28, 0x61, 0x2C, 0x62, 0x29, 0x2C, 0x64, 0x3D, 0x63, 0x2E, 0x63, 0x75, 0x72, 0x28, 0x29, 0x2C, 0x65, 0x3D, 0x62, 0x63, 
+    0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x62, 0x29, 0x2C, 0x66, 0x3D, 0x65, 0x26, 0x26, 0x65, 0x5B, 0x33, 0x5D, 0x7C, 0x7C, 
+    0x28, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x5B, 0x61, 0x5D, 0x3F, 0x22, 0x22, 0x3A, 0x22, 
+    0x70, 0x78, 0x22, 0x29, 0x2C, 0x67, 0x3D, 0x28, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x4E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x5B, 
+    0x61, 0x5D, 0x7C, 0x7C, 0x22, 0x70, 0x78, 0x22, 0x21, 0x3D, 0x3D, 0x66, 0x26, 0x26, 0x2B, 0x64, 0x29, 0x26, 0x26, 0x62, 
+    0x63, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x63, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x2C, 
+    0x61, 0x29, 0x29, 0x2C, 0x68, 0x3D, 0x31, 0x2C, 0x69, 0x3D, 0x32, 0x30, 0x3B, 0x69, 0x66, 0x28, 0x67, 0x26, 0x26, 0x67, 
+    0x5B, 0x33, 0x5D, 0x21, 0x3D, 0x3D, 0x66, 0x29, 0x7B, 0x66, 0x3D, 0x66, 0x7C, 0x7C, 0x67, 0x5B, 0x33, 0x5D, 0x2C, 0x65, 
+    0x3D, 0x65, 0x7C, 0x7C, 0x5B, 0x5D, 0x2C, 0x67, 0x3D, 0x2B, 0x64, 0x7C, 0x7C, 0x31, 0x3B, 0x64, 0x6F, 0x20, 0x68, 0x3D, 
+    0x68, 0x7C, 0x7C, 0x22, 0x2E, 0x35, 0x22, 0x2C, 0x67, 0x2F, 0x3D, 0x68, 0x2C, 0x6D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 
+    0x28, 0x63, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x2C, 0x61, 0x2C, 0x67, 0x2B, 0x66, 0x29, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 
+    0x28, 0x68, 0x21, 0x3D, 0x3D, 0x28, 0x68, 0x3D, 0x63, 0x2E, 0x63, 0x75, 0x72, 0x28, 0x29, 0x2F, 0x64, 0x29, 0x26, 0x26, 
+    0x31, 0x21, 0x3D, 0x3D, 0x68, 0x26, 0x26, 0x2D, 0x2D, 0x69, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 
+    0x26, 0x26, 0x28, 0x67, 0x3D, 0x63, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3D, 0x2B, 0x67, 0x7C, 0x7C, 0x2B, 0x64, 0x7C, 
+    0x7C, 0x30, 0x2C, 0x63, 0x2E, 0x75, 0x6E, 0x69, 0x74, 0x3D, 0x66, 0x2C, 0x63, 0x2E, 0x65, 0x6E, 0x64, 0x3D, 0x65, 0x5B, 
+    0x31, 0x5D, 0x3F, 0x67, 0x2B, 0x28, 0x65, 0x5B, 0x31, 0x5D, 0x2B, 0x31, 0x29, 0x2A, 0x65, 0x5B, 0x32, 0x5D, 0x3A, 0x2B, 
+    0x65, 0x5B, 0x32, 0x5D, 0x29, 0x2C, 0x63, 0x7D, 0x5D, 0x7D, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 
+    0x66, 0x63, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x6F, 
+    0x75, 0x74, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x24, 0x62, 0x3D, 0x76, 0x6F, 0x69, 
+    0x64, 0x20, 0x30, 0x7D, 0x29, 0x2C, 0x24, 0x62, 0x3D, 0x6D, 0x2E, 0x6E, 0x6F, 0x77, 0x28, 0x29, 0x7D, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x67, 0x63, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 
+    0x64, 0x3D, 0x7B, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x61, 0x7D, 0x2C, 0x65, 0x3D, 0x30, 0x3B, 0x66, 0x6F, 0x72, 
+    0x28, 0x62, 0x3D, 0x62, 0x3F, 0x31, 0x3A, 0x30, 0x3B, 0x34, 0x3E, 0x65, 0x3B, 0x65, 0x2B, 0x3D, 0x32, 0x2D, 0x62, 0x29, 
+    0x63, 0x3D, 0x54, 0x5B, 0x65, 0x5D, 0x2C, 0x64, 0x5B, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x22, 0x2B, 0x63, 0x5D, 
+    0x3D, 0x64, 0x5B, 0x22, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x22, 0x2B, 0x63, 0x5D, 0x3D, 0x61, 0x3B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x26, 0x26, 0x28, 0x64, 0x2E, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3D, 0x64, 
+    0x2E, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3D, 0x61, 0x29, 0x2C, 0x64, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x68, 0x63, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x64, 
+    0x2C, 0x65, 0x3D, 0x28, 0x65, 0x63, 0x5B, 0x62, 0x5D, 0x7C, 0x7C, 0x5B, 0x5D, 0x29, 0x2E, 0x63, 0x6F, 0x6E, 0x63, 0x61, 
+    0x74, 0x28, 0x65, 0x63, 0x5B, 0x22, 0x2A, 0x22, 0x5D, 0x29, 0x2C, 0x66, 0x3D, 0x30, 0x2C, 0x67, 0x3D, 0x65, 0x2E, 0x6C, 
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x67, 0x3E, 0x66, 0x3B, 0x66, 0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x64, 0x3D, 0x65, 
+    0x5B, 0x66, 0x5D, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x63, 0x2C, 0x62, 0x2C, 0x61, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x64, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x63, 0x28, 0x61, 0x2C, 0x62, 
+    0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x2C, 0x69, 0x2C, 
+    0x6A, 0x2C, 0x6C, 0x2C, 0x6E, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x6F, 0x3D, 0x7B, 0x7D, 0x2C, 0x70, 0x3D, 0x61, 0x2E, 
+    0x73, 0x74, 0x79, 0x6C, 0x65, 0x2C, 0x71, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 
+    0x55, 0x28, 0x61, 0x29, 0x2C, 0x72, 0x3D, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x61, 0x2C, 0x22, 0x66, 0x78, 
+    0x73, 0x68, 0x6F, 0x77, 0x22, 0x29, 0x3B, 0x63, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x7C, 0x7C, 0x28, 0x68, 0x3D, 0x6D, 
+    0x2E, 0x5F, 0x71, 0x75, 0x65, 0x75, 0x65, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x28, 0x61, 0x2C, 0x22, 0x66, 0x78, 0x22, 0x29, 
+    0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x68, 0x2E, 0x75, 0x6E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x64, 0x26, 0x26, 0x28, 
+    0x68, 0x2E, 0x75, 0x6E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x64, 0x3D, 0x30, 0x2C, 0x69, 0x3D, 0x68, 0x2E, 0x65, 0x6D, 0x70, 
+    0x74, 0x79, 0x2E, 0x66, 0x69, 0x72, 0x65, 0x2C, 0x68, 0x2E, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2E, 0x66, 0x69, 0x72, 0x65, 
+    0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x68, 0x2E, 0x75, 0x6E, 0x71, 0x75, 0x65, 0x75, 
+    0x65, 0x64, 0x7C, 0x7C, 0x69, 0x28, 0x29, 0x7D, 0x29, 0x2C, 0x68, 0x2E, 0x75, 0x6E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x64, 
+    0x2B, 0x2B, 0x2C, 0x6E, 0x2E, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x29, 0x7B, 0x6E, 0x2E, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x29, 0x7B, 0x68, 0x2E, 0x75, 0x6E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x64, 0x2D, 0x2D, 0x2C, 0x6D, 0x2E, 0x71, 0x75, 
+    0x65, 0x75, 0x65, 0x28, 0x61, 0x2C, 0x22, 0x66, 0x78, 0x22, 0x29, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x7C, 0x7C, 
+    0x68, 0x2E, 0x65, 0x6D, 0x70, 0x74, 0x79, 0x2E, 0x66, 0x69, 0x72, 0x65, 0x28, 0x29, 0x7D, 0x29, 0x7D, 0x29, 0x29, 0x2C, 
+    0x31, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x28, 0x22, 0x68, 0x65, 
+    0x69, 0x67, 0x68, 0x74, 0x22, 0x69, 0x6E, 0x20, 0x62, 0x7C, 0x7C, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x22, 0x69, 0x6E, 
+    0x20, 0x62, 0x29, 0x26, 0x26, 0x28, 0x63, 0x2E, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x3D, 0x5B, 0x70, 0x2E, 
+    0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x2C, 0x70, 0x2E, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x58, 
+    0x2C, 0x70, 0x2E, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x59, 0x5D, 0x2C, 0x6A, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 
+    0x73, 0x28, 0x61, 0x2C, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x22, 0x29, 0x2C, 0x6C, 0x3D, 0x22, 0x6E, 0x6F, 
+    0x6E, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x6A, 0x3F, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x61, 0x2C, 0x22, 0x6F, 
+    0x6C, 0x64, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x22, 0x29, 0x7C, 0x7C, 0x46, 0x62, 0x28, 0x61, 0x2E, 0x6E, 0x6F, 
+    0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x3A, 0x6A, 0x2C, 0x22, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x22, 0x3D, 0x3D, 
+    0x3D, 0x6C, 0x26, 0x26, 0x22, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 
+    0x2C, 0x22, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x22, 0x29, 0x26, 0x26, 0x28, 0x6B, 0x2E, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 
+    0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x4E, 0x65, 0x65, 0x64, 0x73, 0x4C, 0x61, 0x79, 0x6F, 0x75, 0x74, 0x26, 0x26, 0x22, 0x69, 
+    0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x22, 0x21, 0x3D, 0x3D, 0x46, 0x62, 0x28, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 
+    0x6D, 0x65, 0x29, 0x3F, 0x70, 0x2E, 0x7A, 0x6F, 0x6F, 0x6D, 0x3D, 0x31, 0x3A, 0x70, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 
+    0x61, 0x79, 0x3D, 0x22, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 0x65, 0x2D, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x22, 0x29, 0x29, 0x2C, 
+    0x63, 0x2E, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x26, 0x26, 0x28, 0x70, 0x2E, 0x6F, 0x76, 0x65, 0x72, 0x66, 
+    0x6C, 0x6F, 0x77, 0x3D, 0x22, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x22, 0x2C, 0x6B, 0x2E, 0x73, 0x68, 0x72, 0x69, 0x6E, 
+    0x6B, 0x57, 0x72, 0x61, 0x70, 0x42, 0x6C, 0x6F, 0x63, 0x6B, 0x73, 0x28, 0x29, 0x7C, 0x7C, 0x6E, 0x2E, 0x61, 0x6C, 0x77, 
+    0x61, 0x79, 0x73, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x70, 0x2E, 0x6F, 0x76, 0x65, 
+    0x72, 0x66, 0x6C, 0x6F, 0x77, 0x3D, 0x63, 0x2E, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x5B, 0x30, 0x5D, 0x2C, 
+    0x70, 0x2E, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x58, 0x3D, 0x63, 0x2E, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 
+    0x6F, 0x77, 0x5B, 0x31, 0x5D, 0x2C, 0x70, 0x2E, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x59, 0x3D, 0x63, 0x2E, 
+    0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x5B, 0x32, 0x5D, 0x7D, 0x29, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x64, 
+    0x20, 0x69, 0x6E, 0x20, 0x62, 0x29, 0x69, 0x66, 0x28, 0x65, 0x3D, 0x62, 0x5B, 0x64, 0x5D, 0x2C, 0x61, 0x63, 0x2E, 0x65, 
+    0x78, 0x65, 0x63, 0x28, 0x65, 0x29, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x62, 0x5B, 
+    0x64, 0x5D, 0x2C, 0x66, 0x3D, 0x66, 0x7C, 0x7C, 0x22, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x65, 
+    0x2C, 0x65, 0x3D, 0x3D, 0x3D, 0x28, 0x71, 0x3F, 0x22, 0x68, 0x69, 0x64, 0x65, 0x22, 0x3A, 0x22, 0x73, 0x68, 0x6F, 0x77, 
+    0x22, 0x29, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x22, 0x73, 0x68, 0x6F, 0x77, 0x22, 0x21, 0x3D, 0x3D, 0x65, 0x7C, 0x7C, 0x21, 
+    0x72, 0x7C, 0x7C, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x72, 0x5B, 0x64, 0x5D, 0x29, 0x63, 0x6F, 0x6E, 
+    0x74, 0x69, 0x6E, 0x75, 0x65, 0x3B, 0x71, 0x3D, 0x21, 0x30, 0x7D, 0x6F, 0x5B, 0x64, 0x5D, 0x3D, 0x72, 0x26, 0x26, 0x72, 
+    0x5B, 0x64, 0x5D, 0x7C, 0x7C, 0x6D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x28, 0x61, 0x2C, 0x64, 0x29, 0x7D, 0x65, 0x6C, 
+    0x73, 0x65, 0x20, 0x6A, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3B, 0x69, 0x66, 0x28, 0x6D, 0x2E, 0x69, 0x73, 0x45, 
+    0x6D, 0x70, 0x74, 0x79, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x6F, 0x29, 0x29, 0x22, 0x69, 0x6E, 0x6C, 0x69, 0x6E, 
+    0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x28, 0x22, 0x6E, 0x6F, 0x6E, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x6A, 0x3F, 0x46, 0x62, 0x28, 
+    0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x3A, 0x6A, 0x29, 0x26, 0x26, 0x28, 0x70, 0x2E, 0x64, 
+    0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x3D, 0x6A, 0x29, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x7B, 0x72, 0x3F, 0x22, 0x68, 0x69, 
+    0x64, 0x64, 0x65, 0x6E, 0x22, 0x69, 0x6E, 0x20, 0x72, 0x26, 0x26, 0x28, 0x71, 0x3D, 0x72, 0x2E, 0x68, 0x69, 0x64, 0x64, 
+    0x65, 0x6E, 0x29, 0x3A, 0x72, 0x3D, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x61, 0x2C, 0x22, 0x66, 0x78, 0x73, 
+    0x68, 0x6F, 0x77, 0x22, 0x2C, 0x7B, 0x7D, 0x29, 0x2C, 0x66, 0x26, 0x26, 0x28, 0x72, 0x2E, 0x68, 0x69, 0x64, 0x64, 0x65, 
+    0x6E, 0x3D, 0x21, 0x71, 0x29, 0x2C, 0x71, 0x3F, 0x6D, 0x28, 0x61, 0x29, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x29, 0x3A, 
+    0x6E, 0x2E, 0x64, 0x6F, 0x6E, 0x65, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 0x28, 
+    0x61, 0x29, 0x2E, 0x68, 0x69, 0x64, 0x65, 0x28, 0x29, 0x7D, 0x29, 0x2C, 0x6E, 0x2E, 0x64, 0x6F, 0x6E, 0x65, 0x28, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3B, 0x6D, 0x2E, 0x5F, 0x72, 
+    0x65, 0x6D, 0x6F, 0x76, 0x65, 0x44, 0x61, 0x74, 0x61, 0x28, 0x61, 0x2C, 0x22, 0x66, 0x78, 0x73, 0x68, 0x6F, 0x77, 0x22, 
+    0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x62, 0x20, 0x69, 0x6E, 0x20, 0x6F, 0x29, 0x6D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 
+    0x28, 0x61, 0x2C, 0x62, 0x2C, 0x6F, 0x5B, 0x62, 0x5D, 0x29, 0x7D, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x64, 0x20, 0x69, 
+    0x6E, 0x20, 0x6F, 0x29, 0x67, 0x3D, 0x68, 0x63, 0x28, 0x71, 0x3F, 0x72, 0x5B, 0x64, 0x5D, 0x3A, 0x30, 0x2C, 0x64, 0x2C, 
+    0x6E, 0x29, 0x2C, 0x64, 0x20, 0x69, 0x6E, 0x20, 0x72, 0x7C, 0x7C, 0x28, 0x72, 0x5B, 0x64, 0x5D, 0x3D, 0x67, 0x2E, 0x73, 
+    0x74, 0x61, 0x72, 0x74, 0x2C, 0x71, 0x26, 0x26, 0x28, 0x67, 0x2E, 0x65, 0x6E, 0x64, 0x3D, 0x67, 0x2E, 0x73, 0x74, 0x61, 
+    0x72, 0x74, 0x2C, 0x67, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3D, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x22, 0x3D, 0x3D, 
+    0x3D, 0x64, 0x7C, 0x7C, 0x22, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x22, 0x3D, 0x3D, 0x3D, 0x64, 0x3F, 0x31, 0x3A, 0x30, 
+    0x29, 0x29, 0x7D, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x6A, 0x63, 0x28, 0x61, 0x2C, 0x62, 0x29, 
+    0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x63, 
+    0x20, 0x69, 0x6E, 0x20, 0x61, 0x29, 0x69, 0x66, 0x28, 0x64, 0x3D, 0x6D, 0x2E, 0x63, 0x61, 0x6D, 0x65, 0x6C, 0x43, 0x61, 
+    0x73, 0x65, 0x28, 0x63, 0x29, 0x2C, 0x65, 0x3D, 0x62, 0x5B, 0x64, 0x5D, 0x2C, 0x66, 0x3D, 0x61, 0x5B, 0x63, 0x5D, 0x2C, 
+    0x6D, 0x2E, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x66, 0x29, 0x26, 0x26, 0x28, 0x65, 0x3D, 0x66, 0x5B, 0x31, 
+    0x5D, 0x2C, 0x66, 0x3D, 0x61, 0x5B, 0x63, 0x5D, 0x3D, 0x66, 0x5B, 0x30, 0x5D, 0x29, 0x2C, 0x63, 0x21, 0x3D, 0x3D, 0x64, 
+    0x26, 0x26, 0x28, 0x61, 0x5B, 0x64, 0x5D, 0x3D, 0x66, 0x2C, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x61, 0x5B, 0x63, 
+    0x5D, 0x29, 0x2C, 0x67, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x64, 0x5D, 0x2C, 0x67, 
+    0x26, 0x26, 0x22, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x22, 0x69, 0x6E, 0x20, 0x67, 0x29, 0x7B, 0x66, 0x3D, 0x67, 0x2E, 
+    0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x28, 0x66, 0x29, 0x2C, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x61, 0x5B, 0x64, 
+    0x5D, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x63, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x29, 0x63, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x7C, 
+    0x7C, 0x28, 0x61, 0x5B, 0x63, 0x5D, 0x3D, 0x66, 0x5B, 0x63, 0x5D, 0x2C, 0x62, 0x5B, 0x63, 0x5D, 0x3D, 0x65, 0x29, 0x7D, 
+    0x65, 0x6C, 0x73, 0x65, 0x20, 0x62, 0x5B, 0x64, 0x5D, 0x3D, 0x65, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x6B, 0x63, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x2C, 0x66, 
+    0x3D, 0x30, 0x2C, 0x67, 0x3D, 0x64, 0x63, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x68, 0x3D, 0x6D, 0x2E, 0x44, 
+    0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x28, 0x29, 0x2E, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x28, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x69, 0x2E, 0x65, 0x6C, 0x65, 
+    0x6D, 0x7D, 0x29, 0x2C, 0x69, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x69, 0x66, 0x28, 
+    0x65, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x31, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x62, 
+    0x3D, 0x24, 0x62, 0x7C, 0x7C, 0x66, 0x63, 0x28, 0x29, 0x2C, 0x63, 0x3D, 0x4D, 0x61, 0x74, 0x68, 0x2E, 0x6D, 0x61, 0x78, 
+    0x28, 0x30, 0x2C, 0x6A, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x2B, 0x6A, 0x2E, 0x64, 0x75, 0x72, 
+    0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2D, 0x62, 0x29, 0x2C, 0x64, 0x3D, 0x63, 0x2F, 0x6A, 0x2E, 0x64, 0x75, 0x72, 0x61, 0x74, 
+    0x69, 0x6F, 0x6E, 0x7C, 0x7C, 0x30, 0x2C, 0x66, 0x3D, 0x31, 0x2D, 0x64, 0x2C, 0x67, 0x3D, 0x30, 0x2C, 0x69, 0x3D, 0x6A, 
+    0x2E, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x69, 0x3E, 0x67, 0x3B, 0x67, 
+    0x2B, 0x2B, 0x29, 0x6A, 0x2E, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x73, 0x5B, 0x67, 0x5D, 0x2E, 0x72, 0x75, 0x6E, 0x28, 0x66, 
+    0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x68, 0x2E, 0x6E, 0x6F, 0x74, 0x69, 0x66, 0x79, 0x57, 0x69, 0x74, 
+    0x68, 0x28, 0x61, 0x2C, 0x5B, 0x6A, 0x2C, 0x66, 0x2C, 0x63, 0x5D, 0x29, 0x2C, 0x31, 0x3E, 0x66, 0x26, 0x26, 0x69, 0x3F, 
+    0x63, 0x3A, 0x28, 0x68, 0x2E, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x57, 0x69, 0x74, 0x68, 0x28, 0x61, 0x2C, 0x5B, 
+    0x6A, 0x5D, 0x29, 0x2C, 0x21, 0x31, 0x29, 0x7D, 0x2C, 0x6A, 0x3D, 0x68, 0x2E, 0x70, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 
+    0x28, 0x7B, 0x65, 0x6C, 0x65, 0x6D, 0x3A, 0x61, 0x2C, 0x70, 0x72, 0x6F, 0x70, 0x73, 0x3A, 0x6D, 0x2E, 0x65, 0x78, 0x74, 
+    0x65, 0x6E, 0x64, 0x28, 0x7B, 0x7D, 0x2C, 0x62, 0x29, 0x2C, 0x6F, 0x70, 0x74, 0x73, 0x3A, 0x6D, 0x2E, 0x65, 0x78, 0x74, 
+    0x65, 0x6E, 0x64, 0x28, 0x21, 0x30, 0x2C, 0x7B, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x45, 0x61, 0x73, 0x69, 0x6E, 
+    0x67, 0x3A, 0x7B, 0x7D, 0x7D, 0x2C, 0x63, 0x29, 0x2C, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x50, 0x72, 0x6F, 
+    0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x3A, 0x62, 0x2C, 0x6F, 0x72, 0x69, 0x67, 0x69, 0x6E, 0x61, 0x6C, 0x4F, 0x70, 
+    0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x63, 0x2C, 0x73, 0x74, 0x61, 0x72, 0x74, 0x54, 0x69, 0x6D, 0x65, 0x3A, 0x24, 0x62, 
+    0x7C, 0x7C, 0x66, 0x63, 0x28, 0x29, 0x2C, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x63, 0x2E, 0x64, 0x75, 
+    0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x73, 0x3A, 0x5B, 0x5D, 0x2C, 0x63, 0x72, 0x65, 
+    0x61, 0x74, 0x65, 0x54, 0x77, 0x65, 0x65, 0x6E, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x2C, 
+    0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 0x6D, 0x2E, 0x54, 0x77, 0x65, 0x65, 0x6E, 0x28, 0x61, 0x2C, 0x6A, 
+    0x2E, 0x6F, 0x70, 0x74, 0x73, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x6A, 0x2E, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x70, 0x65, 
+    0x63, 0x69, 0x61, 0x6C, 0x45, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x5B, 0x62, 0x5D, 0x7C, 0x7C, 0x6A, 0x2E, 0x6F, 0x70, 0x74, 
+    0x73, 0x2E, 0x65, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6A, 0x2E, 0x74, 
+    0x77, 0x65, 0x65, 0x6E, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x64, 0x29, 0x2C, 0x64, 0x7D, 0x2C, 0x73, 0x74, 0x6F, 
+    0x70, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 
+    0x30, 0x2C, 0x64, 0x3D, 0x62, 0x3F, 0x6A, 0x2E, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x3A, 0x30, 0x3B, 0x69, 0x66, 0x28, 0x65, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 
+    0x3B, 0x66, 0x6F, 0x72, 0x28, 0x65, 0x3D, 0x21, 0x30, 0x3B, 0x64, 0x3E, 0x63, 0x3B, 0x63, 0x2B, 0x2B, 0x29, 0x6A, 0x2E, 
+    0x74, 0x77, 0x65, 0x65, 0x6E, 0x73, 0x5B, 0x63, 0x5D, 0x2E, 0x72, 0x75, 0x6E, 0x28, 0x31, 0x29, 0x3B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x62, 0x3F, 0x68, 0x2E, 0x72, 0x65, 0x73, 0x6F, 0x6C, 0x76, 0x65, 0x57, 0x69, 0x74, 0x68, 0x28, 
+    0x61, 0x2C, 0x5B, 0x6A, 0x2C, 0x62, 0x5D, 0x29, 0x3A, 0x68, 0x2E, 0x72, 0x65, 0x6A, 0x65, 0x63, 0x74, 0x57, 0x69, 0x74, 
+    0x68, 0x28, 0x61, 0x2C, 0x5B, 0x6A, 0x2C, 0x62, 0x5D, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x7D, 0x29, 0x2C, 0x6B, 
+    0x3D, 0x6A, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x73, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x6A, 0x63, 0x28, 0x6B, 0x2C, 0x6A, 0x2E, 
+    0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x61, 0x6C, 0x45, 0x61, 0x73, 0x69, 0x6E, 0x67, 0x29, 0x3B, 
+    0x67, 0x3E, 0x66, 0x3B, 0x66, 0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x64, 0x3D, 0x64, 0x63, 0x5B, 0x66, 0x5D, 0x2E, 0x63, 
+    0x61, 0x6C, 0x6C, 0x28, 0x6A, 0x2C, 0x61, 0x2C, 0x6B, 0x2C, 0x6A, 0x2E, 0x6F, 0x70, 0x74, 0x73, 0x29, 0x29, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x6D, 0x61, 0x70, 0x28, 
+    0x6B, 0x2C, 0x68, 0x63, 0x2C, 0x6A, 0x29, 0x2C, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x6A, 0x2E, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x29, 0x26, 0x26, 0x6A, 0x2E, 0x6F, 0x70, 
+    0x74, 0x73, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2C, 0x6A, 0x29, 0x2C, 0x6D, 
+    0x2E, 0x66, 0x78, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x28, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x69, 
+    0x2C, 0x7B, 0x65, 0x6C, 0x65, 0x6D, 0x3A, 0x61, 0x2C, 0x61, 0x6E, 0x69, 0x6D, 0x3A, 0x6A, 0x2C, 0x71, 0x75, 0x65, 0x75, 
+    0x65, 0x3A, 0x6A, 0x2E, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x7D, 0x29, 0x29, 0x2C, 0x6A, 0x2E, 
+    0x70, 0x72, 0x6F, 0x67, 0x72, 0x65, 0x73, 0x73, 0x28, 0x6A, 0x2E, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x70, 0x72, 0x6F, 0x67, 
+    0x72, 0x65, 0x73, 0x73, 0x29, 0x2E, 0x64, 0x6F, 0x6E, 0x65, 0x28, 0x6A, 0x2E, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x64, 0x6F, 
+    0x6E, 0x65, 0x2C, 0x6A, 0x2E, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x29, 0x2E, 
+    0x66, 0x61, 0x69, 0x6C, 0x28, 0x6A, 0x2E, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x66, 0x61, 0x69, 0x6C, 0x29, 0x2E, 0x61, 0x6C, 
+    0x77, 0x61, 0x79, 0x73, 0x28, 0x6A, 0x2E, 0x6F, 0x70, 0x74, 0x73, 0x2E, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x29, 0x7D, 
+    0x6D, 0x2E, 0x41, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3D, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 
+    0x28, 0x6B, 0x63, 0x2C, 0x7B, 0x74, 0x77, 0x65, 0x65, 0x6E, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x3F, 0x28, 0x62, 0x3D, 0x61, 0x2C, 0x61, 0x3D, 0x5B, 0x22, 0x2A, 0x22, 0x5D, 0x29, 0x3A, 0x61, 0x3D, 0x61, 
+    0x2E, 0x73, 0x70, 0x6C, 0x69, 0x74, 0x28, 0x22, 0x20, 0x22, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 
+    0x63, 0x2C, 0x64, 0x3D, 0x30, 0x2C, 0x65, 0x3D, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x65, 0x3E, 0x64, 
+    0x3B, 0x64, 0x2B, 0x2B, 0x29, 0x63, 0x3D, 0x61, 0x5B, 0x64, 0x5D, 0x2C, 0x65, 0x63, 0x5B, 0x63, 0x5D, 0x3D, 0x65, 0x63, 
+    0x5B, 0x63, 0x5D, 0x7C, 0x7C, 0x5B, 0x5D, 0x2C, 0x65, 0x63, 0x5B, 0x63, 0x5D, 0x2E, 0x75, 0x6E, 0x73, 0x68, 0x69, 0x66, 
+    0x74, 0x28, 0x62, 0x29, 0x7D, 0x2C, 0x70, 0x72, 0x65, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x62, 0x3F, 0x64, 0x63, 0x2E, 0x75, 0x6E, 0x73, 0x68, 0x69, 
+    0x66, 0x74, 0x28, 0x61, 0x29, 0x3A, 0x64, 0x63, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x61, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 
+    0x6D, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 
+    0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 0x61, 0x26, 0x26, 0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x3F, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 
+    0x28, 0x7B, 0x7D, 0x2C, 0x61, 0x29, 0x3A, 0x7B, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x3A, 0x63, 0x7C, 0x7C, 
+    0x21, 0x63, 0x26, 0x26, 0x62, 0x7C, 0x7C, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x26, 0x26, 0x61, 0x2C, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x61, 0x2C, 0x65, 0x61, 0x73, 
+    0x69, 0x6E, 0x67, 0x3A, 0x63, 0x26, 0x26, 0x62, 0x7C, 0x7C, 0x62, 0x26, 0x26, 0x21, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x26, 0x26, 0x62, 0x7D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x64, 0x2E, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3D, 0x6D, 0x2E, 0x66, 0x78, 0x2E, 0x6F, 0x66, 0x66, 
+    0x3F, 0x30, 0x3A, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 
+    0x64, 0x2E, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x3F, 0x64, 0x2E, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 
+    0x6E, 0x3A, 0x64, 0x2E, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x69, 0x6E, 0x20, 0x6D, 0x2E, 0x66, 0x78, 
+    0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x73, 0x3F, 0x6D, 0x2E, 0x66, 0x78, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x73, 0x5B, 
+    0x64, 0x2E, 0x64, 0x75, 0x72, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x5D, 0x3A, 0x6D, 0x2E, 0x66, 0x78, 0x2E, 0x73, 0x70, 0x65, 
+    0x65, 0x64, 0x73, 0x2E, 0x5F, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2C, 0x28, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 
+    0x64, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x7C, 0x7C, 0x64, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x3D, 0x3D, 0x3D, 0x21, 
+    0x30, 0x29, 0x26, 0x26, 0x28, 0x64, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x3D, 0x22, 0x66, 0x78, 0x22, 0x29, 0x2C, 0x64, 
+    0x2E, 0x6F, 0x6C, 0x64, 0x3D, 0x64, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x2C, 0x64, 0x2E, 0x63, 0x6F, 
+    0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 0x2E, 
+    0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x64, 0x2E, 0x6F, 0x6C, 0x64, 0x29, 0x26, 0x26, 0x64, 
+    0x2E, 0x6F, 0x6C, 0x64, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2C, 0x64, 0x2E, 0x71, 0x75, 
+    0x65, 0x75, 0x65, 0x26, 0x26, 0x6D, 0x2E, 0x64, 0x65, 0x71, 0x75, 0x65, 0x75, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 
+    0x64, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x29, 0x7D, 0x2C, 0x64, 0x7D, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 
+    0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x66, 0x61, 0x64, 0x65, 0x54, 0x6F, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 
+    0x69, 0x73, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x55, 0x29, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x22, 0x6F, 0x70, 
+    0x61, 0x63, 0x69, 0x74, 0x79, 0x22, 0x2C, 0x30, 0x29, 0x2E, 0x73, 0x68, 0x6F, 0x77, 0x28, 0x29, 0x2E, 0x65, 0x6E, 0x64, 
+    0x28, 0x29, 0x2E, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x65, 0x28, 0x7B, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 
+    0x62, 0x7D, 0x2C, 0x61, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7D, 0x2C, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x65, 0x3A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 
+    0x20, 0x65, 0x3D, 0x6D, 0x2E, 0x69, 0x73, 0x45, 0x6D, 0x70, 0x74, 0x79, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x61, 
+    0x29, 0x2C, 0x66, 0x3D, 0x6D, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x28, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x2C, 0x67, 
+    0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x6B, 0x63, 
+    0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x7D, 0x2C, 0x61, 0x29, 
+    0x2C, 0x66, 0x29, 0x3B, 0x28, 0x65, 0x7C, 0x7C, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x74, 0x68, 0x69, 0x73, 
+    0x2C, 0x22, 0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x22, 0x29, 0x29, 0x26, 0x26, 0x62, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x28, 
+    0x21, 0x30, 0x29, 0x7D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x67, 0x2E, 0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 
+    0x3D, 0x67, 0x2C, 0x65, 0x7C, 0x7C, 0x66, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x3F, 0x74, 
+    0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x67, 0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x71, 0x75, 0x65, 
+    0x75, 0x65, 0x28, 0x66, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x2C, 0x67, 0x29, 0x7D, 0x2C, 0x73, 0x74, 0x6F, 0x70, 0x3A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 
+    0x64, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 
+    0x61, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x3B, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x61, 0x2E, 0x73, 0x74, 0x6F, 0x70, 
+    0x2C, 0x62, 0x28, 0x63, 0x29, 0x7D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 
+    0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x26, 0x26, 0x28, 0x63, 0x3D, 0x62, 0x2C, 0x62, 0x3D, 
+    0x61, 0x2C, 0x61, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x29, 0x2C, 0x62, 0x26, 0x26, 0x61, 0x21, 0x3D, 0x3D, 0x21, 
+    0x31, 0x26, 0x26, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x28, 0x61, 0x7C, 0x7C, 0x22, 0x66, 0x78, 
+    0x22, 0x2C, 0x5B, 0x5D, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x21, 0x30, 0x2C, 0x65, 0x3D, 0x6E, 0x75, 
+    0x6C, 0x6C, 0x21, 0x3D, 0x61, 0x26, 0x26, 0x61, 0x2B, 0x22, 0x71, 0x75, 0x65, 0x75, 0x65, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 
+    0x22, 0x2C, 0x66, 0x3D, 0x6D, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x73, 0x2C, 0x67, 0x3D, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 
+    0x74, 0x61, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x65, 0x29, 0x67, 0x5B, 0x65, 0x5D, 0x26, 0x26, 
+    0x67, 0x5B, 0x65, 0x5D, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x26, 0x26, 0x64, 0x28, 0x67, 0x5B, 0x65, 0x5D, 0x29, 0x3B, 0x65, 
+    0x6C, 0x73, 0x65, 0x20, 0x66, 0x6F, 0x72, 0x28, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x67, 0x29, 0x67, 0x5B, 0x65, 0x5D, 0x26, 
+    0x26, 0x67, 0x5B, 0x65, 0x5D, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x26, 0x26, 0x63, 0x63, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 
+    0x65, 0x29, 0x26, 0x26, 0x64, 0x28, 0x67, 0x5B, 0x65, 0x5D, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x65, 0x3D, 0x66, 0x2E, 
+    0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x65, 0x2D, 0x2D, 0x3B, 0x29, 0x66, 0x5B, 0x65, 0x5D, 0x2E, 0x65, 0x6C, 0x65, 
+    0x6D, 0x21, 0x3D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x7C, 0x7C, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x61, 0x26, 0x26, 0x66, 
+    0x5B, 0x65, 0x5D, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x21, 0x3D, 0x3D, 0x61, 0x7C, 0x7C, 0x28, 0x66, 0x5B, 0x65, 0x5D, 
+    0x2E, 0x61, 0x6E, 0x69, 0x6D, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x28, 0x63, 0x29, 0x2C, 0x62, 0x3D, 0x21, 0x31, 0x2C, 0x66, 
+    0x2E, 0x73, 0x70, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x65, 0x2C, 0x31, 0x29, 0x29, 0x3B, 0x28, 0x62, 0x7C, 0x7C, 0x21, 0x63, 
+    0x29, 0x26, 0x26, 0x6D, 0x2E, 0x64, 0x65, 0x71, 0x75, 0x65, 0x75, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x29, 
+    0x7D, 0x29, 0x7D, 0x2C, 0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x21, 0x3D, 0x3D, 0x21, 0x31, 0x26, 0x26, 0x28, 0x61, 
+    0x3D, 0x61, 0x7C, 0x7C, 0x22, 0x66, 0x78, 0x22, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x3D, 0x6D, 
+    0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2C, 0x64, 0x3D, 0x63, 0x5B, 0x61, 0x2B, 0x22, 
+    0x71, 0x75, 0x65, 0x75, 0x65, 0x22, 0x5D, 0x2C, 0x65, 0x3D, 0x63, 0x5B, 0x61, 0x2B, 0x22, 0x71, 0x75, 0x65, 0x75, 0x65, 
+    0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x22, 0x5D, 0x2C, 0x66, 0x3D, 0x6D, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x73, 0x2C, 0x67, 
+    0x3D, 0x64, 0x3F, 0x64, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3A, 0x30, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x63, 0x2E, 
+    0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x3D, 0x21, 0x30, 0x2C, 0x6D, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x28, 0x74, 0x68, 
+    0x69, 0x73, 0x2C, 0x61, 0x2C, 0x5B, 0x5D, 0x29, 0x2C, 0x65, 0x26, 0x26, 0x65, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x26, 0x26, 
+    0x65, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x21, 0x30, 0x29, 
+    0x2C, 0x62, 0x3D, 0x66, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x62, 0x2D, 0x2D, 0x3B, 0x29, 0x66, 0x5B, 0x62, 
+    0x5D, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x3D, 0x3D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x26, 0x26, 0x66, 0x5B, 0x62, 0x5D, 0x2E, 
+    0x71, 0x75, 0x65, 0x75, 0x65, 0x3D, 0x3D, 0x3D, 0x61, 0x26, 0x26, 0x28, 0x66, 0x5B, 0x62, 0x5D, 0x2E, 0x61, 0x6E, 0x69, 
+    0x6D, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x28, 0x21, 0x30, 0x29, 0x2C, 0x66, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x63, 0x65, 0x28, 
+    0x62, 0x2C, 0x31, 0x29, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x62, 0x3D, 0x30, 0x3B, 0x67, 0x3E, 0x62, 0x3B, 0x62, 0x2B, 
+    0x2B, 0x29, 0x64, 0x5B, 0x62, 0x5D, 0x26, 0x26, 0x64, 0x5B, 0x62, 0x5D, 0x2E, 0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x26, 
+    0x26, 0x64, 0x5B, 0x62, 0x5D, 0x2E, 0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 
+    0x69, 0x73, 0x29, 0x3B, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 0x63, 0x2E, 0x66, 0x69, 0x6E, 0x69, 0x73, 0x68, 0x7D, 
+    0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x5B, 0x22, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 
+    0x22, 0x2C, 0x22, 0x73, 0x68, 0x6F, 0x77, 0x22, 0x2C, 0x22, 0x68, 0x69, 0x64, 0x65, 0x22, 0x5D, 0x2C, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x6D, 0x2E, 0x66, 
+    0x6E, 0x5B, 0x62, 0x5D, 0x3B, 0x6D, 0x2E, 0x66, 0x6E, 0x5B, 0x62, 0x5D, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x2C, 0x64, 0x2C, 0x65, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 
+    0x3D, 0x3D, 0x61, 0x7C, 0x7C, 0x22, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 
+    0x6F, 0x66, 0x20, 0x61, 0x3F, 0x63, 0x2E, 0x61, 0x70, 0x70, 0x6C, 0x79, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x72, 
+    0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 
+    0x65, 0x28, 0x67, 0x63, 0x28, 0x62, 0x2C, 0x21, 0x30, 0x29, 0x2C, 0x61, 0x2C, 0x64, 0x2C, 0x65, 0x29, 0x7D, 0x7D, 0x29, 
+    0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x7B, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x44, 0x6F, 0x77, 0x6E, 0x3A, 0x67, 
+    0x63, 0x28, 0x22, 0x73, 0x68, 0x6F, 0x77, 0x22, 0x29, 0x2C, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x55, 0x70, 0x3A, 0x67, 0x63, 
+    0x28, 0x22, 0x68, 0x69, 0x64, 0x65, 0x22, 0x29, 0x2C, 0x73, 0x6C, 0x69, 0x64, 0x65, 0x54, 0x6F, 0x67, 0x67, 0x6C, 0x65, 
+    0x3A, 0x67, 0x63, 0x28, 0x22, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x22, 0x29, 0x2C, 0x66, 0x61, 0x64, 0x65, 0x49, 0x6E, 
+    0x3A, 0x7B, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x22, 0x73, 0x68, 0x6F, 0x77, 0x22, 0x7D, 0x2C, 0x66, 0x61, 
+    0x64, 0x65, 0x4F, 0x75, 0x74, 0x3A, 0x7B, 0x6F, 0x70, 0x61, 0x63, 0x69, 0x74, 0x79, 0x3A, 0x22, 0x68, 0x69, 0x64, 0x65, 
+    0x22, 0x7D, 0x2C, 0x66, 0x61, 0x64, 0x65, 0x54, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x3A, 0x7B, 0x6F, 0x70, 0x61, 0x63, 0x69, 
+    0x74, 0x79, 0x3A, 0x22, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x22, 0x7D, 0x7D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x66, 0x6E, 0x5B, 0x61, 0x5D, 0x3D, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 
+    0x68, 0x69, 0x73, 0x2E, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x65, 0x28, 0x62, 0x2C, 0x61, 0x2C, 0x63, 0x2C, 0x64, 0x29, 
+    0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x73, 0x3D, 0x5B, 0x5D, 0x2C, 0x6D, 0x2E, 0x66, 0x78, 
+    0x2E, 0x74, 0x69, 0x63, 0x6B, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 
+    0x20, 0x61, 0x2C, 0x62, 0x3D, 0x6D, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x73, 0x2C, 0x63, 0x3D, 0x30, 0x3B, 0x66, 0x6F, 
+    0x72, 0x28, 0x24, 0x62, 0x3D, 0x6D, 0x2E, 0x6E, 0x6F, 0x77, 0x28, 0x29, 0x3B, 0x63, 0x3C, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 
+    0x67, 0x74, 0x68, 0x3B, 0x63, 0x2B, 0x2B, 0x29, 0x61, 0x3D, 0x62, 0x5B, 0x63, 0x5D, 0x2C, 0x61, 0x28, 0x29, 0x7C, 0x7C, 
+    0x62, 0x5B, 0x63, 0x5D, 0x21, 0x3D, 0x3D, 0x61, 0x7C, 0x7C, 0x62, 0x2E, 0x73, 0x70, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x63, 
+    0x2D, 0x2D, 0x2C, 0x31, 0x29, 0x3B, 0x62, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x7C, 0x7C, 0x6D, 0x2E, 0x66, 0x78, 
+    0x2E, 0x73, 0x74, 0x6F, 0x70, 0x28, 0x29, 0x2C, 0x24, 0x62, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x2C, 0x6D, 
+    0x2E, 0x66, 0x78, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x29, 0x7B, 0x6D, 0x2E, 0x74, 0x69, 0x6D, 0x65, 0x72, 0x73, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x61, 0x29, 0x2C, 0x61, 
+    0x28, 0x29, 0x3F, 0x6D, 0x2E, 0x66, 0x78, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x28, 0x29, 0x3A, 0x6D, 0x2E, 0x74, 0x69, 
+    0x6D, 0x65, 0x72, 0x73, 0x2E, 0x70, 0x6F, 0x70, 0x28, 0x29, 0x7D, 0x2C, 0x6D, 0x2E, 0x66, 0x78, 0x2E, 0x69, 0x6E, 0x74, 
+    0x65, 0x72, 0x76, 0x61, 0x6C, 0x3D, 0x31, 0x33, 0x2C, 0x6D, 0x2E, 0x66, 0x78, 0x2E, 0x73, 0x74, 0x61, 0x72, 0x74, 0x3D, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x5F, 0x62, 0x7C, 0x7C, 0x28, 0x5F, 0x62, 0x3D, 0x73, 
+    0x65, 0x74, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x28, 0x6D, 0x2E, 0x66, 0x78, 0x2E, 0x74, 0x69, 0x63, 0x6B, 
+    0x2C, 0x6D, 0x2E, 0x66, 0x78, 0x2E, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x29, 0x29, 0x7D, 0x2C, 0x6D, 0x2E, 
+    0x66, 0x78, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x63, 
+    0x6C, 0x65, 0x61, 0x72, 0x49, 0x6E, 0x74, 0x65, 0x72, 0x76, 0x61, 0x6C, 0x28, 0x5F, 0x62, 0x29, 0x2C, 0x5F, 0x62, 0x3D, 
+    0x6E, 0x75, 0x6C, 0x6C, 0x7D, 0x2C, 0x6D, 0x2E, 0x66, 0x78, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 0x73, 0x3D, 0x7B, 0x73, 
+    0x6C, 0x6F, 0x77, 0x3A, 0x36, 0x30, 0x30, 0x2C, 0x66, 0x61, 0x73, 0x74, 0x3A, 0x32, 0x30, 0x30, 0x2C, 0x5F, 0x64, 0x65, 
+    0x66, 0x61, 0x75, 0x6C, 0x74, 0x3A, 0x34, 0x30, 0x30, 0x7D, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x64, 0x65, 0x6C, 0x61, 
+    0x79, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x61, 0x3D, 0x6D, 0x2E, 0x66, 0x78, 0x3F, 0x6D, 0x2E, 0x66, 0x78, 0x2E, 0x73, 0x70, 0x65, 0x65, 0x64, 
+    0x73, 0x5B, 0x61, 0x5D, 0x7C, 0x7C, 0x61, 0x3A, 0x61, 0x2C, 0x62, 0x3D, 0x62, 0x7C, 0x7C, 0x22, 0x66, 0x78, 0x22, 0x2C, 
+    0x74, 0x68, 0x69, 0x73, 0x2E, 0x71, 0x75, 0x65, 0x75, 0x65, 0x28, 0x62, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 
+    0x6F, 0x75, 0x74, 0x28, 0x62, 0x2C, 0x61, 0x29, 0x3B, 0x63, 0x2E, 0x73, 0x74, 0x6F, 0x70, 0x3D, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28, 
+    0x64, 0x29, 0x7D, 0x7D, 0x29, 0x7D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x3B, 0x62, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 
+    0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x64, 0x69, 0x76, 0x22, 0x29, 0x2C, 0x62, 0x2E, 0x73, 
+    0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 
+    0x6D, 0x65, 0x22, 0x2C, 0x22, 0x74, 0x22, 0x29, 0x2C, 0x62, 0x2E, 0x69, 0x6E, 0x6E, 0x65, 0x72, 0x48, 0x54, 0x4D, 0x4C, 
+    0x3D, 0x22, 0x20, 0x20, 0x3C, 0x6C, 0x69, 0x6E, 0x6B, 0x2F, 0x3E, 0x3C, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x2F, 
+    0x74, 0x61, 0x62, 0x6C, 0x65, 0x3E, 0x3C, 0x61, 0x20, 0x68, 0x72, 0x65, 0x66, 0x3D, 0x27, 0x2F, 0x61, 0x27, 0x3E, 0x61, 
+    0x3C, 0x2F, 0x61, 0x3E, 0x3C, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x20, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x27, 0x63, 0x68, 0x65, 
+    0x63, 0x6B, 0x62, 0x6F, 0x78, 0x27, 0x2F, 0x3E, 0x22, 0x2C, 0x64, 0x3D, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x22, 0x61, 0x22, 0x29, 0x5B, 
+    0x30, 0x5D, 0x2C, 0x63, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 
+    0x28, 0x22, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x22, 0x29, 0x2C, 0x65, 0x3D, 0x63, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 
+    0x64, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 
+    0x6E, 0x74, 0x28, 0x22, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x29, 0x29, 0x2C, 0x61, 0x3D, 0x62, 0x2E, 0x67, 0x65, 
+    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x22, 
+    0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x29, 0x5B, 0x30, 0x5D, 0x2C, 0x64, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x63, 
+    0x73, 0x73, 0x54, 0x65, 0x78, 0x74, 0x3D, 0x22, 0x74, 0x6F, 0x70, 0x3A, 0x31, 0x70, 0x78, 0x22, 0x2C, 0x6B, 0x2E, 0x67, 
+    0x65, 0x74, 0x53, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x3D, 0x22, 0x74, 0x22, 0x21, 0x3D, 
+    0x3D, 0x62, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x2C, 0x6B, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 
+    0x3D, 0x2F, 0x74, 0x6F, 0x70, 0x2F, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x64, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 
+    0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x22, 0x29, 0x29, 0x2C, 0x6B, 0x2E, 0x68, 
+    0x72, 0x65, 0x66, 0x4E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x64, 0x3D, 0x22, 0x2F, 0x61, 0x22, 0x3D, 0x3D, 
+    0x3D, 0x64, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x68, 0x72, 0x65, 
+    0x66, 0x22, 0x29, 0x2C, 0x6B, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x4F, 0x6E, 0x3D, 0x21, 0x21, 0x61, 0x2E, 0x76, 0x61, 
+    0x6C, 0x75, 0x65, 0x2C, 0x6B, 0x2E, 0x6F, 0x70, 0x74, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3D, 0x65, 0x2E, 
+    0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x2C, 0x6B, 0x2E, 0x65, 0x6E, 0x63, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x21, 
+    0x21, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x66, 0x6F, 
+    0x72, 0x6D, 0x22, 0x29, 0x2E, 0x65, 0x6E, 0x63, 0x74, 0x79, 0x70, 0x65, 0x2C, 0x63, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 
+    0x6C, 0x65, 0x64, 0x3D, 0x21, 0x30, 0x2C, 0x6B, 0x2E, 0x6F, 0x70, 0x74, 0x44, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 
+    0x3D, 0x21, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x2C, 0x61, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 
+    0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x29, 0x2C, 
+    0x61, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x22, 0x2C, 0x22, 0x22, 0x29, 0x2C, 0x6B, 0x2E, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x3D, 0x22, 0x22, 0x3D, 0x3D, 0x3D, 
+    0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x22, 0x29, 0x2C, 0x61, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x22, 0x74, 0x22, 0x2C, 0x61, 0x2E, 0x73, 0x65, 
+    0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2C, 0x22, 0x72, 
+    0x61, 0x64, 0x69, 0x6F, 0x22, 0x29, 0x2C, 0x6B, 0x2E, 0x72, 0x61, 0x64, 0x69, 0x6F, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x3D, 
+    0x22, 0x74, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x7D, 0x28, 0x29, 0x3B, 0x76, 0x61, 0x72, 
+    0x20, 0x6C, 0x63, 0x3D, 0x2F, 0x5C, 0x72, 0x2F, 0x67, 0x3B, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 
+    0x64, 0x28, 0x7B, 0x76, 0x61, 0x6C, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 
+    0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x3B, 0x7B, 
+    0x69, 0x66, 0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x3D, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x3B, 0x31, 0x3D, 0x3D, 0x3D, 0x74, 0x68, 0x69, 
+    0x73, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x28, 0x65, 0x3D, 0x64, 0x3F, 0x61, 0x2E, 0x63, 
+    0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x63, 0x2C, 0x6D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2E, 0x76, 
+    0x61, 0x6C, 0x28, 0x29, 0x29, 0x3A, 0x61, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x65, 0x3F, 0x65, 0x3D, 0x22, 0x22, 
+    0x3A, 0x22, 0x6E, 0x75, 0x6D, 0x62, 0x65, 0x72, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x65, 0x3F, 
+    0x65, 0x2B, 0x3D, 0x22, 0x22, 0x3A, 0x6D, 0x2E, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x65, 0x29, 0x26, 0x26, 
+    0x28, 0x65, 0x3D, 0x6D, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x65, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x61, 0x3F, 0x22, 0x22, 
+    0x3A, 0x61, 0x2B, 0x22, 0x22, 0x7D, 0x29, 0x29, 0x2C, 0x62, 0x3D, 0x6D, 0x2E, 0x76, 0x61, 0x6C, 0x48, 0x6F, 0x6F, 0x6B, 
+    0x73, 0x5B, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x5D, 0x7C, 0x7C, 0x6D, 0x2E, 0x76, 0x61, 0x6C, 0x48, 
+    0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 
+    0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x5D, 0x2C, 0x62, 0x26, 0x26, 0x22, 0x73, 0x65, 
+    0x74, 0x22, 0x69, 0x6E, 0x20, 0x62, 0x26, 0x26, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x62, 0x2E, 0x73, 
+    0x65, 0x74, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x65, 0x2C, 0x22, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x29, 0x7C, 0x7C, 
+    0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x65, 0x29, 0x29, 0x7D, 0x29, 0x3B, 0x69, 0x66, 
+    0x28, 0x65, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x3D, 0x6D, 0x2E, 0x76, 0x61, 0x6C, 0x48, 0x6F, 0x6F, 
+    0x6B, 0x73, 0x5B, 0x65, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x5D, 0x7C, 0x7C, 0x6D, 0x2E, 0x76, 0x61, 0x6C, 0x48, 0x6F, 0x6F, 
+    0x6B, 0x73, 0x5B, 0x65, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 
+    0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x5D, 0x2C, 0x62, 0x26, 0x26, 0x22, 0x67, 0x65, 0x74, 0x22, 0x69, 0x6E, 0x20, 
+    0x62, 0x26, 0x26, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x28, 0x63, 0x3D, 0x62, 0x2E, 0x67, 0x65, 0x74, 
+    0x28, 0x65, 0x2C, 0x22, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x29, 0x29, 0x3F, 0x63, 0x3A, 0x28, 0x63, 0x3D, 0x65, 0x2E, 
+    0x76, 0x61, 0x6C, 0x75, 0x65, 0x2C, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 
+    0x6F, 0x66, 0x20, 0x63, 0x3F, 0x63, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x6C, 0x63, 0x2C, 0x22, 0x22, 
+    0x29, 0x3A, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x63, 0x3F, 0x22, 0x22, 0x3A, 0x63, 0x29, 0x7D, 0x7D, 0x7D, 0x29, 0x2C, 
+    0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x76, 0x61, 0x6C, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x3A, 0x7B, 
+    0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x7B, 0x67, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x6D, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x2E, 0x61, 0x74, 0x74, 
+    0x72, 0x28, 0x61, 0x2C, 0x22, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x62, 0x3F, 0x62, 0x3A, 0x6D, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x6D, 0x2E, 0x74, 
+    0x65, 0x78, 0x74, 0x28, 0x61, 0x29, 0x29, 0x7D, 0x7D, 0x2C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x3A, 0x7B, 0x67, 0x65, 
+    0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 
+    0x72, 0x20, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x3D, 0x61, 0x2E, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2C, 0x65, 0x3D, 
+    0x61, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x2C, 0x66, 0x3D, 0x22, 0x73, 
+    0x65, 0x6C, 0x65, 0x63, 0x74, 0x2D, 0x6F, 0x6E, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x7C, 
+    0x7C, 0x30, 0x3E, 0x65, 0x2C, 0x67, 0x3D, 0x66, 0x3F, 0x6E, 0x75, 0x6C, 0x6C, 0x3A, 0x5B, 0x5D, 0x2C, 0x68, 0x3D, 0x66, 
+    0x3F, 0x65, 0x2B, 0x31, 0x3A, 0x64, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x69, 0x3D, 0x30, 0x3E, 0x65, 0x3F, 
+    0x68, 0x3A, 0x66, 0x3F, 0x65, 0x3A, 0x30, 0x3B, 0x68, 0x3E, 0x69, 0x3B, 0x69, 0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x63, 
+    0x3D, 0x64, 0x5B, 0x69, 0x5D, 0x2C, 0x21, 0x28, 0x21, 0x63, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x26, 
+    0x26, 0x69, 0x21, 0x3D, 0x3D, 0x65, 0x7C, 0x7C, 0x28, 0x6B, 0x2E, 0x6F, 0x70, 0x74, 0x44, 0x69, 0x73, 0x61, 0x62, 0x6C, 
+    0x65, 0x64, 0x3F, 0x63, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x3A, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 
+    0x3D, 0x63, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x64, 0x69, 0x73, 
+    0x61, 0x62, 0x6C, 0x65, 0x64, 0x22, 0x29, 0x29, 0x7C, 0x7C, 0x63, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 
+    0x64, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x61, 0x62, 0x6C, 0x65, 0x64, 0x26, 0x26, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 
+    0x61, 0x6D, 0x65, 0x28, 0x63, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x2C, 0x22, 0x6F, 0x70, 
+    0x74, 0x67, 0x72, 0x6F, 0x75, 0x70, 0x22, 0x29, 0x29, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x62, 0x3D, 0x6D, 0x28, 0x63, 0x29, 
+    0x2E, 0x76, 0x61, 0x6C, 0x28, 0x29, 0x2C, 0x66, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x3B, 0x67, 0x2E, 
+    0x70, 0x75, 0x73, 0x68, 0x28, 0x62, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x67, 0x7D, 0x2C, 0x73, 0x65, 
+    0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 
+    0x63, 0x2C, 0x64, 0x2C, 0x65, 0x3D, 0x61, 0x2E, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x2C, 0x66, 0x3D, 0x6D, 0x2E, 
+    0x6D, 0x61, 0x6B, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x62, 0x29, 0x2C, 0x67, 0x3D, 0x65, 0x2E, 0x6C, 0x65, 0x6E, 
+    0x67, 0x74, 0x68, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x67, 0x2D, 0x2D, 0x29, 0x69, 0x66, 0x28, 0x64, 0x3D, 0x65, 
+    0x5B, 0x67, 0x5D, 0x2C, 0x6D, 0x2E, 0x69, 0x6E, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x6D, 0x2E, 0x76, 0x61, 0x6C, 0x48, 
+    0x6F, 0x6F, 0x6B, 0x73, 0x2E, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x67, 0x65, 0x74, 0x28, 0x64, 0x29, 0x2C, 0x66, 
+    0x29, 0x3E, 0x3D, 0x30, 0x29, 0x74, 0x72, 0x79, 0x7B, 0x64, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3D, 
+    0x63, 0x3D, 0x21, 0x30, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x68, 0x29, 0x7B, 0x64, 0x2E, 0x73, 0x63, 0x72, 0x6F, 
+    0x6C, 0x6C, 0x48, 0x65, 0x69, 0x67, 0x68, 0x74, 0x7D, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x64, 0x2E, 0x73, 0x65, 0x6C, 0x65, 
+    0x63, 0x74, 0x65, 0x64, 0x3D, 0x21, 0x31, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x7C, 0x7C, 0x28, 0x61, 
+    0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x3D, 0x2D, 0x31, 0x29, 0x2C, 0x65, 
+    0x7D, 0x7D, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x5B, 0x22, 0x72, 0x61, 0x64, 0x69, 0x6F, 
+    0x22, 0x2C, 0x22, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x62, 0x6F, 0x78, 0x22, 0x5D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 0x2E, 0x76, 0x61, 0x6C, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x74, 0x68, 0x69, 0x73, 
+    0x5D, 0x3D, 0x7B, 0x73, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 
+    0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x62, 0x29, 
+    0x3F, 0x61, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x3D, 0x6D, 0x2E, 0x69, 0x6E, 0x41, 0x72, 0x72, 0x61, 0x79, 
+    0x28, 0x6D, 0x28, 0x61, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x28, 0x29, 0x2C, 0x62, 0x29, 0x3E, 0x3D, 0x30, 0x3A, 0x76, 0x6F, 
+    0x69, 0x64, 0x20, 0x30, 0x7D, 0x7D, 0x2C, 0x6B, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x4F, 0x6E, 0x7C, 0x7C, 0x28, 0x6D, 
+    0x2E, 0x76, 0x61, 0x6C, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x74, 0x68, 0x69, 0x73, 0x5D, 0x2E, 0x67, 0x65, 0x74, 0x3D, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 
+    0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 
+    0x28, 0x22, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x22, 0x29, 0x3F, 0x22, 0x6F, 0x6E, 0x22, 0x3A, 0x61, 0x2E, 0x76, 0x61, 0x6C, 
+    0x75, 0x65, 0x7D, 0x29, 0x7D, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x6D, 0x63, 0x2C, 0x6E, 0x63, 0x2C, 0x6F, 0x63, 0x3D, 
+    0x6D, 0x2E, 0x65, 0x78, 0x70, 0x72, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x48, 0x61, 0x6E, 0x64, 0x6C, 0x65, 0x2C, 0x70, 0x63, 
+    0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x7C, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 
+    0x65, 0x64, 0x29, 0x24, 0x2F, 0x69, 0x2C, 0x71, 0x63, 0x3D, 0x6B, 0x2E, 0x67, 0x65, 0x74, 0x53, 0x65, 0x74, 0x41, 0x74, 
+    0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x2C, 0x72, 0x63, 0x3D, 0x6B, 0x2E, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x3B, 0x6D, 
+    0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x61, 0x74, 0x74, 0x72, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x56, 0x28, 
+    0x74, 0x68, 0x69, 0x73, 0x2C, 0x6D, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x2C, 0x61, 0x2C, 0x62, 0x2C, 0x61, 0x72, 0x67, 0x75, 
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3E, 0x31, 0x29, 0x7D, 0x2C, 0x72, 0x65, 0x6D, 
+    0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72, 
+    0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x29, 0x7D, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 
+    0x6E, 0x64, 0x28, 0x7B, 0x61, 0x74, 0x74, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 
+    0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x3B, 0x69, 0x66, 0x28, 0x61, 0x26, 0x26, 0x33, 0x21, 0x3D, 0x3D, 0x66, 0x26, 0x26, 0x38, 
+    0x21, 0x3D, 0x3D, 0x66, 0x26, 0x26, 0x32, 0x21, 0x3D, 0x3D, 0x66, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 
+    0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 
+    0x3D, 0x3D, 0x3D, 0x4B, 0x3F, 0x6D, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x3A, 0x28, 
+    0x31, 0x3D, 0x3D, 0x3D, 0x66, 0x26, 0x26, 0x6D, 0x2E, 0x69, 0x73, 0x58, 0x4D, 0x4C, 0x44, 0x6F, 0x63, 0x28, 0x61, 0x29, 
+    0x7C, 0x7C, 0x28, 0x62, 0x3D, 0x62, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 
+    0x2C, 0x64, 0x3D, 0x6D, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x62, 0x5D, 0x7C, 0x7C, 0x28, 
+    0x6D, 0x2E, 0x65, 0x78, 0x70, 0x72, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x2E, 0x62, 0x6F, 0x6F, 0x6C, 0x2E, 0x74, 0x65, 
+    0x73, 0x74, 0x28, 0x62, 0x29, 0x3F, 0x6E, 0x63, 0x3A, 0x6D, 0x63, 0x29, 0x29, 0x2C, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 
+    0x3D, 0x3D, 0x3D, 0x63, 0x3F, 0x64, 0x26, 0x26, 0x22, 0x67, 0x65, 0x74, 0x22, 0x69, 0x6E, 0x20, 0x64, 0x26, 0x26, 0x6E, 
+    0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x3D, 0x28, 0x65, 0x3D, 0x64, 0x2E, 0x67, 0x65, 0x74, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x29, 
+    0x3F, 0x65, 0x3A, 0x28, 0x65, 0x3D, 0x6D, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x28, 0x61, 0x2C, 
+    0x62, 0x29, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x65, 0x3F, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3A, 0x65, 0x29, 
+    0x3A, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x3D, 0x63, 0x3F, 0x64, 0x26, 0x26, 0x22, 0x73, 0x65, 0x74, 0x22, 0x69, 0x6E, 
+    0x20, 0x64, 0x26, 0x26, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x28, 0x65, 0x3D, 0x64, 0x2E, 0x73, 0x65, 
+    0x74, 0x28, 0x61, 0x2C, 0x63, 0x2C, 0x62, 0x29, 0x29, 0x3F, 0x65, 0x3A, 0x28, 0x61, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74, 
+    0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x62, 0x2C, 0x63, 0x2B, 0x22, 0x22, 0x29, 0x2C, 0x63, 0x29, 0x3A, 0x76, 
+    0x6F, 0x69, 0x64, 0x20, 0x6D, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72, 0x28, 0x61, 0x2C, 0x62, 
+    0x29, 0x29, 0x7D, 0x2C, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x3D, 0x30, 
+    0x2C, 0x66, 0x3D, 0x62, 0x26, 0x26, 0x62, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x28, 0x45, 0x29, 0x3B, 0x69, 0x66, 0x28, 
+    0x66, 0x26, 0x26, 0x31, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x77, 0x68, 
+    0x69, 0x6C, 0x65, 0x28, 0x63, 0x3D, 0x66, 0x5B, 0x65, 0x2B, 0x2B, 0x5D, 0x29, 0x64, 0x3D, 0x6D, 0x2E, 0x70, 0x72, 0x6F, 
+    0x70, 0x46, 0x69, 0x78, 0x5B, 0x63, 0x5D, 0x7C, 0x7C, 0x63, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x72, 0x2E, 0x6D, 0x61, 
+    0x74, 0x63, 0x68, 0x2E, 0x62, 0x6F, 0x6F, 0x6C, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x63, 0x29, 0x3F, 0x72, 0x63, 0x26, 
+    0x26, 0x71, 0x63, 0x7C, 0x7C, 0x21, 0x70, 0x63, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x63, 0x29, 0x3F, 0x61, 0x5B, 0x64, 
+    0x5D, 0x3D, 0x21, 0x31, 0x3A, 0x61, 0x5B, 0x6D, 0x2E, 0x63, 0x61, 0x6D, 0x65, 0x6C, 0x43, 0x61, 0x73, 0x65, 0x28, 0x22, 
+    0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2D, 0x22, 0x2B, 0x63, 0x29, 0x5D, 0x3D, 0x61, 0x5B, 0x64, 0x5D, 0x3D, 0x21, 
+    0x31, 0x3A, 0x6D, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x28, 0x61, 0x2C, 0x63, 0x2C, 0x22, 0x22, 0x29, 0x2C, 0x61, 0x2E, 0x72, 
+    0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x71, 0x63, 0x3F, 0x63, 0x3A, 
+    0x64, 0x29, 0x7D, 0x2C, 0x61, 0x74, 0x74, 0x72, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x3A, 0x7B, 0x74, 0x79, 0x70, 0x65, 0x3A, 
+    0x7B, 0x73, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x69, 
+    0x66, 0x28, 0x21, 0x6B, 0x2E, 0x72, 0x61, 0x64, 0x69, 0x6F, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x26, 0x26, 0x22, 0x72, 0x61, 
+    0x64, 0x69, 0x6F, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x26, 0x26, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 
+    0x28, 0x61, 0x2C, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x29, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x61, 
+    0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x73, 0x65, 0x74, 0x41, 
+    0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x22, 0x74, 0x79, 0x70, 0x65, 0x22, 0x2C, 0x62, 0x29, 0x2C, 0x63, 
+    0x26, 0x26, 0x28, 0x61, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x63, 0x29, 0x2C, 0x62, 0x7D, 0x7D, 0x7D, 0x7D, 0x7D, 
+    0x29, 0x2C, 0x6E, 0x63, 0x3D, 0x7B, 0x73, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x3F, 
+    0x6D, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x41, 0x74, 0x74, 0x72, 0x28, 0x61, 0x2C, 0x63, 0x29, 0x3A, 0x72, 0x63, 
+    0x26, 0x26, 0x71, 0x63, 0x7C, 0x7C, 0x21, 0x70, 0x63, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x63, 0x29, 0x3F, 0x61, 0x2E, 
+    0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x21, 0x71, 0x63, 0x26, 0x26, 0x6D, 0x2E, 
+    0x70, 0x72, 0x6F, 0x70, 0x46, 0x69, 0x78, 0x5B, 0x63, 0x5D, 0x7C, 0x7C, 0x63, 0x2C, 0x63, 0x29, 0x3A, 0x61, 0x5B, 0x6D, 
+    0x2E, 0x63, 0x61, 0x6D, 0x65, 0x6C, 0x43, 0x61, 0x73, 0x65, 0x28, 0x22, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x2D, 
+    0x22, 0x2B, 0x63, 0x29, 0x5D, 0x3D, 0x61, 0x5B, 0x63, 0x5D, 0x3D, 0x21, 0x30, 0x2C, 0x63, 0x7D, 0x7D, 0x2C, 0x6D, 0x2E, 
+    0x65, 0x61, 0x63, 0x68, 0x28, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x72, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x2E, 0x62, 0x6F, 
+    0x6F, 0x6C, 0x2E, 0x73, 0x6F, 0x75, 0x72, 0x63, 0x65, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x28, 0x2F, 0x5C, 0x77, 0x2B, 
+    0x2F, 0x67, 0x29, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x63, 0x3D, 0x6F, 0x63, 0x5B, 0x62, 0x5D, 0x7C, 0x7C, 0x6D, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x2E, 0x61, 0x74, 
+    0x74, 0x72, 0x3B, 0x6F, 0x63, 0x5B, 0x62, 0x5D, 0x3D, 0x72, 0x63, 0x26, 0x26, 0x71, 0x63, 0x7C, 0x7C, 0x21, 0x70, 0x63, 
+    0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x62, 0x29, 0x3F, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 
+    0x62, 0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x2C, 0x66, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x64, 0x7C, 0x7C, 0x28, 0x66, 0x3D, 0x6F, 0x63, 0x5B, 0x62, 0x5D, 0x2C, 0x6F, 0x63, 0x5B, 0x62, 0x5D, 0x3D, 0x65, 0x2C, 
+    0x65, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x63, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x64, 0x29, 0x3F, 0x62, 0x2E, 0x74, 
+    0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x3A, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x6F, 0x63, 
+    0x5B, 0x62, 0x5D, 0x3D, 0x66, 0x29, 0x2C, 0x65, 0x7D, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x3F, 0x76, 0x6F, 0x69, 0x64, 0x20, 
+    0x30, 0x3A, 0x61, 0x5B, 0x6D, 0x2E, 0x63, 0x61, 0x6D, 0x65, 0x6C, 0x43, 0x61, 0x73, 0x65, 0x28, 0x22, 0x64, 0x65, 0x66, 
+    0x61, 0x75, 0x6C, 0x74, 0x2D, 0x22, 0x2B, 0x62, 0x29, 0x5D, 0x3F, 0x62, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 
+    0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x3A, 0x6E, 0x75, 0x6C, 0x6C, 0x7D, 0x7D, 0x29, 0x2C, 0x72, 0x63, 0x26, 0x26, 0x71, 
+    0x63, 0x7C, 0x7C, 0x28, 0x6D, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x3D, 0x7B, 0x73, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 
+    0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 
+    0x28, 0x61, 0x2C, 0x22, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x22, 0x29, 0x3F, 0x76, 0x6F, 0x69, 0x64, 0x28, 0x61, 0x2E, 0x64, 
+    0x65, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x56, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x62, 0x29, 0x3A, 0x6D, 0x63, 0x26, 0x26, 0x6D, 
+    0x63, 0x2E, 0x73, 0x65, 0x74, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x71, 0x63, 0x7C, 0x7C, 
+    0x28, 0x6D, 0x63, 0x3D, 0x7B, 0x73, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 
+    0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x3D, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 
+    0x69, 0x62, 0x75, 0x74, 0x65, 0x4E, 0x6F, 0x64, 0x65, 0x28, 0x63, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x64, 0x7C, 0x7C, 0x61, 0x2E, 0x73, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x4E, 0x6F, 0x64, 
+    0x65, 0x28, 0x64, 0x3D, 0x61, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 
+    0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x63, 0x29, 0x29, 0x2C, 
+    0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3D, 0x62, 0x2B, 0x3D, 0x22, 0x22, 0x2C, 0x22, 0x76, 0x61, 0x6C, 0x75, 0x65, 
+    0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x7C, 0x7C, 0x62, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 
+    0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x63, 0x29, 0x3F, 0x62, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x7D, 0x2C, 
+    0x6F, 0x63, 0x2E, 0x69, 0x64, 0x3D, 0x6F, 0x63, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x3D, 0x6F, 0x63, 0x2E, 0x63, 0x6F, 0x6F, 
+    0x72, 0x64, 0x73, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 
+    0x76, 0x61, 0x72, 0x20, 0x64, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x3F, 0x76, 0x6F, 0x69, 0x64, 0x20, 
+    0x30, 0x3A, 0x28, 0x64, 0x3D, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x4E, 
+    0x6F, 0x64, 0x65, 0x28, 0x62, 0x29, 0x29, 0x26, 0x26, 0x22, 0x22, 0x21, 0x3D, 0x3D, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 
+    0x65, 0x3F, 0x64, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x6E, 0x75, 0x6C, 0x6C, 0x7D, 0x2C, 0x6D, 0x2E, 0x76, 0x61, 
+    0x6C, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x2E, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 0x3D, 0x7B, 0x67, 0x65, 0x74, 0x3A, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x61, 
+    0x2E, 0x67, 0x65, 0x74, 0x41, 0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x4E, 0x6F, 0x64, 0x65, 0x28, 0x62, 0x29, 
+    0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x26, 0x26, 0x63, 0x2E, 0x73, 0x70, 0x65, 0x63, 0x69, 0x66, 0x69, 
+    0x65, 0x64, 0x3F, 0x63, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x2C, 0x73, 
+    0x65, 0x74, 0x3A, 0x6D, 0x63, 0x2E, 0x73, 0x65, 0x74, 0x7D, 0x2C, 0x6D, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x48, 0x6F, 0x6F, 
+    0x6B, 0x73, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x65, 0x64, 0x69, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x3D, 0x7B, 
+    0x73, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 
+    0x6D, 0x63, 0x2E, 0x73, 0x65, 0x74, 0x28, 0x61, 0x2C, 0x22, 0x22, 0x3D, 0x3D, 0x3D, 0x62, 0x3F, 0x21, 0x31, 0x3A, 0x62, 
+    0x2C, 0x63, 0x29, 0x7D, 0x7D, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x5B, 0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 
+    0x22, 0x2C, 0x22, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x22, 0x5D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x62, 0x5D, 
+    0x3D, 0x7B, 0x73, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x63, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x3F, 0x28, 0x61, 0x2E, 0x73, 0x65, 0x74, 0x41, 
+    0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x62, 0x2C, 0x22, 0x61, 0x75, 0x74, 0x6F, 0x22, 0x29, 0x2C, 0x63, 
+    0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x7D, 0x7D, 0x29, 0x29, 0x2C, 0x6B, 0x2E, 0x73, 0x74, 0x79, 0x6C, 
+    0x65, 0x7C, 0x7C, 0x28, 0x6D, 0x2E, 0x61, 0x74, 0x74, 0x72, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x2E, 0x73, 0x74, 0x79, 0x6C, 
+    0x65, 0x3D, 0x7B, 0x67, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x63, 0x73, 0x73, 0x54, 0x65, 0x78, 
+    0x74, 0x7C, 0x7C, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x2C, 0x73, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x73, 0x74, 
+    0x79, 0x6C, 0x65, 0x2E, 0x63, 0x73, 0x73, 0x54, 0x65, 0x78, 0x74, 0x3D, 0x62, 0x2B, 0x22, 0x22, 0x7D, 0x7D, 0x29, 0x3B, 
+    0x76, 0x61, 0x72, 0x20, 0x73, 0x63, 0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x7C, 0x73, 0x65, 
+    0x6C, 0x65, 0x63, 0x74, 0x7C, 0x74, 0x65, 0x78, 0x74, 0x61, 0x72, 0x65, 0x61, 0x7C, 0x62, 0x75, 0x74, 0x74, 0x6F, 0x6E, 
+    0x7C, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x29, 0x24, 0x2F, 0x69, 0x2C, 0x74, 0x63, 0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 
+    0x61, 0x7C, 0x61, 0x72, 0x65, 0x61, 0x29, 0x24, 0x2F, 0x69, 0x3B, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 0x74, 0x65, 
+    0x6E, 0x64, 0x28, 0x7B, 0x70, 0x72, 0x6F, 0x70, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 
+    0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x56, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x6D, 0x2E, 0x70, 
+    0x72, 0x6F, 0x70, 0x2C, 0x61, 0x2C, 0x62, 0x2C, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 
+    0x6E, 0x67, 0x74, 0x68, 0x3E, 0x31, 0x29, 0x7D, 0x2C, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x50, 0x72, 0x6F, 0x70, 0x3A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 
+    0x3D, 0x6D, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x46, 0x69, 0x78, 0x5B, 0x61, 0x5D, 0x7C, 0x7C, 0x61, 0x2C, 0x74, 0x68, 0x69, 
+    0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x74, 0x72, 
+    0x79, 0x7B, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x61, 0x5D, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x64, 0x65, 0x6C, 
+    0x65, 0x74, 0x65, 0x20, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x61, 0x5D, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x62, 0x29, 
+    0x7B, 0x7D, 0x7D, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x70, 0x72, 
+    0x6F, 0x70, 0x46, 0x69, 0x78, 0x3A, 0x7B, 0x22, 0x66, 0x6F, 0x72, 0x22, 0x3A, 0x22, 0x68, 0x74, 0x6D, 0x6C, 0x46, 0x6F, 
+    0x72, 0x22, 0x2C, 0x22, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x22, 0x3A, 0x22, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 
+    0x65, 0x22, 0x7D, 0x2C, 0x70, 0x72, 0x6F, 0x70, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 
+    0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x3D, 0x61, 0x2E, 0x6E, 
+    0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3B, 0x69, 0x66, 0x28, 0x61, 0x26, 0x26, 0x33, 0x21, 0x3D, 0x3D, 0x67, 0x26, 
+    0x26, 0x38, 0x21, 0x3D, 0x3D, 0x67, 0x26, 0x26, 0x32, 0x21, 0x3D, 0x3D, 0x67, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x66, 0x3D, 0x31, 0x21, 0x3D, 0x3D, 0x67, 0x7C, 0x7C, 0x21, 0x6D, 0x2E, 0x69, 0x73, 0x58, 0x4D, 0x4C, 0x44, 0x6F, 
+    0x63, 0x28, 0x61, 0x29, 0x2C, 0x66, 0x26, 0x26, 0x28, 0x62, 0x3D, 0x6D, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x46, 0x69, 0x78, 
+    0x5B, 0x62, 0x5D, 0x7C, 0x7C, 0x62, 0x2C, 0x65, 0x3D, 0x6D, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 
+    0x5B, 0x62, 0x5D, 0x29, 0x2C, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x63, 0x3F, 0x65, 0x26, 0x26, 0x22, 
+    0x73, 0x65, 0x74, 0x22, 0x69, 0x6E, 0x20, 0x65, 0x26, 0x26, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x28, 
+    0x64, 0x3D, 0x65, 0x2E, 0x73, 0x65, 0x74, 0x28, 0x61, 0x2C, 0x63, 0x2C, 0x62, 0x29, 0x29, 0x3F, 0x64, 0x3A, 0x61, 0x5B, 
+    0x62, 0x5D, 0x3D, 0x63, 0x3A, 0x65, 0x26, 0x26, 0x22, 0x67, 0x65, 0x74, 0x22, 0x69, 0x6E, 0x20, 0x65, 0x26, 0x26, 0x6E, 
+    0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x3D, 0x28, 0x64, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x29, 
+    0x3F, 0x64, 0x3A, 0x61, 0x5B, 0x62, 0x5D, 0x7D, 0x2C, 0x70, 0x72, 0x6F, 0x70, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x3A, 0x7B, 
+    0x74, 0x61, 0x62, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x3A, 0x7B, 0x67, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x6D, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x2E, 0x61, 
+    0x74, 0x74, 0x72, 0x28, 0x61, 0x2C, 0x22, 0x74, 0x61, 0x62, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x22, 0x29, 0x3B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x3F, 0x70, 0x61, 0x72, 0x73, 0x65, 0x49, 0x6E, 0x74, 0x28, 0x62, 0x2C, 0x31, 0x30, 
+    0x29, 0x3A, 0x73, 0x63, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 
+    0x29, 0x7C, 0x7C, 0x74, 0x63, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 
+    0x65, 0x29, 0x26, 0x26, 0x61, 0x2E, 0x68, 0x72, 0x65, 0x66, 0x3F, 0x30, 0x3A, 0x2D, 0x31, 0x7D, 0x7D, 0x7D, 0x7D, 0x29, 
+    0x2C, 0x6B, 0x2E, 0x68, 0x72, 0x65, 0x66, 0x4E, 0x6F, 0x72, 0x6D, 0x61, 0x6C, 0x69, 0x7A, 0x65, 0x64, 0x7C, 0x7C, 0x6D, 
+    0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x5B, 0x22, 0x68, 0x72, 0x65, 0x66, 0x22, 0x2C, 0x22, 0x73, 0x72, 0x63, 0x22, 0x5D, 
+    0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x70, 0x72, 0x6F, 
+    0x70, 0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x62, 0x5D, 0x3D, 0x7B, 0x67, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x67, 0x65, 0x74, 0x41, 
+    0x74, 0x74, 0x72, 0x69, 0x62, 0x75, 0x74, 0x65, 0x28, 0x62, 0x2C, 0x34, 0x29, 0x7D, 0x7D, 0x7D, 0x29, 0x2C, 0x6B, 0x2E, 
+    0x6F, 0x70, 0x74, 0x53, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x7C, 0x7C, 0x28, 0x6D, 0x2E, 0x70, 0x72, 0x6F, 0x70, 
+    0x48, 0x6F, 0x6F, 0x6B, 0x73, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x3D, 0x7B, 0x67, 0x65, 0x74, 0x3A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x61, 0x2E, 
+    0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x26, 
+    0x26, 0x28, 0x62, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x2C, 0x62, 0x2E, 
+    0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x26, 0x26, 0x62, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 
+    0x4E, 0x6F, 0x64, 0x65, 0x2E, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x49, 0x6E, 0x64, 0x65, 0x78, 0x29, 0x2C, 
+    0x6E, 0x75, 0x6C, 0x6C, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x5B, 0x22, 0x74, 0x61, 0x62, 
+    0x49, 0x6E, 0x64, 0x65, 0x78, 0x22, 0x2C, 0x22, 0x72, 0x65, 0x61, 0x64, 0x4F, 0x6E, 0x6C, 0x79, 0x22, 0x2C, 0x22, 0x6D, 
+    0x61, 0x78, 0x4C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x22, 0x2C, 0x22, 0x63, 0x65, 0x6C, 0x6C, 0x53, 0x70, 0x61, 0x63, 0x69, 
+    0x6E, 0x67, 0x22, 0x2C, 0x22, 0x63, 0x65, 0x6C, 0x6C, 0x50, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x22, 0x2C, 0x22, 0x72, 
+    0x6F, 0x77, 0x53, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x22, 0x63, 0x6F, 0x6C, 0x53, 0x70, 0x61, 0x6E, 0x22, 0x2C, 0x22, 0x75, 
+    0x73, 0x65, 0x4D, 0x61, 0x70, 0x22, 0x2C, 0x22, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x42, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x22, 
+    0x2C, 0x22, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x45, 0x64, 0x69, 0x74, 0x61, 0x62, 0x6C, 0x65, 0x22, 0x5D, 0x2C, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x46, 0x69, 0x78, 
+    0x5B, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x5D, 
+    0x3D, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x29, 0x2C, 0x6B, 0x2E, 0x65, 0x6E, 0x63, 0x74, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x28, 
+    0x6D, 0x2E, 0x70, 0x72, 0x6F, 0x70, 0x46, 0x69, 0x78, 0x2E, 0x65, 0x6E, 0x63, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x65, 
+    0x6E, 0x63, 0x6F, 0x64, 0x69, 0x6E, 0x67, 0x22, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x75, 0x63, 0x3D, 0x2F, 0x5B, 0x5C, 
+    0x74, 0x5C, 0x72, 0x5C, 0x6E, 0x5C, 0x66, 0x5D, 0x2F, 0x67, 0x3B, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 0x74, 0x65, 
+    0x6E, 0x64, 0x28, 0x7B, 0x61, 0x64, 0x64, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 
+    0x2C, 0x68, 0x3D, 0x30, 0x2C, 0x69, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x6A, 
+    0x3D, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x26, 
+    0x26, 0x61, 0x3B, 0x69, 0x66, 0x28, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x6D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2E, 0x61, 
+    0x64, 0x64, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x28, 0x61, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 
+    0x62, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x29, 0x7D, 0x29, 
+    0x3B, 0x69, 0x66, 0x28, 0x6A, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x62, 0x3D, 0x28, 0x61, 0x7C, 0x7C, 0x22, 0x22, 0x29, 0x2E, 
+    0x6D, 0x61, 0x74, 0x63, 0x68, 0x28, 0x45, 0x29, 0x7C, 0x7C, 0x5B, 0x5D, 0x3B, 0x69, 0x3E, 0x68, 0x3B, 0x68, 0x2B, 0x2B, 
+    0x29, 0x69, 0x66, 0x28, 0x63, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x68, 0x5D, 0x2C, 0x64, 0x3D, 0x31, 0x3D, 0x3D, 0x3D, 
+    0x63, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x28, 0x63, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 
+    0x4E, 0x61, 0x6D, 0x65, 0x3F, 0x28, 0x22, 0x20, 0x22, 0x2B, 0x63, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 
+    0x65, 0x2B, 0x22, 0x20, 0x22, 0x29, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x75, 0x63, 0x2C, 0x22, 0x20, 
+    0x22, 0x29, 0x3A, 0x22, 0x20, 0x22, 0x29, 0x29, 0x7B, 0x66, 0x3D, 0x30, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x65, 
+    0x3D, 0x62, 0x5B, 0x66, 0x2B, 0x2B, 0x5D, 0x29, 0x64, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x20, 
+    0x22, 0x2B, 0x65, 0x2B, 0x22, 0x20, 0x22, 0x29, 0x3C, 0x30, 0x26, 0x26, 0x28, 0x64, 0x2B, 0x3D, 0x65, 0x2B, 0x22, 0x20, 
+    0x22, 0x29, 0x3B, 0x67, 0x3D, 0x6D, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x64, 0x29, 0x2C, 0x63, 0x2E, 0x63, 0x6C, 0x61, 
+    0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x21, 0x3D, 0x3D, 0x67, 0x26, 0x26, 0x28, 0x63, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 
+    0x4E, 0x61, 0x6D, 0x65, 0x3D, 0x67, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x7D, 
+    0x2C, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 
+    0x2C, 0x68, 0x3D, 0x30, 0x2C, 0x69, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x6A, 
+    0x3D, 0x30, 0x3D, 0x3D, 0x3D, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 
+    0x68, 0x7C, 0x7C, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 
+    0x61, 0x26, 0x26, 0x61, 0x3B, 0x69, 0x66, 0x28, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 
+    0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x6D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 
+    0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x28, 0x61, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 
+    0x74, 0x68, 0x69, 0x73, 0x2C, 0x62, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 
+    0x65, 0x29, 0x29, 0x7D, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x6A, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x62, 0x3D, 0x28, 0x61, 0x7C, 
+    0x7C, 0x22, 0x22, 0x29, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x28, 0x45, 0x29, 0x7C, 0x7C, 0x5B, 0x5D, 0x3B, 0x69, 0x3E, 
+    0x68, 0x3B, 0x68, 0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x63, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x68, 0x5D, 0x2C, 0x64, 
+    0x3D, 0x31, 0x3D, 0x3D, 0x3D, 0x63, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x28, 0x63, 0x2E, 
+    0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3F, 0x28, 0x22, 0x20, 0x22, 0x2B, 0x63, 0x2E, 0x63, 0x6C, 0x61, 
+    0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x2B, 0x22, 0x20, 0x22, 0x29, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 
+    0x75, 0x63, 0x2C, 0x22, 0x20, 0x22, 0x29, 0x3A, 0x22, 0x22, 0x29, 0x29, 0x7B, 0x66, 0x3D, 0x30, 0x3B, 0x77, 0x68, 0x69, 
+    0x6C, 0x65, 0x28, 0x65, 0x3D, 0x62, 0x5B, 0x66, 0x2B, 0x2B, 0x5D, 0x29, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x64, 0x2E, 
+    0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x20, 0x22, 0x2B, 0x65, 0x2B, 0x22, 0x20, 0x22, 0x29, 0x3E, 0x3D, 
+    0x30, 0x29, 0x64, 0x3D, 0x64, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x22, 0x20, 0x22, 0x2B, 0x65, 0x2B, 
+    0x22, 0x20, 0x22, 0x2C, 0x22, 0x20, 0x22, 0x29, 0x3B, 0x67, 0x3D, 0x61, 0x3F, 0x6D, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 
+    0x64, 0x29, 0x3A, 0x22, 0x22, 0x2C, 0x63, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x21, 0x3D, 0x3D, 
+    0x67, 0x26, 0x26, 0x28, 0x63, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3D, 0x67, 0x29, 0x7D, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x74, 0x6F, 0x67, 0x67, 0x6C, 0x65, 0x43, 0x6C, 
+    0x61, 0x73, 0x73, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x63, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 
+    0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x26, 0x26, 
+    0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x3F, 0x62, 0x3F, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x61, 0x64, 0x64, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x28, 0x61, 0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x72, 0x65, 0x6D, 
+    0x6F, 0x76, 0x65, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x28, 0x61, 0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 
+    0x68, 0x28, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x3F, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x63, 0x29, 0x7B, 0x6D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2E, 0x74, 0x6F, 
+    0x67, 0x67, 0x6C, 0x65, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x28, 0x61, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 0x69, 
+    0x73, 0x2C, 0x63, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x2C, 0x62, 
+    0x29, 0x2C, 0x62, 0x29, 0x7D, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x69, 0x66, 0x28, 
+    0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 
+    0x64, 0x3D, 0x30, 0x2C, 0x65, 0x3D, 0x6D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2C, 0x66, 0x3D, 0x61, 0x2E, 0x6D, 0x61, 
+    0x74, 0x63, 0x68, 0x28, 0x45, 0x29, 0x7C, 0x7C, 0x5B, 0x5D, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x62, 0x3D, 0x66, 
+    0x5B, 0x64, 0x2B, 0x2B, 0x5D, 0x29, 0x65, 0x2E, 0x68, 0x61, 0x73, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x28, 0x62, 0x29, 0x3F, 
+    0x65, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x28, 0x62, 0x29, 0x3A, 0x65, 0x2E, 0x61, 
+    0x64, 0x64, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x28, 0x62, 0x29, 0x7D, 0x65, 0x6C, 0x73, 0x65, 0x28, 0x63, 0x3D, 0x3D, 0x3D, 
+    0x4B, 0x7C, 0x7C, 0x22, 0x62, 0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x29, 0x26, 0x26, 0x28, 
+    0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x26, 0x26, 0x6D, 0x2E, 0x5F, 0x64, 
+    0x61, 0x74, 0x61, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x5F, 0x5F, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 
+    0x65, 0x5F, 0x5F, 0x22, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x29, 
+    0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x3D, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x7C, 0x7C, 0x61, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x3F, 0x22, 
+    0x22, 0x3A, 0x6D, 0x2E, 0x5F, 0x64, 0x61, 0x74, 0x61, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x5F, 0x5F, 0x63, 0x6C, 
+    0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x5F, 0x5F, 0x22, 0x29, 0x7C, 0x7C, 0x22, 0x22, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 
+    0x68, 0x61, 0x73, 0x43, 0x6C, 0x61, 0x73, 0x73, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 
+    0x7B, 0x66, 0x6F, 0x72, 0x28, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x22, 0x20, 0x22, 0x2B, 0x61, 0x2B, 0x22, 0x20, 0x22, 
+    0x2C, 0x63, 0x3D, 0x30, 0x2C, 0x64, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3B, 0x64, 
+    0x3E, 0x63, 0x3B, 0x63, 0x2B, 0x2B, 0x29, 0x69, 0x66, 0x28, 0x31, 0x3D, 0x3D, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x63, 
+    0x5D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x28, 0x22, 0x20, 0x22, 0x2B, 0x74, 0x68, 0x69, 
+    0x73, 0x5B, 0x63, 0x5D, 0x2E, 0x63, 0x6C, 0x61, 0x73, 0x73, 0x4E, 0x61, 0x6D, 0x65, 0x2B, 0x22, 0x20, 0x22, 0x29, 0x2E, 
+    0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x75, 0x63, 0x2C, 0x22, 0x20, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x64, 0x65, 
+    0x78, 0x4F, 0x66, 0x28, 0x62, 0x29, 0x3E, 0x3D, 0x30, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x30, 0x3B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x31, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x22, 0x62, 
+    0x6C, 0x75, 0x72, 0x20, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x20, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x69, 0x6E, 0x20, 0x66, 0x6F, 
+    0x63, 0x75, 0x73, 0x6F, 0x75, 0x74, 0x20, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x72, 0x65, 0x73, 0x69, 0x7A, 0x65, 0x20, 0x73, 
+    0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x20, 0x75, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x20, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x20, 0x64, 
+    0x62, 0x6C, 0x63, 0x6C, 0x69, 0x63, 0x6B, 0x20, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x64, 0x6F, 0x77, 0x6E, 0x20, 0x6D, 0x6F, 
+    0x75, 0x73, 0x65, 0x75, 0x70, 0x20, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x20, 0x6D, 0x6F, 0x75, 0x73, 
+    0x65, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x6F, 0x75, 0x74, 0x20, 0x6D, 0x6F, 0x75, 0x73, 0x65, 
+    0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x6C, 0x65, 0x61, 0x76, 0x65, 0x20, 0x63, 0x68, 0x61, 
+    0x6E, 0x67, 0x65, 0x20, 0x73, 0x65, 0x6C, 0x65, 0x63, 0x74, 0x20, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x20, 0x6B, 0x65, 
+    0x79, 0x64, 0x6F, 0x77, 0x6E, 0x20, 0x6B, 0x65, 0x79, 0x70, 0x72, 0x65, 0x73, 0x73, 0x20, 0x6B, 0x65, 0x79, 0x75, 0x70, 
+    0x20, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x20, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x6D, 0x65, 0x6E, 0x75, 0x22, 0x2E, 
+    0x73, 0x70, 0x6C, 0x69, 0x74, 0x28, 0x22, 0x20, 0x22, 0x29, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x2C, 0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x66, 0x6E, 0x5B, 0x62, 0x5D, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 
+    0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3E, 0x30, 0x3F, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x6E, 
+    0x28, 0x62, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x61, 0x2C, 0x63, 0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x74, 0x72, 
+    0x69, 0x67, 0x67, 0x65, 0x72, 0x28, 0x62, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 0x74, 
+    0x65, 0x6E, 0x64, 0x28, 0x7B, 0x68, 0x6F, 0x76, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6D, 0x6F, 0x75, 
+    0x73, 0x65, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x28, 0x61, 0x29, 0x2E, 0x6D, 0x6F, 0x75, 0x73, 0x65, 0x6C, 0x65, 0x61, 0x76, 
+    0x65, 0x28, 0x62, 0x7C, 0x7C, 0x61, 0x29, 0x7D, 0x2C, 0x62, 0x69, 0x6E, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 
+    0x73, 0x2E, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7D, 0x2C, 0x75, 0x6E, 
+    0x62, 0x69, 0x6E, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x66, 0x66, 0x28, 0x61, 0x2C, 0x6E, 0x75, 0x6C, 
+    0x6C, 0x2C, 0x62, 0x29, 0x7D, 0x2C, 0x64, 0x65, 0x6C, 0x65, 0x67, 0x61, 0x74, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x6E, 0x28, 0x62, 0x2C, 0x61, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7D, 0x2C, 0x75, 0x6E, 
+    0x64, 0x65, 0x6C, 0x65, 0x67, 0x61, 0x74, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 
+    0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x31, 0x3D, 0x3D, 0x3D, 0x61, 0x72, 0x67, 0x75, 
+    0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3F, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x66, 
+    0x66, 0x28, 0x61, 0x2C, 0x22, 0x2A, 0x2A, 0x22, 0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x66, 0x66, 0x28, 0x62, 
+    0x2C, 0x61, 0x7C, 0x7C, 0x22, 0x2A, 0x2A, 0x22, 0x2C, 0x63, 0x29, 0x7D, 0x7D, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x76, 
+    0x63, 0x3D, 0x6D, 0x2E, 0x6E, 0x6F, 0x77, 0x28, 0x29, 0x2C, 0x77, 0x63, 0x3D, 0x2F, 0x5C, 0x3F, 0x2F, 0x2C, 0x78, 0x63, 
+    0x3D, 0x2F, 0x28, 0x2C, 0x29, 0x7C, 0x28, 0x5C, 0x5B, 0x7C, 0x7B, 0x29, 0x7C, 0x28, 0x7D, 0x7C, 0x5D, 0x29, 0x7C, 0x22, 
+    0x28, 0x3F, 0x3A, 0x5B, 0x5E, 0x22, 0x5C, 0x5C, 0x5C, 0x72, 0x5C, 0x6E, 0x5D, 0x7C, 0x5C, 0x5C, 0x5B, 0x22, 0x5C, 0x5C, 
+    0x5C, 0x2F, 0x62, 0x66, 0x6E, 0x72, 0x74, 0x5D, 0x7C, 0x5C, 0x5C, 0x75, 0x5B, 0x5C, 0x64, 0x61, 0x2D, 0x66, 0x41, 0x2D, 
+    0x46, 0x5D, 0x7B, 0x34, 0x7D, 0x29, 0x2A, 0x22, 0x5C, 0x73, 0x2A, 0x3A, 0x3F, 0x7C, 0x74, 0x72, 0x75, 0x65, 0x7C, 0x66, 
+    0x61, 0x6C, 0x73, 0x65, 0x7C, 0x6E, 0x75, 0x6C, 0x6C, 0x7C, 0x2D, 0x3F, 0x28, 0x3F, 0x21, 0x30, 0x5C, 0x64, 0x29, 0x5C, 
+    0x64, 0x2B, 0x28, 0x3F, 0x3A, 0x5C, 0x2E, 0x5C, 0x64, 0x2B, 0x7C, 0x29, 0x28, 0x3F, 0x3A, 0x5B, 0x65, 0x45, 0x5D, 0x5B, 
+    0x2B, 0x2D, 0x5D, 0x3F, 0x5C, 0x64, 0x2B, 0x7C, 0x29, 0x2F, 0x67, 0x3B, 0x6D, 0x2E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x4A, 
+    0x53, 0x4F, 0x4E, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x61, 
+    0x2E, 0x4A, 0x53, 0x4F, 0x4E, 0x26, 0x26, 0x61, 0x2E, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x29, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x4A, 0x53, 0x4F, 0x4E, 0x2E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x28, 
+    0x62, 0x2B, 0x22, 0x22, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x65, 
+    0x3D, 0x6D, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x62, 0x2B, 0x22, 0x22, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x65, 0x26, 0x26, 0x21, 0x6D, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x65, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 
+    0x65, 0x28, 0x78, 0x63, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x65, 0x2C, 
+    0x66, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x26, 0x26, 0x62, 0x26, 0x26, 0x28, 0x64, 0x3D, 0x30, 
+    0x29, 0x2C, 0x30, 0x3D, 0x3D, 0x3D, 0x64, 0x3F, 0x61, 0x3A, 0x28, 0x63, 0x3D, 0x65, 0x7C, 0x7C, 0x62, 0x2C, 0x64, 0x2B, 
+    0x3D, 0x21, 0x66, 0x2D, 0x21, 0x65, 0x2C, 0x22, 0x22, 0x29, 0x7D, 0x29, 0x29, 0x3F, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x22, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x22, 0x2B, 0x65, 0x29, 0x28, 0x29, 0x3A, 0x6D, 0x2E, 
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x49, 0x6E, 0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x4A, 0x53, 0x4F, 0x4E, 0x3A, 
+    0x20, 0x22, 0x2B, 0x62, 0x29, 0x7D, 0x2C, 0x6D, 0x2E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x58, 0x4D, 0x4C, 0x3D, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x3B, 0x69, 0x66, 
+    0x28, 0x21, 0x62, 0x7C, 0x7C, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 
+    0x66, 0x20, 0x62, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3B, 0x74, 0x72, 0x79, 0x7B, 
+    0x61, 0x2E, 0x44, 0x4F, 0x4D, 0x50, 0x61, 0x72, 0x73, 0x65, 0x72, 0x3F, 0x28, 0x64, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x44, 
+    0x4F, 0x4D, 0x50, 0x61, 0x72, 0x73, 0x65, 0x72, 0x2C, 0x63, 0x3D, 0x64, 0x2E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x72, 
+    0x6F, 0x6D, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x28, 0x62, 0x2C, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x78, 0x6D, 0x6C, 
+    0x22, 0x29, 0x29, 0x3A, 0x28, 0x63, 0x3D, 0x6E, 0x65, 0x77, 0x20, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x58, 0x4F, 0x62, 
+    0x6A, 0x65, 0x63, 0x74, 0x28, 0x22, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x2E, 0x58, 0x4D, 0x4C, 0x44, 
+    0x4F, 0x4D, 0x22, 0x29, 0x2C, 0x63, 0x2E, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x3D, 0x22, 0x66, 0x61, 0x6C, 0x73, 0x65, 0x22, 
+    0x2C, 0x63, 0x2E, 0x6C, 0x6F, 0x61, 0x64, 0x58, 0x4D, 0x4C, 0x28, 0x62, 0x29, 0x29, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 
+    0x28, 0x65, 0x29, 0x7B, 0x63, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x63, 0x26, 0x26, 0x63, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 
+    0x26, 0x26, 0x21, 0x63, 0x2E, 0x67, 0x65, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x42, 0x79, 0x54, 0x61, 
+    0x67, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x22, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x22, 0x29, 
+    0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x7C, 0x7C, 0x6D, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x22, 0x49, 0x6E, 
+    0x76, 0x61, 0x6C, 0x69, 0x64, 0x20, 0x58, 0x4D, 0x4C, 0x3A, 0x20, 0x22, 0x2B, 0x62, 0x29, 0x2C, 0x63, 0x7D, 0x3B, 0x76, 
+    0x61, 0x72, 0x20, 0x79, 0x63, 0x2C, 0x7A, 0x63, 0x2C, 0x41, 0x63, 0x3D, 0x2F, 0x23, 0x2E, 0x2A, 0x24, 0x2F, 0x2C, 0x42, 
+    0x63, 0x3D, 0x2F, 0x28, 0x5B, 0x3F, 0x26, 0x5D, 0x29, 0x5F, 0x3D, 0x5B, 0x5E, 0x26, 0x5D, 0x2A, 0x2F, 0x2C, 0x43, 0x63, 
+    0x3D, 0x2F, 0x5E, 0x28, 0x2E, 0x2A, 0x3F, 0x29, 0x3A, 0x5B, 0x20, 0x5C, 0x74, 0x5D, 0x2A, 0x28, 0x5B, 0x5E, 0x5C, 0x72, 
+    0x5C, 0x6E, 0x5D, 0x2A, 0x29, 0x5C, 0x72, 0x3F, 0x24, 0x2F, 0x67, 0x6D, 0x2C, 0x44, 0x63, 0x3D, 0x2F, 0x5E, 0x28, 0x3F, 
+    0x3A, 0x61, 0x62, 0x6F, 0x75, 0x74, 0x7C, 0x61, 0x70, 0x70, 0x7C, 0x61, 0x70, 0x70, 0x2D, 0x73, 0x74, 0x6F, 0x72, 0x61, 
+    0x67, 0x65, 0x7C, 0x2E, 0x2B, 0x2D, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x73, 0x69, 0x6F, 0x6E, 0x7C, 0x66, 0x69, 0x6C, 0x65, 
+    0x7C, 0x72, 0x65, 0x73, 0x7C, 0x77, 0x69, 0x64, 0x67, 0x65, 0x74, 0x29, 0x3A, 0x24, 0x2F, 0x2C, 0x45, 0x63, 0x3D, 0x2F, 
+    0x5E, 0x28, 0x3F, 0x3A, 0x47, 0x45, 0x54, 0x7C, 0x48, 0x45, 0x41, 0x44, 0x29, 0x24, 0x2F, 0x2C, 0x46, 0x63, 0x3D, 0x2F, 
+    0x5E, 0x5C, 0x2F, 0x5C, 0x2F, 0x2F, 0x2C, 0x47, 0x63, 0x3D, 0x2F, 0x5E, 0x28, 0x5B, 0x5C, 0x77, 0x2E, 0x2B, 0x2D, 0x5D, 
+    0x2B, 0x3A, 0x29, 0x28, 0x3F, 0x3A, 0x5C, 0x2F, 0x5C, 0x2F, 0x28, 0x3F, 0x3A, 0x5B, 0x5E, 0x5C, 0x2F, 0x3F, 0x23, 0x5D, 
+    0x2A, 0x40, 0x7C, 0x29, 0x28, 0x5B, 0x5E, 0x5C, 0x2F, 0x3F, 0x23, 0x3A, 0x5D, 0x2A, 0x29, 0x28, 0x3F, 0x3A, 0x3A, 0x28, 
+    0x5C, 0x64, 0x2B, 0x29, 0x7C, 0x29, 0x7C, 0x29, 0x2F, 0x2C, 0x48, 0x63, 0x3D, 0x7B, 0x7D, 0x2C, 0x49, 0x63, 0x3D, 0x7B, 
+    0x7D, 0x2C, 0x4A, 0x63, 0x3D, 0x22, 0x2A, 0x2F, 0x22, 0x2E, 0x63, 0x6F, 0x6E, 0x63, 0x61, 0x74, 0x28, 0x22, 0x2A, 0x22, 
+    0x29, 0x3B, 0x74, 0x72, 0x79, 0x7B, 0x7A, 0x63, 0x3D, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2E, 0x68, 0x72, 
+    0x65, 0x66, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x4B, 0x63, 0x29, 0x7B, 0x7A, 0x63, 0x3D, 0x79, 0x2E, 0x63, 0x72, 
+    0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x22, 0x61, 0x22, 0x29, 0x2C, 0x7A, 0x63, 0x2E, 
+    0x68, 0x72, 0x65, 0x66, 0x3D, 0x22, 0x22, 0x2C, 0x7A, 0x63, 0x3D, 0x7A, 0x63, 0x2E, 0x68, 0x72, 0x65, 0x66, 0x7D, 0x79, 
+    0x63, 0x3D, 0x47, 0x63, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x7A, 0x63, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 
+    0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x29, 0x7C, 0x7C, 0x5B, 0x5D, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x20, 0x4C, 0x63, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 0x74, 0x79, 
+    0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x26, 0x26, 0x28, 0x63, 0x3D, 0x62, 0x2C, 0x62, 0x3D, 0x22, 0x2A, 0x22, 0x29, 0x3B, 
+    0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x3D, 0x30, 0x2C, 0x66, 0x3D, 0x62, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 
+    0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x2E, 0x6D, 0x61, 0x74, 0x63, 0x68, 0x28, 0x45, 0x29, 0x7C, 0x7C, 0x5B, 0x5D, 
+    0x3B, 0x69, 0x66, 0x28, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x63, 0x29, 0x29, 
+    0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x64, 0x3D, 0x66, 0x5B, 0x65, 0x2B, 0x2B, 0x5D, 0x29, 0x22, 0x2B, 0x22, 0x3D, 0x3D, 
+    0x3D, 0x64, 0x2E, 0x63, 0x68, 0x61, 0x72, 0x41, 0x74, 0x28, 0x30, 0x29, 0x3F, 0x28, 0x64, 0x3D, 0x64, 0x2E, 0x73, 0x6C, 
+    0x69, 0x63, 0x65, 0x28, 0x31, 0x29, 0x7C, 0x7C, 0x22, 0x2A, 0x22, 0x2C, 0x28, 0x61, 0x5B, 0x64, 0x5D, 0x3D, 0x61, 0x5B, 
+    0x64, 0x5D, 0x7C, 0x7C, 0x5B, 0x5D, 0x29, 0x2E, 0x75, 0x6E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x63, 0x29, 0x29, 0x3A, 
+    0x28, 0x61, 0x5B, 0x64, 0x5D, 0x3D, 0x61, 0x5B, 0x64, 0x5D, 0x7C, 0x7C, 0x5B, 0x5D, 0x29, 0x2E, 0x70, 0x75, 0x73, 0x68, 
+    0x28, 0x63, 0x29, 0x7D, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x4D, 0x63, 0x28, 0x61, 0x2C, 0x62, 
+    0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x3D, 0x7B, 0x7D, 0x2C, 0x66, 0x3D, 0x61, 0x3D, 0x3D, 
+    0x3D, 0x49, 0x63, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x67, 0x28, 0x68, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x69, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x65, 0x5B, 0x68, 0x5D, 0x3D, 0x21, 0x30, 0x2C, 0x6D, 
+    0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x61, 0x5B, 0x68, 0x5D, 0x7C, 0x7C, 0x5B, 0x5D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x68, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x6A, 0x3D, 0x68, 0x28, 0x62, 0x2C, 0x63, 
+    0x2C, 0x64, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 
+    0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x6A, 0x7C, 0x7C, 0x66, 0x7C, 0x7C, 0x65, 0x5B, 0x6A, 0x5D, 0x3F, 0x66, 0x3F, 
+    0x21, 0x28, 0x69, 0x3D, 0x6A, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3A, 0x28, 0x62, 0x2E, 0x64, 0x61, 0x74, 
+    0x61, 0x54, 0x79, 0x70, 0x65, 0x73, 0x2E, 0x75, 0x6E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x6A, 0x29, 0x2C, 0x67, 0x28, 
+    0x6A, 0x29, 0x2C, 0x21, 0x31, 0x29, 0x7D, 0x29, 0x2C, 0x69, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x67, 0x28, 
+    0x62, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x73, 0x5B, 0x30, 0x5D, 0x29, 0x7C, 0x7C, 0x21, 0x65, 0x5B, 
+    0x22, 0x2A, 0x22, 0x5D, 0x26, 0x26, 0x67, 0x28, 0x22, 0x2A, 0x22, 0x29, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x20, 0x4E, 0x63, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x3D, 
+    0x6D, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x66, 0x6C, 0x61, 0x74, 0x4F, 
+    0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x7C, 0x7C, 0x7B, 0x7D, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x64, 0x20, 0x69, 0x6E, 0x20, 
+    0x62, 0x29, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x62, 0x5B, 0x64, 0x5D, 0x26, 0x26, 0x28, 0x28, 0x65, 
+    0x5B, 0x64, 0x5D, 0x3F, 0x61, 0x3A, 0x63, 0x7C, 0x7C, 0x28, 0x63, 0x3D, 0x7B, 0x7D, 0x29, 0x29, 0x5B, 0x64, 0x5D, 0x3D, 
+    0x62, 0x5B, 0x64, 0x5D, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x26, 0x26, 0x6D, 0x2E, 0x65, 0x78, 
+    0x74, 0x65, 0x6E, 0x64, 0x28, 0x21, 0x30, 0x2C, 0x61, 0x2C, 0x63, 0x29, 0x2C, 0x61, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x20, 0x4F, 0x63, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 
+    0x65, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x3D, 0x61, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73, 0x2C, 0x69, 
+    0x3D, 0x61, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x22, 
+    0x2A, 0x22, 0x3D, 0x3D, 0x3D, 0x69, 0x5B, 0x30, 0x5D, 0x29, 0x69, 0x2E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x29, 0x2C, 
+    0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x65, 0x26, 0x26, 0x28, 0x65, 0x3D, 0x61, 0x2E, 0x6D, 0x69, 0x6D, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x62, 0x2E, 0x67, 0x65, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 
+    0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x28, 0x22, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 0x70, 0x65, 
+    0x22, 0x29, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x65, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x68, 0x29, 
+    0x69, 0x66, 0x28, 0x68, 0x5B, 0x67, 0x5D, 0x26, 0x26, 0x68, 0x5B, 0x67, 0x5D, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x65, 
+    0x29, 0x29, 0x7B, 0x69, 0x2E, 0x75, 0x6E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x67, 0x29, 0x3B, 0x62, 0x72, 0x65, 0x61, 
+    0x6B, 0x7D, 0x69, 0x66, 0x28, 0x69, 0x5B, 0x30, 0x5D, 0x69, 0x6E, 0x20, 0x63, 0x29, 0x66, 0x3D, 0x69, 0x5B, 0x30, 0x5D, 
+    0x3B, 0x65, 0x6C, 0x73, 0x65, 0x7B, 0x66, 0x6F, 0x72, 0x28, 0x67, 0x20, 0x69, 0x6E, 0x20, 0x63, 0x29, 0x7B, 0x69, 0x66, 
+    0x28, 0x21, 0x69, 0x5B, 0x30, 0x5D, 0x7C, 0x7C, 0x61, 0x2E, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x72, 0x73, 
+    0x5B, 0x67, 0x2B, 0x22, 0x20, 0x22, 0x2B, 0x69, 0x5B, 0x30, 0x5D, 0x5D, 0x29, 0x7B, 0x66, 0x3D, 0x67, 0x3B, 0x62, 0x72, 
+    0x65, 0x61, 0x6B, 0x7D, 0x64, 0x7C, 0x7C, 0x28, 0x64, 0x3D, 0x67, 0x29, 0x7D, 0x66, 0x3D, 0x66, 0x7C, 0x7C, 0x64, 0x7D, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x66, 0x3F, 0x28, 0x66, 0x21, 0x3D, 0x3D, 0x69, 0x5B, 0x30, 0x5D, 0x26, 0x26, 
+    0x69, 0x2E, 0x75, 0x6E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x66, 0x29, 0x2C, 0x63, 0x5B, 0x66, 0x5D, 0x29, 0x3A, 0x76, 
+    0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x50, 0x63, 0x28, 0x61, 0x2C, 
+    0x62, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x2C, 0x69, 
+    0x2C, 0x6A, 0x3D, 0x7B, 0x7D, 0x2C, 0x6B, 0x3D, 0x61, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x73, 0x2E, 
+    0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x6B, 0x5B, 0x31, 0x5D, 0x29, 0x66, 0x6F, 0x72, 0x28, 
+    0x67, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x2E, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x72, 0x73, 0x29, 0x6A, 0x5B, 
+    0x67, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x5D, 0x3D, 0x61, 0x2E, 0x63, 
+    0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 0x72, 0x73, 0x5B, 0x67, 0x5D, 0x3B, 0x66, 0x3D, 0x6B, 0x2E, 0x73, 0x68, 0x69, 
+    0x66, 0x74, 0x28, 0x29, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x66, 0x29, 0x69, 0x66, 0x28, 0x61, 0x2E, 0x72, 0x65, 
+    0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x5B, 0x66, 0x5D, 0x26, 0x26, 0x28, 0x63, 0x5B, 
+    0x61, 0x2E, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x5B, 0x66, 0x5D, 0x5D, 
+    0x3D, 0x62, 0x29, 0x2C, 0x21, 0x69, 0x26, 0x26, 0x64, 0x26, 0x26, 0x61, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x46, 0x69, 0x6C, 
+    0x74, 0x65, 0x72, 0x26, 0x26, 0x28, 0x62, 0x3D, 0x61, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x46, 0x69, 0x6C, 0x74, 0x65, 0x72, 
+    0x28, 0x62, 0x2C, 0x61, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x29, 0x29, 0x2C, 0x69, 0x3D, 0x66, 0x2C, 
+    0x66, 0x3D, 0x6B, 0x2E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x29, 0x29, 0x69, 0x66, 0x28, 0x22, 0x2A, 0x22, 0x3D, 0x3D, 
+    0x3D, 0x66, 0x29, 0x66, 0x3D, 0x69, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x69, 0x66, 0x28, 0x22, 0x2A, 0x22, 0x21, 0x3D, 
+    0x3D, 0x69, 0x26, 0x26, 0x69, 0x21, 0x3D, 0x3D, 0x66, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x67, 0x3D, 0x6A, 0x5B, 0x69, 0x2B, 
+    0x22, 0x20, 0x22, 0x2B, 0x66, 0x5D, 0x7C, 0x7C, 0x6A, 0x5B, 0x22, 0x2A, 0x20, 0x22, 0x2B, 0x66, 0x5D, 0x2C, 0x21, 0x67, 
+    0x29, 0x66, 0x6F, 0x72, 0x28, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x6A, 0x29, 0x69, 0x66, 0x28, 0x68, 0x3D, 0x65, 0x2E, 0x73, 
+    0x70, 0x6C, 0x69, 0x74, 0x28, 0x22, 0x20, 0x22, 0x29, 0x2C, 0x68, 0x5B, 0x31, 0x5D, 0x3D, 0x3D, 0x3D, 0x66, 0x26, 0x26, 
+    0x28, 0x67, 0x3D, 0x6A, 0x5B, 0x69, 0x2B, 0x22, 0x20, 0x22, 0x2B, 0x68, 0x5B, 0x30, 0x5D, 0x5D, 0x7C, 0x7C, 0x6A, 0x5B, 
+    0x22, 0x2A, 0x20, 0x22, 0x2B, 0x68, 0x5B, 0x30, 0x5D, 0x5D, 0x29, 0x29, 0x7B, 0x67, 0x3D, 0x3D, 0x3D, 0x21, 0x30, 0x3F, 
+    0x67, 0x3D, 0x6A, 0x5B, 0x65, 0x5D, 0x3A, 0x6A, 0x5B, 0x65, 0x5D, 0x21, 0x3D, 0x3D, 0x21, 0x30, 0x26, 0x26, 0x28, 0x66, 
+    0x3D, 0x68, 0x5B, 0x30, 0x5D, 0x2C, 0x6B, 0x2E, 0x75, 0x6E, 0x73, 0x68, 0x69, 0x66, 0x74, 0x28, 0x68, 0x5B, 0x31, 0x5D, 
+    0x29, 0x29, 0x3B, 0x62, 0x72, 0x65, 0x61, 0x6B, 0x7D, 0x69, 0x66, 0x28, 0x67, 0x21, 0x3D, 0x3D, 0x21, 0x30, 0x29, 0x69, 
+    0x66, 0x28, 0x67, 0x26, 0x26, 0x61, 0x5B, 0x22, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x73, 0x22, 0x5D, 0x29, 0x62, 0x3D, 0x67, 
+    0x28, 0x62, 0x29, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x74, 0x72, 0x79, 0x7B, 0x62, 0x3D, 0x67, 0x28, 0x62, 0x29, 0x7D, 
+    0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x6C, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x7B, 0x73, 0x74, 0x61, 0x74, 
+    0x65, 0x3A, 0x22, 0x70, 0x61, 0x72, 0x73, 0x65, 0x72, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x22, 0x2C, 0x65, 0x72, 0x72, 0x6F, 
+    0x72, 0x3A, 0x67, 0x3F, 0x6C, 0x3A, 0x22, 0x4E, 0x6F, 0x20, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x73, 0x69, 0x6F, 0x6E, 
+    0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x22, 0x2B, 0x69, 0x2B, 0x22, 0x20, 0x74, 0x6F, 0x20, 0x22, 0x2B, 0x66, 0x7D, 0x7D, 
+    0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x7B, 0x73, 0x74, 0x61, 0x74, 0x65, 0x3A, 0x22, 0x73, 0x75, 0x63, 0x63, 0x65, 
+    0x73, 0x73, 0x22, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x62, 0x7D, 0x7D, 0x6D, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 
+    0x28, 0x7B, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x3A, 0x30, 0x2C, 0x6C, 0x61, 0x73, 0x74, 0x4D, 0x6F, 0x64, 0x69, 0x66, 
+    0x69, 0x65, 0x64, 0x3A, 0x7B, 0x7D, 0x2C, 0x65, 0x74, 0x61, 0x67, 0x3A, 0x7B, 0x7D, 0x2C, 0x61, 0x6A, 0x61, 0x78, 0x53, 
+    0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x3A, 0x7B, 0x75, 0x72, 0x6C, 0x3A, 0x7A, 0x63, 0x2C, 0x74, 0x79, 0x70, 0x65, 
+    0x3A, 0x22, 0x47, 0x45, 0x54, 0x22, 0x2C, 0x69, 0x73, 0x4C, 0x6F, 0x63, 0x61, 0x6C, 0x3A, 0x44, 0x63, 0x2E, 0x74, 0x65, 
+    0x73, 0x74, 0x28, 0x79, 0x63, 0x5B, 0x31, 0x5D, 0x29, 0x2C, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x3A, 0x21, 0x30, 0x2C, 
+    0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x44, 0x61, 0x74, 0x61, 0x3A, 0x21, 0x30, 0x2C, 0x61, 0x73, 0x79, 0x6E, 0x63, 
+    0x3A, 0x21, 0x30, 0x2C, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x54, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x61, 0x70, 0x70, 
+    0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x78, 0x2D, 0x77, 0x77, 0x77, 0x2D, 0x66, 0x6F, 0x72, 0x6D, 0x2D, 
+    0x75, 0x72, 0x6C, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x64, 0x3B, 0x20, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3D, 
+    0x55, 0x54, 0x46, 0x2D, 0x38, 0x22, 0x2C, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x73, 0x3A, 0x7B, 0x22, 0x2A, 0x22, 0x3A, 
+    0x4A, 0x63, 0x2C, 0x74, 0x65, 0x78, 0x74, 0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x70, 0x6C, 0x61, 0x69, 0x6E, 0x22, 
+    0x2C, 0x68, 0x74, 0x6D, 0x6C, 0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x68, 0x74, 0x6D, 0x6C, 0x22, 0x2C, 0x78, 0x6D, 
+    0x6C, 0x3A, 0x22, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x78, 0x6D, 0x6C, 0x2C, 0x20, 
+    0x74, 0x65, 0x78, 0x74, 0x2F, 0x78, 0x6D, 0x6C, 0x22, 0x2C, 0x6A, 0x73, 0x6F, 0x6E, 0x3A, 0x22, 0x61, 0x70, 0x70, 0x6C, 
+    0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x2C, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 
+    0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x7D, 0x2C, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73, 
+    0x3A, 0x7B, 0x78, 0x6D, 0x6C, 0x3A, 0x2F, 0x78, 0x6D, 0x6C, 0x2F, 0x2C, 0x68, 0x74, 0x6D, 0x6C, 0x3A, 0x2F, 0x68, 0x74, 
+    0x6D, 0x6C, 0x2F, 0x2C, 0x6A, 0x73, 0x6F, 0x6E, 0x3A, 0x2F, 0x6A, 0x73, 0x6F, 0x6E, 0x2F, 0x7D, 0x2C, 0x72, 0x65, 0x73, 
+    0x70, 0x6F, 0x6E, 0x73, 0x65, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x3A, 0x7B, 0x78, 0x6D, 0x6C, 0x3A, 0x22, 0x72, 0x65, 
+    0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x58, 0x4D, 0x4C, 0x22, 0x2C, 0x74, 0x65, 0x78, 0x74, 0x3A, 0x22, 0x72, 0x65, 0x73, 
+    0x70, 0x6F, 0x6E, 0x73, 0x65, 0x54, 0x65, 0x78, 0x74, 0x22, 0x2C, 0x6A, 0x73, 0x6F, 0x6E, 0x3A, 0x22, 0x72, 0x65, 0x73, 
+    0x70, 0x6F, 0x6E, 0x73, 0x65, 0x4A, 0x53, 0x4F, 0x4E, 0x22, 0x7D, 0x2C, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 0x74, 0x65, 
+    0x72, 0x73, 0x3A, 0x7B, 0x22, 0x2A, 0x20, 0x74, 0x65, 0x78, 0x74, 0x22, 0x3A, 0x53, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x2C, 
+    0x22, 0x74, 0x65, 0x78, 0x74, 0x20, 0x68, 0x74, 0x6D, 0x6C, 0x22, 0x3A, 0x21, 0x30, 0x2C, 0x22, 0x74, 0x65, 0x78, 0x74, 
+    0x20, 0x6A, 0x73, 0x6F, 0x6E, 0x22, 0x3A, 0x6D, 0x2E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x4A, 0x53, 0x4F, 0x4E, 0x2C, 0x22, 
+    0x74, 0x65, 0x78, 0x74, 0x20, 0x78, 0x6D, 0x6C, 0x22, 0x3A, 0x6D, 0x2E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x58, 0x4D, 0x4C, 
+    0x7D, 0x2C, 0x66, 0x6C, 0x61, 0x74, 0x4F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x3A, 0x7B, 0x75, 0x72, 0x6C, 0x3A, 0x21, 
+    0x30, 0x2C, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x3A, 0x21, 0x30, 0x7D, 0x7D, 0x2C, 0x61, 0x6A, 0x61, 0x78, 0x53, 
+    0x65, 0x74, 0x75, 0x70, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x3F, 0x4E, 0x63, 0x28, 0x4E, 0x63, 0x28, 0x61, 0x2C, 0x6D, 0x2E, 0x61, 0x6A, 
+    0x61, 0x78, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x29, 0x2C, 0x62, 0x29, 0x3A, 0x4E, 0x63, 0x28, 0x6D, 0x2E, 
+    0x61, 0x6A, 0x61, 0x78, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2C, 0x61, 0x29, 0x7D, 0x2C, 0x61, 0x6A, 0x61, 
+    0x78, 0x50, 0x72, 0x65, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x3A, 0x4C, 0x63, 0x28, 0x48, 0x63, 0x29, 0x2C, 0x61, 0x6A, 
+    0x61, 0x78, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x6F, 0x72, 0x74, 0x3A, 0x4C, 0x63, 0x28, 0x49, 0x63, 0x29, 0x2C, 0x61, 
+    0x6A, 0x61, 0x78, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x22, 0x6F, 
+    0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x61, 0x26, 0x26, 0x28, 0x62, 
+    0x3D, 0x61, 0x2C, 0x61, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x29, 0x2C, 0x62, 0x3D, 0x62, 0x7C, 0x7C, 0x7B, 0x7D, 
+    0x3B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x2C, 0x69, 0x2C, 0x6A, 
+    0x2C, 0x6B, 0x3D, 0x6D, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x53, 0x65, 0x74, 0x75, 0x70, 0x28, 0x7B, 0x7D, 0x2C, 0x62, 0x29, 
+    0x2C, 0x6C, 0x3D, 0x6B, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x7C, 0x7C, 0x6B, 0x2C, 0x6E, 0x3D, 0x6B, 0x2E, 
+    0x63, 0x6F, 0x6E, 0x74, 0x65, 0x78, 0x74, 0x26, 0x26, 0x28, 0x6C, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 
+    0x7C, 0x7C, 0x6C, 0x2E, 0x6A, 0x71, 0x75, 0x65, 0x72, 0x79, 0x29, 0x3F, 0x6D, 0x28, 0x6C, 0x29, 0x3A, 0x6D, 0x2E, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x2C, 0x6F, 0x3D, 0x6D, 0x2E, 0x44, 0x65, 0x66, 0x65, 0x72, 0x72, 0x65, 0x64, 0x28, 0x29, 0x2C, 
+    0x70, 0x3D, 0x6D, 0x2E, 0x43, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x73, 0x28, 0x22, 0x6F, 0x6E, 0x63, 0x65, 0x20, 
+    0x6D, 0x65, 0x6D, 0x6F, 0x72, 0x79, 0x22, 0x29, 0x2C, 0x71, 0x3D, 0x6B, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x43, 
+    0x6F, 0x64, 0x65, 0x7C, 0x7C, 0x7B, 0x7D, 0x2C, 0x72, 0x3D, 0x7B, 0x7D, 0x2C, 0x73, 0x3D, 0x7B, 0x7D, 0x2C, 0x74, 0x3D, 
+    0x30, 0x2C, 0x75, 0x3D, 0x22, 0x63, 0x61, 0x6E, 0x63, 0x65, 0x6C, 0x65, 0x64, 0x22, 0x2C, 0x76, 0x3D, 0x7B, 0x72, 0x65, 
+    0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x3A, 0x30, 0x2C, 0x67, 0x65, 0x74, 0x52, 0x65, 0x73, 0x70, 0x6F, 0x6E, 
+    0x73, 0x65, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 
+    0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3B, 0x69, 0x66, 0x28, 0x32, 0x3D, 0x3D, 0x3D, 0x74, 0x29, 0x7B, 0x69, 0x66, 0x28, 
+    0x21, 0x6A, 0x29, 0x7B, 0x6A, 0x3D, 0x7B, 0x7D, 0x3B, 0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x62, 0x3D, 0x43, 0x63, 0x2E, 
+    0x65, 0x78, 0x65, 0x63, 0x28, 0x66, 0x29, 0x29, 0x6A, 0x5B, 0x62, 0x5B, 0x31, 0x5D, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 
+    0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x5D, 0x3D, 0x62, 0x5B, 0x32, 0x5D, 0x7D, 0x62, 0x3D, 0x6A, 0x5B, 0x61, 
+    0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x5D, 0x7D, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x62, 0x3F, 0x6E, 0x75, 0x6C, 0x6C, 0x3A, 0x62, 0x7D, 0x2C, 0x67, 
+    0x65, 0x74, 0x41, 0x6C, 0x6C, 0x52, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 
+    0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x32, 
+    0x3D, 0x3D, 0x3D, 0x74, 0x3F, 0x66, 0x3A, 0x6E, 0x75, 0x6C, 0x6C, 0x7D, 0x2C, 0x73, 0x65, 0x74, 0x52, 0x65, 0x71, 0x75, 
+    0x65, 0x73, 0x74, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x61, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 
+    0x61, 0x73, 0x65, 0x28, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x7C, 0x7C, 0x28, 0x61, 0x3D, 0x73, 
+    0x5B, 0x63, 0x5D, 0x3D, 0x73, 0x5B, 0x63, 0x5D, 0x7C, 0x7C, 0x61, 0x2C, 0x72, 0x5B, 0x61, 0x5D, 0x3D, 0x62, 0x29, 0x2C, 
+    0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x6F, 0x76, 0x65, 0x72, 0x72, 0x69, 0x64, 0x65, 0x4D, 0x69, 0x6D, 0x65, 0x54, 0x79, 
+    0x70, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 
+    0x6E, 0x20, 0x74, 0x7C, 0x7C, 0x28, 0x6B, 0x2E, 0x6D, 0x69, 0x6D, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3D, 0x61, 0x29, 0x2C, 
+    0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x43, 0x6F, 0x64, 0x65, 0x3A, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3B, 0x69, 0x66, 0x28, 0x61, 0x29, 
+    0x69, 0x66, 0x28, 0x32, 0x3E, 0x74, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x62, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x29, 0x71, 0x5B, 
+    0x62, 0x5D, 0x3D, 0x5B, 0x71, 0x5B, 0x62, 0x5D, 0x2C, 0x61, 0x5B, 0x62, 0x5D, 0x5D, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x20, 
+    0x76, 0x2E, 0x61, 0x6C, 0x77, 0x61, 0x79, 0x73, 0x28, 0x61, 0x5B, 0x76, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x5D, 
+    0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x61, 0x62, 0x6F, 0x72, 0x74, 
+    0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x61, 
+    0x7C, 0x7C, 0x75, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x69, 0x26, 0x26, 0x69, 0x2E, 0x61, 0x62, 0x6F, 0x72, 
+    0x74, 0x28, 0x62, 0x29, 0x2C, 0x78, 0x28, 0x30, 0x2C, 0x62, 0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x7D, 0x3B, 0x69, 
+    0x66, 0x28, 0x6F, 0x2E, 0x70, 0x72, 0x6F, 0x6D, 0x69, 0x73, 0x65, 0x28, 0x76, 0x29, 0x2E, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 
+    0x65, 0x74, 0x65, 0x3D, 0x70, 0x2E, 0x61, 0x64, 0x64, 0x2C, 0x76, 0x2E, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3D, 
+    0x76, 0x2E, 0x64, 0x6F, 0x6E, 0x65, 0x2C, 0x76, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3D, 0x76, 0x2E, 0x66, 0x61, 0x69, 
+    0x6C, 0x2C, 0x6B, 0x2E, 0x75, 0x72, 0x6C, 0x3D, 0x28, 0x28, 0x61, 0x7C, 0x7C, 0x6B, 0x2E, 0x75, 0x72, 0x6C, 0x7C, 0x7C, 
+    0x7A, 0x63, 0x29, 0x2B, 0x22, 0x22, 0x29, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x41, 0x63, 0x2C, 0x22, 
+    0x22, 0x29, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x46, 0x63, 0x2C, 0x79, 0x63, 0x5B, 0x31, 0x5D, 0x2B, 
+    0x22, 0x2F, 0x2F, 0x22, 0x29, 0x2C, 0x6B, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x62, 0x2E, 0x6D, 0x65, 0x74, 0x68, 0x6F, 
+    0x64, 0x7C, 0x7C, 0x62, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x6B, 0x2E, 0x6D, 0x65, 0x74, 0x68, 0x6F, 0x64, 0x7C, 
+    0x7C, 0x6B, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x2C, 0x6B, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x73, 0x3D, 
+    0x6D, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x6B, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x22, 
+    0x2A, 0x22, 0x29, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x2E, 0x6D, 0x61, 
+    0x74, 0x63, 0x68, 0x28, 0x45, 0x29, 0x7C, 0x7C, 0x5B, 0x22, 0x22, 0x5D, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x6B, 
+    0x2E, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x26, 0x26, 0x28, 0x63, 0x3D, 0x47, 0x63, 0x2E, 
+    0x65, 0x78, 0x65, 0x63, 0x28, 0x6B, 0x2E, 0x75, 0x72, 0x6C, 0x2E, 0x74, 0x6F, 0x4C, 0x6F, 0x77, 0x65, 0x72, 0x43, 0x61, 
+    0x73, 0x65, 0x28, 0x29, 0x29, 0x2C, 0x6B, 0x2E, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x3D, 
+    0x21, 0x28, 0x21, 0x63, 0x7C, 0x7C, 0x63, 0x5B, 0x31, 0x5D, 0x3D, 0x3D, 0x3D, 0x79, 0x63, 0x5B, 0x31, 0x5D, 0x26, 0x26, 
+    0x63, 0x5B, 0x32, 0x5D, 0x3D, 0x3D, 0x3D, 0x79, 0x63, 0x5B, 0x32, 0x5D, 0x26, 0x26, 0x28, 0x63, 0x5B, 0x33, 0x5D, 0x7C, 
+    0x7C, 0x28, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x22, 0x3D, 0x3D, 0x3D, 0x63, 0x5B, 0x31, 0x5D, 0x3F, 0x22, 0x38, 0x30, 
+    0x22, 0x3A, 0x22, 0x34, 0x34, 0x33, 0x22, 0x29, 0x29, 0x3D, 0x3D, 0x3D, 0x28, 0x79, 0x63, 0x5B, 0x33, 0x5D, 0x7C, 0x7C, 
+    0x28, 0x22, 0x68, 0x74, 0x74, 0x70, 0x3A, 0x22, 0x3D, 0x3D, 0x3D, 0x79, 0x63, 0x5B, 0x31, 0x5D, 0x3F, 0x22, 0x38, 0x30, 
+    0x22, 0x3A, 0x22, 0x34, 0x34, 0x33, 0x22, 0x29, 0x29, 0x29, 0x29, 0x2C, 0x6B, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x26, 0x26, 
+    0x6B, 0x2E, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x44, 0x61, 0x74, 0x61, 0x26, 0x26, 0x22, 0x73, 0x74, 0x72, 0x69, 
+    0x6E, 0x67, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x6B, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x26, 0x26, 
+    0x28, 0x6B, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x3D, 0x6D, 0x2E, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x28, 0x6B, 0x2E, 0x64, 0x61, 
+    0x74, 0x61, 0x2C, 0x6B, 0x2E, 0x74, 0x72, 0x61, 0x64, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x61, 0x6C, 0x29, 0x29, 0x2C, 0x4D, 
+    0x63, 0x28, 0x48, 0x63, 0x2C, 0x6B, 0x2C, 0x62, 0x2C, 0x76, 0x29, 0x2C, 0x32, 0x3D, 0x3D, 0x3D, 0x74, 0x29, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x3B, 0x68, 0x3D, 0x6B, 0x2E, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x2C, 0x68, 0x26, 
+    0x26, 0x30, 0x3D, 0x3D, 0x3D, 0x6D, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x2B, 0x2B, 0x26, 0x26, 0x6D, 0x2E, 0x65, 
+    0x76, 0x65, 0x6E, 0x74, 0x2E, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x28, 0x22, 0x61, 0x6A, 0x61, 0x78, 0x53, 0x74, 
+    0x61, 0x72, 0x74, 0x22, 0x29, 0x2C, 0x6B, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x6B, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x2E, 
+    0x74, 0x6F, 0x55, 0x70, 0x70, 0x65, 0x72, 0x43, 0x61, 0x73, 0x65, 0x28, 0x29, 0x2C, 0x6B, 0x2E, 0x68, 0x61, 0x73, 0x43, 
+    0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3D, 0x21, 0x45, 0x63, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x6B, 0x2E, 0x74, 0x79, 
+    0x70, 0x65, 0x29, 0x2C, 0x65, 0x3D, 0x6B, 0x2E, 0x75, 0x72, 0x6C, 0x2C, 0x6B, 0x2E, 0x68, 0x61, 0x73, 0x43, 0x6F, 0x6E, 
+    0x74, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x28, 0x6B, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x26, 0x26, 0x28, 0x65, 0x3D, 0x6B, 0x2E, 
+    0x75, 0x72, 0x6C, 0x2B, 0x3D, 0x28, 0x77, 0x63, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x65, 0x29, 0x3F, 0x22, 0x26, 0x22, 
+    0x3A, 0x22, 0x3F, 0x22, 0x29, 0x2B, 0x6B, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x2C, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x20, 
+    0x6B, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x29, 0x2C, 0x6B, 0x2E, 0x63, 0x61, 0x63, 0x68, 0x65, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 
+    0x26, 0x26, 0x28, 0x6B, 0x2E, 0x75, 0x72, 0x6C, 0x3D, 0x42, 0x63, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x65, 0x29, 0x3F, 
+    0x65, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x42, 0x63, 0x2C, 0x22, 0x24, 0x31, 0x5F, 0x3D, 0x22, 0x2B, 
+    0x76, 0x63, 0x2B, 0x2B, 0x29, 0x3A, 0x65, 0x2B, 0x28, 0x77, 0x63, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x65, 0x29, 0x3F, 
+    0x22, 0x26, 0x22, 0x3A, 0x22, 0x3F, 0x22, 0x29, 0x2B, 0x22, 0x5F, 0x3D, 0x22, 0x2B, 0x76, 0x63, 0x2B, 0x2B, 0x29, 0x29, 
+    0x2C, 0x6B, 0x2E, 0x69, 0x66, 0x4D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x26, 0x26, 0x28, 0x6D, 0x2E, 0x6C, 0x61, 
+    0x73, 0x74, 0x4D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x5B, 0x65, 0x5D, 0x26, 0x26, 0x76, 0x2E, 0x73, 0x65, 0x74, 
+    0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x28, 0x22, 0x49, 0x66, 0x2D, 0x4D, 0x6F, 
+    0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x2D, 0x53, 0x69, 0x6E, 0x63, 0x65, 0x22, 0x2C, 0x6D, 0x2E, 0x6C, 0x61, 0x73, 0x74, 
+    0x4D, 0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x5B, 0x65, 0x5D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x74, 0x61, 0x67, 0x5B, 
+    0x65, 0x5D, 0x26, 0x26, 0x76, 0x2E, 0x73, 0x65, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x48, 0x65, 0x61, 0x64, 
+    0x65, 0x72, 0x28, 0x22, 0x49, 0x66, 0x2D, 0x4E, 0x6F, 0x6E, 0x65, 0x2D, 0x4D, 0x61, 0x74, 0x63, 0x68, 0x22, 0x2C, 0x6D, 
+    0x2E, 0x65, 0x74, 0x61, 0x67, 0x5B, 0x65, 0x5D, 0x29, 0x29, 0x2C, 0x28, 0x6B, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x26, 0x26, 
+    0x6B, 0x2E, 0x68, 0x61, 0x73, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x26, 0x26, 0x6B, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 
+    0x65, 0x6E, 0x74, 0x54, 0x79, 0x70, 0x65, 0x21, 0x3D, 0x3D, 0x21, 0x31, 0x7C, 0x7C, 0x62, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 
+    0x65, 0x6E, 0x74, 0x54, 0x79, 0x70, 0x65, 0x29, 0x26, 0x26, 0x76, 0x2E, 0x73, 0x65, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 
+    0x73, 0x74, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x28, 0x22, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x2D, 0x54, 0x79, 
+    0x70, 0x65, 0x22, 0x2C, 0x6B, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x54, 0x79, 0x70, 0x65, 0x29, 0x2C, 0x76, 
+    0x2E, 0x73, 0x65, 0x74, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x28, 0x22, 0x41, 
+    0x63, 0x63, 0x65, 0x70, 0x74, 0x22, 0x2C, 0x6B, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x73, 0x5B, 0x30, 
+    0x5D, 0x26, 0x26, 0x6B, 0x2E, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x73, 0x5B, 0x6B, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x54, 
+    0x79, 0x70, 0x65, 0x73, 0x5B, 0x30, 0x5D, 0x5D, 0x3F, 0x6B, 0x2E, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x73, 0x5B, 0x6B, 
+    0x2E, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x73, 0x5B, 0x30, 0x5D, 0x5D, 0x2B, 0x28, 0x22, 0x2A, 0x22, 0x21, 
+    0x3D, 0x3D, 0x6B, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x73, 0x5B, 0x30, 0x5D, 0x3F, 0x22, 0x2C, 0x20, 
+    0x22, 0x2B, 0x4A, 0x63, 0x2B, 0x22, 0x3B, 0x20, 0x71, 0x3D, 0x30, 0x2E, 0x30, 0x31, 0x22, 0x3A, 0x22, 0x22, 0x29, 0x3A, 
+    0x6B, 0x2E, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x73, 0x5B, 0x22, 0x2A, 0x22, 0x5D, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 
+    0x64, 0x20, 0x69, 0x6E, 0x20, 0x6B, 0x2E, 0x68, 0x65, 0x61, 0x64, 0x65, 0x72, 0x73, 0x29, 0x76, 0x2E, 0x73, 0x65, 0x74, 
+    0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x28, 0x64, 0x2C, 0x6B, 0x2E, 0x68, 0x65, 
+    0x61, 0x64, 0x65, 0x72, 0x73, 0x5B, 0x64, 0x5D, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x6B, 0x2E, 0x62, 0x65, 0x66, 0x6F, 0x72, 
+    0x65, 0x53, 0x65, 0x6E, 0x64, 0x26, 0x26, 0x28, 0x6B, 0x2E, 0x62, 0x65, 0x66, 0x6F, 0x72, 0x65, 0x53, 0x65, 0x6E, 0x64, 
+    0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x6C, 0x2C, 0x76, 0x2C, 0x6B, 0x29, 0x3D, 0x3D, 0x3D, 0x21, 0x31, 0x7C, 0x7C, 0x32, 
+    0x3D, 0x3D, 0x3D, 0x74, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x2E, 0x61, 0x62, 0x6F, 0x72, 0x74, 
+    0x28, 0x29, 0x3B, 0x75, 0x3D, 0x22, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x22, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x64, 0x20, 0x69, 
+    0x6E, 0x7B, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3A, 0x31, 0x2C, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x3A, 0x31, 0x2C, 
+    0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x3A, 0x31, 0x7D, 0x29, 0x76, 0x5B, 0x64, 0x5D, 0x28, 0x6B, 0x5B, 0x64, 
+    0x5D, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x69, 0x3D, 0x4D, 0x63, 0x28, 0x49, 0x63, 0x2C, 0x6B, 0x2C, 0x62, 0x2C, 0x76, 0x29, 
+    0x29, 0x7B, 0x76, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x3D, 0x31, 0x2C, 0x68, 0x26, 0x26, 
+    0x6E, 0x2E, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x28, 0x22, 0x61, 0x6A, 0x61, 0x78, 0x53, 0x65, 0x6E, 0x64, 0x22, 
+    0x2C, 0x5B, 0x76, 0x2C, 0x6B, 0x5D, 0x29, 0x2C, 0x6B, 0x2E, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x26, 0x26, 0x6B, 0x2E, 0x74, 
+    0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x3E, 0x30, 0x26, 0x26, 0x28, 0x67, 0x3D, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 
+    0x6F, 0x75, 0x74, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x2E, 0x61, 0x62, 0x6F, 
+    0x72, 0x74, 0x28, 0x22, 0x74, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x22, 0x29, 0x7D, 0x2C, 0x6B, 0x2E, 0x74, 0x69, 0x6D, 
+    0x65, 0x6F, 0x75, 0x74, 0x29, 0x29, 0x3B, 0x74, 0x72, 0x79, 0x7B, 0x74, 0x3D, 0x31, 0x2C, 0x69, 0x2E, 0x73, 0x65, 0x6E, 
+    0x64, 0x28, 0x72, 0x2C, 0x78, 0x29, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x77, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x21, 
+    0x28, 0x32, 0x3E, 0x74, 0x29, 0x29, 0x74, 0x68, 0x72, 0x6F, 0x77, 0x20, 0x77, 0x3B, 0x78, 0x28, 0x2D, 0x31, 0x2C, 0x77, 
+    0x29, 0x7D, 0x7D, 0x65, 0x6C, 0x73, 0x65, 0x20, 0x78, 0x28, 0x2D, 0x31, 0x2C, 0x22, 0x4E, 0x6F, 0x20, 0x54, 0x72, 0x61, 
+    0x6E, 0x73, 0x70, 0x6F, 0x72, 0x74, 0x22, 0x29, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x78, 0x28, 
+    0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x6A, 0x2C, 0x72, 0x2C, 0x73, 0x2C, 0x75, 
+    0x2C, 0x77, 0x2C, 0x78, 0x3D, 0x62, 0x3B, 0x32, 0x21, 0x3D, 0x3D, 0x74, 0x26, 0x26, 0x28, 0x74, 0x3D, 0x32, 0x2C, 0x67, 
+    0x26, 0x26, 0x63, 0x6C, 0x65, 0x61, 0x72, 0x54, 0x69, 0x6D, 0x65, 0x6F, 0x75, 0x74, 0x28, 0x67, 0x29, 0x2C, 0x69, 0x3D, 
+    0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x66, 0x3D, 0x64, 0x7C, 0x7C, 0x22, 0x22, 0x2C, 0x76, 0x2E, 0x72, 0x65, 0x61, 
+    0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x3D, 0x61, 0x3E, 0x30, 0x3F, 0x34, 0x3A, 0x30, 0x2C, 0x6A, 0x3D, 0x61, 0x3E, 
+    0x3D, 0x32, 0x30, 0x30, 0x26, 0x26, 0x33, 0x30, 0x30, 0x3E, 0x61, 0x7C, 0x7C, 0x33, 0x30, 0x34, 0x3D, 0x3D, 0x3D, 0x61, 
+    0x2C, 0x63, 0x26, 0x26, 0x28, 0x75, 0x3D, 0x4F, 0x63, 0x28, 0x6B, 0x2C, 0x76, 0x2C, 0x63, 0x29, 0x29, 0x2C, 0x75, 0x3D, 
+    0x50, 0x63, 0x28, 0x6B, 0x2C, 0x75, 0x2C, 0x76, 0x2C, 0x6A, 0x29, 0x2C, 0x6A, 0x3F, 0x28, 0x6B, 0x2E, 0x69, 0x66, 0x4D, 
+    0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x26, 0x26, 0x28, 0x77, 0x3D, 0x76, 0x2E, 0x67, 0x65, 0x74, 0x52, 0x65, 0x73, 
+    0x70, 0x6F, 0x6E, 0x73, 0x65, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x28, 0x22, 0x4C, 0x61, 0x73, 0x74, 0x2D, 0x4D, 0x6F, 
+    0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x22, 0x29, 0x2C, 0x77, 0x26, 0x26, 0x28, 0x6D, 0x2E, 0x6C, 0x61, 0x73, 0x74, 0x4D, 
+    0x6F, 0x64, 0x69, 0x66, 0x69, 0x65, 0x64, 0x5B, 0x65, 0x5D, 0x3D, 0x77, 0x29, 0x2C, 0x77, 0x3D, 0x76, 0x2E, 0x67, 0x65, 
+    0x74, 0x52, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x28, 0x22, 0x65, 0x74, 0x61, 
+    0x67, 0x22, 0x29, 0x2C, 0x77, 0x26, 0x26, 0x28, 0x6D, 0x2E, 0x65, 0x74, 0x61, 0x67, 0x5B, 0x65, 0x5D, 0x3D, 0x77, 0x29, 
+    0x29, 0x2C, 0x32, 0x30, 0x34, 0x3D, 0x3D, 0x3D, 0x61, 0x7C, 0x7C, 0x22, 0x48, 0x45, 0x41, 0x44, 0x22, 0x3D, 0x3D, 0x3D, 
+    0x6B, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x3F, 0x78, 0x3D, 0x22, 0x6E, 0x6F, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x22, 
+    0x3A, 0x33, 0x30, 0x34, 0x3D, 0x3D, 0x3D, 0x61, 0x3F, 0x78, 0x3D, 0x22, 0x6E, 0x6F, 0x74, 0x6D, 0x6F, 0x64, 0x69, 0x66, 
+    0x69, 0x65, 0x64, 0x22, 0x3A, 0x28, 0x78, 0x3D, 0x75, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x65, 0x2C, 0x72, 0x3D, 0x75, 0x2E, 
+    0x64, 0x61, 0x74, 0x61, 0x2C, 0x73, 0x3D, 0x75, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x2C, 0x6A, 0x3D, 0x21, 0x73, 0x29, 
+    0x29, 0x3A, 0x28, 0x73, 0x3D, 0x78, 0x2C, 0x28, 0x61, 0x7C, 0x7C, 0x21, 0x78, 0x29, 0x26, 0x26, 0x28, 0x78, 0x3D, 0x22, 
+    0x65, 0x72, 0x72, 0x6F, 0x72, 0x22, 0x2C, 0x30, 0x3E, 0x61, 0x26, 0x26, 0x28, 0x61, 0x3D, 0x30, 0x29, 0x29, 0x29, 0x2C, 
+    0x76, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x3D, 0x61, 0x2C, 0x76, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x54, 
+    0x65, 0x78, 0x74, 0x3D, 0x28, 0x62, 0x7C, 0x7C, 0x78, 0x29, 0x2B, 0x22, 0x22, 0x2C, 0x6A, 0x3F, 0x6F, 0x2E, 0x72, 0x65, 
+    0x73, 0x6F, 0x6C, 0x76, 0x65, 0x57, 0x69, 0x74, 0x68, 0x28, 0x6C, 0x2C, 0x5B, 0x72, 0x2C, 0x78, 0x2C, 0x76, 0x5D, 0x29, 
+    0x3A, 0x6F, 0x2E, 0x72, 0x65, 0x6A, 0x65, 0x63, 0x74, 0x57, 0x69, 0x74, 0x68, 0x28, 0x6C, 0x2C, 0x5B, 0x76, 0x2C, 0x78, 
+    0x2C, 0x73, 0x5D, 0x29, 0x2C, 0x76, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x43, 0x6F, 0x64, 0x65, 0x28, 0x71, 0x29, 
+    0x2C, 0x71, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x68, 0x26, 0x26, 0x6E, 0x2E, 0x74, 0x72, 0x69, 0x67, 0x67, 
+    0x65, 0x72, 0x28, 0x6A, 0x3F, 0x22, 0x61, 0x6A, 0x61, 0x78, 0x53, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x22, 0x3A, 0x22, 
+    0x61, 0x6A, 0x61, 0x78, 0x45, 0x72, 0x72, 0x6F, 0x72, 0x22, 0x2C, 0x5B, 0x76, 0x2C, 0x6B, 0x2C, 0x6A, 0x3F, 0x72, 0x3A, 
+    0x73, 0x5D, 0x29, 0x2C, 0x70, 0x2E, 0x66, 0x69, 0x72, 0x65, 0x57, 0x69, 0x74, 0x68, 0x28, 0x6C, 0x2C, 0x5B, 0x76, 0x2C, 
+    0x78, 0x5D, 0x29, 0x2C, 0x68, 0x26, 0x26, 0x28, 0x6E, 0x2E, 0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x28, 0x22, 0x61, 
+    0x6A, 0x61, 0x78, 0x43, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x22, 0x2C, 0x5B, 0x76, 0x2C, 0x6B, 0x5D, 0x29, 0x2C, 
+    0x2D, 0x2D, 0x6D, 0x2E, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x7C, 0x7C, 0x6D, 0x2E, 0x65, 0x76, 0x65, 0x6E, 0x74, 0x2E, 
+    0x74, 0x72, 0x69, 0x67, 0x67, 0x65, 0x72, 0x28, 0x22, 0x61, 0x6A, 0x61, 0x78, 0x53, 0x74, 0x6F, 0x70, 0x22, 0x29, 0x29, 
+    0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x7D, 0x2C, 0x67, 0x65, 0x74, 0x4A, 0x53, 0x4F, 0x4E, 0x3A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x67, 0x65, 0x74, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x2C, 0x22, 0x6A, 0x73, 0x6F, 0x6E, 
+    0x22, 0x29, 0x7D, 0x2C, 0x67, 0x65, 0x74, 0x53, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x67, 0x65, 0x74, 
+    0x28, 0x61, 0x2C, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x62, 0x2C, 0x22, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 
+    0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x5B, 0x22, 0x67, 0x65, 0x74, 0x22, 0x2C, 0x22, 
+    0x70, 0x6F, 0x73, 0x74, 0x22, 0x5D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 
+    0x7B, 0x6D, 0x5B, 0x62, 0x5D, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x63, 0x2C, 0x64, 
+    0x2C, 0x65, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x63, 0x29, 0x26, 0x26, 0x28, 0x65, 0x3D, 0x65, 0x7C, 0x7C, 0x64, 0x2C, 0x64, 0x3D, 0x63, 0x2C, 
+    0x63, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x29, 0x2C, 0x6D, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x28, 0x7B, 0x75, 0x72, 
+    0x6C, 0x3A, 0x61, 0x2C, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x62, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3A, 
+    0x65, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x63, 0x2C, 0x73, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x3A, 0x64, 0x7D, 0x29, 
+    0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x5B, 0x22, 0x61, 0x6A, 0x61, 0x78, 0x53, 0x74, 0x61, 
+    0x72, 0x74, 0x22, 0x2C, 0x22, 0x61, 0x6A, 0x61, 0x78, 0x53, 0x74, 0x6F, 0x70, 0x22, 0x2C, 0x22, 0x61, 0x6A, 0x61, 0x78, 
+    0x43, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x22, 0x2C, 0x22, 0x61, 0x6A, 0x61, 0x78, 0x45, 0x72, 0x72, 0x6F, 0x72, 
+    0x22, 0x2C, 0x22, 0x61, 0x6A, 0x61, 0x78, 0x53, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x22, 0x2C, 0x22, 0x61, 0x6A, 0x61, 
+    0x78, 0x53, 0x65, 0x6E, 0x64, 0x22, 0x5D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 
+    0x29, 0x7B, 0x6D, 0x2E, 0x66, 0x6E, 0x5B, 0x62, 0x5D, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 
+    0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6F, 0x6E, 0x28, 0x62, 0x2C, 0x61, 
+    0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x5F, 0x65, 0x76, 0x61, 0x6C, 0x55, 0x72, 0x6C, 0x3D, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x61, 0x6A, 0x61, 
+    0x78, 0x28, 0x7B, 0x75, 0x72, 0x6C, 0x3A, 0x61, 0x2C, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x47, 0x45, 0x54, 0x22, 0x2C, 
+    0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3A, 0x22, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x2C, 0x61, 0x73, 
+    0x79, 0x6E, 0x63, 0x3A, 0x21, 0x31, 0x2C, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x3A, 0x21, 0x31, 0x2C, 0x22, 0x74, 0x68, 
+    0x72, 0x6F, 0x77, 0x73, 0x22, 0x3A, 0x21, 0x30, 0x7D, 0x29, 0x7D, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 0x74, 
+    0x65, 0x6E, 0x64, 0x28, 0x7B, 0x77, 0x72, 0x61, 0x70, 0x41, 0x6C, 0x6C, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x29, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 
+    0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x6D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 
+    0x2E, 0x77, 0x72, 0x61, 0x70, 0x41, 0x6C, 0x6C, 0x28, 0x61, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 0x69, 0x73, 
+    0x2C, 0x62, 0x29, 0x29, 0x7D, 0x29, 0x3B, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x29, 0x7B, 0x76, 
+    0x61, 0x72, 0x20, 0x62, 0x3D, 0x6D, 0x28, 0x61, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x2E, 0x6F, 0x77, 0x6E, 
+    0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x29, 0x2E, 0x65, 0x71, 0x28, 0x30, 0x29, 0x2E, 0x63, 0x6C, 
+    0x6F, 0x6E, 0x65, 0x28, 0x21, 0x30, 0x29, 0x3B, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x2E, 0x70, 0x61, 0x72, 0x65, 
+    0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x26, 0x26, 0x62, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x42, 0x65, 0x66, 0x6F, 
+    0x72, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x29, 0x2C, 0x62, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x3B, 
+    0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x61, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x26, 0x26, 
+    0x31, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x2E, 0x6E, 0x6F, 0x64, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x61, 0x3D, 0x61, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 
+    0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x7D, 0x29, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x28, 0x74, 
+    0x68, 0x69, 0x73, 0x29, 0x7D, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x77, 0x72, 
+    0x61, 0x70, 0x49, 0x6E, 0x6E, 0x65, 0x72, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x6D, 0x2E, 0x69, 
+    0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x3F, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x62, 0x29, 0x7B, 0x6D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2E, 0x77, 0x72, 0x61, 0x70, 0x49, 0x6E, 0x6E, 
+    0x65, 0x72, 0x28, 0x61, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x62, 0x29, 0x29, 0x7D, 0x3A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 0x6D, 0x28, 0x74, 
+    0x68, 0x69, 0x73, 0x29, 0x2C, 0x63, 0x3D, 0x62, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x73, 0x28, 0x29, 0x3B, 
+    0x63, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x3F, 0x63, 0x2E, 0x77, 0x72, 0x61, 0x70, 0x41, 0x6C, 0x6C, 0x28, 0x61, 
+    0x29, 0x3A, 0x62, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x28, 0x61, 0x29, 0x7D, 0x29, 0x7D, 0x2C, 0x77, 0x72, 0x61, 
+    0x70, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3D, 
+    0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x63, 0x29, 0x7B, 0x6D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2E, 0x77, 0x72, 0x61, 0x70, 0x41, 0x6C, 0x6C, 
+    0x28, 0x62, 0x3F, 0x61, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x63, 0x29, 0x3A, 0x61, 0x29, 
+    0x7D, 0x29, 0x7D, 0x2C, 0x75, 0x6E, 0x77, 0x72, 0x61, 0x70, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 
+    0x28, 0x29, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x6D, 
+    0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x62, 0x6F, 0x64, 0x79, 
+    0x22, 0x29, 0x7C, 0x7C, 0x6D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x57, 
+    0x69, 0x74, 0x68, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x4E, 0x6F, 0x64, 0x65, 0x73, 0x29, 
+    0x7D, 0x29, 0x2E, 0x65, 0x6E, 0x64, 0x28, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x72, 0x2E, 0x66, 
+    0x69, 0x6C, 0x74, 0x65, 0x72, 0x73, 0x2E, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 
+    0x74, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3C, 0x3D, 0x30, 0x26, 0x26, 0x61, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x48, 
+    0x65, 0x69, 0x67, 0x68, 0x74, 0x3C, 0x3D, 0x30, 0x7C, 0x7C, 0x21, 0x6B, 0x2E, 0x72, 0x65, 0x6C, 0x69, 0x61, 0x62, 0x6C, 
+    0x65, 0x48, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x73, 0x28, 0x29, 0x26, 0x26, 0x22, 0x6E, 
+    0x6F, 0x6E, 0x65, 0x22, 0x3D, 0x3D, 0x3D, 0x28, 0x61, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x26, 0x26, 0x61, 0x2E, 0x73, 
+    0x74, 0x79, 0x6C, 0x65, 0x2E, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x7C, 0x7C, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 
+    0x61, 0x2C, 0x22, 0x64, 0x69, 0x73, 0x70, 0x6C, 0x61, 0x79, 0x22, 0x29, 0x29, 0x7D, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x70, 
+    0x72, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x73, 0x2E, 0x76, 0x69, 0x73, 0x69, 0x62, 0x6C, 0x65, 0x3D, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x6D, 0x2E, 0x65, 
+    0x78, 0x70, 0x72, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x73, 0x2E, 0x68, 0x69, 0x64, 0x64, 0x65, 0x6E, 0x28, 0x61, 
+    0x29, 0x7D, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x51, 0x63, 0x3D, 0x2F, 0x25, 0x32, 0x30, 0x2F, 0x67, 0x2C, 0x52, 0x63, 0x3D, 
+    0x2F, 0x5C, 0x5B, 0x5C, 0x5D, 0x24, 0x2F, 0x2C, 0x53, 0x63, 0x3D, 0x2F, 0x5C, 0x72, 0x3F, 0x5C, 0x6E, 0x2F, 0x67, 0x2C, 
+    0x54, 0x63, 0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 0x73, 0x75, 0x62, 0x6D, 0x69, 0x74, 0x7C, 0x62, 0x75, 0x74, 0x74, 0x6F, 
+    0x6E, 0x7C, 0x69, 0x6D, 0x61, 0x67, 0x65, 0x7C, 0x72, 0x65, 0x73, 0x65, 0x74, 0x7C, 0x66, 0x69, 0x6C, 0x65, 0x29, 0x24, 
+    0x2F, 0x69, 0x2C, 0x55, 0x63, 0x3D, 0x2F, 0x5E, 0x28, 0x3F, 0x3A, 0x69, 0x6E, 0x70, 0x75, 0x74, 0x7C, 0x73, 0x65, 0x6C, 
+    0x65, 0x63, 0x74, 0x7C, 0x74, 0x65, 0x78, 0x74, 0x61, 0x72, 0x65, 0x61, 0x7C, 0x6B, 0x65, 0x79, 0x67, 0x65, 0x6E, 0x29, 
+    0x2F, 0x69, 0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x56, 0x63, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 
+    0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x3B, 0x69, 0x66, 0x28, 0x6D, 0x2E, 0x69, 0x73, 0x41, 0x72, 0x72, 
+    0x61, 0x79, 0x28, 0x62, 0x29, 0x29, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x62, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x62, 0x2C, 0x65, 0x29, 0x7B, 0x63, 0x7C, 0x7C, 0x52, 0x63, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 
+    0x61, 0x29, 0x3F, 0x64, 0x28, 0x61, 0x2C, 0x65, 0x29, 0x3A, 0x56, 0x63, 0x28, 0x61, 0x2B, 0x22, 0x5B, 0x22, 0x2B, 0x28, 
+    0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x65, 0x3F, 0x62, 
+    0x3A, 0x22, 0x22, 0x29, 0x2B, 0x22, 0x5D, 0x22, 0x2C, 0x65, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7D, 0x29, 0x3B, 0x65, 0x6C, 
+    0x73, 0x65, 0x20, 0x69, 0x66, 0x28, 0x63, 0x7C, 0x7C, 0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x21, 0x3D, 0x3D, 
+    0x6D, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x28, 0x62, 0x29, 0x29, 0x64, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x3B, 0x65, 0x6C, 0x73, 
+    0x65, 0x20, 0x66, 0x6F, 0x72, 0x28, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x62, 0x29, 0x56, 0x63, 0x28, 0x61, 0x2B, 0x22, 0x5B, 
+    0x22, 0x2B, 0x65, 0x2B, 0x22, 0x5D, 0x22, 0x2C, 0x62, 0x5B, 0x65, 0x5D, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7D, 0x6D, 0x2E, 
+    0x70, 0x61, 0x72, 0x61, 0x6D, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 
+    0x76, 0x61, 0x72, 0x20, 0x63, 0x2C, 0x64, 0x3D, 0x5B, 0x5D, 0x2C, 0x65, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x62, 0x3D, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x62, 0x29, 0x3F, 0x62, 0x28, 0x29, 0x3A, 0x6E, 0x75, 0x6C, 0x6C, 0x3D, 0x3D, 0x62, 0x3F, 0x22, 0x22, 0x3A, 
+    0x62, 0x2C, 0x64, 0x5B, 0x64, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x5D, 0x3D, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 
+    0x55, 0x52, 0x49, 0x43, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x28, 0x61, 0x29, 0x2B, 0x22, 0x3D, 0x22, 0x2B, 
+    0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x55, 0x52, 0x49, 0x43, 0x6F, 0x6D, 0x70, 0x6F, 0x6E, 0x65, 0x6E, 0x74, 0x28, 0x62, 
+    0x29, 0x7D, 0x3B, 0x69, 0x66, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x62, 0x26, 0x26, 0x28, 0x62, 
+    0x3D, 0x6D, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x26, 0x26, 0x6D, 0x2E, 0x61, 
+    0x6A, 0x61, 0x78, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x74, 0x72, 0x61, 0x64, 0x69, 0x74, 0x69, 0x6F, 
+    0x6E, 0x61, 0x6C, 0x29, 0x2C, 0x6D, 0x2E, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x61, 0x29, 0x7C, 0x7C, 0x61, 
+    0x2E, 0x6A, 0x71, 0x75, 0x65, 0x72, 0x79, 0x26, 0x26, 0x21, 0x6D, 0x2E, 0x69, 0x73, 0x50, 0x6C, 0x61, 0x69, 0x6E, 0x4F, 
+    0x62, 0x6A, 0x65, 0x63, 0x74, 0x28, 0x61, 0x29, 0x29, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x61, 0x2C, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x65, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 
+    0x2C, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x29, 0x7D, 0x29, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x20, 
+    0x66, 0x6F, 0x72, 0x28, 0x63, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x29, 0x56, 0x63, 0x28, 0x63, 0x2C, 0x61, 0x5B, 0x63, 0x5D, 
+    0x2C, 0x62, 0x2C, 0x65, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x2E, 0x6A, 0x6F, 0x69, 0x6E, 0x28, 
+    0x22, 0x26, 0x22, 0x29, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x51, 0x63, 0x2C, 0x22, 0x2B, 0x22, 0x29, 
+    0x7D, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x73, 0x65, 0x72, 0x69, 0x61, 
+    0x6C, 0x69, 0x7A, 0x65, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x70, 0x61, 0x72, 0x61, 0x6D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x73, 0x65, 0x72, 0x69, 
+    0x61, 0x6C, 0x69, 0x7A, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x29, 0x29, 0x7D, 0x2C, 0x73, 0x65, 0x72, 0x69, 0x61, 
+    0x6C, 0x69, 0x7A, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 
+    0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x6D, 0x2E, 0x70, 0x72, 0x6F, 0x70, 
+    0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x22, 0x65, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x22, 0x29, 0x3B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3F, 0x6D, 0x2E, 0x6D, 0x61, 0x6B, 0x65, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x61, 
+    0x29, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x29, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x74, 0x79, 
+    0x70, 0x65, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x26, 
+    0x26, 0x21, 0x6D, 0x28, 0x74, 0x68, 0x69, 0x73, 0x29, 0x2E, 0x69, 0x73, 0x28, 0x22, 0x3A, 0x64, 0x69, 0x73, 0x61, 0x62, 
+    0x6C, 0x65, 0x64, 0x22, 0x29, 0x26, 0x26, 0x55, 0x63, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 
+    0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 0x29, 0x26, 0x26, 0x21, 0x54, 0x63, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 
+    0x61, 0x29, 0x26, 0x26, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x65, 0x64, 0x7C, 0x7C, 0x21, 
+    0x57, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x61, 0x29, 0x29, 0x7D, 0x29, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x6D, 0x28, 0x74, 
+    0x68, 0x69, 0x73, 0x29, 0x2E, 0x76, 0x61, 0x6C, 0x28, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 
+    0x6C, 0x6C, 0x3D, 0x3D, 0x63, 0x3F, 0x6E, 0x75, 0x6C, 0x6C, 0x3A, 0x6D, 0x2E, 0x69, 0x73, 0x41, 0x72, 0x72, 0x61, 0x79, 
+    0x28, 0x63, 0x29, 0x3F, 0x6D, 0x2E, 0x6D, 0x61, 0x70, 0x28, 0x63, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x7B, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x62, 0x2E, 0x6E, 0x61, 
+    0x6D, 0x65, 0x2C, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x61, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x53, 
+    0x63, 0x2C, 0x22, 0x5C, 0x72, 0x5C, 0x6E, 0x22, 0x29, 0x7D, 0x7D, 0x29, 0x3A, 0x7B, 0x6E, 0x61, 0x6D, 0x65, 0x3A, 0x62, 
+    0x2E, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x76, 0x61, 0x6C, 0x75, 0x65, 0x3A, 0x63, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 
+    0x65, 0x28, 0x53, 0x63, 0x2C, 0x22, 0x5C, 0x72, 0x5C, 0x6E, 0x22, 0x29, 0x7D, 0x7D, 0x29, 0x2E, 0x67, 0x65, 0x74, 0x28, 
+    0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x53, 0x65, 0x74, 0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 
+    0x78, 0x68, 0x72, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x61, 0x2E, 0x41, 0x63, 0x74, 0x69, 0x76, 
+    0x65, 0x58, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x3F, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x21, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x69, 0x73, 0x4C, 0x6F, 0x63, 0x61, 0x6C, 0x26, 
+    0x26, 0x2F, 0x5E, 0x28, 0x67, 0x65, 0x74, 0x7C, 0x70, 0x6F, 0x73, 0x74, 0x7C, 0x68, 0x65, 0x61, 0x64, 0x7C, 0x70, 0x75, 
+    0x74, 0x7C, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 0x7C, 0x6F, 0x70, 0x74, 0x69, 0x6F, 0x6E, 0x73, 0x29, 0x24, 0x2F, 0x69, 
+    0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x29, 0x26, 0x26, 0x5A, 0x63, 
+    0x28, 0x29, 0x7C, 0x7C, 0x24, 0x63, 0x28, 0x29, 0x7D, 0x3A, 0x5A, 0x63, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x57, 0x63, 0x3D, 
+    0x30, 0x2C, 0x58, 0x63, 0x3D, 0x7B, 0x7D, 0x2C, 0x59, 0x63, 0x3D, 0x6D, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x53, 0x65, 0x74, 
+    0x74, 0x69, 0x6E, 0x67, 0x73, 0x2E, 0x78, 0x68, 0x72, 0x28, 0x29, 0x3B, 0x61, 0x2E, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 
+    0x58, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x26, 0x26, 0x6D, 0x28, 0x61, 0x29, 0x2E, 0x6F, 0x6E, 0x28, 0x22, 0x75, 0x6E, 
+    0x6C, 0x6F, 0x61, 0x64, 0x22, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x66, 0x6F, 0x72, 
+    0x28, 0x76, 0x61, 0x72, 0x20, 0x61, 0x20, 0x69, 0x6E, 0x20, 0x58, 0x63, 0x29, 0x58, 0x63, 0x5B, 0x61, 0x5D, 0x28, 0x76, 
+    0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x21, 0x30, 0x29, 0x7D, 0x29, 0x2C, 0x6B, 0x2E, 0x63, 0x6F, 0x72, 0x73, 0x3D, 0x21, 
+    0x21, 0x59, 0x63, 0x26, 0x26, 0x22, 0x77, 0x69, 0x74, 0x68, 0x43, 0x72, 0x65, 0x64, 0x65, 0x6E, 0x74, 0x69, 0x61, 0x6C, 
+    0x73, 0x22, 0x69, 0x6E, 0x20, 0x59, 0x63, 0x2C, 0x59, 0x63, 0x3D, 0x6B, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x3D, 0x21, 0x21, 
+    0x59, 0x63, 0x2C, 0x59, 0x63, 0x26, 0x26, 0x6D, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x54, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x6F, 
+    0x72, 0x74, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x21, 0x61, 
+    0x2E, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x7C, 0x7C, 0x6B, 0x2E, 0x63, 0x6F, 0x72, 0x73, 
+    0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x7B, 0x73, 0x65, 0x6E, 0x64, 0x3A, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x2C, 
+    0x66, 0x3D, 0x61, 0x2E, 0x78, 0x68, 0x72, 0x28, 0x29, 0x2C, 0x67, 0x3D, 0x2B, 0x2B, 0x57, 0x63, 0x3B, 0x69, 0x66, 0x28, 
+    0x66, 0x2E, 0x6F, 0x70, 0x65, 0x6E, 0x28, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x2C, 0x61, 0x2E, 0x75, 0x72, 0x6C, 0x2C, 
+    0x61, 0x2E, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x2C, 0x61, 0x2E, 0x75, 0x73, 0x65, 0x72, 0x6E, 0x61, 0x6D, 0x65, 0x2C, 0x61, 
+    0x2E, 0x70, 0x61, 0x73, 0x73, 0x77, 0x6F, 0x72, 0x64, 0x29, 0x2C, 0x61, 0x2E, 0x78, 0x68, 0x72, 0x46, 0x69, 0x65, 0x6C, 
+    0x64, 0x73, 0x29, 0x66, 0x6F, 0x72, 0x28, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x61, 0x2E, 0x78, 0x68, 0x72, 0x46, 0x69, 0x65, 
+    0x6C, 0x64, 0x73, 0x29, 0x66, 0x5B, 0x65, 0x5D, 0x3D, 0x61, 0x2E, 0x78, 0x68, 0x72, 0x46, 0x69, 0x65, 0x6C, 0x64, 0x73, 
+    0x5B, 0x65, 0x5D, 0x3B, 0x61, 0x2E, 0x6D, 0x69, 0x6D, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x66, 0x2E, 0x6F, 0x76, 
+    0x65, 0x72, 0x72, 0x69, 0x64, 0x65, 0x4D, 0x69, 0x6D, 0x65, 0x54, 0x79, 0x70, 0x65, 0x26, 0x26, 0x66, 0x2E, 0x6F, 0x76, 
+    0x65, 0x72, 0x72, 0x69, 0x64, 0x65, 0x4D, 0x69, 0x6D, 0x65, 0x54, 0x79, 0x70, 0x65, 0x28, 0x61, 0x2E, 0x6D, 0x69, 0x6D, 
+    0x65, 0x54, 0x79, 0x70, 0x65, 0x29, 0x2C, 0x61, 0x2E, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 
+    0x7C, 0x7C, 0x63, 0x5B, 0x22, 0x58, 0x2D, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 0x2D, 0x57, 0x69, 0x74, 
+    0x68, 0x22, 0x5D, 0x7C, 0x7C, 0x28, 0x63, 0x5B, 0x22, 0x58, 0x2D, 0x52, 0x65, 0x71, 0x75, 0x65, 0x73, 0x74, 0x65, 0x64, 
+    0x2D, 0x57, 0x69, 0x74, 0x68, 0x22, 0x5D, 0x3D, 0x22, 0x58, 0x4D, 0x4C, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 0x75, 
+    0x65, 0x73, 0x74, 0x22, 0x29, 0x3B, 0x66, 0x6F, 0x72, 0x28, 0x65, 0x20, 0x69, 0x6E, 0x20, 0x63, 0x29, 0x76, 0x6F, 0x69, 
+    0x64, 0x20, 0x30, 0x21, 0x3D, 0x3D, 0x63, 0x5B, 0x65, 0x5D, 0x26, 0x26, 0x66, 0x2E, 0x73, 0x65, 0x74, 0x52, 0x65, 0x71, 
+    0x75, 0x65, 0x73, 0x74, 0x48, 0x65, 0x61, 0x64, 0x65, 0x72, 0x28, 0x65, 0x2C, 0x63, 0x5B, 0x65, 0x5D, 0x2B, 0x22, 0x22, 
+    0x29, 0x3B, 0x66, 0x2E, 0x73, 0x65, 0x6E, 0x64, 0x28, 0x61, 0x2E, 0x68, 0x61, 0x73, 0x43, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 
+    0x74, 0x26, 0x26, 0x61, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x7C, 0x7C, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x2C, 0x62, 0x3D, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x63, 0x2C, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x68, 0x2C, 0x69, 
+    0x2C, 0x6A, 0x3B, 0x69, 0x66, 0x28, 0x62, 0x26, 0x26, 0x28, 0x65, 0x7C, 0x7C, 0x34, 0x3D, 0x3D, 0x3D, 0x66, 0x2E, 0x72, 
+    0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x29, 0x69, 0x66, 0x28, 0x64, 0x65, 0x6C, 0x65, 0x74, 0x65, 
+    0x20, 0x58, 0x63, 0x5B, 0x67, 0x5D, 0x2C, 0x62, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x66, 0x2E, 0x6F, 0x6E, 
+    0x72, 0x65, 0x61, 0x64, 0x79, 0x73, 0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x6D, 0x2E, 0x6E, 
+    0x6F, 0x6F, 0x70, 0x2C, 0x65, 0x29, 0x34, 0x21, 0x3D, 0x3D, 0x66, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 
+    0x74, 0x65, 0x26, 0x26, 0x66, 0x2E, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x28, 0x29, 0x3B, 0x65, 0x6C, 0x73, 0x65, 0x7B, 0x6A, 
+    0x3D, 0x7B, 0x7D, 0x2C, 0x68, 0x3D, 0x66, 0x2E, 0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x2C, 0x22, 0x73, 0x74, 0x72, 0x69, 
+    0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x66, 0x2E, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 
+    0x73, 0x65, 0x54, 0x65, 0x78, 0x74, 0x26, 0x26, 0x28, 0x6A, 0x2E, 0x74, 0x65, 0x78, 0x74, 0x3D, 0x66, 0x2E, 0x72, 0x65, 
+    0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x54, 0x65, 0x78, 0x74, 0x29, 0x3B, 0x74, 0x72, 0x79, 0x7B, 0x69, 0x3D, 0x66, 0x2E, 
+    0x73, 0x74, 0x61, 0x74, 0x75, 0x73, 0x54, 0x65, 0x78, 0x74, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x6B, 0x29, 0x7B, 
+    0x69, 0x3D, 0x22, 0x22, 0x7D, 0x68, 0x7C, 0x7C, 0x21, 0x61, 0x2E, 0x69, 0x73, 0x4C, 0x6F, 0x63, 0x61, 0x6C, 0x7C, 0x7C, 
+    0x61, 0x2E, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x3F, 0x31, 0x32, 0x32, 0x33, 0x3D, 0x3D, 
+    0x3D, 0x68, 0x26, 0x26, 0x28, 0x68, 0x3D, 0x32, 0x30, 0x34, 0x29, 0x3A, 0x68, 0x3D, 0x6A, 0x2E, 0x74, 0x65, 0x78, 0x74, 
+    0x3F, 0x32, 0x30, 0x30, 0x3A, 0x34, 0x30, 0x34, 0x7D, 0x6A, 0x26, 0x26, 0x64, 0x28, 0x68, 0x2C, 0x69, 0x2C, 0x6A, 0x2C, 
+    0x66, 0x2E, 0x67, 0x65, 0x74, 0x41, 0x6C, 0x6C, 0x52, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x48, 0x65, 0x61, 0x64, 
+    0x65, 0x72, 0x73, 0x28, 0x29, 0x29, 0x7D, 0x2C, 0x61, 0x2E, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x3F, 0x34, 0x3D, 0x3D, 0x3D, 
+    0x66, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x3F, 0x73, 0x65, 0x74, 0x54, 0x69, 0x6D, 0x65, 
+    0x6F, 0x75, 0x74, 0x28, 0x62, 0x29, 0x3A, 0x66, 0x2E, 0x6F, 0x6E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73, 0x74, 0x61, 0x74, 
+    0x65, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x58, 0x63, 0x5B, 0x67, 0x5D, 0x3D, 0x62, 0x3A, 0x62, 0x28, 0x29, 0x7D, 
+    0x2C, 0x61, 0x62, 0x6F, 0x72, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x62, 0x26, 
+    0x26, 0x62, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x21, 0x30, 0x29, 0x7D, 0x7D, 0x7D, 0x7D, 0x29, 0x3B, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x5A, 0x63, 0x28, 0x29, 0x7B, 0x74, 0x72, 0x79, 0x7B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x2E, 0x58, 0x4D, 0x4C, 0x48, 0x74, 0x74, 0x70, 0x52, 0x65, 0x71, 
+    0x75, 0x65, 0x73, 0x74, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x62, 0x29, 0x7B, 0x7D, 0x7D, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x20, 0x24, 0x63, 0x28, 0x29, 0x7B, 0x74, 0x72, 0x79, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x6E, 0x65, 0x77, 0x20, 0x61, 0x2E, 0x41, 0x63, 0x74, 0x69, 0x76, 0x65, 0x58, 0x4F, 0x62, 0x6A, 0x65, 0x63, 0x74, 
+    0x28, 0x22, 0x4D, 0x69, 0x63, 0x72, 0x6F, 0x73, 0x6F, 0x66, 0x74, 0x2E, 0x58, 0x4D, 0x4C, 0x48, 0x54, 0x54, 0x50, 0x22, 
+    0x29, 0x7D, 0x63, 0x61, 0x74, 0x63, 0x68, 0x28, 0x62, 0x29, 0x7B, 0x7D, 0x7D, 0x6D, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x53, 
+    0x65, 0x74, 0x75, 0x70, 0x28, 0x7B, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x73, 0x3A, 0x7B, 0x73, 0x63, 0x72, 0x69, 0x70, 
+    0x74, 0x3A, 0x22, 0x74, 0x65, 0x78, 0x74, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x2C, 0x20, 
+    0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x6A, 0x61, 0x76, 0x61, 0x73, 0x63, 0x72, 0x69, 
+    0x70, 0x74, 0x2C, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x65, 0x63, 0x6D, 0x61, 
+    0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x2C, 0x20, 0x61, 0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 
+    0x78, 0x2D, 0x65, 0x63, 0x6D, 0x61, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x7D, 0x2C, 0x63, 0x6F, 0x6E, 0x74, 0x65, 
+    0x6E, 0x74, 0x73, 0x3A, 0x7B, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x3A, 0x2F, 0x28, 0x3F, 0x3A, 0x6A, 0x61, 0x76, 0x61, 
+    0x7C, 0x65, 0x63, 0x6D, 0x61, 0x29, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x2F, 0x7D, 0x2C, 0x63, 0x6F, 0x6E, 0x76, 0x65, 
+    0x72, 0x74, 0x65, 0x72, 0x73, 0x3A, 0x7B, 0x22, 0x74, 0x65, 0x78, 0x74, 0x20, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 
+    0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 
+    0x6D, 0x2E, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x45, 0x76, 0x61, 0x6C, 0x28, 0x61, 0x29, 0x2C, 0x61, 0x7D, 0x7D, 0x7D, 
+    0x29, 0x2C, 0x6D, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x50, 0x72, 0x65, 0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x22, 0x73, 
+    0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x76, 
+    0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x63, 0x61, 0x63, 0x68, 0x65, 0x26, 0x26, 0x28, 0x61, 0x2E, 
+    0x63, 0x61, 0x63, 0x68, 0x65, 0x3D, 0x21, 0x31, 0x29, 0x2C, 0x61, 0x2E, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x44, 0x6F, 0x6D, 
+    0x61, 0x69, 0x6E, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x74, 0x79, 0x70, 0x65, 0x3D, 0x22, 0x47, 0x45, 0x54, 0x22, 0x2C, 0x61, 
+    0x2E, 0x67, 0x6C, 0x6F, 0x62, 0x61, 0x6C, 0x3D, 0x21, 0x31, 0x29, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x61, 0x6A, 0x61, 0x78, 
+    0x54, 0x72, 0x61, 0x6E, 0x73, 0x70, 0x6F, 0x72, 0x74, 0x28, 0x22, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x2C, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x61, 0x2E, 0x63, 0x72, 0x6F, 0x73, 
+    0x73, 0x44, 0x6F, 0x6D, 0x61, 0x69, 0x6E, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x3D, 0x79, 0x2E, 0x68, 
+    0x65, 0x61, 0x64, 0x7C, 0x7C, 0x6D, 0x28, 0x22, 0x68, 0x65, 0x61, 0x64, 0x22, 0x29, 0x5B, 0x30, 0x5D, 0x7C, 0x7C, 0x79, 
+    0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x3B, 0x72, 0x65, 0x74, 
+    0x75, 0x72, 0x6E, 0x7B, 0x73, 0x65, 0x6E, 0x64, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x64, 0x2C, 
+    0x65, 0x29, 0x7B, 0x62, 0x3D, 0x79, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 
+    0x28, 0x22, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x22, 0x29, 0x2C, 0x62, 0x2E, 0x61, 0x73, 0x79, 0x6E, 0x63, 0x3D, 0x21, 
+    0x30, 0x2C, 0x61, 0x2E, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x43, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x26, 0x26, 0x28, 
+    0x62, 0x2E, 0x63, 0x68, 0x61, 0x72, 0x73, 0x65, 0x74, 0x3D, 0x61, 0x2E, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x43, 0x68, 
+    0x61, 0x72, 0x73, 0x65, 0x74, 0x29, 0x2C, 0x62, 0x2E, 0x73, 0x72, 0x63, 0x3D, 0x61, 0x2E, 0x75, 0x72, 0x6C, 0x2C, 0x62, 
+    0x2E, 0x6F, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x3D, 0x62, 0x2E, 0x6F, 0x6E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x73, 0x74, 0x61, 
+    0x74, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 
+    0x63, 0x29, 0x7B, 0x28, 0x63, 0x7C, 0x7C, 0x21, 0x62, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 
+    0x7C, 0x7C, 0x2F, 0x6C, 0x6F, 0x61, 0x64, 0x65, 0x64, 0x7C, 0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x2F, 0x2E, 
+    0x74, 0x65, 0x73, 0x74, 0x28, 0x62, 0x2E, 0x72, 0x65, 0x61, 0x64, 0x79, 0x53, 0x74, 0x61, 0x74, 0x65, 0x29, 0x29, 0x26, 
+    0x26, 0x28, 0x62, 0x2E, 0x6F, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x3D, 0x62, 0x2E, 0x6F, 0x6E, 0x72, 0x65, 0x61, 0x64, 0x79, 
+    0x73, 0x74, 0x61, 0x74, 0x65, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x62, 0x2E, 0x70, 
+    0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 0x6F, 0x64, 0x65, 0x26, 0x26, 0x62, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x4E, 
+    0x6F, 0x64, 0x65, 0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x28, 0x62, 0x29, 0x2C, 0x62, 
+    0x3D, 0x6E, 0x75, 0x6C, 0x6C, 0x2C, 0x63, 0x7C, 0x7C, 0x65, 0x28, 0x32, 0x30, 0x30, 0x2C, 0x22, 0x73, 0x75, 0x63, 0x63, 
+    0x65, 0x73, 0x73, 0x22, 0x29, 0x29, 0x7D, 0x2C, 0x63, 0x2E, 0x69, 0x6E, 0x73, 0x65, 0x72, 0x74, 0x42, 0x65, 0x66, 0x6F, 
+    0x72, 0x65, 0x28, 0x62, 0x2C, 0x63, 0x2E, 0x66, 0x69, 0x72, 0x73, 0x74, 0x43, 0x68, 0x69, 0x6C, 0x64, 0x29, 0x7D, 0x2C, 
+    0x61, 0x62, 0x6F, 0x72, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x62, 0x26, 0x26, 
+    0x62, 0x2E, 0x6F, 0x6E, 0x6C, 0x6F, 0x61, 0x64, 0x28, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x21, 0x30, 0x29, 0x7D, 
+    0x7D, 0x7D, 0x7D, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x5F, 0x63, 0x3D, 0x5B, 0x5D, 0x2C, 0x61, 0x64, 0x3D, 0x2F, 0x28, 
+    0x3D, 0x29, 0x5C, 0x3F, 0x28, 0x3F, 0x3D, 0x26, 0x7C, 0x24, 0x29, 0x7C, 0x5C, 0x3F, 0x5C, 0x3F, 0x2F, 0x3B, 0x6D, 0x2E, 
+    0x61, 0x6A, 0x61, 0x78, 0x53, 0x65, 0x74, 0x75, 0x70, 0x28, 0x7B, 0x6A, 0x73, 0x6F, 0x6E, 0x70, 0x3A, 0x22, 0x63, 0x61, 
+    0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x22, 0x2C, 0x6A, 0x73, 0x6F, 0x6E, 0x70, 0x43, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 
+    0x6B, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x5F, 
+    0x63, 0x2E, 0x70, 0x6F, 0x70, 0x28, 0x29, 0x7C, 0x7C, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x61, 0x6E, 0x64, 0x6F, 0x2B, 0x22, 
+    0x5F, 0x22, 0x2B, 0x76, 0x63, 0x2B, 0x2B, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x5B, 
+    0x61, 0x5D, 0x3D, 0x21, 0x30, 0x2C, 0x61, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x50, 0x72, 0x65, 
+    0x66, 0x69, 0x6C, 0x74, 0x65, 0x72, 0x28, 0x22, 0x6A, 0x73, 0x6F, 0x6E, 0x20, 0x6A, 0x73, 0x6F, 0x6E, 0x70, 0x22, 0x2C, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 
+    0x65, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x3D, 0x62, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x70, 0x21, 0x3D, 0x3D, 0x21, 0x31, 
+    0x26, 0x26, 0x28, 0x61, 0x64, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x62, 0x2E, 0x75, 0x72, 0x6C, 0x29, 0x3F, 0x22, 0x75, 
+    0x72, 0x6C, 0x22, 0x3A, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 
+    0x20, 0x62, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x26, 0x26, 0x21, 0x28, 0x62, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 
+    0x54, 0x79, 0x70, 0x65, 0x7C, 0x7C, 0x22, 0x22, 0x29, 0x2E, 0x69, 0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x61, 
+    0x70, 0x70, 0x6C, 0x69, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x2F, 0x78, 0x2D, 0x77, 0x77, 0x77, 0x2D, 0x66, 0x6F, 0x72, 
+    0x6D, 0x2D, 0x75, 0x72, 0x6C, 0x65, 0x6E, 0x63, 0x6F, 0x64, 0x65, 0x64, 0x22, 0x29, 0x26, 0x26, 0x61, 0x64, 0x2E, 0x74, 
+    0x65, 0x73, 0x74, 0x28, 0x62, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x29, 0x26, 0x26, 0x22, 0x64, 0x61, 0x74, 0x61, 0x22, 0x29, 
+    0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x68, 0x7C, 0x7C, 0x22, 0x6A, 0x73, 0x6F, 0x6E, 0x70, 0x22, 0x3D, 0x3D, 
+    0x3D, 0x62, 0x2E, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x73, 0x5B, 0x30, 0x5D, 0x3F, 0x28, 0x65, 0x3D, 0x62, 
+    0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x70, 0x43, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x3D, 0x6D, 0x2E, 0x69, 0x73, 0x46, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x70, 0x43, 0x61, 0x6C, 0x6C, 0x62, 
+    0x61, 0x63, 0x6B, 0x29, 0x3F, 0x62, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x70, 0x43, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 
+    0x28, 0x29, 0x3A, 0x62, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x70, 0x43, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x2C, 0x68, 
+    0x3F, 0x62, 0x5B, 0x68, 0x5D, 0x3D, 0x62, 0x5B, 0x68, 0x5D, 0x2E, 0x72, 0x65, 0x70, 0x6C, 0x61, 0x63, 0x65, 0x28, 0x61, 
+    0x64, 0x2C, 0x22, 0x24, 0x31, 0x22, 0x2B, 0x65, 0x29, 0x3A, 0x62, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x70, 0x21, 0x3D, 0x3D, 
+    0x21, 0x31, 0x26, 0x26, 0x28, 0x62, 0x2E, 0x75, 0x72, 0x6C, 0x2B, 0x3D, 0x28, 0x77, 0x63, 0x2E, 0x74, 0x65, 0x73, 0x74, 
+    0x28, 0x62, 0x2E, 0x75, 0x72, 0x6C, 0x29, 0x3F, 0x22, 0x26, 0x22, 0x3A, 0x22, 0x3F, 0x22, 0x29, 0x2B, 0x62, 0x2E, 0x6A, 
+    0x73, 0x6F, 0x6E, 0x70, 0x2B, 0x22, 0x3D, 0x22, 0x2B, 0x65, 0x29, 0x2C, 0x62, 0x2E, 0x63, 0x6F, 0x6E, 0x76, 0x65, 0x72, 
+    0x74, 0x65, 0x72, 0x73, 0x5B, 0x22, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 0x20, 0x6A, 0x73, 0x6F, 0x6E, 0x22, 0x5D, 0x3D, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x67, 0x7C, 
+    0x7C, 0x6D, 0x2E, 0x65, 0x72, 0x72, 0x6F, 0x72, 0x28, 0x65, 0x2B, 0x22, 0x20, 0x77, 0x61, 0x73, 0x20, 0x6E, 0x6F, 0x74, 
+    0x20, 0x63, 0x61, 0x6C, 0x6C, 0x65, 0x64, 0x22, 0x29, 0x2C, 0x67, 0x5B, 0x30, 0x5D, 0x7D, 0x2C, 0x62, 0x2E, 0x64, 0x61, 
+    0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x73, 0x5B, 0x30, 0x5D, 0x3D, 0x22, 0x6A, 0x73, 0x6F, 0x6E, 0x22, 0x2C, 0x66, 0x3D, 
+    0x61, 0x5B, 0x65, 0x5D, 0x2C, 0x61, 0x5B, 0x65, 0x5D, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 
+    0x7B, 0x67, 0x3D, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x7D, 0x2C, 0x64, 0x2E, 0x61, 0x6C, 0x77, 0x61, 
+    0x79, 0x73, 0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x61, 0x5B, 0x65, 0x5D, 0x3D, 0x66, 
+    0x2C, 0x62, 0x5B, 0x65, 0x5D, 0x26, 0x26, 0x28, 0x62, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x70, 0x43, 0x61, 0x6C, 0x6C, 0x62, 
+    0x61, 0x63, 0x6B, 0x3D, 0x63, 0x2E, 0x6A, 0x73, 0x6F, 0x6E, 0x70, 0x43, 0x61, 0x6C, 0x6C, 0x62, 0x61, 0x63, 0x6B, 0x2C, 
+    0x5F, 0x63, 0x2E, 0x70, 0x75, 0x73, 0x68, 0x28, 0x65, 0x29, 0x29, 0x2C, 0x67, 0x26, 0x26, 0x6D, 0x2E, 0x69, 0x73, 0x46, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x66, 0x29, 0x26, 0x26, 0x66, 0x28, 0x67, 0x5B, 0x30, 0x5D, 0x29, 0x2C, 
+    0x67, 0x3D, 0x66, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x29, 0x2C, 0x22, 0x73, 0x63, 0x72, 0x69, 0x70, 0x74, 
+    0x22, 0x29, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x48, 
+    0x54, 0x4D, 0x4C, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 
+    0x69, 0x66, 0x28, 0x21, 0x61, 0x7C, 0x7C, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 
+    0x65, 0x6F, 0x66, 0x20, 0x61, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6E, 0x75, 0x6C, 0x6C, 0x3B, 0x22, 0x62, 
+    0x6F, 0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x26, 0x26, 0x28, 
+    0x63, 0x3D, 0x62, 0x2C, 0x62, 0x3D, 0x21, 0x31, 0x29, 0x2C, 0x62, 0x3D, 0x62, 0x7C, 0x7C, 0x79, 0x3B, 0x76, 0x61, 0x72, 
+    0x20, 0x64, 0x3D, 0x75, 0x2E, 0x65, 0x78, 0x65, 0x63, 0x28, 0x61, 0x29, 0x2C, 0x65, 0x3D, 0x21, 0x63, 0x26, 0x26, 0x5B, 
+    0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x64, 0x3F, 0x5B, 0x62, 0x2E, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 
+    0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x64, 0x5B, 0x31, 0x5D, 0x29, 0x5D, 0x3A, 0x28, 0x64, 0x3D, 0x6D, 0x2E, 
+    0x62, 0x75, 0x69, 0x6C, 0x64, 0x46, 0x72, 0x61, 0x67, 0x6D, 0x65, 0x6E, 0x74, 0x28, 0x5B, 0x61, 0x5D, 0x2C, 0x62, 0x2C, 
+    0x65, 0x29, 0x2C, 0x65, 0x26, 0x26, 0x65, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x6D, 0x28, 0x65, 0x29, 
+    0x2E, 0x72, 0x65, 0x6D, 0x6F, 0x76, 0x65, 0x28, 0x29, 0x2C, 0x6D, 0x2E, 0x6D, 0x65, 0x72, 0x67, 0x65, 0x28, 0x5B, 0x5D, 
+    0x2C, 0x64, 0x2E, 0x63, 0x68, 0x69, 0x6C, 0x64, 0x4E, 0x6F, 0x64, 0x65, 0x73, 0x29, 0x29, 0x7D, 0x3B, 0x76, 0x61, 0x72, 
+    0x20, 0x62, 0x64, 0x3D, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x6C, 0x6F, 0x61, 0x64, 0x3B, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x6C, 
+    0x6F, 0x61, 0x64, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 0x63, 0x29, 0x7B, 
+    0x69, 0x66, 0x28, 0x22, 0x73, 0x74, 0x72, 0x69, 0x6E, 0x67, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 
+    0x61, 0x26, 0x26, 0x62, 0x64, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x64, 0x2E, 0x61, 0x70, 0x70, 0x6C, 
+    0x79, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x29, 0x3B, 0x76, 0x61, 
+    0x72, 0x20, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x68, 0x3D, 0x61, 0x2E, 0x69, 
+    0x6E, 0x64, 0x65, 0x78, 0x4F, 0x66, 0x28, 0x22, 0x20, 0x22, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x68, 
+    0x3E, 0x3D, 0x30, 0x26, 0x26, 0x28, 0x64, 0x3D, 0x6D, 0x2E, 0x74, 0x72, 0x69, 0x6D, 0x28, 0x61, 0x2E, 0x73, 0x6C, 0x69, 
+    0x63, 0x65, 0x28, 0x68, 0x2C, 0x61, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x29, 0x29, 0x2C, 0x61, 0x3D, 0x61, 0x2E, 
+    0x73, 0x6C, 0x69, 0x63, 0x65, 0x28, 0x30, 0x2C, 0x68, 0x29, 0x29, 0x2C, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x3F, 0x28, 0x63, 0x3D, 0x62, 0x2C, 0x62, 0x3D, 0x76, 0x6F, 0x69, 0x64, 0x20, 
+    0x30, 0x29, 0x3A, 0x62, 0x26, 0x26, 0x22, 0x6F, 0x62, 0x6A, 0x65, 0x63, 0x74, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 
+    0x6F, 0x66, 0x20, 0x62, 0x26, 0x26, 0x28, 0x66, 0x3D, 0x22, 0x50, 0x4F, 0x53, 0x54, 0x22, 0x29, 0x2C, 0x67, 0x2E, 0x6C, 
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x3E, 0x30, 0x26, 0x26, 0x6D, 0x2E, 0x61, 0x6A, 0x61, 0x78, 0x28, 0x7B, 0x75, 0x72, 0x6C, 
+    0x3A, 0x61, 0x2C, 0x74, 0x79, 0x70, 0x65, 0x3A, 0x66, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x54, 0x79, 0x70, 0x65, 0x3A, 0x22, 
+    0x68, 0x74, 0x6D, 0x6C, 0x22, 0x2C, 0x64, 0x61, 0x74, 0x61, 0x3A, 0x62, 0x7D, 0x29, 0x2E, 0x64, 0x6F, 0x6E, 0x65, 0x28, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x29, 0x7B, 0x65, 0x3D, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 
+    0x6E, 0x74, 0x73, 0x2C, 0x67, 0x2E, 0x68, 0x74, 0x6D, 0x6C, 0x28, 0x64, 0x3F, 0x6D, 0x28, 0x22, 0x3C, 0x64, 0x69, 0x76, 
+    0x3E, 0x22, 0x29, 0x2E, 0x61, 0x70, 0x70, 0x65, 0x6E, 0x64, 0x28, 0x6D, 0x2E, 0x70, 0x61, 0x72, 0x73, 0x65, 0x48, 0x54, 
+    0x4D, 0x4C, 0x28, 0x61, 0x29, 0x29, 0x2E, 0x66, 0x69, 0x6E, 0x64, 0x28, 0x64, 0x29, 0x3A, 0x61, 0x29, 0x7D, 0x29, 0x2E, 
+    0x63, 0x6F, 0x6D, 0x70, 0x6C, 0x65, 0x74, 0x65, 0x28, 0x63, 0x26, 0x26, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x67, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x63, 0x2C, 0x65, 0x7C, 0x7C, 0x5B, 0x61, 
+    0x2E, 0x72, 0x65, 0x73, 0x70, 0x6F, 0x6E, 0x73, 0x65, 0x54, 0x65, 0x78, 0x74, 0x2C, 0x62, 0x2C, 0x61, 0x5D, 0x29, 0x7D, 
+    0x29, 0x2C, 0x74, 0x68, 0x69, 0x73, 0x7D, 0x2C, 0x6D, 0x2E, 0x65, 0x78, 0x70, 0x72, 0x2E, 0x66, 0x69, 0x6C, 0x74, 0x65, 
+    0x72, 0x73, 0x2E, 0x61, 0x6E, 0x69, 0x6D, 0x61, 0x74, 0x65, 0x64, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x67, 0x72, 0x65, 0x70, 0x28, 0x6D, 0x2E, 
+    0x74, 0x69, 0x6D, 0x65, 0x72, 0x73, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 0x65, 0x6C, 0x65, 0x6D, 0x7D, 0x29, 0x2E, 0x6C, 
+    0x65, 0x6E, 0x67, 0x74, 0x68, 0x7D, 0x3B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x64, 0x3D, 0x61, 0x2E, 0x64, 0x6F, 0x63, 0x75, 
+    0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 
+    0x3B, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x20, 0x64, 0x64, 0x28, 0x61, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 
+    0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x69, 0x73, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x28, 0x61, 0x29, 0x3F, 0x61, 0x3A, 0x39, 
+    0x3D, 0x3D, 0x3D, 0x61, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3F, 0x61, 0x2E, 0x64, 0x65, 0x66, 0x61, 
+    0x75, 0x6C, 0x74, 0x56, 0x69, 0x65, 0x77, 0x7C, 0x7C, 0x61, 0x2E, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x57, 0x69, 0x6E, 
+    0x64, 0x6F, 0x77, 0x3A, 0x21, 0x31, 0x7D, 0x6D, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3D, 0x7B, 0x73, 0x65, 0x74, 
+    0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x2C, 
+    0x63, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x64, 0x2C, 0x65, 0x2C, 0x66, 0x2C, 0x67, 0x2C, 0x68, 0x2C, 0x69, 0x2C, 0x6A, 
+    0x2C, 0x6B, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 0x22, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 
+    0x22, 0x29, 0x2C, 0x6C, 0x3D, 0x6D, 0x28, 0x61, 0x29, 0x2C, 0x6E, 0x3D, 0x7B, 0x7D, 0x3B, 0x22, 0x73, 0x74, 0x61, 0x74, 
+    0x69, 0x63, 0x22, 0x3D, 0x3D, 0x3D, 0x6B, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x2E, 0x70, 0x6F, 
+    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3D, 0x22, 0x72, 0x65, 0x6C, 0x61, 0x74, 0x69, 0x76, 0x65, 0x22, 0x29, 0x2C, 0x68, 
+    0x3D, 0x6C, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x28, 0x29, 0x2C, 0x66, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 
+    0x61, 0x2C, 0x22, 0x74, 0x6F, 0x70, 0x22, 0x29, 0x2C, 0x69, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 0x22, 
+    0x6C, 0x65, 0x66, 0x74, 0x22, 0x29, 0x2C, 0x6A, 0x3D, 0x28, 0x22, 0x61, 0x62, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x22, 
+    0x3D, 0x3D, 0x3D, 0x6B, 0x7C, 0x7C, 0x22, 0x66, 0x69, 0x78, 0x65, 0x64, 0x22, 0x3D, 0x3D, 0x3D, 0x6B, 0x29, 0x26, 0x26, 
+    0x6D, 0x2E, 0x69, 0x6E, 0x41, 0x72, 0x72, 0x61, 0x79, 0x28, 0x22, 0x61, 0x75, 0x74, 0x6F, 0x22, 0x2C, 0x5B, 0x66, 0x2C, 
+    0x69, 0x5D, 0x29, 0x3E, 0x2D, 0x31, 0x2C, 0x6A, 0x3F, 0x28, 0x64, 0x3D, 0x6C, 0x2E, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x29, 0x2C, 0x67, 0x3D, 0x64, 0x2E, 0x74, 0x6F, 0x70, 0x2C, 0x65, 0x3D, 0x64, 0x2E, 0x6C, 0x65, 0x66, 
+    0x74, 0x29, 0x3A, 0x28, 0x67, 0x3D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x28, 0x66, 0x29, 0x7C, 
+    0x7C, 0x30, 0x2C, 0x65, 0x3D, 0x70, 0x61, 0x72, 0x73, 0x65, 0x46, 0x6C, 0x6F, 0x61, 0x74, 0x28, 0x69, 0x29, 0x7C, 0x7C, 
+    0x30, 0x29, 0x2C, 0x6D, 0x2E, 0x69, 0x73, 0x46, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x26, 0x26, 
+    0x28, 0x62, 0x3D, 0x62, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2C, 0x63, 0x2C, 0x68, 0x29, 0x29, 0x2C, 0x6E, 0x75, 
+    0x6C, 0x6C, 0x21, 0x3D, 0x62, 0x2E, 0x74, 0x6F, 0x70, 0x26, 0x26, 0x28, 0x6E, 0x2E, 0x74, 0x6F, 0x70, 0x3D, 0x62, 0x2E, 
+    0x74, 0x6F, 0x70, 0x2D, 0x68, 0x2E, 0x74, 0x6F, 0x70, 0x2B, 0x67, 0x29, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x21, 0x3D, 0x62, 
+    0x2E, 0x6C, 0x65, 0x66, 0x74, 0x26, 0x26, 0x28, 0x6E, 0x2E, 0x6C, 0x65, 0x66, 0x74, 0x3D, 0x62, 0x2E, 0x6C, 0x65, 0x66, 
+    0x74, 0x2D, 0x68, 0x2E, 0x6C, 0x65, 0x66, 0x74, 0x2B, 0x65, 0x29, 0x2C, 0x22, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x22, 0x69, 
+    0x6E, 0x20, 0x62, 0x3F, 0x62, 0x2E, 0x75, 0x73, 0x69, 0x6E, 0x67, 0x2E, 0x63, 0x61, 0x6C, 0x6C, 0x28, 0x61, 0x2C, 0x6E, 
+    0x29, 0x3A, 0x6C, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x6E, 0x29, 0x7D, 0x7D, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x65, 0x78, 
+    0x74, 0x65, 0x6E, 0x64, 0x28, 0x7B, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x61, 0x29, 0x7B, 0x69, 0x66, 0x28, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 
+    0x6E, 0x67, 0x74, 0x68, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 
+    0x3D, 0x61, 0x3F, 0x74, 0x68, 0x69, 0x73, 0x3A, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x66, 0x75, 
+    0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x2E, 0x73, 
+    0x65, 0x74, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x61, 0x2C, 0x62, 0x29, 0x7D, 0x29, 
+    0x3B, 0x76, 0x61, 0x72, 0x20, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x3D, 0x7B, 0x74, 0x6F, 0x70, 0x3A, 0x30, 0x2C, 0x6C, 0x65, 
+    0x66, 0x74, 0x3A, 0x30, 0x7D, 0x2C, 0x65, 0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x2C, 0x66, 0x3D, 0x65, 0x26, 
+    0x26, 0x65, 0x2E, 0x6F, 0x77, 0x6E, 0x65, 0x72, 0x44, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x3B, 0x69, 0x66, 0x28, 
+    0x66, 0x29, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x62, 0x3D, 0x66, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 
+    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x6D, 0x2E, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x73, 0x28, 
+    0x62, 0x2C, 0x65, 0x29, 0x3F, 0x28, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x42, 0x6F, 
+    0x75, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x52, 0x65, 0x63, 0x74, 0x21, 0x3D, 0x3D, 0x4B, 
+    0x26, 0x26, 0x28, 0x64, 0x3D, 0x65, 0x2E, 0x67, 0x65, 0x74, 0x42, 0x6F, 0x75, 0x6E, 0x64, 0x69, 0x6E, 0x67, 0x43, 0x6C, 
+    0x69, 0x65, 0x6E, 0x74, 0x52, 0x65, 0x63, 0x74, 0x28, 0x29, 0x29, 0x2C, 0x63, 0x3D, 0x64, 0x64, 0x28, 0x66, 0x29, 0x2C, 
+    0x7B, 0x74, 0x6F, 0x70, 0x3A, 0x64, 0x2E, 0x74, 0x6F, 0x70, 0x2B, 0x28, 0x63, 0x2E, 0x70, 0x61, 0x67, 0x65, 0x59, 0x4F, 
+    0x66, 0x66, 0x73, 0x65, 0x74, 0x7C, 0x7C, 0x62, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x54, 0x6F, 0x70, 0x29, 0x2D, 
+    0x28, 0x62, 0x2E, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x54, 0x6F, 0x70, 0x7C, 0x7C, 0x30, 0x29, 0x2C, 0x6C, 0x65, 0x66, 
+    0x74, 0x3A, 0x64, 0x2E, 0x6C, 0x65, 0x66, 0x74, 0x2B, 0x28, 0x63, 0x2E, 0x70, 0x61, 0x67, 0x65, 0x58, 0x4F, 0x66, 0x66, 
+    0x73, 0x65, 0x74, 0x7C, 0x7C, 0x62, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x4C, 0x65, 0x66, 0x74, 0x29, 0x2D, 0x28, 
+    0x62, 0x2E, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x4C, 0x65, 0x66, 0x74, 0x7C, 0x7C, 0x30, 0x29, 0x7D, 0x29, 0x3A, 0x64, 
+    0x7D, 0x2C, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 
+    0x29, 0x7B, 0x69, 0x66, 0x28, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x2C, 
+    0x62, 0x2C, 0x63, 0x3D, 0x7B, 0x74, 0x6F, 0x70, 0x3A, 0x30, 0x2C, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x30, 0x7D, 0x2C, 0x64, 
+    0x3D, 0x74, 0x68, 0x69, 0x73, 0x5B, 0x30, 0x5D, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x22, 0x66, 0x69, 0x78, 0x65, 
+    0x64, 0x22, 0x3D, 0x3D, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x64, 0x2C, 0x22, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 
+    0x6F, 0x6E, 0x22, 0x29, 0x3F, 0x62, 0x3D, 0x64, 0x2E, 0x67, 0x65, 0x74, 0x42, 0x6F, 0x75, 0x6E, 0x64, 0x69, 0x6E, 0x67, 
+    0x43, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x52, 0x65, 0x63, 0x74, 0x28, 0x29, 0x3A, 0x28, 0x61, 0x3D, 0x74, 0x68, 0x69, 0x73, 
+    0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x50, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x28, 0x29, 0x2C, 0x62, 0x3D, 0x74, 0x68, 
+    0x69, 0x73, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x28, 0x29, 0x2C, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 
+    0x6D, 0x65, 0x28, 0x61, 0x5B, 0x30, 0x5D, 0x2C, 0x22, 0x68, 0x74, 0x6D, 0x6C, 0x22, 0x29, 0x7C, 0x7C, 0x28, 0x63, 0x3D, 
+    0x61, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x28, 0x29, 0x29, 0x2C, 0x63, 0x2E, 0x74, 0x6F, 0x70, 0x2B, 0x3D, 0x6D, 
+    0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x5B, 0x30, 0x5D, 0x2C, 0x22, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x54, 0x6F, 0x70, 
+    0x57, 0x69, 0x64, 0x74, 0x68, 0x22, 0x2C, 0x21, 0x30, 0x29, 0x2C, 0x63, 0x2E, 0x6C, 0x65, 0x66, 0x74, 0x2B, 0x3D, 0x6D, 
+    0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x5B, 0x30, 0x5D, 0x2C, 0x22, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x4C, 0x65, 0x66, 
+    0x74, 0x57, 0x69, 0x64, 0x74, 0x68, 0x22, 0x2C, 0x21, 0x30, 0x29, 0x29, 0x2C, 0x7B, 0x74, 0x6F, 0x70, 0x3A, 0x62, 0x2E, 
+    0x74, 0x6F, 0x70, 0x2D, 0x63, 0x2E, 0x74, 0x6F, 0x70, 0x2D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x64, 0x2C, 0x22, 0x6D, 
+    0x61, 0x72, 0x67, 0x69, 0x6E, 0x54, 0x6F, 0x70, 0x22, 0x2C, 0x21, 0x30, 0x29, 0x2C, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x62, 
+    0x2E, 0x6C, 0x65, 0x66, 0x74, 0x2D, 0x63, 0x2E, 0x6C, 0x65, 0x66, 0x74, 0x2D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x64, 
+    0x2C, 0x22, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x4C, 0x65, 0x66, 0x74, 0x22, 0x2C, 0x21, 0x30, 0x29, 0x7D, 0x7D, 0x7D, 
+    0x2C, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x50, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x3A, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 0x73, 0x2E, 0x6D, 0x61, 0x70, 
+    0x28, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x61, 0x3D, 0x74, 0x68, 
+    0x69, 0x73, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x50, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x7C, 0x7C, 0x63, 0x64, 0x3B, 
+    0x77, 0x68, 0x69, 0x6C, 0x65, 0x28, 0x61, 0x26, 0x26, 0x21, 0x6D, 0x2E, 0x6E, 0x6F, 0x64, 0x65, 0x4E, 0x61, 0x6D, 0x65, 
+    0x28, 0x61, 0x2C, 0x22, 0x68, 0x74, 0x6D, 0x6C, 0x22, 0x29, 0x26, 0x26, 0x22, 0x73, 0x74, 0x61, 0x74, 0x69, 0x63, 0x22, 
+    0x3D, 0x3D, 0x3D, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x61, 0x2C, 0x22, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 
+    0x22, 0x29, 0x29, 0x61, 0x3D, 0x61, 0x2E, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x50, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x3B, 
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x7C, 0x7C, 0x63, 0x64, 0x7D, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 
+    0x65, 0x61, 0x63, 0x68, 0x28, 0x7B, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x4C, 0x65, 0x66, 0x74, 0x3A, 0x22, 0x70, 0x61, 
+    0x67, 0x65, 0x58, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x22, 0x2C, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x54, 0x6F, 0x70, 
+    0x3A, 0x22, 0x70, 0x61, 0x67, 0x65, 0x59, 0x4F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x22, 0x7D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x63, 0x3D, 0x2F, 0x59, 0x2F, 0x2E, 
+    0x74, 0x65, 0x73, 0x74, 0x28, 0x62, 0x29, 0x3B, 0x6D, 0x2E, 0x66, 0x6E, 0x5B, 0x61, 0x5D, 0x3D, 0x66, 0x75, 0x6E, 0x63, 
+    0x74, 0x69, 0x6F, 0x6E, 0x28, 0x64, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x56, 0x28, 0x74, 0x68, 0x69, 
+    0x73, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x64, 0x2C, 0x65, 0x29, 0x7B, 0x76, 0x61, 
+    0x72, 0x20, 0x66, 0x3D, 0x64, 0x64, 0x28, 0x61, 0x29, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x76, 0x6F, 0x69, 
+    0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x65, 0x3F, 0x66, 0x3F, 0x62, 0x20, 0x69, 0x6E, 0x20, 0x66, 0x3F, 0x66, 0x5B, 0x62, 
+    0x5D, 0x3A, 0x66, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 
+    0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x5B, 0x64, 0x5D, 0x3A, 0x61, 0x5B, 0x64, 0x5D, 0x3A, 0x76, 0x6F, 0x69, 
+    0x64, 0x28, 0x66, 0x3F, 0x66, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x54, 0x6F, 0x28, 0x63, 0x3F, 0x6D, 0x28, 0x66, 
+    0x29, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x4C, 0x65, 0x66, 0x74, 0x28, 0x29, 0x3A, 0x65, 0x2C, 0x63, 0x3F, 0x65, 
+    0x3A, 0x6D, 0x28, 0x66, 0x29, 0x2E, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x54, 0x6F, 0x70, 0x28, 0x29, 0x29, 0x3A, 0x61, 
+    0x5B, 0x64, 0x5D, 0x3D, 0x65, 0x29, 0x7D, 0x2C, 0x61, 0x2C, 0x64, 0x2C, 0x61, 0x72, 0x67, 0x75, 0x6D, 0x65, 0x6E, 0x74, 
+    0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x2C, 0x6E, 0x75, 0x6C, 0x6C, 0x29, 0x7D, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 
+    0x65, 0x61, 0x63, 0x68, 0x28, 0x5B, 0x22, 0x74, 0x6F, 0x70, 0x22, 0x2C, 0x22, 0x6C, 0x65, 0x66, 0x74, 0x22, 0x5D, 0x2C, 
+    0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x48, 
+    0x6F, 0x6F, 0x6B, 0x73, 0x5B, 0x62, 0x5D, 0x3D, 0x4C, 0x62, 0x28, 0x6B, 0x2E, 0x70, 0x69, 0x78, 0x65, 0x6C, 0x50, 0x6F, 
+    0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 0x63, 0x29, 
+    0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x63, 0x3F, 0x28, 0x63, 0x3D, 0x4A, 0x62, 0x28, 0x61, 0x2C, 0x62, 0x29, 
+    0x2C, 0x48, 0x62, 0x2E, 0x74, 0x65, 0x73, 0x74, 0x28, 0x63, 0x29, 0x3F, 0x6D, 0x28, 0x61, 0x29, 0x2E, 0x70, 0x6F, 0x73, 
+    0x69, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x5B, 0x62, 0x5D, 0x2B, 0x22, 0x70, 0x78, 0x22, 0x3A, 0x63, 0x29, 0x3A, 0x76, 
+    0x6F, 0x69, 0x64, 0x20, 0x30, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x7B, 0x48, 0x65, 
+    0x69, 0x67, 0x68, 0x74, 0x3A, 0x22, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x22, 0x2C, 0x57, 0x69, 0x64, 0x74, 0x68, 0x3A, 
+    0x22, 0x77, 0x69, 0x64, 0x74, 0x68, 0x22, 0x7D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x61, 0x2C, 
+    0x62, 0x29, 0x7B, 0x6D, 0x2E, 0x65, 0x61, 0x63, 0x68, 0x28, 0x7B, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x22, 
+    0x69, 0x6E, 0x6E, 0x65, 0x72, 0x22, 0x2B, 0x61, 0x2C, 0x63, 0x6F, 0x6E, 0x74, 0x65, 0x6E, 0x74, 0x3A, 0x62, 0x2C, 0x22, 
+    0x22, 0x3A, 0x22, 0x6F, 0x75, 0x74, 0x65, 0x72, 0x22, 0x2B, 0x61, 0x7D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 
+    0x6E, 0x28, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x6D, 0x2E, 0x66, 0x6E, 0x5B, 0x64, 0x5D, 0x3D, 0x66, 0x75, 0x6E, 0x63, 0x74, 
+    0x69, 0x6F, 0x6E, 0x28, 0x64, 0x2C, 0x65, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x66, 0x3D, 0x61, 0x72, 0x67, 0x75, 0x6D, 
+    0x65, 0x6E, 0x74, 0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x26, 0x26, 0x28, 0x63, 0x7C, 0x7C, 0x22, 0x62, 0x6F, 
+    0x6F, 0x6C, 0x65, 0x61, 0x6E, 0x22, 0x21, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x64, 0x29, 0x2C, 0x67, 0x3D, 
+    0x63, 0x7C, 0x7C, 0x28, 0x64, 0x3D, 0x3D, 0x3D, 0x21, 0x30, 0x7C, 0x7C, 0x65, 0x3D, 0x3D, 0x3D, 0x21, 0x30, 0x3F, 0x22, 
+    0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x22, 0x3A, 0x22, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x22, 0x29, 0x3B, 0x72, 0x65, 
+    0x74, 0x75, 0x72, 0x6E, 0x20, 0x56, 0x28, 0x74, 0x68, 0x69, 0x73, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 
+    0x28, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x29, 0x7B, 0x76, 0x61, 0x72, 0x20, 0x65, 0x3B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 
+    0x20, 0x6D, 0x2E, 0x69, 0x73, 0x57, 0x69, 0x6E, 0x64, 0x6F, 0x77, 0x28, 0x62, 0x29, 0x3F, 0x62, 0x2E, 0x64, 0x6F, 0x63, 
+    0x75, 0x6D, 0x65, 0x6E, 0x74, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 
+    0x74, 0x5B, 0x22, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x22, 0x2B, 0x61, 0x5D, 0x3A, 0x39, 0x3D, 0x3D, 0x3D, 0x62, 0x2E, 
+    0x6E, 0x6F, 0x64, 0x65, 0x54, 0x79, 0x70, 0x65, 0x3F, 0x28, 0x65, 0x3D, 0x62, 0x2E, 0x64, 0x6F, 0x63, 0x75, 0x6D, 0x65, 
+    0x6E, 0x74, 0x45, 0x6C, 0x65, 0x6D, 0x65, 0x6E, 0x74, 0x2C, 0x4D, 0x61, 0x74, 0x68, 0x2E, 0x6D, 0x61, 0x78, 0x28, 0x62, 
+    0x2E, 0x62, 0x6F, 0x64, 0x79, 0x5B, 0x22, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x22, 0x2B, 0x61, 0x5D, 0x2C, 0x65, 0x5B, 
+    0x22, 0x73, 0x63, 0x72, 0x6F, 0x6C, 0x6C, 0x22, 0x2B, 0x61, 0x5D, 0x2C, 0x62, 0x2E, 0x62, 0x6F, 0x64, 0x79, 0x5B, 0x22, 
+    0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 0x22, 0x2B, 0x61, 0x5D, 0x2C, 0x65, 0x5B, 0x22, 0x6F, 0x66, 0x66, 0x73, 0x65, 0x74, 
+    0x22, 0x2B, 0x61, 0x5D, 0x2C, 0x65, 0x5B, 0x22, 0x63, 0x6C, 0x69, 0x65, 0x6E, 0x74, 0x22, 0x2B, 0x61, 0x5D, 0x29, 0x29, 
+    0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x3D, 0x3D, 0x3D, 0x64, 0x3F, 0x6D, 0x2E, 0x63, 0x73, 0x73, 0x28, 0x62, 0x2C, 
+    0x63, 0x2C, 0x67, 0x29, 0x3A, 0x6D, 0x2E, 0x73, 0x74, 0x79, 0x6C, 0x65, 0x28, 0x62, 0x2C, 0x63, 0x2C, 0x64, 0x2C, 0x67, 
+    0x29, 0x7D, 0x2C, 0x62, 0x2C, 0x66, 0x3F, 0x64, 0x3A, 0x76, 0x6F, 0x69, 0x64, 0x20, 0x30, 0x2C, 0x66, 0x2C, 0x6E, 0x75, 
+    0x6C, 0x6C, 0x29, 0x7D, 0x7D, 0x29, 0x7D, 0x29, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x73, 0x69, 0x7A, 0x65, 0x3D, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x74, 0x68, 0x69, 
+    0x73, 0x2E, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x7D, 0x2C, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x61, 0x6E, 0x64, 0x53, 0x65, 
+    0x6C, 0x66, 0x3D, 0x6D, 0x2E, 0x66, 0x6E, 0x2E, 0x61, 0x64, 0x64, 0x42, 0x61, 0x63, 0x6B, 0x2C, 0x22, 0x66, 0x75, 0x6E, 
+    0x63, 0x74, 0x69, 0x6F, 0x6E, 0x22, 0x3D, 0x3D, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x64, 0x65, 0x66, 0x69, 0x6E, 
+    0x65, 0x26, 0x26, 0x64, 0x65, 0x66, 0x69, 0x6E, 0x65, 0x2E, 0x61, 0x6D, 0x64, 0x26, 0x26, 0x64, 0x65, 0x66, 0x69, 0x6E, 
+    0x65, 0x28, 0x22, 0x6A, 0x71, 0x75, 0x65, 0x72, 0x79, 0x22, 0x2C, 0x5B, 0x5D, 0x2C, 0x66, 0x75, 0x6E, 0x63, 0x74, 0x69, 
+    0x6F, 0x6E, 0x28, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x7D, 0x29, 0x3B, 0x76, 0x61, 0x72, 0x20, 
+    0x65, 0x64, 0x3D, 0x61, 0x2E, 0x6A, 0x51, 0x75, 0x65, 0x72, 0x79, 0x2C, 0x66, 0x64, 0x3D, 0x61, 0x2E, 0x24, 0x3B, 0x72, 
+    0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x6D, 0x2E, 0x6E, 0x6F, 0x43, 0x6F, 0x6E, 0x66, 0x6C, 0x69, 0x63, 0x74, 0x3D, 0x66, 
+    0x75, 0x6E, 0x63, 0x74, 0x69, 0x6F, 0x6E, 0x28, 0x62, 0x29, 0x7B, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x20, 0x61, 0x2E, 
+    0x24, 0x3D, 0x3D, 0x3D, 0x6D, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x24, 0x3D, 0x66, 0x64, 0x29, 0x2C, 0x62, 0x26, 0x26, 0x61, 
+    0x2E, 0x6A, 0x51, 0x75, 0x65, 0x72, 0x79, 0x3D, 0x3D, 0x3D, 0x6D, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x6A, 0x51, 0x75, 0x65, 
+    0x72, 0x79, 0x3D, 0x65, 0x64, 0x29, 0x2C, 0x6D, 0x7D, 0x2C, 0x74, 0x79, 0x70, 0x65, 0x6F, 0x66, 0x20, 0x62, 0x3D, 0x3D, 
+    0x3D, 0x4B, 0x26, 0x26, 0x28, 0x61, 0x2E, 0x6A, 0x51, 0x75, 0x65, 0x72, 0x79, 0x3D, 0x61, 0x2E, 0x24, 0x3D, 0x6D, 0x29, 
+    0x2C, 0x6D, 0x7D, 0x29, 0x3B, 0x0A, 
+};
+
+uint8_t jquery_js_gzip_data[]
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xDD, 0xBD, 0x79, 0x77, 0x23, 0xC7, 0x91, 0x2F, 0xFA, 0xFF, 
+    0x7C, 0x0A, 0xA2, 0xDC, 0x43, 0x55, 0x35, 0x92, 0x20, 0xD8, 0x92, 0x7C, 0xC7, 0x05, 0x15, 0xEB, 0x49, 0xDD, 0x92, 0x25, 
+    0x5B, 0x9B, 0xDD, 0x2D, 0x4B, 0x32, 0x08, 0xE9, 0xD4, 0x86, 0x85, 0xC4, 0x46, 0x00, 0x6C, 0x92, 0x22, 0xE0, 0xCF, 0xFE, 
+    0xE2, 0x17, 0x91, 0x99, 0x95, 0xB5, 0xA0, 0x5B, 0x9E, 0xB9, 0xEF, 0xBC, 0x7B, 0xAE, 0xEC, 0x26, 0xAA, 0xB2, 0x72, 0xCF, 
+    0xC8, 0xC8, 0x88, 0xC8, 0x58, 0xCE, 0x9F, 0x77, 0x4E, 0xAE, 0xFF, 0x76, 0x57, 0x6C, 0x1E, 0x4F, 0xDE, 0x5E, 0xF4, 0x2E, 
+    0xE8, 0xFF, 0x27, 0xFB, 0x13, 0x3F, 0x0B, 0x4E, 0x5E, 0xF4, 0xFB, 0x1F, 0x2B, 0xFA, 0x7B, 0xF1, 0x91, 0xF9, 0xFE, 0xC5, 
+    0xEA, 0x6E, 0x99, 0x27, 0xBB, 0xD9, 0x6A, 0xA9, 0x4E, 0xBE, 0x5A, 0x66, 0x3D, 0xCA, 0x78, 0x7D, 0x8B, 0x2F, 0xBD, 0xD5, 
+    0x66, 0x72, 0x3E, 0x9F, 0x65, 0xC5, 0x72, 0x5B, 0x9C, 0x3C, 0x3F, 0xFF, 0x8F, 0xCE, 0xF8, 0x6E, 0x99, 0x21, 0x9F, 0x9F, 
+    0xA8, 0x34, 0x78, 0xF2, 0x56, 0xE9, 0x75, 0x91, 0xED, 0xBC, 0x28, 0xDA, 0x3D, 0xAE, 0x8B, 0xD5, 0xF8, 0x64, 0xB1, 0xCA, 
+    0xEF, 0xE6, 0xC5, 0xE9, 0xE9, 0x91, 0x0F, 0xBD, 0xE2, 0x61, 0xBD, 0xDA, 0xEC, 0xB6, 0x71, 0xF5, 0x35, 0x4A, 0x7A, 0xF9, 
+    0x2A, 0xBB, 0x5B, 0x14, 0xCB, 0x5D, 0x9C, 0x52, 0xCD, 0x9D, 0x7E, 0x10, 0x96, 0x0D, 0x05, 0x4F, 0xB3, 0xB1, 0xDF, 0x29, 
+    0xB3, 0x04, 0xBB, 0xE9, 0x66, 0x75, 0x7F, 0xB2, 0x2C, 0xEE, 0x4F, 0x3E, 0xDF, 0x6C, 0x56, 0x1B, 0xDF, 0xD3, 0xA3, 0xD8, 
+    0x14, 0xB7, 0x77, 0xB3, 0x4D, 0xB1, 0x3D, 0x49, 0x4E, 0xEE, 0x67, 0xCB, 0x9C, 0xF2, 0xDC, 0xCF, 0x76, 0x53, 0x7A, 0x33, 
+    0x25, 0xBD, 0x60, 0xB0, 0x29, 0x76, 0x77, 0x9B, 0xE5, 0x09, 0xB5, 0x12, 0x1C, 0x42, 0xFE, 0xEB, 0x7B, 0x34, 0xF6, 0x62, 
+    0x3C, 0x5B, 0x16, 0xB9, 0xD7, 0x31, 0xDD, 0x95, 0xF2, 0xB1, 0xFC, 0x84, 0xBB, 0xE9, 0x6C, 0xAB, 0xAA, 0x23, 0x7F, 0x9B, 
+    0x6C, 0x4E, 0xB2, 0x68, 0x38, 0x52, 0x79, 0x94, 0xF5, 0xB6, 0x98, 0x21, 0x55, 0xD0, 0x53, 0xB6, 0x5A, 0x66, 0xC9, 0x4E, 
+    0x8D, 0xE9, 0x71, 0x7D, 0xB7, 0x9D, 0xAA, 0x09, 0x3D, 0x50, 0x1D, 0xC5, 0xC3, 0x77, 0x63, 0x35, 0x8D, 0x9E, 0x0E, 0x6A, 
+    0x16, 0x4D, 0x7B, 0xBB, 0xD5, 0xEB, 0xDD, 0x66, 0xB6, 0x9C, 0xA8, 0x6B, 0x7A, 0x99, 0x26, 0xDB, 0xEF, 0xEE, 0x97, 0xDF, 
+    0x6F, 0x56, 0xEB, 0x62, 0xB3, 0x7B, 0x54, 0x37, 0xC8, 0x34, 0x8F, 0x3C, 0x59, 0x30, 0x4F, 0x2D, 0xA2, 0x6A, 0xBB, 0xBA, 
+    0xFF, 0x18, 0xFC, 0xA2, 0x37, 0x5E, 0x52, 0xE5, 0xB3, 0x1D, 0x7F, 0x39, 0xA8, 0x65, 0x74, 0xFE, 0xCB, 0xF0, 0x6A, 0x7B, 
+    0x75, 0xF7, 0xC5, 0xE7, 0x5F, 0x7C, 0x71, 0xF5, 0xF0, 0x69, 0x7F, 0xD4, 0xDD, 0xD7, 0xDE, 0x9F, 0x9D, 0x4F, 0xD4, 0x8A, 
+    0xB2, 0x9D, 0x2D, 0xB6, 0x67, 0xE7, 0x6A, 0x1D, 0x9D, 0x9F, 0xF9, 0xC3, 0xAB, 0x3C, 0x39, 0xFB, 0x6D, 0x14, 0x9C, 0x4F, 
+    0x66, 0xEA, 0xB6, 0xBD, 0xB1, 0x94, 0x7A, 0xFC, 0xC3, 0x9A, 0xFA, 0xF7, 0x32, 0xD9, 0x16, 0x7E, 0x70, 0x18, 0xA0, 0xE5, 
+    0x68, 0xD1, 0x5B, 0x6F, 0x56, 0xBB, 0x15, 0x26, 0x2C, 0x7A, 0x12, 0x68, 0x09, 0xE7, 0x8A, 0x26, 0x60, 0xBB, 0xDB, 0xDC, 
+    0x65, 0xBB, 0xD5, 0x26, 0x5C, 0xA8, 0x6D, 0x31, 0x2F, 0xF8, 0xD1, 0xF3, 0xD4, 0xBC, 0x58, 0x4E, 0x76, 0xD3, 0xB0, 0xAF, 
+    0x76, 0xAB, 0x4F, 0x37, 0x9B, 0xE4, 0xB1, 0x5C, 0x61, 0xDB, 0x50, 0xDE, 0xCB, 0x92, 0xF9, 0xDC, 0xC7, 0x74, 0xD3, 0x78, 
+    0x26, 0xC5, 0xAE, 0x02, 0x05, 0x66, 0xE8, 0x77, 0xF3, 0x79, 0x27, 0x4A, 0xE2, 0xFE, 0x65, 0x12, 0x23, 0xE7, 0x30, 0xE9, 
+    0xE2, 0xA7, 0x27, 0xF5, 0x8F, 0x42, 0x49, 0x1B, 0x85, 0xD5, 0xCA, 0xB0, 0x1A, 0xAF, 0x77, 0x49, 0x76, 0x53, 0xA9, 0x12, 
+    0xAB, 0x98, 0xD2, 0x48, 0x16, 0xC5, 0x66, 0x52, 0x70, 0xD6, 0x9E, 0x33, 0x00, 0x3F, 0x50, 0x49, 0x09, 0x31, 0x34, 0xDC, 
+    0xE2, 0xED, 0x77, 0x0C, 0xD6, 0x11, 0x03, 0x44, 0x8A, 0xBC, 0xBB, 0xE2, 0x41, 0x5E, 0xCD, 0x8B, 0x4A, 0x0F, 0xAA, 0x48, 
+    0xB2, 0x69, 0xD8, 0x3A, 0x95, 0x8B, 0x1E, 0xBE, 0x71, 0x4B, 0x4A, 0x56, 0x6D, 0x91, 0xAC, 0xDB, 0x46, 0xC9, 0x55, 0xDA, 
+    0x4E, 0xFB, 0xD4, 0xC5, 0x64, 0xED, 0x57, 0xE1, 0x30, 0x55, 0x99, 0xCD, 0x9E, 0xC8, 0x60, 0x29, 0x09, 0x95, 0x06, 0x54, 
+    0x2F, 0xC3, 0x64, 0xCB, 0x1C, 0xD7, 0x2A, 0xCE, 0x7B, 0xC9, 0x7A, 0x3D, 0x7F, 0xD4, 0x3D, 0xDA, 0x4C, 0x78, 0x9F, 0x6C, 
+    0x51, 0xC1, 0x78, 0xB6, 0xD9, 0xEE, 0x8E, 0x55, 0x50, 0xDC, 0xFA, 0x7D, 0xCA, 0x33, 0x4F, 0xDE, 0x99, 0xE5, 0xEC, 0x82, 
+    0xF2, 0x14, 0xB7, 0x2D, 0x53, 0xEE, 0xAC, 0x98, 0xCA, 0xA2, 0x6E, 0xD2, 0xF5, 0xB1, 0x9C, 0x69, 0xD8, 0xB7, 0xF3, 0x5D, 
+    0xEB, 0x67, 0x76, 0x19, 0xF5, 0x4F, 0x4F, 0xD3, 0xCB, 0x2C, 0x1E, 0xF2, 0x02, 0x67, 0xA3, 0x51, 0x38, 0x1C, 0xA1, 0xFA, 
+    0x65, 0x7E, 0x74, 0x94, 0x76, 0xC1, 0xF6, 0xFB, 0xC6, 0xDA, 0x02, 0x8C, 0x34, 0x5C, 0x84, 0x63, 0xB5, 0x25, 0x34, 0x14, 
+    0xD2, 0x46, 0xA6, 0x1F, 0xB5, 0x5D, 0xF3, 0xD4, 0xD1, 0x1B, 0x3F, 0xD0, 0x12, 0x11, 0x9E, 0xDA, 0x51, 0x3B, 0x11, 0xEF, 
+    0x38, 0xFD, 0xEC, 0xB4, 0x89, 0x21, 0xD1, 0x62, 0xD2, 0xDC, 0xE7, 0xAA, 0x50, 0x63, 0xDA, 0xF4, 0x76, 0x22, 0x87, 0xFD, 
+    0xD1, 0x7E, 0x4F, 0x3B, 0x7A, 0x1A, 0x5D, 0xD0, 0xD6, 0xB7, 0xC9, 0x66, 0xE8, 0xD7, 0x51, 0xE7, 0x62, 0x30, 0x06, 0x0A, 
+    0x4B, 0x57, 0xAB, 0x79, 0x91, 0x2C, 0x4B, 0x84, 0x39, 0x39, 0x3D, 0xF5, 0xAF, 0xA3, 0x49, 0xA5, 0xB2, 0xA9, 0xAE, 0xAC, 
+    0xDB, 0x0D, 0x54, 0x03, 0xC3, 0x4E, 0xF6, 0xFB, 0x45, 0x6F, 0xB6, 0xFD, 0xC2, 0xF4, 0x6B, 0x12, 0xEC, 0xF7, 0xFE, 0x84, 
+    0xD0, 0x49, 0x40, 0xAD, 0x47, 0xD1, 0x8C, 0xEA, 0x9B, 0x08, 0xE0, 0x4E, 0xCF, 0xCE, 0x82, 0xC1, 0xEC, 0x72, 0x3A, 0x40, 
+    0x45, 0x84, 0x5B, 0x65, 0x47, 0xF9, 0x45, 0xA5, 0xA5, 0x20, 0x40, 0xBF, 0xF2, 0x93, 0xD9, 0xF2, 0xA4, 0x08, 0x92, 0x68, 
+    0x32, 0xCC, 0x47, 0xB4, 0x52, 0x05, 0x7E, 0x26, 0x9D, 0x28, 0xCA, 0xD0, 0xBD, 0xD3, 0x53, 0xFC, 0xA0, 0xD5, 0xEF, 0xE7, 
+    0xC9, 0x6C, 0x29, 0x73, 0x4D, 0x27, 0x0C, 0x35, 0x8C, 0x5D, 0x35, 0xDB, 0xF2, 0x46, 0xA7, 0x84, 0x20, 0x88, 0xFD, 0x94, 
+    0xFE, 0x4F, 0xC3, 0x25, 0xDC, 0x98, 0x9C, 0x9E, 0x96, 0x1F, 0x93, 0x20, 0x4E, 0xB0, 0x92, 0xA1, 0x4D, 0x77, 0xEB, 0xE2, 
+    0xAF, 0x34, 0x64, 0x34, 0x1F, 0x99, 0x75, 0xF0, 0xAF, 0x69, 0x92, 0xA9, 0xD2, 0xF0, 0xED, 0x6A, 0x96, 0x9F, 0xF4, 0x75, 
+    0x6F, 0x38, 0x0B, 0xA5, 0x1A, 0x00, 0x9A, 0x94, 0x0B, 0xE7, 0x3F, 0xD1, 0x41, 0x93, 0x10, 0x2A, 0x0F, 0xF5, 0x51, 0xE1, 
+    0x75, 0xFD, 0x79, 0xF7, 0x9B, 0x64, 0x37, 0xED, 0x6D, 0x90, 0xBC, 0xF0, 0x83, 0xA0, 0xB7, 0x29, 0xD6, 0xF3, 0x24, 0x2B, 
+    0xFC, 0xF3, 0xAB, 0x57, 0x84, 0x25, 0x3D, 0x2F, 0x50, 0xB3, 0xED, 0xDF, 0x8B, 0x24, 0x7F, 0x0C, 0x3B, 0x7D, 0x55, 0xE0, 
+    0xA0, 0xA9, 0xC0, 0x71, 0xFD, 0x10, 0x4A, 0x80, 0x81, 0x57, 0xAB, 0xB5, 0x0B, 0x8C, 0x84, 0xEE, 0xED, 0x7A, 0xB4, 0x6C, 
+    0x72, 0xCF, 0x24, 0xD1, 0x22, 0xD2, 0xE0, 0xB0, 0x8E, 0x5C, 0x8D, 0x9E, 0x9A, 0x90, 0xFF, 0x9A, 0x89, 0xDA, 0xEF, 0x5B, 
+    0x2A, 0x48, 0xF0, 0xA5, 0x51, 0xFA, 0x47, 0x39, 0xB5, 0x8E, 0xE3, 0xCE, 0xD3, 0xD3, 0x24, 0xA2, 0x33, 0x57, 0x4E, 0x37, 
+    0x94, 0xF8, 0x96, 0x96, 0x7D, 0x33, 0xCB, 0x5A, 0x8A, 0x74, 0xDC, 0x95, 0xA2, 0x72, 0x67, 0xEB, 0x64, 0xB3, 0x2D, 0xBE, 
+    0x98, 0xAF, 0x12, 0x2C, 0x0E, 0x6D, 0x4A, 0x14, 0xFF, 0x7C, 0xB1, 0xDE, 0x3D, 0xCA, 0x8A, 0x35, 0xF7, 0x3A, 0xC3, 0x77, 
+    0x0A, 0x38, 0x4A, 0x02, 0x5D, 0xE7, 0x85, 0x5E, 0xA3, 0x0E, 0x97, 0x76, 0xD6, 0xBB, 0xA5, 0x34, 0x9F, 0xFD, 0xFB, 0xBD, 
+    0x01, 0xF7, 0x8E, 0x33, 0xD6, 0xFD, 0x3E, 0xE9, 0x2D, 0x57, 0x79, 0xF1, 0x86, 0x5E, 0x05, 0xF8, 0x65, 0xE4, 0xF4, 0xA9, 
+    0x6C, 0x69, 0xB7, 0x79, 0x04, 0xFD, 0x90, 0xB8, 0x9B, 0xFF, 0xF4, 0xB4, 0x73, 0x2D, 0x08, 0x33, 0x51, 0x9E, 0x93, 0xEE, 
+    0x05, 0xCE, 0x17, 0xB7, 0x40, 0x79, 0xD4, 0x29, 0x8F, 0x3A, 0x6C, 0x5E, 0xBE, 0x1B, 0x7B, 0x65, 0x4B, 0x07, 0x3A, 0xF8, 
+    0x09, 0xB5, 0x5B, 0x9C, 0x4C, 0x29, 0xD4, 0xEE, 0x4D, 0x6F, 0x75, 0xBF, 0xFC, 0x9A, 0xD0, 0x64, 0xD0, 0x98, 0x86, 0x13, 
+    0xDB, 0x87, 0x34, 0x70, 0x27, 0xC9, 0x00, 0xB0, 0x40, 0x37, 0x2D, 0x6E, 0xBA, 0xDF, 0x3B, 0x59, 0x0F, 0x0A, 0x4D, 0x1F, 
+    0x5B, 0x5D, 0x5A, 0xD7, 0x38, 0xE9, 0x7A, 0x5E, 0xD8, 0xC0, 0x0F, 0x98, 0x44, 0x07, 0xE0, 0x4C, 0x6A, 0x3C, 0x1D, 0xCE, 
+    0x74, 0xE5, 0xC1, 0xA8, 0x9C, 0xE7, 0xD0, 0x7C, 0xA7, 0xBD, 0x37, 0x5F, 0xA5, 0xC9, 0xFC, 0xF3, 0xB7, 0xC9, 0xBC, 0x6C, 
+    0x94, 0x4E, 0xB4, 0x14, 0xBB, 0x95, 0xE8, 0x98, 0x05, 0xBD, 0xD0, 0xF6, 0x4B, 0x68, 0xAF, 0x15, 0xD9, 0xEB, 0x6C, 0x33, 
+    0x5B, 0xEF, 0x1C, 0x58, 0xA5, 0x8C, 0xF4, 0x85, 0xCA, 0x3A, 0x03, 0x08, 0x7C, 0x8C, 0x22, 0x4B, 0x16, 0xC5, 0x1C, 0x14, 
+    0x45, 0xDB, 0x50, 0x12, 0xBB, 0x1D, 0x57, 0xCA, 0x23, 0x62, 0xC5, 0x2B, 0xF7, 0xE7, 0x5A, 0xDD, 0xF2, 0x56, 0xCB, 0x8B, 
+    0x6F, 0xA9, 0x86, 0xF6, 0x63, 0x56, 0xE0, 0x02, 0xDF, 0x09, 0x64, 0xED, 0x33, 0x91, 0x31, 0x5F, 0xAF, 0xEE, 0x0D, 0x19, 
+    0x83, 0x89, 0xAD, 0xA6, 0xB4, 0x1C, 0xDC, 0x38, 0x62, 0x01, 0x87, 0x84, 0xD8, 0xA3, 0x3E, 0x50, 0x97, 0xC1, 0xDC, 0x93, 
+    0x08, 0x5B, 0x1E, 0xD0, 0x99, 0x31, 0x7D, 0x3A, 0x09, 0x9E, 0xB0, 0x84, 0x83, 0xF1, 0x65, 0x31, 0x28, 0x04, 0xAD, 0xE6, 
+    0x54, 0xBF, 0x1C, 0xAE, 0xC9, 0xB0, 0x20, 0xE4, 0x19, 0x10, 0xAD, 0x18, 0x11, 0x06, 0x0C, 0xD2, 0x4D, 0x91, 0xDC, 0x1C, 
+    0x8A, 0x39, 0x91, 0xD4, 0x28, 0x53, 0xC8, 0xB2, 0xFF, 0xCE, 0x12, 0xC7, 0xDB, 0x92, 0x09, 0x46, 0xC1, 0x42, 0xE1, 0xE7, 
+    0xF7, 0xB5, 0xF7, 0xEE, 0x52, 0x06, 0x16, 0x09, 0x0C, 0xB0, 0xD4, 0xEF, 0x82, 0x3A, 0x82, 0x39, 0x1F, 0x90, 0x57, 0xAE, 
+    0xD4, 0x12, 0x58, 0x14, 0x14, 0xCE, 0x4D, 0x51, 0xA3, 0xF8, 0x1C, 0x12, 0x9A, 0x80, 0x7B, 0x38, 0x1A, 0xD4, 0xF1, 0x93, 
+    0xBF, 0xF1, 0xED, 0x09, 0x10, 0xC4, 0x86, 0x40, 0xCB, 0x94, 0xB7, 0x65, 0xCA, 0xD9, 0x85, 0x5F, 0xD0, 0x7A, 0x09, 0x1D, 
+    0x1F, 0x32, 0x92, 0x8C, 0x48, 0xB6, 0x40, 0x65, 0x84, 0x57, 0x96, 0xCD, 0x36, 0xED, 0x6A, 0x62, 0xDD, 0x52, 0xBD, 0x6E, 
+    0xE6, 0xB8, 0x30, 0x14, 0x54, 0x42, 0xB9, 0x78, 0x3B, 0x62, 0x76, 0x2C, 0x89, 0x92, 0x11, 0xBD, 0x99, 0xC5, 0x7C, 0x64, 
+    0x2C, 0x92, 0x07, 0xBF, 0xAF, 0xF2, 0x6E, 0x16, 0x84, 0x59, 0xD8, 0x1F, 0xE4, 0x97, 0xD9, 0x20, 0x93, 0x55, 0xC8, 0x30, 
+    0xB3, 0xB4, 0x2F, 0x52, 0x22, 0x4F, 0x68, 0x12, 0xED, 0x46, 0xCF, 0x0E, 0xF2, 0x70, 0x76, 0x41, 0xB3, 0x81, 0x91, 0xB4, 
+    0xCE, 0x44, 0xD7, 0x36, 0x97, 0x13, 0xAC, 0x15, 0x16, 0xD6, 0x06, 0xF7, 0xD3, 0xD9, 0x9C, 0x06, 0x7F, 0x99, 0x07, 0xB4, 
+    0x40, 0xDD, 0xEE, 0x28, 0x4A, 0x87, 0x39, 0xFD, 0x30, 0xF0, 0xE1, 0xF0, 0x0B, 0x24, 0x83, 0x3D, 0x0D, 0xE9, 0xF3, 0xA8, 
+    0x96, 0xD5, 0xEE, 0x0B, 0xA9, 0x32, 0xA2, 0xB5, 0xA6, 0x8D, 0x4D, 0x0B, 0xD5, 0x98, 0x1F, 0x8C, 0xDC, 0x40, 0x3C, 0xB1, 
+    0x37, 0x63, 0xEA, 0xCA, 0xA4, 0x04, 0xFB, 0x69, 0xD4, 0xC9, 0x06, 0x93, 0xCB, 0xF1, 0x60, 0x4C, 0x23, 0xCE, 0xA3, 0x0E, 
+    0x71, 0x50, 0xC3, 0x31, 0xE5, 0x22, 0xA8, 0xA1, 0x86, 0xA7, 0xA7, 0xA7, 0x05, 0xD3, 0x6C, 0x9C, 0x6A, 0x11, 0x59, 0x51, 
+    0xA7, 0x72, 0xDD, 0x7D, 0xD5, 0x68, 0x00, 0xFB, 0x8A, 0x68, 0xA5, 0x21, 0x8F, 0x6F, 0xCA, 0x68, 0xD3, 0x69, 0xD1, 0x34, 
+    0x88, 0xCD, 0x21, 0xD0, 0x92, 0x9F, 0x9E, 0xCE, 0xA4, 0xD1, 0x3C, 0x18, 0x58, 0x20, 0x1F, 0x0B, 0x90, 0xBF, 0xB7, 0x80, 
+    0xE9, 0xA2, 0xDE, 0x77, 0x34, 0xE2, 0x19, 0x58, 0x8F, 0xBB, 0x59, 0x1E, 0x5E, 0x28, 0xC2, 0xFA, 0x0F, 0xAD, 0x50, 0x0B, 
+    0x32, 0x4F, 0x17, 0x6D, 0x40, 0x24, 0xAD, 0xBF, 0x4F, 0x88, 0x62, 0x98, 0x8E, 0x54, 0x1A, 0x25, 0x2A, 0x89, 0x68, 0x72, 
+    0x2A, 0x84, 0x19, 0xD1, 0x34, 0x7E, 0x16, 0x69, 0xF6, 0xC4, 0x92, 0x5C, 0xEA, 0x45, 0x40, 0x33, 0xDE, 0xA4, 0x64, 0x13, 
+    0xDD, 0xB3, 0x54, 0x68, 0x58, 0x65, 0x78, 0x4C, 0xBF, 0x5E, 0x41, 0x00, 0xA2, 0xBD, 0xE8, 0xA1, 0xEB, 0x34, 0x9D, 0xCE, 
+    0x0F, 0x8E, 0x46, 0xFC, 0x76, 0xBB, 0xAA, 0x30, 0x34, 0x13, 0x10, 0xE8, 0x7D, 0x93, 0x6E, 0xEE, 0x82, 0x9E, 0x79, 0x95, 
+    0xEC, 0x68, 0xC5, 0xB6, 0x77, 0x6B, 0xF0, 0xE6, 0xE1, 0xCD, 0x01, 0xDD, 0x67, 0xAE, 0xC5, 0xFB, 0x4C, 0x88, 0xD4, 0x13, 
+    0x22, 0x17, 0xD2, 0x62, 0x73, 0x22, 0x5C, 0xEC, 0x89, 0x19, 0xD8, 0x09, 0x6F, 0x38, 0x2E, 0x7E, 0xF2, 0xF7, 0x62, 0xF2, 
+    0xF9, 0xC3, 0xFA, 0x44, 0xF6, 0xB0, 0x50, 0x48, 0x1E, 0xD3, 0xD3, 0x3B, 0xDF, 0x3B, 0x21, 0xD2, 0xAA, 0x3A, 0xA7, 0xD3, 
+    0xA1, 0x37, 0x94, 0x73, 0xE7, 0xC4, 0xEB, 0xA6, 0x5D, 0x6F, 0xE4, 0x8D, 0x1A, 0xB8, 0x99, 0xF6, 0xA4, 0x69, 0x67, 0x53, 
+    0xF2, 0x11, 0x49, 0xB9, 0x43, 0x2D, 0x59, 0x30, 0x68, 0xA1, 0xAE, 0xB2, 0x1A, 0x7D, 0x10, 0x77, 0x2E, 0xC2, 0x0B, 0x6C, 
+    0x51, 0x4B, 0x40, 0xD0, 0xAE, 0x8D, 0x3B, 0xFD, 0xB0, 0x24, 0xA9, 0xA8, 0x88, 0x3E, 0x7C, 0xBD, 0x25, 0x8F, 0xB7, 0xB2, 
+    0xC4, 0xE9, 0x25, 0xD8, 0x91, 0xB3, 0x0B, 0x06, 0xB3, 0x03, 0x3A, 0xB3, 0x8D, 0x1A, 0xC4, 0x4B, 0xC9, 0x11, 0xA8, 0xA9, 
+    0x9A, 0xA9, 0x6B, 0x75, 0xA3, 0xE6, 0x6A, 0xA1, 0x96, 0x6A, 0xA5, 0xE8, 0x14, 0x53, 0x1B, 0xB5, 0x55, 0x3B, 0x75, 0x17, 
+    0x79, 0xDB, 0xD9, 0x6F, 0xBF, 0xCD, 0x0B, 0xAF, 0x7B, 0x66, 0xA6, 0x5F, 0xBD, 0x75, 0x44, 0x22, 0xEA, 0x9E, 0xB6, 0xC8, 
+    0x03, 0xFD, 0x7B, 0x8C, 0x26, 0x29, 0xF1, 0xA4, 0xBF, 0xC9, 0xCF, 0xA7, 0xF2, 0xF3, 0x59, 0x3B, 0xCF, 0x9E, 0xA0, 0xEB, 
+    0x04, 0x89, 0xF3, 0xA8, 0xD3, 0x0F, 0x14, 0xAD, 0xF7, 0xCB, 0xC8, 0x91, 0x73, 0xA8, 0x57, 0xD1, 0xC5, 0x27, 0x9F, 0x7C, 
+    0x78, 0xA1, 0x3E, 0x27, 0xFE, 0xA0, 0x2E, 0x82, 0xF8, 0x02, 0xFB, 0xFE, 0xCF, 0xD1, 0x17, 0xBD, 0xF5, 0x6A, 0xAD, 0xBE, 
+    0xC4, 0x2F, 0x24, 0x19, 0x5F, 0x99, 0x87, 0xBF, 0xD0, 0x83, 0x08, 0x3C, 0xFE, 0x4A, 0x4F, 0x5A, 0xB8, 0x51, 0xA5, 0x4E, 
+    0x0D, 0x0E, 0x49, 0xA9, 0xD3, 0x99, 0xCB, 0xEB, 0x0D, 0xB2, 0xCB, 0x74, 0x90, 0x0A, 0xB2, 0x64, 0x36, 0x2E, 0xAD, 0xE0, 
+    0xC9, 0x74, 0x50, 0xE2, 0xC9, 0xAF, 0x23, 0x2F, 0x9B, 0x16, 0xD9, 0x4D, 0x91, 0xEF, 0x45, 0x8A, 0x40, 0x0F, 0xC9, 0xF6, 
+    0x71, 0x99, 0xED, 0x93, 0xBB, 0xDD, 0x6A, 0x4C, 0x73, 0xB3, 0xE5, 0x27, 0x3A, 0x6A, 0x1E, 0xF7, 0xE0, 0xBD, 0x37, 0xAB, 
+    0xF9, 0x76, 0x4F, 0x03, 0x2C, 0x36, 0xFB, 0x7C, 0xB6, 0x4D, 0xD2, 0x39, 0x15, 0x98, 0xCE, 0xF2, 0xBC, 0x58, 0xEE, 0x67, 
+    0x5B, 0xC2, 0x3F, 0xFB, 0x39, 0x51, 0xE7, 0xFB, 0xC5, 0xDD, 0x7C, 0x37, 0x5B, 0xCF, 0x8B, 0x3D, 0x0D, 0x76, 0xB9, 0xA7, 
+    0x23, 0x2E, 0x5F, 0x2D, 0xE7, 0x8F, 0x7B, 0x2D, 0x3A, 0xA2, 0xB6, 0x32, 0xFA, 0x40, 0x13, 0xF4, 0x4D, 0xE4, 0x0D, 0xAF, 
+    0xAE, 0x1E, 0x5E, 0xF4, 0xAF, 0xAE, 0x76, 0x57, 0x57, 0x9B, 0xAB, 0xAB, 0xE5, 0xD5, 0xD5, 0x78, 0xE4, 0xA9, 0x6F, 0x23, 
+    0xCF, 0x8F, 0xC3, 0x2B, 0xFA, 0xAF, 0xB7, 0xA7, 0x0C, 0xF7, 0x67, 0xA3, 0xFD, 0xF0, 0x17, 0xCA, 0xD8, 0xEF, 0x9F, 0xD1, 
+    0xDF, 0xA4, 0x3F, 0x0A, 0xBA, 0x9E, 0xFA, 0x2E, 0xFA, 0xD6, 0x1E, 0x82, 0xDE, 0xBD, 0xA7, 0xBC, 0xFB, 0x3F, 0x10, 0xCC, 
+    0x7F, 0x1F, 0x79, 0x57, 0x57, 0x43, 0xAF, 0xFB, 0x4D, 0xD7, 0x7B, 0xEE, 0x7B, 0xDD, 0x6F, 0xBB, 0x5E, 0x40, 0x55, 0xE9, 
+    0xF7, 0xE1, 0xF3, 0x5F, 0x9E, 0xED, 0x3B, 0xFF, 0x1A, 0xC5, 0x51, 0xA0, 0x53, 0xE2, 0xF0, 0x03, 0xBF, 0x6C, 0xEA, 0x17, 
+    0xFC, 0x7E, 0x30, 0x0A, 0x9E, 0x07, 0x1F, 0xEC, 0xAF, 0xBC, 0xFA, 0x87, 0x2B, 0x0F, 0x5F, 0xAE, 0xBC, 0x3D, 0xD5, 0xFB, 
+    0x1D, 0xD5, 0x1B, 0xEC, 0x75, 0x2D, 0x57, 0x57, 0xD4, 0xE7, 0xBF, 0x45, 0x74, 0x34, 0xDB, 0x06, 0xAF, 0xAE, 0x7C, 0xDF, 
+    0xFF, 0xF7, 0xAB, 0x0E, 0xF6, 0xF5, 0x2F, 0x7E, 0x40, 0x13, 0x30, 0x1A, 0xED, 0xBD, 0xEE, 0xF7, 0x54, 0xF3, 0xF3, 0x60, 
+    0xDF, 0xA3, 0x7C, 0x57, 0x68, 0x5A, 0xFD, 0x3D, 0x02, 0x24, 0x0B, 0x12, 0xF0, 0xBD, 0x5F, 0xB8, 0x2F, 0x5D, 0xAE, 0xE0, 
+    0x17, 0x5D, 0x78, 0x14, 0x98, 0xDA, 0xA8, 0xA4, 0x7C, 0x7F, 0x46, 0x13, 0x35, 0xA1, 0x79, 0x7A, 0xDD, 0x52, 0xF8, 0xB9, 
+    0x92, 0x1F, 0xFA, 0xFC, 0xA6, 0xED, 0xB3, 0x3F, 0xBC, 0xEC, 0xFE, 0x0B, 0x5D, 0xA1, 0x97, 0xC0, 0x66, 0xFD, 0xA1, 0x92, 
+    0x35, 0x32, 0x59, 0xA9, 0x03, 0xA3, 0x0F, 0x68, 0x5C, 0xCF, 0x63, 0x77, 0x96, 0xB8, 0xED, 0x7F, 0xB8, 0x25, 0xFE, 0x16, 
+    0xA8, 0x1F, 0xEB, 0x8D, 0xD1, 0xEC, 0x3E, 0xA3, 0x7C, 0x3F, 0x45, 0x4F, 0x5F, 0xBD, 0x0A, 0x2B, 0xDF, 0xFE, 0xA0, 0xA7, 
+    0x98, 0xBE, 0xBE, 0xFC, 0xFA, 0xD3, 0xD7, 0xAF, 0xAB, 0x5F, 0x69, 0xA0, 0xE5, 0xF7, 0x37, 0x9F, 0xFE, 0xB9, 0xFA, 0x15, 
+    0x9F, 0x6A, 0x10, 0x43, 0xFD, 0x97, 0xCC, 0x9F, 0xBE, 0x79, 0xF3, 0xF7, 0xB0, 0xD6, 0x8B, 0xEF, 0x09, 0x9A, 0x5E, 0x7F, 
+    0xFE, 0xC3, 0xAB, 0xEF, 0xEA, 0x1F, 0xA8, 0xCB, 0x2F, 0xBF, 0xFC, 0xEA, 0xEB, 0x5A, 0xD7, 0x42, 0x9F, 0x81, 0x9C, 0x25, 
+    0x3A, 0x7B, 0xC8, 0x6C, 0xF6, 0xCB, 0xDD, 0x14, 0xFF, 0xCE, 0xF0, 0x12, 0x9C, 0xF9, 0x19, 0x11, 0x10, 0xF9, 0x7E, 0x35, 
+    0x3E, 0x03, 0x82, 0xD3, 0x40, 0xA2, 0x67, 0xAB, 0x78, 0x4B, 0xFB, 0x64, 0x95, 0xE7, 0xB4, 0x7A, 0xC3, 0x2E, 0x41, 0x7B, 
+    0xE0, 0x5F, 0x5D, 0xE5, 0xCF, 0x83, 0xE5, 0xBE, 0x84, 0x53, 0xFD, 0x41, 0xBF, 0xD3, 0xE7, 0x2E, 0x01, 0x81, 0x9D, 0x5A, 
+    0x06, 0x08, 0x6F, 0x46, 0x23, 0x81, 0x8C, 0xA3, 0x36, 0x6E, 0xC0, 0xFF, 0xD7, 0x34, 0xCE, 0x67, 0x3A, 0xCB, 0xB2, 0x28, 
+    0xF2, 0xED, 0x4B, 0x91, 0xA4, 0x85, 0x2D, 0xEB, 0x2C, 0xCB, 0x1C, 0x96, 0xBD, 0x2A, 0x6E, 0xF7, 0x13, 0x1A, 0x93, 0x8C, 
+    0xA8, 0x1C, 0x60, 0x75, 0x0C, 0xF4, 0x42, 0xBB, 0x33, 0x0F, 0x62, 0xEE, 0xBA, 0xD3, 0x31, 0x3F, 0x8E, 0x86, 0xBF, 0x50, 
+    0xDF, 0x9F, 0xE9, 0x2E, 0x1E, 0xD4, 0xCF, 0xD1, 0x39, 0x7A, 0x35, 0x5B, 0xAE, 0xEF, 0x76, 0x1A, 0xF1, 0xEC, 0xD1, 0x99, 
+    0x84, 0x50, 0xC5, 0x3E, 0xBD, 0xDB, 0xED, 0x56, 0xCB, 0xE0, 0xD9, 0xF9, 0x4C, 0xFD, 0x93, 0xF2, 0x4D, 0xAF, 0x72, 0x3C, 
+    0x3E, 0x83, 0xDC, 0xF5, 0x97, 0xA7, 0x51, 0xF7, 0xEA, 0xE9, 0x6A, 0xFB, 0xFC, 0x6A, 0xB8, 0x4C, 0x76, 0xB3, 0xB7, 0xC5, 
+    0xC9, 0xD5, 0xFD, 0xB9, 0xFA, 0x55, 0x6A, 0xFB, 0x83, 0x3F, 0x04, 0xA6, 0xA0, 0x69, 0xF1, 0xAF, 0xEE, 0xE9, 0x2F, 0xC1, 
+    0x82, 0x4E, 0xA0, 0xBA, 0x54, 0x92, 0x46, 0xE7, 0x43, 0x1A, 0xD6, 0xB9, 0x4A, 0xE9, 0x89, 0xF6, 0xE0, 0xD5, 0xF9, 0x44, 
+    0x65, 0x69, 0x05, 0xF2, 0x78, 0xBF, 0xD1, 0x76, 0xCB, 0x93, 0xB3, 0xF1, 0xE8, 0xE9, 0x42, 0xFD, 0xF1, 0xC0, 0xA3, 0x88, 
+    0xF7, 0x32, 0x44, 0xDA, 0x7B, 0x3C, 0x02, 0x80, 0x70, 0x9E, 0x46, 0xAD, 0x94, 0x56, 0xE4, 0xF5, 0x1F, 0xE8, 0x74, 0x3D, 
+    0xFB, 0xE3, 0xC7, 0x1F, 0x7F, 0xF8, 0x47, 0x43, 0xF7, 0x80, 0x6A, 0x23, 0x02, 0x21, 0x83, 0xE8, 0xED, 0x32, 0x8F, 0xE5, 
+    0x44, 0xEF, 0x8D, 0x37, 0xAB, 0xC5, 0xCB, 0x69, 0xB2, 0x79, 0x49, 0x67, 0xA3, 0x9F, 0x77, 0xB9, 0x44, 0x10, 0xB6, 0x7E, 
+    0xBC, 0xBC, 0xBC, 0xE8, 0xEF, 0x3F, 0xFE, 0xF8, 0xC5, 0x9F, 0xFE, 0xA8, 0x2E, 0xFA, 0x2F, 0x3E, 0x3C, 0xCD, 0xF7, 0x1F, 
+    0xFF, 0xF1, 0xC3, 0x17, 0xFD, 0xE0, 0xC0, 0x8C, 0xF7, 0x57, 0x9A, 0x78, 0xF9, 0x22, 0xFA, 0x8B, 0x50, 0x2B, 0x6F, 0x7B, 
+    0x0C, 0x6A, 0xDF, 0x52, 0xD9, 0x6D, 0xA0, 0xAA, 0x6F, 0x5F, 0x0C, 0xDD, 0x77, 0x23, 0xCF, 0xB5, 0x07, 0xB4, 0xE6, 0xAF, 
+    0x0B, 0x3A, 0xE3, 0xBE, 0x8A, 0x9E, 0xB8, 0xDE, 0xF0, 0x0B, 0x9D, 0x2B, 0xAE, 0x9E, 0x81, 0x5F, 0x1A, 0x2E, 0x4A, 0xE9, 
+    0x66, 0x53, 0xA2, 0x8D, 0x5A, 0x69, 0xEE, 0xC4, 0x21, 0xB9, 0x35, 0x9D, 0x9D, 0x0C, 0xB3, 0x92, 0x70, 0x0E, 0x06, 0x96, 
+    0x64, 0xCE, 0xE8, 0x54, 0x3A, 0x1C, 0x2C, 0x11, 0x32, 0x4E, 0x79, 0x76, 0xE9, 0x7C, 0x97, 0xBA, 0xC6, 0x74, 0xC4, 0xCB, 
+    0x01, 0xBF, 0xE2, 0x83, 0xFD, 0x5E, 0x3D, 0x80, 0x80, 0xF5, 0xD3, 0x38, 0x85, 0x08, 0xA0, 0xD8, 0xBC, 0xD2, 0xC7, 0xF9, 
+    0x7E, 0x9F, 0x86, 0x6F, 0x03, 0x9A, 0xF7, 0x25, 0x31, 0xD0, 0xD4, 0x33, 0xA2, 0x12, 0x89, 0xC6, 0x58, 0x52, 0x0F, 0x72, 
+    0xB0, 0x42, 0x8A, 0xA5, 0x1D, 0x9A, 0xA8, 0xB4, 0xF7, 0x11, 0xF6, 0x88, 0x64, 0xD6, 0xE5, 0x82, 0x4A, 0xFB, 0x37, 0x44, 
+    0x22, 0x99, 0xB9, 0x21, 0x06, 0xFC, 0x4F, 0x94, 0x76, 0xA3, 0x73, 0x09, 0xED, 0xBC, 0x3E, 0x3D, 0xED, 0x14, 0xCC, 0xE4, 
+    0x8C, 0xA3, 0x5F, 0x99, 0x3B, 0x07, 0x33, 0x45, 0xAF, 0xD7, 0xD1, 0x78, 0x78, 0x31, 0xE2, 0x2F, 0x7F, 0x8A, 0x50, 0x0A, 
+    0x4F, 0x53, 0xAA, 0x6E, 0x52, 0xEC, 0x3E, 0x9F, 0x17, 0xE8, 0xE4, 0x67, 0x8F, 0x5F, 0xE5, 0xFE, 0x75, 0xA0, 0x3A, 0xD3, 
+    0xFD, 0xBE, 0x33, 0xED, 0xAD, 0x09, 0xFC, 0x97, 0x3B, 0xAC, 0x4B, 0xA5, 0x1F, 0xD3, 0xDE, 0x0C, 0xCC, 0xE2, 0xB5, 0x4D, 
+    0x14, 0xB2, 0x7A, 0x4A, 0x40, 0x68, 0x99, 0xD5, 0xDA, 0xE8, 0x89, 0x24, 0x41, 0x4B, 0x95, 0xB4, 0x66, 0xBB, 0x34, 0x9E, 
+    0x1D, 0xB1, 0x62, 0x53, 0xFA, 0x7D, 0x5F, 0x1B, 0x3C, 0xBE, 0xE1, 0x8B, 0x91, 0xF9, 0x6E, 0x40, 0x2E, 0x57, 0xEE, 0x78, 
+    0xB6, 0x9F, 0x3D, 0xBE, 0x49, 0x26, 0x10, 0x02, 0x60, 0x0E, 0x14, 0xF7, 0x9E, 0xE7, 0xE1, 0xC3, 0x11, 0xB5, 0x91, 0x55, 
+    0x73, 0xBE, 0x24, 0x0C, 0xB2, 0x15, 0xE1, 0x41, 0x7A, 0xE4, 0xCB, 0x7B, 0x5B, 0xB3, 0x39, 0x31, 0x1A, 0xEA, 0x2A, 0x78, 
+    0xB5, 0xDE, 0xED, 0x16, 0xAC, 0x6D, 0xE7, 0x96, 0xE6, 0xF4, 0xB6, 0xB7, 0x2B, 0xB6, 0xCC, 0xDD, 0xF2, 0xEC, 0x6F, 0xA3, 
+    0x4D, 0x74, 0x47, 0x84, 0x5E, 0x4A, 0x84, 0x1E, 0xAF, 0xC9, 0xE9, 0x69, 0xA2, 0x2E, 0xE4, 0xC1, 0x11, 0x7D, 0xA5, 0x47, 
+    0x64, 0x19, 0xC1, 0xD3, 0x2A, 0x9A, 0x80, 0x6F, 0xF2, 0x37, 0xB2, 0x8C, 0x9F, 0xEE, 0x08, 0x80, 0x08, 0x5D, 0xD1, 0x69, 
+    0x32, 0xCB, 0x89, 0x1E, 0x88, 0xA9, 0x01, 0x7B, 0xC0, 0xA4, 0xA9, 0x22, 0x84, 0xF2, 0xEC, 0xD4, 0x0B, 0xC2, 0xB4, 0xB7, 
+    0xAD, 0x67, 0x56, 0xB4, 0x15, 0xB7, 0x44, 0xFD, 0xD0, 0xB4, 0x7F, 0xE0, 0x75, 0xB7, 0x5D, 0xEF, 0x83, 0xD1, 0x89, 0xA7, 
+    0xE6, 0xD1, 0xAA, 0xCA, 0x8E, 0xCE, 0xCF, 0xCE, 0x82, 0xD5, 0x70, 0x3E, 0x8A, 0xB6, 0xDD, 0xDB, 0xD4, 0xC7, 0x53, 0x30, 
+    0xB8, 0x8F, 0x92, 0xD4, 0x8C, 0xEB, 0xF4, 0x74, 0x95, 0xD2, 0xE2, 0x3B, 0x90, 0x43, 0x80, 0x4F, 0xA3, 0x5B, 0xF5, 0xAE, 
+    0x57, 0xB3, 0xA5, 0x4F, 0xD8, 0x2A, 0xC0, 0xA4, 0x3C, 0x04, 0xC0, 0x13, 0x8D, 0xD9, 0xBC, 0xEF, 0xF1, 0x85, 0xD2, 0x6B, 
+    0x7D, 0x7F, 0xF4, 0x29, 0xED, 0xE1, 0x07, 0x9E, 0x47, 0x41, 0x02, 0x8F, 0xC1, 0xD3, 0x81, 0x28, 0x59, 0xDA, 0xDA, 0x54, 
+    0x96, 0xEA, 0xA5, 0xA1, 0x2D, 0x56, 0x6F, 0x8B, 0xDA, 0xA8, 0x69, 0xBB, 0xEA, 0x8A, 0x67, 0x7E, 0x29, 0x50, 0xFA, 0xBB, 
+    0xF2, 0x9E, 0x5D, 0xE0, 0x34, 0xE2, 0xBD, 0x5B, 0x6E, 0x68, 0x50, 0xD3, 0x22, 0xCA, 0x07, 0xEF, 0x69, 0x93, 0x53, 0x3F, 
+    0xC3, 0x16, 0xB7, 0xDC, 0x18, 0x43, 0x5F, 0xD6, 0x05, 0x17, 0x73, 0x09, 0x16, 0x8C, 0x88, 0xD4, 0xAF, 0x79, 0x5E, 0x4E, 
+    0x4F, 0x73, 0xEA, 0x2D, 0xF1, 0x3E, 0xE9, 0x30, 0xE9, 0x6D, 0xA7, 0xB3, 0xF1, 0xCE, 0x0F, 0x88, 0x05, 0x1C, 0x72, 0xDE, 
+    0x51, 0x54, 0x98, 0xBE, 0xA4, 0x65, 0x93, 0xD3, 0xD4, 0x15, 0x79, 0x0D, 0xEF, 0x46, 0x44, 0xAC, 0x13, 0x63, 0x6E, 0xBF, 
+    0xCF, 0xD2, 0x92, 0xD3, 0x59, 0xF6, 0x32, 0x3A, 0x82, 0x76, 0x85, 0x06, 0x31, 0xDF, 0xCB, 0x67, 0x6F, 0xBD, 0x60, 0x50, 
+    0xCE, 0x5E, 0xA7, 0x93, 0x40, 0xAE, 0xD6, 0x94, 0x42, 0x9A, 0x89, 0x72, 0x17, 0x03, 0x90, 0x5D, 0xBE, 0xE9, 0xE9, 0x7B, 
+    0x09, 0xE4, 0x2B, 0x18, 0x09, 0x9C, 0xB2, 0x83, 0xEC, 0xAE, 0xD3, 0x2A, 0xD2, 0xD4, 0x9C, 0xDC, 0xDE, 0x0B, 0x9A, 0x72, 
+    0x8A, 0x82, 0x00, 0x23, 0xEF, 0x25, 0xB4, 0x14, 0x5F, 0x26, 0xCB, 0x7C, 0x5E, 0x0C, 0xB3, 0x61, 0x31, 0x22, 0x7C, 0x5A, 
+    0xD6, 0x76, 0x53, 0xA9, 0x2D, 0x05, 0xA8, 0xE7, 0x10, 0xE1, 0xD7, 0x19, 0xB2, 0x8B, 0x28, 0x72, 0x70, 0x1C, 0xED, 0x9C, 
+    0x7F, 0x11, 0xB8, 0xAE, 0xEE, 0x36, 0x59, 0xF1, 0x15, 0xB8, 0x8E, 0xFD, 0xFE, 0x15, 0x91, 0x2E, 0xFF, 0x4A, 0xEA, 0x69, 
+    0xD8, 0xDB, 0x79, 0x05, 0x4F, 0x19, 0x09, 0x49, 0x16, 0x65, 0xBD, 0x25, 0x1D, 0xE6, 0xAF, 0x67, 0xE9, 0x9C, 0xD0, 0x2B, 
+    0x8B, 0x6C, 0xD0, 0x46, 0x60, 0xD8, 0x0E, 0x2B, 0x27, 0x89, 0x2F, 0x42, 0x42, 0xF7, 0xB6, 0xC7, 0x73, 0x77, 0xA1, 0x5C, 
+    0xD9, 0xA6, 0x1E, 0xC2, 0x91, 0x6D, 0x69, 0x38, 0x51, 0xA6, 0x26, 0x98, 0xA7, 0xC4, 0xBC, 0xF3, 0x8D, 0x29, 0x8D, 0xD4, 
+    0x99, 0xDF, 0xC5, 0xFF, 0xA8, 0x7E, 0xDF, 0x69, 0x80, 0xCE, 0x0E, 0xA1, 0x52, 0xF8, 0x2D, 0x38, 0xD2, 0xDE, 0xD2, 0x6D, 
+    0x8F, 0xA0, 0xD0, 0x6D, 0xD2, 0x80, 0x69, 0xD4, 0x25, 0x04, 0xEC, 0x7C, 0x22, 0x5E, 0x56, 0xFA, 0x53, 0x40, 0x0E, 0x0A, 
+    0x49, 0x49, 0x66, 0x0E, 0x4F, 0x02, 0x99, 0x49, 0x34, 0xAE, 0x82, 0xC1, 0x84, 0xC0, 0x80, 0x56, 0x9E, 0x50, 0xEC, 0x64, 
+    0x34, 0xA2, 0xB5, 0x03, 0x14, 0x44, 0x1D, 0x3F, 0xC7, 0x0F, 0x9E, 0xE9, 0x44, 0xC6, 0xFF, 0x6C, 0x97, 0x56, 0x95, 0xBD, 
+    0x40, 0xF8, 0x5F, 0x1F, 0x7C, 0xAD, 0x48, 0x9C, 0x50, 0xE1, 0x4B, 0x02, 0x9B, 0x43, 0x16, 0x8D, 0x09, 0x24, 0x44, 0x52, 
+    0x81, 0x8B, 0xF3, 0x31, 0xDE, 0x67, 0xDB, 0x9F, 0xBE, 0xF9, 0xBA, 0xC9, 0x8C, 0xB3, 0x58, 0x31, 0xA9, 0x9F, 0xC5, 0x49, 
+    0x60, 0xF9, 0x6C, 0xDD, 0x8A, 0xBD, 0xF0, 0x8D, 0xBD, 0x2F, 0xDF, 0x7C, 0xF3, 0x75, 0x15, 0xED, 0x86, 0x1D, 0x88, 0xF0, 
+    0xB8, 0xD5, 0x62, 0x67, 0x6A, 0x69, 0x61, 0xFC, 0x0B, 0x88, 0xE1, 0x1B, 0x6D, 0x85, 0x6F, 0x69, 0x9E, 0x8A, 0x1E, 0x31, 
+    0xA9, 0x09, 0xB1, 0xA1, 0xFF, 0x98, 0x15, 0xF7, 0x56, 0xFE, 0x24, 0xF4, 0x00, 0x50, 0x7F, 0xE1, 0x40, 0x7C, 0x51, 0xEF, 
+    0x5C, 0xEC, 0x2F, 0xA3, 0x42, 0xAD, 0xA2, 0xC6, 0x07, 0xB5, 0x8E, 0x3A, 0x63, 0xBF, 0xA0, 0x85, 0x38, 0x3D, 0xC5, 0xFD, 
+    0xDC, 0x84, 0x20, 0x65, 0x8D, 0x5B, 0xB1, 0x5E, 0x92, 0xE7, 0x9F, 0x13, 0xB5, 0xBC, 0xFB, 0x7A, 0xB6, 0xDD, 0x15, 0xD4, 
+    0x9F, 0xB8, 0x99, 0x04, 0x15, 0x88, 0xF9, 0x2A, 0x21, 0xDC, 0xEF, 0x48, 0x84, 0x16, 0x10, 0x88, 0x77, 0x2E, 0x82, 0x70, 
+    0x82, 0xCD, 0x4C, 0x78, 0x8E, 0x8B, 0x50, 0xED, 0xEE, 0xAB, 0xEF, 0xAD, 0x96, 0x47, 0xCA, 0x42, 0x0C, 0xCB, 0x68, 0x80, 
+    0x31, 0xF2, 0x36, 0x9A, 0x39, 0xB0, 0xE4, 0x0A, 0xFA, 0x33, 0x73, 0x52, 0x46, 0x44, 0x81, 0x13, 0xF5, 0x53, 0x3B, 0xBE, 
+    0xEC, 0x67, 0xC2, 0xE7, 0xA8, 0xB1, 0x0D, 0x1C, 0x8E, 0xD6, 0x4D, 0xC7, 0x49, 0xB1, 0xCC, 0x05, 0xAF, 0x15, 0x1A, 0x81, 
+    0xBE, 0x5C, 0x2D, 0x04, 0x81, 0xD2, 0xB1, 0xA8, 0x9B, 0x6B, 0x12, 0x09, 0x60, 0x1F, 0x35, 0x3C, 0x37, 0x5B, 0xB5, 0x67, 
+    0x7B, 0xF4, 0x4C, 0x4E, 0xBB, 0xE2, 0x18, 0x95, 0x70, 0x7A, 0x7A, 0xAC, 0x67, 0xB3, 0x25, 0xCD, 0x3B, 0xE0, 0x2B, 0xF2, 
+    0x3E, 0x21, 0x4C, 0x7E, 0xC2, 0xC3, 0x8C, 0x3E, 0x48, 0x3E, 0xB8, 0xFC, 0xE4, 0x9C, 0xDE, 0x2F, 0x2B, 0x89, 0x27, 0x33, 
+    0x93, 0xEC, 0xA9, 0xA4, 0xC7, 0x5C, 0x0E, 0x8F, 0xA9, 0x36, 0x77, 0x2F, 0x18, 0x7F, 0x1E, 0x21, 0x43, 0xC0, 0xDE, 0xD4, 
+    0x46, 0x04, 0x62, 0xEB, 0xC8, 0xD4, 0xAD, 0x2A, 0x53, 0x47, 0x9B, 0x84, 0xA8, 0x81, 0x3B, 0xD5, 0xA9, 0x0D, 0x14, 0x15, 
+    0x13, 0x2D, 0xD3, 0x92, 0xEA, 0xDF, 0xB5, 0x35, 0x16, 0xFB, 0x39, 0xF5, 0x7E, 0x99, 0xF7, 0xBE, 0x7A, 0x55, 0x93, 0x5A, 
+    0x41, 0x1E, 0xA4, 0x65, 0x6B, 0x35, 0x6A, 0x50, 0xB6, 0xFA, 0xBA, 0x44, 0x85, 0x35, 0x62, 0xB1, 0xBC, 0x2F, 0xCB, 0x40, 
+    0xC8, 0x95, 0x87, 0x5A, 0x3C, 0xCC, 0xA0, 0x22, 0x70, 0x38, 0x28, 0x34, 0x3A, 0xDF, 0x15, 0x9B, 0x6A, 0xB3, 0xA5, 0x08, 
+    0xD1, 0x50, 0x06, 0x19, 0x91, 0x04, 0xA9, 0xAD, 0xAE, 0x75, 0xD9, 0x9A, 0xA4, 0x15, 0xCE, 0x8F, 0xC3, 0x21, 0x08, 0x7D, 
+    0x7D, 0xFA, 0xDB, 0x11, 0xFE, 0x6F, 0x68, 0x56, 0x86, 0xEC, 0x62, 0x42, 0xDB, 0x38, 0x46, 0xA8, 0xB1, 0x60, 0x23, 0x5D, 
+    0x3A, 0x56, 0x99, 0x96, 0xB7, 0xC9, 0xFC, 0xAE, 0xD0, 0x5D, 0x55, 0xBA, 0x8B, 0x6F, 0x3E, 0xFD, 0x73, 0xD4, 0xBE, 0x9F, 
+    0xE2, 0x56, 0x91, 0x62, 0xCB, 0x02, 0x55, 0x31, 0x72, 0x7C, 0x94, 0xE2, 0x36, 0x52, 0xE7, 0x56, 0x59, 0x7A, 0x0E, 0x79, 
+    0xA3, 0x5C, 0xAF, 0x1D, 0xAD, 0x00, 0xA7, 0x38, 0xED, 0x49, 0x16, 0x16, 0x3E, 0x99, 0xC3, 0x7C, 0xCC, 0x57, 0x1C, 0x01, 
+    0xC8, 0x84, 0xCC, 0x41, 0x9A, 0x9A, 0x43, 0xC8, 0xEC, 0x0C, 0xE4, 0x86, 0xF4, 0x1A, 0x1F, 0xCC, 0xD8, 0x59, 0x42, 0x13, 
+    0x1D, 0xA7, 0xFB, 0xFF, 0x8D, 0x09, 0xB0, 0xA5, 0x34, 0xA4, 0xC6, 0x47, 0x39, 0x81, 0x72, 0x1E, 0xD4, 0x06, 0x63, 0xBE, 
+    0xC5, 0x1F, 0x61, 0x0B, 0x4A, 0x4C, 0x52, 0xA7, 0x7B, 0xC1, 0x0B, 0xF9, 0xB5, 0x4D, 0x5A, 0x45, 0x1F, 0x22, 0xA5, 0x38, 
+    0x59, 0x6C, 0x89, 0xCA, 0x5B, 0xDD, 0x67, 0xF3, 0xD9, 0x3A, 0xFA, 0x80, 0xF0, 0xC5, 0x6A, 0xCD, 0xE7, 0xAA, 0x11, 0x9E, 
+    0x72, 0xDA, 0xB9, 0x24, 0xD2, 0x83, 0x24, 0x33, 0x3E, 0x69, 0x50, 0xDA, 0xDE, 0xD0, 0xA9, 0xEB, 0x17, 0x2A, 0x38, 0xB2, 
+    0xA8, 0xE3, 0xF4, 0xF4, 0x56, 0x66, 0xD7, 0x83, 0xC0, 0x72, 0x14, 0x95, 0xB2, 0x4A, 0xC8, 0x0E, 0xAF, 0x58, 0x60, 0xD5, 
+    0x5A, 0xA3, 0xE9, 0x46, 0x59, 0xD5, 0x7E, 0x6F, 0xAA, 0x2A, 0xA5, 0xA2, 0x71, 0xC8, 0x80, 0xBA, 0x17, 0xA1, 0xD0, 0x91, 
+    0xBA, 0x42, 0x2D, 0x17, 0x6E, 0xA9, 0xA9, 0xFC, 0x44, 0x60, 0x5E, 0x9B, 0x34, 0xD9, 0x76, 0x45, 0x9D, 0x8C, 0x16, 0xD2, 
+    0x29, 0x18, 0xD4, 0x39, 0x21, 0x2C, 0x36, 0x31, 0x29, 0x22, 0x41, 0xE6, 0x9E, 0xB8, 0x18, 0x31, 0x0D, 0x6A, 0xD9, 0x97, 
+    0x38, 0xA1, 0x94, 0xF7, 0xEA, 0xD8, 0xF8, 0xF1, 0x3D, 0xCA, 0xDB, 0x26, 0x92, 0x4B, 0x8A, 0x70, 0xCB, 0xCA, 0x80, 0x8F, 
+    0x8D, 0xBC, 0x58, 0xB2, 0x5C, 0xBB, 0x6D, 0xE4, 0xE6, 0x93, 0xF2, 0x42, 0x23, 0xFE, 0x3E, 0x52, 0xCB, 0x73, 0x15, 0x3E, 
+    0xD0, 0x27, 0x53, 0x52, 0xF5, 0x9E, 0x87, 0x1E, 0x1F, 0xD7, 0x04, 0x8A, 0x0B, 0x70, 0x0F, 0xC5, 0xD6, 0xE4, 0x37, 0x60, 
+    0xB9, 0x25, 0xB6, 0x4D, 0x7F, 0xDA, 0xEF, 0x57, 0xBD, 0xFB, 0x22, 0xBD, 0x99, 0xED, 0xBE, 0xA9, 0xE6, 0xC5, 0x87, 0xC5, 
+    0xEA, 0xB7, 0x96, 0xD4, 0x55, 0x5B, 0xCE, 0x6D, 0x2D, 0x31, 0x68, 0x1E, 0x96, 0x59, 0x8F, 0x46, 0x92, 0xAD, 0x08, 0xD4, 
+    0x01, 0x39, 0x9C, 0x3F, 0xDA, 0x5A, 0xBD, 0x0D, 0xE6, 0x7F, 0x54, 0xF9, 0x3E, 0xDC, 0x76, 0x00, 0xAA, 0x3C, 0xB6, 0x8D, 
+    0x1E, 0x5B, 0x27, 0xF2, 0xD4, 0xDF, 0x00, 0x0B, 0xB7, 0xD1, 0xAD, 0x9D, 0x78, 0x47, 0xAE, 0x76, 0xAB, 0x99, 0xD1, 0x3D, 
+    0x68, 0x81, 0x0D, 0xB1, 0xC8, 0x2D, 0x79, 0x36, 0x6E, 0x9E, 0xD4, 0xCC, 0xC8, 0xAA, 0x97, 0xAD, 0x16, 0x38, 0x6C, 0x0C, 
+    0x79, 0xF7, 0xFD, 0x6A, 0x3B, 0x43, 0xC7, 0x03, 0xB5, 0x83, 0x3C, 0xC7, 0xC9, 0xB6, 0xDC, 0x25, 0xB3, 0xE5, 0x36, 0x88, 
+    0xDB, 0xE4, 0x4F, 0x7F, 0xAA, 0xB0, 0x3C, 0x71, 0x52, 0x27, 0xEB, 0x42, 0xB0, 0x46, 0x69, 0x95, 0x5B, 0x1B, 0x38, 0x57, 
+    0x3C, 0x39, 0x1D, 0xBF, 0x7E, 0x87, 0xFE, 0x42, 0x24, 0x94, 0x3B, 0xDA, 0x30, 0x1D, 0x3F, 0xB3, 0x4D, 0xC7, 0xE5, 0x23, 
+    0x31, 0x46, 0x61, 0x72, 0xAC, 0xEB, 0xC4, 0x71, 0xFD, 0xF1, 0xF4, 0xE8, 0x57, 0x2A, 0xDA, 0x94, 0xA2, 0xF1, 0x3D, 0xBA, 
+    0xE0, 0xE3, 0x34, 0xAA, 0x70, 0xFB, 0xF8, 0xE2, 0xDC, 0xED, 0x74, 0xFA, 0x03, 0xCB, 0x90, 0xAA, 0xCF, 0xA2, 0x34, 0x6E, 
+    0xD4, 0x93, 0x38, 0x9C, 0xD8, 0x09, 0xAE, 0xAD, 0x54, 0x7F, 0x20, 0x82, 0xCB, 0xCE, 0xD1, 0x3E, 0x9D, 0x75, 0xD2, 0x63, 
+    0x9F, 0x2C, 0xF2, 0x8F, 0x73, 0x3A, 0x9B, 0xA3, 0x36, 0xCA, 0x9F, 0x1A, 0xF4, 0x9B, 0xC2, 0xB9, 0x20, 0x3E, 0x3E, 0x05, 
+    0x69, 0x10, 0x5E, 0xA8, 0x8B, 0x53, 0xCC, 0xBA, 0x28, 0x0B, 0xBE, 0x2A, 0x40, 0x0A, 0x17, 0x39, 0x56, 0xE8, 0x58, 0x21, 
+    0x6E, 0x28, 0x8F, 0x31, 0xBE, 0x02, 0x2A, 0x4B, 0x95, 0x06, 0x29, 0xF1, 0x2D, 0x84, 0x5D, 0x6F, 0x55, 0x12, 0xC4, 0x67, 
+    0x17, 0x61, 0x2A, 0xB9, 0xD2, 0x63, 0xB9, 0xA8, 0x7B, 0x17, 0xE1, 0x4D, 0xFC, 0x57, 0x01, 0xFB, 0x1B, 0x2A, 0x75, 0x66, 
+    0x9F, 0xA9, 0x77, 0xFD, 0xF0, 0xA3, 0xD3, 0x1C, 0xF5, 0x5C, 0xB4, 0x2D, 0xD5, 0xB1, 0x29, 0xCE, 0x58, 0xE3, 0x00, 0xDA, 
+    0x2D, 0xE5, 0x02, 0x12, 0xA7, 0xE2, 0xAE, 0xA7, 0x9A, 0x46, 0xC3, 0x64, 0x84, 0x7B, 0xF9, 0x94, 0x85, 0x8B, 0x9D, 0x31, 
+    0xCD, 0x81, 0x55, 0x9E, 0xE0, 0xB1, 0xD9, 0xEE, 0x53, 0x0F, 0xC7, 0x78, 0x99, 0xBC, 0xBB, 0xAB, 0x03, 0x96, 0x4C, 0x12, 
+    0xAB, 0x62, 0x6A, 0xD1, 0x72, 0x81, 0x41, 0x16, 0x25, 0x83, 0x92, 0x61, 0x77, 0x60, 0x6A, 0xDA, 0xBB, 0x5B, 0x8A, 0x64, 
+    0x25, 0x43, 0xAE, 0xB4, 0x3D, 0xD7, 0xCC, 0xCD, 0x25, 0x39, 0xA6, 0xD0, 0x0D, 0x8C, 0xA2, 0x19, 0x14, 0x23, 0xF2, 0x6E, 
+    0xB7, 0x84, 0x0D, 0x6A, 0x12, 0xDF, 0x14, 0x7F, 0x09, 0x75, 0xB6, 0xB7, 0xE8, 0xFC, 0xCC, 0x3C, 0x5F, 0x84, 0x74, 0x5E, 
+    0x17, 0x41, 0xB8, 0x24, 0xF6, 0x32, 0x35, 0x58, 0xB0, 0xFD, 0xD2, 0x95, 0x65, 0xC2, 0x10, 0x9D, 0xC8, 0x1F, 0x68, 0x39, 
+    0x95, 0x45, 0x2C, 0x4E, 0x6D, 0x2C, 0x4B, 0x1B, 0x6C, 0x1A, 0xF9, 0x70, 0xC2, 0xF2, 0x61, 0x4B, 0x2B, 0xFE, 0xA0, 0xBC, 
+    0xE8, 0x83, 0x67, 0x17, 0x38, 0x91, 0x15, 0x6D, 0xFC, 0x06, 0xC2, 0xA6, 0x45, 0x59, 0xEF, 0xF7, 0x9B, 0xD3, 0xD3, 0x8D, 
+    0xE0, 0x9F, 0x34, 0xA0, 0x23, 0x02, 0x67, 0x8D, 0x7E, 0x0B, 0x58, 0xDC, 0x26, 0xDB, 0x6A, 0xEB, 0xA8, 0x9F, 0x41, 0x64, 
+    0xB2, 0xDF, 0xB7, 0x20, 0x5C, 0x00, 0x6C, 0x6E, 0x65, 0xB7, 0x17, 0x40, 0x33, 0x65, 0x42, 0x29, 0x7F, 0xB6, 0x94, 0x96, 
+    0x16, 0xD2, 0x07, 0x4F, 0x87, 0x72, 0x4E, 0x52, 0xB5, 0x94, 0x09, 0x21, 0x08, 0x32, 0x27, 0xD7, 0x65, 0x9F, 0xE7, 0xC6, 
+    0xE0, 0xA5, 0xD6, 0xF9, 0x7C, 0xCF, 0xBC, 0x18, 0xBD, 0x77, 0xAA, 0x06, 0x6C, 0x66, 0xAD, 0x8A, 0x77, 0x17, 0x66, 0xB0, 
+    0xA7, 0x03, 0xD9, 0x95, 0x53, 0xD5, 0x34, 0x0E, 0xA0, 0xFB, 0x42, 0x94, 0xE0, 0xE7, 0x32, 0x4B, 0x6E, 0x4E, 0x55, 0xCB, 
+    0x19, 0xC4, 0x05, 0xDF, 0x05, 0x74, 0xD6, 0x86, 0xC0, 0xAB, 0xAA, 0xF0, 0x51, 0xB3, 0xE3, 0x78, 0x1C, 0xBA, 0xDC, 0x30, 
+    0xD6, 0x29, 0xAE, 0xB1, 0x13, 0xB4, 0x27, 0xA0, 0x38, 0xD2, 0x24, 0xE7, 0x53, 0x9C, 0x8D, 0xE3, 0xDE, 0x76, 0x5D, 0x64, 
+    0xB3, 0xF1, 0xAC, 0xC8, 0xE3, 0xB1, 0xD0, 0xF3, 0x21, 0x4B, 0xE9, 0x30, 0x7E, 0x56, 0x4F, 0x8D, 0xDE, 0xA5, 0x9E, 0xEA, 
+    0xBD, 0x7E, 0xA4, 0x99, 0x7E, 0x38, 0xE1, 0x9C, 0xEA, 0xE4, 0x6E, 0xB9, 0x29, 0xB2, 0xD5, 0x64, 0x39, 0xFB, 0xAD, 0xC8, 
+    0x4F, 0x8A, 0x87, 0xF5, 0xA6, 0xD8, 0x6E, 0xA1, 0xA4, 0x7A, 0xE2, 0x75, 0x13, 0x99, 0xD2, 0xBB, 0xE5, 0x8C, 0x48, 0x87, 
+    0xD7, 0x10, 0xAC, 0x34, 0xC5, 0x1B, 0x0E, 0xC9, 0xCE, 0xDB, 0x98, 0x70, 0x09, 0xC1, 0x0E, 0xB1, 0x3F, 0xD9, 0xEE, 0xD5, 
+    0x1D, 0xB4, 0xA6, 0x89, 0xC2, 0xDA, 0xAA, 0x9B, 0x48, 0x63, 0xC9, 0xD7, 0x3B, 0xD0, 0x23, 0x60, 0x55, 0x58, 0x71, 0xC0, 
+    0xEF, 0x83, 0x30, 0xC1, 0x07, 0xFF, 0xB3, 0x40, 0xCD, 0x0D, 0x41, 0x4F, 0x3C, 0xD1, 0x70, 0x0C, 0x82, 0x9E, 0xCF, 0x8D, 
+    0xE1, 0x18, 0x52, 0x23, 0x2C, 0x11, 0x1F, 0xE5, 0xE3, 0x20, 0x70, 0xE4, 0x8B, 0x89, 0xD6, 0xCD, 0x66, 0x71, 0x92, 0x22, 
+    0x5C, 0x67, 0x30, 0x08, 0x0B, 0x2E, 0xA1, 0xDB, 0x54, 0x40, 0x46, 0x43, 0x33, 0xF9, 0x06, 0xFA, 0xF9, 0x2D, 0x8A, 0x19, 
+    0x91, 0xE7, 0x59, 0xA4, 0x67, 0xA0, 0x98, 0x11, 0x12, 0xEF, 0x48, 0xB0, 0x14, 0x84, 0xE0, 0xFE, 0x24, 0x3F, 0x17, 0xFC, 
+    0xCA, 0x1F, 0x9A, 0xFA, 0x67, 0x3D, 0xDC, 0x0E, 0xF2, 0x8D, 0xE5, 0x72, 0x67, 0xD1, 0xA1, 0x9B, 0xC8, 0xBA, 0x64, 0x49, 
+    0xE4, 0xF2, 0xED, 0x83, 0x64, 0x80, 0x04, 0x57, 0x14, 0x99, 0x75, 0x23, 0x56, 0xDF, 0x35, 0xD7, 0x26, 0x1F, 0x4A, 0xD3, 
+    0x1F, 0x71, 0xCB, 0x15, 0xAD, 0xC6, 0x7F, 0x60, 0xE9, 0x25, 0x5F, 0x39, 0x6F, 0x7C, 0x57, 0xC5, 0x75, 0x94, 0x9C, 0x64, 
+    0x46, 0xDC, 0x8E, 0x48, 0xAA, 0x04, 0x37, 0x6C, 0xA3, 0x27, 0x47, 0x5C, 0x1D, 0x7E, 0xDC, 0x57, 0x42, 0x0A, 0x7F, 0xBF, 
+    0x2D, 0xEE, 0xF2, 0x55, 0x38, 0x4D, 0x15, 0x23, 0x93, 0xF0, 0x27, 0x55, 0x82, 0x3A, 0x74, 0xAF, 0xC1, 0x30, 0xE1, 0x77, 
+    0x53, 0xCC, 0xF9, 0x66, 0x33, 0x7C, 0xF2, 0x2E, 0xBD, 0xF0, 0x29, 0x9F, 0x6D, 0x42, 0xAF, 0x44, 0xBB, 0x9E, 0x36, 0x18, 
+    0x80, 0x4E, 0xAF, 0x77, 0xD2, 0xF2, 0x9D, 0x92, 0xBB, 0x36, 0x79, 0x53, 0xBC, 0x9D, 0xAD, 0xEE, 0xB6, 0x7A, 0xF4, 0x95, 
+    0xB2, 0xFF, 0x3A, 0x96, 0x89, 0x38, 0x79, 0x4A, 0xFA, 0x82, 0x79, 0xEA, 0xF0, 0x89, 0xAF, 0xC5, 0xDB, 0x78, 0xF4, 0xE1, 
+    0xC5, 0x28, 0xC2, 0x9F, 0x1A, 0x7F, 0xAD, 0x92, 0xE1, 0x87, 0x23, 0x22, 0x03, 0xE8, 0x2F, 0xA1, 0x82, 0xE1, 0x47, 0xFC, 
+    0xF7, 0x63, 0x68, 0xBC, 0x3A, 0x1A, 0x8B, 0x3A, 0xAB, 0xF7, 0xAF, 0x88, 0x59, 0xCD, 0xE1, 0x0B, 0xC0, 0x20, 0x17, 0xF4, 
+    0xB0, 0x33, 0xE8, 0x81, 0x05, 0xFF, 0xCA, 0x02, 0xB2, 0xFA, 0x88, 0x76, 0x8B, 0xDC, 0xB8, 0xBF, 0xB3, 0x2F, 0x15, 0x7C, 
+    0xA1, 0xBC, 0xE5, 0x6E, 0x2A, 0x0D, 0xD0, 0x27, 0x53, 0xD3, 0x87, 0x41, 0xAC, 0x7B, 0x67, 0x36, 0x34, 0xBD, 0xF6, 0x47, 
+    0xE8, 0xF8, 0x47, 0xA3, 0xA8, 0xEB, 0xE3, 0x27, 0x46, 0x97, 0xF1, 0xF8, 0x47, 0xCA, 0x76, 0x11, 0x84, 0x2F, 0x9E, 0xFB, 
+    0x1E, 0xAE, 0xC2, 0xA5, 0xB2, 0x0F, 0x59, 0x7F, 0x37, 0xCF, 0xCD, 0x5B, 0x80, 0xB2, 0x1F, 0x4B, 0xD9, 0xFF, 0x35, 0xA2, 
+    0xEE, 0xFF, 0x57, 0x23, 0x43, 0x88, 0x1F, 0x42, 0x2E, 0xB5, 0x16, 0x0F, 0x46, 0xBD, 0xA0, 0x6D, 0xE7, 0x74, 0xD0, 0x3C, 
+    0x6D, 0x66, 0x9A, 0x1D, 0x03, 0x6A, 0x3F, 0xF5, 0x78, 0x0E, 0xF4, 0xDD, 0x0F, 0xEA, 0x88, 0xB1, 0x11, 0x43, 0x1E, 0x50, 
+    0x8C, 0x9C, 0x51, 0x75, 0xCA, 0xC3, 0xEC, 0xF4, 0xF4, 0x1F, 0x92, 0x1D, 0x42, 0x6A, 0x82, 0xE1, 0x89, 0x9F, 0xC1, 0xEE, 
+    0x4B, 0x5E, 0xAC, 0xD1, 0x94, 0x4F, 0x5C, 0xA0, 0x95, 0x33, 0x9F, 0xA5, 0xC1, 0x99, 0x79, 0x66, 0x95, 0x63, 0x6A, 0x28, 
+    0xC2, 0x1F, 0x3B, 0x87, 0xBC, 0xCC, 0xD4, 0x58, 0xE6, 0xA4, 0xB8, 0xAB, 0xF5, 0x21, 0x51, 0xB0, 0x00, 0x68, 0x01, 0x21, 
+    0xA8, 0x61, 0xBC, 0x5F, 0x30, 0xD3, 0x2E, 0xD2, 0x17, 0x59, 0x44, 0xDC, 0xD0, 0xA0, 0xEB, 0x54, 0x84, 0x1C, 0xFF, 0xB6, 
+    0x42, 0x32, 0xF5, 0x4E, 0x94, 0x47, 0x9A, 0xFD, 0x7A, 0x1C, 0x26, 0x7C, 0x93, 0x64, 0xE5, 0xD3, 0x6C, 0x65, 0xE1, 0x2A, 
+    0x09, 0xF8, 0xBF, 0x58, 0x05, 0x18, 0xCA, 0x2A, 0x9A, 0x01, 0x50, 0x6D, 0xC0, 0xA4, 0xE2, 0x32, 0xBC, 0xA5, 0x5F, 0xFA, 
+    0xBA, 0xAE, 0x05, 0xAD, 0x65, 0xA5, 0x30, 0xC4, 0x79, 0xD9, 0xEF, 0x5B, 0xA5, 0x51, 0x6D, 0x92, 0x28, 0x2D, 0xBA, 0xF5, 
+    0x02, 0xDE, 0x62, 0x07, 0xDA, 0x27, 0xB5, 0x2D, 0xAB, 0x5C, 0x03, 0x26, 0x9B, 0x6C, 0x2E, 0x19, 0x22, 0x7D, 0xAC, 0xFB, 
+    0xB9, 0x63, 0x84, 0x25, 0xBA, 0xC6, 0x45, 0x0C, 0xC6, 0x0E, 0xD3, 0x15, 0xA6, 0xB1, 0x5F, 0x74, 0x81, 0xCB, 0x3D, 0x49, 
+    0x88, 0x21, 0xE4, 0xCA, 0x42, 0xF3, 0x3D, 0x46, 0xCF, 0xE8, 0xF5, 0x17, 0xFD, 0x4A, 0x50, 0xD7, 0x67, 0x11, 0xBB, 0x01, 
+    0xAF, 0x2C, 0x08, 0xBD, 0xE7, 0xE5, 0x47, 0xF7, 0xC3, 0x25, 0x11, 0x81, 0xDE, 0x33, 0xF7, 0x9B, 0x40, 0x51, 0x09, 0x82, 
+    0xD2, 0xD4, 0xBF, 0x74, 0x16, 0x28, 0x36, 0x76, 0x0B, 0xC6, 0x0F, 0xF5, 0x5A, 0xF6, 0x6E, 0xE7, 0xF6, 0xFB, 0xC2, 0xC2, 
+    0xA3, 0xA9, 0xAA, 0x7B, 0xC1, 0x95, 0x75, 0xBD, 0x33, 0x2F, 0x84, 0xC8, 0x9D, 0xA0, 0xA8, 0x89, 0x56, 0x8C, 0x85, 0x91, 
+    0xD6, 0x37, 0x88, 0x18, 0x8B, 0x30, 0x3D, 0x56, 0x82, 0x37, 0x51, 0xED, 0x1E, 0xF4, 0x5F, 0xDC, 0xF4, 0xB3, 0x8F, 0x60, 
+    0x01, 0xE4, 0x69, 0xED, 0x1E, 0xEE, 0x89, 0x99, 0x4F, 0x1C, 0x6C, 0xB9, 0x9E, 0x93, 0xB8, 0xC5, 0xF8, 0xA3, 0xE3, 0x72, 
+    0x04, 0x0E, 0x60, 0xA3, 0x27, 0x33, 0xE9, 0x47, 0x45, 0xA9, 0x31, 0x1A, 0xE3, 0xEA, 0x21, 0xF6, 0x9C, 0x93, 0xCD, 0x6B, 
+    0xC1, 0xF6, 0xB7, 0x55, 0xD6, 0x62, 0x03, 0xC5, 0xE1, 0x63, 0x77, 0x5C, 0x6A, 0x1B, 0x75, 0x66, 0xA7, 0xA7, 0x9D, 0x29, 
+    0x4E, 0xE7, 0x5B, 0x51, 0x67, 0x30, 0x14, 0xC3, 0x3A, 0x78, 0x9A, 0x5B, 0x2E, 0x60, 0x1E, 0xCD, 0x87, 0xEB, 0x11, 0xF8, 
+    0xCE, 0x69, 0x3C, 0x3F, 0xBE, 0xC5, 0x36, 0xAC, 0xF7, 0x39, 0xAF, 0x93, 0xAE, 0x9D, 0x8B, 0xC1, 0x2A, 0x5A, 0xD3, 0x2C, 
+    0x2D, 0xE7, 0xAC, 0xFD, 0x99, 0x50, 0x93, 0xAB, 0xD3, 0xD3, 0xCA, 0x48, 0x0E, 0x76, 0x8B, 0x53, 0x23, 0xAB, 0x68, 0x38, 
+    0x89, 0x6F, 0x9D, 0x43, 0x3D, 0xBC, 0xED, 0x61, 0xE6, 0xF9, 0x79, 0x84, 0x6B, 0x98, 0x6D, 0xF0, 0x74, 0x13, 0xDD, 0x0E, 
+    0xEF, 0x08, 0xE1, 0xF9, 0xF8, 0x61, 0x53, 0xAC, 0xEB, 0xE8, 0x86, 0xA8, 0x60, 0x56, 0xF4, 0x58, 0x46, 0xD7, 0x40, 0x60, 
+    0x51, 0x74, 0x7F, 0x7A, 0x7A, 0x4D, 0x27, 0x81, 0x5A, 0x54, 0x12, 0x5E, 0x8C, 0xD4, 0x1C, 0xE4, 0xEA, 0xAD, 0xA3, 0x14, 
+    0x33, 0x5C, 0x8E, 0xEC, 0x68, 0xBB, 0x5D, 0xFA, 0x38, 0xA7, 0xFF, 0xD3, 0xA8, 0xA9, 0x85, 0x45, 0xB4, 0x8C, 0xFA, 0x01, 
+    0x44, 0x2B, 0xEB, 0xD5, 0xDA, 0x67, 0x3D, 0x8F, 0xEA, 0x40, 0x4F, 0x4F, 0xBB, 0xDD, 0x05, 0x65, 0x67, 0x1E, 0xF0, 0x09, 
+    0xBD, 0x88, 0x86, 0xF7, 0xB4, 0x6C, 0x8B, 0xD1, 0x40, 0x0C, 0x04, 0x2C, 0xED, 0xB1, 0x65, 0xD3, 0x33, 0x3F, 0x95, 0xAE, 
+    0xA7, 0xBA, 0xEB, 0x01, 0xA8, 0x77, 0x74, 0x4C, 0xBA, 0x18, 0xA0, 0xB7, 0x17, 0xA3, 0x81, 0x43, 0x88, 0xFC, 0x9E, 0x3E, 
+    0xFD, 0x9B, 0x8B, 0xA3, 0x3B, 0xCD, 0x5D, 0xF2, 0xE7, 0xD2, 0xA1, 0xB9, 0xD3, 0x21, 0x0C, 0x61, 0x41, 0x27, 0x96, 0x8C, 
+    0xAA, 0x6A, 0xB3, 0xB0, 0x38, 0x8B, 0x0A, 0x9A, 0x53, 0x16, 0x92, 0x2C, 0xFE, 0x13, 0x4A, 0x24, 0x7D, 0x22, 0xFE, 0xCF, 
+    0x73, 0x18, 0x2D, 0x1D, 0x5A, 0x4E, 0x38, 0x47, 0xBB, 0x1B, 0x54, 0x27, 0x53, 0x45, 0x5B, 0x5E, 0xAC, 0x1C, 0xC2, 0x3E, 
+    0x21, 0x3C, 0x28, 0xA1, 0xC6, 0x26, 0x38, 0xE7, 0xB5, 0x47, 0x8C, 0xA7, 0x5C, 0x46, 0x12, 0x55, 0x2D, 0x15, 0x08, 0x45, 
+    0x6D, 0xAF, 0xF9, 0xA8, 0xEB, 0x31, 0x53, 0xFA, 0x85, 0xE1, 0x83, 0x2E, 0xA0, 0x0C, 0x3E, 0x4C, 0x54, 0xA2, 0x08, 0x8B, 
+    0xA5, 0x23, 0xE5, 0xB6, 0x55, 0xD3, 0xCC, 0xF5, 0x93, 0x3A, 0xDF, 0xE1, 0xDE, 0xCF, 0x26, 0xAE, 0x4E, 0x3D, 0x33, 0x24, 
+    0x47, 0x6E, 0x65, 0xF3, 0xE8, 0xAF, 0x86, 0xF3, 0xC3, 0xE5, 0x2C, 0x8E, 0xCC, 0x1C, 0x57, 0xB3, 0x19, 0x7E, 0x38, 0xE5, 
+    0x10, 0xB4, 0x9D, 0x61, 0xA8, 0x93, 0x50, 0x16, 0xBE, 0x16, 0xA0, 0xC5, 0x64, 0x82, 0xC2, 0xA7, 0xE5, 0x6A, 0x17, 0x4E, 
+    0xDB, 0x64, 0xAD, 0xB8, 0x22, 0x16, 0x13, 0xE9, 0x69, 0x53, 0xFF, 0xA2, 0x94, 0xCE, 0x63, 0x4E, 0xAA, 0x03, 0x01, 0x7A, 
+    0xB1, 0x6A, 0x55, 0x93, 0x28, 0x37, 0x5C, 0x75, 0xA1, 0x86, 0x23, 0xE0, 0xB2, 0x9A, 0xC6, 0x01, 0xEC, 0x19, 0x89, 0x73, 
+    0x9A, 0xC0, 0x6A, 0x91, 0xC9, 0x82, 0x29, 0x86, 0x93, 0xE2, 0x67, 0x1C, 0x54, 0x07, 0x03, 0x6D, 0xEC, 0xF2, 0xF0, 0x63, 
+    0xFA, 0x41, 0xE5, 0x60, 0x50, 0x51, 0x3D, 0xDB, 0x08, 0x10, 0xCB, 0xC2, 0xC0, 0x8A, 0x8B, 0x12, 0x9A, 0xFE, 0xFA, 0xC8, 
+    0x5A, 0xEE, 0xE8, 0x5D, 0xE6, 0x3F, 0x75, 0xF8, 0x5B, 0xDC, 0x7C, 0x69, 0xF6, 0xF6, 0x77, 0xD7, 0xE2, 0xA7, 0x2E, 0xEB, 
+    0x00, 0x39, 0x10, 0x4B, 0xFA, 0xC1, 0xC5, 0xD0, 0xB9, 0x01, 0x4E, 0xD0, 0x9E, 0x2D, 0x09, 0xCE, 0x16, 0x34, 0x32, 0x4F, 
+    0x96, 0x93, 0x23, 0x0D, 0xFC, 0xA8, 0x29, 0x32, 0x3E, 0x82, 0x8F, 0x01, 0x2A, 0x97, 0x67, 0x30, 0x55, 0xC9, 0x7B, 0xA8, 
+    0x1F, 0xD5, 0xD0, 0x4D, 0x18, 0xE4, 0xAB, 0x13, 0x56, 0xA3, 0xC0, 0xBD, 0x07, 0xD7, 0x54, 0xD7, 0x3F, 0x7A, 0x58, 0xCC, 
+    0x43, 0x7C, 0x40, 0x07, 0xEA, 0xDF, 0x24, 0xDD, 0x9A, 0xC9, 0x10, 0xDD, 0x56, 0x6D, 0x0E, 0xDA, 0x19, 0x89, 0xE8, 0xE1, 
+    0x97, 0x24, 0x61, 0x82, 0x63, 0xD2, 0x70, 0x83, 0x75, 0xB1, 0x63, 0x5D, 0x6B, 0x24, 0x28, 0xC5, 0x8E, 0x34, 0x55, 0xBB, 
+    0x64, 0x53, 0xB1, 0x2A, 0x77, 0xF5, 0x00, 0x57, 0x59, 0x22, 0x42, 0xD0, 0xF2, 0x19, 0xFB, 0x6F, 0x5A, 0xB9, 0x47, 0x93, 
+    0x13, 0xF5, 0x42, 0x8C, 0xC7, 0x66, 0x39, 0x31, 0x45, 0xAB, 0x55, 0xAB, 0x95, 0x3A, 0x24, 0x62, 0x2B, 0x22, 0x35, 0xA1, 
+    0xA7, 0x7E, 0xEC, 0xFB, 0xB2, 0x97, 0x64, 0x60, 0xA8, 0xB4, 0xAC, 0x17, 0xAA, 0x61, 0xDC, 0xE4, 0x17, 0xAC, 0xDC, 0xBE, 
+    0x2F, 0x9F, 0x7D, 0x50, 0x70, 0x9D, 0x0E, 0xF6, 0x3F, 0x0B, 0x77, 0x93, 0xDE, 0x74, 0x53, 0x10, 0x77, 0xF8, 0x2F, 0x4A, 
+    0x48, 0x52, 0x56, 0x7C, 0x61, 0x4B, 0x68, 0x96, 0xFA, 0xB7, 0x93, 0x9F, 0xE6, 0x4E, 0x80, 0x6D, 0xBB, 0x88, 0x31, 0xD4, 
+    0xAF, 0xEF, 0xCF, 0x4C, 0x2C, 0x99, 0xBE, 0x54, 0x69, 0xA5, 0x95, 0x7F, 0xA7, 0xE2, 0x4B, 0x8A, 0xFE, 0x13, 0x1D, 0xA9, 
+    0x35, 0xFA, 0x89, 0x0B, 0x59, 0x1B, 0xD3, 0x0C, 0xFD, 0xC9, 0x5C, 0x10, 0x1D, 0x94, 0x79, 0x6A, 0xEF, 0x9B, 0xAB, 0xC3, 
+    0xE4, 0xBE, 0xD9, 0x0A, 0x78, 0x3A, 0x54, 0x59, 0xA1, 0x1E, 0x44, 0x01, 0x1B, 0xD5, 0xB0, 0x6E, 0xA5, 0xF0, 0x5E, 0xBE, 
+    0x9C, 0x4D, 0x47, 0x0D, 0x30, 0x7D, 0xF2, 0xC7, 0x36, 0x0B, 0x56, 0xE9, 0x43, 0x9B, 0xED, 0xAC, 0x3D, 0x45, 0x7A, 0xDC, 
+    0x3A, 0x9B, 0xE7, 0x4E, 0x8B, 0x24, 0x2F, 0x36, 0x6D, 0x63, 0xFB, 0xA7, 0xDE, 0xAC, 0x76, 0x4E, 0x61, 0xCC, 0x8B, 0x09, 
+    0x6C, 0xCB, 0xFC, 0x73, 0x4B, 0x66, 0x51, 0xFC, 0xF9, 0x1F, 0x2E, 0x93, 0xA3, 0x3E, 0x64, 0xC0, 0xCD, 0x49, 0x4A, 0x0F, 
+    0x8A, 0x55, 0xB3, 0x9B, 0x76, 0xBA, 0xF5, 0xAA, 0x8E, 0xB5, 0x49, 0x2D, 0xA0, 0x86, 0xB2, 0x7E, 0x02, 0x7B, 0x21, 0xEB, 
+    0x21, 0xC8, 0xA8, 0xE1, 0x07, 0x26, 0x58, 0x03, 0x70, 0x10, 0xA6, 0x4C, 0x5D, 0xF4, 0x66, 0xFC, 0x14, 0x2C, 0x1D, 0xFC, 
+    0x67, 0x26, 0x89, 0xD0, 0x3B, 0xA3, 0xC7, 0xDA, 0x67, 0x47, 0xC2, 0x38, 0x4C, 0xCF, 0x2E, 0x90, 0xA7, 0xB8, 0xAD, 0xE7, 
+    0x28, 0x59, 0x93, 0x21, 0x0C, 0xFF, 0xB2, 0x6E, 0x1A, 0x66, 0x9C, 0x93, 0xB8, 0xED, 0x66, 0x6D, 0xC6, 0xE0, 0x25, 0x8B, 
+    0xFA, 0x83, 0x94, 0xED, 0x01, 0xA3, 0x17, 0x41, 0x52, 0xBF, 0x87, 0x4E, 0xA8, 0x3C, 0x71, 0xDF, 0xEF, 0x2A, 0x7E, 0xF1, 
+    0x9E, 0xE2, 0xF3, 0x5D, 0x5B, 0x47, 0xAD, 0xCD, 0x5E, 0x64, 0xFB, 0x3A, 0x38, 0x3B, 0x03, 0xA1, 0x33, 0x30, 0xD5, 0xE4, 
+    0x95, 0x6A, 0x26, 0xBF, 0xBB, 0x9A, 0x6E, 0x37, 0xFF, 0x24, 0x6D, 0xAF, 0x85, 0x35, 0x2B, 0x0C, 0x80, 0x13, 0x2F, 0x12, 
+    0x39, 0xE0, 0x7E, 0x6B, 0x0D, 0x9A, 0x9F, 0x36, 0x49, 0x3E, 0x5B, 0xC1, 0x86, 0x9E, 0x37, 0x7F, 0xBA, 0x7A, 0xC0, 0x33, 
+    0xB1, 0xE0, 0x05, 0x7E, 0xD7, 0xC4, 0x21, 0xDE, 0xAF, 0x36, 0x39, 0x9E, 0x67, 0x8B, 0x64, 0x82, 0xC4, 0x43, 0x50, 0x52, 
+    0x5F, 0xE9, 0x28, 0x9A, 0xA7, 0xBE, 0x63, 0x1F, 0xFD, 0xB4, 0xBD, 0x4B, 0x17, 0x33, 0x88, 0x8A, 0xD4, 0xA6, 0x20, 0x4A, 
+    0xA9, 0x99, 0x7F, 0x21, 0xF9, 0x8D, 0x5E, 0xD9, 0x1A, 0x6A, 0x9D, 0x87, 0x75, 0xEA, 0x78, 0x2B, 0x31, 0x8A, 0x19, 0xDB, 
+    0xB2, 0xC7, 0x15, 0xB2, 0x8B, 0x99, 0xEA, 0x75, 0x0A, 0xEA, 0x09, 0xE0, 0x76, 0x53, 0x40, 0x4C, 0x1A, 0x1D, 0x31, 0x03, 
+    0x2C, 0x6D, 0xBB, 0xA2, 0xDF, 0x0C, 0x87, 0x0E, 0xBB, 0x6F, 0x6B, 0xD3, 0x14, 0xF7, 0xC3, 0x1B, 0x2B, 0xF7, 0x1C, 0x10, 
+    0xF1, 0xC2, 0xC6, 0x8D, 0xC4, 0x08, 0xE4, 0x3D, 0x2B, 0xCE, 0x32, 0x84, 0x4C, 0xF0, 0xE4, 0x77, 0x88, 0x41, 0xF4, 0x8B, 
+    0xE8, 0xB5, 0x28, 0x6C, 0x4F, 0x03, 0x96, 0x88, 0x14, 0xAC, 0x36, 0x3D, 0xD5, 0xD5, 0x14, 0x10, 0x79, 0x68, 0x1E, 0x74, 
+    0xBF, 0x9F, 0x06, 0x4A, 0x9B, 0x33, 0x8E, 0xA9, 0x5E, 0x68, 0x5D, 0xC1, 0xCB, 0x02, 0x55, 0xF1, 0xC6, 0x56, 0x01, 0xF5, 
+    0x3B, 0x62, 0x7A, 0xB5, 0x52, 0xAA, 0x1A, 0x4B, 0xF6, 0x27, 0x11, 0x22, 0x67, 0x62, 0x4F, 0xCE, 0x95, 0x3A, 0x34, 0xDA, 
+    0x09, 0xDF, 0xA1, 0x97, 0x8D, 0x5A, 0xAE, 0x57, 0xD6, 0x62, 0x02, 0xC3, 0x37, 0x33, 0x91, 0x41, 0x87, 0x9A, 0xFB, 0x89, 
+    0x28, 0x47, 0xDB, 0xE2, 0x7E, 0x7F, 0x4D, 0xAF, 0x84, 0xD9, 0xE9, 0x03, 0x9E, 0xFC, 0x02, 0x69, 0xEF, 0xEF, 0xC5, 0x44, 
+    0xE9, 0x0B, 0x0D, 0x22, 0x31, 0x8F, 0xB4, 0x8E, 0xCB, 0xA7, 0x4C, 0xDB, 0x34, 0xDB, 0x39, 0x9E, 0xEA, 0xEF, 0xE1, 0x34, 
+    0x2E, 0x65, 0x59, 0x41, 0xF8, 0x1B, 0x2D, 0xD6, 0x2C, 0xB0, 0xB3, 0x7F, 0x28, 0xC1, 0xE2, 0x36, 0x6D, 0x1A, 0xAA, 0x39, 
+    0xC6, 0x00, 0x9E, 0x67, 0x4D, 0xD5, 0xF2, 0x2E, 0x1B, 0x73, 0x8A, 0xC8, 0xBD, 0x54, 0x29, 0x29, 0xAD, 0x11, 0xD3, 0xAA, 
+    0x99, 0x45, 0x4A, 0xC7, 0xE7, 0x06, 0xCE, 0x80, 0x08, 0xD3, 0x39, 0xE2, 0x4F, 0xF0, 0x21, 0x44, 0x98, 0x3F, 0x94, 0xB7, 
+    0x4F, 0xA9, 0x9C, 0x3C, 0x71, 0x85, 0xAB, 0x1E, 0x97, 0xD2, 0x70, 0x36, 0xE3, 0xD5, 0x6C, 0x5C, 0xEA, 0x5C, 0xED, 0xDA, 
+    0xDB, 0x96, 0x44, 0x97, 0xA8, 0x31, 0xE6, 0x13, 0xE9, 0x09, 0x43, 0x25, 0xF8, 0xA3, 0x31, 0x03, 0xE4, 0xA4, 0x59, 0x71, 
+    0x4B, 0xCD, 0x74, 0xA6, 0xEA, 0x3A, 0xEC, 0xBD, 0x6D, 0x55, 0xD4, 0x7C, 0xBC, 0x53, 0xE0, 0xCC, 0x67, 0x51, 0x8D, 0x69, 
+    0x54, 0x04, 0xB6, 0x7C, 0xB7, 0x76, 0x7A, 0x3A, 0xB5, 0xBC, 0xED, 0x14, 0x62, 0x51, 0x47, 0xAE, 0x0D, 0x5E, 0x37, 0x9A, 
+    0x42, 0x9C, 0x88, 0x2A, 0xC0, 0x85, 0x5C, 0x2B, 0x4E, 0x6B, 0xF6, 0xC5, 0xD1, 0x61, 0xDD, 0x56, 0x14, 0x46, 0x4B, 0x76, 
+    0xAA, 0x32, 0x17, 0x56, 0x9A, 0xD4, 0xA2, 0xA4, 0xCC, 0x9E, 0x25, 0x86, 0xC5, 0x48, 0x67, 0x6C, 0x39, 0xDA, 0x43, 0x08, 
+    0x17, 0xCB, 0x16, 0x77, 0x69, 0x0B, 0xA6, 0xA4, 0x95, 0x36, 0x76, 0xDB, 0x83, 0xE2, 0x32, 0x1F, 0xE4, 0x04, 0x32, 0xC2, 
+    0x0A, 0xB0, 0xC7, 0x14, 0x47, 0x1A, 0x6F, 0xEB, 0xB9, 0x4B, 0x5D, 0x61, 0x8E, 0xA9, 0x0B, 0x9C, 0x0E, 0xE1, 0x85, 0x29, 
+    0x55, 0x39, 0x2B, 0x41, 0xF1, 0x3A, 0x12, 0xA3, 0xE5, 0xD4, 0x3A, 0x6C, 0x61, 0xE3, 0x62, 0xE1, 0x74, 0x80, 0x2B, 0x32, 
+    0x7F, 0xCC, 0xF5, 0x04, 0xAC, 0xEC, 0xA9, 0xEF, 0x4A, 0xD4, 0x35, 0xAB, 0x0C, 0x88, 0xA1, 0x84, 0xE3, 0x11, 0xC5, 0x76, 
+    0xE1, 0xAD, 0xD3, 0x05, 0x87, 0x23, 0xCA, 0x69, 0xC7, 0x82, 0x1F, 0xA3, 0xBA, 0xF2, 0x88, 0xF2, 0xD0, 0xAC, 0xA8, 0x02, 
+    0x66, 0x24, 0x92, 0x56, 0x20, 0x0D, 0xF9, 0x83, 0x8A, 0x66, 0xB0, 0xC6, 0x81, 0x15, 0x79, 0x50, 0xC4, 0x02, 0x0E, 0xFA, 
+    0xB3, 0x8A, 0x26, 0x66, 0x2C, 0x6B, 0xDC, 0x68, 0xD0, 0x24, 0xC2, 0xA4, 0xF6, 0xB9, 0xA7, 0xA6, 0xA5, 0xDE, 0x03, 0x8D, 
+    0x27, 0x9C, 0x32, 0x73, 0x77, 0x1B, 0xC1, 0xFE, 0xA5, 0x33, 0x86, 0x39, 0xEE, 0x3A, 0xA4, 0x99, 0x5A, 0xAB, 0x05, 0xF1, 
+    0xC6, 0xA8, 0x5E, 0x6D, 0xA2, 0x2C, 0x26, 0x50, 0xF3, 0xC7, 0x71, 0x12, 0xAE, 0x88, 0x2B, 0x0F, 0xE2, 0xE1, 0x28, 0x9C, 
+    0x84, 0xB7, 0xAC, 0xE2, 0x4D, 0xD4, 0xB9, 0x0F, 0x93, 0x5A, 0xCE, 0x49, 0xCB, 0x7E, 0x1D, 0x51, 0xE1, 0x8D, 0x5A, 0xD2, 
+    0x8B, 0x7F, 0xAD, 0x30, 0xB1, 0xF8, 0x70, 0x13, 0x5D, 0x57, 0x01, 0xE1, 0x06, 0xBC, 0xE3, 0x9C, 0x70, 0xD4, 0x0D, 0xCF, 
+    0xE8, 0x66, 0xB8, 0xA4, 0x27, 0xB0, 0x8F, 0xB7, 0xFA, 0x69, 0x1E, 0xB0, 0x9D, 0x82, 0x5C, 0xFF, 0x80, 0xF6, 0x96, 0x07, 
+    0x34, 0x40, 0x95, 0xDE, 0x58, 0x9D, 0x91, 0x6A, 0x7D, 0x1B, 0xA9, 0xEF, 0x5A, 0xD6, 0xE0, 0x96, 0xDE, 0xA8, 0xA2, 0x41, 
+    0xC1, 0x94, 0x8E, 0x28, 0x7F, 0x5D, 0xC3, 0xD0, 0xFC, 0x3D, 0xC5, 0xFD, 0xEB, 0xA8, 0x30, 0xF7, 0xE7, 0x63, 0x35, 0x0F, 
+    0xC2, 0x05, 0xD2, 0x89, 0xED, 0x83, 0x89, 0xF9, 0xF0, 0x1A, 0xDD, 0x9C, 0xE0, 0x07, 0x7D, 0x94, 0x6D, 0xBA, 0xE1, 0x51, 
+    0xE3, 0x52, 0x3D, 0xDE, 0x98, 0x3B, 0xB2, 0x95, 0x32, 0x8D, 0x04, 0xE1, 0x86, 0xD6, 0x33, 0xD6, 0xDD, 0x98, 0xD0, 0x6C, 
+    0xCD, 0x82, 0xD0, 0x18, 0x5D, 0xD0, 0x6B, 0x45, 0x21, 0xFB, 0xBE, 0x8A, 0x21, 0x15, 0x9F, 0x76, 0xAE, 0x03, 0x8C, 0xBC, 
+    0x67, 0x6E, 0x84, 0x86, 0x2C, 0x84, 0x07, 0x02, 0x07, 0xFC, 0x4E, 0x20, 0x30, 0xB1, 0x9F, 0x70, 0x20, 0x12, 0x40, 0x43, 
+    0x17, 0xA0, 0x8F, 0xE9, 0x6A, 0xD7, 0x87, 0x15, 0xD2, 0x72, 0x8A, 0x1B, 0x00, 0x35, 0x3F, 0x92, 0xE9, 0xAF, 0xD6, 0x43, 
+    0x03, 0x73, 0xBE, 0x3A, 0x37, 0x41, 0x9A, 0x2B, 0x02, 0xC1, 0xD2, 0xEB, 0xFD, 0x0B, 0x0F, 0x4A, 0xB8, 0xD4, 0xEE, 0xC0, 
+    0x7A, 0x88, 0xC0, 0x06, 0xF7, 0x0A, 0x41, 0x09, 0x73, 0x37, 0x3A, 0x7B, 0x38, 0xD7, 0x0F, 0xC1, 0x61, 0x34, 0x18, 0x5F, 
+    0xCE, 0x06, 0x33, 0xED, 0xCC, 0xA1, 0x3A, 0xC0, 0x99, 0x1E, 0x60, 0x40, 0x0D, 0x52, 0xFF, 0x08, 0xFB, 0x2C, 0xE8, 0xA8, 
+    0x0D, 0x44, 0x00, 0xF6, 0xA4, 0xF3, 0xCB, 0x71, 0xE8, 0xE4, 0xD6, 0x73, 0x2B, 0xB7, 0x92, 0x48, 0xD5, 0xC7, 0x1B, 0x15, 
+    0xA5, 0x2D, 0x25, 0xD3, 0x5B, 0x44, 0xDD, 0xEE, 0xAC, 0xE2, 0xCC, 0xC3, 0x6D, 0xB7, 0x30, 0xED, 0x56, 0x64, 0x5B, 0xB4, 
+    0x0F, 0x67, 0x97, 0x04, 0x06, 0xD2, 0x0D, 0x7E, 0xC4, 0x89, 0x66, 0x25, 0xC1, 0xB3, 0xB3, 0x8B, 0xC0, 0x38, 0x0A, 0xD0, 
+    0x27, 0x2C, 0x2D, 0x04, 0x5F, 0xFB, 0xCC, 0xCE, 0x5E, 0x48, 0x95, 0x31, 0x6D, 0xC2, 0xD0, 0xF3, 0x0E, 0x8E, 0xEF, 0x23, 
+    0x63, 0x1B, 0x43, 0x6B, 0x7D, 0x39, 0x3B, 0x3D, 0xBD, 0x2F, 0xAB, 0x9C, 0x01, 0xC5, 0x28, 0xEA, 0xA4, 0xA4, 0x5A, 0xE1, 
+    0xB2, 0x4D, 0xE5, 0x03, 0x35, 0x38, 0x2C, 0x0C, 0xD5, 0x6A, 0xCE, 0x66, 0xEE, 0x61, 0x09, 0x55, 0x0F, 0x55, 0xDB, 0x0F, 
+    0x2B, 0x2D, 0x71, 0xEC, 0x48, 0x2E, 0x71, 0x2B, 0x5B, 0x47, 0x2E, 0xEA, 0x46, 0xCA, 0x40, 0xD4, 0x0C, 0x41, 0x73, 0x9F, 
+    0x30, 0x85, 0xD7, 0xF7, 0x68, 0x2F, 0x11, 0xAA, 0xA0, 0xED, 0xB4, 0xC5, 0x9E, 0xDA, 0xD1, 0xC1, 0x71, 0x07, 0x24, 0xC3, 
+    0x5A, 0xA0, 0x46, 0xC9, 0x15, 0x8A, 0xA3, 0x54, 0x5C, 0xBD, 0x8D, 0xEE, 0xBB, 0x91, 0xB0, 0x1A, 0x3B, 0x82, 0xC6, 0x8A, 
+    0xFB, 0xA7, 0xFD, 0xBE, 0x77, 0xA1, 0x1E, 0xA2, 0x3B, 0xB3, 0x1B, 0xB1, 0x2E, 0x37, 0xE2, 0x81, 0x4B, 0x94, 0x06, 0x26, 
+    0xC1, 0xE0, 0x96, 0x9E, 0x1E, 0x4E, 0x4F, 0xB5, 0xB7, 0xAC, 0x79, 0x74, 0x37, 0xBC, 0x1D, 0x51, 0x2A, 0xAD, 0x19, 0x63, 
+    0x84, 0xD3, 0xD3, 0x79, 0xF0, 0xB4, 0xB0, 0x66, 0x84, 0x2B, 0x9A, 0xEA, 0x05, 0x6E, 0x65, 0x21, 0x2B, 0xF6, 0xB1, 0xDB, 
+    0xA6, 0x30, 0xF5, 0x92, 0xE9, 0x21, 0x5C, 0x20, 0x04, 0x0C, 0xDA, 0xB8, 0x8F, 0xDE, 0x06, 0x87, 0x8C, 0x05, 0x9C, 0x11, 
+    0x64, 0xCE, 0x73, 0xDA, 0xF9, 0xEB, 0xB3, 0x33, 0x35, 0x86, 0x16, 0x87, 0xCE, 0xCE, 0x38, 0x68, 0xDD, 0x8D, 0x6E, 0x15, 
+    0x65, 0x44, 0x47, 0xD6, 0xD5, 0xB6, 0x52, 0x69, 0x6B, 0xE5, 0xC3, 0xF4, 0x10, 0x4D, 0x95, 0x77, 0xD9, 0xEB, 0xCB, 0xBE, 
+    0xD6, 0xD0, 0xBA, 0x25, 0xE4, 0xB2, 0xA1, 0x4E, 0xEF, 0xF7, 0x5B, 0xFE, 0xEB, 0xE3, 0x27, 0xFA, 0xB3, 0x6C, 0xAB, 0x19, 
+    0x9D, 0x13, 0x5B, 0x60, 0x8F, 0x6D, 0x70, 0x30, 0x28, 0x61, 0x06, 0x5B, 0x30, 0xEA, 0x22, 0xD0, 0xF1, 0xD6, 0xAE, 0x0E, 
+    0xF5, 0xCE, 0xBA, 0x2A, 0x01, 0xE0, 0x55, 0x94, 0x05, 0xA8, 0x1E, 0x7B, 0x19, 0x2F, 0x63, 0xA3, 0x23, 0x6C, 0x47, 0xB8, 
+    0xFB, 0x60, 0x0F, 0x42, 0x16, 0xF6, 0x05, 0xE1, 0xD8, 0xE4, 0x9B, 0x46, 0x63, 0x51, 0x9E, 0xA2, 0x3E, 0x46, 0xEF, 0x50, 
+    0x10, 0x66, 0x6F, 0x24, 0x9F, 0x3A, 0x34, 0x76, 0x87, 0x06, 0x28, 0xB7, 0x60, 0x13, 0xB6, 0xEA, 0x2B, 0xE1, 0xC9, 0x28, 
+    0x06, 0xD1, 0x80, 0xC7, 0x11, 0xC1, 0x2B, 0x1C, 0xB2, 0x10, 0x9C, 0x42, 0xD2, 0x68, 0xF5, 0x09, 0xC2, 0xC2, 0x3C, 0x0D, 
+    0xA8, 0x5A, 0x6A, 0xEF, 0x01, 0x67, 0x1B, 0x4E, 0xBC, 0xB1, 0xBD, 0x32, 0x8F, 0x12, 0x47, 0x75, 0x78, 0x56, 0x5E, 0xA6, 
+    0x57, 0x2D, 0x6C, 0xF9, 0x04, 0x45, 0x57, 0x1D, 0x17, 0x0F, 0x51, 0x9B, 0xAF, 0x25, 0x58, 0x3A, 0xAD, 0x22, 0xCC, 0x26, 
+    0x75, 0x38, 0x5A, 0xDA, 0x66, 0x70, 0xAA, 0x60, 0x40, 0x05, 0x54, 0xBF, 0x68, 0x98, 0x20, 0xAE, 0x8C, 0xB9, 0x1D, 0xAF, 
+    0xE1, 0x75, 0xB4, 0x02, 0xF5, 0xB4, 0x72, 0xEE, 0x3A, 0xE9, 0x8C, 0x37, 0x6B, 0xF0, 0x82, 0x28, 0xCD, 0xAF, 0x5E, 0x61, 
+    0x77, 0xFB, 0x37, 0x7C, 0x85, 0x10, 0x68, 0xC6, 0xDA, 0x2A, 0xDE, 0x8B, 0x65, 0x89, 0x6B, 0x4B, 0xB5, 0xC6, 0x0E, 0xB1, 
+    0x68, 0xE6, 0x9A, 0xEF, 0xA8, 0x19, 0xCD, 0xB0, 0x4A, 0x5F, 0x54, 0x2A, 0xEA, 0xFB, 0x37, 0x06, 0x67, 0xB9, 0x0C, 0x82, 
+    0xBE, 0x28, 0x87, 0x7A, 0x11, 0x9D, 0xDA, 0xF4, 0x45, 0x75, 0xAC, 0x62, 0x59, 0x31, 0x58, 0xF2, 0x25, 0x6E, 0x45, 0x2E, 
+    0xA7, 0x4A, 0x94, 0x71, 0x6D, 0x58, 0x00, 0x21, 0xA9, 0xCD, 0x38, 0x0F, 0xB3, 0xE8, 0xA7, 0x9E, 0x6B, 0xFF, 0x6D, 0x2C, 
+    0x09, 0x89, 0x81, 0xAA, 0x1D, 0xDA, 0x33, 0x5A, 0x57, 0xF4, 0x13, 0xA3, 0x9D, 0x41, 0x64, 0x6E, 0x07, 0x32, 0x8F, 0x6E, 
+    0x2A, 0xE8, 0x12, 0x54, 0xEE, 0x22, 0x92, 0xC1, 0xC0, 0x44, 0x91, 0x7D, 0xB3, 0x2C, 0xDE, 0x39, 0x26, 0x63, 0xC2, 0x78, 
+    0x6D, 0xCE, 0xB4, 0x76, 0x53, 0x46, 0x6D, 0xB8, 0x79, 0x6D, 0x4E, 0xD9, 0x99, 0xBA, 0xC0, 0x20, 0xC7, 0xA5, 0x7E, 0x6F, 
+    0xCA, 0x06, 0xB4, 0x49, 0xDD, 0x54, 0x14, 0xD0, 0xA2, 0x0A, 0x73, 0xE7, 0xA2, 0xE1, 0xCB, 0x5F, 0x12, 0x23, 0x47, 0xC0, 
+    0xB4, 0x0A, 0x88, 0xBE, 0x63, 0x55, 0x22, 0xB8, 0x63, 0x7A, 0xB7, 0x31, 0x25, 0xD5, 0x72, 0x50, 0xAE, 0x82, 0x0D, 0xA1, 
+    0x2F, 0x6D, 0x98, 0xE7, 0x05, 0x46, 0xBD, 0x46, 0x2B, 0xAF, 0xB2, 0x9D, 0xC2, 0x9D, 0x6A, 0x2A, 0xE9, 0x44, 0x9D, 0x0E, 
+    0xC1, 0x2B, 0x44, 0xAD, 0x15, 0x7D, 0xC6, 0x23, 0x66, 0x21, 0x17, 0xEF, 0x50, 0x0F, 0x6D, 0x37, 0x50, 0x6C, 0x51, 0xC4, 
+    0x6E, 0xB5, 0x81, 0x49, 0x4E, 0x20, 0xD2, 0x8C, 0x3E, 0xF8, 0x03, 0xB4, 0xD4, 0x93, 0x4B, 0x4F, 0x79, 0x7F, 0x10, 0x11, 
+    0x91, 0x63, 0xED, 0x52, 0x95, 0x0D, 0x21, 0x3F, 0x78, 0x54, 0x62, 0x35, 0x53, 0x91, 0x14, 0xED, 0x59, 0x2A, 0x3A, 0x2D, 
+    0x66, 0x93, 0xE9, 0x6E, 0x7F, 0x3F, 0xCB, 0x77, 0x53, 0x4F, 0x1D, 0xB9, 0x6E, 0xCE, 0x62, 0x51, 0xCD, 0x0A, 0xEB, 0x3A, 
+    0x58, 0xCA, 0xB3, 0x97, 0xA4, 0x55, 0x49, 0x13, 0x9D, 0x18, 0x2F, 0xC4, 0x02, 0xA9, 0xD4, 0xE2, 0xFA, 0x7D, 0xE6, 0x3D, 
+    0x2C, 0x12, 0x3B, 0xAF, 0x9B, 0xEE, 0x54, 0xD5, 0xC7, 0x79, 0x27, 0x78, 0xEC, 0x75, 0xD0, 0x7B, 0xCF, 0xB8, 0x25, 0xAB, 
+    0x1D, 0xB8, 0x2E, 0x79, 0x6C, 0x9C, 0x44, 0x6A, 0x8B, 0x48, 0xAE, 0x73, 0x5C, 0x24, 0x57, 0xCE, 0x85, 0xB1, 0x4C, 0x63, 
+    0x15, 0xA3, 0x63, 0x0B, 0xA7, 0x1D, 0x7E, 0xD5, 0xBA, 0x55, 0x2A, 0x9D, 0xEB, 0x9E, 0x7D, 0xAD, 0xDA, 0x5D, 0x6F, 0x35, 
+    0x56, 0x40, 0x9C, 0xC0, 0x74, 0xFA, 0x71, 0x6D, 0xC6, 0xA1, 0xB6, 0x7B, 0x4C, 0x1B, 0x2E, 0x77, 0xB4, 0xE1, 0x72, 0x57, 
+    0x1B, 0x8E, 0xB0, 0x77, 0x7A, 0x80, 0x82, 0xDF, 0x82, 0xF7, 0x7C, 0xB4, 0x65, 0x27, 0x90, 0xEB, 0x4D, 0xB4, 0x2D, 0xF5, 
+    0xA0, 0x74, 0xD2, 0x90, 0xA8, 0x1F, 0x71, 0x2A, 0xB9, 0xDE, 0x58, 0x39, 0xD0, 0x42, 0x9F, 0x65, 0x94, 0xBF, 0x3C, 0xD4, 
+    0x28, 0x95, 0xFD, 0xBC, 0x6E, 0x8D, 0x46, 0x19, 0x3B, 0x74, 0xFA, 0xE9, 0x9B, 0xAF, 0x69, 0x13, 0x50, 0x22, 0x3F, 0x52, 
+    0x92, 0x55, 0x66, 0xDC, 0xDA, 0x47, 0xD6, 0x33, 0xDC, 0x99, 0x46, 0x18, 0xE9, 0x54, 0x70, 0x1C, 0x91, 0x2B, 0xE7, 0xBF, 
+    0x7C, 0xC2, 0x5E, 0x21, 0xE0, 0x3B, 0xE2, 0x3C, 0xBE, 0xF4, 0xE3, 0xF0, 0x93, 0xAB, 0xF3, 0xAB, 0x8B, 0xCB, 0x3D, 0x7C, 
+    0x43, 0xBC, 0xA5, 0xCF, 0xBD, 0xE1, 0x2F, 0xE1, 0x1F, 0xAE, 0x86, 0x57, 0x3D, 0x35, 0x7A, 0xFE, 0xEC, 0xBC, 0x14, 0x61, 
+    0xDC, 0x9B, 0x79, 0x25, 0x34, 0x54, 0x71, 0x30, 0x95, 0xDA, 0x1B, 0x95, 0x45, 0x0F, 0x3E, 0xBE, 0x2A, 0xAA, 0x1F, 0x0E, 
+    0x81, 0xDC, 0x31, 0xDE, 0xDF, 0x14, 0x74, 0x2C, 0xA0, 0x29, 0x71, 0xE0, 0x63, 0x28, 0x6D, 0xE8, 0x75, 0xB6, 0xD4, 0x53, 
+    0xA5, 0xDD, 0xCB, 0xC2, 0x4D, 0x7F, 0x58, 0xDC, 0xC1, 0xB7, 0x56, 0x03, 0xD5, 0x56, 0x29, 0xC4, 0xB2, 0xF1, 0xB8, 0x06, 
+    0x87, 0xA1, 0x65, 0x8A, 0x25, 0x22, 0xDE, 0xD5, 0x32, 0x0D, 0x7A, 0xA9, 0x5D, 0x53, 0xD2, 0x49, 0x74, 0x19, 0xF5, 0xA5, 
+    0x17, 0x07, 0x53, 0xD1, 0x11, 0x3F, 0x18, 0xB8, 0xF6, 0x73, 0x2E, 0x75, 0xE8, 0x24, 0xF6, 0xC2, 0xE5, 0x8A, 0x10, 0x16, 
+    0xB4, 0x66, 0x60, 0x74, 0x22, 0xB2, 0x0D, 0x83, 0xC7, 0x59, 0x47, 0xA2, 0x64, 0x1B, 0x04, 0xAE, 0xEA, 0x7A, 0xB7, 0xAC, 
+    0xA5, 0x12, 0x13, 0xC7, 0x1F, 0x12, 0x4B, 0x5A, 0xCD, 0x42, 0x8D, 0xEB, 0x41, 0xA4, 0x6D, 0x83, 0xA8, 0x1A, 0x3D, 0xB3, 
+    0xEB, 0x5E, 0xC7, 0xCD, 0xAC, 0xFF, 0xC4, 0xDA, 0x77, 0x6D, 0x6A, 0x58, 0x7C, 0xB1, 0xCA, 0x2E, 0xC1, 0x20, 0xD1, 0xD4, 
+    0xE7, 0xA3, 0xB3, 0x00, 0x4D, 0xDF, 0x11, 0x75, 0x9F, 0xC2, 0xB0, 0xEB, 0xD3, 0x53, 0xEE, 0xC8, 0xCE, 0x59, 0xD2, 0x4A, 
+    0xA4, 0x65, 0x51, 0xBA, 0x6A, 0x5A, 0x38, 0xF6, 0x03, 0xF0, 0x6B, 0xC6, 0x3E, 0x95, 0x4B, 0xA1, 0x8C, 0x16, 0x09, 0xBA, 
+    0x85, 0x64, 0x0A, 0x00, 0x59, 0xC8, 0xEF, 0x48, 0x41, 0xA2, 0x5A, 0x27, 0x8A, 0xCB, 0x8B, 0xD8, 0xEC, 0x39, 0x68, 0xE3, 
+    0x64, 0x7C, 0x12, 0x19, 0xF2, 0x8B, 0x33, 0x9B, 0xB7, 0xB8, 0xF2, 0xD6, 0x65, 0x8D, 0xBC, 0x30, 0x81, 0xAF, 0x3F, 0xAD, 
+    0xD0, 0xF5, 0x7E, 0x37, 0xCA, 0xF7, 0xDA, 0xCF, 0xB1, 0x38, 0xDA, 0xB8, 0x08, 0xD8, 0x91, 0xE4, 0xEE, 0xDF, 0x2E, 0xD8, 
+    0x0F, 0xD8, 0xCF, 0x6A, 0xDB, 0x95, 0x4F, 0x47, 0xE7, 0x6C, 0x6A, 0x54, 0x9D, 0x9E, 0x96, 0x14, 0x0D, 0xA6, 0x3E, 0xB4, 
+    0xBD, 0x30, 0x96, 0x92, 0x07, 0x51, 0x4B, 0x7E, 0x50, 0x8F, 0xAE, 0xF7, 0xAF, 0xDF, 0xC4, 0x87, 0x0C, 0xA1, 0x07, 0xFF, 
+    0x93, 0xE1, 0xD5, 0xFD, 0xD5, 0x8F, 0xA3, 0xEE, 0x65, 0x30, 0xFC, 0xE5, 0x72, 0xF4, 0x7C, 0xAF, 0xFD, 0xCA, 0x3C, 0x67, 
+    0x37, 0x32, 0x9F, 0x46, 0xD6, 0x21, 0x78, 0x3B, 0x15, 0x2D, 0xAE, 0x54, 0x5D, 0x60, 0x68, 0xDD, 0xAF, 0x22, 0xE0, 0xC8, 
+    0xE8, 0xE0, 0x92, 0x83, 0x28, 0x9B, 0x26, 0x9B, 0x4F, 0x77, 0x44, 0x70, 0x12, 0x95, 0x79, 0x59, 0x49, 0x32, 0x0C, 0x1B, 
+    0xF1, 0x9A, 0x7C, 0x6B, 0x2A, 0xD4, 0x68, 0xF4, 0x61, 0x3C, 0x14, 0x7E, 0x97, 0x6F, 0xD5, 0x47, 0xE1, 0x6F, 0xC6, 0xF7, 
+    0x88, 0x82, 0xBC, 0xAA, 0x93, 0x11, 0xAD, 0x79, 0x7A, 0x6A, 0xA8, 0xC5, 0x4E, 0x8A, 0x5B, 0x61, 0x71, 0x1F, 0x1E, 0x43, 
+    0x32, 0xF4, 0x10, 0x68, 0xD0, 0x09, 0xC2, 0x86, 0xCF, 0xE6, 0xD4, 0x7E, 0x63, 0x91, 0x8F, 0x71, 0x62, 0x42, 0xA4, 0xE6, 
+    0x09, 0xC1, 0xE6, 0x2E, 0x59, 0x66, 0xEC, 0x6A, 0x3E, 0xC6, 0x0E, 0x0F, 0x53, 0xE5, 0xFA, 0xF5, 0xA6, 0x17, 0xF6, 0x5C, 
+    0x8B, 0x33, 0x99, 0x4B, 0xAA, 0xD4, 0xE8, 0x1C, 0xF1, 0xB6, 0x6E, 0x71, 0xD2, 0xF2, 0xC8, 0x0B, 0xAD, 0xEE, 0xB4, 0x9A, 
+    0x22, 0x5A, 0x6B, 0x3A, 0x28, 0x4E, 0xC5, 0x4F, 0xB2, 0x78, 0x7E, 0x0C, 0x2A, 0x68, 0x58, 0xFB, 0xA9, 0x0E, 0x62, 0xFD, 
+    0x20, 0x5C, 0x88, 0x8C, 0x8A, 0x35, 0xDB, 0x32, 0xC5, 0x29, 0xAE, 0xC7, 0xEB, 0x03, 0x7B, 0xE5, 0x7C, 0xAC, 0x1B, 0xB9, 
+    0x66, 0x70, 0x70, 0xA2, 0x72, 0xB6, 0x6D, 0x2C, 0x69, 0xC0, 0x27, 0x96, 0x15, 0xCC, 0x60, 0x22, 0x9B, 0x39, 0x1E, 0x50, 
+    0x1E, 0xEC, 0x24, 0x39, 0x9E, 0xD7, 0xA2, 0x0B, 0xDE, 0xB5, 0xE0, 0x22, 0xAC, 0x39, 0xA4, 0xEB, 0xB6, 0x3C, 0x7A, 0x54, 
+    0x95, 0xED, 0x15, 0x25, 0xFC, 0x7E, 0xA8, 0xE8, 0x2F, 0xF2, 0x4C, 0xF9, 0x95, 0x62, 0xA6, 0x52, 0xC9, 0x5E, 0x6D, 0x2C, 
+    0x08, 0xEB, 0x7E, 0x0F, 0xDB, 0x5C, 0xED, 0x3F, 0xF4, 0xE0, 0x85, 0xED, 0x31, 0xD6, 0xBF, 0xBC, 0x33, 0xFC, 0x05, 0x9D, 
+    0xFE, 0x56, 0x79, 0x3E, 0xB1, 0xBD, 0x22, 0x6C, 0x5D, 0xEB, 0xA5, 0x7D, 0x54, 0x95, 0x6E, 0x25, 0xE6, 0x09, 0xCE, 0x0B, 
+    0xAD, 0x03, 0x52, 0x3F, 0xD1, 0xA8, 0xEB, 0x30, 0xF8, 0xD4, 0xB9, 0x0F, 0xC2, 0xBE, 0x21, 0xE6, 0x7F, 0xE1, 0x3F, 0xCA, 
+    0x06, 0xFC, 0x4C, 0x76, 0x9C, 0xCC, 0xF4, 0x76, 0x0F, 0xF5, 0x35, 0x7A, 0xFD, 0x61, 0xB9, 0x9B, 0xCD, 0xF7, 0x6C, 0x91, 
+    0x79, 0xAE, 0x5E, 0x46, 0x4F, 0xAC, 0x95, 0x45, 0x39, 0xF8, 0x6A, 0x4B, 0xF4, 0x35, 0xB6, 0x78, 0xC6, 0xED, 0x31, 0x5F, 
+    0x6D, 0x51, 0x31, 0xDC, 0x4E, 0x0D, 0x4A, 0x2F, 0xD4, 0x50, 0x6B, 0x6E, 0x3F, 0x93, 0x98, 0xC1, 0x05, 0x25, 0x64, 0xE4, 
+    0xD3, 0xE2, 0xD0, 0xC7, 0xF5, 0x05, 0xE0, 0x5B, 0x7F, 0xC0, 0x99, 0x98, 0x7B, 0x15, 0xAE, 0xB9, 0xD7, 0xC2, 0x2F, 0x02, 
+    0x9A, 0x6C, 0xF6, 0xB5, 0x7D, 0x51, 0xF3, 0x22, 0xA0, 0x59, 0xDE, 0x02, 0xCE, 0x3A, 0x0A, 0xB4, 0x61, 0x2F, 0x31, 0xD4, 
+    0x56, 0xAE, 0xB9, 0xC3, 0x63, 0xF7, 0x91, 0xC3, 0x51, 0xCB, 0x9D, 0x78, 0xDD, 0x4F, 0x47, 0xD2, 0xE1, 0x9B, 0xE3, 0x4C, 
+    0xBB, 0xFE, 0x74, 0x44, 0xDE, 0xEC, 0x3B, 0xD2, 0x39, 0xCC, 0xA0, 0x50, 0xD3, 0x76, 0x96, 0x2D, 0xCC, 0xCA, 0x70, 0x38, 
+    0x05, 0x7D, 0x96, 0xB9, 0x50, 0x7A, 0xFC, 0x98, 0xCA, 0x5B, 0x8F, 0x29, 0x71, 0x95, 0x49, 0x63, 0x75, 0x8F, 0x29, 0xE2, 
+    0x96, 0xE6, 0xAB, 0x6D, 0xE1, 0xBA, 0xAC, 0xAF, 0x0E, 0x57, 0x3B, 0x5E, 0x75, 0x9D, 0xD3, 0xE3, 0x4E, 0x4D, 0x4D, 0x22, 
+    0x8B, 0xBA, 0xDB, 0x7C, 0x33, 0x01, 0x9D, 0xAB, 0xB4, 0xF4, 0x31, 0xCF, 0x70, 0x17, 0xF6, 0xCB, 0xEB, 0x00, 0x20, 0x08, 
+    0xD9, 0x29, 0xF9, 0x68, 0x00, 0x49, 0x35, 0x26, 0x6C, 0x50, 0x37, 0x5B, 0x82, 0x87, 0x20, 0xAB, 0x69, 0x70, 0x01, 0x19, 
+    0xEF, 0x24, 0x9E, 0x88, 0xD6, 0x8B, 0x56, 0x24, 0xAD, 0x5B, 0x3A, 0x1F, 0xA1, 0x45, 0xD8, 0x07, 0x2E, 0x0D, 0xCB, 0x5E, 
+    0x20, 0x57, 0x2E, 0xCB, 0x6A, 0x27, 0xDB, 0xB8, 0xBC, 0x39, 0xB1, 0xE7, 0x30, 0xA4, 0x33, 0xAC, 0x7C, 0x40, 0x4D, 0xB7, 
+    0x6A, 0x61, 0xC4, 0x2D, 0x7E, 0x78, 0x4B, 0x6A, 0x4C, 0xE3, 0x04, 0x85, 0x53, 0x8E, 0x71, 0x80, 0xA1, 0xD2, 0x0C, 0x9E, 
+    0x87, 0xB8, 0x38, 0xD4, 0x2B, 0x1E, 0xEA, 0xDC, 0x74, 0x3C, 0xCA, 0x83, 0x6B, 0xC2, 0xAF, 0xD7, 0x9E, 0x38, 0x21, 0x3F, 
+    0x60, 0x77, 0xFE, 0x30, 0x60, 0x35, 0xE7, 0x25, 0x3C, 0xB4, 0xA8, 0x24, 0xCF, 0xDB, 0x5D, 0x40, 0x37, 0x02, 0x28, 0xE8, 
+    0xB1, 0x55, 0x82, 0x3D, 0x10, 0x9A, 0x25, 0xD6, 0x97, 0x97, 0x2F, 0x60, 0xFF, 0xA9, 0x54, 0xDD, 0x67, 0xF5, 0x20, 0x11, 
+    0x6E, 0x85, 0xF4, 0xDD, 0x37, 0x0E, 0x8F, 0x6B, 0x31, 0x06, 0xC2, 0xDA, 0xBB, 0x81, 0x59, 0x48, 0x45, 0x5D, 0xEF, 0xA5, 
+    0xAF, 0xA4, 0x9B, 0xF9, 0x8A, 0x28, 0x67, 0x67, 0xC7, 0x13, 0x7D, 0x70, 0xD1, 0x71, 0xF7, 0x95, 0x73, 0xD5, 0xAE, 0xFD, 
+    0xAF, 0x3E, 0xB5, 0x68, 0x9A, 0x18, 0x05, 0x8F, 0xA6, 0x79, 0x68, 0xAA, 0xCD, 0xB5, 0xDC, 0x43, 0x4E, 0x5B, 0x0C, 0x69, 
+    0xCC, 0x16, 0xB6, 0xD2, 0xD4, 0x84, 0xA4, 0x60, 0x4E, 0xEB, 0x5C, 0x5D, 0x06, 0xB6, 0x04, 0xE3, 0xC0, 0x63, 0x2A, 0xDC, 
+    0x6D, 0x45, 0xA1, 0x2E, 0x28, 0x18, 0xB1, 0xA5, 0x2D, 0xCC, 0x44, 0x45, 0xC1, 0x36, 0x38, 0x08, 0xD6, 0x3C, 0x96, 0xB7, 
+    0xAE, 0x48, 0xAC, 0xEB, 0x26, 0xA0, 0x78, 0xE7, 0x50, 0x5A, 0x9A, 0x78, 0x5F, 0x91, 0x23, 0x2D, 0xFD, 0xBE, 0xF1, 0xBB, 
+    0xED, 0xF1, 0x04, 0xA0, 0xB6, 0xDF, 0x39, 0x75, 0x75, 0x55, 0x69, 0x14, 0xD7, 0x48, 0xFA, 0xC8, 0x7A, 0xE9, 0xAF, 0xB0, 
+    0x22, 0x2C, 0x27, 0x1E, 0x71, 0x22, 0x02, 0x47, 0x86, 0x00, 0x8E, 0x4A, 0xD9, 0x13, 0xEB, 0x9D, 0xF5, 0xB8, 0xA2, 0x07, 
+    0x14, 0x32, 0x47, 0x5B, 0x6B, 0x21, 0x23, 0x50, 0x40, 0xDF, 0x67, 0xE3, 0x0D, 0xBB, 0x69, 0x89, 0xF5, 0xE1, 0xBB, 0xDC, 
+    0x39, 0xB6, 0x77, 0x26, 0x49, 0x3C, 0xF0, 0x5A, 0xEA, 0x36, 0x34, 0xDB, 0x91, 0xB0, 0x6C, 0xE2, 0x7A, 0x03, 0x84, 0x99, 
+    0x46, 0x65, 0x5B, 0xE3, 0x1C, 0x81, 0xC2, 0x6F, 0x8B, 0x3F, 0xA2, 0xC8, 0x89, 0x8E, 0x92, 0x96, 0xCC, 0x86, 0xC7, 0x53, 
+    0x5E, 0xD1, 0x84, 0xFF, 0x38, 0xE0, 0x9B, 0xCD, 0x8C, 0x69, 0xA9, 0x06, 0x0E, 0xCB, 0xF9, 0x8A, 0xD3, 0xB2, 0xA1, 0x7C, 
+    0xAB, 0xEA, 0x92, 0x35, 0x10, 0x76, 0xFB, 0x2F, 0x59, 0x23, 0x98, 0xF3, 0x69, 0x8C, 0x82, 0x5C, 0x9F, 0x95, 0x92, 0x3A, 
+    0x48, 0x71, 0x89, 0x94, 0x79, 0x5B, 0x6C, 0x58, 0x41, 0x49, 0xD7, 0xE0, 0x70, 0x3C, 0x81, 0x21, 0xF4, 0x3F, 0x8F, 0xCE, 
+    0xAF, 0x5E, 0x77, 0xCF, 0x27, 0xEA, 0x8B, 0xE8, 0xC9, 0x51, 0x4D, 0xF8, 0x73, 0xB9, 0xAF, 0xBF, 0xC0, 0x88, 0x9F, 0xAC, 
+    0xE8, 0x5C, 0xE3, 0x81, 0x44, 0x30, 0xBE, 0xFF, 0x39, 0x4B, 0x5F, 0x55, 0x55, 0x03, 0x98, 0x7D, 0x8F, 0xE3, 0xB4, 0x53, 
+    0x29, 0xE1, 0x8D, 0x97, 0xC4, 0xDF, 0xA7, 0xD4, 0x6A, 0xD5, 0x39, 0x31, 0x71, 0xBC, 0x4D, 0xFC, 0xFD, 0x05, 0x0F, 0x0C, 
+    0x8D, 0x87, 0x25, 0xC5, 0x72, 0x50, 0xDA, 0x56, 0xB2, 0xE2, 0xCB, 0x18, 0x67, 0xE2, 0x0C, 0x66, 0xD9, 0x2B, 0xA2, 0xB8, 
+    0xF9, 0xFA, 0xE5, 0xBA, 0xAC, 0x7F, 0x2E, 0x07, 0x2A, 0xD4, 0x29, 0x16, 0xC5, 0x62, 0xB5, 0x79, 0x3C, 0x3D, 0x9D, 0xD3, 
+    0xC1, 0x0A, 0xA5, 0x1F, 0x5C, 0x0D, 0xC2, 0xDB, 0x37, 0x0E, 0xD9, 0xA9, 0x75, 0x1E, 0x45, 0x9F, 0x06, 0xF0, 0x1C, 0xAE, 
+    0x7D, 0x7C, 0x43, 0x81, 0x7F, 0x38, 0x36, 0x37, 0x67, 0x73, 0x1C, 0x24, 0x73, 0xD0, 0xDE, 0xAC, 0xB9, 0xC8, 0x36, 0x84, 
+    0xBB, 0xD5, 0xFA, 0xBB, 0xE5, 0x17, 0xC9, 0x7C, 0x4B, 0x24, 0x30, 0x94, 0x5D, 0xF4, 0xF9, 0xC6, 0xD1, 0x45, 0xA6, 0xF0, 
+    0x96, 0x11, 0xCF, 0x2C, 0xF7, 0x7E, 0xED, 0xCF, 0x8C, 0xB8, 0x99, 0x98, 0xCB, 0x18, 0x5D, 0x0F, 0x6F, 0x8C, 0x82, 0x23, 
+    0xEB, 0x8F, 0xDD, 0x44, 0x4F, 0x95, 0x43, 0x44, 0xBC, 0x21, 0x1A, 0xC2, 0xCC, 0x74, 0x73, 0xD0, 0x29, 0x3D, 0x3F, 0xFA, 
+    0x0C, 0x8E, 0xBC, 0x14, 0x69, 0x2D, 0x1C, 0x8F, 0x14, 0xD2, 0xAE, 0xA8, 0x09, 0x12, 0x2B, 0x4E, 0xA8, 0x73, 0xDA, 0x19, 
+    0x02, 0x33, 0xA7, 0xA7, 0x37, 0x50, 0xEE, 0xE4, 0x50, 0x29, 0x53, 0x73, 0x4C, 0x87, 0xAC, 0x61, 0x6A, 0x3A, 0x5E, 0x92, 
+    0x19, 0xB0, 0xD0, 0x80, 0x29, 0x09, 0x11, 0x30, 0x8E, 0xB7, 0x6F, 0x05, 0x73, 0x12, 0xAB, 0xF6, 0xC2, 0x01, 0x50, 0xA2, 
+    0x5C, 0x5D, 0x83, 0x00, 0x74, 0x4F, 0x7A, 0x98, 0xED, 0xC1, 0xB7, 0x5B, 0x4B, 0x8C, 0x9C, 0x29, 0x08, 0x08, 0x01, 0x28, 
+    0xEB, 0x84, 0xBC, 0x45, 0x9B, 0xDC, 0x28, 0xDA, 0x62, 0x58, 0xE6, 0x24, 0xCF, 0xD4, 0x14, 0x37, 0x25, 0x44, 0x93, 0x04, 
+    0x53, 0x6B, 0x8A, 0x09, 0x01, 0x38, 0x5C, 0x4E, 0x17, 0x97, 0xE8, 0x71, 0x81, 0x1B, 0x2C, 0x7E, 0x1A, 0x9F, 0x9D, 0x41, 
+    0x70, 0x2A, 0xBD, 0xA9, 0x53, 0x80, 0x96, 0xA2, 0x70, 0x85, 0x39, 0x53, 0xA6, 0x76, 0x3A, 0xBE, 0xF6, 0x3E, 0x69, 0x2E, 
+    0x08, 0xEA, 0x3A, 0x9C, 0xE5, 0x48, 0x8C, 0x39, 0xAA, 0xB4, 0xA1, 0x57, 0xB7, 0x35, 0xE3, 0x2C, 0xCA, 0x22, 0x21, 0xA4, 
+    0xAB, 0x99, 0x5B, 0x82, 0x08, 0x75, 0xA6, 0x07, 0x35, 0x5F, 0xB9, 0xC4, 0x80, 0xAD, 0x67, 0x66, 0xEA, 0x20, 0x52, 0xDC, 
+    0x81, 0x26, 0x5D, 0x25, 0x0A, 0xB5, 0x56, 0x38, 0x63, 0x6D, 0xC5, 0xE2, 0xC7, 0xD9, 0xAE, 0x12, 0x65, 0xA2, 0x74, 0xD6, 
+    0x47, 0xE3, 0x85, 0x0A, 0xC6, 0x8C, 0x55, 0xA5, 0x32, 0xDE, 0xDD, 0x6C, 0x1C, 0xA0, 0x15, 0x8F, 0x63, 0xA3, 0x80, 0x4C, 
+    0xB0, 0x42, 0x0C, 0x6C, 0x3C, 0xB3, 0xA0, 0xC3, 0xEB, 0xAE, 0x9B, 0x47, 0x13, 0x2D, 0x7D, 0xBE, 0xE9, 0x99, 0xB6, 0xEB, 
+    0xC1, 0x9E, 0x9C, 0x72, 0x6D, 0xBD, 0xEE, 0xE4, 0x07, 0x8B, 0x81, 0x6E, 0xDC, 0xA0, 0x3A, 0xAF, 0xE0, 0x6C, 0x7B, 0xD3, 
+    0xAA, 0x18, 0x3C, 0x1C, 0x7A, 0x9B, 0x62, 0xBB, 0x9A, 0xBF, 0x85, 0x50, 0x3B, 0x5F, 0x2D, 0xE9, 0xC7, 0x41, 0x46, 0xF0, 
+    0x1A, 0x96, 0x15, 0x27, 0x82, 0x1E, 0x20, 0xF2, 0xD6, 0x79, 0x73, 0x6F, 0xA4, 0x50, 0x90, 0xDD, 0x5D, 0x2A, 0x6F, 0x9C, 
+    0x10, 0xFA, 0x7E, 0x4F, 0xB9, 0x6B, 0xD6, 0xF1, 0xE5, 0x72, 0xCB, 0xD5, 0x6E, 0x36, 0x7E, 0xF4, 0x70, 0x88, 0xAE, 0x26, 
+    0x30, 0x68, 0xAE, 0x95, 0x35, 0xC5, 0x46, 0x98, 0x54, 0x0F, 0xBE, 0x5C, 0xF8, 0x84, 0xCD, 0xA3, 0xA7, 0xED, 0x2E, 0xD9, 
+    0xB5, 0x4D, 0x59, 0x46, 0xE8, 0x6F, 0x7E, 0x9F, 0x3C, 0x6E, 0x5B, 0xBE, 0xC1, 0x03, 0xDB, 0xB2, 0x70, 0x36, 0x64, 0x0F, 
+    0xDD, 0xF5, 0x1B, 0xB3, 0xBA, 0x9B, 0xBA, 0x07, 0xAE, 0xF1, 0x30, 0x69, 0xB3, 0x95, 0xA8, 0xDD, 0xCC, 0xA6, 0xE3, 0x71, 
+    0xAF, 0x1D, 0xCD, 0xE8, 0xCB, 0xC6, 0x49, 0x54, 0xE5, 0xAE, 0xC1, 0xEC, 0xC0, 0x2A, 0x93, 0x28, 0xCA, 0x62, 0x08, 0x07, 
+    0xAF, 0x23, 0xBF, 0xD1, 0xEC, 0x84, 0xDD, 0xB7, 0xB5, 0x05, 0xFC, 0x1A, 0xE8, 0xE0, 0x4B, 0x65, 0x7D, 0x60, 0x90, 0x17, 
+    0x33, 0xC2, 0xB1, 0xB1, 0x7D, 0xF4, 0x03, 0x19, 0x74, 0xD6, 0xD3, 0x0B, 0xA6, 0x07, 0x8D, 0x77, 0x2C, 0x04, 0x68, 0x74, 
+    0x99, 0x7A, 0x66, 0x65, 0xB0, 0x1C, 0x04, 0xA9, 0xD4, 0x99, 0xFE, 0xA8, 0xEB, 0x01, 0xF2, 0xBC, 0x11, 0xB7, 0xCB, 0xB8, 
+    0x30, 0x2B, 0x6B, 0x95, 0x00, 0x7B, 0x13, 0x09, 0xE5, 0x61, 0xBB, 0x04, 0xFF, 0x80, 0x2A, 0x11, 0x57, 0x94, 0x41, 0x99, 
+    0x19, 0xE4, 0x14, 0x3F, 0xBE, 0x2B, 0x38, 0x9C, 0x05, 0x52, 0xC8, 0xBB, 0x43, 0x02, 0x60, 0x42, 0x0F, 0xE5, 0x39, 0x4A, 
+    0x0C, 0xF1, 0x8C, 0xF5, 0x40, 0xB1, 0x38, 0xAA, 0x39, 0xC7, 0x49, 0x39, 0xC7, 0x70, 0x2D, 0x4B, 0x07, 0x1E, 0x1C, 0xC5, 
+    0x0E, 0x72, 0x99, 0xD6, 0x88, 0x1D, 0xE8, 0xE1, 0xA4, 0xE1, 0x07, 0x77, 0x96, 0xB3, 0x88, 0x70, 0x46, 0x3A, 0xBC, 0xF8, 
+    0x25, 0x19, 0x51, 0x39, 0x83, 0x18, 0x28, 0xE5, 0x05, 0xBF, 0x03, 0x31, 0x10, 0x13, 0xCE, 0x13, 0x32, 0x6A, 0x89, 0xF5, 
+    0x50, 0xB4, 0x4E, 0x55, 0x11, 0xE7, 0x61, 0xFB, 0x8E, 0xAD, 0xE6, 0xA7, 0x7E, 0x99, 0x1D, 0xCE, 0x4E, 0xBE, 0xCC, 0x8C, 
+    0xE1, 0xF2, 0x95, 0x8D, 0x38, 0x21, 0xEB, 0x2F, 0x54, 0xC1, 0xF7, 0x86, 0xF7, 0xD3, 0xA2, 0x4D, 0x53, 0x1C, 0x6A, 0x90, 
+    0x8D, 0xC0, 0x12, 0x1C, 0xD9, 0xD0, 0xF2, 0xC3, 0x2C, 0x7A, 0x20, 0x8A, 0xEE, 0x38, 0xBC, 0x14, 0x21, 0x0E, 0x79, 0x36, 
+    0x9A, 0x8F, 0x93, 0xD0, 0x81, 0x6C, 0x68, 0x74, 0xBE, 0xCF, 0xFE, 0xB3, 0x00, 0x09, 0x43, 0x54, 0x8F, 0xE6, 0xE0, 0xE9, 
+    0xA9, 0x1E, 0x35, 0x8D, 0x38, 0xD5, 0x46, 0x17, 0xC3, 0x82, 0x6D, 0x45, 0x66, 0xC4, 0x30, 0x0B, 0xDC, 0x31, 0x9E, 0x43, 
+    0x03, 0xE1, 0xD9, 0xD9, 0x78, 0xBF, 0x9F, 0x18, 0x88, 0xB5, 0xE9, 0x04, 0x12, 0x7C, 0x5D, 0xCF, 0xF7, 0xEE, 0x97, 0x17, 
+    0xCC, 0xA4, 0xCF, 0x58, 0xF3, 0x57, 0x4E, 0xA1, 0x02, 0xB6, 0x7A, 0x95, 0xD7, 0x9B, 0xCA, 0xAB, 0x15, 0x75, 0x43, 0xCA, 
+    0x50, 0x9B, 0x0B, 0x24, 0x95, 0xD3, 0xE1, 0xBE, 0x99, 0x1D, 0x84, 0x3E, 0xDC, 0x20, 0x86, 0x99, 0x6C, 0xA0, 0x49, 0x73, 
+    0x03, 0x21, 0x07, 0x74, 0xC4, 0x78, 0x00, 0xD6, 0x39, 0x5C, 0x7D, 0x24, 0xA8, 0x43, 0x4D, 0x9C, 0xCD, 0xA1, 0x49, 0xCB, 
+    0x2F, 0x39, 0x46, 0xA3, 0x48, 0xD4, 0xA2, 0x56, 0xCA, 0x9D, 0x3F, 0xD5, 0xBB, 0x95, 0x18, 0xC8, 0x2A, 0x91, 0xBC, 0x0D, 
+    0x82, 0x76, 0xA1, 0xB8, 0xC8, 0x8F, 0xC9, 0x6C, 0x17, 0x12, 0x9D, 0xB5, 0x9A, 0xE7, 0xF2, 0xA1, 0x42, 0x58, 0xC6, 0xBA, 
+    0x62, 0xE4, 0xEA, 0x76, 0x43, 0xFD, 0xE6, 0x77, 0x10, 0x2C, 0x70, 0xD3, 0xC8, 0xAE, 0x5D, 0xD2, 0x74, 0xFA, 0x71, 0xE7, 
+    0xEC, 0xCC, 0x29, 0x19, 0x72, 0xD4, 0x31, 0xAE, 0x5E, 0x82, 0x7F, 0x3E, 0xF6, 0xD2, 0x15, 0x3D, 0x1B, 0x95, 0xA2, 0x62, 
+    0xF7, 0x66, 0xB6, 0x28, 0x56, 0x77, 0x3B, 0x5F, 0x17, 0xC2, 0x75, 0x9F, 0x2E, 0xC0, 0x2E, 0x74, 0x3B, 0xA8, 0xF4, 0xF4, 
+    0xB4, 0x52, 0xE9, 0x65, 0x9F, 0x4E, 0xD5, 0x2F, 0x2B, 0xB3, 0xF7, 0xA8, 0x86, 0x30, 0x1E, 0xE4, 0xA9, 0x22, 0x6A, 0x6B, 
+    0x32, 0x29, 0xB4, 0xDB, 0x03, 0x08, 0x1A, 0x21, 0x0E, 0xAC, 0xA5, 0xFA, 0x1E, 0xD7, 0xE6, 0x41, 0x64, 0x40, 0x1F, 0x57, 
+    0xE3, 0xB1, 0x4D, 0x01, 0x93, 0xEF, 0x72, 0xF9, 0x5F, 0xD1, 0xAE, 0x7E, 0x6C, 0xFA, 0xDE, 0xF4, 0x1F, 0xB5, 0xAF, 0xDD, 
+    0x9A, 0xFF, 0xCD, 0x57, 0xDF, 0x7D, 0xA3, 0x6D, 0xBE, 0xBE, 0x5E, 0x25, 0x39, 0xDC, 0x78, 0xFD, 0x05, 0x37, 0x03, 0x2A, 
+    0x69, 0xCF, 0x2E, 0x0E, 0x37, 0x39, 0x4B, 0x10, 0x52, 0x9D, 0x79, 0x51, 0xF1, 0xC8, 0xC9, 0x7D, 0xE2, 0x43, 0x2D, 0x9B, 
+    0x26, 0xCB, 0x09, 0x1D, 0xBE, 0x7F, 0x41, 0x55, 0xB5, 0x5C, 0xBA, 0x92, 0xC0, 0xD1, 0xCE, 0xFA, 0x0B, 0xF5, 0xDA, 0x6F, 
+    0x76, 0x7B, 0xBF, 0x97, 0x16, 0x81, 0x8C, 0x90, 0x6E, 0xEC, 0x42, 0xA0, 0x0A, 0x00, 0xA7, 0x87, 0xF8, 0xF0, 0x28, 0x33, 
+    0xFD, 0x1A, 0xAD, 0x82, 0x0B, 0xFA, 0x0A, 0x82, 0x15, 0xBD, 0xFC, 0xAC, 0x17, 0x56, 0x01, 0xB8, 0xC8, 0x35, 0xC1, 0xC2, 
+    0x0A, 0x7F, 0x09, 0xBA, 0xFF, 0xCB, 0xA8, 0x82, 0x2C, 0x8E, 0xD7, 0xDF, 0x06, 0x01, 0xC6, 0x7A, 0xB5, 0xD9, 0xFD, 0xE0, 
+    0xB1, 0xC5, 0xE3, 0xE9, 0xF1, 0x19, 0x6F, 0xE6, 0x75, 0xA6, 0x5B, 0xD4, 0xFD, 0x1E, 0xEB, 0x3E, 0x50, 0x8F, 0xCC, 0x78, 
+    0x2D, 0x97, 0x99, 0x71, 0x71, 0xBA, 0x14, 0xE9, 0xE8, 0x74, 0x59, 0x64, 0x6E, 0xD4, 0x99, 0x81, 0xB6, 0xD6, 0x60, 0x8F, 
+    0x75, 0x67, 0x60, 0xDA, 0xB9, 0x0E, 0xB1, 0xBD, 0x07, 0x66, 0x15, 0xF2, 0xD5, 0xEB, 0x6C, 0xB3, 0x9A, 0xCF, 0xA1, 0xA0, 
+    0x65, 0x56, 0xB0, 0x10, 0xFE, 0xC5, 0xDD, 0x40, 0xDC, 0x86, 0xCD, 0x4C, 0xA3, 0x29, 0xC6, 0x3B, 0xCF, 0x38, 0x8A, 0x2E, 
+    0x51, 0x82, 0x33, 0xA7, 0x85, 0xFA, 0x98, 0x36, 0x6C, 0x65, 0x05, 0x0F, 0x07, 0xDF, 0xF2, 0x15, 0x5F, 0x5A, 0xB4, 0x91, 
+    0x06, 0x07, 0x1E, 0xCB, 0x5F, 0x2B, 0xC1, 0x65, 0xBE, 0xE6, 0xEB, 0xC0, 0xAF, 0x71, 0x25, 0xB2, 0xF0, 0x6F, 0x8C, 0x55, 
+    0xAE, 0x8D, 0x84, 0x07, 0xBD, 0x3D, 0xDA, 0xA0, 0x5F, 0xAB, 0x1B, 0x22, 0xF9, 0xE7, 0x54, 0xE4, 0x33, 0x9C, 0x8B, 0xDF, 
+    0xE2, 0x56, 0xFC, 0xEB, 0xE4, 0x91, 0xDA, 0x07, 0x1F, 0xB7, 0xF0, 0xDB, 0x03, 0x6C, 0x0E, 0xB2, 0xCA, 0xED, 0x88, 0xEB, 
+    0xB2, 0x15, 0x28, 0xC2, 0x63, 0x5D, 0x24, 0x31, 0xD5, 0xDB, 0x3D, 0xC2, 0xE7, 0x8C, 0x9F, 0x52, 0x81, 0x36, 0xCD, 0x14, 
+    0x95, 0x1F, 0xFD, 0x20, 0x65, 0x7B, 0xD9, 0x76, 0xCB, 0xEE, 0x63, 0xBC, 0xB5, 0xD6, 0x71, 0x09, 0x93, 0x94, 0x90, 0xC7, 
+    0xDD, 0xAE, 0x18, 0xA4, 0xAB, 0x0D, 0xAC, 0xB8, 0xFA, 0x03, 0x56, 0x33, 0xA1, 0x5F, 0xD1, 0x3A, 0xA1, 0x07, 0x62, 0x4E, 
+    0xE9, 0x2F, 0xE6, 0x38, 0x3C, 0xFB, 0x13, 0xFD, 0xB7, 0x7E, 0x80, 0x03, 0x0B, 0xD7, 0x77, 0x60, 0x1E, 0xD4, 0x5C, 0x09, 
+    0x2A, 0xEB, 0x58, 0x52, 0xDA, 0xFD, 0x6D, 0xB5, 0x5A, 0xD0, 0x04, 0xFD, 0x15, 0x9D, 0xAF, 0x77, 0x85, 0x48, 0x0A, 0x44, 
+    0xBC, 0x09, 0x65, 0xE6, 0x06, 0x0B, 0x3A, 0x02, 0x67, 0x4B, 0x6A, 0xD0, 0x76, 0x68, 0x4D, 0xE0, 0x0B, 0x89, 0xFE, 0xC5, 
+    0xFA, 0x41, 0x77, 0x0E, 0x4F, 0xA8, 0x32, 0xBC, 0xF0, 0x8E, 0x4F, 0x79, 0x12, 0x7D, 0xC8, 0xB7, 0xDE, 0x84, 0xD3, 0x08, 
+    0x10, 0x7E, 0x44, 0x41, 0x50, 0x0D, 0x7E, 0xE6, 0xF4, 0x29, 0xBA, 0x60, 0x9F, 0xBE, 0xAE, 0xB3, 0xF0, 0x9C, 0x15, 0x7C, 
+    0x1A, 0x74, 0x66, 0xFB, 0xC4, 0x0E, 0x74, 0xAC, 0xD1, 0x28, 0x22, 0x9E, 0x89, 0xBD, 0xA5, 0x7E, 0x2E, 0x61, 0x39, 0x83, 
+    0xA7, 0x5A, 0x02, 0x44, 0x02, 0x00, 0x5B, 0xED, 0x53, 0x35, 0x61, 0xE9, 0x8A, 0x86, 0xD8, 0xB4, 0x25, 0xF7, 0xC5, 0xE1, 
+    0xA0, 0x09, 0x45, 0x86, 0xD9, 0x24, 0xCB, 0x8A, 0xF5, 0xEE, 0x55, 0xB2, 0x4B, 0xA2, 0xB6, 0x68, 0xBF, 0xCB, 0x15, 0x3E, 
+    0x0D, 0x1D, 0xE3, 0x39, 0xF1, 0xDA, 0x50, 0x73, 0xFF, 0x84, 0xB8, 0xB4, 0xCE, 0x15, 0x8B, 0x75, 0x0E, 0x7E, 0x21, 0x01, 
+    0x47, 0x71, 0x3F, 0x93, 0x21, 0x8E, 0x14, 0x5F, 0x61, 0xEA, 0x13, 0xA7, 0xD5, 0x05, 0x86, 0x75, 0x13, 0xCB, 0x7B, 0xE5, 
+    0x1B, 0x7D, 0x9F, 0xFB, 0x24, 0x97, 0xB9, 0xCF, 0xAF, 0x0E, 0xFB, 0xAB, 0xA1, 0x79, 0x1E, 0xE1, 0x26, 0xF7, 0xDB, 0xE8, 
+    0xDC, 0x1F, 0x7E, 0x7A, 0xF6, 0x4F, 0x04, 0x65, 0x2E, 0x4F, 0x94, 0xEF, 0x1C, 0x75, 0x8F, 0xF2, 0x2A, 0xA8, 0xEE, 0x35, 
+    0xDD, 0x06, 0xFB, 0xC8, 0x69, 0x88, 0x67, 0x5E, 0xB7, 0x74, 0x1D, 0xF6, 0xAD, 0xF2, 0xCE, 0xA0, 0xDC, 0x5B, 0x33, 0x01, 
+    0xE4, 0xBB, 0xDE, 0x5A, 0xB7, 0xF3, 0xA0, 0x79, 0x7F, 0x9D, 0x69, 0x44, 0x12, 0x79, 0xBB, 0xCD, 0x1D, 0x63, 0xE4, 0x8C, 
+    0xE3, 0x65, 0x8D, 0x21, 0x87, 0xD1, 0xAF, 0x17, 0xA1, 0x87, 0x45, 0x90, 0x37, 0x76, 0x00, 0xD3, 0xCD, 0xBA, 0x9E, 0xBC, 
+    0x76, 0xB3, 0xF0, 0x1B, 0xE3, 0xF0, 0x25, 0xD6, 0x97, 0xB1, 0x7F, 0x79, 0xFD, 0xDD, 0xB7, 0x2C, 0xF8, 0x70, 0xDC, 0x86, 
+    0x2D, 0x7A, 0xE8, 0xB9, 0x1E, 0xAB, 0x28, 0xB5, 0x1B, 0x8E, 0xFD, 0xD0, 0x34, 0xA5, 0xF8, 0xBE, 0x35, 0xCC, 0x28, 0xB4, 
+    0xFE, 0x78, 0x02, 0xD8, 0x79, 0x37, 0x6E, 0xC7, 0x7A, 0x95, 0x20, 0xA5, 0xC2, 0x2C, 0xB1, 0x29, 0xE2, 0x0A, 0x7D, 0xE0, 
+    0x6C, 0x2D, 0xF6, 0x1F, 0xB6, 0x99, 0xBF, 0x95, 0xB1, 0x3E, 0xF8, 0x9E, 0xA9, 0x04, 0x30, 0x88, 0xF7, 0x8D, 0xA1, 0x3A, 
+    0x51, 0xB7, 0xAC, 0xE8, 0x03, 0x98, 0x64, 0x1B, 0x0E, 0xB3, 0x28, 0x44, 0x49, 0xCE, 0x68, 0xCC, 0xEC, 0x7D, 0x29, 0x4C, 
+    0x88, 0x90, 0x9C, 0xC5, 0x30, 0xE1, 0x08, 0xF1, 0xE7, 0xF4, 0x74, 0x3A, 0xF8, 0x0F, 0xE8, 0x32, 0xC2, 0xB5, 0xC2, 0x0D, 
+    0x5B, 0x59, 0xC0, 0x78, 0xEA, 0x66, 0xC4, 0xF3, 0x10, 0xEC, 0xF7, 0xF6, 0x1A, 0x34, 0x6F, 0xB9, 0x7B, 0xB2, 0x4A, 0x97, 
+    0x37, 0x44, 0xDC, 0x98, 0x7A, 0x23, 0x6D, 0xC2, 0x5E, 0x06, 0x7E, 0x0B, 0xA7, 0x44, 0xCD, 0x52, 0x9D, 0x94, 0x09, 0x3F, 
+    0x94, 0xEF, 0xE9, 0x10, 0x3E, 0xC9, 0xE0, 0x43, 0x6C, 0x88, 0xD5, 0x1A, 0xB6, 0x3A, 0x8D, 0x98, 0xA1, 0x69, 0x6B, 0xCC, 
+    0x50, 0x8E, 0xF7, 0x59, 0xC4, 0x5C, 0x53, 0x19, 0x93, 0x97, 0xDE, 0xE0, 0xD6, 0xCF, 0x76, 0xBD, 0xFA, 0x89, 0x93, 0xD8, 
+    0x1B, 0xCF, 0x84, 0x8D, 0x2D, 0x14, 0x0C, 0x39, 0x26, 0x9C, 0x6A, 0x1F, 0xD8, 0x60, 0x68, 0x12, 0xC9, 0x4B, 0xA0, 0xCA, 
+    0x81, 0x73, 0x74, 0x5F, 0xCC, 0x9F, 0x8E, 0x18, 0x4A, 0x38, 0x60, 0x14, 0xB5, 0x01, 0x69, 0x1A, 0xB3, 0x1F, 0x80, 0x74, 
+    0xA4, 0x04, 0xCF, 0x8C, 0x59, 0xDF, 0xB3, 0x51, 0x36, 0x40, 0xB4, 0xE1, 0x89, 0x1A, 0x3B, 0xD6, 0x44, 0x7F, 0xAF, 0x28, 
+    0x53, 0xB5, 0xAC, 0x6F, 0xAE, 0xCD, 0x1F, 0xEC, 0x9A, 0x12, 0x6F, 0xE8, 0xAC, 0xE9, 0x14, 0xBC, 0xCE, 0xD0, 0x2E, 0xFF, 
+    0x28, 0xB4, 0x8F, 0x6C, 0x7C, 0x05, 0x83, 0x1D, 0x56, 0x55, 0x10, 0xF9, 0x73, 0x8C, 0x84, 0x10, 0x7F, 0x64, 0xAC, 0x60, 
+    0xF4, 0x4D, 0x98, 0xDD, 0x34, 0x88, 0xA1, 0x3B, 0xAB, 0x95, 0xF7, 0x45, 0xB4, 0x0D, 0x5D, 0x06, 0x3B, 0x02, 0xEA, 0x3D, 
+    0xC3, 0x79, 0x4E, 0xF9, 0x68, 0xA8, 0x21, 0xC7, 0x5A, 0x76, 0xC7, 0xA7, 0x44, 0x21, 0x82, 0x32, 0xE0, 0x73, 0xEA, 0xC4, 
+    0xDD, 0x0B, 0x5C, 0x6B, 0x25, 0x27, 0x5C, 0x83, 0x76, 0x5D, 0x3D, 0x4C, 0x11, 0xAA, 0x81, 0x51, 0x42, 0xDC, 0xF9, 0x1E, 
+    0xBE, 0x42, 0x1B, 0x3B, 0xC7, 0xDA, 0x49, 0x1D, 0x7C, 0x18, 0x2A, 0xEA, 0x92, 0x76, 0x24, 0xEA, 0x7B, 0x19, 0x2B, 0x9B, 
+    0x23, 0xF1, 0xFC, 0x20, 0x60, 0x20, 0x4F, 0x24, 0xDC, 0x47, 0x12, 0x1F, 0x10, 0xD6, 0x90, 0x37, 0x71, 0x34, 0x1D, 0x5A, 
+    0x72, 0x89, 0x45, 0x1C, 0x3B, 0xF5, 0xF1, 0xF4, 0x44, 0x12, 0xA6, 0xFB, 0x70, 0x28, 0x19, 0x12, 0x99, 0xF1, 0x27, 0x68, 
+    0xEE, 0xA0, 0xDE, 0xF0, 0xC9, 0x83, 0x40, 0xA3, 0xD8, 0x9D, 0x78, 0xB8, 0x75, 0xF7, 0x8A, 0x45, 0x5A, 0xE4, 0xFA, 0xD9, 
+    0xC4, 0x14, 0x0C, 0x09, 0x0F, 0x13, 0x16, 0x0E, 0x5F, 0xBD, 0xF8, 0x5F, 0x2F, 0x5F, 0x7D, 0xF6, 0xC7, 0xCF, 0xCF, 0x3E, 
+    0xFD, 0xFC, 0x8F, 0xAF, 0xCE, 0x2E, 0x2E, 0xB2, 0xF1, 0xD9, 0x9F, 0xFE, 0xF8, 0xD9, 0x7F, 0x9D, 0x7D, 0xF4, 0xD1, 0x47, 
+    0x1F, 0x7F, 0xFC, 0xE1, 0xC7, 0x1F, 0xF5, 0xE9, 0x3F, 0x8F, 0x65, 0x94, 0x5C, 0x73, 0xAB, 0xB2, 0x5B, 0xE2, 0xAA, 0x82, 
+    0x71, 0x5F, 0x86, 0xEE, 0xBA, 0x63, 0x53, 0x97, 0x6F, 0xAA, 0xD3, 0x81, 0x23, 0x99, 0xEF, 0xD9, 0xF2, 0x3B, 0xAF, 0xD6, 
+    0x59, 0x61, 0x7F, 0xFF, 0x66, 0x10, 0x9E, 0x16, 0xD7, 0xBE, 0xAA, 0xE7, 0xB5, 0x39, 0xFF, 0xAE, 0xBD, 0x1E, 0xFE, 0xFA, 
+    0x3B, 0xAA, 0x53, 0xCC, 0x77, 0xFD, 0xFA, 0xBB, 0xAA, 0xE4, 0xBC, 0xF5, 0xFB, 0xFA, 0xBC, 0x59, 0x46, 0x5F, 0x94, 0xF3, 
+    0x6E, 0x30, 0x17, 0xBD, 0x13, 0x6C, 0xB4, 0xB1, 0xA3, 0x18, 0x3B, 0x70, 0xCF, 0x28, 0x61, 0xF4, 0x9C, 0x7B, 0x14, 0x7D, 
+    0xCD, 0xC2, 0x78, 0x7E, 0x2C, 0xEA, 0x76, 0x63, 0xE7, 0x56, 0x9B, 0x60, 0xEE, 0x57, 0xF9, 0xC6, 0x57, 0x89, 0xDB, 0x22, 
+    0xC7, 0xC9, 0xB4, 0x05, 0x8F, 0x45, 0xC7, 0xCF, 0xA4, 0xA9, 0xE2, 0x3F, 0x19, 0x66, 0x62, 0xB1, 0x86, 0x87, 0x1E, 0xFC, 
+    0x29, 0xAB, 0x3E, 0x2B, 0xED, 0x59, 0x27, 0x62, 0x72, 0x18, 0xCA, 0xE5, 0x8F, 0xBB, 0x57, 0x72, 0x2D, 0x4F, 0xFD, 0x98, 
+    0x76, 0xC6, 0x77, 0x62, 0x48, 0x07, 0x63, 0xC5, 0x00, 0xFC, 0x64, 0x6B, 0x1F, 0x78, 0x96, 0x6C, 0x58, 0x53, 0x7D, 0xCF, 
+    0xD4, 0x88, 0xB4, 0x2C, 0x57, 0xC3, 0x2C, 0x55, 0x72, 0x83, 0x22, 0xC8, 0x88, 0x45, 0x94, 0x03, 0xB7, 0x24, 0x2D, 0x82, 
+    0x8D, 0xF7, 0x17, 0xE4, 0x00, 0xCA, 0xE1, 0x38, 0x46, 0x77, 0xA1, 0x59, 0xA8, 0x7B, 0x99, 0x04, 0x8E, 0x73, 0xF1, 0xB6, 
+    0xF5, 0xAE, 0xDE, 0x63, 0x37, 0x9B, 0x28, 0x0B, 0x95, 0x3D, 0x14, 0x78, 0x30, 0xC0, 0x70, 0x7B, 0x57, 0xDC, 0x15, 0xE1, 
+    0x3B, 0x95, 0x7A, 0x13, 0xC4, 0x78, 0x67, 0xFB, 0xBE, 0xF1, 0x03, 0xE2, 0xD7, 0x71, 0x11, 0x88, 0x58, 0xCD, 0x74, 0xB2, 
+    0x57, 0x1A, 0x5C, 0x56, 0x74, 0x72, 0x89, 0xC8, 0x69, 0x22, 0xC4, 0xC7, 0x95, 0x3C, 0x15, 0xA5, 0x1D, 0x44, 0x7A, 0xB7, 
+    0x3E, 0xDD, 0x89, 0x3A, 0x67, 0x93, 0x03, 0x3B, 0xD8, 0xBC, 0x68, 0xF6, 0x2B, 0x78, 0xE2, 0x98, 0x5A, 0xE8, 0x84, 0x66, 
+    0xB5, 0x16, 0x3D, 0xCE, 0x25, 0xED, 0x97, 0x3A, 0x26, 0x2C, 0xD9, 0xB2, 0x06, 0xC9, 0xE8, 0x01, 0x67, 0xFB, 0x72, 0xB5, 
+    0xBA, 0xD9, 0x5A, 0x0F, 0x3A, 0x95, 0x85, 0x28, 0xCA, 0x7A, 0x0E, 0x03, 0xA8, 0x56, 0x1B, 0x59, 0x33, 0x78, 0x63, 0x06, 
+    0xEC, 0xB2, 0xC2, 0x9C, 0x60, 0x13, 0xE6, 0x93, 0x3E, 0x3A, 0x12, 0x69, 0x1D, 0x19, 0xE3, 0x9B, 0xD6, 0x2D, 0x4B, 0x59, 
+    0x05, 0xEF, 0x8D, 0xF9, 0x72, 0x4B, 0x15, 0x46, 0x2F, 0x77, 0xC2, 0xB6, 0x96, 0x1D, 0x5C, 0xA2, 0x60, 0x83, 0xF1, 0xFD, 
+    0x07, 0x0B, 0xF9, 0x20, 0x06, 0x75, 0xFA, 0xDA, 0x1E, 0x59, 0x59, 0xCF, 0x3F, 0xE7, 0xF0, 0x4A, 0x41, 0xB3, 0x99, 0xE5, 
+    0x8C, 0x09, 0x04, 0xFB, 0xA6, 0x9E, 0xE4, 0x7A, 0xE5, 0xB8, 0xBC, 0xBD, 0x2E, 0xED, 0xA4, 0xC2, 0x0E, 0xD4, 0x50, 0xCB, 
+    0x66, 0xC1, 0x01, 0x35, 0xD5, 0x4F, 0x99, 0x44, 0x7B, 0xA9, 0xE3, 0x97, 0xB6, 0xA5, 0x93, 0xCE, 0xBF, 0xA8, 0x85, 0xD7, 
+    0xED, 0x38, 0x7A, 0x94, 0xBE, 0xC4, 0xD5, 0xC5, 0xAC, 0x2A, 0xEC, 0x7F, 0x55, 0xDF, 0x48, 0x9F, 0x64, 0xB1, 0x59, 0x70, 
+    0x83, 0xA2, 0xAC, 0xEF, 0x7D, 0x76, 0xC4, 0x86, 0xD4, 0xB0, 0x75, 0x23, 0x54, 0xC1, 0xC5, 0x6E, 0xB9, 0x41, 0x15, 0x34, 
+    0xF4, 0x0E, 0x51, 0x7A, 0x61, 0xA9, 0x4F, 0xEE, 0x72, 0xB2, 0x3E, 0x5E, 0x9F, 0x85, 0x82, 0x06, 0x5E, 0xCA, 0x2D, 0xD5, 
+    0x02, 0xB0, 0xEF, 0xDB, 0x9A, 0x2D, 0x95, 0xE0, 0x58, 0xDD, 0xFC, 0xED, 0x9D, 0xF5, 0x68, 0x40, 0x95, 0x6D, 0x00, 0xDB, 
+    0xDA, 0x36, 0xC1, 0xB9, 0x6B, 0x64, 0x75, 0xA1, 0x8A, 0xAA, 0xFC, 0x45, 0x10, 0x3C, 0xB4, 0x9F, 0x1C, 0x85, 0xA8, 0xA9, 
+    0xBB, 0x21, 0xCE, 0xCE, 0x72, 0xB8, 0xB3, 0x73, 0x65, 0x6A, 0x63, 0x85, 0xD0, 0xCF, 0xB4, 0x37, 0x8E, 0x2F, 0x9C, 0x2C, 
+    0x04, 0x9B, 0x04, 0xE9, 0x4D, 0xEA, 0x84, 0x0C, 0xB2, 0x68, 0x00, 0x9E, 0xA8, 0x54, 0x52, 0x81, 0xE1, 0x40, 0x38, 0x7B, 
+    0x86, 0x53, 0xE0, 0xF2, 0x6E, 0x57, 0xE9, 0x37, 0x06, 0x4D, 0xC7, 0xD4, 0x79, 0x4A, 0xDD, 0x2F, 0x5C, 0x31, 0x85, 0x96, 
+    0x8B, 0xBE, 0x46, 0xA8, 0xC5, 0xB3, 0x51, 0x0C, 0x06, 0x2C, 0x7F, 0x7E, 0xD5, 0xDB, 0x07, 0x57, 0x79, 0x97, 0x5E, 0x86, 
+    0xC5, 0xE7, 0x23, 0xFE, 0x40, 0xAF, 0xFB, 0xE0, 0x5C, 0x87, 0x94, 0x52, 0x6F, 0xA2, 0xA1, 0xF7, 0x66, 0xB5, 0xF6, 0x94, 
+    0xF7, 0x77, 0xB0, 0xF7, 0xF4, 0xFB, 0xD9, 0x6A, 0xB7, 0x5B, 0x2D, 0xE8, 0xE1, 0x6B, 0x48, 0x51, 0x46, 0xEA, 0x87, 0x63, 
+    0xE1, 0x77, 0x09, 0xFF, 0x40, 0x15, 0x04, 0x57, 0x5F, 0x04, 0x21, 0x0B, 0x70, 0xF0, 0xE2, 0xB5, 0x9E, 0xF9, 0x77, 0x38, 
+    0x43, 0xEA, 0x38, 0xFA, 0x6A, 0x35, 0x67, 0xC5, 0xAC, 0xAE, 0xF1, 0x8F, 0x48, 0x08, 0xD1, 0xED, 0x36, 0x6A, 0x3A, 0x01, 
+    0xC4, 0x45, 0xBC, 0xB6, 0xF3, 0x6F, 0x33, 0x18, 0x27, 0x08, 0x64, 0xE5, 0x5E, 0x7B, 0x34, 0x95, 0x77, 0xD2, 0xC1, 0x53, 
+    0x01, 0xF6, 0x1A, 0xEC, 0xD2, 0x14, 0x54, 0x62, 0x16, 0x98, 0x66, 0xB8, 0xF6, 0xA9, 0xCA, 0x88, 0xEE, 0x52, 0xB8, 0xAE, 
+    0xA7, 0x16, 0xAC, 0x4F, 0xB8, 0x0A, 0x31, 0x8E, 0x0A, 0xAA, 0x31, 0xAD, 0x73, 0x18, 0xD8, 0x4E, 0x38, 0xD6, 0xF0, 0x35, 
+    0x2B, 0xAE, 0xF9, 0xA5, 0x6D, 0x81, 0x89, 0x27, 0x16, 0x84, 0xFE, 0x75, 0x94, 0xAA, 0xF4, 0xD8, 0x15, 0xC0, 0xB5, 0x94, 
+    0x60, 0xDF, 0xCE, 0x19, 0x07, 0x24, 0xD0, 0xCA, 0xB5, 0xD6, 0xF4, 0x3D, 0x65, 0xDF, 0x5E, 0x70, 0x09, 0x10, 0xE7, 0xA1, 
+    0xB9, 0x03, 0x40, 0xCA, 0x54, 0x99, 0x4F, 0x41, 0x09, 0x03, 0x45, 0x9C, 0x84, 0xD7, 0xB1, 0xE9, 0x47, 0x10, 0xCE, 0xE2, 
+    0x94, 0x5D, 0x86, 0xE2, 0x52, 0x60, 0x7C, 0x50, 0x3F, 0x0A, 0x1F, 0x6E, 0xBC, 0x92, 0xEC, 0xD9, 0x4F, 0x09, 0x62, 0x7B, 
+    0x96, 0x57, 0xFD, 0xC7, 0xE5, 0x19, 0x3A, 0x6A, 0x84, 0x3A, 0x2A, 0x5C, 0xCA, 0xEC, 0x07, 0xB3, 0xA6, 0x5F, 0x6C, 0x92, 
+    0x09, 0xE7, 0xD0, 0x36, 0x16, 0x8E, 0x89, 0xD0, 0xC9, 0xC9, 0x27, 0xF3, 0xD9, 0xF2, 0xE6, 0xFC, 0xF2, 0x13, 0xB6, 0xE3, 
+    0xBA, 0xFC, 0xE4, 0x5C, 0xFF, 0x1A, 0xAB, 0xA8, 0xF3, 0xE4, 0x83, 0xCB, 0x04, 0x76, 0x51, 0x62, 0x4C, 0xC4, 0x91, 0x48, 
+    0xA2, 0x0F, 0x4C, 0xD7, 0x3F, 0x80, 0x71, 0xD1, 0x0D, 0x01, 0x40, 0x02, 0xC9, 0xCF, 0x8F, 0xD3, 0x19, 0x51, 0x60, 0x6B, 
+    0x62, 0xF9, 0xB5, 0x48, 0xC7, 0xB1, 0x24, 0xB2, 0xCC, 0xCB, 0x4D, 0x6F, 0x07, 0x71, 0x59, 0xD4, 0x39, 0x12, 0x71, 0xC5, 
+    0xDB, 0x89, 0x34, 0xCD, 0x40, 0xD5, 0x4D, 0x6F, 0xBA, 0x5B, 0xCC, 0x5F, 0x17, 0x9B, 0x59, 0x32, 0x87, 0x33, 0x94, 0xCE, 
+    0xD1, 0x82, 0x18, 0x48, 0xBD, 0xDC, 0xC7, 0x2F, 0xE7, 0xB4, 0x0F, 0x22, 0xEF, 0x93, 0x70, 0x99, 0xBC, 0xA5, 0xD1, 0xF1, 
+    0x0F, 0xD0, 0x64, 0x63, 0xF2, 0xE8, 0x03, 0x15, 0xCE, 0x90, 0x9D, 0x8D, 0x7D, 0x08, 0xA0, 0x7A, 0x2B, 0xA2, 0x28, 0x79, 
+    0xA2, 0x94, 0x38, 0x0C, 0xD2, 0x81, 0xA1, 0x69, 0xE0, 0x9E, 0xB2, 0x2E, 0xA5, 0x00, 0x91, 0x59, 0x2D, 0x68, 0x11, 0xB5, 
+    0x6E, 0x12, 0x24, 0x8F, 0xCD, 0xAD, 0x2A, 0xD3, 0xFF, 0x89, 0x09, 0xF0, 0x7A, 0xF9, 0x40, 0x33, 0x6F, 0x9E, 0x31, 0xA5, 
+    0xCB, 0x15, 0xF7, 0xDC, 0x94, 0x67, 0x8B, 0x99, 0x4A, 0xDF, 0xAC, 0xC7, 0xC7, 0x8A, 0xE9, 0x54, 0xAD, 0x27, 0xE0, 0xC8, 
+    0x9A, 0x16, 0x61, 0x7A, 0x11, 0x19, 0xEC, 0x3E, 0x38, 0x31, 0xC3, 0xF8, 0x40, 0x3F, 0x7C, 0x70, 0xC2, 0x11, 0x43, 0x3E, 
+    0xD8, 0xE9, 0xC5, 0xE5, 0x64, 0x99, 0xC6, 0x7A, 0x1F, 0x8E, 0xF5, 0xC8, 0x8C, 0xD5, 0x0E, 0x83, 0xE5, 0xD0, 0x98, 0xA8, 
+    0xB4, 0x1A, 0xD1, 0xCB, 0x4F, 0xEB, 0x82, 0xEA, 0x8C, 0xA8, 0xE2, 0x9B, 0x4A, 0x44, 0xAF, 0x7A, 0x25, 0x17, 0x50, 0x30, 
+    0x6A, 0x74, 0x84, 0x4A, 0xF9, 0xB4, 0x6F, 0xFF, 0x5B, 0x42, 0xBE, 0xD4, 0x15, 0xF2, 0xE5, 0xED, 0x42, 0xBE, 0x83, 0xDF, 
+    0x10, 0x36, 0x32, 0x3E, 0x3C, 0x26, 0x70, 0x6C, 0xF1, 0x1A, 0x24, 0xF2, 0x79, 0xF6, 0x41, 0x04, 0xD7, 0x6A, 0xB3, 0x25, 
+    0x7B, 0x10, 0xCA, 0xE0, 0xF9, 0xD3, 0xEB, 0xA6, 0xCA, 0xBF, 0x19, 0x12, 0x19, 0xF3, 0xD9, 0x5D, 0x4A, 0xFB, 0x6F, 0xEB, 
+    0x8D, 0xA2, 0x4C, 0x24, 0x4A, 0x60, 0x75, 0xAB, 0x26, 0x7B, 0x99, 0xF2, 0x80, 0x00, 0x6A, 0xD9, 0x73, 0x87, 0x09, 0x02, 
+    0x33, 0xA2, 0x19, 0x41, 0xD6, 0x5D, 0x0A, 0x06, 0xB9, 0x91, 0x51, 0xF2, 0x59, 0xF4, 0xD3, 0x3B, 0x42, 0x0D, 0x73, 0x8C, 
+    0x61, 0xC4, 0x22, 0xBE, 0x29, 0x1E, 0xCF, 0x39, 0xD8, 0x30, 0xE5, 0x5C, 0xAC, 0xEE, 0xB6, 0xC5, 0x7E, 0xBD, 0x9A, 0x2D, 
+    0x69, 0x43, 0xEC, 0xB5, 0xA2, 0x31, 0x0D, 0xF7, 0x2E, 0xD8, 0xF3, 0xD4, 0x9F, 0x73, 0x28, 0x62, 0xCA, 0xA8, 0x47, 0x26, 
+    0x41, 0xD2, 0xF9, 0x2F, 0xED, 0xA1, 0x74, 0x7E, 0xB7, 0x81, 0x74, 0x91, 0x63, 0x12, 0x0F, 0x7F, 0xE9, 0x8D, 0x9E, 0x73, 
+    0x90, 0xE4, 0x9E, 0xDF, 0x43, 0xB8, 0x66, 0xD7, 0xB0, 0x2C, 0x49, 0x5D, 0x77, 0xC6, 0x65, 0x24, 0x4C, 0x27, 0xD9, 0x89, 
+    0x8D, 0x98, 0x21, 0xD9, 0x09, 0xE2, 0xF9, 0x58, 0xF5, 0x6A, 0x57, 0xDE, 0x33, 0x30, 0x13, 0xCF, 0xD0, 0xF3, 0x34, 0x99, 
+    0xAF, 0xD2, 0x64, 0x0E, 0x26, 0xBE, 0xAE, 0xBF, 0x5B, 0x71, 0x71, 0x5B, 0xFA, 0x56, 0x52, 0x73, 0x71, 0x30, 0xAB, 0x6E, 
+    0xD5, 0xA6, 0x64, 0x14, 0x18, 0x93, 0x6E, 0x10, 0x28, 0x66, 0x6A, 0xAF, 0xED, 0x66, 0x51, 0x46, 0xC8, 0x77, 0x66, 0x52, 
+    0x88, 0xA6, 0x99, 0x59, 0x1B, 0x01, 0x0E, 0x45, 0x76, 0x37, 0xCB, 0xA1, 0x5E, 0xC3, 0x0F, 0x91, 0x11, 0x90, 0x05, 0x8A, 
+    0x4E, 0xAF, 0x8D, 0x74, 0x6F, 0x2B, 0x67, 0x99, 0x79, 0x13, 0x37, 0x36, 0xF0, 0xD4, 0x21, 0x55, 0x06, 0x2C, 0x69, 0x33, 
+    0x6F, 0x6D, 0x97, 0xAB, 0x9A, 0xE0, 0x81, 0xEB, 0xD1, 0xBF, 0xEA, 0x8B, 0x72, 0x7D, 0x6D, 0x26, 0xB7, 0x89, 0xEC, 0x93, 
+    0x4E, 0x70, 0x99, 0x31, 0x82, 0x34, 0x39, 0x40, 0x1E, 0xB0, 0x91, 0xA0, 0x28, 0x69, 0xDC, 0xF4, 0xA8, 0xE7, 0x0B, 0xE7, 
+    0xE2, 0xFF, 0xA0, 0x24, 0x29, 0xE2, 0xB8, 0x10, 0xCC, 0x69, 0x11, 0xBE, 0x74, 0xD4, 0x01, 0x3D, 0x0F, 0xEA, 0x0A, 0x69, 
+    0xD3, 0x41, 0xA6, 0x8D, 0x01, 0x0C, 0xBF, 0x98, 0xA2, 0x38, 0xB8, 0x8A, 0x6E, 0x39, 0x12, 0xB0, 0x5A, 0x47, 0x1C, 0x42, 
+    0x57, 0x2A, 0xD3, 0xD2, 0xA2, 0x9E, 0xB1, 0x21, 0x0E, 0xD4, 0x8A, 0x1D, 0x21, 0x98, 0x2E, 0xB2, 0xE1, 0x65, 0x32, 0x1F, 
+    0xAE, 0x46, 0x50, 0x32, 0xA5, 0x4A, 0x20, 0x0A, 0xE4, 0xBD, 0x3A, 0xA1, 0x0D, 0x88, 0xD3, 0x25, 0xBC, 0xEE, 0xA5, 0xC4, 
+    0x7A, 0xB3, 0x38, 0x7A, 0xBF, 0x5F, 0xA9, 0xA3, 0x65, 0xE7, 0xA5, 0x8C, 0xF0, 0x89, 0xDD, 0x3F, 0xAD, 0xD4, 0x8A, 0xA6, 
+    0x88, 0xEB, 0xB8, 0x15, 0x79, 0x49, 0xAE, 0xF4, 0x42, 0x86, 0x74, 0xEA, 0xD3, 0x52, 0x85, 0xB2, 0x70, 0xCA, 0x2C, 0x69, 
+    0x58, 0x54, 0x63, 0x86, 0xB3, 0x56, 0xFC, 0x11, 0x63, 0x4B, 0x1D, 0x62, 0x8B, 0xF0, 0x13, 0xA1, 0x56, 0x3E, 0x21, 0xC3, 
+    0xB5, 0xB6, 0x8F, 0xEE, 0x41, 0xC3, 0x77, 0x46, 0xEB, 0xBC, 0x8C, 0x26, 0xD4, 0x3B, 0xAC, 0xB1, 0x3C, 0xB1, 0x1F, 0x1B, 
+    0x3B, 0xBA, 0x97, 0xAB, 0x3B, 0x02, 0xDF, 0xBE, 0xBA, 0x06, 0x2E, 0xB8, 0x5B, 0xC3, 0xC1, 0x0B, 0x3F, 0x94, 0x76, 0x94, 
+    0x6B, 0x75, 0x03, 0x4B, 0xCA, 0xCE, 0x05, 0xD5, 0xD0, 0xBC, 0x4A, 0x8C, 0x5B, 0x6E, 0x17, 0x57, 0x04, 0xDD, 0xF0, 0xF9, 
+    0x9C, 0x54, 0x91, 0x72, 0xE3, 0xF2, 0xD0, 0xEB, 0x52, 0x4E, 0xE8, 0x93, 0x5E, 0xA3, 0x0E, 0x2C, 0x09, 0x7E, 0x4D, 0xCB, 
+    0xF3, 0x40, 0xCD, 0x0D, 0xCC, 0x1B, 0x18, 0xAF, 0x26, 0x44, 0x32, 0x73, 0x90, 0x01, 0xC6, 0x4B, 0xA3, 0xB4, 0x57, 0x1B, 
+    0x1A, 0x11, 0xD4, 0x7D, 0xF8, 0x99, 0x59, 0x1A, 0xBF, 0x13, 0xCA, 0xAC, 0x9C, 0xEC, 0x58, 0x4C, 0x08, 0x61, 0xFA, 0x81, 
+    0xBE, 0x6C, 0x69, 0x2A, 0x17, 0xFE, 0xEE, 0x1D, 0xAC, 0x65, 0x6C, 0xAC, 0x31, 0x5B, 0xDB, 0xCF, 0x34, 0xB4, 0x9B, 0x72, 
+    0x2F, 0x82, 0x97, 0x3F, 0x02, 0xE7, 0xD7, 0x75, 0x38, 0xBF, 0x16, 0xAF, 0x4E, 0xD3, 0x12, 0xD4, 0xAF, 0x1D, 0x50, 0x9F, 
+    0x6A, 0x50, 0x9F, 0xBE, 0x0B, 0xD4, 0xE1, 0x51, 0xFA, 0x38, 0xA4, 0xE7, 0xF1, 0xBC, 0x0A, 0xE9, 0xF3, 0x2A, 0xA4, 0x2F, 
+    0xA3, 0x1B, 0xCE, 0xCD, 0x7E, 0x9C, 0xA6, 0x1C, 0x3E, 0xA0, 0xE6, 0xA0, 0xFD, 0xEA, 0xAA, 0x17, 0x78, 0x5D, 0x03, 0x76, 
+    0xF4, 0x46, 0x38, 0xB8, 0xF7, 0xFC, 0x0A, 0x9C, 0x08, 0x04, 0x26, 0x3E, 0x9E, 0xE0, 0xB2, 0x1D, 0xDE, 0x26, 0xA2, 0x65, 
+    0x75, 0x78, 0x50, 0xA4, 0x9C, 0x44, 0x4B, 0xE2, 0xAF, 0x54, 0xA7, 0x10, 0x37, 0x20, 0x93, 0x9E, 0xD9, 0x30, 0xFB, 0x3D, 
+    0xF3, 0x46, 0x58, 0x62, 0x4E, 0x17, 0x18, 0x98, 0xC2, 0x73, 0xB6, 0xC0, 0xFD, 0xA4, 0x67, 0xC1, 0x3E, 0x60, 0x35, 0x43, 
+    0xC9, 0xE7, 0x98, 0x56, 0x79, 0xCF, 0x9F, 0x7B, 0x72, 0xCF, 0xD0, 0x29, 0xD3, 0x79, 0x2B, 0x18, 0x70, 0x19, 0x43, 0xC7, 
+    0xD3, 0x2D, 0x53, 0x83, 0x9F, 0xB3, 0x33, 0x82, 0x42, 0x81, 0x89, 0xD3, 0x53, 0xF3, 0x64, 0x85, 0x19, 0x70, 0xDE, 0x46, 
+    0xFD, 0x59, 0x96, 0x62, 0xC0, 0x39, 0x75, 0x2D, 0xD9, 0xE4, 0xC4, 0xFB, 0x20, 0xBB, 0x79, 0x36, 0x05, 0xD6, 0xCA, 0xE2, 
+    0x5C, 0xBD, 0xA5, 0x16, 0xAE, 0x3A, 0x04, 0xDC, 0x25, 0x94, 0x39, 0x8C, 0x08, 0x05, 0x0B, 0xA0, 0xD9, 0x16, 0x9C, 0xFE, 
+    0x2B, 0x9C, 0xDF, 0x37, 0x81, 0x59, 0x52, 0x29, 0x8E, 0x92, 0x5D, 0x00, 0x07, 0xC3, 0x2A, 0x00, 0xBA, 0x2E, 0xE6, 0xBE, 
+    0x61, 0x59, 0xA1, 0xD4, 0x68, 0x9A, 0x68, 0x08, 0x35, 0x3C, 0x01, 0x51, 0x8F, 0x83, 0x0A, 0x68, 0xDC, 0x5E, 0x75, 0xC5, 
+    0xD6, 0xD8, 0x08, 0x7A, 0x1B, 0x44, 0x43, 0x9A, 0xE4, 0x47, 0x40, 0xE3, 0xB5, 0x71, 0x6A, 0xA4, 0x7D, 0x5D, 0xC6, 0x12, 
+    0xAF, 0x37, 0x4C, 0xD5, 0xAD, 0xF3, 0xCD, 0xAE, 0x1C, 0x67, 0xB0, 0x6F, 0x0E, 0x00, 0x87, 0x12, 0xF3, 0x7D, 0x1A, 0xCD, 
+    0x23, 0x0E, 0x24, 0xFF, 0xA8, 0x3E, 0xAC, 0x44, 0x04, 0x3B, 0x3D, 0xFD, 0xAF, 0xDA, 0x7B, 0x47, 0x87, 0x28, 0x5B, 0x77, 
+    0x1B, 0xC7, 0x13, 0x06, 0xBF, 0x2E, 0xA5, 0xA7, 0x54, 0xFD, 0x25, 0x7C, 0x67, 0xFB, 0xB7, 0xD1, 0xDA, 0x69, 0x92, 0x7A, 
+    0x7F, 0x6B, 0x65, 0x5D, 0xB7, 0x7A, 0x07, 0x41, 0x62, 0xE6, 0x14, 0x0D, 0xBD, 0xE0, 0x93, 0x3E, 0x42, 0x98, 0x13, 0xFA, 
+    0x5A, 0xE3, 0x5E, 0xC2, 0x11, 0x8E, 0xC3, 0x1C, 0x85, 0x36, 0xC7, 0xA2, 0x27, 0xAB, 0xB9, 0x56, 0xCD, 0xEB, 0x27, 0xD8, 
+    0x89, 0x82, 0x76, 0xDE, 0xBE, 0x91, 0xAE, 0x45, 0x45, 0xFC, 0x22, 0xFC, 0x50, 0x39, 0x53, 0x10, 0xDD, 0x96, 0x18, 0xDC, 
+    0x4D, 0xA7, 0x95, 0x8A, 0x9C, 0xD7, 0xB8, 0x75, 0x1B, 0xDE, 0xBE, 0x77, 0x1B, 0x86, 0x12, 0xC8, 0x09, 0x12, 0x0E, 0x22, 
+    0xEE, 0x8D, 0xD6, 0x2F, 0xAD, 0x11, 0x3B, 0x12, 0x86, 0xEF, 0x19, 0xFD, 0x88, 0xEB, 0x28, 0xA3, 0xC8, 0x91, 0xF1, 0xBD, 
+    0x4B, 0x45, 0x84, 0xA9, 0x70, 0xE1, 0xA8, 0x6E, 0x1A, 0xA8, 0x65, 0x2D, 0xA8, 0x05, 0x16, 0x7C, 0x37, 0x66, 0xFE, 0xA1, 
+    0x52, 0xAC, 0x1F, 0x6D, 0x3C, 0xF4, 0x4C, 0x76, 0x80, 0xF8, 0x1C, 0xC1, 0xE6, 0xEF, 0x80, 0x20, 0x17, 0xBA, 0x93, 0x25, 
+    0xE6, 0xB3, 0xAD, 0x58, 0x56, 0xE0, 0x82, 0xE6, 0x49, 0x74, 0xD9, 0x6E, 0x2A, 0xA8, 0x6A, 0xBF, 0x5F, 0x2B, 0xBD, 0xE2, 
+    0xB3, 0xEE, 0x1A, 0xBB, 0x1A, 0xDE, 0x15, 0x1D, 0xFB, 0xB3, 0x01, 0xF1, 0xD8, 0xD5, 0x94, 0x95, 0xF1, 0x20, 0x47, 0x07, 
+    0xF5, 0x74, 0x00, 0x17, 0xEB, 0x44, 0x04, 0xD7, 0xCC, 0x64, 0x1F, 0xE1, 0x9B, 0x44, 0x9F, 0x16, 0x6E, 0x60, 0xE3, 0xFD, 
+    0x7E, 0xAE, 0xAB, 0x92, 0x7E, 0xC1, 0xC5, 0xCD, 0x61, 0x69, 0x3D, 0x16, 0x51, 0xE3, 0xAB, 0xE1, 0x12, 0x2E, 0x8B, 0xA8, 
+    0xF7, 0x58, 0x60, 0xF8, 0x38, 0x4F, 0x26, 0xEC, 0x75, 0xF9, 0xF5, 0x6E, 0x45, 0xCC, 0x53, 0x4E, 0xB0, 0xA4, 0x63, 0x57, 
+    0x2F, 0x2F, 0x2F, 0xE2, 0x59, 0x78, 0x63, 0x51, 0x2D, 0x86, 0x32, 0x8E, 0x7C, 0x73, 0x6C, 0x4C, 0xCB, 0x8D, 0xC8, 0x66, 
+    0x2F, 0x43, 0x29, 0x36, 0x2A, 0x0F, 0x16, 0xCA, 0x21, 0x5B, 0x98, 0x60, 0x44, 0x6E, 0x2A, 0x78, 0x5A, 0xA7, 0x50, 0x9E, 
+    0x1B, 0x43, 0x29, 0x76, 0x0A, 0x59, 0x53, 0xF9, 0x05, 0x25, 0x9D, 0x2B, 0x40, 0x0E, 0x36, 0x62, 0x61, 0xA0, 0x52, 0xDA, 
+    0xA6, 0x8A, 0x71, 0x42, 0xCA, 0xF6, 0x5F, 0xB0, 0x7C, 0x91, 0x99, 0xF0, 0x03, 0xCD, 0xEC, 0xF3, 0x38, 0xD6, 0x8C, 0xB6, 
+    0x79, 0xB8, 0xFA, 0xFB, 0xF7, 0x92, 0x1B, 0x83, 0x85, 0x4C, 0xFC, 0x86, 0xFA, 0x2B, 0x1F, 0x00, 0x03, 0xE6, 0x59, 0xB7, 
+    0xA7, 0x9D, 0xE8, 0x53, 0xAB, 0xC2, 0x4D, 0xD4, 0x3A, 0x89, 0x4D, 0x4B, 0x23, 0xC9, 0x09, 0xA4, 0x9A, 0x00, 0x41, 0x48, 
+    0x01, 0x23, 0x9C, 0x03, 0xA9, 0xD1, 0x83, 0x88, 0x63, 0x54, 0x93, 0x2C, 0x5D, 0x0B, 0x43, 0x46, 0x75, 0xF8, 0x46, 0x41, 
+    0x68, 0xC3, 0x77, 0xF2, 0xF5, 0x8C, 0x7A, 0x23, 0xD8, 0x0A, 0xE7, 0xF6, 0x56, 0xC4, 0xCC, 0xC8, 0x81, 0x55, 0xEB, 0x99, 
+    0x98, 0xAD, 0xAA, 0x08, 0xDA, 0x3D, 0x30, 0x9E, 0x3D, 0xF8, 0x8E, 0x75, 0x49, 0xC5, 0xB6, 0xA4, 0xA9, 0x83, 0x7A, 0x5D, 
+    0x2E, 0xB8, 0x18, 0xD8, 0x57, 0xD7, 0x5C, 0xC8, 0x69, 0x39, 0x7A, 0x9B, 0xDB, 0xCC, 0x7E, 0x7D, 0x3A, 0x88, 0x8F, 0x49, 
+    0xB6, 0x58, 0x4E, 0xCA, 0x0D, 0x22, 0x7B, 0x98, 0x2B, 0xA6, 0x55, 0xA0, 0x45, 0x7C, 0xA5, 0xFB, 0x8E, 0x85, 0x70, 0x5E, 
+    0xA5, 0x5B, 0x5A, 0x10, 0x2B, 0x5B, 0xF2, 0x69, 0x6A, 0x9B, 0xD3, 0xE4, 0xD6, 0xD6, 0xCD, 0xA5, 0xAE, 0x41, 0xA9, 0x5B, 
+    0xB8, 0x1F, 0x13, 0x59, 0x90, 0x6A, 0xB8, 0x4F, 0x8E, 0xC1, 0xFD, 0x53, 0xD2, 0xCB, 0xEE, 0x36, 0xD8, 0x3C, 0xBA, 0x63, 
+    0x63, 0xE1, 0x03, 0x26, 0x65, 0x3D, 0xC4, 0x78, 0xD8, 0xE6, 0x86, 0x13, 0xA7, 0xC2, 0xAF, 0x16, 0x8B, 0x22, 0x9F, 0x21, 
+    0xAC, 0x53, 0x5B, 0xCD, 0x3E, 0xE5, 0x71, 0x71, 0x24, 0x2C, 0xB3, 0xDC, 0x77, 0x13, 0x85, 0xB6, 0x24, 0x15, 0xD8, 0xA3, 
+    0xBE, 0x6E, 0x8A, 0x0E, 0xC7, 0xA8, 0xC0, 0xB4, 0xE1, 0xB2, 0xBE, 0x90, 0x0B, 0xDF, 0x2C, 0xF2, 0xFD, 0xFA, 0x74, 0x17, 
+    0x96, 0x2A, 0x19, 0x89, 0x21, 0x9A, 0x14, 0x87, 0xA8, 0x58, 0xF7, 0x39, 0xD0, 0x40, 0xAD, 0x07, 0x36, 0x73, 0x6E, 0xFB, 
+    0xD9, 0x25, 0x87, 0xD9, 0x56, 0x99, 0x31, 0xFB, 0x61, 0xFD, 0xE2, 0xEA, 0xD6, 0x52, 0x62, 0x0A, 0xE4, 0x8C, 0x13, 0xE6, 
+    0x56, 0xD6, 0xFB, 0x18, 0x6D, 0x97, 0xED, 0xCE, 0xAC, 0x1B, 0x0C, 0x6E, 0xDC, 0xF7, 0xCA, 0x3A, 0xAA, 0xA4, 0x84, 0x59, 
+    0x33, 0xA7, 0xC7, 0x6F, 0x3D, 0x8D, 0x9B, 0xCE, 0xB4, 0x4A, 0xFA, 0xB0, 0x0C, 0x56, 0xCE, 0x02, 0x3E, 0x88, 0x4F, 0x4F, 
+    0x67, 0xAE, 0xF1, 0x36, 0xCD, 0xBB, 0x78, 0xD1, 0x86, 0xDA, 0x24, 0x4B, 0x57, 0x3A, 0x86, 0x07, 0x34, 0x42, 0xCE, 0x4E, 
+    0x24, 0x3E, 0x19, 0x88, 0x61, 0x75, 0x0D, 0xF9, 0xD8, 0x4A, 0x56, 0x7B, 0x5C, 0xAD, 0x54, 0x39, 0xB3, 0x7E, 0xDA, 0x59, 
+    0xF9, 0xA8, 0xAD, 0x62, 0xED, 0x5F, 0x90, 0x3D, 0xA7, 0xF5, 0x07, 0x53, 0x6D, 0x61, 0x05, 0x17, 0x28, 0xE3, 0x11, 0x6B, 
+    0x7A, 0xBB, 0xDE, 0x34, 0x94, 0xBD, 0x20, 0x29, 0xE4, 0x42, 0x15, 0x3F, 0x20, 0x19, 0x1C, 0x16, 0x2A, 0x5E, 0xD0, 0x59, 
+    0xC6, 0x3D, 0xD2, 0x86, 0xC9, 0x33, 0x90, 0x06, 0xDA, 0xE3, 0x89, 0xFE, 0xA4, 0x63, 0xFD, 0xCD, 0x6C, 0xAC, 0x3F, 0xA8, 
+    0xBC, 0xA3, 0xC2, 0xC2, 0x3A, 0x91, 0x2E, 0x2C, 0x09, 0xA8, 0x5D, 0x96, 0x3E, 0x01, 0x0C, 0xC2, 0x59, 0x39, 0xFD, 0xC5, 
+    0xC1, 0xAE, 0xE4, 0xF4, 0x93, 0xB4, 0x3D, 0x3B, 0x37, 0x66, 0x4B, 0xA4, 0xFA, 0x2E, 0x77, 0x0A, 0x8D, 0xB4, 0x09, 0xCC, 
+    0x59, 0x1E, 0x1A, 0xCA, 0xC6, 0x0E, 0xF5, 0x61, 0x9D, 0xE8, 0xBA, 0xE6, 0x6D, 0x7A, 0xE2, 0xA0, 0xE8, 0x61, 0xAE, 0x3D, 
+    0xA8, 0x1A, 0xBE, 0x7C, 0x18, 0x16, 0xA3, 0xC1, 0x84, 0x4E, 0xCD, 0x7A, 0x62, 0x34, 0x89, 0xFE, 0x69, 0x18, 0x4B, 0xB9, 
+    0xBE, 0x65, 0x31, 0x8D, 0x5C, 0xCB, 0xFD, 0x5C, 0xFD, 0x72, 0x53, 0x3C, 0x4A, 0x3A, 0x44, 0x0A, 0x79, 0xC4, 0x7A, 0xDB, 
+    0xEB, 0xAD, 0x31, 0x24, 0xA6, 0x47, 0xA3, 0xF5, 0xA1, 0xBF, 0x04, 0x61, 0xF9, 0x09, 0x96, 0x10, 0x0E, 0xB5, 0x34, 0x06, 
+    0x56, 0xC9, 0xAB, 0xFC, 0x41, 0xCA, 0xF7, 0x27, 0xEC, 0x71, 0x25, 0xC1, 0xD2, 0x8D, 0xE9, 0xCF, 0xA0, 0x0C, 0x49, 0x67, 
+    0x48, 0x16, 0xF3, 0x48, 0x18, 0x64, 0xBB, 0xC9, 0xB4, 0x98, 0x06, 0x27, 0xB9, 0xFA, 0x50, 0xE4, 0x12, 0xFC, 0xD5, 0x85, 
+    0x34, 0x5B, 0xC2, 0x7E, 0xAC, 0x78, 0x76, 0xEB, 0x2D, 0x8A, 0x5D, 0xF2, 0xD7, 0xE2, 0x31, 0x82, 0x1F, 0x7F, 0xFD, 0xAC, 
+    0x26, 0xDA, 0x8C, 0x32, 0x9E, 0x58, 0x43, 0x68, 0x35, 0x26, 0x2E, 0x97, 0x6F, 0xA1, 0xD6, 0xDB, 0xD0, 0x4B, 0xE6, 0x3B, 
+    0xCA, 0x77, 0x92, 0x8A, 0xEC, 0xEC, 0x24, 0x83, 0xF7, 0x8E, 0x39, 0xC0, 0xF9, 0x24, 0xDB, 0x6D, 0xE6, 0xF8, 0x54, 0xC1, 
+    0x81, 0x27, 0xBC, 0xF9, 0xBF, 0x27, 0xBE, 0x11, 0x17, 0x92, 0xDC, 0xC6, 0x09, 0xBB, 0x7D, 0x2B, 0x72, 0x9D, 0x81, 0x49, 
+    0x51, 0x24, 0x4B, 0x1F, 0x4F, 0x76, 0xB3, 0x45, 0xF1, 0x7A, 0x97, 0x2C, 0xD6, 0x27, 0x6F, 0x89, 0x20, 0x81, 0x07, 0xE3, 
+    0x6C, 0xEA, 0x39, 0xCA, 0x30, 0xCA, 0xAC, 0x22, 0xE4, 0x50, 0xE5, 0xD2, 0xE8, 0xEE, 0xC1, 0xC7, 0xC9, 0x09, 0xFE, 0xBC, 
+    0xA4, 0x41, 0x9E, 0xD0, 0x67, 0xFC, 0xC3, 0x73, 0xAD, 0x8A, 0x9A, 0xE7, 0x19, 0xE7, 0x0E, 0xC8, 0x68, 0xF5, 0x72, 0xC3, 
+    0x3C, 0x8B, 0xFC, 0x64, 0x1C, 0xFA, 0xF6, 0x4C, 0xE5, 0x71, 0xF9, 0x48, 0x40, 0xAC, 0x5B, 0x41, 0x10, 0xB6, 0x83, 0x72, 
+    0x40, 0xC9, 0xF4, 0x4B, 0xB0, 0xC8, 0x89, 0xFC, 0xD0, 0xB4, 0xCD, 0x67, 0x34, 0x2D, 0x3F, 0xE9, 0xDF, 0x9F, 0x4F, 0xC6, 
+    0x9B, 0xD5, 0x42, 0x2F, 0xE9, 0x89, 0xE8, 0x72, 0xFE, 0xA4, 0x7F, 0x7F, 0x3E, 0x21, 0x34, 0x59, 0xFC, 0xC4, 0x7F, 0x7F, 
+    0x3E, 0xD9, 0x66, 0x9B, 0xA2, 0x58, 0xFE, 0xA4, 0x7F, 0x7F, 0x3E, 0xD9, 0xAD, 0x74, 0xA9, 0xF7, 0x0F, 0xCF, 0xD5, 0x00, 
+    0x49, 0x35, 0x56, 0xE3, 0x68, 0xB1, 0x4E, 0xDB, 0x83, 0xDA, 0x1C, 0x70, 0xD3, 0xC6, 0x77, 0x26, 0xE4, 0xC6, 0xDC, 0x6B, 
+    0xD6, 0xC7, 0xB0, 0x30, 0x55, 0xA7, 0x2C, 0xD9, 0xAF, 0x51, 0x4D, 0x05, 0x9A, 0x91, 0x16, 0xAE, 0x26, 0x94, 0xAE, 0xB3, 
+    0xAC, 0xAC, 0x0B, 0xA7, 0x19, 0xC4, 0x12, 0xB1, 0x96, 0x33, 0x6E, 0xE7, 0x34, 0x47, 0xEC, 0x26, 0xF4, 0x83, 0x33, 0xC9, 
+    0x25, 0x65, 0x9C, 0x5C, 0x6E, 0x02, 0x87, 0xA7, 0xE4, 0x69, 0xB2, 0xB5, 0xFF, 0x5C, 0xA9, 0xFD, 0xCD, 0x6A, 0x5D, 0xA9, 
+    0x9C, 0xDF, 0x6B, 0x75, 0x97, 0x79, 0x9C, 0x77, 0xF8, 0x93, 0xE9, 0x24, 0xBD, 0x0A, 0xDC, 0x32, 0xD9, 0xE6, 0xD7, 0x12, 
+    0x09, 0xAB, 0x94, 0x5B, 0x91, 0x1D, 0xA3, 0x99, 0x80, 0xD0, 0x13, 0x74, 0x8E, 0x01, 0xC9, 0xA8, 0x06, 0x4A, 0xA4, 0x48, 
+    0x0B, 0x5E, 0x17, 0xA7, 0x63, 0xF8, 0xAA, 0xA3, 0xBF, 0x1F, 0x86, 0x1F, 0xD1, 0xDF, 0x17, 0x61, 0x5F, 0x80, 0x49, 0x9F, 
+    0xCE, 0xE1, 0x13, 0xD4, 0xD0, 0x11, 0xB6, 0x47, 0xD8, 0x07, 0x8E, 0xBA, 0x28, 0x71, 0x4A, 0x9E, 0x1A, 0x4C, 0xAC, 0x55, 
+    0xDD, 0xC1, 0xC1, 0x9C, 0x82, 0x4A, 0x15, 0xFC, 0x87, 0xEC, 0x81, 0x23, 0xF4, 0x2D, 0x53, 0xE9, 0x5C, 0xEE, 0x5C, 0xB8, 
+    0x42, 0x5F, 0x55, 0x11, 0x98, 0x78, 0x5A, 0x36, 0xED, 0x1D, 0x14, 0x04, 0xD2, 0xAD, 0x4D, 0x3A, 0x75, 0x46, 0x95, 0x66, 
+    0x51, 0x42, 0xFB, 0x9F, 0xC1, 0x23, 0x37, 0xE5, 0x6A, 0x82, 0x34, 0xDA, 0x59, 0xDD, 0xED, 0x3C, 0x5C, 0x96, 0xD3, 0xB1, 
+    0xF8, 0xAE, 0x96, 0x1C, 0x3B, 0x76, 0xA1, 0x2D, 0xF5, 0xF5, 0x1E, 0x31, 0xAE, 0xF6, 0xAA, 0x89, 0x7A, 0xC2, 0x0D, 0x8B, 
+    0x67, 0x4D, 0x71, 0xF5, 0x81, 0x7A, 0x8D, 0x3F, 0x1C, 0xB9, 0xFB, 0xA8, 0x74, 0xC8, 0x10, 0xF0, 0xEF, 0x33, 0x9D, 0xD7, 
+    0xCB, 0xAC, 0xBC, 0xC4, 0x83, 0x24, 0x21, 0x2D, 0xE8, 0xD4, 0x2E, 0xEE, 0x96, 0xB2, 0x4C, 0x2E, 0xD5, 0x52, 0x35, 0xD8, 
+    0x2A, 0xDD, 0xE3, 0x08, 0xF5, 0x02, 0x99, 0x21, 0xE8, 0xAE, 0xD9, 0x32, 0x99, 0x9B, 0x9B, 0x9D, 0x5A, 0x4A, 0x4F, 0x5A, 
+    0xE7, 0x4B, 0x2A, 0x5B, 0x0E, 0xEA, 0x75, 0x6A, 0x3B, 0x5B, 0xDC, 0xCD, 0x2B, 0x56, 0x90, 0x5A, 0x94, 0x57, 0xDA, 0xD8, 
+    0x6B, 0x49, 0xAD, 0x73, 0x0A, 0x41, 0x69, 0x84, 0xA5, 0x15, 0x89, 0x9A, 0x6D, 0x5F, 0xEB, 0x1A, 0x38, 0x96, 0x43, 0xA5, 
+    0x55, 0xC2, 0xAF, 0x87, 0x60, 0x90, 0xC7, 0x35, 0x36, 0xC2, 0x2F, 0x4C, 0x98, 0xE4, 0xA6, 0xF8, 0x5B, 0x0B, 0x3E, 0x60, 
+    0xAB, 0x76, 0x84, 0x5B, 0xCA, 0x1A, 0xF4, 0x20, 0xF0, 0xA5, 0x2B, 0x1F, 0x8A, 0x5A, 0x6D, 0x6D, 0xE2, 0xFA, 0xED, 0x73, 
+    0xAB, 0x89, 0x0D, 0xE6, 0xB2, 0xCD, 0xF2, 0x86, 0x95, 0xEA, 0xEA, 0xB1, 0xB5, 0x4B, 0xC3, 0x6F, 0xB9, 0x44, 0x1A, 0x54, 
+    0x4C, 0x6D, 0xE0, 0xB3, 0x48, 0x6B, 0x40, 0x48, 0x48, 0xE9, 0xBF, 0x72, 0x8C, 0xAA, 0xDC, 0x70, 0x61, 0x55, 0xBB, 0x1C, 
+    0xB0, 0xFA, 0xEC, 0x02, 0x4E, 0x86, 0x70, 0xD4, 0xB5, 0x49, 0xC5, 0xE1, 0x95, 0x64, 0x8E, 0x7D, 0x36, 0xF3, 0xDB, 0x95, 
+    0x4E, 0x9A, 0x2A, 0xAB, 0x60, 0x5C, 0x34, 0x31, 0x2B, 0xAA, 0xE9, 0x1C, 0x4E, 0x68, 0xCE, 0x6F, 0x64, 0x3D, 0x41, 0xDA, 
+    0x24, 0x07, 0xD9, 0x34, 0x3F, 0xCA, 0x6C, 0x95, 0x90, 0x05, 0x92, 0x3D, 0x4E, 0xD2, 0x30, 0x4D, 0x35, 0x05, 0x23, 0x6D, 
+    0xC2, 0x3A, 0xDC, 0x82, 0x91, 0x78, 0x6B, 0xD0, 0xDE, 0x11, 0xEC, 0x51, 0x1D, 0xC9, 0x10, 0xCC, 0x2B, 0x24, 0x7E, 0x4B, 
+    0xE2, 0x61, 0x85, 0x3D, 0x10, 0x65, 0x9E, 0x92, 0x84, 0x83, 0x28, 0x3A, 0xA8, 0xC8, 0x90, 0x44, 0x35, 0x52, 0xBF, 0x39, 
+    0x1E, 0x9E, 0x9E, 0x9A, 0x63, 0xA4, 0xCE, 0xA9, 0x36, 0xF6, 0x4B, 0xD2, 0xDF, 0xC1, 0x45, 0x21, 0x43, 0x15, 0xF4, 0x9A, 
+    0xE6, 0xBD, 0xCD, 0xD9, 0x1F, 0x1C, 0x9D, 0xEA, 0x94, 0xED, 0x2C, 0xEA, 0xEC, 0x4D, 0xDC, 0xE4, 0x77, 0xC2, 0xEA, 0x24, 
+    0x03, 0x0C, 0x55, 0x8D, 0x01, 0xFA, 0x77, 0x7A, 0xD2, 0x1C, 0x59, 0xD9, 0x97, 0x5A, 0xB5, 0xC6, 0xEB, 0x42, 0x85, 0xD5, 
+    0xC2, 0xDD, 0x3B, 0xD3, 0x6C, 0x72, 0x8C, 0x44, 0xAC, 0x6B, 0x8A, 0x5C, 0x6D, 0x73, 0xF7, 0xEF, 0x74, 0xEC, 0x1D, 0x73, 
+    0xAF, 0x7B, 0x28, 0xBD, 0x69, 0xCB, 0xF7, 0xAE, 0x6F, 0xDA, 0x3E, 0xBF, 0x39, 0x12, 0x46, 0x1C, 0xE2, 0x61, 0x87, 0x09, 
+    0x2E, 0x2C, 0xCC, 0x26, 0xF4, 0xF8, 0x99, 0x30, 0xC0, 0xC6, 0x13, 0x3A, 0x6C, 0x5E, 0x24, 0x6F, 0x0B, 0x93, 0x4C, 0xC7, 
+    0x83, 0xD2, 0x37, 0xB1, 0x3A, 0xBB, 0x7E, 0x93, 0x02, 0xFA, 0x45, 0x17, 0x31, 0x9F, 0xF8, 0x34, 0xAA, 0xBB, 0x35, 0xA9, 
+    0x49, 0x2A, 0x46, 0xD1, 0x53, 0xE5, 0x20, 0x4B, 0x95, 0x11, 0x7B, 0xD1, 0xA3, 0x30, 0x3B, 0x0D, 0xBB, 0xDD, 0xAC, 0xF4, 
+    0x04, 0x59, 0xA3, 0x23, 0x58, 0x65, 0xDD, 0x32, 0xEF, 0x9A, 0x2A, 0xF3, 0x3B, 0x60, 0xC5, 0x45, 0x97, 0xC7, 0x55, 0x42, 
+    0x32, 0x61, 0x24, 0xB4, 0x9A, 0xC5, 0xD8, 0x72, 0xF1, 0x44, 0x75, 0x59, 0x69, 0x43, 0xBB, 0xF9, 0xB8, 0x51, 0xCD, 0x80, 
+    0x76, 0x27, 0x0C, 0x21, 0xD5, 0x4D, 0x4F, 0xAE, 0xDC, 0xF5, 0xD5, 0x38, 0x82, 0x41, 0x56, 0x47, 0xAA, 0xBF, 0x47, 0x4F, 
+    0x7C, 0x81, 0xF6, 0x7B, 0x0E, 0x65, 0x3A, 0x15, 0x17, 0x5E, 0x00, 0x2B, 0x13, 0x46, 0x45, 0xA6, 0x3E, 0x68, 0x7E, 0x49, 
+    0x06, 0x3E, 0x83, 0x7B, 0xBF, 0x4A, 0xC5, 0x20, 0xD7, 0x39, 0xAC, 0xB9, 0x49, 0xF0, 0x54, 0x9B, 0xDF, 0x24, 0x7D, 0xF4, 
+    0x66, 0x91, 0xD3, 0x5C, 0x6A, 0x09, 0x00, 0xC1, 0x3F, 0x65, 0xB2, 0x0E, 0x84, 0x05, 0x21, 0x3C, 0x7A, 0x63, 0xA2, 0xBD, 
+    0x67, 0x8E, 0xD2, 0x72, 0xA6, 0xBC, 0xCA, 0xC8, 0x59, 0xEB, 0xD8, 0xED, 0xAB, 0xCD, 0xD0, 0xDE, 0xB1, 0xC4, 0x24, 0xFF, 
+    0x9A, 0x9A, 0x7D, 0xC5, 0x5A, 0x93, 0x47, 0x6A, 0x17, 0x67, 0x94, 0xD0, 0xED, 0x3B, 0x46, 0x27, 0xD4, 0x2B, 0x2C, 0x2F, 
+    0x36, 0xEA, 0x5F, 0xB4, 0xA7, 0x1A, 0x27, 0xC0, 0x1A, 0x4B, 0x94, 0xB4, 0xEC, 0xBD, 0xBC, 0xC6, 0x36, 0xB4, 0x82, 0xEF, 
+    0x99, 0x01, 0xD4, 0x0A, 0xAA, 0x44, 0xFB, 0xC8, 0x34, 0x37, 0x3A, 0xFF, 0x83, 0xE5, 0xD5, 0x37, 0x36, 0x92, 0xC7, 0x4E, 
+    0x59, 0x20, 0x30, 0x26, 0xCA, 0x1C, 0xC7, 0x61, 0x4C, 0xBE, 0x1F, 0x87, 0xB1, 0x9F, 0x84, 0x3F, 0xE7, 0xEE, 0xDB, 0x40, 
+    0x6A, 0xB1, 0xEF, 0xB7, 0x93, 0x7D, 0xFB, 0xBD, 0xC7, 0xDA, 0x3A, 0x95, 0xC4, 0xFA, 0xF2, 0x4A, 0x47, 0xD7, 0x3A, 0x64, 
+    0xA7, 0x74, 0xA0, 0xF7, 0xAB, 0xB1, 0x0A, 0x75, 0x17, 0xC6, 0xD3, 0x0A, 0x3A, 0xE2, 0x53, 0xB3, 0x4A, 0xA7, 0x99, 0xF2, 
+    0x12, 0x80, 0x59, 0x3A, 0xF8, 0xEB, 0xF5, 0xDD, 0x76, 0xA7, 0x6B, 0xCA, 0x19, 0xDD, 0x96, 0x22, 0xDC, 0xC6, 0x26, 0x68, 
+    0x6B, 0xB0, 0x59, 0x4B, 0x7D, 0x85, 0x5B, 0x1B, 0xBA, 0x28, 0x9B, 0x29, 0x57, 0xDE, 0xD4, 0xAF, 0x85, 0x9C, 0xDC, 0x1B, 
+    0x87, 0xFA, 0x6D, 0xF6, 0x4B, 0xA8, 0x5A, 0x56, 0x0D, 0xA1, 0x0A, 0xDA, 0x3B, 0x58, 0xDD, 0x94, 0x03, 0xBD, 0x3A, 0x65, 
+    0x64, 0xE0, 0xC0, 0xD9, 0x67, 0xB4, 0x1B, 0x2B, 0xAB, 0xDF, 0xD8, 0x67, 0x36, 0x43, 0x7B, 0x5B, 0x9D, 0x1A, 0xCC, 0x42, 
+    0x12, 0xEA, 0x10, 0xB1, 0xF2, 0xFA, 0xC6, 0xDC, 0xC8, 0xBC, 0x7B, 0x02, 0x1A, 0xA0, 0xEF, 0xEC, 0xD8, 0x46, 0x3F, 0xED, 
+    0x8E, 0x3D, 0x82, 0xCC, 0x9D, 0x09, 0x70, 0xE8, 0x3D, 0x31, 0x64, 0x7B, 0x57, 0x17, 0x35, 0x6C, 0xB2, 0xC7, 0x37, 0x61, 
+    0x52, 0x4A, 0x28, 0xB6, 0x89, 0xB1, 0x73, 0x1A, 0xBC, 0x1B, 0xA3, 0x5B, 0x2E, 0xE6, 0x9D, 0x7B, 0xB8, 0x75, 0x8F, 0xEA, 
+    0xA9, 0x21, 0x70, 0x68, 0xDD, 0x5F, 0xB2, 0x75, 0x35, 0x1F, 0x68, 0xF7, 0xAE, 0x39, 0x81, 0x85, 0x13, 0xB5, 0x6C, 0xA2, 
+    0x70, 0x89, 0x2E, 0x37, 0xD7, 0xA6, 0x2D, 0xEE, 0xCE, 0x61, 0x63, 0xA9, 0x52, 0x65, 0xD1, 0x7C, 0xF5, 0xEA, 0x81, 0x57, 
+    0x6A, 0x50, 0x3F, 0x81, 0xD3, 0x51, 0x0B, 0xBE, 0x10, 0xF2, 0x5E, 0x68, 0x96, 0xAA, 0x98, 0x42, 0x9F, 0xBB, 0x66, 0xB9, 
+    0x73, 0x28, 0x8B, 0x17, 0x88, 0x80, 0xD3, 0x50, 0xF4, 0x48, 0xC4, 0x20, 0x47, 0x39, 0x59, 0x15, 0x8C, 0xFD, 0xFA, 0x41, 
+    0xF7, 0xE2, 0x08, 0xAE, 0xFC, 0xB7, 0x9A, 0x3D, 0xBB, 0x18, 0xC0, 0x26, 0xA9, 0xAC, 0xBC, 0x80, 0x0B, 0xF5, 0x56, 0x36, 
+    0xC6, 0xE9, 0x8A, 0x73, 0xA3, 0x8D, 0x4A, 0xD8, 0x8D, 0x41, 0x55, 0x49, 0xBF, 0x12, 0x52, 0xB2, 0xA1, 0xDF, 0x51, 0x55, 
+    0x33, 0x2E, 0x7D, 0x08, 0x37, 0x4D, 0x15, 0x39, 0x0A, 0x5D, 0xB6, 0xDF, 0x43, 0x05, 0x58, 0xAB, 0x80, 0xB3, 0x82, 0xDE, 
+    0x58, 0x54, 0xEC, 0x64, 0x94, 0x4B, 0x0E, 0x7F, 0x90, 0xA9, 0x04, 0x12, 0xEA, 0xA2, 0xE1, 0x1B, 0x57, 0x5F, 0xB0, 0x8A, 
+    0x24, 0x09, 0x5E, 0x64, 0xFC, 0x3C, 0x82, 0x03, 0x51, 0x5B, 0x63, 0xA8, 0x3F, 0x40, 0x9D, 0xA1, 0xC5, 0x3A, 0x30, 0x67, 
+    0xED, 0x30, 0x93, 0x57, 0xBF, 0x3A, 0x1D, 0x82, 0x58, 0x96, 0x6F, 0x75, 0xA8, 0xDA, 0xD4, 0xBA, 0x14, 0xE8, 0xE4, 0x15, 
+    0xAF, 0xC9, 0x8E, 0xE7, 0xEE, 0x42, 0xFB, 0xDD, 0xCA, 0x5B, 0x9D, 0x6C, 0xF8, 0xE2, 0x23, 0x22, 0x81, 0xCE, 0x44, 0xEB, 
+    0x26, 0x43, 0x04, 0x45, 0xD6, 0xCD, 0x31, 0xFA, 0x1A, 0xFE, 0xA4, 0xA6, 0x97, 0xA6, 0x69, 0xD6, 0xA6, 0x51, 0x40, 0x0D, 
+    0xBF, 0x42, 0xF7, 0x28, 0x63, 0xDB, 0xA0, 0x83, 0x5A, 0x2D, 0xDB, 0xD8, 0x78, 0x57, 0x52, 0xE3, 0xAC, 0x24, 0x40, 0x8F, 
+    0x3A, 0xD9, 0xCE, 0xD0, 0xAA, 0x02, 0xCB, 0xCB, 0x14, 0x77, 0x95, 0x1B, 0x41, 0x8A, 0x45, 0x24, 0x66, 0x72, 0x72, 0x97, 
+    0xD6, 0x84, 0x57, 0xCD, 0xDA, 0xFD, 0x9A, 0xCC, 0x46, 0xEE, 0xDC, 0xCA, 0xE7, 0x96, 0xC4, 0xEC, 0x7A, 0x3D, 0xAF, 0xEB, 
+    0x7C, 0x0A, 0xCB, 0x4F, 0xAA, 0xBC, 0xA6, 0xA0, 0x47, 0x73, 0x81, 0xA4, 0xAC, 0x03, 0xEB, 0x16, 0xE0, 0xE3, 0x6B, 0x0F, 
+    0x17, 0xAC, 0xA8, 0xDD, 0x82, 0xC6, 0x85, 0x70, 0x4A, 0x55, 0x98, 0x32, 0x61, 0x97, 0x23, 0x51, 0x30, 0x39, 0x66, 0xED, 
+    0x5A, 0x01, 0x12, 0x76, 0x35, 0xC3, 0x97, 0x52, 0x94, 0x9C, 0xBE, 0x67, 0x85, 0x5C, 0xDC, 0x98, 0xD8, 0x25, 0x6A, 0xC8, 
+    0xA2, 0x1A, 0xAE, 0x4B, 0x8F, 0xD5, 0x67, 0x84, 0x27, 0x58, 0x26, 0xBE, 0x88, 0x71, 0xAA, 0xD3, 0x6E, 0x4A, 0x5A, 0x0D, 
+    0x6A, 0xB4, 0x21, 0x4C, 0x19, 0x7E, 0xA1, 0xAD, 0x42, 0xC6, 0x0A, 0x06, 0xF3, 0xBB, 0xEE, 0x4C, 0xF2, 0xB4, 0x3C, 0x9E, 
+    0x0A, 0x6B, 0x51, 0xBA, 0x67, 0x45, 0xF7, 0xE4, 0x9D, 0x8A, 0xEE, 0x59, 0x55, 0x33, 0x57, 0x87, 0x22, 0x32, 0x37, 0x3A, 
+    0x41, 0xED, 0x33, 0x82, 0x9C, 0x70, 0xA8, 0xF8, 0xD2, 0x87, 0x30, 0x8B, 0x9F, 0xD2, 0xC8, 0x4B, 0xD2, 0x74, 0xB3, 0x4F, 
+    0x36, 0xBB, 0x59, 0x36, 0x2F, 0xF6, 0xC9, 0x76, 0x46, 0x47, 0x76, 0x72, 0x47, 0x27, 0xDE, 0x3E, 0xCD, 0x67, 0x7B, 0xE2, 
+    0x44, 0xDF, 0x26, 0xDB, 0x3D, 0x9B, 0x13, 0xE3, 0xCF, 0x9C, 0x30, 0xDD, 0x1E, 0x72, 0x95, 0xD9, 0x7C, 0xBB, 0x1F, 0xCF, 
+    0x26, 0x59, 0xC2, 0xF1, 0x86, 0xF1, 0x78, 0xB7, 0x29, 0xF6, 0xE3, 0xD5, 0x0A, 0x2A, 0xB4, 0x12, 0x8B, 0x77, 0x3F, 0x9D, 
+    0x10, 0x6B, 0xB6, 0xDE, 0x2F, 0x92, 0xCD, 0xCD, 0x7E, 0x51, 0xE0, 0xC3, 0x32, 0x79, 0xBB, 0xA7, 0xD3, 0x06, 0x8A, 0xB9, 
+    0xC6, 0xAA, 0x67, 0xBF, 0x2D, 0x78, 0x2A, 0xF6, 0xDB, 0xBB, 0x05, 0xE5, 0x7C, 0xDC, 0x43, 0x48, 0xB1, 0x7F, 0x4B, 0xDD, 
+    0x58, 0x11, 0x61, 0x91, 0x46, 0xE7, 0x27, 0xD7, 0x7F, 0x83, 0x73, 0xDB, 0xAB, 0xBC, 0x1B, 0x79, 0x7E, 0xCC, 0x78, 0x68, 
+    0x4F, 0x2F, 0x81, 0x77, 0x3E, 0x51, 0x93, 0x34, 0x72, 0x15, 0x50, 0x3E, 0xA1, 0xEF, 0x5E, 0xB7, 0x48, 0xBB, 0x5E, 0x30, 
+    0xBC, 0xBA, 0xDA, 0x9E, 0x5F, 0x8E, 0x3C, 0x62, 0x39, 0x3C, 0x44, 0xD5, 0x8B, 0xCE, 0x7F, 0xB9, 0xDA, 0x76, 0xCF, 0xD5, 
+    0x8C, 0x9E, 0x28, 0x5B, 0x07, 0xCA, 0xC0, 0xFB, 0x14, 0xDA, 0xBE, 0xF3, 0x3D, 0x9B, 0xB6, 0xEE, 0xA7, 0x9B, 0xFD, 0x6C, 
+    0x31, 0xD9, 0x8B, 0xDA, 0x30, 0xB4, 0xED, 0xD1, 0xE7, 0x64, 0x4F, 0x24, 0x48, 0xB2, 0x08, 0x7C, 0x78, 0x84, 0x0F, 0x47, 
+    0x5D, 0x71, 0x10, 0x1F, 0x5C, 0x9D, 0x5F, 0x9E, 0x4F, 0x66, 0xEA, 0x9A, 0x2B, 0xD3, 0x5F, 0xCE, 0xD5, 0x0D, 0x5E, 0x59, 
+    0xC1, 0xFF, 0x7C, 0xA6, 0xE6, 0x78, 0xD9, 0x9F, 0xFE, 0x21, 0xBE, 0xBA, 0xEF, 0x0E, 0xCE, 0xD5, 0x42, 0xDA, 0x0D, 0xB7, 
+    0xD9, 0x66, 0xB6, 0xDE, 0xED, 0xD9, 0xF9, 0x03, 0xB7, 0x12, 0x50, 0xDE, 0x25, 0x7D, 0xD4, 0x44, 0x2B, 0xDC, 0xD1, 0xC7, 
+    0xE1, 0xF0, 0x97, 0x68, 0xB4, 0x8F, 0xE8, 0xD9, 0x28, 0x9B, 0xF7, 0x90, 0x6D, 0x85, 0x51, 0x3C, 0xDB, 0x5F, 0x9D, 0x53, 
+    0x8E, 0xEB, 0xE4, 0x6D, 0xB2, 0x2F, 0xB2, 0x45, 0x12, 0x48, 0x8D, 0xF4, 0x79, 0x8D, 0xCF, 0x70, 0x22, 0x40, 0x19, 0x7A, 
+    0xCF, 0xA9, 0x3F, 0xB7, 0x32, 0xEA, 0xE7, 0x9F, 0x74, 0xA0, 0x90, 0x3C, 0x7C, 0xF9, 0xEA, 0xD3, 0x37, 0x9F, 0x5E, 0x0D, 
+    0xF7, 0x67, 0x67, 0xC1, 0x1E, 0x09, 0xA3, 0xAB, 0x11, 0x9E, 0x2F, 0x29, 0xC7, 0x33, 0x9A, 0xCB, 0x4D, 0x1A, 0x3D, 0x49, 
+    0xF4, 0xE8, 0x70, 0x78, 0xA1, 0xBC, 0x4F, 0x04, 0x37, 0x9C, 0xD0, 0x61, 0xBF, 0x9B, 0xAD, 0x89, 0x5F, 0xFA, 0xC0, 0x3C, 
+    0x7D, 0x80, 0x28, 0x32, 0x9F, 0x9C, 0xCB, 0xF7, 0x4B, 0x6F, 0xA4, 0x08, 0x17, 0xD1, 0x81, 0x26, 0xA5, 0xC6, 0xB3, 0x62, 
+    0x9E, 0xD3, 0x31, 0x2F, 0x79, 0xCA, 0xB7, 0x91, 0xC2, 0x8C, 0x4B, 0x9E, 0x45, 0xB2, 0x96, 0xCF, 0xFC, 0x30, 0x52, 0x3C, 
+    0xC5, 0xF2, 0x49, 0x70, 0x8E, 0x7C, 0x35, 0xCF, 0x88, 0x8B, 0x40, 0x00, 0x25, 0x19, 0xC4, 0x80, 0x83, 0xBF, 0xEB, 0x47, 
+    0xFA, 0xBC, 0x09, 0x87, 0x2F, 0xEC, 0x37, 0x59, 0x01, 0x9D, 0x85, 0x1F, 0x9D, 0xAC, 0xB4, 0xDC, 0x2D, 0x79, 0x6D, 0x46, 
+    0xFA, 0xCC, 0x30, 0x2B, 0xA5, 0xED, 0x9B, 0xDB, 0x16, 0xF5, 0xE3, 0xC3, 0x46, 0xF9, 0xDD, 0x46, 0xB7, 0xB7, 0xB9, 0x6C, 
+    0x69, 0xD4, 0xCA, 0xAB, 0x6B, 0xD6, 0x1E, 0xF1, 0xB0, 0xAF, 0x3C, 0x04, 0xA7, 0x19, 0xF1, 0xD8, 0x7E, 0xFA, 0x24, 0x9F, 
+    0xBD, 0x95, 0x7A, 0xF8, 0x61, 0x74, 0x50, 0xDB, 0x34, 0x22, 0x0C, 0xF1, 0x48, 0xA8, 0x30, 0x8D, 0xB6, 0x69, 0xC5, 0xF8, 
+    0xA1, 0x5D, 0x33, 0x9F, 0xF6, 0x77, 0xDA, 0xA3, 0x55, 0xE4, 0x7E, 0x47, 0xF2, 0x4C, 0x2B, 0x4A, 0x8B, 0xAB, 0x0D, 0x53, 
+    0xF0, 0x80, 0x5D, 0x8A, 0x07, 0x33, 0x3E, 0x7E, 0x96, 0x8D, 0xCC, 0xDF, 0x31, 0xDB, 0x5C, 0x62, 0xCA, 0xAF, 0xF9, 0xA0, 
+    0x16, 0x61, 0xD3, 0xB9, 0xAA, 0x8A, 0xE0, 0x7D, 0xD4, 0x9C, 0x0F, 0xAD, 0x96, 0x2B, 0x70, 0xB8, 0x12, 0xB7, 0x7F, 0xD2, 
+    0x01, 0x2B, 0x83, 0xD0, 0x56, 0xC0, 0x6E, 0xAC, 0x8D, 0xBF, 0xED, 0x4F, 0x71, 0xA7, 0xC5, 0x85, 0xEB, 0xC9, 0xB6, 0xA0, 
+    0x96, 0x13, 0x48, 0xCC, 0x32, 0xA6, 0x79, 0x22, 0x76, 0xED, 0xE8, 0xBA, 0xBC, 0x25, 0x72, 0x7E, 0xA0, 0x63, 0xCB, 0x11, 
+    0x59, 0xC2, 0x07, 0x15, 0xE2, 0x01, 0xC2, 0xBB, 0x88, 0xC3, 0x2B, 0x83, 0x46, 0x8B, 0xC7, 0xE6, 0x22, 0xDD, 0xBA, 0xCF, 
+    0x1D, 0x2B, 0x1A, 0x32, 0xD3, 0x6F, 0x36, 0x42, 0xA0, 0xB5, 0x76, 0x24, 0x8A, 0x0B, 0xBC, 0xBB, 0xE3, 0xAA, 0x37, 0x85, 
+    0x07, 0x0E, 0xED, 0x77, 0x37, 0x19, 0x29, 0x0E, 0xC6, 0x56, 0x09, 0x0D, 0x1A, 0x3C, 0xFD, 0x68, 0xE2, 0x8B, 0x1B, 0x1E, 
+    0xD7, 0x4A, 0x7D, 0x1B, 0xC6, 0x34, 0xB5, 0x98, 0x91, 0xCE, 0x41, 0x56, 0xF5, 0x0F, 0xCC, 0x70, 0xE6, 0x05, 0x95, 0xBE, 
+    0x34, 0x3D, 0x54, 0xBB, 0xF6, 0x4A, 0x54, 0x66, 0xC3, 0xFE, 0x84, 0xDF, 0x69, 0xA3, 0x44, 0xA7, 0x1A, 0x58, 0xA1, 0x8A, 
+    0xED, 0x4F, 0x95, 0x5C, 0xAE, 0x83, 0xA0, 0x2E, 0x88, 0xDB, 0xE8, 0x4A, 0x60, 0x42, 0x27, 0x80, 0x13, 0x4B, 0xB3, 0x7C, 
+    0x59, 0x8F, 0x48, 0xFB, 0x59, 0xE7, 0xA0, 0x0D, 0x89, 0xD1, 0xD4, 0x0C, 0xBA, 0xDE, 0xB9, 0xD7, 0xD5, 0x82, 0x74, 0xA7, 
+    0xA2, 0x47, 0xE7, 0xA8, 0x5C, 0xA7, 0x3A, 0xF6, 0x85, 0x4C, 0xA3, 0x75, 0xCD, 0x1D, 0x1B, 0x71, 0xD9, 0xF0, 0x62, 0x14, 
+    0x9A, 0x9B, 0x86, 0x46, 0xDC, 0x73, 0xB7, 0xD6, 0xDF, 0xD2, 0x16, 0x5F, 0xF5, 0x06, 0x5E, 0x08, 0x90, 0x60, 0xB6, 0xCE, 
+    0xCE, 0xE6, 0x1D, 0x49, 0x91, 0xE8, 0x6C, 0x7F, 0xFE, 0x36, 0x99, 0x13, 0xD3, 0x99, 0x96, 0xC6, 0xBE, 0x1C, 0x99, 0xD6, 
+    0xFD, 0xEA, 0xBA, 0x00, 0xFB, 0x54, 0x37, 0xD4, 0x88, 0xF1, 0x8B, 0x75, 0x2B, 0xB5, 0xB6, 0xAB, 0xD7, 0xC0, 0xA5, 0x06, 
+    0xB7, 0x9A, 0x44, 0x25, 0xE7, 0x3B, 0x66, 0x87, 0x7F, 0x5A, 0x93, 0x7B, 0x20, 0x6E, 0x75, 0x8D, 0x87, 0x07, 0xA3, 0x54, 
+    0x3B, 0x29, 0xCD, 0x2C, 0x06, 0x36, 0x92, 0xC6, 0x94, 0x37, 0x89, 0x78, 0xE3, 0x9F, 0xC2, 0x8E, 0xA6, 0x16, 0x60, 0xB7, 
+    0xCA, 0xE7, 0x67, 0x0A, 0x79, 0x30, 0x03, 0x07, 0xF1, 0x1D, 0xC2, 0xA1, 0x70, 0xAB, 0x3E, 0x48, 0x9E, 0x0E, 0x4A, 0xFB, 
+    0x15, 0x09, 0x1C, 0xAF, 0x1F, 0x9F, 0xD5, 0xF1, 0xC4, 0xA0, 0x31, 0x6C, 0x1D, 0x0D, 0x25, 0x3D, 0x12, 0x3B, 0x4B, 0x75, 
+    0xAA, 0x96, 0x51, 0xA7, 0xA7, 0xAE, 0x8A, 0x2B, 0x6C, 0x2D, 0xED, 0x74, 0x08, 0xB7, 0x93, 0x63, 0x7C, 0x85, 0xD1, 0x6E, 
+    0xAF, 0x2A, 0x34, 0xB3, 0x8B, 0x19, 0xA3, 0xD0, 0x3C, 0x48, 0x1B, 0x70, 0x61, 0x2B, 0x0E, 0x0E, 0x9E, 0x1C, 0xA7, 0x9E, 
+    0xF8, 0x00, 0x4A, 0x39, 0x3E, 0x95, 0x28, 0xFE, 0x40, 0x4B, 0xC7, 0x7F, 0x40, 0x10, 0xF4, 0x9E, 0x0E, 0x85, 0xC1, 0x81, 
+    0xA6, 0x1E, 0x91, 0x12, 0x84, 0x8E, 0x45, 0x68, 0x16, 0x57, 0x42, 0xCA, 0xB1, 0x8E, 0xA3, 0xB5, 0xB5, 0x83, 0x44, 0xCA, 
+    0x3C, 0x07, 0x15, 0x33, 0x3E, 0x90, 0xFE, 0xD6, 0x98, 0x8D, 0x05, 0x32, 0xD4, 0xBD, 0x85, 0x6B, 0xD0, 0x28, 0xEA, 0x92, 
+    0xA5, 0xC1, 0x9B, 0x93, 0x1F, 0x3D, 0x10, 0xD9, 0xAA, 0x74, 0xBC, 0x8A, 0x66, 0xD0, 0xA1, 0x1A, 0x96, 0x49, 0xAD, 0x81, 
+    0x9F, 0x6B, 0xBC, 0xC7, 0x01, 0xBF, 0x78, 0xB8, 0xFC, 0xC4, 0xED, 0xBD, 0xD5, 0x97, 0x9A, 0xFC, 0xCB, 0x23, 0x5D, 0x1B, 
+    0xC7, 0xCB, 0x59, 0x6C, 0xEB, 0x15, 0xEC, 0xCC, 0x15, 0x6F, 0xCD, 0x63, 0x52, 0xFF, 0x18, 0xFA, 0x4E, 0x27, 0x09, 0x85, 
+    0x1B, 0xAB, 0x2C, 0x7E, 0x97, 0xD1, 0xB9, 0xE6, 0x7E, 0x51, 0x35, 0x70, 0x5A, 0x50, 0xF1, 0x56, 0x32, 0x6F, 0x72, 0x63, 
+    0x8E, 0x43, 0x19, 0x51, 0x0B, 0x8F, 0xDE, 0x69, 0x09, 0xCC, 0xE1, 0xE4, 0x9D, 0x05, 0x10, 0xC7, 0x09, 0x12, 0x7D, 0x8C, 
+    0x23, 0x52, 0x74, 0x26, 0x3A, 0x50, 0xA0, 0xF7, 0x89, 0xD7, 0x75, 0x9D, 0x5A, 0x5D, 0x12, 0xF2, 0xC4, 0x05, 0x40, 0xC5, 
+    0x4C, 0x2F, 0xF4, 0x77, 0xD5, 0xC5, 0x29, 0xED, 0x2B, 0x77, 0x69, 0xC5, 0xB9, 0x17, 0x9D, 0x98, 0x2E, 0x36, 0x86, 0x7C, 
+    0xCF, 0xAF, 0x43, 0x7B, 0xDD, 0x46, 0x52, 0x42, 0x93, 0xB8, 0xD1, 0x41, 0x2E, 0xAA, 0x09, 0xB5, 0xDE, 0x07, 0x7A, 0xA7, 
+    0xDF, 0x21, 0x26, 0x28, 0x61, 0x0B, 0x9C, 0xDC, 0x01, 0x2B, 0x3A, 0x6A, 0xDC, 0x06, 0x04, 0x30, 0x21, 0xDC, 0xD6, 0xED, 
+    0x4E, 0x82, 0x9C, 0x63, 0xCA, 0x7F, 0xC6, 0x71, 0x3A, 0x39, 0x11, 0xBA, 0xB5, 0x1C, 0x38, 0x83, 0x6B, 0x99, 0x46, 0xD3, 
+    0xFD, 0x5E, 0x2A, 0x60, 0x1D, 0x78, 0xA9, 0xB3, 0xA5, 0xAE, 0x09, 0xA1, 0x90, 0x4F, 0xCB, 0x5A, 0x98, 0xCD, 0x67, 0xBC, 
+    0x37, 0xB6, 0x28, 0x5A, 0x7A, 0xA4, 0xCC, 0x36, 0x83, 0x53, 0xB8, 0x32, 0xFE, 0xE9, 0x6F, 0x38, 0x6B, 0x3B, 0xB3, 0xD3, 
+    0x53, 0xA6, 0x33, 0x6C, 0x1E, 0x34, 0x3B, 0x8D, 0x0A, 0xBE, 0xD7, 0x55, 0xE3, 0x83, 0x4A, 0xEF, 0x68, 0xD6, 0x0C, 0x37, 
+    0xD4, 0xC2, 0x91, 0x1B, 0x5C, 0x6E, 0xE1, 0x40, 0x5D, 0xC3, 0x3C, 0xA0, 0xB4, 0xE5, 0x5E, 0x81, 0xAA, 0x4A, 0xA1, 0x68, 
+    0x4F, 0xD4, 0xC2, 0x2D, 0xC6, 0x71, 0x79, 0xCB, 0x01, 0x67, 0x11, 0xDC, 0x95, 0x70, 0xFE, 0x2D, 0x9D, 0xDD, 0xFB, 0x3D, 
+    0x2B, 0x80, 0x04, 0xAD, 0xD6, 0xDE, 0xE3, 0x20, 0x30, 0x07, 0xFD, 0x5A, 0x8D, 0x9D, 0x78, 0xDB, 0xE3, 0x51, 0x38, 0x2E, 
+    0x5D, 0x26, 0xCE, 0x35, 0xFC, 0x50, 0xF6, 0x27, 0x9E, 0xC4, 0x55, 0xD5, 0x7E, 0xB5, 0x9D, 0x84, 0x23, 0xB8, 0xF5, 0xAF, 
+    0xF5, 0x01, 0x37, 0x16, 0x9B, 0x1C, 0xD0, 0x88, 0x01, 0xC7, 0x12, 0xAD, 0xE0, 0x48, 0x44, 0x74, 0x1E, 0xCE, 0xE8, 0x94, 
+    0x26, 0x32, 0xCD, 0x10, 0x99, 0x6A, 0xEA, 0x00, 0x21, 0x1C, 0xBC, 0x77, 0xC7, 0xD6, 0x55, 0xD9, 0x2C, 0x25, 0xE2, 0xF2, 
+    0xD9, 0x05, 0xD1, 0xA6, 0xCF, 0x5E, 0x10, 0x0C, 0x77, 0xE7, 0x70, 0xC2, 0x5B, 0x44, 0xF0, 0x05, 0xEF, 0x78, 0x2D, 0x82, 
+    0xB6, 0xBA, 0xB5, 0x76, 0x65, 0xDA, 0xAA, 0xC5, 0x06, 0xFA, 0xF4, 0x74, 0x6A, 0x07, 0x77, 0x7A, 0xBA, 0x16, 0xC2, 0xC9, 
+    0x0C, 0x08, 0x2E, 0xF5, 0x78, 0x5B, 0x4C, 0xED, 0x30, 0x10, 0x3D, 0x95, 0x91, 0x3A, 0xD3, 0x08, 0xB4, 0x46, 0x91, 0xA6, 
+    0x5B, 0x08, 0x88, 0x67, 0xFB, 0xFD, 0x8D, 0xAD, 0x2C, 0xB6, 0x34, 0x3E, 0x7D, 0x41, 0xFF, 0x2B, 0x1F, 0xFB, 0xE1, 0x34, 
+    0x9C, 0xBA, 0x94, 0x4C, 0x21, 0x2E, 0x72, 0x4A, 0x72, 0xAF, 0xE9, 0x85, 0xC9, 0x21, 0x8B, 0xAE, 0x23, 0x37, 0x2B, 0xD1, 
+    0x82, 0xCA, 0xD0, 0x2C, 0x84, 0x70, 0xAF, 0x9B, 0xB5, 0xA0, 0x6A, 0x77, 0xE7, 0x5E, 0xC3, 0xE1, 0xA6, 0x59, 0xF7, 0xA9, 
+    0x1B, 0x57, 0x41, 0x4D, 0xF9, 0x38, 0xD0, 0xAE, 0x2F, 0x23, 0xCF, 0xF8, 0x5E, 0x70, 0x3B, 0x1B, 0x4C, 0x2B, 0x95, 0x55, 
+    0x3E, 0x0D, 0xA6, 0x88, 0x4C, 0x6B, 0x66, 0x5D, 0xEC, 0x6C, 0x8E, 0xCD, 0x2A, 0x81, 0x13, 0x1C, 0xFB, 0xAF, 0xAA, 0xB5, 
+    0x35, 0xCC, 0xB2, 0xD9, 0x4D, 0x19, 0xE2, 0xE3, 0x71, 0xB4, 0x77, 0x6B, 0x5A, 0xFF, 0x36, 0x0D, 0x18, 0xE6, 0xB5, 0xED, 
+    0x53, 0xB4, 0x1E, 0xDE, 0xEA, 0x70, 0xCA, 0xEC, 0x3C, 0xE6, 0xEC, 0x82, 0xC1, 0xDC, 0x38, 0x8D, 0x1F, 0xC3, 0x1F, 0x3D, 
+    0x0B, 0xE3, 0x1C, 0x5C, 0x3A, 0xAE, 0xE1, 0x52, 0x83, 0x61, 0xAA, 0xE0, 0x3D, 0x0E, 0x9C, 0x6D, 0x3E, 0xE1, 0xDD, 0x3D, 
+    0x85, 0x9A, 0x3D, 0x0E, 0xEF, 0xB2, 0xF9, 0xE9, 0xB0, 0xE0, 0x08, 0xCB, 0x66, 0x8D, 0xCD, 0x8D, 0x90, 0x17, 0xD8, 0xC8, 
+    0x47, 0xE3, 0x52, 0x65, 0x55, 0x70, 0xC0, 0x4A, 0x1C, 0x75, 0x2C, 0x5B, 0x5C, 0x2F, 0x99, 0xBD, 0x5F, 0xC6, 0x54, 0xE8, 
+    0xF3, 0x39, 0x60, 0xDC, 0xC7, 0x5D, 0x47, 0xDA, 0xBB, 0x94, 0x9A, 0xD7, 0x0D, 0xA9, 0x09, 0x43, 0xD4, 0x64, 0xD6, 0x25, 
+    0xDF, 0x00, 0x27, 0x08, 0x01, 0xFB, 0x4A, 0xC0, 0x3C, 0x31, 0xCD, 0x57, 0xB1, 0x11, 0x90, 0x00, 0xB8, 0x39, 0xA2, 0xE6, 
+    0xB2, 0xD3, 0xA6, 0x6B, 0x38, 0xEB, 0x60, 0x12, 0xC7, 0xD0, 0x61, 0x81, 0x95, 0x9D, 0xD9, 0x94, 0x25, 0x01, 0x60, 0x5C, 
+    0x93, 0x67, 0x41, 0x04, 0x1C, 0x56, 0xA9, 0x17, 0x0C, 0x65, 0x62, 0xA9, 0x17, 0xD4, 0x5C, 0x5E, 0x35, 0xE2, 0x4D, 0xCD, 
+    0x63, 0xEB, 0x68, 0x6C, 0x36, 0x32, 0xCC, 0x54, 0x5E, 0xA7, 0x72, 0x98, 0x97, 0x6A, 0xA4, 0xFA, 0xB3, 0x20, 0x44, 0x31, 
+    0x99, 0x58, 0x3B, 0xE1, 0x2D, 0xE2, 0xEA, 0xDD, 0x91, 0x68, 0x33, 0xFF, 0x10, 0x19, 0x5C, 0xCB, 0x97, 0x52, 0xB3, 0x25, 
+    0x96, 0x40, 0x9F, 0x7E, 0x19, 0x99, 0x48, 0xDC, 0x8B, 0xF8, 0xC6, 0x65, 0xA7, 0xEF, 0x37, 0xC2, 0x15, 0x35, 0x0C, 0x62, 
+    0xEA, 0xDB, 0x20, 0xE1, 0x30, 0x83, 0x12, 0x11, 0xAF, 0xEE, 0xA9, 0x06, 0x21, 0x87, 0xB8, 0xE2, 0x23, 0xFA, 0x6F, 0xBD, 
+    0x7C, 0xB5, 0xF8, 0x26, 0x59, 0xCE, 0xD6, 0xAD, 0x31, 0x1A, 0x2C, 0x95, 0x6E, 0x2F, 0x58, 0xB4, 0xAB, 0xCA, 0x96, 0xB4, 
+    0x3F, 0xD5, 0x93, 0x0C, 0x8F, 0x42, 0x3C, 0x9B, 0xD6, 0x83, 0x1F, 0xA4, 0x35, 0x07, 0x0A, 0x87, 0x83, 0x04, 0xAF, 0xF9, 
+    0x3F, 0xA8, 0x83, 0xB4, 0xAD, 0x8B, 0xCD, 0xEE, 0x33, 0xBE, 0x4C, 0xC4, 0x4E, 0xAA, 0x04, 0xAB, 0x41, 0x77, 0xE5, 0x9E, 
+    0xF1, 0xBF, 0xD9, 0xDB, 0xC6, 0x05, 0x78, 0x2D, 0xA1, 0xDE, 0xBC, 0x15, 0xC0, 0x26, 0xE3, 0xDD, 0x51, 0x1D, 0xC6, 0xFF, 
+    0x2F, 0x1A, 0xAD, 0xC4, 0x63, 0x3B, 0x04, 0xAD, 0x86, 0xB8, 0x55, 0x66, 0x31, 0x89, 0x17, 0xA5, 0x22, 0x76, 0x09, 0xDF, 
+    0x10, 0x8D, 0x94, 0x6C, 0x64, 0x6E, 0xC5, 0x0E, 0xA9, 0x10, 0x72, 0x59, 0x85, 0x6E, 0x2B, 0x9D, 0xF9, 0x11, 0x12, 0xCD, 
+    0xD8, 0x19, 0x6C, 0x95, 0x7F, 0x00, 0x8F, 0x68, 0xB1, 0x6F, 0x56, 0xC3, 0xBE, 0xA0, 0x9C, 0x09, 0xB7, 0xA2, 0xA8, 0x4B, 
+    0x33, 0xB9, 0x75, 0x54, 0x4E, 0x8A, 0x2C, 0xA8, 0x8A, 0xEA, 0x9B, 0xE1, 0x3F, 0xCC, 0xF8, 0x12, 0xB6, 0xB0, 0xD1, 0xA3, 
+    0x10, 0xD5, 0x22, 0xD8, 0xDB, 0xB1, 0x7B, 0xF6, 0xA7, 0x7A, 0xB4, 0xBA, 0xDA, 0x30, 0x12, 0x76, 0xA2, 0x6D, 0x82, 0x70, 
+    0xB9, 0xE0, 0x94, 0x54, 0x7A, 0x53, 0xF9, 0x34, 0x48, 0xB4, 0xC0, 0x6A, 0x5B, 0x93, 0xAC, 0x78, 0xC2, 0x54, 0x78, 0x22, 
+    0x31, 0xD1, 0x79, 0x4C, 0x54, 0xC4, 0x7E, 0x2D, 0x32, 0x4B, 0x93, 0x37, 0x70, 0xFC, 0x07, 0x99, 0x28, 0x63, 0x9D, 0x8B, 
+    0x30, 0xD1, 0x0E, 0x74, 0xE0, 0xB9, 0x2A, 0x09, 0x45, 0xEC, 0xCF, 0x6E, 0x21, 0xDB, 0x6E, 0x64, 0xB9, 0x52, 0xD7, 0x57, 
+    0xDC, 0x41, 0x81, 0x75, 0xF8, 0x9D, 0x18, 0x51, 0x76, 0x9C, 0x46, 0x6D, 0x6C, 0x9A, 0x98, 0xD1, 0xC1, 0x94, 0xBB, 0x1E, 
+    0xA0, 0x6A, 0xBE, 0xFD, 0x9C, 0xCB, 0xB0, 0x4A, 0x38, 0x4D, 0x4B, 0xDC, 0x59, 0xAA, 0x6E, 0x9C, 0x22, 0xBE, 0xB5, 0x2B, 
+    0x0B, 0x6B, 0x89, 0x55, 0x4B, 0x60, 0x96, 0x96, 0xB1, 0xF6, 0x3A, 0x35, 0x49, 0xE4, 0xE9, 0xE9, 0xA4, 0xFA, 0xF5, 0x1D, 
+    0xF4, 0x1E, 0x72, 0x10, 0xD9, 0x69, 0x49, 0xD4, 0xE4, 0x5D, 0x24, 0x2A, 0x0E, 0xC1, 0x84, 0x95, 0xA7, 0x5A, 0x29, 0x50, 
+    0x36, 0x8B, 0x63, 0x2B, 0x9D, 0xFC, 0x32, 0x1B, 0x64, 0xD8, 0x1F, 0x91, 0x8E, 0xEA, 0xC9, 0x93, 0x54, 0x97, 0x94, 0xF8, 
+    0x35, 0x20, 0x4B, 0x19, 0xC8, 0x2A, 0x5E, 0x60, 0x80, 0xCD, 0xA2, 0xBE, 0xE3, 0xF8, 0xF6, 0x90, 0xEA, 0x9D, 0x5F, 0x3B, 
+    0x71, 0x92, 0x77, 0x9E, 0x1E, 0xBA, 0xC3, 0xD5, 0x90, 0x32, 0x8D, 0x28, 0x23, 0xCE, 0xC5, 0xCF, 0x7B, 0x31, 0x52, 0x8A, 
+    0x99, 0xA8, 0x6B, 0x35, 0xD4, 0xC6, 0x23, 0x51, 0x34, 0x45, 0x15, 0x4F, 0xF7, 0x40, 0xB3, 0x0A, 0x06, 0x25, 0x6A, 0x45, 
+    0x42, 0xE9, 0x27, 0x5B, 0x99, 0x19, 0xAC, 0xEE, 0x38, 0x5F, 0xD3, 0xB4, 0x04, 0x3B, 0x45, 0x83, 0x0A, 0xEC, 0x51, 0x5F, 
+    0x66, 0xD6, 0x6C, 0x9B, 0x95, 0x0C, 0x4D, 0xEF, 0x6B, 0x5B, 0x07, 0x26, 0x69, 0x72, 0xCB, 0x8A, 0x60, 0x62, 0xDA, 0xC9, 
+    0xBA, 0xCA, 0x4B, 0xE6, 0x8A, 0x20, 0x79, 0x5E, 0xF1, 0x65, 0xB6, 0x14, 0xAD, 0xB9, 0x55, 0x34, 0x3F, 0xBB, 0x20, 0x26, 
+    0x8B, 0x9D, 0x43, 0xDD, 0x56, 0xC3, 0xAA, 0xAC, 0x99, 0xC9, 0xBC, 0xDD, 0xEF, 0xE7, 0x88, 0xFE, 0xD5, 0xB8, 0x52, 0x5E, 
+    0xB3, 0x25, 0x6E, 0xE9, 0x9C, 0xE7, 0xF4, 0x74, 0xA9, 0xC1, 0x6F, 0x1D, 0x04, 0xC7, 0xAF, 0xF3, 0xAC, 0xC2, 0x30, 0x91, 
+    0x2D, 0xB7, 0x88, 0x13, 0x75, 0xCB, 0x3A, 0xC1, 0xFD, 0x51, 0xB4, 0x76, 0x2C, 0xD3, 0x32, 0x5C, 0x77, 0x12, 0xF8, 0x73, 
+    0x14, 0xB1, 0xDC, 0x59, 0x34, 0xDE, 0xD7, 0xE8, 0xD7, 0x9C, 0x1D, 0x9E, 0x2C, 0x7A, 0x15, 0x4E, 0x53, 0xE3, 0xF7, 0x06, 
+    0x6D, 0x42, 0x30, 0xA8, 0x83, 0x6C, 0xC2, 0x3F, 0x8A, 0xC3, 0x9B, 0x88, 0x65, 0x59, 0x0B, 0x53, 0x01, 0x67, 0x2A, 0x42, 
+    0x09, 0x03, 0xF6, 0x27, 0x3A, 0xCE, 0x1A, 0xAD, 0xFF, 0xCC, 0xA1, 0x98, 0x1F, 0x52, 0x36, 0xA2, 0x35, 0xD8, 0x61, 0x7E, 
+    0x79, 0x3D, 0xB8, 0x66, 0x23, 0x33, 0x9A, 0x71, 0x3A, 0x41, 0x56, 0xC6, 0xE9, 0x26, 0xE3, 0x25, 0x58, 0xDB, 0xB3, 0xE6, 
+    0xC1, 0x18, 0x88, 0x53, 0x38, 0x94, 0x89, 0xC8, 0xAE, 0xCB, 0x23, 0x81, 0x3D, 0x0B, 0x99, 0x59, 0x80, 0x95, 0x7E, 0xAE, 
+    0xAE, 0x79, 0xB8, 0x63, 0xCD, 0xE6, 0x4F, 0x86, 0x13, 0x1B, 0x7A, 0xB8, 0x3E, 0x48, 0xE9, 0xE3, 0x44, 0x3D, 0xA6, 0xB0, 
+    0x19, 0xED, 0x0F, 0xC6, 0xB6, 0x3F, 0x13, 0x54, 0x65, 0xE8, 0xF7, 0xDC, 0xA5, 0xDF, 0x3B, 0xA5, 0xD6, 0x44, 0x45, 0x2C, 
+    0x5A, 0x39, 0xCE, 0x10, 0xF1, 0x0A, 0x63, 0x81, 0xD1, 0x14, 0xD4, 0x2C, 0x0A, 0xCA, 0xF2, 0xC3, 0x66, 0xCE, 0x56, 0xC6, 
+    0xFA, 0x59, 0x3E, 0x82, 0x2E, 0x2E, 0x6B, 0xF1, 0xD1, 0x14, 0x1D, 0xD6, 0x50, 0x09, 0x71, 0x38, 0x2F, 0xBC, 0x5A, 0x64, 
+    0x20, 0xDE, 0x28, 0x0C, 0xEE, 0xB9, 0x65, 0x3C, 0x09, 0xCB, 0xE1, 0x48, 0x2C, 0xCA, 0x2B, 0xA7, 0x86, 0x28, 0x7D, 0xB1, 
+    0xAA, 0x8C, 0x20, 0x88, 0x37, 0xAB, 0xD0, 0x93, 0x27, 0xCF, 0xD0, 0x6A, 0x48, 0xD2, 0x8F, 0x9E, 0x72, 0xA9, 0x87, 0x50, 
+    0xAB, 0x61, 0x99, 0xD4, 0x4F, 0x99, 0x6C, 0xF1, 0x98, 0x7A, 0xF1, 0x0C, 0x2E, 0x41, 0x6C, 0x44, 0xCF, 0xC1, 0x2B, 0xDE, 
+    0x7B, 0x43, 0xF1, 0x25, 0xCD, 0x18, 0xAA, 0x1C, 0x35, 0x95, 0x5D, 0xB9, 0x4D, 0xA3, 0x72, 0xB1, 0x06, 0xD3, 0xCB, 0x48, 
+    0x24, 0xB8, 0x44, 0x6B, 0x10, 0xD4, 0x4D, 0x1D, 0x64, 0x20, 0x00, 0xC2, 0x5A, 0x29, 0xFE, 0x04, 0xC2, 0x5C, 0x3A, 0xC2, 
+    0x7D, 0x18, 0x68, 0xEB, 0x4D, 0x0D, 0xAF, 0x5A, 0x1C, 0xAF, 0xB3, 0x42, 0x15, 0xB4, 0x06, 0xD6, 0x7B, 0x99, 0xAA, 0x57, 
+    0x69, 0x25, 0xA6, 0xDE, 0xE7, 0xA9, 0xEF, 0x0A, 0xDE, 0xA8, 0x67, 0x8D, 0x8B, 0xE7, 0xC0, 0x60, 0xDC, 0x37, 0x2B, 0xFA, 
+    0xC8, 0xDC, 0x3F, 0x6B, 0xCF, 0x52, 0x9B, 0x5A, 0xE9, 0xE1, 0xE5, 0x6A, 0x41, 0xAC, 0x69, 0x91, 0xBF, 0xD6, 0x91, 0x05, 
+    0xF2, 0xE3, 0x5F, 0xFD, 0x82, 0x05, 0x09, 0xC4, 0xC7, 0x18, 0x87, 0xFD, 0xE2, 0x01, 0x10, 0xC9, 0x8E, 0x13, 0xC0, 0x41, 
+    0x19, 0x4C, 0x8A, 0x11, 0x20, 0xDC, 0x5B, 0x95, 0xD2, 0xE9, 0x2F, 0x9C, 0x9B, 0x84, 0x47, 0xDA, 0xB4, 0xAF, 0x10, 0x18, 
+    0xC7, 0x5E, 0x8C, 0x73, 0x8C, 0xB0, 0xCF, 0x45, 0x80, 0xAD, 0x1D, 0x0D, 0x8A, 0xF5, 0x2C, 0xBE, 0xBC, 0x4C, 0x23, 0xFA, 
+    0x47, 0x87, 0xA9, 0xEF, 0x7D, 0x22, 0x71, 0x19, 0x4F, 0xF8, 0xAF, 0x84, 0x09, 0x88, 0x3E, 0xE8, 0x7F, 0x70, 0xC2, 0xC1, 
+    0x01, 0xF8, 0x49, 0x62, 0x17, 0xE0, 0xF1, 0x9C, 0xCE, 0x3A, 0x67, 0x1A, 0xD2, 0xBA, 0xF9, 0x15, 0x3B, 0x1D, 0x7A, 0x89, 
+    0xF0, 0xDA, 0xD5, 0x78, 0x8E, 0xFB, 0x7D, 0x25, 0xD1, 0x6C, 0xC6, 0xA0, 0x8C, 0x62, 0x9E, 0xF6, 0xEE, 0x37, 0x74, 0x46, 
+    0xFB, 0xDA, 0x6B, 0x18, 0x8B, 0x85, 0xCA, 0xEE, 0xBF, 0x4C, 0xED, 0x04, 0x04, 0x8A, 0x87, 0xC9, 0x88, 0xE7, 0xD0, 0xF0, 
+    0xC4, 0x37, 0xB8, 0xE9, 0x6D, 0xA7, 0x84, 0x82, 0x6F, 0x7E, 0xDC, 0x24, 0x6B, 0x0E, 0x62, 0xB0, 0x8D, 0xAA, 0xC6, 0x4A, 
+    0x3A, 0x02, 0x54, 0x69, 0xDE, 0x99, 0x20, 0xCE, 0x86, 0xB5, 0xF1, 0x2C, 0x03, 0xD1, 0xFF, 0x3B, 0x61, 0x24, 0xE2, 0xFF, 
+    0xCB, 0xA2, 0x48, 0x9C, 0xDD, 0x17, 0xE9, 0xCD, 0x6C, 0x77, 0x96, 0xAE, 0x1E, 0xCE, 0xB6, 0xB3, 0xDF, 0x10, 0x2F, 0x42, 
+    0x2F, 0x1D, 0x92, 0x06, 0x67, 0x8B, 0xD5, 0x6F, 0xC7, 0xBE, 0x1D, 0x49, 0x36, 0x60, 0x9E, 0x62, 0x4D, 0xFE, 0xED, 0xB0, 
+    0x14, 0xBF, 0xEB, 0xCA, 0x58, 0x0F, 0x42, 0xE0, 0xD6, 0xFB, 0x18, 0x53, 0x92, 0x44, 0x1F, 0x76, 0x6A, 0x51, 0x2B, 0x9A, 
+    0x11, 0x2A, 0x4A, 0xDF, 0xAF, 0x07, 0xE3, 0x7A, 0xED, 0xCF, 0xD0, 0x38, 0x90, 0x4E, 0x9E, 0xAB, 0x2F, 0xAB, 0xCA, 0x19, 
+    0xBF, 0xF8, 0x5E, 0xF7, 0x75, 0xD7, 0x0B, 0xFC, 0xB8, 0xB3, 0x7E, 0x08, 0x86, 0xC9, 0xD9, 0x6F, 0xFF, 0x39, 0xEA, 0x3E, 
+    0xD3, 0x0A, 0x1A, 0x5F, 0xA5, 0xEA, 0x2F, 0xA9, 0xFA, 0x2B, 0x8A, 0xFB, 0xB4, 0x46, 0xFB, 0x0D, 0xD6, 0x6B, 0x9F, 0xB2, 
+    0x53, 0xD0, 0x3D, 0x96, 0x0B, 0x8E, 0xD4, 0x18, 0x2B, 0x54, 0xD0, 0x41, 0xEC, 0x7F, 0x95, 0xB6, 0x69, 0x88, 0xD5, 0xEF, 
+    0x29, 0x1D, 0x07, 0x1A, 0x8D, 0x3A, 0x68, 0xA7, 0x88, 0x33, 0x74, 0xEA, 0x41, 0xF4, 0xCE, 0x0B, 0x05, 0xC4, 0x3B, 0x45, 
+    0x89, 0x12, 0xD6, 0x09, 0x25, 0x7C, 0xA5, 0x05, 0xEB, 0x59, 0xCC, 0x68, 0xF4, 0x7B, 0xAD, 0x60, 0xCC, 0x37, 0x16, 0x04, 
+    0x3D, 0xFB, 0x3D, 0xC2, 0x54, 0x85, 0x26, 0xAC, 0x21, 0xD4, 0xE7, 0x80, 0x4E, 0x26, 0xCC, 0xF6, 0x1D, 0xBF, 0x9B, 0x60, 
+    0x4F, 0x69, 0x0B, 0x69, 0x4E, 0xA2, 0x28, 0xD3, 0x74, 0x6A, 0x7F, 0x43, 0x74, 0x5A, 0xFE, 0x59, 0x3F, 0xA7, 0xE2, 0x7A, 
+    0x7B, 0x2A, 0x8B, 0xC7, 0xD1, 0x3F, 0x17, 0xB3, 0xA5, 0x44, 0x19, 0x19, 0xE3, 0x25, 0x79, 0x90, 0x97, 0x32, 0xDD, 0x49, 
+    0x35, 0xE5, 0xA2, 0x09, 0xFA, 0xAF, 0xEB, 0x30, 0x69, 0xB9, 0x5B, 0xA6, 0x50, 0x4E, 0x29, 0xB8, 0x4E, 0xB6, 0x8C, 0xCA, 
+    0x24, 0x9E, 0x84, 0x93, 0xAE, 0xE7, 0x1D, 0x82, 0xB0, 0x11, 0x57, 0xC7, 0x38, 0x5B, 0x30, 0x78, 0xFD, 0xD8, 0x5A, 0xB9, 
+    0xD9, 0xFE, 0xE7, 0xAB, 0xE0, 0x4C, 0xB7, 0x30, 0x77, 0xF0, 0x43, 0x02, 0x57, 0x24, 0x08, 0x27, 0x46, 0xB3, 0x3A, 0x65, 
+    0x97, 0x31, 0xEE, 0x6C, 0x76, 0xFE, 0x5A, 0x9F, 0x4E, 0x40, 0x9C, 0x18, 0x7D, 0xDC, 0x2D, 0xC5, 0x68, 0x8A, 0x1A, 0xA4, 
+    0x19, 0x65, 0x3B, 0x54, 0xFE, 0x88, 0x08, 0x08, 0xF2, 0x18, 0x55, 0x07, 0xC0, 0x69, 0x10, 0x07, 0xF3, 0x37, 0x6F, 0x4C, 
+    0x6B, 0xFC, 0x9A, 0x38, 0x2C, 0xF6, 0x53, 0x1D, 0x7B, 0x17, 0xC5, 0xC2, 0x0B, 0x31, 0xDD, 0xD3, 0xDE, 0x7A, 0xF6, 0x50, 
+    0xB0, 0xF9, 0x6C, 0xD7, 0xC3, 0x96, 0xD3, 0x05, 0x72, 0xB7, 0xE6, 0xD6, 0x99, 0x26, 0xA2, 0x26, 0xB9, 0xDB, 0xAD, 0x3C, 
+    0x57, 0x8D, 0xEC, 0xEB, 0x8A, 0x7E, 0xC0, 0x13, 0xC1, 0x61, 0xD8, 0xF0, 0xBD, 0x9C, 0xF8, 0x36, 0x50, 0x4C, 0x87, 0x4E, 
+    0x01, 0xAB, 0xAF, 0xC6, 0x0D, 0x68, 0x01, 0xA2, 0x09, 0xDE, 0x1D, 0xDA, 0x30, 0xDE, 0x51, 0x1A, 0x1C, 0x51, 0xB1, 0x3C, 
+    0x34, 0x4E, 0x91, 0x4A, 0x2C, 0x5B, 0xBE, 0x43, 0x3A, 0x86, 0xC3, 0xFF, 0xB7, 0x7B, 0x69, 0xC5, 0xBD, 0x63, 0xFB, 0xB1, 
+    0x93, 0xE8, 0x33, 0x07, 0xAA, 0xAB, 0xFA, 0xE8, 0x80, 0x63, 0x43, 0x8B, 0xB2, 0xC7, 0xF3, 0x55, 0xB2, 0x0B, 0x31, 0xDD, 
+    0x83, 0x15, 0x31, 0xBA, 0xB3, 0xDD, 0x63, 0xD8, 0xFB, 0x18, 0x9E, 0x41, 0xF5, 0x5B, 0xE4, 0xF5, 0xE9, 0x9D, 0x03, 0xC4, 
+    0xEB, 0x14, 0xD8, 0x47, 0x6C, 0xB7, 0x5F, 0xA0, 0x5C, 0xD4, 0xE9, 0x64, 0xF6, 0x45, 0x99, 0xE3, 0x00, 0x3E, 0xBE, 0xA1, 
+    0x58, 0x43, 0x78, 0x77, 0x3E, 0x5B, 0x47, 0x9E, 0x83, 0xCF, 0xBD, 0x86, 0x73, 0xCF, 0xF6, 0x22, 0xEC, 0x9A, 0x14, 0xBE, 
+    0xA8, 0x99, 0xFB, 0x61, 0xC0, 0xAA, 0xD6, 0xC3, 0x8C, 0x71, 0x5B, 0x59, 0x2A, 0x48, 0xDF, 0x5F, 0xF3, 0x49, 0x12, 0x49, 
+    0x8C, 0x98, 0x32, 0x01, 0x04, 0x31, 0xA7, 0x7C, 0xB3, 0xFA, 0xED, 0xB3, 0x46, 0xE2, 0x8F, 0x7C, 0x78, 0xD9, 0xF4, 0xD2, 
+    0x45, 0xFD, 0x8D, 0x22, 0xC8, 0x9A, 0xCF, 0xB0, 0x2A, 0x5F, 0xCE, 0xF2, 0xBC, 0x58, 0x7E, 0xC7, 0xE7, 0x42, 0x5B, 0xF8, 
+    0x4E, 0xBB, 0xE5, 0x66, 0x3E, 0x7B, 0x8B, 0xB0, 0x4D, 0xFF, 0x5D, 0x57, 0x70, 0xB4, 0xCC, 0x58, 0xCA, 0x8C, 0x0F, 0x8A, 
+    0x77, 0xC6, 0xF7, 0xE6, 0x54, 0x3F, 0x96, 0xBF, 0x90, 0xFC, 0x05, 0x78, 0x75, 0xA9, 0xFA, 0x1B, 0x3E, 0x78, 0xD8, 0xA3, 
+    0xF4, 0xD1, 0x52, 0x53, 0x29, 0x35, 0xAD, 0x68, 0x61, 0xCE, 0x2A, 0x00, 0x3C, 0xFB, 0xBF, 0x32, 0x16, 0xD6, 0xEF, 0xA1, 
+    0x55, 0xA4, 0xC5, 0x56, 0x52, 0xC5, 0xF9, 0xD4, 0x9E, 0xDA, 0x46, 0xA8, 0x9C, 0xA1, 0xA3, 0x17, 0xFF, 0x39, 0xD0, 0x3F, 
+    0x7A, 0x40, 0x20, 0x50, 0x9A, 0x64, 0xCB, 0x47, 0x48, 0xAD, 0xCF, 0x81, 0x87, 0xFB, 0x3D, 0x0E, 0x3F, 0xCD, 0xE1, 0x07, 
+    0x1B, 0x67, 0x37, 0xFB, 0xCC, 0xF6, 0x2E, 0xFE, 0x13, 0x47, 0xAA, 0xDF, 0xFC, 0x4C, 0xBC, 0x09, 0x1F, 0xED, 0xE2, 0x2C, 
+    0x07, 0x11, 0x00, 0xC6, 0x91, 0x47, 0x0D, 0x01, 0xDC, 0xDF, 0x9D, 0x5D, 0xFA, 0xC4, 0x79, 0xA9, 0xA4, 0x9C, 0x8C, 0xB3, 
+    0xE8, 0x77, 0x91, 0x53, 0x6A, 0x56, 0x9B, 0xE9, 0xFF, 0x83, 0xA8, 0xC4, 0xBE, 0x67, 0x7B, 0xB7, 0x28, 0x37, 0x4B, 0x34, 
+    0xAB, 0x92, 0x80, 0x7D, 0xCF, 0x42, 0x8B, 0x4E, 0xB9, 0xE0, 0x13, 0x2A, 0xEA, 0x70, 0xC8, 0x0E, 0x46, 0x76, 0x7E, 0xDB, 
+    0xFC, 0xCD, 0xDC, 0xE9, 0x76, 0x1A, 0x08, 0xEA, 0x8E, 0x9A, 0x8D, 0xF6, 0xE4, 0x86, 0xFE, 0xE5, 0x40, 0xF8, 0x39, 0x3F, 
+    0xEC, 0xE4, 0x49, 0xAB, 0x51, 0x6A, 0x4D, 0xCF, 0xD9, 0x51, 0xD4, 0xBE, 0xCB, 0xE1, 0xCF, 0x11, 0xFC, 0x51, 0x6D, 0x82, 
+    0xDF, 0x31, 0x01, 0x76, 0xAA, 0x98, 0xB1, 0x83, 0x12, 0x03, 0x84, 0x34, 0x2C, 0xD3, 0x61, 0x9C, 0xF6, 0x25, 0xEF, 0x31, 
+    0x5C, 0x57, 0xFA, 0x4E, 0xCD, 0xBA, 0x10, 0xF0, 0xF2, 0x0C, 0x32, 0xCE, 0x5A, 0xEA, 0x3B, 0xEB, 0x6A, 0x0B, 0xED, 0x76, 
+    0x90, 0x78, 0x6A, 0xDB, 0xFB, 0x64, 0x1D, 0x1D, 0x71, 0x0C, 0xC0, 0x0E, 0x91, 0xB4, 0xEE, 0x16, 0x5B, 0x72, 0xA4, 0xC1, 
+    0x64, 0x38, 0x1E, 0x19, 0xEA, 0x07, 0xF7, 0x7E, 0xE5, 0x23, 0x3B, 0x1E, 0x1A, 0x20, 0x46, 0x86, 0x9C, 0xD5, 0x89, 0x8E, 
+    0xE6, 0xE1, 0x96, 0x76, 0x72, 0xA3, 0x22, 0xCB, 0x22, 0xEB, 0xE8, 0x69, 0x44, 0x7A, 0x27, 0xF3, 0xF5, 0x34, 0xB9, 0xF2, 
+    0x87, 0xBF, 0x04, 0xA3, 0xE7, 0x57, 0x50, 0x38, 0xFE, 0x96, 0x12, 0xF5, 0xA1, 0x77, 0xB5, 0x7D, 0x0E, 0x7D, 0x64, 0xF9, 
+    0x18, 0x9C, 0xAB, 0xEF, 0x98, 0x54, 0xC7, 0xC0, 0xF7, 0xBC, 0x50, 0x44, 0xD5, 0x9F, 0x65, 0xC3, 0x22, 0x19, 0x05, 0x3D, 
+    0xA8, 0x42, 0x7F, 0x7F, 0x84, 0xF6, 0xEF, 0x3D, 0x0F, 0x0C, 0xC9, 0xFF, 0xB7, 0x7A, 0x16, 0xC4, 0x09, 0x08, 0x22, 0x9D, 
+    0x53, 0x67, 0xFA, 0x7B, 0x1A, 0x3D, 0x59, 0xAC, 0xE0, 0x95, 0x68, 0xE1, 0xED, 0x6C, 0x3B, 0x4B, 0x67, 0x73, 0x9C, 0xD6, 
+    0xDE, 0x94, 0x8F, 0x24, 0x4F, 0x99, 0x95, 0xF5, 0x78, 0x17, 0x78, 0x07, 0xF5, 0x9A, 0x0A, 0x13, 0x59, 0xB3, 0x2B, 0x36, 
+    0xAF, 0x31, 0x08, 0x5A, 0x7E, 0x80, 0x36, 0x28, 0xB2, 0x1F, 0x05, 0x93, 0x7A, 0x1F, 0x71, 0x5C, 0xA2, 0x37, 0x69, 0x34, 
+    0xF4, 0xE4, 0xF0, 0xA3, 0x66, 0xBF, 0xA3, 0x7F, 0x74, 0x3C, 0xD2, 0xDF, 0xC5, 0xD6, 0x1B, 0x95, 0x87, 0xC4, 0x0F, 0xA5, 
+    0x02, 0x9F, 0x0E, 0x87, 0x66, 0xB4, 0x0E, 0x75, 0x2C, 0x14, 0x71, 0x37, 0xF3, 0xE9, 0xCE, 0xEF, 0x03, 0xD7, 0xFC, 0x40, 
+    0x98, 0x42, 0x0B, 0xC1, 0xBB, 0xC6, 0x85, 0xD2, 0x05, 0x0E, 0x84, 0x94, 0x70, 0xDA, 0x9B, 0x96, 0x60, 0x51, 0x4C, 0x2F, 
+    0xBD, 0x41, 0xA4, 0xA8, 0x6E, 0xA6, 0xEA, 0x2D, 0x18, 0xED, 0x99, 0x52, 0x88, 0xF1, 0x8F, 0xA6, 0xE2, 0x22, 0xAB, 0x0C, 
+    0xB2, 0x80, 0xA8, 0xCF, 0x64, 0xB2, 0x6E, 0x62, 0x7A, 0x39, 0x61, 0xCD, 0x1C, 0xDC, 0x62, 0x4F, 0x46, 0xE6, 0xE4, 0xC1, 
+    0x85, 0x35, 0x3C, 0xCC, 0x39, 0x22, 0xBA, 0xD5, 0x3C, 0xB7, 0x12, 0x14, 0xF1, 0x62, 0xE5, 0x82, 0xB9, 0x42, 0x10, 0x30, 
+    0x2A, 0x41, 0xE4, 0x82, 0x15, 0x8A, 0x88, 0xFB, 0xEE, 0xDA, 0x16, 0x09, 0x14, 0xD3, 0x13, 0xB5, 0x0F, 0xA7, 0xA7, 0x3F, 
+    0xB0, 0x2F, 0xBD, 0x77, 0xB5, 0xAA, 0xBE, 0x48, 0xFD, 0xBC, 0x34, 0x68, 0x0B, 0x10, 0x84, 0xB5, 0x88, 0x50, 0x4E, 0xF9, 
+    0x74, 0xDE, 0xBA, 0xED, 0x76, 0x0A, 0xC7, 0xC1, 0x6D, 0xAD, 0x96, 0x22, 0xCE, 0xB4, 0x58, 0x28, 0x77, 0x64, 0x42, 0x90, 
+    0xFC, 0x89, 0xB8, 0xB5, 0x7F, 0x7C, 0x4A, 0x52, 0xA7, 0x95, 0xC6, 0x00, 0xBC, 0x96, 0xD4, 0x96, 0x19, 0x48, 0x63, 0x3D, 
+    0x4D, 0x5E, 0x28, 0x75, 0x95, 0x92, 0x35, 0x47, 0xF1, 0xF4, 0xC7, 0xB4, 0xEA, 0xE2, 0xE2, 0x7B, 0x7D, 0x9D, 0x92, 0x96, 
+    0xAA, 0x52, 0xF1, 0x37, 0xC9, 0x8E, 0xF9, 0x2E, 0xBF, 0xAF, 0x72, 0x42, 0x3B, 0x67, 0x08, 0x0D, 0xD6, 0x0F, 0x82, 0xAE, 
+    0x9F, 0x8B, 0xAB, 0x5D, 0xC2, 0xCA, 0x41, 0x98, 0x96, 0x75, 0xFE, 0x94, 0xBA, 0x86, 0x64, 0x06, 0x32, 0xC6, 0x51, 0xC6, 
+    0x2E, 0x26, 0x63, 0x4F, 0xD0, 0x21, 0xC2, 0x76, 0xC9, 0xD9, 0xE1, 0x05, 0xF1, 0x47, 0xA1, 0xC7, 0x38, 0x5E, 0xF8, 0x93, 
+    0x0B, 0x8E, 0x30, 0xDD, 0x1F, 0x7C, 0xC4, 0x1E, 0xCD, 0xA2, 0x17, 0x81, 0x46, 0xA5, 0x5A, 0xAB, 0xD0, 0x9F, 0x74, 0x6D, 
+    0xC4, 0x8D, 0xAC, 0xFB, 0x86, 0x1D, 0xE6, 0xF6, 0x61, 0xDC, 0xAE, 0xF2, 0xD8, 0xB7, 0x95, 0x9A, 0xBC, 0x67, 0x65, 0x74, 
+    0x0E, 0x8D, 0x7E, 0xBD, 0x4A, 0x19, 0x53, 0x77, 0xA7, 0x99, 0x5F, 0x77, 0x94, 0xB3, 0x23, 0x0C, 0x37, 0x3A, 0xA8, 0x8B, 
+    0x11, 0x48, 0x38, 0xBD, 0x68, 0xAB, 0xB9, 0x4C, 0xEC, 0x34, 0x7A, 0xFD, 0xCE, 0x9A, 0xCD, 0xC4, 0x4F, 0xCA, 0x19, 0xFD, 
+    0xB9, 0xB6, 0x4A, 0xC8, 0x19, 0xB9, 0x33, 0x96, 0xB8, 0x32, 0x92, 0x30, 0xA9, 0x9E, 0x22, 0xE3, 0xC8, 0xF0, 0xA5, 0x0E, 
+    0x51, 0x4E, 0x70, 0x54, 0x92, 0x4D, 0x95, 0x18, 0x26, 0x36, 0x8B, 0x87, 0x2B, 0x85, 0x31, 0xB3, 0x6B, 0xFD, 0x4B, 0x04, 
+    0x05, 0xD7, 0x14, 0x2F, 0x23, 0x9F, 0x22, 0xFA, 0x8B, 0x74, 0x6A, 0x4C, 0xBB, 0xA2, 0x7F, 0xE9, 0x7C, 0x65, 0x6A, 0xC8, 
+    0xA0, 0x79, 0x97, 0xC9, 0x2D, 0xEC, 0x9D, 0x49, 0x31, 0xC8, 0x41, 0x9C, 0xFB, 0x4E, 0x7F, 0x0C, 0x61, 0x8E, 0xB8, 0x86, 
+    0x05, 0xDF, 0xE9, 0x96, 0x15, 0x14, 0x91, 0x73, 0xE2, 0xC3, 0xBD, 0xB1, 0x8D, 0x15, 0x59, 0x74, 0x0D, 0xB0, 0x41, 0x54, 
+    0xD1, 0x06, 0x5A, 0xB8, 0x21, 0x0A, 0x98, 0xB7, 0x75, 0xD5, 0x36, 0xB7, 0x5B, 0xED, 0x76, 0xCB, 0x30, 0x5B, 0x55, 0x66, 
+    0xD5, 0x62, 0x58, 0xC3, 0xB5, 0xF2, 0x58, 0x3D, 0x9D, 0xD9, 0x0A, 0x76, 0x75, 0xEC, 0x4B, 0xEF, 0xC2, 0x0B, 0xE1, 0x16, 
+    0xE1, 0xA0, 0xA8, 0xDE, 0x6F, 0xEF, 0x16, 0x29, 0x9D, 0xF5, 0x4F, 0x19, 0x1D, 0x11, 0x8B, 0x25, 0xFB, 0x0E, 0xE4, 0x68, 
+    0x04, 0xB3, 0xF9, 0xFC, 0x3B, 0xDD, 0x16, 0x5E, 0xE7, 0xC5, 0xC3, 0x9F, 0x37, 0xAB, 0x7B, 0xF3, 0xFC, 0x9A, 0xA5, 0x9E, 
+    0x12, 0xB6, 0xC0, 0x9E, 0x0B, 0xF4, 0x86, 0x60, 0xAE, 0x5F, 0xDA, 0xB7, 0x55, 0x59, 0x81, 0x50, 0x14, 0xFC, 0x40, 0xA7, 
+    0xE5, 0x72, 0x8B, 0x47, 0x82, 0x87, 0xD5, 0x3D, 0x3F, 0xFD, 0xF6, 0x15, 0xBC, 0xF7, 0xF1, 0x13, 0x44, 0x70, 0x70, 0x01, 
+    0x45, 0x5D, 0xFB, 0x9E, 0x5D, 0x8C, 0x3D, 0x09, 0xAF, 0xE9, 0x85, 0x25, 0xFF, 0x18, 0x7B, 0xE6, 0x89, 0x66, 0x8E, 0xA7, 
+    0x5D, 0x5E, 0xE0, 0xF0, 0xE3, 0x71, 0xDE, 0x66, 0x6D, 0x28, 0x66, 0x83, 0x1F, 0xD6, 0x74, 0x41, 0xFF, 0xAB, 0xF6, 0x9E, 
+    0x18, 0x46, 0xD7, 0x51, 0x83, 0xAC, 0x07, 0x33, 0x9C, 0x59, 0x41, 0x0A, 0x9F, 0x3C, 0x0C, 0x85, 0xDC, 0xD1, 0xE1, 0x74, 
+    0xC4, 0x26, 0xFF, 0xCE, 0x7B, 0xF4, 0x03, 0xEE, 0xA6, 0xA6, 0x81, 0xA8, 0xA1, 0x9B, 0x45, 0x24, 0x10, 0x61, 0x31, 0x96, 
+    0x79, 0x9D, 0x8E, 0x4A, 0x69, 0x85, 0x15, 0x30, 0x00, 0xDE, 0x69, 0x89, 0xBD, 0x19, 0x3F, 0x5A, 0xE7, 0x4A, 0x04, 0xA9, 
+    0x13, 0xBE, 0x76, 0x80, 0x9E, 0x00, 0x74, 0xCC, 0xE2, 0x22, 0x9C, 0x51, 0x85, 0x7C, 0x1D, 0x65, 0x63, 0xA3, 0x3A, 0x91, 
+    0x28, 0x39, 0xE6, 0x64, 0x11, 0xFD, 0x4D, 0xA3, 0xC9, 0x2C, 0x10, 0xF3, 0x41, 0xBF, 0x80, 0x8A, 0xE3, 0x45, 0xF0, 0xBC, 
+    0x20, 0x94, 0xD8, 0x75, 0xA0, 0xD5, 0xEC, 0x2A, 0x88, 0xCE, 0x88, 0xEA, 0x5F, 0x32, 0x74, 0x78, 0x12, 0x43, 0xA3, 0xC3, 
+    0xE2, 0x7C, 0x8D, 0xA7, 0xCC, 0xA7, 0x0E, 0xBB, 0xFB, 0xE2, 0x62, 0x02, 0x4A, 0x32, 0x0F, 0x59, 0x37, 0x62, 0x3C, 0xDB, 
+    0x64, 0xC8, 0x81, 0xE1, 0xE5, 0x30, 0xEA, 0xB3, 0xB0, 0xD4, 0x3A, 0x67, 0x2E, 0x19, 0x72, 0x78, 0xBA, 0xF0, 0x31, 0xAC, 
+    0x88, 0xC6, 0x3F, 0x2D, 0x36, 0xF0, 0xB0, 0xA0, 0x3A, 0x3E, 0xE6, 0x64, 0x5B, 0x9B, 0x13, 0xA0, 0xE8, 0x8C, 0xFD, 0x86, 
+    0xEF, 0xD8, 0x8C, 0x38, 0xC7, 0x81, 0xC5, 0xAE, 0xC0, 0xB8, 0xBC, 0x09, 0xE5, 0x7A, 0x8D, 0x1B, 0x6D, 0x06, 0xAA, 0xF0, 
+    0x1D, 0x84, 0x63, 0x63, 0xB5, 0xAD, 0x85, 0xC4, 0xFB, 0xD7, 0x59, 0x43, 0xC5, 0xEF, 0x59, 0xED, 0xEA, 0xDA, 0x22, 0x22, 
+    0xA8, 0x59, 0xD2, 0x3E, 0x6E, 0x37, 0x4B, 0x68, 0x90, 0x78, 0xA1, 0x1A, 0x6F, 0x41, 0xE1, 0x99, 0x0E, 0xC6, 0xCD, 0x22, 
+    0x99, 0xEB, 0x75, 0x65, 0x6A, 0xE7, 0x75, 0xCA, 0x99, 0x5E, 0xA7, 0x8C, 0x79, 0x3C, 0xAD, 0x23, 0x9E, 0xC5, 0x7E, 0x05, 
+    0x09, 0x8D, 0xB5, 0x95, 0x68, 0x5F, 0xF4, 0x9D, 0x69, 0xA5, 0x68, 0x56, 0x33, 0x78, 0x82, 0x84, 0xC5, 0x77, 0xC8, 0x26, 
+    0x37, 0xE5, 0x55, 0xDE, 0xD0, 0x13, 0x9E, 0x99, 0x88, 0x39, 0xC1, 0xD9, 0xA3, 0xC6, 0x95, 0x9B, 0x33, 0xBC, 0xA8, 0x8E, 
+    0x8B, 0x5C, 0xFB, 0xDE, 0x2C, 0xFE, 0x4E, 0x63, 0xD3, 0x66, 0xCC, 0x29, 0x02, 0x45, 0x71, 0xE0, 0xE4, 0x9C, 0x05, 0xB1, 
+    0x90, 0xF7, 0x94, 0xEF, 0xEF, 0xA9, 0x6A, 0x4A, 0x23, 0x7E, 0x36, 0x73, 0x71, 0x08, 0x42, 0xFB, 0x6C, 0x7D, 0x03, 0x6C, 
+    0x5B, 0xFA, 0x21, 0xEE, 0xC2, 0xF2, 0xD3, 0x53, 0x3E, 0x53, 0xCC, 0x82, 0x32, 0x19, 0x41, 0xDF, 0x63, 0x8D, 0x8E, 0x73, 
+    0xF5, 0xDF, 0x38, 0x6A, 0xE0, 0x0E, 0x2C, 0x08, 0xFB, 0x81, 0xF6, 0x30, 0xA3, 0xB1, 0x9D, 0x01, 0x0E, 0x9E, 0x1E, 0x2B, 
+    0x0E, 0x6B, 0xC1, 0xD7, 0xBA, 0x2B, 0xDF, 0xEA, 0xF9, 0x01, 0x11, 0x55, 0x95, 0x89, 0xC6, 0x35, 0x11, 0xA9, 0x76, 0x7F, 
+    0xA8, 0x21, 0x4D, 0xBF, 0x06, 0x7C, 0x5B, 0x1B, 0xF7, 0xFA, 0x17, 0xCF, 0x9D, 0xF5, 0x16, 0xF6, 0xA0, 0xF7, 0xEC, 0x82, 
+    0x8E, 0x12, 0x2F, 0x4C, 0x19, 0xE5, 0x7B, 0x5E, 0x63, 0x86, 0xEC, 0x79, 0x61, 0xA0, 0x37, 0xAF, 0x89, 0x65, 0xD9, 0xA6, 
+    0xBF, 0x84, 0x97, 0x34, 0x88, 0x3D, 0x66, 0x77, 0x7C, 0x2B, 0xE6, 0xEB, 0x5E, 0xF4, 0xFB, 0xCF, 0x61, 0x3A, 0x8A, 0x06, 
+    0x08, 0x65, 0xB0, 0xBC, 0x50, 0xBA, 0x46, 0x60, 0x68, 0x9F, 0x3C, 0x6F, 0x90, 0xE9, 0xA8, 0xDD, 0xCA, 0x4F, 0x2F, 0xA3, 
+    0x0B, 0x2D, 0x3E, 0x83, 0xEC, 0xD8, 0xD3, 0x2A, 0xE2, 0xB0, 0xDB, 0x28, 0xB5, 0xAE, 0xBF, 0x91, 0x7B, 0x67, 0xC8, 0x8B, 
+    0x6A, 0xCA, 0x97, 0x1C, 0x07, 0xBC, 0x61, 0xA4, 0x24, 0x2D, 0x19, 0x32, 0x3A, 0xE5, 0x98, 0x02, 0x9D, 0xBC, 0x9C, 0x25, 
+    0xDF, 0x74, 0x26, 0xFA, 0xA6, 0x54, 0x8C, 0xAE, 0x34, 0x47, 0x8B, 0x39, 0x86, 0xE7, 0xD9, 0x6E, 0xA1, 0x43, 0x03, 0xDA, 
+    0x55, 0x74, 0xB9, 0xFE, 0xAF, 0x53, 0x22, 0x03, 0x5A, 0x64, 0x67, 0xAA, 0x75, 0x75, 0xD3, 0x12, 0xA0, 0x9F, 0x2C, 0xA7, 
+    0x25, 0x41, 0xCF, 0xCF, 0x0C, 0xC3, 0xF5, 0x97, 0x54, 0x0D, 0x13, 0x43, 0xD7, 0x49, 0x64, 0xB7, 0x32, 0xA2, 0x64, 0x79, 
+    0xBF, 0xAE, 0xD9, 0x73, 0x9A, 0x65, 0xC3, 0x96, 0xD3, 0xA3, 0x66, 0xD5, 0x35, 0x49, 0x76, 0x38, 0xBE, 0x4F, 0x93, 0x2E, 
+    0x76, 0xAA, 0xE8, 0xF3, 0x86, 0xAE, 0xE6, 0x87, 0x55, 0xFD, 0xE5, 0x8B, 0xF2, 0xA7, 0x03, 0xD0, 0x7E, 0x23, 0xDA, 0x76, 
+    0x9C, 0x39, 0x7E, 0x38, 0x43, 0x38, 0x72, 0xFD, 0x48, 0xDB, 0x3E, 0x15, 0x54, 0xF3, 0x9B, 0x61, 0x3E, 0x42, 0xF5, 0x63, 
+    0xFA, 0xDD, 0xEF, 0xE9, 0xEF, 0xD9, 0x0B, 0xFE, 0xED, 0x3B, 0xEC, 0xF2, 0x41, 0xFD, 0xD9, 0xD1, 0x84, 0xF2, 0x6B, 0x3D, 
+    0x03, 0xFE, 0x8E, 0x7E, 0x4C, 0x83, 0xBA, 0xF6, 0x6C, 0x1D, 0x61, 0x1F, 0x57, 0x16, 0xAB, 0x5D, 0x79, 0x60, 0x20, 0x20, 
+    0xC9, 0x39, 0x7E, 0x72, 0x19, 0xCB, 0x58, 0x86, 0x9B, 0x6B, 0x02, 0xD3, 0x89, 0x3E, 0x5C, 0x68, 0xD6, 0x66, 0x3C, 0x4C, 
+    0x89, 0x0B, 0x19, 0xD9, 0x2D, 0x8F, 0x37, 0x39, 0x6A, 0xCD, 0x50, 0xC6, 0x87, 0x8A, 0x9E, 0x2E, 0x87, 0x5D, 0x77, 0xAE, 
+    0x9C, 0x14, 0x2B, 0x5C, 0x98, 0x43, 0xF4, 0x00, 0xAD, 0x37, 0xD5, 0x8C, 0xAC, 0x0A, 0xDF, 0x64, 0x53, 0x22, 0xA7, 0x9A, 
+    0x18, 0xEE, 0x1F, 0x5A, 0xBD, 0x94, 0x55, 0x8B, 0x88, 0x47, 0x2F, 0x8E, 0xE7, 0x81, 0xA5, 0xFD, 0x6A, 0x32, 0x99, 0xB7, 
+    0x05, 0x5D, 0x24, 0x54, 0xB5, 0x82, 0x8A, 0x94, 0x1B, 0x06, 0x56, 0x07, 0x82, 0x45, 0xC3, 0xBE, 0x56, 0x27, 0x46, 0x03, 
+    0xE6, 0xB9, 0x6E, 0xE2, 0xFF, 0x83, 0x34, 0x12, 0x2F, 0xE4, 0xD7, 0x94, 0x33, 0xAF, 0x52, 0x94, 0xA3, 0x68, 0x96, 0xDC, 
+    0xFE, 0x3F, 0x2B, 0xAC, 0x94, 0x11, 0x21, 0x17, 0xF7, 0xF4, 0xA1, 0xF4, 0x7F, 0x47, 0x47, 0xFE, 0x6C, 0xE7, 0xE4, 0x23, 
+    0x42, 0xF7, 0xCD, 0x7D, 0x51, 0x2C, 0xA3, 0x7F, 0xA6, 0xCA, 0xCD, 0x17, 0x11, 0x51, 0xBA, 0x24, 0x50, 0xBC, 0xE3, 0xC8, 
+    0x3A, 0xF4, 0x11, 0xE5, 0xC2, 0xB6, 0xE0, 0x83, 0x5A, 0x6B, 0x55, 0x42, 0x11, 0x29, 0xEB, 0xA5, 0x38, 0xCA, 0x8C, 0x33, 
+    0x84, 0x2D, 0xC4, 0xFA, 0x20, 0x3D, 0xB6, 0xF7, 0x8C, 0xBD, 0xC5, 0x0D, 0x83, 0xE8, 0x43, 0x46, 0xA9, 0x71, 0xC4, 0x96, 
+    0x6C, 0x76, 0x46, 0xE7, 0xF7, 0x5E, 0x1E, 0x32, 0x76, 0xEB, 0x29, 0x95, 0x2C, 0xF3, 0x28, 0x97, 0xC7, 0x3B, 0xEA, 0x07, 
+    0x3B, 0x39, 0x75, 0xC9, 0x9E, 0x6C, 0x14, 0x83, 0x75, 0x05, 0xD1, 0xF3, 0x1F, 0x44, 0x69, 0xDC, 0x6D, 0x9A, 0x0A, 0x70, 
+    0x32, 0xB8, 0xB5, 0x80, 0xBD, 0xED, 0x65, 0xE9, 0x14, 0x19, 0x07, 0x00, 0x1C, 0xAC, 0xF2, 0x5F, 0xAD, 0xF5, 0xED, 0x96, 
+    0x29, 0x7D, 0xF0, 0xDB, 0xEF, 0x07, 0xB5, 0xB9, 0x5B, 0x36, 0x9D, 0xF6, 0xD0, 0x69, 0xFF, 0x9E, 0xC6, 0x24, 0x65, 0x45, 
+    0xA3, 0x8F, 0xDC, 0xC9, 0xE8, 0xE5, 0x77, 0x1B, 0xF6, 0x43, 0x07, 0x0D, 0x7B, 0x9E, 0xB6, 0xA1, 0x33, 0x85, 0x23, 0xA3, 
+    0xEF, 0x5B, 0xCF, 0xFD, 0x3C, 0x51, 0x7D, 0x75, 0xD1, 0xFE, 0x2D, 0x08, 0x8D, 0x92, 0x30, 0xCD, 0xAA, 0x6F, 0xE6, 0xF2, 
+    0xAC, 0x9C, 0xF3, 0x80, 0xCE, 0x8F, 0xF2, 0xAD, 0x5A, 0xC9, 0x76, 0x57, 0xAC, 0xB5, 0x22, 0xA2, 0x9B, 0x54, 0x2A, 0x64, 
+    0x89, 0xC7, 0x76, 0x53, 0xBF, 0xD1, 0x28, 0xE3, 0x5B, 0x06, 0x9A, 0x49, 0xFE, 0xFB, 0xCE, 0x99, 0xB4, 0xDF, 0x95, 0xE8, 
+    0x33, 0xA9, 0x06, 0xA4, 0x3A, 0x00, 0xE9, 0x7E, 0x53, 0x6E, 0x7D, 0xD1, 0x93, 0xB5, 0x56, 0xAF, 0x9D, 0xF4, 0x7A, 0x41, 
+    0xEA, 0x1E, 0x88, 0xD1, 0xEB, 0x61, 0x22, 0x4B, 0x02, 0x7D, 0x44, 0xBC, 0x1B, 0x71, 0x8A, 0xD6, 0x19, 0x71, 0xD2, 0x4C, 
+    0xCE, 0xD8, 0x70, 0x1C, 0x7E, 0xA2, 0x43, 0x71, 0x71, 0x3A, 0x0E, 0x4A, 0x78, 0xB3, 0x94, 0x1B, 0x4E, 0x50, 0xD5, 0x71, 
+    0x4A, 0x74, 0x49, 0x58, 0x6D, 0xA6, 0x7E, 0xFA, 0xB3, 0xE6, 0xD4, 0x03, 0x4F, 0xA7, 0xAD, 0xBF, 0x91, 0x82, 0x48, 0x95, 
+    0xD5, 0xDE, 0xF9, 0x2D, 0xDD, 0x73, 0xA8, 0x61, 0x5D, 0xAE, 0x4A, 0xF4, 0xEA, 0xC4, 0xA0, 0x44, 0x94, 0x95, 0xEE, 0x83, 
+    0x07, 0xBB, 0xEF, 0x26, 0xBC, 0xAF, 0xEA, 0xBD, 0x66, 0x06, 0xED, 0xFE, 0x60, 0x17, 0x46, 0xAF, 0x9F, 0xF5, 0x74, 0x1C, 
+    0xB5, 0x24, 0xE3, 0x7A, 0x98, 0xBD, 0x26, 0xD5, 0x3C, 0xCF, 0x71, 0x8F, 0x5D, 0x76, 0x8F, 0x13, 0x2A, 0x3A, 0xE3, 0x6D, 
+    0x8D, 0x1B, 0x8F, 0x8C, 0x8C, 0x44, 0x9E, 0x70, 0x74, 0x27, 0x9B, 0xD6, 0x68, 0xEC, 0x34, 0xC3, 0x40, 0x2F, 0x2D, 0xDF, 
+    0x7A, 0x1F, 0x9F, 0xB1, 0x54, 0x2A, 0x5B, 0xD1, 0xD2, 0x3D, 0xE7, 0xC7, 0xEF, 0xBF, 0x0A, 0xCE, 0x5F, 0x70, 0xCD, 0xE3, 
+    0x87, 0xA8, 0x01, 0x74, 0xCA, 0xAE, 0x04, 0xA4, 0xD9, 0x00, 0xA1, 0x67, 0xA9, 0xFA, 0x95, 0x8E, 0x92, 0x4C, 0x62, 0xEA, 
+    0x09, 0xE2, 0xDF, 0x03, 0x27, 0xEF, 0x81, 0x89, 0x11, 0x4A, 0x2F, 0xCD, 0x6A, 0xA2, 0xE1, 0x38, 0xD4, 0xD2, 0xE1, 0x7D, 
+    0x60, 0x24, 0xC9, 0xA2, 0x40, 0x52, 0x8A, 0x93, 0x33, 0xAA, 0xAF, 0x0C, 0x69, 0x4B, 0x95, 0xE4, 0x59, 0x34, 0x9C, 0x65, 
+    0x23, 0x55, 0x64, 0xD1, 0x93, 0xF7, 0xDC, 0x0B, 0x87, 0xC7, 0xBC, 0xB7, 0x18, 0xBB, 0x12, 0x60, 0xEE, 0x32, 0x90, 0xB5, 
+    0x20, 0x4C, 0x3A, 0x58, 0x33, 0x23, 0x97, 0xD3, 0xF7, 0xFF, 0xC3, 0x0F, 0x47, 0x35, 0x84, 0x99, 0x94, 0x08, 0x93, 0x8E, 
+    0xEA, 0xDA, 0x27, 0x11, 0xD3, 0x75, 0x98, 0xCF, 0xE9, 0x42, 0x00, 0x6A, 0x2A, 0x14, 0xF0, 0xCF, 0x34, 0xFC, 0x04, 0x50, 
+    0xE8, 0xBB, 0x20, 0xA6, 0xFC, 0x05, 0x1F, 0xF5, 0x44, 0xBA, 0x4F, 0xA8, 0x21, 0x14, 0x83, 0xAD, 0x1C, 0xA1, 0x68, 0xBC, 
+    0x52, 0x77, 0x0A, 0x8E, 0xC4, 0x31, 0x89, 0xBA, 0xB0, 0x08, 0x1D, 0xE4, 0xAB, 0x13, 0xB6, 0x2B, 0xF4, 0x70, 0x65, 0x3D, 
+    0x39, 0x8F, 0xA6, 0xCA, 0xC0, 0xA5, 0xA9, 0x57, 0x4D, 0xBA, 0x63, 0xA3, 0x85, 0x3F, 0x05, 0xDF, 0x3D, 0x35, 0x63, 0x3B, 
+    0x47, 0x67, 0x60, 0x8B, 0x30, 0x3D, 0x3D, 0x3D, 0x3B, 0x9B, 0x95, 0xE1, 0xD7, 0x59, 0x4B, 0x22, 0xD3, 0xA7, 0x48, 0x77, 
+    0xB2, 0xDF, 0xA3, 0x2D, 0x44, 0x01, 0x95, 0xD3, 0x02, 0xA1, 0x81, 0xE9, 0x04, 0x01, 0xDF, 0x1D, 0x4F, 0xBA, 0x15, 0xFE, 
+    0x3B, 0xEC, 0xE2, 0x2F, 0x14, 0xCC, 0x46, 0x8E, 0x8E, 0xE0, 0x38, 0x2B, 0x0F, 0x7C, 0x02, 0xE5, 0x37, 0xB3, 0x05, 0xDC, 
+    0x7C, 0xBA, 0x07, 0xF4, 0x33, 0xE3, 0x02, 0x88, 0xA8, 0xA6, 0x67, 0x69, 0xA4, 0x7D, 0xD3, 0x96, 0x52, 0xB8, 0x49, 0x56, 
+    0x8D, 0xA8, 0xFC, 0xA4, 0x6F, 0x42, 0x09, 0x4E, 0x61, 0x66, 0xC1, 0xD1, 0x28, 0x45, 0x7A, 0x49, 0xD4, 0x5C, 0x31, 0x28, 
+    0xBA, 0xD1, 0x8B, 0xB3, 0x34, 0xC8, 0xA2, 0x37, 0xB0, 0xF0, 0xCB, 0x87, 0x46, 0xD0, 0xD8, 0x45, 0xD8, 0x85, 0x61, 0x29, 
+    0x32, 0xA4, 0xD7, 0xC4, 0x32, 0xC6, 0xAC, 0x82, 0x6A, 0x98, 0x81, 0x5C, 0x5F, 0x7C, 0xC1, 0xE2, 0xB5, 0xEC, 0xC6, 0x34, 
+    0x33, 0xD4, 0x99, 0x63, 0x65, 0x16, 0xF9, 0x45, 0xC6, 0xAC, 0xF1, 0x70, 0x14, 0x98, 0x30, 0x03, 0x94, 0x42, 0x10, 0x37, 
+    0x02, 0xC4, 0x40, 0x9E, 0x6A, 0xA2, 0x32, 0x0C, 0x26, 0x3A, 0x50, 0x04, 0x2D, 0x30, 0x26, 0x70, 0x3C, 0x12, 0xEC, 0x9F, 
+    0x81, 0xB2, 0xB2, 0x22, 0x3A, 0xA7, 0xC1, 0x59, 0x76, 0xC4, 0xB0, 0x59, 0x1B, 0xB4, 0x6A, 0x2D, 0x6B, 0xA2, 0x10, 0xD7, 
+    0x96, 0xF1, 0xB9, 0xAD, 0x08, 0x82, 0x7E, 0x00, 0x75, 0xE8, 0x44, 0x76, 0x44, 0x64, 0x6D, 0x6C, 0x35, 0x2F, 0x20, 0x2E, 
+    0x86, 0xB7, 0x0B, 0x07, 0x2C, 0xAA, 0x07, 0x68, 0xE7, 0x30, 0xF3, 0x5A, 0x7D, 0x66, 0x4A, 0xEB, 0xCE, 0x1F, 0xE1, 0xFB, 
+    0xAB, 0x7C, 0x61, 0xBB, 0xBA, 0xA9, 0x13, 0x3A, 0x5D, 0xB9, 0x2F, 0xAE, 0xF2, 0x60, 0x59, 0x66, 0xBF, 0x9F, 0x81, 0xD0, 
+    0x52, 0x65, 0x4A, 0xB7, 0xAB, 0x96, 0xBD, 0x64, 0x7E, 0x9F, 0x3C, 0x6E, 0x5D, 0x80, 0x68, 0x4B, 0x2B, 0x0B, 0x9D, 0x9D, 
+    0xA9, 0x32, 0xEE, 0x3C, 0x77, 0xD5, 0xEA, 0xC3, 0x4F, 0xAB, 0xB1, 0xDC, 0xD9, 0x79, 0x62, 0xDD, 0x50, 0xC5, 0x37, 0x42, 
+    0x01, 0x5C, 0x8B, 0xD1, 0xDE, 0x11, 0xC9, 0x00, 0xDF, 0x91, 0x31, 0x43, 0x06, 0x4F, 0xB3, 0xE3, 0x39, 0x1D, 0xF1, 0xC3, 
+    0xB5, 0x7D, 0x56, 0xE5, 0xE3, 0x4F, 0xCE, 0xF3, 0xCF, 0x23, 0x31, 0x28, 0xAC, 0xC9, 0x03, 0xD4, 0x3C, 0xB2, 0x11, 0xAA, 
+    0xAF, 0x63, 0x67, 0xF2, 0xDD, 0x1B, 0x96, 0xFD, 0x1E, 0x7A, 0xA8, 0xE5, 0x6D, 0x47, 0x78, 0xAD, 0x34, 0x3F, 0x85, 0x62, 
+    0x73, 0x73, 0x11, 0xE1, 0x72, 0xED, 0x22, 0x3F, 0x0C, 0x58, 0x7E, 0x2B, 0x59, 0x59, 0x55, 0xF3, 0x5B, 0x04, 0x12, 0xF9, 
+    0x3A, 0x79, 0xA4, 0x5D, 0xC5, 0x01, 0xD3, 0xB9, 0x0E, 0xDA, 0xD8, 0xD5, 0xFA, 0xE3, 0xB5, 0x66, 0x5B, 0xC3, 0x75, 0x79, 
+    0x59, 0x53, 0x61, 0xE0, 0xD8, 0x68, 0xC8, 0x0C, 0x8D, 0x43, 0x95, 0xD9, 0xA9, 0xB0, 0x97, 0x6C, 0x4D, 0x3D, 0x51, 0xC8, 
+    0x8D, 0xDB, 0xD6, 0xCB, 0x29, 0x5D, 0xD6, 0x0A, 0xCD, 0x09, 0x67, 0x2A, 0xDD, 0x2F, 0x17, 0xEE, 0x97, 0x9F, 0xDD, 0x2F, 
+    0x2F, 0x46, 0x87, 0xC0, 0x71, 0xF2, 0xC0, 0x96, 0xE9, 0xF0, 0xF1, 0x91, 0x8F, 0xE8, 0x14, 0x11, 0x64, 0x5A, 0x88, 0xB1, 
+    0xA5, 0x09, 0x79, 0x8B, 0x4F, 0x8C, 0x35, 0x3D, 0x39, 0x5E, 0x30, 0x8B, 0x10, 0x01, 0x10, 0xFE, 0xBB, 0x8D, 0x31, 0x96, 
+    0x02, 0xF2, 0x56, 0xDE, 0x07, 0x5C, 0x4E, 0x9E, 0x69, 0xCA, 0x10, 0x30, 0x6C, 0xE3, 0xF8, 0xE4, 0xDE, 0x40, 0x61, 0x1A, 
+    0x22, 0xED, 0xD9, 0xF2, 0xAE, 0x18, 0xDC, 0xC2, 0x69, 0xEC, 0x0A, 0x2E, 0xC6, 0x37, 0xA7, 0xA7, 0x1B, 0xE6, 0x11, 0x4B, 
+    0x86, 0x29, 0xD7, 0xD1, 0xF1, 0xAE, 0xA3, 0xD2, 0x12, 0xA7, 0x1E, 0xFE, 0x6E, 0x15, 0x04, 0xCE, 0x1A, 0xFB, 0x0E, 0x90, 
+    0xD4, 0x61, 0x41, 0x42, 0xC5, 0x99, 0x75, 0xBA, 0x16, 0x9B, 0xF2, 0xA7, 0x4D, 0x6C, 0x16, 0x82, 0xE6, 0x61, 0xC3, 0x91, 
+    0xE3, 0x36, 0x3D, 0x49, 0x09, 0xC2, 0xB6, 0x6D, 0xAE, 0x10, 0x11, 0x05, 0xD2, 0x37, 0x93, 0x2D, 0xEA, 0xDC, 0x06, 0xEA, 
+    0x36, 0x86, 0x06, 0xB9, 0xE1, 0x83, 0x96, 0xBD, 0x1C, 0x1A, 0xE2, 0xAE, 0x4F, 0x34, 0x7C, 0x35, 0x6C, 0x91, 0x6A, 0x7E, 
+    0x17, 0x42, 0xB0, 0x11, 0xB6, 0xCF, 0xA2, 0x16, 0x13, 0x1E, 0xF8, 0x64, 0x15, 0xB8, 0x0C, 0xE5, 0x0A, 0x92, 0xBD, 0x83, 
+    0xB3, 0x92, 0xAB, 0x60, 0x12, 0x11, 0x52, 0xBD, 0x8D, 0x31, 0x97, 0x61, 0x9F, 0x58, 0xA0, 0x25, 0x21, 0x5C, 0x7C, 0xA1, 
+    0x35, 0xF0, 0x91, 0x08, 0x81, 0x28, 0xD3, 0xD2, 0xB7, 0xEC, 0x7B, 0x04, 0x07, 0x8F, 0x49, 0xD1, 0xBF, 0xCE, 0x6D, 0x0C, 
+    0xE1, 0x17, 0xB3, 0xB5, 0xF1, 0x86, 0xF3, 0xA0, 0xE2, 0x95, 0xE4, 0x3A, 0x6B, 0x09, 0x3A, 0x54, 0x3A, 0x47, 0x49, 0x04, 
+    0x2F, 0xBB, 0x82, 0xD3, 0x8C, 0x29, 0x00, 0x81, 0x26, 0x84, 0x7E, 0x51, 0x25, 0x0B, 0x3E, 0x96, 0xEB, 0x16, 0x8E, 0xF3, 
+    0x2A, 0x1F, 0x23, 0xC8, 0x09, 0x68, 0x0B, 0xE9, 0x60, 0xEE, 0xEC, 0x8A, 0x7E, 0x6C, 0xC2, 0x27, 0x22, 0x43, 0x4D, 0x9E, 
+    0x9A, 0x8B, 0x00, 0x55, 0x24, 0x19, 0x2C, 0x43, 0xC5, 0x51, 0x3F, 0xD1, 0xA6, 0xCA, 0x90, 0x74, 0xDA, 0xB2, 0xF9, 0xA8, 
+    0xEC, 0xE6, 0x38, 0x90, 0xDE, 0x22, 0x34, 0x85, 0x89, 0x46, 0x43, 0xDC, 0x3D, 0x3D, 0x15, 0x1A, 0x02, 0xD1, 0xE1, 0xA8, 
+    0x28, 0xC7, 0x7D, 0xD3, 0x3C, 0x46, 0xF8, 0x5C, 0xCA, 0x33, 0x63, 0xB0, 0x83, 0x13, 0xE0, 0x55, 0x31, 0x2E, 0x36, 0x1B, 
+    0x04, 0x01, 0x68, 0xD9, 0xCC, 0xBA, 0x27, 0x33, 0xA6, 0x2A, 0x0E, 0x1C, 0x45, 0xB3, 0xA2, 0x1D, 0x5E, 0x04, 0x26, 0x80, 
+    0xF1, 0xC0, 0x9C, 0x8D, 0x69, 0xF4, 0x8C, 0xB0, 0x2B, 0x0E, 0x7F, 0xE2, 0xE1, 0x9C, 0x9B, 0xCC, 0x6B, 0x59, 0x37, 0x90, 
+    0x01, 0xDD, 0x6B, 0xCB, 0x5B, 0x9D, 0x09, 0xD9, 0x75, 0x5E, 0xA6, 0x80, 0xE6, 0x18, 0x47, 0x17, 0x67, 0x39, 0xDF, 0x67, 
+    0xCF, 0xA2, 0xEB, 0xDE, 0x0E, 0x14, 0x5A, 0x69, 0x2E, 0xA7, 0x05, 0x1D, 0x26, 0x7D, 0x38, 0x19, 0x41, 0x5D, 0xD3, 0x2F, 
+    0x7D, 0x4D, 0x4C, 0x69, 0x43, 0xED, 0x66, 0xE3, 0x47, 0x18, 0x5B, 0xD0, 0x0C, 0x0C, 0xAF, 0x69, 0xBD, 0xB1, 0x0A, 0x17, 
+    0x97, 0xD0, 0x35, 0x8B, 0xB3, 0xD0, 0x87, 0x41, 0xFE, 0x76, 0x35, 0x7F, 0x5B, 0xD8, 0x2C, 0x23, 0x76, 0xB6, 0x7B, 0x20, 
+    0xB4, 0x3E, 0x05, 0x21, 0xBB, 0x98, 0x11, 0x14, 0x48, 0x54, 0xA4, 0x44, 0x07, 0xD8, 0x71, 0x5D, 0xDF, 0x50, 0xA7, 0x89, 
+    0x99, 0x73, 0xD2, 0x3A, 0x7D, 0xF5, 0xA4, 0x8D, 0xC7, 0x3F, 0x67, 0x32, 0x1B, 0x31, 0x1A, 0x10, 0xD0, 0xCE, 0xB8, 0x21, 
+    0xD6, 0xFA, 0xC1, 0xB3, 0x62, 0x1B, 0xA6, 0x36, 0xF1, 0x3B, 0x61, 0x08, 0xC3, 0x4C, 0xD9, 0xA9, 0x09, 0xED, 0xE4, 0x99, 
+    0xF9, 0x08, 0x33, 0x3B, 0x35, 0x4A, 0x46, 0x1C, 0xC2, 0xD7, 0x55, 0x49, 0xBB, 0x56, 0x42, 0x64, 0x9A, 0x0B, 0x4B, 0x2D, 
+    0x91, 0xA0, 0xB1, 0x5D, 0x83, 0xEF, 0xDC, 0xB2, 0xA8, 0x41, 0x1E, 0x7B, 0x95, 0x8E, 0x32, 0x0D, 0xA3, 0x3F, 0x08, 0x87, 
+    0x60, 0xE7, 0xD1, 0xCE, 0xBC, 0xF6, 0x8E, 0x45, 0x34, 0x11, 0x3B, 0xA4, 0x0F, 0x5D, 0xDB, 0x36, 0xA1, 0xA7, 0x61, 0xD3, 
+    0x98, 0xC6, 0xB5, 0xA5, 0x0A, 0x19, 0x17, 0x16, 0x15, 0x5F, 0x9F, 0x12, 0x40, 0xAB, 0xD3, 0xB7, 0x86, 0x7F, 0x76, 0x19, 
+    0x33, 0x59, 0xC6, 0x0B, 0xC7, 0xAB, 0x53, 0x73, 0x99, 0x14, 0x61, 0x92, 0x10, 0xC9, 0x40, 0xAB, 0x95, 0x54, 0x65, 0xAC, 
+    0x79, 0x6E, 0x08, 0x62, 0x78, 0xC5, 0xB8, 0x2D, 0xDA, 0xFB, 0x37, 0xAD, 0xE3, 0x0E, 0xAA, 0x54, 0x59, 0x9E, 0x59, 0xB2, 
+    0xEC, 0x9A, 0xA8, 0x67, 0x53, 0xA6, 0xA4, 0xCE, 0x06, 0xD6, 0x22, 0x14, 0xF6, 0x50, 0x37, 0x6A, 0x9A, 0x21, 0x12, 0x5D, 
+    0xC5, 0xB6, 0xCD, 0x34, 0xC3, 0x22, 0x01, 0xC4, 0x32, 0x2E, 0x5F, 0x4D, 0x08, 0x56, 0x2E, 0x42, 0x7C, 0x11, 0x94, 0x8B, 
+    0x37, 0xBE, 0x05, 0x9F, 0x99, 0x32, 0xB0, 0x96, 0x2C, 0x67, 0x0B, 0xA2, 0x08, 0x98, 0xCA, 0x09, 0x75, 0x0D, 0xFC, 0x72, 
+    0xE0, 0x48, 0xC5, 0xC6, 0x7B, 0xA2, 0x69, 0xCB, 0xBC, 0x07, 0x82, 0xAB, 0x75, 0x2A, 0x9E, 0xCD, 0xA0, 0xB3, 0xD5, 0x62, 
+    0x8D, 0x3D, 0x1C, 0xF4, 0xC6, 0xC9, 0x6C, 0x6E, 0x72, 0xE0, 0xD9, 0xEE, 0x77, 0x9D, 0x26, 0x6F, 0x10, 0x66, 0x7D, 0x4A, 
+    0x9D, 0x60, 0x80, 0x2B, 0xFD, 0x3D, 0xDD, 0x20, 0x34, 0x09, 0x16, 0xAA, 0xE1, 0x0E, 0xB3, 0x32, 0x05, 0x09, 0x7C, 0x0E, 
+    0x21, 0x14, 0x60, 0x24, 0x94, 0x70, 0x08, 0x23, 0xD0, 0x52, 0xF0, 0x3A, 0xA8, 0x9B, 0x35, 0x25, 0x75, 0x4F, 0x54, 0xE2, 
+    0x7A, 0x8B, 0x98, 0x37, 0x46, 0x6C, 0x19, 0x1B, 0x84, 0x0E, 0xF5, 0x3B, 0x11, 0x82, 0x12, 0x1E, 0x35, 0x15, 0x33, 0xFA, 
+    0xD6, 0x68, 0x4A, 0x69, 0x9C, 0x67, 0x36, 0x23, 0xF1, 0xFE, 0xB9, 0xF6, 0x6D, 0x90, 0x68, 0x91, 0x38, 0x01, 0x41, 0x91, 
+    0xB7, 0x6B, 0x9A, 0x23, 0x58, 0x46, 0xD3, 0xFB, 0x69, 0xEC, 0x6E, 0x7C, 0xAA, 0xF0, 0xC9, 0xCC, 0x68, 0x08, 0x75, 0x14, 
+    0x38, 0x8B, 0x92, 0x2B, 0x29, 0x67, 0x0E, 0x88, 0x33, 0x2F, 0xB7, 0x6F, 0xA2, 0x64, 0x5B, 0x85, 0x92, 0x35, 0xD5, 0xD1, 
+    0x24, 0xBF, 0x28, 0xF7, 0x10, 0xA5, 0x1F, 0xAC, 0xF2, 0x87, 0xDD, 0xEC, 0x11, 0x03, 0xCA, 0x6A, 0x3C, 0x8E, 0xFB, 0xA1, 
+    0xB9, 0xAB, 0xB4, 0xBD, 0x2A, 0xB3, 0xC5, 0xE5, 0x63, 0x58, 0x3E, 0xE2, 0xA4, 0x10, 0x06, 0x1C, 0xC3, 0xDD, 0xC6, 0xCE, 
+    0xF3, 0xB0, 0xCC, 0x85, 0xA0, 0xAA, 0x36, 0xBD, 0xF4, 0x24, 0xA3, 0xBD, 0x02, 0xE7, 0x86, 0x51, 0xD0, 0x0F, 0x7C, 0xFD, 
+    0x26, 0x26, 0x7B, 0xF2, 0x2E, 0xDC, 0x02, 0x71, 0x4F, 0xF3, 0x1C, 0x01, 0x26, 0xF5, 0xB4, 0xA8, 0xF2, 0x31, 0xAA, 0xF8, 
+    0x5B, 0x75, 0xC6, 0xCC, 0x65, 0x02, 0x5C, 0xB4, 0xD0, 0x6F, 0x29, 0x0A, 0x43, 0x65, 0x5C, 0x35, 0x54, 0x7C, 0xF2, 0x42, 
+    0x48, 0x7D, 0x66, 0x76, 0x74, 0x3A, 0x8C, 0x55, 0x0F, 0x55, 0x01, 0xFB, 0x38, 0x21, 0xFA, 0x7E, 0xF5, 0x1E, 0xFF, 0xBC, 
+    0xDA, 0x50, 0xFF, 0x87, 0x80, 0x29, 0x6A, 0xAB, 0x56, 0xA0, 0xFA, 0x86, 0x18, 0x02, 0x85, 0x81, 0x03, 0x90, 0x01, 0x9F, 
+    0x30, 0xBF, 0xB9, 0xF8, 0x4F, 0x0F, 0x4A, 0xAE, 0xE1, 0x0E, 0x4A, 0x7F, 0x7B, 0x47, 0x40, 0x9F, 0x2A, 0xCD, 0x97, 0x04, 
+    0xEC, 0xC8, 0x8D, 0x27, 0x57, 0x82, 0x17, 0x83, 0x0E, 0xA8, 0x53, 0x53, 0x11, 0x1D, 0xD2, 0x3C, 0xC2, 0x2A, 0x94, 0x41, 
+    0x0B, 0xC4, 0x2F, 0x4A, 0x17, 0x73, 0xDA, 0xA5, 0xFF, 0x6C, 0x39, 0xDB, 0x4E, 0xF9, 0x4E, 0x29, 0xE5, 0xB0, 0x1B, 0x3E, 
+    0x7B, 0xDC, 0x36, 0x37, 0xEE, 0x3D, 0xF9, 0x1E, 0x4D, 0x10, 0xFF, 0x76, 0x5C, 0x2E, 0xDA, 0x45, 0x5C, 0x8A, 0xC7, 0x27, 
+    0x5A, 0x56, 0x2E, 0x73, 0xAB, 0x33, 0xA9, 0x49, 0x50, 0xC7, 0xEC, 0x95, 0x7D, 0xD1, 0xE6, 0x52, 0x1D, 0xD9, 0x07, 0x36, 
+    0xF0, 0x01, 0xDE, 0x14, 0x7C, 0x18, 0x98, 0xDE, 0x34, 0x2D, 0xD1, 0xAD, 0xD7, 0x5F, 0x60, 0x07, 0xE3, 0xF9, 0x17, 0x57, 
+    0x86, 0x1D, 0x71, 0xFE, 0xEB, 0x74, 0x2B, 0x81, 0xE3, 0xE0, 0x07, 0x4F, 0x0D, 0x47, 0x47, 0x9C, 0x01, 0x4B, 0x27, 0x58, 
+    0x29, 0x47, 0x0B, 0xF3, 0xA8, 0x9E, 0xAE, 0x57, 0xF2, 0xB2, 0x1E, 0xCF, 0x3D, 0x63, 0xD9, 0xAD, 0xE3, 0x42, 0x8F, 0x81, 
+    0x4C, 0x0E, 0xA5, 0xC9, 0x10, 0x11, 0x6D, 0xF1, 0x97, 0x3B, 0x4F, 0xB0, 0xE8, 0x4F, 0xC4, 0x5B, 0x83, 0x09, 0x75, 0x2D, 
+    0x4E, 0x5B, 0x9A, 0x19, 0xB3, 0xCC, 0x68, 0xD7, 0x94, 0x85, 0xE4, 0x58, 0x1B, 0x5B, 0x6C, 0x76, 0x76, 0x36, 0x08, 0xC6, 
+    0x28, 0x02, 0xB4, 0xDE, 0x11, 0x47, 0x1C, 0xA2, 0xB0, 0xC3, 0x7D, 0xE5, 0x4F, 0xDC, 0x5B, 0x28, 0x70, 0x10, 0x45, 0xC7, 
+    0x09, 0x80, 0x30, 0x59, 0x56, 0x44, 0xC2, 0x85, 0xFA, 0xF3, 0xD8, 0x04, 0x0A, 0x2F, 0x14, 0x9C, 0x2A, 0xC0, 0x01, 0x4D, 
+    0x27, 0x0B, 0x1A, 0xBB, 0x23, 0x61, 0xB7, 0x04, 0xB2, 0xFA, 0xAD, 0x72, 0xBD, 0x8E, 0x09, 0xFA, 0x19, 0xE9, 0xA9, 0x7D, 
+    0xD7, 0xBC, 0x72, 0xF0, 0x0E, 0x67, 0xBE, 0x40, 0x9F, 0x0D, 0xCD, 0xEC, 0x7A, 0x10, 0x46, 0x95, 0xAF, 0x32, 0xD9, 0xA3, 
+    0xEA, 0x6C, 0xE7, 0x71, 0x5E, 0x52, 0x00, 0x4C, 0xBF, 0x1A, 0xC8, 0xA4, 0x15, 0x33, 0x1C, 0xBC, 0xF6, 0xA8, 0x80, 0x25, 
+    0x96, 0x48, 0x70, 0x3C, 0xB7, 0xF2, 0xEB, 0xD8, 0x6C, 0xC3, 0x7E, 0x35, 0x2D, 0x27, 0x36, 0x95, 0x89, 0x4D, 0x65, 0x62, 
+    0xB5, 0x87, 0x13, 0xCC, 0x67, 0x3A, 0xB2, 0xF0, 0x9E, 0xB0, 0xB2, 0x61, 0xEA, 0xCE, 0x27, 0x5B, 0x48, 0x9B, 0xB9, 0x4C, 
+    0x79, 0x2E, 0x45, 0x78, 0xD4, 0x27, 0x2A, 0x20, 0x65, 0xBF, 0x16, 0x39, 0xDB, 0x09, 0xE1, 0xAF, 0xEE, 0x6C, 0xE5, 0xC5, 
+    0xC1, 0x51, 0x06, 0xE8, 0xCD, 0xA0, 0x0E, 0x41, 0x45, 0xF1, 0x40, 0x33, 0x9E, 0x4A, 0x58, 0x4B, 0x25, 0x4C, 0xE7, 0xA8, 
+    0xD5, 0xCB, 0x3E, 0xDB, 0xFD, 0xA6, 0xA3, 0x81, 0xFE, 0x75, 0x0F, 0xA5, 0xCA, 0xED, 0x93, 0x48, 0xDC, 0x69, 0xE1, 0x5A, 
+    0xAE, 0xC4, 0xB2, 0x23, 0xD1, 0x06, 0x78, 0x79, 0x0D, 0x3A, 0x9B, 0x64, 0xF0, 0x98, 0x80, 0xB0, 0x75, 0x72, 0x5D, 0xE5, 
+    0xDC, 0xC9, 0x6E, 0xE7, 0xD4, 0xBF, 0x57, 0x70, 0x93, 0x4F, 0x99, 0x34, 0x6B, 0xAC, 0x38, 0xF1, 0x87, 0x35, 0x27, 0x71, 
+    0xFF, 0x75, 0xD2, 0x1B, 0xB9, 0xAC, 0x43, 0xB2, 0x1E, 0x26, 0x4D, 0x2B, 0xE1, 0xDF, 0xAF, 0x96, 0xA5, 0x5E, 0x97, 0xD4, 
+    0x71, 0xE0, 0xF4, 0xEF, 0xEE, 0x76, 0xCE, 0x07, 0xAE, 0x49, 0x3E, 0xE8, 0x8A, 0xCA, 0x6F, 0xBA, 0xBA, 0xC3, 0xFB, 0x4D, 
+    0xA3, 0x9B, 0xC8, 0xDD, 0x8C, 0x32, 0x35, 0xA8, 0x9A, 0x87, 0x27, 0xD0, 0x08, 0xB5, 0x58, 0x4D, 0x70, 0x65, 0x37, 0x75, 
+    0xE4, 0x0B, 0x3F, 0x20, 0x16, 0x6C, 0x33, 0x2D, 0x50, 0x2C, 0xE5, 0x90, 0x83, 0xCC, 0x06, 0x4A, 0x65, 0x4A, 0x35, 0x89, 
+    0xC0, 0x6D, 0xA9, 0x04, 0x82, 0x0F, 0x3C, 0xC9, 0xD6, 0x4D, 0x0D, 0x58, 0x65, 0x67, 0x67, 0x04, 0x58, 0x83, 0xD4, 0xCA, 
+    0xA4, 0xB4, 0x00, 0x9C, 0x83, 0x4C, 0x97, 0x92, 0x4E, 0x87, 0xFE, 0xAB, 0x85, 0x59, 0x90, 0x8E, 0x18, 0x6A, 0x05, 0xED, 
+    0x98, 0xDB, 0x8C, 0x04, 0x91, 0xE0, 0xC3, 0x32, 0x07, 0xAA, 0xD4, 0x15, 0x71, 0x20, 0xA4, 0xB7, 0xC9, 0x3C, 0xBA, 0xF8, 
+    0x50, 0x95, 0xB9, 0xDD, 0x91, 0xFE, 0x4A, 0x48, 0xC3, 0xFF, 0x35, 0x8D, 0xB6, 0xC5, 0xEE, 0x2B, 0x9D, 0xD9, 0xB7, 0x53, 
+    0x52, 0xAD, 0x24, 0x30, 0xB5, 0xA2, 0xD7, 0x6E, 0x1D, 0xAC, 0x01, 0x65, 0x4B, 0xFF, 0x4A, 0xEC, 0xCF, 0xAF, 0xE2, 0x42, 
+    0xC5, 0xE4, 0x67, 0x0A, 0x22, 0x22, 0x68, 0x5A, 0xDD, 0x87, 0x7F, 0xEC, 0x13, 0x03, 0x97, 0x6C, 0x77, 0xE1, 0x0B, 0x7A, 
+    0xB0, 0xB7, 0x4A, 0x1F, 0xF5, 0xFB, 0xFA, 0xE4, 0xA6, 0xFD, 0x93, 0x3C, 0x46, 0x47, 0xDC, 0xB4, 0xA0, 0xBA, 0x0A, 0xB5, 
+    0x02, 0x49, 0x7A, 0xC2, 0x2E, 0x5B, 0x52, 0x7D, 0x2A, 0x38, 0x07, 0x85, 0xA3, 0x61, 0xE3, 0x1C, 0x57, 0x8E, 0xB0, 0x19, 
+    0x02, 0xD6, 0x41, 0xD6, 0x3E, 0x1E, 0x93, 0x47, 0x3B, 0x3A, 0x6A, 0x02, 0x87, 0x5C, 0xCE, 0x0E, 0xDE, 0x61, 0xCD, 0x46, 
+    0x2D, 0x39, 0x0A, 0x1C, 0xD9, 0x3C, 0xD9, 0x6E, 0x21, 0xC7, 0xA1, 0x6D, 0xBF, 0xFB, 0xFF, 0xC9, 0xDA, 0xAD, 0xD1, 0x55, 
+    0xE3, 0x40, 0x47, 0x69, 0x2B, 0x81, 0xE3, 0x66, 0x2C, 0xDA, 0xBF, 0x27, 0xFC, 0x90, 0x1C, 0x6D, 0x47, 0x3B, 0x93, 0x43, 
+    0x5B, 0x0D, 0x4B, 0x26, 0xB6, 0xF6, 0x81, 0xC1, 0xC8, 0x0D, 0x0A, 0xBF, 0x76, 0xA6, 0x86, 0xBE, 0x49, 0xC8, 0x14, 0x3B, 
+    0x43, 0x90, 0x27, 0xB2, 0x71, 0xDB, 0x39, 0x95, 0x3A, 0x37, 0x2E, 0x24, 0x26, 0x95, 0xE9, 0xE4, 0x0C, 0xE8, 0xCE, 0x4D, 
+    0x0F, 0x33, 0xF4, 0x2D, 0x6B, 0x8E, 0xCD, 0x7E, 0x23, 0xEA, 0xDD, 0x3B, 0x4F, 0x44, 0xD3, 0xBC, 0x5A, 0x00, 0xB9, 0x44, 
+    0x61, 0x0F, 0x93, 0xF6, 0xDD, 0x92, 0xE3, 0xE7, 0xB2, 0xFB, 0x52, 0x56, 0x6E, 0x2A, 0x7D, 0x95, 0x16, 0xD6, 0x57, 0x29, 
+    0x7D, 0x28, 0x68, 0xD9, 0x31, 0xD5, 0x9D, 0x4E, 0x63, 0x46, 0x24, 0x84, 0x92, 0xC9, 0xA1, 0x32, 0x1B, 0x20, 0x1A, 0x07, 
+    0x19, 0x57, 0xF9, 0xCA, 0x26, 0x14, 0xF6, 0x23, 0x4D, 0x5F, 0xA3, 0x26, 0xE3, 0x84, 0x2F, 0xA9, 0x81, 0x0C, 0xF7, 0xCE, 
+    0xE3, 0xEB, 0x4F, 0x88, 0x76, 0x29, 0x93, 0xD8, 0xEE, 0x25, 0xB5, 0xA1, 0x49, 0x3E, 0x94, 0x17, 0xB7, 0xAC, 0x34, 0xA1, 
+    0x8D, 0xBA, 0xD8, 0xC9, 0xB1, 0xD2, 0x61, 0x6B, 0x50, 0x1F, 0x3F, 0xFD, 0xC3, 0xE4, 0x8F, 0xAC, 0x7B, 0x57, 0x63, 0xB5, 
+    0x3D, 0xCF, 0xA2, 0xF3, 0xAB, 0xCD, 0xF9, 0x64, 0x50, 0x21, 0xA8, 0x29, 0x4B, 0xDB, 0x75, 0x3C, 0x7B, 0xFD, 0x36, 0x41, 
+    0x0F, 0x58, 0x1D, 0xB5, 0xEE, 0x3C, 0xC7, 0x7A, 0xFA, 0xAC, 0x71, 0x43, 0xEA, 0xB8, 0xC3, 0x96, 0x62, 0xD0, 0x70, 0x5C, 
+    0xC6, 0xD2, 0xB5, 0x1C, 0x9A, 0x63, 0x8E, 0xDF, 0x16, 0xA3, 0xB2, 0x01, 0xEC, 0x03, 0x37, 0xD3, 0xFA, 0x8A, 0xA2, 0x88, 
+    0x69, 0x64, 0x5E, 0x93, 0x3B, 0xA2, 0xF4, 0x2E, 0x3E, 0x94, 0x52, 0x3B, 0xAD, 0x24, 0x2D, 0xCC, 0x7B, 0xD1, 0xE6, 0xB4, 
+    0xCE, 0xF8, 0x87, 0xA2, 0x62, 0x09, 0xDB, 0x35, 0x07, 0x7C, 0x3A, 0x50, 0x8B, 0x8E, 0x02, 0x82, 0x8E, 0x7A, 0x5F, 0x4F, 
+    0x6E, 0x77, 0x65, 0x3C, 0xE2, 0x1B, 0x6D, 0xAD, 0xEF, 0x99, 0x3A, 0x3A, 0xB0, 0xA9, 0xBD, 0xB3, 0x57, 0x85, 0x32, 0x4B, 
+    0x6B, 0x42, 0x61, 0xCB, 0xFA, 0x16, 0x81, 0xF6, 0x48, 0x63, 0xA5, 0x27, 0x95, 0xCE, 0x14, 0x2D, 0x3D, 0x29, 0xDE, 0xD9, 
+    0x8D, 0x49, 0xB3, 0x1B, 0xEC, 0x85, 0x19, 0x7A, 0x18, 0x65, 0x27, 0x02, 0x08, 0xC7, 0x32, 0xDA, 0x1F, 0xB2, 0x6B, 0x5A, 
+    0xD5, 0xA8, 0x8C, 0xBE, 0xD9, 0x3C, 0x63, 0xF7, 0x53, 0x3A, 0x82, 0x0C, 0xE6, 0x2D, 0x33, 0xDE, 0x03, 0x1D, 0x50, 0xB2, 
+    0x5A, 0xDF, 0xCC, 0xA0, 0xB6, 0xAB, 0x16, 0xD4, 0xFD, 0x81, 0xEB, 0xCE, 0xB8, 0x1A, 0x07, 0x1D, 0xD6, 0x08, 0xD0, 0x2A, 
+    0x76, 0xDA, 0xA9, 0x20, 0xBB, 0x9E, 0x56, 0xB2, 0x93, 0x9B, 0x35, 0x5B, 0x71, 0xA4, 0x62, 0x6F, 0x6D, 0x46, 0xF9, 0x82, 
+    0x65, 0x0E, 0x66, 0xF7, 0xB3, 0xD2, 0x36, 0xAB, 0x8B, 0x71, 0xC2, 0x99, 0x96, 0xCA, 0x27, 0xDA, 0x97, 0x4D, 0xFF, 0xB2, 
+    0x00, 0xC7, 0x16, 0xA3, 0x03, 0x21, 0xC7, 0xA8, 0x1F, 0x13, 0x60, 0x5D, 0x84, 0x86, 0xBA, 0x55, 0xB3, 0x88, 0xB2, 0xC4, 
+    0x44, 0x72, 0xC7, 0x05, 0xCC, 0x34, 0x2F, 0x67, 0x83, 0x99, 0xC8, 0x93, 0x32, 0x71, 0x09, 0xD9, 0xF1, 0x3B, 0x99, 0x6D, 
+    0xEC, 0xF4, 0x74, 0x26, 0x17, 0x0D, 0x7E, 0x05, 0x73, 0xC4, 0x25, 0x56, 0x09, 0xB5, 0x7B, 0xF4, 0xAC, 0xB6, 0xF9, 0xCD, 
+    0x77, 0x5A, 0x1F, 0x68, 0x24, 0x3A, 0xEE, 0xDD, 0xCC, 0x97, 0x8A, 0xD7, 0x34, 0x37, 0x07, 0x54, 0xE8, 0x25, 0x28, 0x00, 
+    0x0C, 0x61, 0x9E, 0x44, 0xE3, 0x9B, 0x76, 0x9F, 0xEC, 0x24, 0xE2, 0x32, 0xAD, 0xA5, 0x91, 0x8E, 0x04, 0x9F, 0xDA, 0xFB, 
+    0xE0, 0xC9, 0x51, 0x65, 0x4B, 0x1D, 0xD9, 0xDD, 0xCC, 0xE8, 0x98, 0xB7, 0xD5, 0x4D, 0x61, 0x54, 0xD4, 0xDC, 0x9B, 0x4F, 
+    0xB9, 0x80, 0x9E, 0x88, 0x99, 0x13, 0xEE, 0x3E, 0x27, 0x2C, 0x4B, 0xD7, 0x4E, 0x46, 0x4B, 0xE8, 0xD5, 0x95, 0x31, 0x38, 
+    0xE6, 0xE8, 0xD7, 0x65, 0xD4, 0x67, 0x25, 0xE8, 0xBC, 0x74, 0x2B, 0x9D, 0xE1, 0x16, 0x46, 0xB4, 0xA1, 0xE1, 0xF7, 0x5C, 
+    0xAB, 0x4A, 0x88, 0xB2, 0xBE, 0x08, 0xC0, 0x9D, 0xCC, 0x9D, 0x0B, 0xD7, 0xB1, 0x4B, 0x6D, 0xC9, 0xA3, 0xB3, 0x0B, 0x18, 
+    0x10, 0x1F, 0x2A, 0x84, 0xBB, 0xE0, 0x4D, 0x55, 0x06, 0xF9, 0x1A, 0xA9, 0x8A, 0xF8, 0xA2, 0xB2, 0xE5, 0x47, 0x75, 0xED, 
+    0x8C, 0x8A, 0x97, 0xFE, 0x52, 0x5D, 0x2F, 0xB6, 0x5E, 0xB6, 0x1D, 0xDF, 0xAA, 0x7C, 0xCD, 0x22, 0x0B, 0x90, 0x62, 0xA0, 
+    0xD6, 0x9B, 0x46, 0x79, 0x74, 0xB1, 0xA6, 0x41, 0xB5, 0x45, 0xB6, 0xCA, 0x3F, 0x8A, 0xB8, 0x8E, 0x9D, 0x18, 0x31, 0x42, 
+    0xE8, 0x86, 0x06, 0xF1, 0x07, 0xDA, 0xA1, 0xCF, 0x22, 0x53, 0xCB, 0x4C, 0xAD, 0x32, 0x71, 0x90, 0xBA, 0xE1, 0x9D, 0x27, 
+    0xC1, 0x6E, 0xD4, 0x5A, 0xEB, 0x67, 0xE8, 0x6E, 0xEF, 0xCD, 0xC4, 0x05, 0xCF, 0xCE, 0x67, 0xEA, 0x36, 0x8B, 0x1A, 0x87, 
+    0xBB, 0xDA, 0x20, 0x91, 0xCF, 0xAE, 0xEA, 0x41, 0x82, 0x4A, 0xDF, 0xA9, 0xFB, 0xB8, 0xE0, 0x76, 0x8F, 0x2B, 0x18, 0x96, 
+    0x1A, 0xB2, 0x47, 0x1D, 0x99, 0x35, 0xA3, 0xFA, 0x94, 0x85, 0x1C, 0xDE, 0xB8, 0x82, 0x95, 0x1A, 0xFD, 0xAA, 0xDE, 0x90, 
+    0x94, 0x57, 0xC6, 0x83, 0xD2, 0xE8, 0x62, 0x2C, 0xB6, 0x16, 0xF4, 0xF3, 0x82, 0x75, 0x33, 0x4C, 0x1F, 0x9C, 0x08, 0x18, 
+    0x25, 0xB5, 0x03, 0x87, 0xAB, 0x0B, 0x96, 0x41, 0x1B, 0x7D, 0x4A, 0xF6, 0xD9, 0xC9, 0x2E, 0xBA, 0x2A, 0x8E, 0xC6, 0xA1, 
+    0xBD, 0x50, 0x73, 0xED, 0x0C, 0x38, 0xE1, 0xD5, 0xB0, 0xAA, 0xF7, 0xBE, 0x5E, 0xA3, 0x05, 0x07, 0x72, 0x06, 0x0B, 0x68, 
+    0x9C, 0x56, 0xC4, 0xCB, 0x2C, 0x5C, 0x54, 0xF4, 0xED, 0xB3, 0x38, 0x2F, 0x71, 0x7D, 0x6E, 0x14, 0xB1, 0x60, 0x74, 0x91, 
+    0x6B, 0x0D, 0xFD, 0x94, 0x2D, 0x2E, 0xF8, 0x28, 0x74, 0x71, 0x6E, 0x1A, 0xD8, 0x23, 0x55, 0x2A, 0x0B, 0x8B, 0xC0, 0xA2, 
+    0x23, 0xAE, 0x74, 0x6B, 0x2B, 0x75, 0x6D, 0x39, 0x72, 0x6B, 0xB7, 0xA0, 0x2B, 0xAE, 0x11, 0x25, 0x34, 0xFA, 0x2E, 0x88, 
+    0x9B, 0xCC, 0xC6, 0x31, 0x74, 0xD6, 0x87, 0x7B, 0x73, 0x64, 0x99, 0x9B, 0xD1, 0x46, 0x52, 0x08, 0xBD, 0x78, 0x12, 0xFC, 
+    0xCF, 0xC5, 0x7B, 0xD9, 0xE9, 0x69, 0xF5, 0x8A, 0x5F, 0xC7, 0x42, 0xCA, 0xA2, 0xB1, 0xF8, 0x16, 0xC6, 0x5C, 0x62, 0x15, 
+    0xBE, 0x98, 0x3D, 0xB0, 0x1C, 0x39, 0x53, 0x47, 0xA6, 0x32, 0x0B, 0xE2, 0x4D, 0x76, 0x7A, 0x7A, 0x0B, 0x81, 0xEE, 0x3A, 
+    0xB3, 0x69, 0x7C, 0x93, 0x07, 0x7F, 0x91, 0x43, 0xF7, 0x6E, 0xD0, 0xD3, 0x1C, 0xCD, 0x99, 0xD7, 0xCD, 0x82, 0x51, 0x64, 
+    0x32, 0x2D, 0xCC, 0x54, 0xF2, 0xB1, 0xA8, 0x9A, 0x41, 0x28, 0x6E, 0xE9, 0xF0, 0x0C, 0x59, 0x90, 0x68, 0x96, 0x37, 0x94, 
+    0x60, 0xDF, 0x2D, 0x98, 0x44, 0x9C, 0x6F, 0x97, 0xF4, 0x1B, 0xCD, 0xBF, 0x8D, 0x94, 0x59, 0x0F, 0x3E, 0x62, 0x68, 0xCB, 
+    0x52, 0x13, 0x9E, 0xF7, 0xBA, 0xD5, 0xC9, 0x6C, 0xA5, 0x12, 0x53, 0x56, 0x31, 0xF4, 0x0D, 0x39, 0x09, 0x79, 0xD3, 0x41, 
+    0xF0, 0xE1, 0x32, 0x6B, 0xA2, 0x36, 0x6C, 0x10, 0x4B, 0x86, 0xB0, 0x40, 0xB1, 0xB6, 0x8E, 0xB4, 0xBC, 0xAD, 0x13, 0x58, 
+    0x6D, 0xBB, 0x73, 0x9B, 0xA1, 0xEF, 0xD5, 0x25, 0xA1, 0xA2, 0xEF, 0x99, 0xDF, 0x0C, 0x81, 0xA9, 0x11, 0x06, 0xD7, 0xE0, 
+    0xEA, 0xE6, 0x2A, 0x6E, 0x57, 0x77, 0x9B, 0xAC, 0xD0, 0xD0, 0x71, 0x7E, 0x75, 0xDF, 0x3D, 0x9F, 0x04, 0xAD, 0x22, 0x97, 
+    0x55, 0xA6, 0xCD, 0x59, 0x2C, 0xF0, 0x0F, 0x38, 0x29, 0x6A, 0x74, 0x1F, 0x61, 0x61, 0xDC, 0x29, 0x28, 0xCD, 0x6C, 0xAC, 
+    0xA8, 0x1E, 0x72, 0x3B, 0xA9, 0x51, 0x49, 0x25, 0x85, 0x95, 0x47, 0x66, 0xBA, 0x4C, 0x5C, 0xDB, 0xDF, 0xA1, 0xF8, 0xB1, 
+    0xE6, 0xDC, 0x63, 0x9C, 0x41, 0xC7, 0xE6, 0x39, 0x33, 0xFB, 0xF0, 0xE8, 0xE4, 0xA4, 0xC1, 0xA8, 0xB5, 0x76, 0x2C, 0xA2, 
+    0x19, 0x8D, 0xEF, 0x20, 0x13, 0xBD, 0xD4, 0xEF, 0x5A, 0xDC, 0x56, 0xB8, 0xE2, 0x8E, 0xF8, 0xD5, 0x90, 0x0C, 0x11, 0x62, 
+    0xCC, 0x63, 0x31, 0x33, 0xBD, 0xFF, 0x51, 0x0B, 0x1A, 0x96, 0x46, 0x8F, 0x80, 0x90, 0xBE, 0x64, 0xA9, 0x20, 0x4B, 0xF6, 
+    0x87, 0x92, 0x05, 0xCE, 0x9C, 0x56, 0x81, 0x86, 0xBF, 0x33, 0xFD, 0xD6, 0x12, 0x80, 0xA6, 0x04, 0xAD, 0x8C, 0x3D, 0x3A, 
+    0xCA, 0x08, 0x53, 0xD0, 0xFE, 0x86, 0x8A, 0x14, 0x6B, 0xA2, 0xB4, 0x79, 0x40, 0x12, 0x78, 0xA6, 0xE5, 0xC1, 0xBB, 0xCA, 
+    0x7A, 0xB3, 0x9C, 0xD6, 0x92, 0x03, 0xE6, 0xE1, 0x37, 0x5B, 0xAD, 0x36, 0xF9, 0xB6, 0xFD, 0x9E, 0x68, 0x50, 0x5F, 0x23, 
+    0xBF, 0x75, 0x54, 0x69, 0x10, 0x58, 0xDB, 0x61, 0xEE, 0x4C, 0xAC, 0x7F, 0x43, 0x23, 0x39, 0xB1, 0xD4, 0x8F, 0xC4, 0x41, 
+    0x6E, 0xB3, 0xB1, 0x31, 0x7B, 0xBA, 0xA5, 0x76, 0xDB, 0x0D, 0xD6, 0x15, 0xC6, 0xDD, 0xE6, 0x78, 0xC6, 0xF4, 0xA4, 0x34, 
+    0xE2, 0xDA, 0x14, 0xC9, 0x3A, 0x1D, 0x94, 0x0B, 0x0E, 0xDA, 0x60, 0xB3, 0xC8, 0x67, 0x2C, 0x88, 0x68, 0x5F, 0x32, 0xBB, 
+    0xC0, 0x62, 0x93, 0x02, 0xEF, 0xB9, 0xB2, 0xD4, 0x25, 0xDD, 0x24, 0x6A, 0x18, 0xCA, 0x68, 0x60, 0x34, 0x2D, 0xAD, 0xDC, 
+    0xE3, 0xAC, 0xD1, 0x8A, 0x05, 0x3E, 0x6D, 0xDA, 0xD9, 0x3C, 0x40, 0x44, 0x27, 0xB8, 0x3C, 0x42, 0xFA, 0x40, 0x53, 0x81, 
+    0x11, 0x20, 0xD4, 0x60, 0x5C, 0x84, 0x0A, 0x0D, 0x66, 0xA0, 0xC4, 0x85, 0xAE, 0xC8, 0xC2, 0xE8, 0xFB, 0xB4, 0x11, 0xBA, 
+    0xED, 0x25, 0x08, 0xB6, 0x88, 0x35, 0xD4, 0x44, 0xD4, 0x56, 0x53, 0x4A, 0x12, 0x39, 0x4E, 0xE8, 0xA4, 0xBD, 0x09, 0x6D, 
+    0xB2, 0x97, 0x25, 0xDD, 0xCB, 0x75, 0x22, 0x13, 0x4F, 0x3B, 0x9D, 0x3F, 0xD9, 0x23, 0x03, 0x92, 0xAA, 0xF4, 0x12, 0xF0, 
+    0xE2, 0x7B, 0xE8, 0x25, 0x51, 0x36, 0x7E, 0x37, 0xBD, 0xF4, 0x7D, 0xB5, 0x9A, 0x8A, 0x6C, 0xCD, 0xA0, 0x5E, 0x16, 0xAA, 
+    0xB5, 0x5F, 0x01, 0x80, 0xE8, 0x66, 0x36, 0x3F, 0x19, 0x69, 0x91, 0xA5, 0x72, 0x9C, 0x44, 0x51, 0xAA, 0x26, 0xC1, 0x53, 
+    0x18, 0x24, 0xD6, 0x28, 0x2B, 0x5D, 0x3D, 0x2C, 0x5E, 0x57, 0xB0, 0x09, 0x86, 0xB3, 0xD5, 0x2F, 0xE8, 0x49, 0x89, 0x68, 
+    0x0C, 0x56, 0xC2, 0x56, 0x44, 0x76, 0x50, 0x8D, 0xF1, 0xD6, 0x14, 0x1E, 0xDB, 0x29, 0xB1, 0x89, 0x50, 0x62, 0x13, 0xA1, 
+    0xC4, 0x26, 0x86, 0x12, 0x1B, 0x47, 0x17, 0xE2, 0x5E, 0xAD, 0x53, 0xA1, 0xB1, 0x58, 0x07, 0x2A, 0x75, 0x46, 0x0E, 0xEC, 
+    0x9F, 0xB2, 0x51, 0x58, 0x69, 0x5B, 0x00, 0xED, 0x01, 0xC7, 0x16, 0xA6, 0x28, 0xA9, 0x9D, 0xC2, 0xA5, 0x76, 0x44, 0x6E, 
+    0x54, 0x52, 0x3B, 0x39, 0xE1, 0x66, 0x58, 0x68, 0x86, 0x45, 0x49, 0x73, 0x15, 0x25, 0xCD, 0x85, 0xEC, 0x25, 0xCD, 0x25, 
+    0x99, 0x65, 0xD0, 0xE6, 0xF0, 0x4F, 0x52, 0xB1, 0x1A, 0xFE, 0x7D, 0x5C, 0x31, 0x65, 0x67, 0x4B, 0x53, 0xCF, 0x51, 0x90, 
+    0x60, 0x83, 0xB9, 0xAF, 0x38, 0xD2, 0xD1, 0x45, 0x3F, 0x08, 0xB7, 0x99, 0x09, 0xFF, 0x63, 0x35, 0xCA, 0xF6, 0xFB, 0x5D, 
+    0x33, 0x91, 0xA3, 0x8D, 0x6E, 0x0A, 0xDC, 0x2C, 0x9F, 0x5D, 0x1C, 0xB4, 0xF5, 0x5F, 0x55, 0xC6, 0x66, 0x03, 0x08, 0x0F, 
+    0x45, 0xAC, 0xA6, 0xBC, 0xED, 0x26, 0x6B, 0xD9, 0xDC, 0xEE, 0x2C, 0xBE, 0x63, 0xDF, 0x4D, 0xAA, 0x7B, 0xFA, 0xA3, 0xD2, 
+    0xE4, 0xD0, 0x4A, 0xE5, 0x78, 0x27, 0x3B, 0x8A, 0xF0, 0x86, 0x93, 0x3B, 0x32, 0x3B, 0x89, 0xC3, 0xE5, 0xBA, 0xCA, 0xBC, 
+    0x69, 0x8D, 0xBB, 0xAF, 0x86, 0x64, 0x72, 0xDF, 0xAA, 0x19, 0x85, 0x00, 0xAE, 0x5E, 0xE5, 0xE8, 0x05, 0x82, 0x50, 0xAD, 
+    0x48, 0xF2, 0xEF, 0x96, 0xF3, 0x47, 0x78, 0x07, 0x49, 0x1E, 0xBE, 0xE6, 0x3D, 0x07, 0xB0, 0x2E, 0xE6, 0x73, 0xED, 0x63, 
+    0x44, 0xBF, 0x7D, 0xAF, 0x95, 0x8C, 0xA9, 0xC8, 0xEA, 0x9E, 0x3E, 0x2D, 0x91, 0xBE, 0x9A, 0xEB, 0xA7, 0xBB, 0x6D, 0xF1, 
+    0x4D, 0xB2, 0xA6, 0x07, 0x76, 0x1E, 0xFA, 0x99, 0xD8, 0xCE, 0x2B, 0x63, 0x3B, 0xFF, 0xB9, 0x46, 0xC5, 0x75, 0xCE, 0xD3, 
+    0xC0, 0xAE, 0x88, 0xA0, 0x2A, 0xB2, 0x1D, 0x96, 0x9D, 0xF1, 0x4C, 0x6A, 0x21, 0xA5, 0x9D, 0x45, 0x2A, 0x60, 0x45, 0x9B, 
+    0x1E, 0x3D, 0xAC, 0xB8, 0x5B, 0x82, 0xB9, 0xEE, 0x08, 0x13, 0x0D, 0xAF, 0x76, 0x57, 0x9B, 0xAB, 0xE5, 0xD5, 0x78, 0x54, 
+    0x17, 0x00, 0xD2, 0x08, 0x5E, 0x62, 0x9B, 0x1E, 0x93, 0x02, 0x3A, 0xF1, 0x35, 0x5C, 0xE7, 0xCF, 0xD7, 0x4D, 0xAB, 0x3B, 
+    0xDC, 0xCA, 0x1A, 0x75, 0x48, 0x47, 0x20, 0xF8, 0x0E, 0x47, 0xCE, 0x80, 0x29, 0x2D, 0xEB, 0x33, 0xDD, 0xF0, 0x5D, 0x51, 
+    0xA0, 0xB6, 0x74, 0xB2, 0x68, 0xC4, 0x88, 0xC9, 0xAE, 0x03, 0xB9, 0xCF, 0xE3, 0xAB, 0x63, 0x2F, 0xB0, 0x7C, 0x02, 0x94, 
+    0x47, 0x06, 0xB3, 0xCB, 0xA9, 0x09, 0xE1, 0xA1, 0xE3, 0xB6, 0x4E, 0x47, 0xC4, 0x68, 0x5D, 0x44, 0xAE, 0x3F, 0x7E, 0x56, 
+    0x01, 0xB6, 0xF5, 0xC6, 0x50, 0x57, 0xE9, 0x3A, 0x09, 0x30, 0xAB, 0x2C, 0x5D, 0x0A, 0xDF, 0x11, 0x91, 0x0F, 0x3B, 0x42, 
+    0xFC, 0x81, 0xF2, 0x9E, 0x09, 0x6B, 0x02, 0xA5, 0xC1, 0x31, 0xB3, 0x1E, 0xA5, 0x55, 0x38, 0xCC, 0x31, 0xB9, 0xF4, 0x27, 
+    0x7D, 0xE8, 0x4E, 0x74, 0x23, 0x79, 0x1B, 0x4C, 0x8C, 0xC5, 0x68, 0x0E, 0xF5, 0x5B, 0xDB, 0x90, 0xE0, 0x36, 0xB7, 0x2F, 
+    0x84, 0xE4, 0xAA, 0x7E, 0xEE, 0xB5, 0x57, 0xA1, 0xFF, 0xD6, 0x1A, 0xB1, 0xBD, 0x72, 0xED, 0xF0, 0x80, 0x55, 0xD9, 0xFF, 
+    0xCE, 0x95, 0x73, 0xFA, 0xF7, 0x7F, 0xF4, 0xE2, 0x1D, 0x59, 0x3B, 0x79, 0x6D, 0x5B, 0x41, 0x08, 0xA5, 0xA0, 0xEA, 0x62, 
+    0x6A, 0xB2, 0x5F, 0x94, 0x5E, 0x51, 0x0E, 0x78, 0x22, 0x6B, 0x0A, 0xDB, 0xD6, 0x7F, 0x6F, 0x59, 0xE5, 0x0E, 0xB4, 0xBE, 
+    0xAC, 0x8E, 0xCD, 0x8A, 0x5E, 0x9A, 0xC1, 0x31, 0x03, 0xC9, 0xD4, 0x75, 0xA8, 0x8E, 0x20, 0x6D, 0xA2, 0xF7, 0x51, 0x6E, 
+    0xA4, 0xC0, 0x75, 0x13, 0x5F, 0x4D, 0xD3, 0x8C, 0x55, 0x55, 0x95, 0xCB, 0x15, 0xD7, 0x9B, 0xC5, 0x75, 0x7A, 0xE9, 0x57, 
+    0x85, 0xF4, 0xD5, 0xC5, 0x05, 0x8B, 0x99, 0x06, 0x87, 0xB0, 0xAA, 0x2F, 0xEA, 0xF6, 0xCF, 0x00, 0xAC, 0x68, 0x82, 0xE9, 
+    0xFA, 0x59, 0x00, 0x53, 0x01, 0x00, 0x1D, 0xE0, 0x18, 0xB6, 0xB9, 0x58, 0x1D, 0xC4, 0xF3, 0xDB, 0x4A, 0xF3, 0xC4, 0xA2, 
+    0x15, 0x95, 0xC1, 0x10, 0x57, 0x52, 0x94, 0xC3, 0x4D, 0x45, 0x2D, 0xD6, 0x87, 0xDF, 0x80, 0xBF, 0x56, 0x6E, 0xCF, 0x25, 
+    0xE8, 0x5C, 0xB5, 0xBF, 0xA5, 0x57, 0x21, 0xD1, 0xB5, 0xF9, 0xF5, 0x57, 0xFB, 0xE9, 0xD7, 0x5F, 0xBD, 0x3A, 0xE4, 0xD6, 
+    0xDE, 0xA3, 0xEA, 0x2B, 0x11, 0x57, 0xC2, 0x26, 0xF3, 0x1D, 0xC4, 0xF1, 0x5A, 0xC5, 0xF4, 0x9D, 0x43, 0x4A, 0xE8, 0x31, 
+    0xB5, 0x8B, 0xB0, 0x23, 0x00, 0x5A, 0xC2, 0x80, 0xD6, 0x0C, 0x1F, 0x61, 0x14, 0x29, 0x9D, 0xC8, 0x30, 0xD0, 0x95, 0x73, 
+    0xED, 0x1E, 0xA8, 0xB4, 0x49, 0x7E, 0xF7, 0x9E, 0xB0, 0x30, 0xCF, 0x72, 0x49, 0xA3, 0xDB, 0xDB, 0x1F, 0x18, 0x25, 0x5F, 
+    0xE7, 0x78, 0xF4, 0xD2, 0xF9, 0xDD, 0xE6, 0x64, 0x4C, 0x0C, 0xD9, 0x56, 0xFE, 0x42, 0x45, 0x19, 0xBF, 0xAB, 0xBB, 0xDD, 
+    0xC9, 0x7C, 0x95, 0xE4, 0x27, 0x9B, 0x62, 0x4B, 0x94, 0xC4, 0x89, 0x88, 0x69, 0x4F, 0xEE, 0x96, 0x9C, 0x98, 0xCD, 0x67, 
+    0xD9, 0xCD, 0x49, 0x9E, 0xCE, 0xE5, 0x61, 0xB1, 0xA2, 0x23, 0x31, 0x27, 0xDE, 0x4E, 0x9E, 0xEE, 0xD6, 0xF2, 0x8B, 0x25, 
+    0x95, 0x27, 0x18, 0x03, 0xE8, 0x27, 0xAA, 0x97, 0x1F, 0xC0, 0xB4, 0xE8, 0x34, 0x5A, 0x4F, 0xCA, 0x98, 0x4D, 0x93, 0xE5, 
+    0x84, 0x1A, 0x92, 0xC0, 0xC5, 0xDB, 0xBB, 0x74, 0x31, 0xDB, 0x9D, 0xDC, 0x14, 0x8F, 0x5C, 0x2F, 0xFD, 0xAE, 0xA1, 0x21, 
+    0x89, 0x07, 0xAA, 0xBE, 0xD8, 0x6C, 0x56, 0xB4, 0x99, 0x70, 0xE0, 0x3E, 0xEC, 0x08, 0x09, 0xDE, 0x79, 0x8E, 0x7A, 0x62, 
+    0x9B, 0xF2, 0x41, 0x55, 0x2F, 0xA3, 0xE4, 0x95, 0x1B, 0x14, 0x78, 0x3F, 0x36, 0xA1, 0xE0, 0x53, 0x13, 0x5F, 0x22, 0xD3, 
+    0x9B, 0xCB, 0x84, 0x04, 0x4F, 0x83, 0x46, 0x74, 0xA5, 0x29, 0x06, 0xF8, 0x8E, 0xB0, 0xE5, 0xE5, 0x88, 0x21, 0x34, 0x2E, 
+    0x07, 0x0D, 0x55, 0x20, 0x44, 0xB2, 0x00, 0x4D, 0x78, 0x8C, 0x9D, 0x2F, 0x43, 0xD3, 0x73, 0x7F, 0x98, 0x71, 0x53, 0x77, 
+    0xCB, 0x46, 0x91, 0x5A, 0x81, 0xF1, 0xD8, 0x96, 0xE0, 0x48, 0x12, 0x12, 0x72, 0xFE, 0x3D, 0x1A, 0x76, 0x3C, 0x6C, 0xA3, 
+    0x2A, 0x77, 0xB7, 0x3C, 0x52, 0xCA, 0x96, 0xB9, 0x68, 0x39, 0x86, 0x62, 0xA7, 0x79, 0xEF, 0x39, 0xC7, 0x07, 0x36, 0x09, 
+    0x54, 0x35, 0x22, 0xFF, 0x3E, 0xF7, 0x44, 0xCC, 0xC0, 0x44, 0xCC, 0xDB, 0xCC, 0x28, 0x6A, 0xA8, 0x7B, 0x5C, 0x64, 0xC6, 
+    0xE7, 0xEA, 0x81, 0x7E, 0x7D, 0x15, 0xEC, 0xFD, 0xAB, 0xE1, 0xFE, 0x89, 0x7E, 0x0E, 0xFB, 0x51, 0xB0, 0xF7, 0x38, 0xAE, 
+    0xB6, 0x77, 0x75, 0x05, 0x72, 0x67, 0xB4, 0xBF, 0xBA, 0x1A, 0xE2, 0xF9, 0x3C, 0x1D, 0x2F, 0x37, 0x3B, 0xBC, 0xDE, 0x0D, 
+    0xAF, 0xF2, 0xE4, 0x6C, 0xFC, 0xE9, 0xD9, 0x17, 0xA3, 0xA7, 0x8F, 0x0E, 0xC1, 0x73, 0xEF, 0x6A, 0xFB, 0x3C, 0x8C, 0xF7, 
+    0x08, 0xA8, 0xBD, 0x1F, 0x27, 0x84, 0x40, 0x58, 0x6D, 0x6B, 0x7F, 0x16, 0xFB, 0x71, 0xA7, 0x7F, 0x95, 0x07, 0x57, 0x79, 
+    0x17, 0x51, 0xB4, 0x7B, 0xF4, 0xBB, 0x0F, 0x50, 0x77, 0xF1, 0xF9, 0x08, 0x46, 0x8A, 0x31, 0x27, 0x30, 0x31, 0xC5, 0x64, 
+    0xF9, 0x5F, 0x5E, 0x7F, 0xF7, 0x6D, 0xE4, 0x1E, 0x8F, 0xE0, 0x61, 0x7A, 0x48, 0x05, 0xF9, 0x8D, 0x5F, 0xC9, 0x67, 0x3D, 
+    0xAB, 0x3B, 0x69, 0x3E, 0xF8, 0x4C, 0x1B, 0x71, 0x43, 0x62, 0x74, 0x15, 0x86, 0x5E, 0x90, 0x6F, 0xA5, 0xD5, 0x9E, 0x89, 
+    0x18, 0x5A, 0xD8, 0xDD, 0xFC, 0x90, 0x55, 0xFD, 0x0A, 0xB0, 0x81, 0x79, 0x29, 0x2D, 0x60, 0x9B, 0x37, 0xDA, 0xDE, 0xAA, 
+    0xCF, 0xE6, 0x12, 0x09, 0x5F, 0xF9, 0x81, 0x2D, 0x22, 0xE2, 0xA4, 0x33, 0x3E, 0xEB, 0x14, 0x8A, 0xB1, 0x52, 0x10, 0xDB, 
+    0xB3, 0xC0, 0xD3, 0x85, 0xE1, 0x59, 0x82, 0x35, 0x51, 0x78, 0x1B, 0xF9, 0xDE, 0x57, 0xCB, 0xB7, 0xC4, 0x2E, 0xE4, 0x27, 
+    0xE8, 0x79, 0x78, 0x02, 0x99, 0x14, 0x04, 0x03, 0x3C, 0x04, 0x62, 0xC1, 0xA2, 0x86, 0x9E, 0xB8, 0x92, 0xB8, 0x82, 0x69, 
+    0x49, 0x71, 0x58, 0xFD, 0xC0, 0x34, 0x70, 0xEE, 0x33, 0x38, 0x3E, 0x4C, 0xD2, 0x7B, 0xF5, 0xDD, 0x37, 0xDF, 0xA3, 0xAE, 
+    0x4D, 0x4C, 0xFD, 0x85, 0x65, 0xA8, 0x4D, 0x60, 0x37, 0x75, 0xE2, 0x2E, 0x64, 0xB3, 0x5A, 0xBC, 0xE6, 0xBA, 0x20, 0x2B, 
+    0xC0, 0xAE, 0x3E, 0x7F, 0x58, 0x20, 0x04, 0x2F, 0x46, 0x85, 0x32, 0x9F, 0x52, 0x17, 0xDE, 0x16, 0x3F, 0x69, 0xAD, 0x4C, 
+    0xEF, 0x9B, 0x19, 0xE1, 0xA3, 0xED, 0x6A, 0xBC, 0xEB, 0x81, 0x49, 0xFC, 0xEE, 0x1B, 0x48, 0x16, 0x7A, 0xC9, 0xF6, 0x71, 
+    0x99, 0x45, 0x1E, 0x2F, 0x37, 0x8E, 0x6D, 0xA0, 0x2A, 0xFA, 0x0C, 0x11, 0x4E, 0x19, 0x51, 0x26, 0x33, 0x2A, 0x3C, 0xAE, 
+    0xDC, 0xA5, 0xE6, 0xFA, 0x9A, 0x56, 0x23, 0x3B, 0xA2, 0x3A, 0xC1, 0xBD, 0xDD, 0xF0, 0xC4, 0x39, 0x86, 0x6B, 0x8D, 0xA9, 
+    0xA4, 0x66, 0x65, 0x26, 0x55, 0x26, 0x66, 0xB3, 0x8F, 0x99, 0xFA, 0x2D, 0x53, 0x9F, 0x12, 0x68, 0xFF, 0xA1, 0xF7, 0xFC, 
+    0xD9, 0xB9, 0xFA, 0x0C, 0x40, 0x3E, 0x8C, 0x4F, 0x47, 0xC1, 0xAF, 0xD1, 0xF0, 0x97, 0xD3, 0xD1, 0xF3, 0x73, 0xF5, 0x92, 
+    0x25, 0x0B, 0xBD, 0xE7, 0x71, 0x10, 0x0E, 0x4F, 0xAE, 0x76, 0x23, 0xB8, 0x6B, 0x64, 0x68, 0x7F, 0x1E, 0x5C, 0x6D, 0xE2, 
+    0x67, 0xE7, 0x93, 0x85, 0x7A, 0x65, 0x84, 0x0F, 0x29, 0xE1, 0xD1, 0x7D, 0xB2, 0x5E, 0xE3, 0xDF, 0xD9, 0x76, 0xB7, 0xDA, 
+    0x24, 0x93, 0x62, 0xDF, 0xEB, 0x9E, 0x31, 0x42, 0xDA, 0xC2, 0xFE, 0x62, 0x4C, 0xE7, 0xED, 0x9E, 0x50, 0xE6, 0xFE, 0x7E, 
+    0x96, 0xD3, 0x50, 0x82, 0x90, 0x1A, 0xFD, 0x5C, 0x17, 0xFF, 0xF3, 0xE7, 0x6F, 0xF6, 0x5F, 0x7E, 0xFE, 0xE9, 0x2B, 0x58, 
+    0xEB, 0x7E, 0x81, 0xB4, 0xAB, 0xF3, 0xAB, 0xF3, 0x73, 0xF5, 0x67, 0xFE, 0x3C, 0xBC, 0xBA, 0xA7, 0x8A, 0x46, 0xDD, 0x10, 
+    0xDB, 0x02, 0x1F, 0x78, 0xE7, 0x5D, 0x9D, 0xC7, 0x7F, 0x18, 0x3D, 0xFF, 0x7F, 0x68, 0xAF, 0xC8, 0x73, 0x48, 0xBD, 0xA2, 
+    0x0F, 0xA1, 0x4F, 0xFB, 0x25, 0xD8, 0xD3, 0xFF, 0xCE, 0xD5, 0x97, 0x19, 0x6C, 0x19, 0xBF, 0xE2, 0xBF, 0x7F, 0xA1, 0x75, 
+    0x78, 0x7E, 0xEE, 0x19, 0x93, 0x4A, 0x84, 0xFB, 0x66, 0x68, 0xF8, 0x2D, 0x8B, 0xE6, 0xAB, 0x8C, 0xD5, 0x96, 0x99, 0x55, 
+    0xD5, 0xEB, 0xF2, 0x57, 0xC2, 0x29, 0xBF, 0xB5, 0xA8, 0xBD, 0x24, 0xB4, 0xAE, 0xBF, 0x65, 0x9C, 0x13, 0xD2, 0x40, 0xCA, 
+    0xA2, 0xDF, 0x0E, 0x8F, 0x59, 0xF4, 0x67, 0x6D, 0x3D, 0x46, 0x49, 0x15, 0x76, 0x4A, 0x08, 0x8E, 0xD2, 0xBB, 0x76, 0xE6, 
+    0xF0, 0xB0, 0x55, 0x45, 0xA3, 0x26, 0xF8, 0x5A, 0xF5, 0x56, 0xEE, 0xB1, 0x31, 0x12, 0xE5, 0x8B, 0x8B, 0x6A, 0x23, 0x35, 
+    0xF2, 0xB6, 0x46, 0x63, 0x67, 0x81, 0xA1, 0x3F, 0xCD, 0x2D, 0x86, 0xD7, 0x15, 0x5D, 0x17, 0xEB, 0x64, 0x12, 0x9B, 0x21, 
+    0xB7, 0x9E, 0x25, 0x39, 0x22, 0xBA, 0x12, 0xAB, 0xA3, 0x84, 0x4D, 0xD3, 0x60, 0x90, 0x6A, 0x14, 0xE0, 0x33, 0xEC, 0x83, 
+    0xDA, 0x37, 0xBE, 0xE7, 0xCD, 0x5C, 0x03, 0xA9, 0x6F, 0xB2, 0xBA, 0x32, 0x33, 0x7B, 0x51, 0x01, 0x11, 0xF3, 0x55, 0x56, 
+    0xCE, 0xC7, 0x04, 0xF7, 0xAE, 0xF8, 0x3E, 0xB3, 0xD8, 0x07, 0xBE, 0xA3, 0x58, 0xA9, 0x93, 0x69, 0x82, 0x84, 0x5D, 0x4B, 
+    0x0D, 0x2B, 0x52, 0x02, 0x5D, 0xE4, 0x3A, 0x9A, 0x6A, 0x25, 0xE8, 0x63, 0x0A, 0xC2, 0xD7, 0xFB, 0xFD, 0x78, 0xBF, 0x2F, 
+    0x86, 0xD7, 0xA3, 0x78, 0x1C, 0x77, 0xFC, 0x59, 0x74, 0x6D, 0x04, 0x7E, 0x21, 0x02, 0x67, 0x10, 0x0D, 0x05, 0x72, 0x66, 
+    0x6B, 0x87, 0x76, 0x1D, 0xA8, 0x09, 0xFE, 0xC0, 0x6C, 0x27, 0x50, 0x33, 0x7B, 0x6D, 0xED, 0x66, 0x86, 0x61, 0x16, 0x7C, 
+    0x46, 0xB2, 0x31, 0xC2, 0xE9, 0xE9, 0x84, 0xC1, 0xA9, 0x1C, 0xF7, 0xB7, 0x75, 0xC3, 0x30, 0x5C, 0xBE, 0x5D, 0x27, 0x0F, 
+    0xAF, 0x8B, 0xDD, 0x8E, 0xFA, 0xB6, 0xED, 0x8D, 0xE7, 0xC9, 0x4E, 0x1B, 0xE9, 0xC0, 0xB9, 0xAD, 0x6B, 0x8B, 0x58, 0x6A, 
+    0x73, 0xD0, 0xC4, 0xD2, 0xE2, 0xFB, 0x05, 0xFD, 0x12, 0x2E, 0x95, 0x38, 0x22, 0x4F, 0x84, 0x3E, 0x31, 0xEB, 0x29, 0xC7, 
+    0x11, 0x2F, 0x11, 0x86, 0x6B, 0x30, 0x04, 0xFA, 0xC0, 0x0D, 0x49, 0xFE, 0x5D, 0x76, 0xCC, 0xEF, 0xBD, 0x96, 0x0F, 0x6C, 
+    0xD9, 0x77, 0x9B, 0x1D, 0x9C, 0xA6, 0x8C, 0x69, 0x48, 0xDA, 0xFD, 0x6C, 0x30, 0xEB, 0xC9, 0xD4, 0x38, 0x37, 0x82, 0x85, 
+    0x76, 0x0E, 0xB8, 0x98, 0x2D, 0x74, 0xD8, 0x39, 0xD6, 0xF9, 0xF8, 0x7B, 0xB1, 0x5D, 0xD3, 0xA0, 0x8A, 0x2F, 0x8B, 0x24, 
+    0x27, 0xD2, 0xC2, 0xD3, 0x51, 0x74, 0xCE, 0xDE, 0x48, 0x28, 0x76, 0xD1, 0x3C, 0x61, 0xAF, 0x99, 0x12, 0x3E, 0x1C, 0xB1, 
+    0xC6, 0x39, 0x58, 0x30, 0xFE, 0x5A, 0xE7, 0x82, 0x4F, 0x33, 0xBB, 0x1A, 0x93, 0x60, 0x90, 0xD2, 0x0E, 0xBC, 0x39, 0x50, 
+    0x4E, 0xF4, 0x85, 0x4A, 0x65, 0xC1, 0x98, 0xBB, 0x25, 0x26, 0x8C, 0xB6, 0xB2, 0x4C, 0xAE, 0xB7, 0x66, 0x3A, 0xCC, 0x3C, 
+    0x8D, 0x8D, 0x28, 0x20, 0xA2, 0x6F, 0xB6, 0xC3, 0x09, 0xFB, 0x2E, 0xC2, 0x87, 0x11, 0x5B, 0xC4, 0xE9, 0x1A, 0x21, 0x19, 
+    0xCA, 0xC1, 0x2D, 0xB1, 0x65, 0x67, 0x6E, 0x16, 0x7A, 0x1C, 0xFB, 0xE3, 0x8E, 0x0C, 0xFC, 0xF4, 0xB4, 0xEC, 0x08, 0x1C, 
+    0x85, 0x21, 0x08, 0xA7, 0x11, 0x16, 0xDB, 0xE9, 0xFD, 0x3E, 0x6B, 0x75, 0x98, 0xC6, 0x81, 0xAC, 0x08, 0xDC, 0x6F, 0xDC, 
+    0xA9, 0xD5, 0xBB, 0x4B, 0x42, 0x45, 0x0F, 0x2F, 0x46, 0xE5, 0x54, 0xB8, 0x1D, 0x0E, 0xAE, 0x87, 0x93, 0xBA, 0x3C, 0xA6, 
+    0x3A, 0x20, 0x42, 0x26, 0xD1, 0x8D, 0x59, 0x14, 0x13, 0xFA, 0x34, 0x60, 0x42, 0x60, 0xA3, 0x57, 0xE0, 0x8B, 0x59, 0x31, 
+    0xCF, 0xB7, 0x12, 0xDC, 0x33, 0x1B, 0xB6, 0xA4, 0x13, 0x10, 0x05, 0x1C, 0x1C, 0x39, 0x07, 0xDD, 0x80, 0x2E, 0x7E, 0xC1, 
+    0xD6, 0x0C, 0x2C, 0xD8, 0x74, 0x13, 0x40, 0x25, 0xD9, 0x21, 0x70, 0x38, 0xE1, 0xB1, 0x72, 0x9A, 0xE7, 0x88, 0xC6, 0x0C, 
+    0x2B, 0x63, 0x2C, 0x8C, 0x0D, 0x56, 0x4C, 0x69, 0x98, 0x46, 0x51, 0x4F, 0x19, 0x4B, 0xEC, 0xD2, 0xE8, 0x7A, 0x38, 0xE3, 
+    0xC5, 0x18, 0xC3, 0x38, 0x8C, 0x76, 0x0F, 0x3F, 0xAA, 0xCE, 0xA4, 0x8C, 0x66, 0x7A, 0xCD, 0x30, 0x01, 0x91, 0x68, 0x49, 
+    0x3E, 0x4F, 0x69, 0xAA, 0xB4, 0xD7, 0xB7, 0xB2, 0x8A, 0x29, 0xD6, 0xD3, 0xD6, 0xC2, 0x6F, 0x04, 0x39, 0x13, 0xB6, 0x26, 
+    0x89, 0x91, 0xAD, 0x18, 0x85, 0xF8, 0x03, 0x1D, 0xF5, 0x3E, 0xBB, 0x82, 0x43, 0x1E, 0x75, 0x63, 0x57, 0x14, 0xB5, 0x06, 
+    0x0E, 0x78, 0x4D, 0x38, 0x67, 0x20, 0xDE, 0x12, 0x92, 0xA1, 0xB7, 0x9B, 0x6E, 0x56, 0xF7, 0x5B, 0x6F, 0x14, 0xA4, 0xD1, 
+    0x04, 0xD7, 0x22, 0x3C, 0x30, 0x1C, 0x19, 0xF2, 0xAE, 0x0F, 0x8A, 0xB9, 0x8D, 0x92, 0xB0, 0xDD, 0x81, 0x30, 0xAD, 0x9C, 
+    0xC7, 0x8A, 0x7F, 0xC2, 0x49, 0x3C, 0x0F, 0xBD, 0x6F, 0x57, 0x27, 0xB2, 0x84, 0x5B, 0x76, 0x62, 0x40, 0xE4, 0x05, 0x80, 
+    0x92, 0x86, 0xB2, 0x5B, 0x61, 0x16, 0x0E, 0x87, 0x43, 0xB5, 0x9E, 0xED, 0x5D, 0x96, 0x11, 0x7F, 0xE1, 0x29, 0x4C, 0x7D, 
+    0x98, 0xBA, 0xC1, 0xCA, 0x13, 0x26, 0x3D, 0xC2, 0xBE, 0x42, 0x80, 0xDF, 0x6F, 0x56, 0x39, 0x5F, 0xD0, 0x84, 0x04, 0x6C, 
+    0xC5, 0x2E, 0x81, 0x85, 0xA0, 0x72, 0x91, 0x4D, 0xF8, 0x74, 0xB7, 0x99, 0x87, 0x74, 0xD4, 0xF3, 0xA5, 0xB0, 0x47, 0x27, 
+    0xAD, 0xA7, 0x66, 0xDB, 0xAF, 0xE9, 0xCC, 0x9B, 0x87, 0xAF, 0xB4, 0x0C, 0xF7, 0x31, 0xC3, 0x5C, 0x28, 0x89, 0x86, 0x05, 
+    0x6F, 0x93, 0xEB, 0xCD, 0x0A, 0x8D, 0x73, 0x40, 0x5C, 0xA0, 0x14, 0xD0, 0x31, 0x78, 0xD0, 0x18, 0xE3, 0x0D, 0x57, 0x05, 
+    0x0D, 0xF1, 0x99, 0x1C, 0x9D, 0xE7, 0x0F, 0x67, 0xF7, 0xF7, 0xF7, 0x67, 0x50, 0x6C, 0x3C, 0xA3, 0xE6, 0x58, 0x2E, 0x58, 
+    0xE4, 0x03, 0xB0, 0x50, 0x1B, 0x78, 0xB0, 0xFA, 0xE1, 0xCD, 0x17, 0x67, 0xFF, 0xE5, 0x29, 0x89, 0x71, 0x0B, 0xD7, 0x95, 
+    0xCF, 0xBD, 0xF0, 0x2F, 0xD4, 0x25, 0xC4, 0x80, 0x15, 0xE2, 0x8A, 0x28, 0xCC, 0xD9, 0xD2, 0x93, 0x18, 0x88, 0x92, 0x82, 
+    0x47, 0x4F, 0x3D, 0xE0, 0xBD, 0xD2, 0xD2, 0x62, 0xAE, 0x4E, 0x2C, 0x3D, 0xA6, 0xAE, 0xB7, 0xEC, 0xC9, 0xD9, 0xC9, 0x80, 
+    0x14, 0x9D, 0xE3, 0x3A, 0x79, 0x9B, 0xE8, 0x70, 0x65, 0x07, 0xD3, 0x77, 0x6A, 0x1D, 0x75, 0xA2, 0xF4, 0xB9, 0x34, 0xC7, 
+    0x2D, 0x9D, 0x4B, 0x4D, 0x5C, 0xFA, 0x1C, 0xB2, 0x30, 0x77, 0xBB, 0x48, 0x11, 0xCF, 0x24, 0x12, 0x2D, 0xE5, 0xE9, 0xBE, 
+    0x9B, 0x24, 0xDC, 0xE2, 0x98, 0xCE, 0x98, 0x34, 0x50, 0xAF, 0xD2, 0xAE, 0xDE, 0xB8, 0x18, 0x37, 0x77, 0xCC, 0x0B, 0x85, 
+    0xB4, 0x14, 0xC2, 0xF2, 0x84, 0x47, 0x8A, 0xE9, 0x95, 0x57, 0xD4, 0x02, 0x06, 0xDF, 0x92, 0xFB, 0x3A, 0x1D, 0xE3, 0x0D, 
+    0x4B, 0x32, 0x98, 0x8E, 0xD2, 0xF2, 0x18, 0x91, 0x55, 0x36, 0x2B, 0xF4, 0x00, 0x2F, 0xA3, 0x07, 0x0B, 0x07, 0x77, 0x47, 
+    0xEE, 0x7F, 0xD2, 0x98, 0x4E, 0x2A, 0x3E, 0xAC, 0xAA, 0xE7, 0x13, 0x24, 0x2C, 0xE1, 0xB7, 0x70, 0x29, 0xE2, 0xA6, 0x42, 
+    0xE5, 0x85, 0x6B, 0xFC, 0xDE, 0x9A, 0xC8, 0x11, 0x25, 0xF3, 0x25, 0x0E, 0x1B, 0x4A, 0x7C, 0xB3, 0x49, 0x96, 0x34, 0xEC, 
+    0xCD, 0x0E, 0x89, 0x5F, 0xE9, 0xC4, 0x5A, 0xB3, 0x4D, 0x23, 0x38, 0x41, 0x36, 0xAE, 0xE1, 0x0E, 0xD4, 0xB1, 0xB5, 0x63, 
+    0x17, 0x47, 0xE2, 0xC8, 0x2E, 0x2A, 0x6E, 0xCA, 0x63, 0xF4, 0x6E, 0xAD, 0xCD, 0x65, 0x11, 0x75, 0x59, 0x0F, 0x79, 0xBF, 
+    0xBF, 0x51, 0xCB, 0xF2, 0x95, 0xAA, 0x9E, 0x3B, 0x51, 0x51, 0xE7, 0xBD, 0xEB, 0xDB, 0xBB, 0x62, 0xF3, 0x08, 0xB7, 0x5D, 
+    0x73, 0x66, 0x35, 0x10, 0x0C, 0x59, 0xAD, 0x2A, 0x96, 0xCA, 0x6A, 0x4D, 0xAF, 0x2F, 0x93, 0xF9, 0x1C, 0x2E, 0x37, 0x61, 
+    0xD0, 0xB5, 0xCC, 0x8A, 0x93, 0x45, 0xB1, 0x58, 0x6D, 0xE0, 0x85, 0xE1, 0x16, 0x48, 0x8F, 0x36, 0xE7, 0xDD, 0xF6, 0x25, 
+    0x55, 0xCB, 0x01, 0x25, 0x37, 0x40, 0xF1, 0x5B, 0xFC, 0xD9, 0x11, 0x4D, 0x76, 0x17, 0x79, 0x59, 0x42, 0x45, 0xA0, 0x53, 
+    0xA7, 0xDE, 0x46, 0x4F, 0x90, 0xEE, 0x3F, 0xBE, 0xE6, 0xED, 0xDC, 0x57, 0x8D, 0xD3, 0xB1, 0xC5, 0x17, 0x12, 0xE1, 0x9E, 
+    0x17, 0x90, 0xB5, 0xC8, 0x51, 0x76, 0x1D, 0x3C, 0xE1, 0x08, 0xB1, 0x92, 0xAA, 0x97, 0x99, 0x89, 0x7E, 0x4E, 0x27, 0x44, 
+    0xDA, 0x8C, 0x8D, 0x49, 0x54, 0xC1, 0x8B, 0xD1, 0x21, 0x25, 0xD4, 0x97, 0xD4, 0xBE, 0x1C, 0x2A, 0x3A, 0x5D, 0xA9, 0x68, 
+    0x1E, 0xA6, 0x07, 0xF4, 0xE9, 0xD3, 0xF9, 0xBC, 0xDA, 0xAD, 0xB6, 0x28, 0x1C, 0xDC, 0xA9, 0x78, 0xAC, 0x2F, 0x98, 0xB7, 
+    0x18, 0x09, 0x4D, 0xE6, 0x76, 0xD7, 0x18, 0x88, 0x7B, 0xB5, 0x5C, 0xE9, 0x82, 0xF5, 0xAE, 0x05, 0xAD, 0xB9, 0x08, 0x22, 
+    0xA3, 0x48, 0xA2, 0x72, 0x26, 0x0A, 0x5E, 0x6D, 0x70, 0x16, 0x89, 0xB4, 0x12, 0x72, 0x8B, 0xCD, 0x2C, 0x2F, 0xBE, 0xD1, 
+    0x84, 0x45, 0xAB, 0x8A, 0x16, 0x2B, 0x3B, 0x1A, 0xD2, 0x23, 0x4A, 0x4C, 0xD9, 0x72, 0x71, 0xDA, 0xE7, 0x96, 0x2D, 0xF2, 
+    0x5F, 0x5C, 0xEE, 0x02, 0xEB, 0x50, 0x20, 0x09, 0x6E, 0x21, 0x89, 0x19, 0xE2, 0xAF, 0xC2, 0x4D, 0x9A, 0x50, 0x15, 0x27, 
+    0x6F, 0x8D, 0x0D, 0x6B, 0x32, 0x7C, 0xAB, 0xD7, 0x7C, 0x54, 0x8B, 0x72, 0x4B, 0x1C, 0xCF, 0xA6, 0xF5, 0x02, 0x69, 0xBF, 
+    0xBF, 0x33, 0x39, 0x71, 0xFA, 0xF5, 0x38, 0x23, 0xF4, 0x17, 0x61, 0xAD, 0x6E, 0xC6, 0x79, 0x40, 0x7F, 0x56, 0xD6, 0x24, 
+    0xFC, 0x6D, 0x50, 0x1A, 0x37, 0xAE, 0x21, 0x6A, 0x54, 0xD4, 0xAC, 0x1C, 0x00, 0xD1, 0x5B, 0xB1, 0xBB, 0x7D, 0x2B, 0x1C, 
+    0x1D, 0xBD, 0xC2, 0xC8, 0x16, 0xE7, 0xD8, 0x66, 0x1E, 0xF9, 0x90, 0x6D, 0xF3, 0xE3, 0x7E, 0xFF, 0x5B, 0x06, 0x9F, 0x96, 
+    0xA5, 0xEC, 0xED, 0x53, 0xD6, 0x18, 0xB2, 0xAF, 0x5F, 0x64, 0x8A, 0xD1, 0x7C, 0xD7, 0x3B, 0x3F, 0x67, 0x35, 0x6E, 0xBE, 
+    0xC2, 0x49, 0x7B, 0x8B, 0x62, 0x37, 0x5D, 0xE5, 0xA0, 0xDF, 0xE4, 0x9E, 0xE7, 0xC6, 0xA6, 0x48, 0x16, 0xCA, 0x69, 0xE9, 
+    0x17, 0x23, 0x2A, 0x28, 0x93, 0x98, 0x4D, 0x08, 0x8E, 0x73, 0x22, 0x9E, 0x37, 0xD2, 0x1A, 0x60, 0xB4, 0x31, 0x89, 0x41, 
+    0xDE, 0xBE, 0x5A, 0x2D, 0x08, 0xD1, 0x33, 0x57, 0x63, 0xD8, 0x25, 0xEE, 0x7F, 0x8D, 0x63, 0x52, 0x95, 0xEC, 0x11, 0x34, 
+    0x5E, 0x11, 0xFA, 0x8A, 0xE9, 0x00, 0x1E, 0x06, 0x31, 0xC9, 0x04, 0xED, 0xF2, 0xF6, 0x42, 0x88, 0x1C, 0x76, 0xA4, 0xE4, 
+    0x4D, 0x77, 0xBB, 0x75, 0xC8, 0xC2, 0x58, 0x78, 0x14, 0xF2, 0xFE, 0xAB, 0xEF, 0x85, 0xDE, 0x47, 0x1F, 0x7D, 0x48, 0xD4, 
+    0x27, 0x5C, 0x64, 0x3C, 0x36, 0xB2, 0x3D, 0x36, 0xF2, 0x71, 0xEB, 0x18, 0xE0, 0xE9, 0xE9, 0x4D, 0xCF, 0x39, 0x09, 0x4B, 
+    0x31, 0xB8, 0x65, 0x2E, 0x4C, 0x3E, 0x3D, 0x23, 0x11, 0x63, 0xE7, 0xC4, 0x4C, 0x10, 0x26, 0x19, 0xFA, 0x55, 0x00, 0x10, 
+    0x58, 0xC1, 0xA8, 0x6F, 0x80, 0x2F, 0xD5, 0x0D, 0x91, 0x8B, 0x6F, 0x03, 0x25, 0x3B, 0xDD, 0xF8, 0x4C, 0x1C, 0x4C, 0xA1, 
+    0x02, 0xC9, 0x07, 0xB0, 0x9A, 0x8A, 0xFF, 0x57, 0xC4, 0x84, 0xC7, 0x41, 0xDF, 0xED, 0x32, 0x81, 0xCF, 0x61, 0xDD, 0x8D, 
+    0xC8, 0xCF, 0x63, 0x44, 0x08, 0x9B, 0x9C, 0x72, 0x2D, 0xE5, 0xA7, 0x1A, 0x2B, 0x00, 0x17, 0xB0, 0xC9, 0x56, 0x93, 0xE1, 
+    0x51, 0xE7, 0x73, 0x7D, 0xE0, 0x4B, 0x56, 0x18, 0x6F, 0xF0, 0xE4, 0x57, 0x72, 0xF1, 0xE6, 0xD2, 0xC3, 0xD2, 0xDF, 0xBB, 
+    0x91, 0x7F, 0x6F, 0xAD, 0x13, 0x63, 0xEF, 0x94, 0xA6, 0x2A, 0xF6, 0x82, 0xAE, 0x1E, 0xA5, 0xBE, 0xC7, 0x97, 0x37, 0x5E, 
+    0x39, 0x62, 0xDA, 0xC4, 0x42, 0x94, 0x67, 0x06, 0x80, 0xFA, 0x59, 0x59, 0xBC, 0x94, 0x27, 0x7D, 0x46, 0x10, 0xFA, 0xEC, 
+    0xE2, 0xD7, 0xC8, 0xEB, 0xBE, 0x85, 0xA4, 0x39, 0x2C, 0xBA, 0xAD, 0xCD, 0x78, 0x36, 0x07, 0x5B, 0x33, 0x8C, 0x0D, 0xC5, 
+    0xC3, 0xF1, 0x7B, 0x5D, 0x12, 0x88, 0x2D, 0x2A, 0xDF, 0xF6, 0xEA, 0xF8, 0xC9, 0xF7, 0xBE, 0x1A, 0x9F, 0x99, 0x3C, 0x67, 
+    0xAF, 0x67, 0x84, 0xA1, 0x3D, 0xD5, 0x28, 0xC9, 0x12, 0x68, 0xA2, 0x9F, 0xDE, 0x55, 0xC9, 0xB7, 0xB4, 0x11, 0xE1, 0xAF, 
+    0x2C, 0x9B, 0x7A, 0x65, 0x6E, 0xEA, 0x95, 0x5F, 0xC2, 0x4B, 0x39, 0x8F, 0x78, 0x73, 0xE8, 0x25, 0xB6, 0x95, 0xC4, 0x36, 
+    0x73, 0xD2, 0x82, 0xF6, 0x96, 0x2A, 0x5C, 0x93, 0xAA, 0xD4, 0x12, 0xA8, 0xB6, 0x02, 0x9F, 0x32, 0x5D, 0xE5, 0xB9, 0x5B, 
+    0x95, 0xD9, 0x97, 0x9B, 0x9E, 0xA6, 0xB8, 0x86, 0xD5, 0x2F, 0xA3, 0xF8, 0xE8, 0x97, 0xAE, 0x26, 0xDC, 0xAB, 0xC9, 0xB1, 
+    0xA7, 0x88, 0x48, 0xFD, 0x4B, 0xD6, 0xF5, 0x06, 0x27, 0xB7, 0x51, 0xBF, 0xD7, 0x67, 0xB7, 0xB9, 0x41, 0x58, 0x56, 0xC3, 
+    0x66, 0xF9, 0x25, 0x23, 0x4B, 0x13, 0x21, 0xA7, 0x49, 0xD0, 0xD2, 0x5F, 0x98, 0xC7, 0xE8, 0xCF, 0xCC, 0xC7, 0x82, 0x1B, 
+    0xEA, 0x49, 0xC4, 0xD3, 0xD7, 0x44, 0xE0, 0x8A, 0x3F, 0x79, 0xFB, 0x2A, 0x97, 0x41, 0x73, 0xF5, 0x56, 0xDD, 0x04, 0x91, 
+    0x4C, 0xA2, 0x6C, 0x1D, 0xBB, 0x77, 0x34, 0x8A, 0x0D, 0x06, 0x74, 0x00, 0xF3, 0xA3, 0x67, 0x3B, 0xF2, 0xA4, 0xB1, 0x68, 
+    0x78, 0xA1, 0x69, 0xF1, 0x0B, 0x65, 0xED, 0xEC, 0x2F, 0x0E, 0xC1, 0x5B, 0x6A, 0x9F, 0x38, 0x31, 0xDD, 0x89, 0x59, 0xF4, 
+    0x0D, 0x68, 0x17, 0xBD, 0x41, 0x09, 0xA1, 0xF7, 0xCA, 0x13, 0x3C, 0xBA, 0xC0, 0xB6, 0x5C, 0xD6, 0x36, 0x20, 0x47, 0x6E, 
+    0x1D, 0x52, 0xCF, 0x46, 0x00, 0x4D, 0x26, 0x93, 0x31, 0xEB, 0x3B, 0x31, 0x01, 0xBB, 0xEC, 0x33, 0xC7, 0xD2, 0xEE, 0xA4, 
+    0xCC, 0xF4, 0xDA, 0xD3, 0x99, 0xBD, 0x00, 0x7A, 0xDA, 0xFA, 0x25, 0x10, 0xE1, 0xD4, 0x0E, 0x2E, 0xDC, 0x68, 0xFE, 0x88, 
+    0xE8, 0xDF, 0xA8, 0x07, 0xC3, 0x72, 0xDC, 0x0B, 0x79, 0xC0, 0x27, 0x59, 0xC0, 0x5C, 0xCA, 0xC9, 0xFD, 0xE0, 0xC1, 0x3F, 
+    0xBB, 0x50, 0xF0, 0xC8, 0xC7, 0xE7, 0x17, 0xBF, 0x81, 0xE5, 0xB0, 0x64, 0x99, 0xE7, 0x38, 0x23, 0x7D, 0xA8, 0x72, 0xAC, 
+    0xD7, 0x6A, 0xA3, 0xB6, 0xEA, 0x4E, 0xDD, 0xAB, 0x87, 0x28, 0x1D, 0x40, 0xFD, 0x05, 0xC4, 0xD3, 0x2E, 0x7A, 0x01, 0x7F, 
+    0x32, 0x15, 0x93, 0xB6, 0x09, 0xB8, 0x3F, 0xAD, 0xBD, 0x33, 0x66, 0xFF, 0x38, 0x44, 0xE7, 0xB8, 0x93, 0x94, 0x5C, 0xF6, 
+    0xE3, 0x8F, 0x88, 0xD8, 0xB9, 0xA6, 0xA7, 0xE8, 0x45, 0x9F, 0xC6, 0xFF, 0x61, 0xBF, 0x7F, 0x49, 0x67, 0xD4, 0x87, 0xFD, 
+    0x8F, 0x20, 0x9A, 0x67, 0xED, 0xD0, 0xBB, 0xE8, 0x3B, 0x78, 0xCF, 0x78, 0xCB, 0x3E, 0xBD, 0xEF, 0xA2, 0xEF, 0xF1, 0x72, 
+    0x47, 0xAF, 0xD7, 0x81, 0xBA, 0x8E, 0xFD, 0xDA, 0x0E, 0xBF, 0xA7, 0x03, 0xAF, 0x45, 0xB0, 0xF0, 0x35, 0x6D, 0x5E, 0xBB, 
+    0xA7, 0x09, 0x05, 0xDE, 0xB7, 0x21, 0x83, 0xE8, 0x9E, 0x3E, 0xB4, 0x97, 0xC7, 0xDE, 0xB5, 0xC5, 0xF4, 0x46, 0xA6, 0xEC, 
+    0x84, 0x95, 0xA5, 0xA3, 0x34, 0x34, 0xC8, 0x23, 0x71, 0x40, 0x08, 0xAE, 0x8C, 0x1F, 0xE0, 0x83, 0xCB, 0x44, 0x23, 0x08, 
+    0xF5, 0x78, 0x24, 0x75, 0xB7, 0x30, 0x1D, 0x09, 0xFD, 0x87, 0xE8, 0x8E, 0x09, 0x86, 0x82, 0x68, 0xC3, 0x3B, 0xC1, 0x8F, 
+    0x5B, 0x7A, 0x60, 0xE0, 0xA3, 0x69, 0xE9, 0x6C, 0x21, 0x39, 0xDB, 0x46, 0x0F, 0x0A, 0x27, 0x77, 0xE7, 0x01, 0x17, 0x86, 
+    0x54, 0x87, 0x66, 0x17, 0x69, 0xAA, 0xD8, 0x9A, 0xBA, 0x8F, 0x33, 0xC8, 0x10, 0x1E, 0x34, 0x6B, 0xE6, 0x91, 0x75, 0xC5, 
+    0x70, 0x45, 0xF3, 0x80, 0xA3, 0x9E, 0x66, 0x6B, 0x55, 0xF1, 0x64, 0x32, 0x57, 0x43, 0x02, 0x13, 0xF5, 0x76, 0x14, 0x84, 
+    0x2B, 0xD7, 0x97, 0xC9, 0x1C, 0x20, 0xFA, 0xA0, 0xB6, 0xA3, 0xB2, 0x52, 0x10, 0x49, 0x3E, 0x5C, 0x37, 0x99, 0xE5, 0xAC, 
+    0x00, 0xF7, 0x75, 0x2C, 0xE0, 0xAD, 0x59, 0xD0, 0x90, 0xDF, 0x3E, 0x97, 0x3E, 0x02, 0xDA, 0xA9, 0xE5, 0x4D, 0x88, 0xEA, 
+    0xD6, 0xEC, 0x19, 0xCD, 0x69, 0x84, 0xD2, 0x10, 0x90, 0xBA, 0xB6, 0x4F, 0x5E, 0xEA, 0x2D, 0x67, 0xF7, 0xCA, 0xD9, 0x99, 
+    0x39, 0xDC, 0x58, 0x54, 0xDD, 0x76, 0xB4, 0xAD, 0xD8, 0xB4, 0xC4, 0xFA, 0x14, 0x66, 0x62, 0x95, 0xEF, 0x03, 0x8E, 0x2A, 
+    0x99, 0x4E, 0x8C, 0xCA, 0xA8, 0xF2, 0x98, 0x85, 0x0A, 0xB8, 0xCC, 0x6B, 0xE6, 0xFF, 0x8E, 0x99, 0x54, 0x48, 0x19, 0x3D, 
+    0x07, 0x69, 0x19, 0xDC, 0xBA, 0xA2, 0xB0, 0x03, 0x25, 0x2C, 0x85, 0x88, 0x6A, 0x2D, 0x6A, 0x88, 0xF5, 0x8B, 0xBC, 0x8A, 
+    0x89, 0x75, 0x4D, 0x04, 0xCB, 0x07, 0x2A, 0x1C, 0x5F, 0xC0, 0xF4, 0x5D, 0x65, 0x96, 0xE9, 0x11, 0xB6, 0xC6, 0x67, 0x16, 
+    0x2E, 0x11, 0x3E, 0x3D, 0x55, 0x06, 0xFD, 0x86, 0x85, 0x48, 0x00, 0x32, 0x65, 0x50, 0x59, 0x5E, 0x33, 0x0D, 0x2F, 0x49, 
+    0x01, 0x55, 0xCE, 0x9D, 0xAA, 0x4D, 0xBC, 0xBB, 0x84, 0x95, 0xC5, 0x55, 0x25, 0x26, 0x1B, 0xBD, 0xF7, 0xA2, 0xB2, 0xED, 
+    0x72, 0x4E, 0x77, 0xC6, 0x04, 0xD7, 0x6E, 0xCB, 0xDD, 0x32, 0x40, 0x11, 0x44, 0xD8, 0x41, 0x9A, 0x89, 0x37, 0xA2, 0x86, 
+    0x0B, 0x2B, 0x8C, 0x20, 0x3C, 0xA6, 0x25, 0x31, 0xE0, 0x69, 0x83, 0x9A, 0x9B, 0x8E, 0xFB, 0x4D, 0xB2, 0x46, 0x20, 0x6C, 
+    0xB7, 0xD1, 0xFF, 0xAE, 0x7E, 0x89, 0xAE, 0xAB, 0xAA, 0x5B, 0x62, 0x94, 0x49, 0xB4, 0x89, 0xA2, 0x55, 0xA2, 0x3B, 0x16, 
+    0xBD, 0x3D, 0x40, 0xA4, 0xF8, 0x7E, 0x50, 0x86, 0xC9, 0x1E, 0x98, 0x6C, 0x55, 0x7D, 0x31, 0x37, 0xDC, 0xB7, 0xAD, 0x5C, 
+    0xA5, 0x6C, 0x48, 0xD8, 0xF0, 0x8F, 0xCC, 0x2E, 0x8E, 0x84, 0x0D, 0x4C, 0x9C, 0x88, 0xF0, 0xC6, 0x50, 0xA1, 0x4C, 0x29, 
+    0x6D, 0x16, 0x92, 0x4A, 0x7A, 0x19, 0x30, 0xC8, 0x04, 0xF2, 0xD3, 0x5E, 0x92, 0x2B, 0x2C, 0x0D, 0x26, 0xE0, 0xAB, 0xE5, 
+    0xB2, 0x78, 0x8F, 0x5D, 0xCC, 0x51, 0x75, 0x8E, 0xDA, 0x5C, 0x72, 0x55, 0x8D, 0xD9, 0x0C, 0x1B, 0xFE, 0x36, 0x8C, 0x8A, 
+    0x06, 0x87, 0xBC, 0xD2, 0x42, 0x1A, 0x98, 0xC9, 0x9B, 0xFB, 0xDB, 0xAC, 0x5C, 0x99, 0x20, 0x34, 0x31, 0xF3, 0x7C, 0x71, 
+    0x4E, 0x81, 0x2F, 0xAD, 0x3A, 0x8E, 0x95, 0x2E, 0x0E, 0x8E, 0xAF, 0x7F, 0xD6, 0x5C, 0xFF, 0xB4, 0x6A, 0x25, 0x1A, 0x84, 
+    0xD2, 0xD4, 0xDD, 0xB2, 0xDA, 0x58, 0x75, 0x66, 0x64, 0x75, 0xE1, 0xF1, 0xA5, 0x61, 0x3A, 0x64, 0x95, 0xDF, 0x45, 0x57, 
+    0x43, 0x62, 0x3E, 0x22, 0xE6, 0xB7, 0x51, 0x6B, 0xB2, 0x21, 0xDC, 0xB5, 0xEE, 0x08, 0x56, 0x0C, 0x70, 0x42, 0xEB, 0xA3, 
+    0x3D, 0xC8, 0x18, 0x7D, 0xD8, 0xF5, 0x46, 0xFB, 0x9C, 0xD9, 0x1A, 0xFF, 0x7B, 0xED, 0xD1, 0x8A, 0xCB, 0xB8, 0x11, 0x9F, 
+    0x44, 0x7D, 0xC8, 0x77, 0xDD, 0x38, 0x42, 0x94, 0x44, 0x47, 0x4F, 0xE9, 0xAB, 0xBF, 0x12, 0x83, 0xD3, 0x0F, 0x1C, 0x4F, 
+    0x91, 0x26, 0x78, 0x87, 0x8D, 0x00, 0x53, 0x86, 0xA9, 0x6A, 0x89, 0x5A, 0x71, 0xA8, 0x77, 0x91, 0xA3, 0xAA, 0xCD, 0x8B, 
+    0x96, 0x3E, 0x76, 0x5A, 0x07, 0x83, 0x35, 0x65, 0xC9, 0xCF, 0xDF, 0xB2, 0xE8, 0xFC, 0x3F, 0x5F, 0xF4, 0xCF, 0x27, 0xEA, 
+    0xEF, 0xB8, 0x82, 0x1F, 0x5E, 0x8D, 0x9E, 0x9D, 0xAB, 0xD7, 0x6C, 0x56, 0x1C, 0x5F, 0x2D, 0x29, 0xF9, 0x8D, 0xBE, 0x37, 
+    0x14, 0xA5, 0x0C, 0xA3, 0x14, 0x3D, 0x5B, 0xE0, 0xD2, 0x91, 0x4E, 0xC4, 0x62, 0xC7, 0xB7, 0x8D, 0xAC, 0x1E, 0xFD, 0xC3, 
+    0x3B, 0xD5, 0xA9, 0x6F, 0x8A, 0xC7, 0x49, 0xB1, 0x0C, 0xCE, 0x67, 0x25, 0x75, 0xF4, 0x8F, 0xBA, 0x40, 0xBF, 0xE1, 0x2B, 
+    0x5F, 0x63, 0xDE, 0x8A, 0x97, 0x00, 0x5C, 0xE4, 0xEE, 0xF7, 0x7F, 0x37, 0x4A, 0xB1, 0x41, 0x4C, 0x10, 0x8A, 0xC0, 0x09, 
+    0xA8, 0xAD, 0xEB, 0x0D, 0x3D, 0xA2, 0xAB, 0xEB, 0xD2, 0xAF, 0x22, 0x4E, 0x41, 0x44, 0x77, 0xBD, 0x91, 0xA7, 0x0A, 0x51, 
+    0x71, 0x08, 0xAC, 0xF8, 0x9C, 0x2A, 0x33, 0x05, 0x3A, 0x1C, 0x04, 0x82, 0xCA, 0xA0, 0xED, 0x9C, 0x51, 0x73, 0xCD, 0x9B, 
+    0x4C, 0x1A, 0xD8, 0x66, 0x0A, 0xAE, 0x0E, 0x61, 0xDF, 0xA4, 0x46, 0xCD, 0x91, 0x46, 0xAD, 0x26, 0x50, 0x70, 0x63, 0x51, 
+    0xD4, 0x3E, 0xD5, 0x36, 0x4F, 0x1A, 0xC4, 0xA9, 0x6F, 0xCC, 0x71, 0x53, 0x68, 0x1E, 0xD1, 0xD1, 0x34, 0x34, 0xA6, 0xAA, 
+    0xA3, 0x48, 0x44, 0xBD, 0x3F, 0xFC, 0xFD, 0x2B, 0x1C, 0x35, 0x04, 0x36, 0x4B, 0x0C, 0xBE, 0xEB, 0x11, 0xC7, 0xD6, 0xF2, 
+    0x25, 0x0D, 0x58, 0xEE, 0x61, 0x6F, 0x91, 0x52, 0xAD, 0x45, 0xED, 0x8A, 0x19, 0xC1, 0xEB, 0x56, 0x2E, 0xCB, 0x5C, 0x16, 
+    0xDA, 0x71, 0x98, 0x08, 0x43, 0xB7, 0x44, 0x0B, 0xF5, 0xB4, 0xEF, 0xAB, 0xEF, 0x21, 0x43, 0xB6, 0x6E, 0x92, 0xCC, 0x32, 
+    0x25, 0xAE, 0xD6, 0xAB, 0x6C, 0x42, 0x36, 0xC7, 0x50, 0xA5, 0x5D, 0xB4, 0x9D, 0x78, 0xC7, 0x79, 0x23, 0xCD, 0x68, 0xA6, 
+    0xD8, 0x49, 0x23, 0x16, 0xB7, 0xF4, 0xA3, 0x75, 0xBD, 0x9A, 0x2D, 0x7D, 0xE2, 0x4D, 0x4B, 0xC9, 0xCA, 0xDF, 0x88, 0xE0, 
+    0xE8, 0x7A, 0xF5, 0x93, 0x89, 0xD0, 0xFB, 0x8C, 0x75, 0x9E, 0x5B, 0x30, 0x86, 0x11, 0x13, 0x88, 0x73, 0x77, 0x93, 0x51, 
+    0xC6, 0x85, 0x7D, 0x54, 0x4D, 0x3A, 0x86, 0x72, 0x5A, 0x8F, 0x0A, 0x6D, 0x20, 0x28, 0xA8, 0xA6, 0xD0, 0xEA, 0x02, 0xA5, 
+    0x5E, 0x07, 0x34, 0x09, 0x4B, 0xA3, 0x5A, 0xAD, 0xA5, 0x47, 0x58, 0x46, 0x7B, 0xB2, 0x6A, 0x3D, 0x79, 0x18, 0xF6, 0x2A, 
+    0x28, 0x74, 0xC9, 0x8A, 0x6D, 0x1D, 0x83, 0xC1, 0x66, 0x5B, 0xDF, 0x0B, 0x4B, 0x6B, 0xE2, 0xD3, 0xD3, 0x1F, 0xF4, 0x36, 
+    0xA8, 0x58, 0xB1, 0x23, 0x32, 0xF6, 0x1B, 0xBB, 0x3F, 0xAC, 0xA2, 0x9C, 0xB6, 0x07, 0xDD, 0x77, 0x7E, 0x34, 0x9F, 0x02, 
+    0x8E, 0xF6, 0xE9, 0x8C, 0xCD, 0xF5, 0x6D, 0xE3, 0x5A, 0xEC, 0x57, 0x7D, 0xC7, 0x67, 0x22, 0xD6, 0x2C, 0x21, 0x24, 0x0B, 
+    0x62, 0x31, 0xCC, 0xCF, 0x5A, 0x0C, 0xF3, 0x9F, 0x30, 0x06, 0x3A, 0x4D, 0x18, 0x12, 0xC4, 0xB2, 0x25, 0xB1, 0x2B, 0xFA, 
+    0x9A, 0x56, 0x14, 0x8A, 0x0E, 0x4C, 0x07, 0x86, 0x2D, 0x59, 0xB3, 0xF6, 0xAC, 0x4C, 0x4E, 0x6A, 0x64, 0x5D, 0x81, 0xE1, 
+    0x87, 0xE9, 0x26, 0xB2, 0x37, 0xBB, 0x49, 0xAF, 0xA2, 0x3B, 0x12, 0x37, 0x96, 0xB7, 0xC3, 0x33, 0xA3, 0x2F, 0x69, 0x4E, 
+    0x4F, 0x09, 0x7D, 0x51, 0xBD, 0x7B, 0xD0, 0x9F, 0x7B, 0xB0, 0xCD, 0x7B, 0x20, 0x32, 0x11, 0xBA, 0xEC, 0xB5, 0xB1, 0x34, 
+    0x30, 0x9D, 0x33, 0xE5, 0x3B, 0x91, 0x2D, 0xFC, 0x33, 0x83, 0x4F, 0x99, 0x67, 0xF4, 0xF7, 0x10, 0xFE, 0x33, 0x63, 0xCC, 
+    0xFA, 0x23, 0x14, 0xFD, 0x7E, 0x62, 0x8D, 0x88, 0x9F, 0xB3, 0xA8, 0xD9, 0x4B, 0x9A, 0xD4, 0x5A, 0xF7, 0x68, 0x3F, 0x42, 
+    0x45, 0x0C, 0xDA, 0x3A, 0xA2, 0x6B, 0xE7, 0xB9, 0xFB, 0xC9, 0xE8, 0x12, 0x26, 0xD8, 0x34, 0x3F, 0x65, 0xC1, 0x4F, 0xD9, 
+    0x30, 0x19, 0xE9, 0x0D, 0xCE, 0xA1, 0x3A, 0x58, 0x1E, 0xB4, 0xDA, 0x6C, 0xA3, 0x4E, 0xE7, 0x67, 0xC4, 0x5C, 0xBC, 0xA7, 
+    0x63, 0xEE, 0xE5, 0xA6, 0x20, 0x6C, 0xBF, 0x23, 0x10, 0xDF, 0xC2, 0xB8, 0xE1, 0xE7, 0x0C, 0x7D, 0xB9, 0xE1, 0xBE, 0x70, 
+    0x36, 0xF5, 0x73, 0x66, 0xB0, 0x80, 0xE5, 0x5F, 0xFD, 0x1A, 0x85, 0xD7, 0x49, 0x5C, 0x01, 0x21, 0x84, 0x95, 0x68, 0xA5, 
+    0x1A, 0x54, 0xE0, 0x09, 0x9C, 0xB3, 0x13, 0xD3, 0xC5, 0xB9, 0xA2, 0xA5, 0x45, 0xE0, 0xD1, 0xC2, 0xF5, 0x79, 0xF7, 0xC7, 
+    0x8C, 0xED, 0x3E, 0x7B, 0xAB, 0x35, 0xCE, 0x20, 0x91, 0x7A, 0x26, 0x2C, 0x17, 0x4B, 0x84, 0xA7, 0xC7, 0x1B, 0xED, 0x49, 
+    0x06, 0x00, 0x18, 0x08, 0x6C, 0xB7, 0xF7, 0xAB, 0x4D, 0x0E, 0x6B, 0x4C, 0xAA, 0x44, 0xAE, 0x88, 0xCA, 0x1B, 0xCC, 0x4A, 
+    0x22, 0xD8, 0x4A, 0x27, 0x81, 0x5E, 0x07, 0xE5, 0xA5, 0xF9, 0xE9, 0xE9, 0xB8, 0x57, 0x97, 0x77, 0xB7, 0xA5, 0xF9, 0x65, 
+    0x11, 0xB4, 0x59, 0x19, 0x77, 0x36, 0xF4, 0x7E, 0x3A, 0xD3, 0xE2, 0x95, 0x22, 0x3F, 0x03, 0x15, 0xE1, 0x71, 0x9C, 0xB1, 
+    0xB6, 0xF4, 0xC8, 0xFB, 0xE9, 0x9B, 0xAF, 0xBF, 0xDC, 0xED, 0xD6, 0xFA, 0x83, 0xF6, 0x9C, 0x58, 0xC8, 0xFD, 0x79, 0x69, 
+    0xAB, 0xC2, 0x32, 0xB0, 0x71, 0x53, 0x70, 0x43, 0xA7, 0x14, 0xE2, 0x89, 0x42, 0x4F, 0x6C, 0x2C, 0x62, 0x89, 0xA4, 0x22, 
+    0xF0, 0x92, 0x7B, 0x62, 0x71, 0x48, 0xC6, 0xFE, 0xB5, 0xCA, 0xA9, 0xD7, 0xC1, 0xE3, 0xF8, 0x26, 0x87, 0x23, 0xC4, 0x81, 
+    0x19, 0xDA, 0xEF, 0xC1, 0x45, 0x8F, 0x1D, 0x09, 0x02, 0x5F, 0x27, 0x6B, 0x81, 0x22, 0xC1, 0xD2, 0x84, 0xB0, 0xAF, 0x15, 
+    0x38, 0x10, 0x0C, 0x72, 0x46, 0x66, 0xAF, 0x45, 0x39, 0x93, 0x55, 0xF5, 0x56, 0x6B, 0xAA, 0xFD, 0xA3, 0x4E, 0xB5, 0x22, 
+    0xF4, 0xDF, 0x88, 0x85, 0x58, 0x51, 0x80, 0x6F, 0xE3, 0xA7, 0x94, 0x47, 0x18, 0xE0, 0xA6, 0x13, 0x8A, 0x71, 0xCF, 0xBD, 
+    0xCC, 0xA3, 0xEE, 0x5D, 0xB3, 0x3F, 0x88, 0xA8, 0x9A, 0x2E, 0x82, 0x99, 0x99, 0xAD, 0x07, 0x69, 0x5A, 0x2E, 0x73, 0x43, 
+    0x80, 0x19, 0x79, 0xDE, 0x61, 0x4A, 0xC8, 0x2C, 0x31, 0xDB, 0x97, 0x75, 0x11, 0xCA, 0x05, 0x8B, 0x2F, 0x5E, 0xBC, 0xF8, 
+    0x30, 0x62, 0x27, 0xF9, 0xFE, 0x34, 0x7A, 0xD1, 0xFF, 0x28, 0x08, 0xA7, 0x91, 0x34, 0x14, 0xBF, 0xE8, 0xF7, 0xC3, 0x8F, 
+    0xFA, 0x1F, 0x1D, 0xAE, 0xE1, 0xFF, 0x4D, 0xAE, 0xBC, 0xC6, 0xBD, 0xD6, 0x2B, 0x1A, 0x3E, 0x24, 0x34, 0x6C, 0xC6, 0xF5, 
+    0x29, 0x8C, 0x5D, 0x3F, 0x45, 0x41, 0xD8, 0x3A, 0x6D, 0x3C, 0xB5, 0x51, 0x1A, 0xA6, 0x70, 0xF8, 0x54, 0xBB, 0xC9, 0x20, 
+    0x12, 0x80, 0x18, 0x14, 0x77, 0x0F, 0x1F, 0xAA, 0xA1, 0x6C, 0x32, 0x6D, 0xCE, 0xE5, 0x44, 0xB1, 0x49, 0x7A, 0x55, 0xC0, 
+    0x72, 0x8D, 0xB9, 0x6C, 0xC1, 0x67, 0xAD, 0x05, 0xDF, 0xA5, 0x47, 0xF7, 0xE5, 0x9B, 0x37, 0xDF, 0x7B, 0x81, 0x5B, 0x59, 
+    0xE5, 0x06, 0xD0, 0x5E, 0x27, 0x0B, 0xF3, 0xA8, 0xEF, 0x8D, 0xCB, 0x4B, 0x5F, 0x75, 0x52, 0xB9, 0x17, 0x3E, 0x92, 0x5E, 
+    0x64, 0x8B, 0xD6, 0xF4, 0x87, 0xB3, 0xF2, 0x4B, 0xE5, 0xFA, 0x58, 0xB7, 0x06, 0x35, 0x34, 0xD4, 0xB9, 0x47, 0xB6, 0x40, 
+    0x12, 0xCF, 0x6B, 0xD7, 0xBD, 0x7C, 0x6F, 0xAB, 0xAB, 0x08, 0x5B, 0x19, 0x63, 0x61, 0x73, 0x3F, 0xC7, 0x79, 0x06, 0xE7, 
+    0x5C, 0x87, 0xF2, 0xF0, 0xB0, 0xD7, 0xAC, 0xBE, 0x65, 0x8E, 0x2B, 0x8C, 0x8E, 0x21, 0xA2, 0x12, 0x91, 0xB7, 0xB3, 0xD9, 
+    0xB5, 0x48, 0xDE, 0x3B, 0x17, 0x35, 0x34, 0xC1, 0xDF, 0xC4, 0x64, 0x87, 0xD9, 0xEE, 0x44, 0x37, 0x1B, 0x89, 0x92, 0x53, 
+    0x1D, 0xD5, 0xB6, 0xB6, 0xC7, 0xDA, 0x25, 0x4E, 0x9D, 0xA5, 0x57, 0xBF, 0x47, 0x16, 0xE6, 0x82, 0xA1, 0xF1, 0xF0, 0xC0, 
+    0x6E, 0x9C, 0xF6, 0xFB, 0xC7, 0xBA, 0x0E, 0x63, 0x3B, 0x52, 0x66, 0x71, 0x49, 0x8B, 0x2B, 0x2C, 0x23, 0x88, 0x21, 0x96, 
+    0x58, 0xB4, 0x28, 0x39, 0x60, 0xBB, 0xA4, 0xBE, 0x14, 0xAD, 0x02, 0xB6, 0xCA, 0x32, 0x1A, 0x06, 0xB5, 0x6F, 0xEC, 0x45, 
+    0x6B, 0x83, 0x6B, 0x48, 0xA0, 0xF1, 0x94, 0xF6, 0x00, 0x8E, 0xAE, 0x28, 0x6D, 0xDB, 0x0C, 0x55, 0x3D, 0x6C, 0x50, 0xDE, 
+    0x9D, 0xD4, 0xD9, 0x4F, 0xFB, 0xFD, 0x39, 0xCA, 0x12, 0x8D, 0x62, 0x24, 0xC7, 0xDA, 0xB1, 0x54, 0x5A, 0xC1, 0x5B, 0xDC, 
+    0x9B, 0x77, 0x35, 0x23, 0xAA, 0xCF, 0xC7, 0xCD, 0xC6, 0xDC, 0xA0, 0xDE, 0x30, 0x72, 0x90, 0x02, 0xD4, 0x9B, 0xC2, 0x87, 
+    0xC7, 0x33, 0xAB, 0x10, 0x82, 0xBD, 0x9F, 0x55, 0xE5, 0x07, 0xB4, 0x0A, 0x0E, 0xB3, 0x7F, 0x6C, 0x4B, 0xEB, 0xDE, 0x35, 
+    0x76, 0x36, 0xD6, 0xF1, 0xD7, 0x0C, 0xBC, 0x00, 0x75, 0xFD, 0xDC, 0x8F, 0x82, 0xAB, 0xD8, 0x8F, 0xA3, 0xD3, 0xFD, 0xB3, 
+    0x60, 0x7F, 0x15, 0x5F, 0xC5, 0xE7, 0x83, 0xCA, 0xA6, 0x83, 0x68, 0x6D, 0x1D, 0x7A, 0x99, 0xBE, 0x25, 0x17, 0xA5, 0x87, 
+    0xB5, 0xB9, 0x34, 0x6F, 0xC6, 0x76, 0xFA, 0x35, 0x13, 0xC7, 0x72, 0x2C, 0xE8, 0x63, 0x57, 0xE4, 0xAB, 0xAE, 0xF7, 0xAB, 
+    0x5C, 0xE8, 0xB8, 0x44, 0x25, 0x6E, 0x81, 0xB1, 0xC6, 0xAD, 0x1B, 0x00, 0x6D, 0xB0, 0x5E, 0xC4, 0xDA, 0xAB, 0xB8, 0x66, 
+    0xAB, 0x47, 0xA9, 0x4C, 0x7B, 0x9C, 0xC9, 0xFA, 0xA5, 0xCC, 0xCD, 0x4A, 0x11, 0x14, 0x04, 0xB1, 0x47, 0x7F, 0x39, 0x30, 
+    0x6A, 0x15, 0xF1, 0xA7, 0xFA, 0xF2, 0xA6, 0xE3, 0x57, 0x2E, 0x67, 0xC4, 0x68, 0xC8, 0x5A, 0xEB, 0xBC, 0x57, 0xDB, 0x05, 
+    0x84, 0x6F, 0xD9, 0x20, 0xDF, 0x85, 0x11, 0xBD, 0x83, 0xDF, 0x92, 0xFC, 0x86, 0x4D, 0x94, 0x0C, 0x03, 0xDC, 0x4F, 0xF5, 
+    0x8A, 0x05, 0x96, 0x42, 0xBD, 0xCA, 0x64, 0xD6, 0x38, 0xB1, 0xEA, 0x47, 0xF8, 0x00, 0xA8, 0x24, 0xF8, 0x10, 0x8E, 0x54, 
+    0x52, 0xD4, 0x34, 0x4E, 0xA1, 0x49, 0x89, 0x3F, 0x96, 0x60, 0x4D, 0x72, 0x5C, 0xBA, 0x41, 0xE3, 0x3A, 0xAC, 0xCD, 0x56, 
+    0x5A, 0xBB, 0xEA, 0x33, 0xB3, 0x66, 0xEE, 0xE1, 0x74, 0x76, 0x61, 0xEE, 0xB0, 0xC1, 0x1C, 0x95, 0x34, 0xBD, 0x5F, 0x45, 
+    0x77, 0x65, 0x14, 0x35, 0x39, 0x96, 0x49, 0xA9, 0x93, 0x0C, 0x1B, 0x91, 0xFB, 0x64, 0x7B, 0xB2, 0x5C, 0xED, 0x4E, 0x00, 
+    0x46, 0x2C, 0xC0, 0x9F, 0xD0, 0x14, 0x1C, 0x54, 0x75, 0x4A, 0x22, 0x91, 0xE3, 0xB2, 0x3F, 0xFC, 0x02, 0xF7, 0xF3, 0x45, 
+    0xA5, 0xE6, 0x49, 0xA9, 0xEA, 0x7F, 0x50, 0x79, 0x8B, 0x97, 0x79, 0x29, 0xC0, 0xCC, 0x30, 0x0F, 0xAF, 0x3A, 0xB9, 0x59, 
+    0x6D, 0xB2, 0x7E, 0xD5, 0x1E, 0x9D, 0xA1, 0xE3, 0x36, 0x11, 0x9F, 0x2A, 0x76, 0xEE, 0xE1, 0x9D, 0x7F, 0xEC, 0x4F, 0x58, 
+    0x46, 0x37, 0x89, 0xC6, 0x65, 0x78, 0x19, 0x8B, 0xA7, 0xDC, 0xB0, 0x84, 0xAC, 0xA1, 0xC3, 0xEE, 0xF9, 0xEA, 0xB2, 0x6A, 
+    0x26, 0x5C, 0x5B, 0xB4, 0xD4, 0x93, 0x8A, 0x96, 0x7A, 0xAB, 0x09, 0x96, 0x56, 0x03, 0x06, 0x6E, 0x67, 0x25, 0x99, 0x47, 
+    0x51, 0x06, 0xC6, 0xDD, 0x02, 0x2E, 0xD1, 0x39, 0x6A, 0x1F, 0xDC, 0x46, 0x0F, 0x47, 0x65, 0xC0, 0xEF, 0x61, 0x5A, 0x43, 
+    0xAB, 0x08, 0xFB, 0x1D, 0x8C, 0x42, 0x0E, 0x4B, 0x90, 0xDE, 0x11, 0xAE, 0xF8, 0x62, 0x93, 0x4C, 0xF8, 0x0B, 0x6D, 0x3F, 
+    0x66, 0x74, 0xC5, 0x6B, 0xAA, 0x70, 0xF7, 0x20, 0xFD, 0x0B, 0x63, 0x77, 0xE7, 0x63, 0x64, 0x8B, 0x62, 0x33, 0x29, 0xFC, 
+    0x21, 0xBC, 0xF4, 0x39, 0x52, 0x2A, 0x2D, 0xB5, 0x49, 0x73, 0x76, 0x3D, 0xCA, 0x5A, 0xEE, 0x03, 0xFB, 0xD4, 0x36, 0x07, 
+    0x6D, 0x5E, 0x7C, 0xD3, 0xDC, 0x3A, 0x8D, 0xCA, 0xDB, 0x9D, 0x8F, 0x0E, 0x5C, 0x23, 0x6E, 0xFE, 0x06, 0x25, 0x56, 0xC7, 
+    0x9C, 0xAE, 0xDC, 0x66, 0x97, 0x11, 0x1B, 0x45, 0x1A, 0x7D, 0x85, 0x44, 0x2B, 0x5E, 0x4E, 0x95, 0x71, 0x0C, 0xCE, 0xDE, 
+    0x08, 0x4D, 0x72, 0x9F, 0x83, 0xD3, 0xD6, 0xC5, 0x1E, 0x7A, 0xC2, 0xB5, 0x90, 0x3E, 0x4C, 0x5B, 0x9C, 0x78, 0x4B, 0x88, 
+    0x59, 0xEF, 0xFB, 0xEF, 0x5E, 0xBF, 0x01, 0x08, 0x5B, 0x93, 0x1D, 0xC3, 0xBD, 0x54, 0x24, 0xDE, 0x63, 0x47, 0xDA, 0x2D, 
+    0xBA, 0x6D, 0x5A, 0xB3, 0x2F, 0xA8, 0x05, 0xC4, 0xA0, 0xC3, 0xB6, 0x28, 0x41, 0x9B, 0xAA, 0x45, 0x6E, 0x3F, 0x8F, 0xE9, 
+    0x7C, 0xFD, 0x24, 0x9F, 0xBD, 0xBD, 0xF4, 0xAC, 0x0C, 0xD7, 0x01, 0x35, 0xF0, 0xCD, 0x6C, 0xD8, 0x0D, 0x1B, 0x41, 0x08, 
+    0x2C, 0xAD, 0x42, 0x09, 0x42, 0xDD, 0x57, 0x59, 0xE9, 0x89, 0x08, 0x46, 0x32, 0xF8, 0x73, 0x76, 0x54, 0x43, 0x41, 0xCA, 
+    0xC2, 0x07, 0x00, 0x82, 0x6A, 0x68, 0x8D, 0x9A, 0x9A, 0x98, 0x4E, 0xBB, 0x44, 0xCD, 0xDB, 0x65, 0xFC, 0x13, 0x42, 0x31, 
+    0xBE, 0x75, 0x7C, 0xEA, 0x4A, 0x85, 0xAD, 0xAB, 0x00, 0x20, 0x3D, 0x09, 0xF9, 0xA0, 0xE7, 0x4A, 0x6B, 0x7A, 0xC1, 0xD1, 
+    0x85, 0x21, 0x17, 0x1A, 0x74, 0x83, 0x25, 0x20, 0xF3, 0xBC, 0xD2, 0xDE, 0x6C, 0xFB, 0x23, 0x8D, 0x77, 0x75, 0x0F, 0x69, 
+    0x5B, 0x12, 0xFE, 0xA9, 0xE2, 0xB3, 0x27, 0x2E, 0x1D, 0x8B, 0xCC, 0x8A, 0x7B, 0x10, 0xE1, 0x72, 0xD2, 0x4A, 0x89, 0xB0, 
+    0x73, 0x41, 0x94, 0xA4, 0xC8, 0x44, 0xD9, 0x75, 0x84, 0x08, 0x3F, 0xDF, 0xE5, 0x35, 0xC0, 0xD1, 0x41, 0x33, 0xA1, 0xE2, 
+    0x57, 0xDB, 0x99, 0x78, 0xB6, 0x54, 0x73, 0xDC, 0x07, 0x04, 0x6A, 0x09, 0x6D, 0x2D, 0x0F, 0x67, 0xFE, 0x2C, 0xE3, 0x9B, 
+    0x43, 0xA6, 0xBB, 0x44, 0x70, 0x6A, 0x72, 0x47, 0xDE, 0xA6, 0x98, 0x27, 0x20, 0x79, 0xA1, 0xD8, 0x1A, 0xCD, 0x75, 0x2F, 
+    0x7C, 0xF1, 0xEA, 0xAD, 0xAB, 0xE6, 0xCB, 0x2F, 0x35, 0x2B, 0x13, 0xE6, 0xC5, 0x18, 0xB4, 0xD0, 0x75, 0x44, 0xE7, 0x50, 
+    0xBA, 0x5D, 0xCD, 0xEF, 0x76, 0x2C, 0x9F, 0xBD, 0x81, 0xEB, 0xD2, 0xD9, 0x03, 0x21, 0x50, 0xBC, 0xB0, 0x03, 0x67, 0xE3, 
+    0x0C, 0x4C, 0xDC, 0x5B, 0xA8, 0xE1, 0x58, 0xCD, 0x46, 0xC1, 0xE5, 0xD9, 0x05, 0xAE, 0x56, 0x73, 0x6A, 0xCE, 0xF4, 0x83, 
+    0x59, 0x5F, 0x3A, 0xAD, 0xC0, 0x3C, 0x45, 0x10, 0xE7, 0x8D, 0x77, 0x41, 0xE8, 0x4F, 0xAA, 0xB1, 0x91, 0x11, 0x33, 0xA3, 
+    0x12, 0x2E, 0x79, 0x86, 0xA4, 0xC6, 0x56, 0x61, 0x29, 0x5E, 0x6A, 0x62, 0x11, 0x64, 0xBC, 0x9B, 0xB4, 0x77, 0xBD, 0x1E, 
+    0xBB, 0x5F, 0xC6, 0x7D, 0xE0, 0x6A, 0x2D, 0x6F, 0x67, 0x53, 0xFC, 0xED, 0x4E, 0xCA, 0x2C, 0x68, 0x9B, 0xF3, 0xE0, 0x41, 
+    0xBF, 0x53, 0x2E, 0xFC, 0xE0, 0x9C, 0xF1, 0x60, 0x03, 0x38, 0x61, 0x2F, 0x83, 0x74, 0xE4, 0xF1, 0x8B, 0x69, 0x6A, 0x19, 
+    0x84, 0x73, 0x9E, 0xA2, 0xA5, 0xB8, 0x0E, 0x71, 0xC4, 0x6F, 0xAB, 0xFA, 0x8A, 0x06, 0xEF, 0x72, 0x2E, 0x59, 0x12, 0xD3, 
+    0x6C, 0x2D, 0x16, 0x1E, 0xB9, 0x28, 0xD2, 0x8B, 0xD5, 0xB3, 0x10, 0x63, 0xDC, 0x4D, 0xA7, 0xC6, 0x03, 0x9A, 0xB8, 0x05, 
+    0x7C, 0x82, 0xCF, 0xD2, 0xBE, 0xC2, 0x08, 0xC2, 0xFE, 0xA1, 0x74, 0x70, 0xA9, 0x43, 0xBE, 0x55, 0x6F, 0x8C, 0x58, 0xF6, 
+    0x50, 0xBA, 0x63, 0x1C, 0xD7, 0xE1, 0x1F, 0xF1, 0x76, 0x89, 0x2A, 0x21, 0x92, 0x7B, 0xCB, 0x72, 0xE6, 0xD8, 0x37, 0xF2, 
+    0x63, 0x30, 0x87, 0x9F, 0x21, 0x2E, 0x38, 0x4D, 0xC9, 0xCB, 0xF9, 0x8C, 0xF2, 0xFE, 0x9D, 0xD0, 0x13, 0x1D, 0xE7, 0x7F, 
+    0x65, 0xE4, 0x77, 0xE4, 0x3B, 0xB4, 0xAB, 0xB2, 0x28, 0xE7, 0x88, 0x30, 0xDC, 0x51, 0x86, 0x82, 0x2E, 0xFB, 0xF7, 0x9B, 
+    0x14, 0x3F, 0xCB, 0xC0, 0xD8, 0x01, 0xB1, 0x09, 0x25, 0x18, 0x9C, 0x81, 0x32, 0xE2, 0x0A, 0xE8, 0x8D, 0x21, 0x80, 0x87, 
+    0x26, 0x60, 0x63, 0x4A, 0xFE, 0x54, 0x2F, 0x89, 0x68, 0x83, 0x4E, 0x51, 0xBC, 0xA2, 0xEC, 0x21, 0x08, 0xF3, 0x83, 0x32, 
+    0x70, 0x58, 0x33, 0xE4, 0xAD, 0x5C, 0xB3, 0xF1, 0x2E, 0xAC, 0x4F, 0x66, 0x6E, 0xBD, 0x85, 0x6A, 0x83, 0x0F, 0xBB, 0x01, 
+    0x64, 0xB7, 0xE4, 0xEE, 0xCE, 0x8C, 0x53, 0xF1, 0x50, 0xD6, 0x36, 0x0B, 0xA1, 0xAF, 0xC5, 0x9B, 0xB2, 0xA8, 0xDF, 0xEB, 
+    0x0B, 0x1C, 0x95, 0xBA, 0xA9, 0x7C, 0xEA, 0x95, 0xDE, 0x8B, 0xB0, 0x86, 0x82, 0xBC, 0x39, 0x70, 0xB2, 0x0D, 0xD1, 0xCD, 
+    0x73, 0xCA, 0xD3, 0x68, 0xF6, 0x2C, 0xE7, 0x94, 0x20, 0xC4, 0x34, 0x67, 0x12, 0x85, 0x98, 0x7D, 0x65, 0x67, 0x32, 0x69, 
+    0x2D, 0xF9, 0x30, 0x41, 0x65, 0x46, 0xBD, 0x38, 0xB2, 0x67, 0xB8, 0xEE, 0x33, 0x3B, 0x40, 0x09, 0x40, 0xF7, 0x06, 0xD7, 
+    0xBC, 0x1D, 0xB3, 0x18, 0x7A, 0xDF, 0x48, 0xF5, 0xF5, 0xAC, 0xA8, 0xDA, 0xD3, 0x14, 0xBF, 0x72, 0xC7, 0xFB, 0x6F, 0xC9, 
+    0x96, 0x1B, 0xB3, 0xB5, 0xDF, 0x67, 0xB9, 0xB9, 0x97, 0x64, 0x19, 0xBC, 0xEB, 0xE7, 0x49, 0xA6, 0x89, 0x95, 0xE6, 0x0C, 
+    0x42, 0x6C, 0xC1, 0x9D, 0x7C, 0x51, 0xE9, 0xD6, 0x69, 0x25, 0xD5, 0xA8, 0xFC, 0x50, 0x75, 0x2A, 0x6E, 0xC1, 0x0A, 0x6A, 
+    0xF6, 0x16, 0xE2, 0x3C, 0x65, 0x21, 0x55, 0xD2, 0x35, 0x0C, 0x37, 0xA2, 0x3E, 0x8B, 0x08, 0xF9, 0xFC, 0x67, 0xC3, 0xBF, 
+    0x05, 0x83, 0x86, 0x1F, 0xF0, 0xFC, 0x1D, 0x81, 0x94, 0x73, 0x23, 0xC4, 0x1A, 0x47, 0x7C, 0x12, 0x0D, 0xEA, 0xC8, 0xA3, 
+    0x88, 0xC7, 0x31, 0xAB, 0x95, 0x8E, 0x63, 0x38, 0x8A, 0x0F, 0xC7, 0x47, 0xCF, 0x34, 0xC4, 0xA7, 0x82, 0xE5, 0x14, 0x53, 
+    0x8D, 0x3E, 0x65, 0xB7, 0x9B, 0xCD, 0xCF, 0xE8, 0x9C, 0x1F, 0x07, 0xCE, 0x16, 0x22, 0x48, 0x2D, 0x54, 0x16, 0x17, 0xA1, 
+    0x93, 0xFE, 0x06, 0x1C, 0x55, 0xC0, 0x55, 0x20, 0x4C, 0x13, 0x3B, 0x60, 0xAF, 0xE3, 0x36, 0xC6, 0xAF, 0x75, 0x27, 0xF2, 
+    0x50, 0x0C, 0xE0, 0xC3, 0xE4, 0xDD, 0x91, 0xEB, 0x39, 0x96, 0xF7, 0x9A, 0x36, 0xD6, 0xFC, 0x7B, 0xBD, 0x52, 0xAA, 0xD5, 
+    0x5A, 0x39, 0x03, 0x95, 0xF4, 0x97, 0x54, 0x3C, 0xFD, 0x7D, 0x99, 0x5A, 0x0F, 0x6D, 0x2C, 0x32, 0x2E, 0x8F, 0x1A, 0xAA, 
+    0xB2, 0x8B, 0xB0, 0x95, 0x61, 0xE9, 0x6C, 0x29, 0x70, 0xD6, 0x55, 0xAE, 0x25, 0x43, 0xE3, 0xEA, 0x49, 0xF1, 0x26, 0x08, 
+    0xB5, 0x07, 0xA8, 0xA6, 0xEB, 0x76, 0x29, 0x64, 0x63, 0x7D, 0xB3, 0x33, 0x6C, 0xAF, 0x9B, 0x18, 0x09, 0x4D, 0x88, 0xF8, 
+    0xE8, 0xA1, 0xB7, 0xBA, 0xDB, 0x71, 0xB2, 0x53, 0x9E, 0xD9, 0x45, 0x5E, 0xF2, 0xDC, 0x5D, 0xF2, 0x72, 0x59, 0xEB, 0x53, 
+    0x08, 0xAA, 0xDB, 0xB1, 0xF0, 0xB7, 0xE4, 0x2A, 0x87, 0xDC, 0xC8, 0xD8, 0x7E, 0x08, 0x36, 0x23, 0xC4, 0xA2, 0x8B, 0xD9, 
+    0x89, 0x89, 0x0C, 0x19, 0xEA, 0x1D, 0x5D, 0x52, 0xA4, 0x75, 0x68, 0xAA, 0xDC, 0x2F, 0x36, 0x29, 0x1A, 0xDC, 0xBA, 0x1D, 
+    0x07, 0x1E, 0x4F, 0x10, 0x2A, 0x0D, 0x6E, 0xC4, 0x64, 0x4F, 0x5A, 0x92, 0x3D, 0xCC, 0x44, 0xD6, 0x0F, 0x10, 0x1B, 0x2D, 
+    0x2B, 0xED, 0xE1, 0xF2, 0x99, 0x99, 0x35, 0x02, 0x22, 0x94, 0x57, 0x45, 0xE5, 0xCD, 0x64, 0x90, 0x0D, 0x69, 0x32, 0x54, 
+    0xDF, 0xCA, 0xC6, 0x03, 0xB3, 0x9A, 0x6C, 0xEF, 0x2B, 0x9B, 0x1B, 0x03, 0x9B, 0x40, 0xBF, 0x5E, 0xE2, 0xB4, 0x89, 0xDF, 
+    0x10, 0xC4, 0x01, 0x49, 0xD5, 0x38, 0xCE, 0x43, 0x23, 0xCB, 0xB5, 0xC0, 0x69, 0x0C, 0xD7, 0x61, 0xD3, 0x1F, 0x1D, 0x41, 
+    0x46, 0x9A, 0x54, 0x94, 0x8C, 0xC9, 0x32, 0x7F, 0x5D, 0xCC, 0xC7, 0xC2, 0x6A, 0x10, 0x0C, 0x7C, 0x06, 0xDE, 0xCD, 0x33, 
+    0x25, 0x9D, 0x50, 0x36, 0x05, 0x51, 0xC3, 0x74, 0xDA, 0xCA, 0x6F, 0x2F, 0x59, 0xE4, 0xE6, 0xD9, 0xF7, 0xE4, 0xD6, 0x10, 
+    0x81, 0x40, 0x54, 0xCB, 0xE5, 0x9C, 0x3E, 0xCA, 0x0B, 0x10, 0xA5, 0xD7, 0x7F, 0x43, 0x4E, 0x35, 0xC6, 0xF3, 0xB3, 0x81, 
+    0xE3, 0xCF, 0xEE, 0xE5, 0x6A, 0x39, 0x26, 0xE6, 0x61, 0x17, 0xB5, 0xD1, 0xB9, 0xBD, 0x67, 0x40, 0x76, 0x4C, 0xFD, 0x3D, 
+    0x8B, 0xC6, 0xB9, 0xC4, 0x23, 0xD1, 0x75, 0xD9, 0x2F, 0xFA, 0xB5, 0xA0, 0xCF, 0x8B, 0x83, 0x32, 0x1C, 0x45, 0x24, 0xA7, 
+    0xB7, 0xFD, 0x8C, 0x1A, 0x16, 0xC8, 0x11, 0x0C, 0xFE, 0xE3, 0xFF, 0x05, 0x84, 0xF9, 0x4F, 0x80, 0x2A, 0x76, 0x01, 0x00, 
+};
+
+XEmbeddedContent web_jquery_js =
+{
+    95786,
+    "application/x-javascript",
+    jquery_js_data,
+    "64d95d9509776d6e",
+    33160,
+    jquery_js_gzip_data,
+    0,
+    nullptr,
+};
+
+#endif
@@ -0,0 +1,126 @@
+/*
+ * Auto generated header file to be used with web2cam
+ *
+ * Source file: styles.css
+ */
+
+#ifndef styles_css_h
+#define styles_css_h
+
+#include "XWebServer.hpp"
+
+uint8_t styles_css_data[]
+{
+    0x5B, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x72, 0x6F, 0x6C, 0x65, 0x3D, 0x70, 0x61, 0x67, 0x65, 0x5D, 0x20, 0x7B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6D, 0x69, 0x6E, 0x2D, 0x68, 0x65, 0x69, 0x67, 0x68, 0x74, 0x3A, 0x20, 0x31, 0x30, 0x30, 0x25, 0x20, 
+    0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x68, 0x65, 0x69, 0x67, 
+    0x68, 0x74, 0x3A, 0x61, 0x75, 0x74, 0x6F, 0x20, 0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 0x0A, 
+    0x7D, 0x0A, 0x0A, 0x5B, 0x64, 0x61, 0x74, 0x61, 0x2D, 0x72, 0x6F, 0x6C, 0x65, 0x3D, 0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72, 
+    0x5D, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x6F, 0x73, 0x69, 0x74, 0x69, 0x6F, 0x6E, 0x3A, 0x20, 0x61, 0x62, 
+    0x73, 0x6F, 0x6C, 0x75, 0x74, 0x65, 0x20, 0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x30, 0x20, 0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 
+    0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x30, 0x20, 0x21, 0x69, 0x6D, 
+    0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x31, 
+    0x30, 0x30, 0x25, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x2E, 0x75, 0x69, 0x2D, 0x70, 0x61, 0x67, 0x65, 0x20, 0x7B, 0x0A, 0x20, 
+    0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 
+    0x20, 0x23, 0x45, 0x30, 0x45, 0x38, 0x45, 0x30, 0x20, 0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 
+    0x0A, 0x7D, 0x0A, 0x0A, 0x2E, 0x75, 0x69, 0x2D, 0x70, 0x61, 0x67, 0x65, 0x20, 0x2E, 0x75, 0x69, 0x2D, 0x68, 0x65, 0x61, 
+    0x64, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 
+    0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x30, 0x30, 0x41, 0x30, 0x34, 0x30, 0x20, 0x21, 0x69, 0x6D, 0x70, 
+    0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 
+    0x6E, 0x64, 0x3A, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x61, 0x72, 0x2D, 0x67, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 
+    0x23, 0x30, 0x30, 0x38, 0x30, 0x34, 0x30, 0x2C, 0x20, 0x23, 0x30, 0x30, 0x41, 0x30, 0x34, 0x30, 0x29, 0x20, 0x21, 0x69, 
+    0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x2E, 0x75, 0x69, 0x2D, 0x70, 0x61, 0x67, 
+    0x65, 0x20, 0x2E, 0x75, 0x69, 0x2D, 0x66, 0x6F, 0x6F, 0x74, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x30, 0x30, 
+    0x38, 0x30, 0x34, 0x30, 0x20, 0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x3A, 0x20, 0x6C, 0x69, 0x6E, 0x65, 0x61, 0x72, 0x2D, 
+    0x67, 0x72, 0x61, 0x64, 0x69, 0x65, 0x6E, 0x74, 0x28, 0x23, 0x30, 0x30, 0x41, 0x30, 0x34, 0x30, 0x2C, 0x20, 0x23, 0x30, 
+    0x30, 0x38, 0x30, 0x34, 0x30, 0x29, 0x20, 0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 0x0A, 0x7D, 
+    0x0A, 0x0A, 0x2E, 0x75, 0x69, 0x2D, 0x70, 0x61, 0x67, 0x65, 0x20, 0x2E, 0x75, 0x69, 0x2D, 0x68, 0x65, 0x61, 0x64, 0x65, 
+    0x72, 0x20, 0x2E, 0x75, 0x69, 0x2D, 0x62, 0x74, 0x6E, 0x2D, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 
+    0x23, 0x30, 0x30, 0x35, 0x30, 0x32, 0x30, 0x20, 0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 0x0A, 
+    0x7D, 0x0A, 0x0A, 0x2E, 0x75, 0x69, 0x2D, 0x70, 0x61, 0x67, 0x65, 0x20, 0x2E, 0x75, 0x69, 0x2D, 0x68, 0x65, 0x61, 0x64, 
+    0x65, 0x72, 0x20, 0x2E, 0x75, 0x69, 0x2D, 0x62, 0x74, 0x6E, 0x2D, 0x61, 0x63, 0x74, 0x69, 0x76, 0x65, 0x20, 0x7B, 0x0A, 
+    0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 
+    0x3A, 0x20, 0x23, 0x35, 0x30, 0x35, 0x30, 0x35, 0x30, 0x20, 0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 
+    0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x2E, 0x75, 0x69, 0x2D, 0x70, 0x61, 0x67, 0x65, 0x20, 0x2E, 0x75, 0x69, 0x2D, 0x63, 0x6F, 
+    0x6E, 0x74, 0x65, 0x6E, 0x74, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 
+    0x20, 0x32, 0x30, 0x70, 0x78, 0x20, 0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 0x0A, 0x20, 0x20, 
+    0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 0x69, 0x6E, 0x2D, 0x62, 0x6F, 0x74, 0x74, 0x6F, 0x6D, 0x3A, 0x20, 0x33, 0x30, 0x70, 
+    0x78, 0x20, 0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x3A, 0x20, 0x31, 0x30, 0x30, 0x25, 0x20, 0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 
+    0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6F, 0x76, 0x65, 0x72, 0x66, 0x6C, 0x6F, 0x77, 0x3A, 0x20, 0x68, 0x69, 0x64, 0x64, 
+    0x65, 0x6E, 0x20, 0x21, 0x69, 0x6D, 0x70, 0x6F, 0x72, 0x74, 0x61, 0x6E, 0x74, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x63, 
+    0x61, 0x6D, 0x65, 0x72, 0x61, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 
+    0x20, 0x66, 0x6C, 0x6F, 0x61, 0x74, 0x3A, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 
+    0x64, 0x74, 0x68, 0x3A, 0x20, 0x36, 0x36, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x73, 0x74, 0x61, 0x74, 
+    0x75, 0x73, 0x63, 0x6F, 0x6E, 0x74, 0x61, 0x69, 0x6E, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 0x6C, 
+    0x6F, 0x61, 0x74, 0x3A, 0x20, 0x6C, 0x65, 0x66, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x77, 0x69, 0x64, 0x74, 0x68, 
+    0x3A, 0x20, 0x33, 0x30, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x70, 
+    0x72, 0x6F, 0x70, 0x65, 0x72, 0x74, 0x69, 0x65, 0x73, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x6D, 0x61, 0x72, 0x67, 
+    0x69, 0x6E, 0x2D, 0x6C, 0x65, 0x66, 0x74, 0x3A, 0x20, 0x36, 0x38, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x77, 0x69, 0x64, 0x74, 0x68, 0x3A, 0x20, 0x33, 0x30, 0x30, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x61, 
+    0x63, 0x6B, 0x67, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x44, 0x30, 0x45, 
+    0x38, 0x44, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x30, 
+    0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 0x64, 0x65, 0x72, 0x3A, 0x20, 0x32, 0x70, 0x78, 0x20, 
+    0x73, 0x6F, 0x6C, 0x69, 0x64, 0x20, 0x23, 0x30, 0x30, 0x41, 0x30, 0x34, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 
+    0x6F, 0x72, 0x64, 0x65, 0x72, 0x2D, 0x72, 0x61, 0x64, 0x69, 0x75, 0x73, 0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x3B, 0x0A, 
+    0x7D, 0x0A, 0x0A, 0x23, 0x63, 0x61, 0x6D, 0x65, 0x72, 0x61, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x62, 0x6F, 0x72, 
+    0x64, 0x65, 0x72, 0x3A, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x23, 0x30, 0x30, 0x36, 0x30, 0x31, 0x30, 0x20, 0x73, 0x6F, 
+    0x6C, 0x69, 0x64, 0x3B, 0x0A, 0x7D, 0x0A, 0x0A, 0x23, 0x63, 0x6F, 0x70, 0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x7B, 
+    0x0A, 0x20, 0x20, 0x20, 0x20, 0x74, 0x65, 0x78, 0x74, 0x2D, 0x61, 0x6C, 0x69, 0x67, 0x6E, 0x3A, 0x20, 0x72, 0x69, 0x67, 
+    0x68, 0x74, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x70, 0x61, 0x64, 0x64, 0x69, 0x6E, 0x67, 0x3A, 0x20, 0x31, 0x30, 0x70, 
+    0x78, 0x20, 0x32, 0x30, 0x70, 0x78, 0x20, 0x31, 0x30, 0x70, 0x78, 0x20, 0x30, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 
+    0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 0x23, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x66, 
+    0x6F, 0x6E, 0x74, 0x2D, 0x73, 0x69, 0x7A, 0x65, 0x3A, 0x20, 0x31, 0x32, 0x70, 0x78, 0x3B, 0x0A, 0x20, 0x20, 0x20, 0x20, 
+    0x74, 0x65, 0x78, 0x74, 0x2D, 0x73, 0x68, 0x61, 0x64, 0x6F, 0x77, 0x3A, 0x20, 0x31, 0x70, 0x78, 0x20, 0x31, 0x70, 0x78, 
+    0x20, 0x30, 0x70, 0x78, 0x20, 0x23, 0x30, 0x30, 0x36, 0x30, 0x32, 0x30, 0x3B, 0x0A, 0x7D, 0x0A, 0x23, 0x63, 0x6F, 0x70, 
+    0x79, 0x72, 0x69, 0x67, 0x68, 0x74, 0x20, 0x61, 0x2C, 0x20, 0x61, 0x3A, 0x66, 0x6F, 0x63, 0x75, 0x73, 0x2C, 0x20, 0x61, 
+    0x3A, 0x68, 0x6F, 0x76, 0x65, 0x72, 0x20, 0x7B, 0x0A, 0x20, 0x20, 0x20, 0x20, 0x63, 0x6F, 0x6C, 0x6F, 0x72, 0x3A, 0x20, 
+    0x23, 0x46, 0x46, 0x46, 0x46, 0x46, 0x46, 0x3B, 0x0A, 0x7D, 0x0A, 
+};
+
+uint8_t styles_css_gzip_data[]
+{
+    0x1F, 0x8B, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0x9D, 0x54, 0xDB, 0x6E, 0xDB, 0x30, 0x0C, 0x7D, 0xCF, 0x57, 
+    0x68, 0x28, 0x06, 0x6C, 0x40, 0x35, 0x28, 0xE9, 0x1A, 0x18, 0x2E, 0xF6, 0x50, 0xA0, 0xD9, 0x4F, 0x14, 0x7B, 0x60, 0x2C, 
+    0xD9, 0x16, 0x66, 0x8B, 0x86, 0x44, 0xF7, 0x36, 0xF4, 0xDF, 0x27, 0x59, 0x56, 0xAE, 0xAE, 0xB7, 0xD6, 0x79, 0x11, 0x44, 
+    0x9E, 0xC3, 0x43, 0xF2, 0x28, 0xF7, 0x12, 0x08, 0xB8, 0xC5, 0x46, 0xFD, 0xE8, 0xA0, 0x52, 0xBF, 0xD8, 0x9F, 0x05, 0xF3, 
+    0x5F, 0xAB, 0x0D, 0xAF, 0x95, 0xAE, 0x6A, 0xCA, 0xD9, 0x52, 0x88, 0xCF, 0xEC, 0x93, 0x6E, 0x3B, 0xB4, 0x04, 0x86, 0x6E, 
+    0x86, 0x84, 0x31, 0x08, 0x3D, 0xE1, 0x51, 0xEC, 0x75, 0xB1, 0xB8, 0xDF, 0x53, 0x96, 0x88, 0xA4, 0x6C, 0x22, 0xED, 0xD0, 
+    0x69, 0xD2, 0x68, 0x72, 0x06, 0x5B, 0x87, 0x4D, 0x4F, 0xEA, 0x8C, 0xB6, 0x51, 0xA5, 0xAF, 0x28, 0xCE, 0xEE, 0xB7, 0x48, 
+    0x84, 0xED, 0x54, 0xE4, 0x51, 0x4B, 0xAA, 0xF3, 0xA0, 0x71, 0x28, 0xFE, 0xAD, 0xD7, 0x3C, 0x34, 0x32, 0x96, 0xDC, 0x42, 
+    0xF1, 0xBB, 0xB2, 0xD8, 0x1B, 0xC9, 0x0B, 0x6C, 0xD0, 0xE6, 0xEC, 0x62, 0x23, 0x36, 0xD9, 0x46, 0x9C, 0x8A, 0xDE, 0xE1, 
+    0xC2, 0xA1, 0x56, 0x20, 0x95, 0x7D, 0x9B, 0x42, 0x88, 0x5B, 0xF1, 0x7D, 0x42, 0xE4, 0x2E, 0x33, 0x67, 0x8D, 0x36, 0x0A, 
+    0x2C, 0xAF, 0x2C, 0x48, 0xAD, 0x0C, 0x7D, 0xF1, 0x98, 0xCC, 0x63, 0x2E, 0x13, 0xF8, 0xEB, 0xAC, 0x80, 0x38, 0xB7, 0x39, 
+    0x01, 0xD9, 0x07, 0x04, 0xDC, 0x26, 0x01, 0xD9, 0x3F, 0x05, 0x8C, 0x13, 0x08, 0xC7, 0x2D, 0x19, 0x6E, 0xC3, 0xB2, 0xE7, 
+    0xE4, 0x5C, 0x8B, 0x95, 0x78, 0x0F, 0x21, 0x14, 0xA4, 0x1F, 0x66, 0x96, 0x74, 0x2D, 0xC2, 0x6F, 0x96, 0xB1, 0x40, 0x43, 
+    0xBE, 0xB1, 0xE4, 0x2D, 0x90, 0x52, 0x9B, 0x2A, 0x67, 0x2B, 0xD1, 0x3D, 0x9D, 0x0D, 0xA6, 0x05, 0x5B, 0x79, 0x47, 0x27, 
+    0x17, 0x5D, 0x4D, 0xE5, 0x44, 0x23, 0x4D, 0xBB, 0x1D, 0x1F, 0x94, 0x2D, 0x1B, 0x7C, 0xCC, 0x59, 0xAD, 0xA5, 0x54, 0xE6, 
+    0x54, 0xD8, 0x45, 0x01, 0xAD, 0xB2, 0x10, 0x24, 0x81, 0x9F, 0x7B, 0xDA, 0x9C, 0x87, 0x80, 0xB7, 0x73, 0x30, 0xF5, 0x51, 
+    0x8D, 0xF5, 0xDA, 0x0B, 0x88, 0x40, 0x47, 0x40, 0xBD, 0xFB, 0x5F, 0xE0, 0x95, 0xD8, 0x01, 0x63, 0xC5, 0xCE, 0x62, 0xA7, 
+    0x2C, 0x69, 0xE5, 0xD2, 0xC3, 0x8D, 0x9D, 0xC6, 0x77, 0xB4, 0xCE, 0x86, 0xF4, 0x73, 0x82, 0x37, 0xA6, 0x7E, 0xE7, 0x9F, 
+    0xC6, 0x9D, 0xB8, 0x39, 0x1E, 0xE8, 0x72, 0x8F, 0x40, 0xEB, 0x77, 0xE8, 0x47, 0xEC, 0xA7, 0xE7, 0xDF, 0xAF, 0x96, 0xC9, 
+    0xCC, 0x87, 0x61, 0x1E, 0x0C, 0xD7, 0xBB, 0x84, 0xDB, 0x4B, 0x4D, 0xCB, 0x1E, 0x49, 0x42, 0x38, 0xE0, 0xD7, 0x62, 0x29, 
+    0x22, 0xDB, 0x98, 0x8C, 0xDD, 0xF3, 0xA1, 0xDD, 0x48, 0x3D, 0x11, 0x87, 0x46, 0x57, 0xFE, 0x6F, 0x63, 0xB8, 0x9F, 0x90, 
+    0x17, 0x97, 0x3E, 0x9C, 0x46, 0x2D, 0xA9, 0xA3, 0x9F, 0xC3, 0x17, 0xEF, 0x4A, 0x3F, 0x64, 0xEE, 0xF4, 0x8B, 0xF2, 0xA0, 
+    0x55, 0xEA, 0x69, 0xA0, 0x77, 0x35, 0xC8, 0xB0, 0xDC, 0x65, 0x60, 0x09, 0x24, 0x49, 0xDA, 0x4A, 0x04, 0x51, 0x07, 0x9A, 
+    0xE0, 0x92, 0x41, 0x5E, 0x62, 0xD1, 0xBB, 0x70, 0xA8, 0x83, 0x2F, 0x46, 0x9D, 0xA7, 0x15, 0x5F, 0x17, 0x7F, 0x01, 0x49, 
+    0x28, 0x09, 0xEB, 0x5B, 0x05, 0x00, 0x00, 
+};
+
+XEmbeddedContent web_styles_css =
+{
+    1371,
+    "text/css",
+    styles_css_data,
+    "b726e43e101a564b",
+    487,
+    styles_css_gzip_data,
+    0,
+    nullptr,
+};
+
+#endif
@@ -25,17 +25,22 @@
 #include <pwd.h>
 #include <linux/limits.h>
 #include <map>
+#include <vector>
 #include <stdlib.h>
 #include <iostream>
 
 
 #include "XV4LCamera.hpp"
 #include "XV4LCameraConfig.hpp"
+#include "XSyntheticVideoSource.hpp"
+#include "XReplayVideoSource.hpp"
 #include "XWebServer.hpp"
 #include "XVideoSourceToWeb.hpp"
+#include "XUplinkSender.hpp"
 #include "XObjectConfigurationSerializer.hpp"
 #include "XObjectConfigurationRequestHandler.hpp"
 #include "XManualResetEvent.hpp"
+#include "XLog.hpp"
 
 // Release build embeds web resources into executable
 #ifdef NDEBUG
@@ -61,6 +66,32 @@ using namespace std;
 // Name of the device and default title of the camera
 const char* DEVICE_NAME = "Video for Linux Camera";
 
+// Receiver to send frames to if no uplinks are specified on command line
+#define DEFAULT_UPLINK_ADDRESS  "35.163.144.7"
+#define DEFAULT_UPLINK_PORT     (9000)
+#define DEFAULT_UPLINK_QUEUE    (8)
+
+// Video sources the application can stream
+enum class VideoSourceType
+{
+    Camera = 0,
+    Synthetic,
+    Replay
+};
+
+// Configuration of a single uplink sink
+struct UplinkSettings
+{
+    string            Name;
+    string            Address;
+    uint16_t          Port;
+    uint32_t          QueueLength;
+    XUplinkDropPolicy DropPolicy;
+    bool              ZeroCopy;
+    XUplinkProtocol   Protocol;
+    uint32_t          StreamId;
+};
+
 XManualResetEvent ExitEvent;
 
 // Different application settings
@@ -70,6 +101,16 @@ struct
     uint32_t FrameWidth;
     uint32_t FrameHeight;
     uint32_t FrameRate;
+    bool     JpegEncoding;
+    uint32_t EncoderThreads;
+    uint32_t BufferCount;
+    bool     BufferLeasing;
+    VideoSourceType   Source;
+    XPixelFormat      SyntheticFormat;
+    XSyntheticPattern SyntheticPattern;
+    string   ReplayFileName;
+    float    ReplaySpeed;
+    bool     ReplayLoop;
     uint32_t WebPort;
     string   HtRealm;
     string   HtDigestFileName;
@@ -78,6 +119,7 @@ struct
     string   CameraTitle;
     UserGroup ViewersGroup;
     UserGroup ConfigGroup;
+    vector<UplinkSettings> Uplinks;
 }
 Settings;
 
@@ -97,7 +139,7 @@ public:
     // Video source error notification
     virtual void OnError( const std::string& errorMessage, bool fatal )
     {
-        printf( "[%s] : %s \n", ( ( fatal ) ? "Fatal" : "Error" ), errorMessage.c_str( ) );
+        XLOG_ERROR_LIMITED( 1000, "[%s] : %s", ( ( fatal ) ? "Fatal" : "Error" ), errorMessage.c_str( ) );
         if ( fatal )
         {
             // time to exit if something has bad happened
@@ -109,11 +151,20 @@ public:
 // Set default values for settings
 void SetDefaultSettings( )
 {
-    Settings.DeviceNumber = 0;
-    Settings.FrameWidth   = 640;
-    Settings.FrameHeight  = 480;
-    Settings.FrameRate    = 20;
-    Settings.WebPort      = 8000;
+    Settings.DeviceNumber  = 0;
+    Settings.FrameWidth    = 640;
+    Settings.FrameHeight   = 480;
+    Settings.FrameRate     = 20;
+    Settings.JpegEncoding  = true;
+    Settings.EncoderThreads = 1;
+    Settings.BufferCount   = 4;
+    Settings.BufferLeasing = true;
+    Settings.Source           = VideoSourceType::Camera;
+    Settings.SyntheticFormat  = XPixelFormat::JPEG;
+    Settings.SyntheticPattern = XSyntheticPattern::Gradient;
+    Settings.ReplaySpeed      = 1.0f;
+    Settings.ReplayLoop       = false;
+    Settings.WebPort       = 8000;
 
     Settings.HtRealm = "cam2web";
     Settings.HtDigestFileName.clear( );
@@ -136,6 +187,359 @@ void SetDefaultSettings( )
 #endif
 
     Settings.CameraTitle = DEVICE_NAME;
+
+    // the default receiver still expects frames in the old format
+    Settings.Uplinks.clear( );
+    Settings.Uplinks.push_back( { "primary", DEFAULT_UPLINK_ADDRESS, DEFAULT_UPLINK_PORT,
+                                  DEFAULT_UPLINK_QUEUE, XUplinkDropPolicy::DropOldest, false,
+                                  XUplinkProtocol::Legacy, 0 } );
+}
+
+// Parse uplink specification: <host>:<port>[,queue=<n>][,drop=oldest|newest][,zerocopy=on|off]
+//                             [,proto=v1|legacy][,stream=<id>][,name=<name>]
+bool ParseUplink( const string& value, UplinkSettings& uplink )
+{
+    size_t   optionsStart = value.find( ',' );
+    string   address      = value.substr( 0, optionsStart );
+    size_t   portStart    = address.rfind( ':' );
+    uint32_t port;
+
+    if ( ( portStart == string::npos ) || ( portStart == 0 ) ||
+         ( sscanf( address.c_str( ) + portStart + 1, "%u", &port ) != 1 ) ||
+         ( port == 0 ) || ( port > 65535 ) )
+    {
+        return false;
+    }
+
+    uplink.Address     = address.substr( 0, portStart );
+    uplink.Port        = static_cast<uint16_t>( port );
+    uplink.Name        = address;
+    uplink.QueueLength = DEFAULT_UPLINK_QUEUE;
+    uplink.DropPolicy  = XUplinkDropPolicy::DropOldest;
+    uplink.ZeroCopy    = false;
+    uplink.Protocol    = XUplinkProtocol::Version1;
+    uplink.StreamId    = 0;
+
+    while ( optionsStart != string::npos )
+    {
+        size_t optionEnd = value.find( ',', optionsStart + 1 );
+        string option    = value.substr( optionsStart + 1, ( optionEnd == string::npos ) ? string::npos : optionEnd - optionsStart - 1 );
+        size_t equalPos  = option.find( '=' );
+
+        if ( equalPos == string::npos )
+        {
+            return false;
+        }
+
+        string optionKey   = option.substr( 0, equalPos );
+        string optionValue = option.substr( equalPos + 1 );
+
+        if ( optionKey == "queue" )
+        {
+            if ( ( sscanf( optionValue.c_str( ), "%u", &uplink.QueueLength ) != 1 ) || ( uplink.QueueLength == 0 ) )
+                return false;
+        }
+        else if ( optionKey == "drop" )
+        {
+            if ( optionValue == "oldest" )
+                uplink.DropPolicy = XUplinkDropPolicy::DropOldest;
+            else if ( optionValue == "newest" )
+                uplink.DropPolicy = XUplinkDropPolicy::DropNewest;
+            else
+                return false;
+        }
+        else if ( optionKey == "zerocopy" )
+        {
+            if ( optionValue == "on" )
+                uplink.ZeroCopy = true;
+            else if ( optionValue == "off" )
+                uplink.ZeroCopy = false;
+            else
+                return false;
+        }
+        else if ( optionKey == "proto" )
+        {
+            if ( optionValue == "v1" )
+                uplink.Protocol = XUplinkProtocol::Version1;
+            else if ( optionValue == "legacy" )
+                uplink.Protocol = XUplinkProtocol::Legacy;
+            else
+                return false;
+        }
+        else if ( optionKey == "stream" )
+        {
+            if ( sscanf( optionValue.c_str( ), "%u", &uplink.StreamId ) != 1 )
+                return false;
+        }
+        else if ( ( optionKey == "name" ) && ( !optionValue.empty( ) ) )
+        {
+            uplink.Name = optionValue;
+        }
+        else
+        {
+            return false;
+        }
+
+        optionsStart = optionEnd;
+    }
+
+    return true;
+}
+
+// Parse video source specification: camera | synthetic[,format=jpeg|rgb|gray|yuyv][,pattern=gradient|noise] |
+// replay,file=<path>[,speed=<x>][,loop=on|off]
+bool ParseSource( const string& value )
+{
+    size_t optionsStart = value.find( ',' );
+    string source       = value.substr( 0, optionsStart );
+
+    if ( source == "camera" )
+    {
+        Settings.Source = VideoSourceType::Camera;
+        return ( optionsStart == string::npos );
+    }
+    else if ( source == "synthetic" )
+    {
+        Settings.Source = VideoSourceType::Synthetic;
+    }
+    else if ( source == "replay" )
+    {
+        Settings.Source = VideoSourceType::Replay;
+    }
+    else
+    {
+        return false;
+    }
+
+    while ( optionsStart != string::npos )
+    {
+        size_t optionEnd = value.find( ',', optionsStart + 1 );
+        string option    = value.substr( optionsStart + 1, ( optionEnd == string::npos ) ? string::npos : optionEnd - optionsStart - 1 );
+        size_t equalPos  = option.find( '=' );
+
+        if ( equalPos == string::npos )
+        {
+            return false;
+        }
+
+        string optionKey   = option.substr( 0, equalPos );
+        string optionValue = option.substr( equalPos + 1 );
+
+        if ( ( optionKey == "format" ) && ( Settings.Source == VideoSourceType::Synthetic ) )
+        {
+            if ( optionValue == "jpeg" )
+                Settings.SyntheticFormat = XPixelFormat::JPEG;
+            else if ( optionValue == "rgb" )
+                Settings.SyntheticFormat = XPixelFormat::RGB24;
+            else if ( optionValue == "gray" )
+                Settings.SyntheticFormat = XPixelFormat::Grayscale8;
+            else if ( optionValue == "yuyv" )
+                Settings.SyntheticFormat = XPixelFormat::YUYV;
+            else
+                return false;
+        }
+        else if ( ( optionKey == "pattern" ) && ( Settings.Source == VideoSourceType::Synthetic ) )
+        {
+            if ( optionValue == "gradient" )
+                Settings.SyntheticPattern = XSyntheticPattern::Gradient;
+            else if ( optionValue == "noise" )
+                Settings.SyntheticPattern = XSyntheticPattern::Noise;
+            else
+                return false;
+        }
+        else if ( ( optionKey == "file" ) && ( Settings.Source == VideoSourceType::Replay ) )
+        {
+            Settings.ReplayFileName = optionValue;
+        }
+        else if ( ( optionKey == "speed" ) && ( Settings.Source == VideoSourceType::Replay ) )
+        {
+            char* valueEnd;
+
+            Settings.ReplaySpeed = strtof( optionValue.c_str( ), &valueEnd );
+
+            if ( ( *valueEnd != '\0' ) || ( valueEnd == optionValue.c_str( ) ) ||
+                 ( Settings.ReplaySpeed < 0.0f ) || ( Settings.ReplaySpeed > 1000.0f ) )
+                return false;
+        }
+        else if ( ( optionKey == "loop" ) && ( Settings.Source == VideoSourceType::Replay ) )
+        {
+            if ( optionValue == "on" )
+                Settings.ReplayLoop = true;
+            else if ( optionValue == "off" )
+                Settings.ReplayLoop = false;
+            else
+                return false;
+        }
+        else
+        {
+            return false;
+        }
+
+        optionsStart = optionEnd;
+    }
+
+    // replay needs something to replay
+    return ( ( Settings.Source != VideoSourceType::Replay ) || ( !Settings.ReplayFileName.empty( ) ) );
+}
+
+// Parse command line and override default settings
+bool ParseCommandLine( int argc, char* argv[] )
+{
+    bool uplinksSpecified = false;
+    bool ret = true;
+    int  i;
+
+    for ( i = 1; i < argc; i++ )
+    {
+        char* ptrDelimiter = strchr( argv[i], ':' );
+
+        if ( ( ptrDelimiter == nullptr ) || ( argv[i][0] != '-' ) )
+        {
+            break;
+        }
+
+        string key   = string( argv[i] + 1, ptrDelimiter - argv[i] - 1 );
+        string value = string( ptrDelimiter + 1 );
+
+        if ( ( key.empty( ) ) || ( value.empty( ) ) )
+            break;
+
+        if ( key == "format" )
+        {
+            if ( value == "mjpeg" )
+                Settings.JpegEncoding = true;
+            else if ( value == "yuyv" )
+                Settings.JpegEncoding = false;
+            else
+                break;
+        }
+        else if ( key == "encthreads" )
+        {
+            int scanned = sscanf( value.c_str( ), "%u", &(Settings.EncoderThreads) );
+
+            if ( ( scanned != 1 ) || ( Settings.EncoderThreads < 1 ) || ( Settings.EncoderThreads > 16 ) )
+                break;
+        }
+        else if ( key == "buffers" )
+        {
+            int scanned = sscanf( value.c_str( ), "%u", &(Settings.BufferCount) );
+
+            if ( ( scanned != 1 ) || ( Settings.BufferCount < 2 ) || ( Settings.BufferCount > 32 ) )
+                break;
+        }
+        else if ( key == "lease" )
+        {
+            if ( value == "on" )
+                Settings.BufferLeasing = true;
+            else if ( value == "off" )
+                Settings.BufferLeasing = false;
+            else
+                break;
+        }
+        else if ( key == "size" )
+        {
+            int scanned = sscanf( value.c_str( ), "%ux%u", &(Settings.FrameWidth), &(Settings.FrameHeight) );
+
+            if ( ( scanned != 2 ) || ( Settings.FrameWidth < 16 ) || ( Settings.FrameHeight < 16 ) ||
+                 ( Settings.FrameWidth > 8192 ) || ( Settings.FrameHeight > 8192 ) )
+                break;
+        }
+        else if ( key == "fps" )
+        {
+            int scanned = sscanf( value.c_str( ), "%u", &(Settings.FrameRate) );
+
+            if ( ( scanned != 1 ) || ( Settings.FrameRate > 1000 ) )
+                break;
+        }
+        else if ( key == "source" )
+        {
+            if ( !ParseSource( value ) )
+                break;
+        }
+        else if ( key == "uplink" )
+        {
+            // the first uplink on command line replaces the default one
+            if ( !uplinksSpecified )
+            {
+                Settings.Uplinks.clear( );
+                uplinksSpecified = true;
+            }
+
+            if ( value != "none" )
+            {
+                UplinkSettings uplink;
+
+                if ( !ParseUplink( value, uplink ) )
+                    break;
+
+                Settings.Uplinks.push_back( uplink );
+            }
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    // camera can not go as fast as possible
+    if ( ( Settings.FrameRate == 0 ) && ( Settings.Source == VideoSourceType::Camera ) )
+    {
+        i = 0;
+    }
+
+    if ( i != argc )
+    {
+        printf( "cam2web - streaming camera to web \n" );
+        printf( "Version: %s \n\n", STR_INFO_VERSION );
+        printf( "Available command line options: \n" );
+        printf( "  -format:<?> Format to capture from camera: mjpeg, yuyv. YUYV frames \n" );
+        printf( "              are compressed without converting them to RGB first. \n" );
+        printf( "              Default is 'mjpeg'. \n" );
+        printf( "  -encthreads:<1-16> Number of threads to compress YUYV frames with. \n" );
+        printf( "              Frames are split into strips compressed in parallel. \n" );
+        printf( "              Default is 1. \n" );
+        printf( "  -buffers:<2-32> Number of capture buffers to request from camera driver. \n" );
+        printf( "              Default is 4. \n" );
+        printf( "  -lease:<?>  Provide camera's frames without copying them, while at \n" );
+        printf( "              least 2 capture buffers are left to the driver: on, off. \n" );
+        printf( "              Default is 'on'. \n" );
+        printf( "  -size:<?>   Size of video frames, <width>x<height>. Default is 640x480. \n" );
+        printf( "  -fps:<0-1000> Frame rate to capture at; 0 provides frames as fast as \n" );
+        printf( "              possible (synthetic and replay video sources only). \n" );
+        printf( "              Replay uses it for recordings without capture times. \n" );
+        printf( "              Default is 20. \n" );
+        printf( "  -source:<?> Video source to stream: camera, synthetic test pattern \n" );
+        printf( "              generator, which does not need any camera, or replay of \n" );
+        printf( "              a recorded MJPEG stream: \n" );
+        printf( "              synthetic[,format=jpeg|rgb|gray|yuyv] \n" );
+        printf( "                       [,pattern=gradient|noise] \n" );
+        printf( "              replay,file=<path>[,speed=<x>][,loop=on|off] \n" );
+        printf( "              Default is 'camera', synthetic source provides gradient \n" );
+        printf( "              JPEG frames by default. Replay reads concatenated JPEGs, \n" );
+        printf( "              multipart MJPEG or frames saved from an uplink; speed \n" );
+        printf( "              scales original timing (0 - as fast as possible). \n" );
+        printf( "  -uplink:<?> Receiver to send all frames to, can be repeated to send to \n" );
+        printf( "              several receivers at once. Format of the value is: \n" );
+        printf( "              <host>:<port>[,queue=<n>][,drop=oldest|newest] \n" );
+        printf( "                           [,zerocopy=on|off][,proto=v1|legacy] \n" );
+        printf( "                           [,stream=<id>][,name=<?>] \n" );
+        printf( "              queue - number of frames to keep while the receiver is \n" );
+        printf( "                      slow or unreachable (default is %u); \n", DEFAULT_UPLINK_QUEUE );
+        printf( "              drop  - which frame to discard when queue is full; \n" );
+        printf( "              zerocopy - send with MSG_ZEROCOPY (default is off); \n" );
+        printf( "              proto - 'v1' sends a header with sequence number, capture \n" );
+        printf( "                      time and frame size (default); 'legacy' sends \n" );
+        printf( "                      only the size of a frame; \n" );
+        printf( "              stream - stream id to put into v1 headers; \n" );
+        printf( "              name  - name of the receiver used in log messages. \n" );
+        printf( "              Use 'none' to disable sending. Default is %s:%u \n", DEFAULT_UPLINK_ADDRESS, DEFAULT_UPLINK_PORT );
+        printf( "              using legacy protocol. \n" );
+        printf( "\n" );
+
+        ret = false;
+    }
+
+    return ret;
 }
 
 
@@ -144,7 +548,12 @@ int main( int argc, char* argv[] )
     struct sigaction sigIntAction;
 
     SetDefaultSettings( );
-    
+
+    if ( !ParseCommandLine( argc, argv ) )
+    {
+        return -1;
+    }
+
     // set-up handler for certain signals
     sigIntAction.sa_handler = sigIntHandler;
     sigemptyset( &sigIntAction.sa_mask );
@@ -200,6 +609,11 @@ int main( int argc, char* argv[] )
     xcamera->SetVideoDevice( Settings.DeviceNumber );
     xcamera->SetVideoSize( Settings.FrameWidth, Settings.FrameHeight );
     xcamera->SetFrameRate(Settings.FrameRate );
+    xcamera->EnableJpegEncoding( Settings.JpegEncoding );
+    xcamera->SetBufferCount( Settings.BufferCount );
+    xcamera->EnableBufferLeasing( Settings.BufferLeasing );
+
+    video2web.SetJpegThreadCount( Settings.EncoderThreads );
 
     // restore camera settings
     serializer.LoadConfiguration( );
@@ -210,11 +624,56 @@ int main( int argc, char* argv[] )
 
     listenerChain.Add( video2web.VideoSourceListener( ) );
     listenerChain.Add( &cameraErrorListener );
-    xcamera->SetListener( &listenerChain );
-    
 
-    printf("Camera Started \n");
-        xcamera->Start( );
+    // stream either the camera, generated test pattern or recorded stream
+    shared_ptr<XSyntheticVideoSource> xsynthetic;
+    shared_ptr<XReplayVideoSource>    xreplay;
+    IVideoSource*                     videoSource = xcamera.get( );
+
+    if ( Settings.Source == VideoSourceType::Synthetic )
+    {
+        xsynthetic = XSyntheticVideoSource::Create( );
+        xsynthetic->SetVideoSize( Settings.FrameWidth, Settings.FrameHeight );
+        xsynthetic->SetFrameRate( Settings.FrameRate );
+        xsynthetic->SetPixelFormat( Settings.SyntheticFormat );
+        xsynthetic->SetPattern( Settings.SyntheticPattern );
+        videoSource = xsynthetic.get( );
+    }
+    else if ( Settings.Source == VideoSourceType::Replay )
+    {
+        xreplay = XReplayVideoSource::Create( );
+        xreplay->SetFileName( Settings.ReplayFileName );
+        xreplay->SetSpeed( Settings.ReplaySpeed );
+        xreplay->SetFrameRate( Settings.FrameRate );
+        xreplay->SetLooped( Settings.ReplayLoop );
+        videoSource = xreplay.get( );
+    }
+
+    videoSource->SetListener( &listenerChain );
+
+    // create uplinks sending frames to remote receivers, each from its own thread
+    vector<shared_ptr<XUplinkSender>> uplinks;
+
+    for ( const UplinkSettings& uplinkSettings : Settings.Uplinks )
+    {
+        shared_ptr<XUplinkSender> uplink = make_shared<XUplinkSender>( uplinkSettings.Address, uplinkSettings.Port,
+                                                                       uplinkSettings.QueueLength, uplinkSettings.DropPolicy,
+                                                                       uplinkSettings.Protocol );
+
+        uplink->SetName( uplinkSettings.Name );
+        uplink->SetStreamId( uplinkSettings.StreamId );
+        uplink->EnableZeroCopy( uplinkSettings.ZeroCopy );
+        uplink->Start( );
+        video2web.AddUplink( uplink );
+        uplinks.push_back( uplink );
+
+        printf( "Uplink [%s] - sending frames to %s:%u \n", uplinkSettings.Name.c_str( ),
+                uplinkSettings.Address.c_str( ), uplinkSettings.Port );
+    }
+
+    printf( "%s Started \n", ( Settings.Source == VideoSourceType::Synthetic ) ? "Synthetic video source" :
+                              ( Settings.Source == VideoSourceType::Replay )    ? "Replay video source" : "Camera" );
+        videoSource->Start( );
 
         while ( !ExitEvent.Wait( 60000 ) )
         {
@@ -224,8 +683,18 @@ int main( int argc, char* argv[] )
 
         serializer.SaveConfiguration( );
 
-        xcamera->SignalToStop( );
-        xcamera->WaitForStop( );
+        videoSource->SignalToStop( );
+        videoSource->WaitForStop( );
+
+        for ( const shared_ptr<XUplinkSender>& uplink : uplinks )
+        {
+            video2web.RemoveUplink( uplink );
+            uplink->SignalToStop( );
+        }
+        for ( const shared_ptr<XUplinkSender>& uplink : uplinks )
+        {
+            uplink->WaitForStop( );
+        }
     
     return 0;
 }
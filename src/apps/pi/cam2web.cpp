@@ -30,9 +30,12 @@
 #include "XRaspiCameraConfig.hpp"
 #include "XWebServer.hpp"
 #include "XVideoSourceToWeb.hpp"
+#include "XUplinkSender.hpp"
 #include "XObjectConfigurationSerializer.hpp"
 #include "XObjectConfigurationRequestHandler.hpp"
+#include "XMetrics.hpp"
 #include "XManualResetEvent.hpp"
+#include "XLog.hpp"
 
 // Release build embeds web resources into executable
 #ifdef NDEBUG
@@ -55,9 +58,16 @@ using namespace std;
 #define STR_INFO_VERSION        "1.1.0"
 #define STR_INFO_PLATFORM       "RaspberryPi"
 
+// How long browsers may cache embedded images and libraries without asking if they changed, seconds
+#define STATIC_CONTENT_MAX_AGE  (7 * 24 * 3600)
+
 // Name of the device and default title of the camera
 const char* DEVICE_NAME = "RaspberryPi Camera";
 
+// Receiver to send all frames to
+#define DEFAULT_UPLINK_ADDRESS  "35.163.144.7"
+#define DEFAULT_UPLINK_PORT     (9000)
+
 XManualResetEvent ExitEvent;
 
 // Different application settings
@@ -68,6 +78,7 @@ struct
     uint32_t FrameRate;
     uint32_t JpegQuality;
     uint32_t WebPort;
+    uint32_t WebThreads;
     string   HtRealm;
     string   HtDigestFileName;
     string   CameraConfigFileName;
@@ -95,7 +106,7 @@ public:
     // Video source error notification
     virtual void OnError( const std::string& errorMessage, bool fatal )
     {
-        printf( "[%s] : %s \n", ( ( fatal ) ? "Fatal" : "Error" ), errorMessage.c_str( ) );
+        XLOG_ERROR_LIMITED( 1000, "[%s] : %s", ( ( fatal ) ? "Fatal" : "Error" ), errorMessage.c_str( ) );
         if ( fatal )
         {
             // time to exit if something has bad happened
@@ -112,6 +123,7 @@ void SetDefaultSettings( )
     Settings.FrameRate   = 30;
     Settings.JpegQuality = 10;
     Settings.WebPort     = 8000;
+    Settings.WebThreads  = 1;
 
     Settings.HtRealm = "cam2web";
     Settings.HtDigestFileName.clear( );
@@ -214,6 +226,13 @@ bool ParseCommandLine( int argc, char* argv[] )
             if ( Settings.WebPort > 65535 )
                 Settings.WebPort = 65535;
         }
+        else if ( key == "threads" )
+        {
+            int scanned = sscanf( value.c_str( ), "%u", &(Settings.WebThreads) );
+
+            if ( ( scanned != 1 ) || ( Settings.WebThreads < 1 ) || ( Settings.WebThreads > 32 ) )
+                break;
+        }
         else if ( key == "realm" )
         {
             Settings.HtRealm = value;
@@ -307,6 +326,8 @@ bool ParseCommandLine( int argc, char* argv[] )
         printf( "              Default is 10. \n" );
         printf( "  -port:<num> Port number for web server to listen on. \n" );
         printf( "              Default is 8000. \n" );
+        printf( "  -threads:<1-32> Number of threads serving web clients. Connections \n" );
+        printf( "              are spread between them by the system. Default is 1. \n" );
         printf( "  -realm:<?>  HTTP digest authentication domain. \n" );
         printf( "              Default is 'cam2web'. \n" );
         printf( "  -htpass:<?> htdigest file containing list of users to access the camera. \n" );
@@ -386,6 +407,8 @@ int main( int argc, char* argv[] )
     UserGroup           viewersGroup = Settings.ViewersGroup;
     UserGroup           configGroup  = Settings.ConfigGroup;
 
+    server.SetThreadCount( Settings.WebThreads );
+
     if ( !Settings.HtRealm.empty( ) )
     {
         server.SetAuthDomain( Settings.HtRealm );
@@ -409,7 +432,10 @@ int main( int argc, char* argv[] )
            AddHandler( make_shared<XObjectInformationRequestHandler>( "/camera/properties", make_shared<XRaspiCameraPropsInfo>( xcamera ) ), configGroup ).
            AddHandler( make_shared<XObjectInformationRequestHandler>( "/camera/info", make_shared<XObjectInformationMap>( cameraInfo ) ), viewersGroup ).
            AddHandler( video2web.CreateJpegHandler( "/camera/jpeg" ), viewersGroup ).
-           AddHandler( video2web.CreateMjpegHandler( "/camera/mjpeg", Settings.FrameRate ), viewersGroup );
+           AddHandler( video2web.CreateMjpegHandler( "/camera/mjpeg", Settings.FrameRate ), viewersGroup ).
+           AddHandler( video2web.CreateWebSocketHandler( "/camera/ws", Settings.FrameRate ), viewersGroup ).
+           AddHandler( video2web.CreateStreamStatsHandler( "/camera/streams" ), configGroup ).
+           AddHandler( make_shared<XMetricsRequestHandler>( "/metrics" ) );
 
     // use custom or embedded web content
     if ( !Settings.CustomWebContent.empty( ) )
@@ -423,14 +449,14 @@ int main( int argc, char* argv[] )
         server.AddHandler( make_shared<XEmbeddedContentHandler>( "/", &web_index_html ), viewersGroup ).
                AddHandler( make_shared<XEmbeddedContentHandler>( "index.html", &web_index_html ), viewersGroup ).
                AddHandler( make_shared<XEmbeddedContentHandler>( "styles.css", &web_styles_css ), viewersGroup ).
-               AddHandler( make_shared<XEmbeddedContentHandler>( "cam2web.png", &web_cam2web_png ) ).
-               AddHandler( make_shared<XEmbeddedContentHandler>( "cam2web_white.png", &web_cam2web_white_png ) ).
+               AddHandler( make_shared<XEmbeddedContentHandler>( "cam2web.png", &web_cam2web_png, STATIC_CONTENT_MAX_AGE ) ).
+               AddHandler( make_shared<XEmbeddedContentHandler>( "cam2web_white.png", &web_cam2web_white_png, STATIC_CONTENT_MAX_AGE ) ).
                AddHandler( make_shared<XEmbeddedContentHandler>( "camera.js", &web_camera_js ), viewersGroup ).
                AddHandler( make_shared<XEmbeddedContentHandler>( "cameraproperties.js", &web_cameraproperties_js ), viewersGroup ).
                AddHandler( make_shared<XEmbeddedContentHandler>( "cameraproperties.html", &web_cameraproperties_html ), configGroup ).
-               AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.js", &web_jquery_js ), viewersGroup ).
-               AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.mobile.js", &web_jquery_mobile_js ), viewersGroup ).
-               AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.mobile.css", &web_jquery_mobile_css ), viewersGroup );
+               AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.js", &web_jquery_js, STATIC_CONTENT_MAX_AGE ), viewersGroup ).
+               AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.mobile.js", &web_jquery_mobile_js, STATIC_CONTENT_MAX_AGE ), viewersGroup ).
+               AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.mobile.css", &web_jquery_mobile_css, STATIC_CONTENT_MAX_AGE ), viewersGroup );
     #endif
     }
 
@@ -442,6 +468,14 @@ int main( int argc, char* argv[] )
     listenerChain.Add( &cameraErrorListener );
     xcamera->SetListener( &listenerChain );
 
+    // send all frames to the remote receiver as well (it expects frames in the old format)
+    shared_ptr<XUplinkSender> uplink = make_shared<XUplinkSender>( DEFAULT_UPLINK_ADDRESS, DEFAULT_UPLINK_PORT, 8,
+                                                                   XUplinkDropPolicy::DropOldest, XUplinkProtocol::Legacy );
+
+    uplink->SetName( "primary" );
+    uplink->Start( );
+    video2web.AddUplink( uplink );
+
     if ( server.Start( ) )
     {
         printf( "Web server started on port %d ...\n", server.Port( ) );
@@ -459,6 +493,7 @@ int main( int argc, char* argv[] )
         xcamera->SignalToStop( );
         xcamera->WaitForStop( );
         server.Stop( );
+        uplink->WaitForStop( );
 
         printf( "Done \n" );
     }
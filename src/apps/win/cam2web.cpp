@@ -46,6 +46,7 @@
 #include "XVideoSourceToWeb.hpp"
 #include "XObjectConfigurationSerializer.hpp"
 #include "XObjectConfigurationRequestHandler.hpp"
+#include "XMetrics.hpp"
 #include "AppConfig.hpp"
 
 // Release build embeds web resources into executable
@@ -103,6 +104,9 @@ using namespace std::chrono;
 #define STR_INFO_VERSION        "1.1.0"
 #define STR_INFO_PLATFORM       "Windows"
 
+// How long browsers may cache embedded images and libraries without asking if they changed, seconds
+#define STATIC_CONTENT_MAX_AGE  (7 * 24 * 3600)
+
 // Available application icons
 static const int AppIconIds[]       = { IDI_CAM2WEB, IDI_CAM2WEB_GREEN, IDI_CAM2WEB_ORANGE, IDI_CAM2WEB_RED };
 static const int AppActiveIconIds[] = { IDI_CAMERA_ACTIVE_BLUE, IDI_CAMERA_ACTIVE_GREEN, IDI_CAMERA_ACTIVE_ORANGE, IDI_CAMERA_ACTIVE_RED };
@@ -787,7 +791,9 @@ static bool StartVideoStreaming( )
                       AddHandler( make_shared<XObjectInformationRequestHandler>( "/camera/properties", make_shared<XLocalVideoDevicePropsInfo>( gData->camera ) ), configGroup ).
                       AddHandler( make_shared<XObjectInformationRequestHandler>( "/camera/info", make_shared<XObjectInformationMap>( cameraInfo ) ), viewersGroup ).
                       AddHandler( gData->video2web.CreateJpegHandler( "/camera/jpeg" ), viewersGroup ).
-                      AddHandler( gData->video2web.CreateMjpegHandler( "/camera/mjpeg", gData->appConfig->MjpegFrameRate( ) ), viewersGroup );
+                      AddHandler( gData->video2web.CreateMjpegHandler( "/camera/mjpeg", gData->appConfig->MjpegFrameRate( ) ), viewersGroup ).
+                      AddHandler( gData->video2web.CreateWebSocketHandler( "/camera/ws", gData->appConfig->MjpegFrameRate( ) ), viewersGroup ).
+                      AddHandler( make_shared<XMetricsRequestHandler>( "/metrics" ) );
 
         // check if custom web content is available
         if ( !gData->appConfig->CustomWebContent( ).empty( ) )
@@ -804,14 +810,14 @@ static bool StartVideoStreaming( )
             gData->server.AddHandler( make_shared<XEmbeddedContentHandler>( "/", &web_index_html ), viewersGroup ).
                           AddHandler( make_shared<XEmbeddedContentHandler>( "index.html", &web_index_html ), viewersGroup ).
                           AddHandler( make_shared<XEmbeddedContentHandler>( "styles.css", &web_styles_css ), viewersGroup ).
-                          AddHandler( make_shared<XEmbeddedContentHandler>( "cam2web.png", &web_cam2web_png ) ).
-                          AddHandler( make_shared<XEmbeddedContentHandler>( "cam2web_white.png", &web_cam2web_white_png ) ).
+                          AddHandler( make_shared<XEmbeddedContentHandler>( "cam2web.png", &web_cam2web_png, STATIC_CONTENT_MAX_AGE ) ).
+                          AddHandler( make_shared<XEmbeddedContentHandler>( "cam2web_white.png", &web_cam2web_white_png, STATIC_CONTENT_MAX_AGE ) ).
                           AddHandler( make_shared<XEmbeddedContentHandler>( "camera.js", &web_camera_js ), viewersGroup ).
                           AddHandler( make_shared<XEmbeddedContentHandler>( "cameraproperties.js", &web_cameraproperties_js ), viewersGroup ).
                           AddHandler( make_shared<XEmbeddedContentHandler>( "cameraproperties.html", &web_cameraproperties_html ), configGroup ).
-                          AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.js", &web_jquery_js ), viewersGroup ).
-                          AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.mobile.js", &web_jquery_mobile_js ), viewersGroup ).
-                          AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.mobile.css", &web_jquery_mobile_css ), viewersGroup );
+                          AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.js", &web_jquery_js, STATIC_CONTENT_MAX_AGE ), viewersGroup ).
+                          AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.mobile.js", &web_jquery_mobile_js, STATIC_CONTENT_MAX_AGE ), viewersGroup ).
+                          AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.mobile.css", &web_jquery_mobile_css, STATIC_CONTENT_MAX_AGE ), viewersGroup );
 #endif
         }
 
@@ -1389,11 +1395,11 @@ void AppData::StartAdminServer( )
         adminServer.AddHandler( make_shared<XEmbeddedContentHandler>( "/", &web_admin_html ), UserGroup::Admin ).
             AddHandler( make_shared<XEmbeddedContentHandler>( "index.html", &web_admin_html ), UserGroup::Admin ).
             AddHandler( make_shared<XEmbeddedContentHandler>( "styles.css", &web_styles_css ), UserGroup::Admin ).
-                    AddHandler( make_shared<XEmbeddedContentHandler>( "cam2web.png", &web_cam2web_png ) ).
-                    AddHandler( make_shared<XEmbeddedContentHandler>( "cam2web_white.png", &web_cam2web_white_png ) ).
-                    AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.js", &web_jquery_js ), UserGroup::Admin ).
-                    AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.mobile.js", &web_jquery_mobile_js ), UserGroup::Admin ).
-                    AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.mobile.css", &web_jquery_mobile_css ), UserGroup::Admin );
+                    AddHandler( make_shared<XEmbeddedContentHandler>( "cam2web.png", &web_cam2web_png, STATIC_CONTENT_MAX_AGE ) ).
+                    AddHandler( make_shared<XEmbeddedContentHandler>( "cam2web_white.png", &web_cam2web_white_png, STATIC_CONTENT_MAX_AGE ) ).
+                    AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.js", &web_jquery_js, STATIC_CONTENT_MAX_AGE ), UserGroup::Admin ).
+                    AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.mobile.js", &web_jquery_mobile_js, STATIC_CONTENT_MAX_AGE ), UserGroup::Admin ).
+                    AddHandler( make_shared<XEmbeddedContentHandler>( "jquery.mobile.css", &web_jquery_mobile_css, STATIC_CONTENT_MAX_AGE ), UserGroup::Admin );
 #endif
 
         if ( !adminServer.Start( ) )
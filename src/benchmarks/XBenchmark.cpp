@@ -0,0 +1,238 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <math.h>
+#include <time.h>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#include "XBenchmark.hpp"
+
+using namespace std;
+using namespace std::chrono;
+
+// number of iterations done before measuring anything (warm up caches, pools, connections)
+#define WARMUP_ITERATIONS (3)
+
+XBenchmark::XBenchmark( ) :
+    mMinTimeMs( 1000 ), mMinIterations( 10 ), mMaxIterations( 100000 ), mFilter( ), mResults( )
+{
+}
+
+// Set for how long to run every benchmark and limits for number of iterations
+void XBenchmark::SetLimits( uint32_t minTimeMs, uint32_t minIterations, uint32_t maxIterations )
+{
+    mMinTimeMs     = minTimeMs;
+    mMinIterations = ( minIterations == 0 ) ? 1 : minIterations;
+    mMaxIterations = ( maxIterations < mMinIterations ) ? mMinIterations : maxIterations;
+}
+
+// Set filter - only benchmarks with names containing it are run
+void XBenchmark::SetFilter( const string& filter )
+{
+    mFilter = filter;
+}
+
+// Check if benchmark with the specified name passes the filter
+bool XBenchmark::IsSelected( const string& name ) const
+{
+    return ( ( mFilter.empty( ) ) || ( name.find( mFilter ) != string::npos ) );
+}
+
+// Run benchmark timing every call of the operation
+bool XBenchmark::Run( const string& name, uint64_t bytesPerOp, const function<void( )>& operation )
+{
+    return RunTimed( name, bytesPerOp, [&operation]( ) -> int64_t
+    {
+        steady_clock::time_point start = steady_clock::now( );
+
+        operation( );
+
+        return duration_cast<nanoseconds>( steady_clock::now( ) - start ).count( );
+    } );
+}
+
+// Run benchmark, which measures its time itself
+bool XBenchmark::RunTimed( const string& name, uint64_t bytesPerOp, const TimedOperation& operation )
+{
+    vector<int64_t>          samples;
+    steady_clock::time_point start;
+    bool                     ret = true;
+
+    if ( !IsSelected( name ) )
+    {
+        return false;
+    }
+
+    for ( int i = 0; ( i < WARMUP_ITERATIONS ) && ( ret ); i++ )
+    {
+        ret = ( operation( ) >= 0 );
+    }
+
+    start = steady_clock::now( );
+
+    while ( ret )
+    {
+        int64_t time = operation( );
+
+        if ( time < 0 )
+        {
+            ret = false;
+        }
+        else
+        {
+            samples.push_back( time );
+
+            if ( ( samples.size( ) >= mMaxIterations ) ||
+                 ( ( samples.size( ) >= mMinIterations ) &&
+                   ( duration_cast<milliseconds>( steady_clock::now( ) - start ).count( ) >= mMinTimeMs ) ) )
+            {
+                break;
+            }
+        }
+    }
+
+    if ( !ret )
+    {
+        fprintf( stderr, "%s - FAILED \n", name.c_str( ) );
+    }
+    else
+    {
+        mResults.push_back( Calculate( name, bytesPerOp, samples ) );
+    }
+
+    return ret;
+}
+
+// Results of all benchmarks run so far
+const vector<XBenchmarkResult>& XBenchmark::Results( ) const
+{
+    return mResults;
+}
+
+// Calculate statistics of the collected samples
+XBenchmarkResult XBenchmark::Calculate( const string& name, uint64_t bytesPerOp, vector<int64_t>& samples )
+{
+    XBenchmarkResult result;
+    size_t           count = samples.size( );
+    double           sum   = 0;
+    double           sumSq = 0;
+
+    sort( samples.begin( ), samples.end( ) );
+
+    for ( int64_t sample : samples )
+    {
+        sum += static_cast<double>( sample );
+    }
+
+    result.Name       = name;
+    result.Iterations = static_cast<uint32_t>( count );
+    result.BytesPerOp = bytesPerOp;
+    result.Mean       = sum / count;
+
+    for ( int64_t sample : samples )
+    {
+        double diff = static_cast<double>( sample ) - result.Mean;
+        sumSq += diff * diff;
+    }
+
+    // percentiles use nearest rank
+    auto percentile = [&samples, count]( double p ) -> double
+    {
+        size_t rank = static_cast<size_t>( ceil( p / 100.0 * count ) );
+        return static_cast<double>( samples[( rank == 0 ) ? 0 : rank - 1] );
+    };
+
+    result.StdDev       = sqrt( sumSq / count );
+    result.Min          = static_cast<double>( samples.front( ) );
+    result.P50          = percentile( 50 );
+    result.P90          = percentile( 90 );
+    result.P99          = percentile( 99 );
+    result.Max          = static_cast<double>( samples.back( ) );
+    result.MBPerSecond  = ( result.Mean > 0 ) ? bytesPerOp * 1000.0 / result.Mean : 0;
+    result.OpsPerSecond = ( result.Mean > 0 ) ? 1000000000.0 / result.Mean : 0;
+
+    return result;
+}
+
+// Print header of the results table
+void XBenchmark::PrintHeader( FILE* file )
+{
+    fprintf( file, "%-40s %8s %12s %12s %12s %12s %10s %10s \n",
+             "Benchmark", "Iters", "ns/op", "p50", "p99", "max", "MB/s", "ops/s" );
+}
+
+// Print a result as human readable table row
+void XBenchmark::PrintResult( FILE* file, const XBenchmarkResult& result )
+{
+    fprintf( file, "%-40s %8u %12.0f %12.0f %12.0f %12.0f %10.1f %10.1f \n",
+             result.Name.c_str( ), result.Iterations, result.Mean, result.P50, result.P99, result.Max,
+             result.MBPerSecond, result.OpsPerSecond );
+}
+
+// Write all results as JSON
+void XBenchmark::WriteJson( FILE* file ) const
+{
+    char       strTime[32] = "";
+    time_t     now         = time( nullptr );
+    struct tm  utcTime;
+
+    if ( gmtime_r( &now, &utcTime ) != nullptr )
+    {
+        strftime( strTime, sizeof( strTime ), "%Y-%m-%dT%H:%M:%SZ", &utcTime );
+    }
+
+    fprintf( file, "{\n" );
+    fprintf( file, "  \"suite\": \"cam2web\",\n" );
+    fprintf( file, "  \"timestamp\": \"%s\",\n", strTime );
+    fprintf( file, "  \"compiler\": \"%s\",\n", __VERSION__ );
+    fprintf( file, "  \"cpus\": %u,\n", thread::hardware_concurrency( ) );
+    fprintf( file, "  \"results\": [\n" );
+
+    for ( size_t i = 0; i < mResults.size( ); i++ )
+    {
+        const XBenchmarkResult& result = mResults[i];
+
+        fprintf( file, "    { \"name\": \"%s\", \"iterations\": %u, \"bytes_per_op\": %llu, "
+                       "\"ns_per_op\": %.1f, \"stddev_ns\": %.1f, \"min_ns\": %.0f, \"p50_ns\": %.0f, "
+                       "\"p90_ns\": %.0f, \"p99_ns\": %.0f, \"max_ns\": %.0f, \"mb_per_s\": %.2f, \"ops_per_s\": %.2f }%s\n",
+                 result.Name.c_str( ), result.Iterations, static_cast<unsigned long long>( result.BytesPerOp ),
+                 result.Mean, result.StdDev, result.Min, result.P50, result.P90, result.P99, result.Max,
+                 result.MBPerSecond, result.OpsPerSecond, ( i + 1 == mResults.size( ) ) ? "" : "," );
+    }
+
+    fprintf( file, "  ]\n" );
+    fprintf( file, "}\n" );
+}
+
+// Write all results as CSV
+void XBenchmark::WriteCsv( FILE* file ) const
+{
+    fprintf( file, "name,iterations,bytes_per_op,ns_per_op,stddev_ns,min_ns,p50_ns,p90_ns,p99_ns,max_ns,mb_per_s,ops_per_s\n" );
+
+    for ( const XBenchmarkResult& result : mResults )
+    {
+        fprintf( file, "%s,%u,%llu,%.1f,%.1f,%.0f,%.0f,%.0f,%.0f,%.0f,%.2f,%.2f\n",
+                 result.Name.c_str( ), result.Iterations, static_cast<unsigned long long>( result.BytesPerOp ),
+                 result.Mean, result.StdDev, result.Min, result.P50, result.P90, result.P99, result.Max,
+                 result.MBPerSecond, result.OpsPerSecond );
+    }
+}
@@ -0,0 +1,94 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef XBENCHMARK_HPP
+#define XBENCHMARK_HPP
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <functional>
+
+// Statistics of a single benchmark. All times are in nanoseconds per operation.
+struct XBenchmarkResult
+{
+    std::string Name;
+    uint32_t    Iterations;
+    uint64_t    BytesPerOp;
+    double      Mean;
+    double      StdDev;
+    double      Min;
+    double      P50;
+    double      P90;
+    double      P99;
+    double      Max;
+    double      MBPerSecond;    // bytes per operation / mean time, 10^6 bytes
+    double      OpsPerSecond;   // 1 / mean time - frames per second for frame operations
+};
+
+// Runs benchmarks, timing every iteration separately, so percentiles can be reported,
+// and collects their results
+class XBenchmark
+{
+public:
+    // Operation timed by the caller - returns its time in nanoseconds or negative value on failure
+    typedef std::function<int64_t( )> TimedOperation;
+
+public:
+    XBenchmark( );
+
+    // Set for how long to run every benchmark (milliseconds) and limits for number of iterations
+    void SetLimits( uint32_t minTimeMs, uint32_t minIterations, uint32_t maxIterations );
+
+    // Set filter - only benchmarks with names containing it are run (empty - run all)
+    void SetFilter( const std::string& filter );
+    // Check if benchmark with the specified name passes the filter
+    bool IsSelected( const std::string& name ) const;
+
+    // Run benchmark if it passes the filter. The operation is called once per iteration; bytes per
+    // operation is the amount of data processed by one call (0 if throughput makes no sense).
+    bool Run( const std::string& name, uint64_t bytesPerOp, const std::function<void( )>& operation );
+    // Same as above, but the operation measures its time itself (for asynchronous pipelines)
+    bool RunTimed( const std::string& name, uint64_t bytesPerOp, const TimedOperation& operation );
+
+    // Results of all benchmarks run so far
+    const std::vector<XBenchmarkResult>& Results( ) const;
+
+    // Print a result as human readable table row (and the table header)
+    static void PrintHeader( FILE* file );
+    static void PrintResult( FILE* file, const XBenchmarkResult& result );
+
+    // Write all results as JSON/CSV
+    void WriteJson( FILE* file ) const;
+    void WriteCsv( FILE* file ) const;
+
+private:
+    static XBenchmarkResult Calculate( const std::string& name, uint64_t bytesPerOp, std::vector<int64_t>& samples );
+
+private:
+    uint32_t                      mMinTimeMs;
+    uint32_t                      mMinIterations;
+    uint32_t                      mMaxIterations;
+    std::string                   mFilter;
+    std::vector<XBenchmarkResult> mResults;
+};
+
+#endif // XBENCHMARK_HPP
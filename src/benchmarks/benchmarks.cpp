@@ -0,0 +1,768 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <arpa/inet.h>
+#include <string>
+#include <vector>
+#include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <chrono>
+
+#include "XBenchmark.hpp"
+#include "XImage.hpp"
+#include "XYuyvToRgb.hpp"
+#include "XJpegEncoder.hpp"
+#include "XSimpleJsonParser.hpp"
+#include "XVideoSourceToWeb.hpp"
+#include "XUplinkSender.hpp"
+#include "XWebServer.hpp"
+
+using namespace std;
+using namespace std::chrono;
+
+// Frame size to run benchmarks for
+struct FrameSize
+{
+    const char* Name;
+    int32_t     Width;
+    int32_t     Height;
+};
+
+static const FrameSize StandardSizes[] =
+{
+    { "vga",  640,  480  },
+    { "hd",   1280, 720  },
+    { "fhd",  1920, 1080 },
+    { "uhd",  3840, 2160 }
+};
+
+// Different application settings
+struct
+{
+    vector<FrameSize> Sizes;
+    string            Filter;
+    uint32_t          TimeMs;
+    uint32_t          EncoderThreads;
+    string            JsonFileName;
+    string            CsvFileName;
+}
+Settings;
+
+// Generate synthetic frame - moving gradients with some texture, so compression has some work to do
+static shared_ptr<XImage> MakeSyntheticFrame( int32_t width, int32_t height, XPixelFormat format, uint32_t frameIndex )
+{
+    shared_ptr<XImage> image = XImage::Allocate( width, height, format );
+
+    if ( image )
+    {
+        uint32_t shift = frameIndex * 4;
+
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            uint8_t* row = image->Data( ) + y * image->Stride( );
+
+            for ( int32_t x = 0; x < width; x++ )
+            {
+                uint8_t texture = static_cast<uint8_t>( ( ( x * 7 ) ^ ( y * 13 ) ) & 0x0F );
+                uint8_t r       = static_cast<uint8_t>( ( x + shift ) * 255 / ( width + shift ) ) ^ texture;
+                uint8_t g       = static_cast<uint8_t>( y * 255 / height ) ^ texture;
+                uint8_t b       = static_cast<uint8_t>( ( x + y + shift ) & 0xFF );
+                uint8_t luma    = static_cast<uint8_t>( ( r * 77 + g * 150 + b * 29 ) >> 8 );
+
+                switch ( format )
+                {
+                case XPixelFormat::RGB24:
+                    row[x * 3 + RedIndex]   = r;
+                    row[x * 3 + GreenIndex] = g;
+                    row[x * 3 + BlueIndex]  = b;
+                    break;
+
+                case XPixelFormat::Grayscale8:
+                    row[x] = luma;
+                    break;
+
+                case XPixelFormat::YUYV:
+                    row[x * 2]     = luma;
+                    row[x * 2 + 1] = ( x & 1 ) ? static_cast<uint8_t>( 128 + ( ( r - luma ) >> 1 ) )
+                                               : static_cast<uint8_t>( 128 + ( ( b - luma ) >> 1 ) );
+                    break;
+
+                default:
+                    break;
+                }
+            }
+        }
+    }
+
+    return image;
+}
+
+// Get size of image's data in bytes
+static uint64_t ImageBytes( const shared_ptr<XImage>& image )
+{
+    return XImageDataSize( image->Format( ), image->Height( ), image->Stride( ) );
+}
+
+// Receiver of uplink frames listening on local host - counts complete frames received
+class LocalSink
+{
+private:
+    int                ListenSocket;
+    int                ClientSocket;
+    uint16_t           Port;
+    thread             ReceiveThread;
+    mutex              Sync;
+    condition_variable FrameReceived;
+    uint64_t           FramesReceived;
+
+public:
+    LocalSink( ) : ListenSocket( -1 ), ClientSocket( -1 ), Port( 0 ), ReceiveThread( ), Sync( ), FrameReceived( ), FramesReceived( 0 )
+    {
+    }
+
+    ~LocalSink( )
+    {
+        if ( ListenSocket != -1 ) shutdown( ListenSocket, SHUT_RDWR );
+        if ( ClientSocket != -1 ) shutdown( ClientSocket, SHUT_RDWR );
+        if ( ReceiveThread.joinable( ) ) ReceiveThread.join( );
+        if ( ListenSocket != -1 ) close( ListenSocket );
+        if ( ClientSocket != -1 ) close( ClientSocket );
+    }
+
+    uint16_t LocalPort( ) const { return Port; }
+
+    // Start listening on a free port of the loopback interface
+    bool Start( )
+    {
+        sockaddr_in address;
+        socklen_t   addressLength = sizeof( address );
+
+        memset( &address, 0, sizeof( address ) );
+        address.sin_family      = AF_INET;
+        address.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+        address.sin_port        = 0;
+
+        ListenSocket = socket( AF_INET, SOCK_STREAM, 0 );
+
+        if ( ( ListenSocket == -1 ) ||
+             ( bind( ListenSocket, reinterpret_cast<sockaddr*>( &address ), sizeof( address ) ) != 0 ) ||
+             ( listen( ListenSocket, 1 ) != 0 ) ||
+             ( getsockname( ListenSocket, reinterpret_cast<sockaddr*>( &address ), &addressLength ) != 0 ) )
+        {
+            return false;
+        }
+
+        Port          = ntohs( address.sin_port );
+        ReceiveThread = thread( ReceiveThreadHandler, this );
+
+        return true;
+    }
+
+    // Wait till total number of received frames reaches the specified value
+    bool WaitForFrames( uint64_t count, uint32_t timeoutMs )
+    {
+        unique_lock<mutex> lock( Sync );
+
+        return FrameReceived.wait_for( lock, milliseconds( timeoutMs ), [this, count]( ) { return FramesReceived >= count; } );
+    }
+
+    uint64_t Received( )
+    {
+        lock_guard<mutex> lock( Sync );
+        return FramesReceived;
+    }
+
+private:
+    static bool ReadAll( int socket, uint8_t* buffer, uint32_t size )
+    {
+        while ( size != 0 )
+        {
+            ssize_t received = recv( socket, buffer, size, 0 );
+
+            if ( received <= 0 )
+            {
+                return false;
+            }
+
+            buffer += received;
+            size   -= static_cast<uint32_t>( received );
+        }
+
+        return true;
+    }
+
+    // Accept a single connection and read version 1 frames from it
+    static void ReceiveThreadHandler( LocalSink* me )
+    {
+        vector<uint8_t> payload;
+        uint8_t         header[40];
+
+        me->ClientSocket = accept( me->ListenSocket, nullptr, nullptr );
+
+        while ( ( me->ClientSocket != -1 ) && ( ReadAll( me->ClientSocket, header, sizeof( header ) ) ) )
+        {
+            uint32_t headerSize  = header[5];
+            uint32_t payloadSize = ( static_cast<uint32_t>( header[8] ) << 24 ) | ( static_cast<uint32_t>( header[9] ) << 16 ) |
+                                   ( static_cast<uint32_t>( header[10] ) << 8 ) | header[11];
+
+            payload.resize( payloadSize + headerSize - sizeof( header ) );
+
+            if ( !ReadAll( me->ClientSocket, payload.data( ), static_cast<uint32_t>( payload.size( ) ) ) )
+            {
+                break;
+            }
+
+            {
+                lock_guard<mutex> lock( me->Sync );
+                me->FramesReceived++;
+            }
+            me->FrameReceived.notify_all( );
+        }
+    }
+};
+
+// YUYV to RGB conversion with all implementations supported by CPU
+static void RunYuyvToRgb( XBenchmark& bench, const FrameSize& size )
+{
+    static const XYuyvToRgbImplementation implementations[] =
+    {
+        XYuyvToRgbImplementation::Scalar, XYuyvToRgbImplementation::SSE2, XYuyvToRgbImplementation::SSSE3,
+        XYuyvToRgbImplementation::AVX2, XYuyvToRgbImplementation::NEON
+    };
+
+    shared_ptr<XImage> yuyv = MakeSyntheticFrame( size.Width, size.Height, XPixelFormat::YUYV, 0 );
+    shared_ptr<XImage> rgb  = XImage::Allocate( size.Width, size.Height, XPixelFormat::RGB24 );
+
+    for ( XYuyvToRgbImplementation implementation : implementations )
+    {
+        if ( XYuyvToRgb::IsSupported( implementation ) )
+        {
+            bench.Run( string( "yuyv2rgb/" ) + XYuyvToRgb::Name( implementation ) + "/" + size.Name, ImageBytes( yuyv ), [&]( )
+            {
+                XYuyvToRgb::Convert( implementation, yuyv->Data( ), yuyv->Stride( ), rgb->Data( ), rgb->Stride( ),
+                                     size.Width, size.Height );
+            } );
+        }
+    }
+}
+
+// JPEG encoding of different pixel formats, single and multi threaded
+static void RunJpegEncoder( XBenchmark& bench, const FrameSize& size )
+{
+    static const XPixelFormat formats[] = { XPixelFormat::RGB24, XPixelFormat::YUYV, XPixelFormat::Grayscale8 };
+    static const char*        names[]   = { "rgb24", "yuyv", "gray8" };
+
+    uint32_t        bufferSize = size.Width * size.Height * 3;
+    vector<uint8_t> buffer( bufferSize );
+
+    for ( size_t i = 0; i < sizeof( formats ) / sizeof( formats[0] ); i++ )
+    {
+        shared_ptr<const XImage> image = MakeSyntheticFrame( size.Width, size.Height, formats[i], 0 );
+        vector<uint32_t>         threadCounts( 1, 1 );
+
+        if ( Settings.EncoderThreads > 1 )
+        {
+            threadCounts.push_back( Settings.EncoderThreads );
+        }
+
+        for ( uint32_t threads : threadCounts )
+        {
+            XJpegEncoder encoder( 85, true );
+            string       name = string( "jpeg/encode/" ) + names[i];
+
+            if ( threads > 1 )
+            {
+                name += "-t" + to_string( threads );
+            }
+
+            encoder.SetThreadCount( threads );
+
+            bench.Run( name + "/" + size.Name, XImageDataSize( image->Format( ), image->Height( ), image->Stride( ) ), [&]( )
+            {
+                uint8_t* data     = buffer.data( );
+                uint32_t dataSize = bufferSize;
+
+                encoder.EncodeToMemory( image, &data, &dataSize );
+
+                // buffer is big enough for any sane JPEG, but just in case
+                if ( data != buffer.data( ) )
+                {
+                    free( data );
+                }
+            } );
+        }
+    }
+}
+
+// Copying images - the way image is copied when it is kept by a consumer
+static void RunImageCopy( XBenchmark& bench, const FrameSize& size )
+{
+    shared_ptr<XImage> source = MakeSyntheticFrame( size.Width, size.Height, XPixelFormat::RGB24, 0 );
+    shared_ptr<XImage> target;
+
+    source->CopyDataOrClone( target );
+
+    bench.Run( string( "image/copy/rgb24/" ) + size.Name, ImageBytes( source ), [&]( )
+    {
+        source->CopyDataOrClone( target );
+    } );
+}
+
+// Parsing of camera configuration requests
+static void RunJsonParser( XBenchmark& bench )
+{
+    const string json = "{\"brightness\":\"50\",\"contrast\":\"32\",\"saturation\":\"64\",\"hue\":\"0\","
+                        "\"sharpness\":\"24\",\"gain\":\"0\",\"blc\":\"1\",\"redBalance\":\"1000\","
+                        "\"blueBalance\":\"1000\",\"awb\":\"true\",\"hflip\":\"false\",\"vflip\":\"false\"}";
+    map<string, string> values;
+
+    bench.Run( "json/parse/config", json.size( ), [&]( )
+    {
+        values.clear( );
+        XSimpleJsonParser( json, values );
+    } );
+}
+
+// Web request handler replying with the smallest possible response, so only dispatching is measured
+class ReplyOkHandler : public IWebRequestHandler
+{
+public:
+    ReplyOkHandler( const string& uri, bool canHandleSubContent = false ) :
+        IWebRequestHandler( uri, canHandleSubContent )
+    {
+    }
+
+    void HandleHttpRequest( const IWebRequest&, IWebResponse& response )
+    {
+        response.Printf( "HTTP/1.1 200 OK\r\nContent-Length: 2\r\n\r\nok" );
+    }
+};
+
+// Connect to the specified port of local host with a blocking socket
+static int ConnectLocal( uint16_t port )
+{
+    sockaddr_in address;
+    int         noDelay = 1;
+    int         sock    = socket( AF_INET, SOCK_STREAM, 0 );
+
+    memset( &address, 0, sizeof( address ) );
+    address.sin_family      = AF_INET;
+    address.sin_addr.s_addr = htonl( INADDR_LOOPBACK );
+    address.sin_port        = htons( port );
+
+    if ( ( sock != -1 ) &&
+         ( connect( sock, reinterpret_cast<sockaddr*>( &address ), sizeof( address ) ) != 0 ) )
+    {
+        close( sock );
+        sock = -1;
+    }
+
+    if ( sock != -1 )
+    {
+        setsockopt( sock, IPPROTO_TCP, TCP_NODELAY, &noDelay, sizeof( noDelay ) );
+    }
+
+    return sock;
+}
+
+// Requests to web server with the set of handlers the camera applications have. Every operation
+// sends a request over a kept alive connection and waits for the reply, so ops/s is requests per second.
+static void RunWebDispatch( XBenchmark& bench )
+{
+    static const char* handlerUris[] =
+    {
+        "/", "/index.html", "/styles.css", "/cam2web.png", "/cam2web_white.png", "/camera.js",
+        "/cameraproperties.html", "/cameraproperties.js", "/jquery.js", "/jquery.mobile.js",
+        "/version", "/camera/config", "/camera/properties", "/camera/info", "/camera/jpeg",
+        "/camera/mjpeg", "/camera/ws", "/camera/streams"
+    };
+    static const char* requestUris[] = { "/camera/properties", "/static/js/app.js" };
+    static const char* names[]       = { "web/dispatch/exact", "web/dispatch/prefix" };
+
+    XWebServer server( "", 0 );
+    uint16_t   port = 0;
+
+    for ( const char* uri : handlerUris )
+    {
+        server.AddHandler( make_shared<ReplyOkHandler>( uri ) );
+    }
+    server.AddHandler( make_shared<ReplyOkHandler>( "/static", true ) );
+
+    // find a free port
+    for ( uint16_t tryPort = 18000; ( tryPort < 18100 ) && ( port == 0 ); tryPort++ )
+    {
+        if ( server.SetPort( tryPort ).Start( ) )
+        {
+            port = tryPort;
+        }
+    }
+
+    for ( size_t i = 0; i < sizeof( requestUris ) / sizeof( requestUris[0] ); i++ )
+    {
+        if ( !bench.IsSelected( names[i] ) )
+        {
+            continue;
+        }
+
+        int sock = ( port != 0 ) ? ConnectLocal( port ) : -1;
+
+        if ( sock == -1 )
+        {
+            fprintf( stderr, "%s - failed preparing \n", names[i] );
+            continue;
+        }
+
+        // a request as browsers send it
+        string request = string( "GET " ) + requestUris[i] + " HTTP/1.1\r\n"
+                         "Host: 127.0.0.1\r\n"
+                         "User-Agent: Mozilla/5.0 (X11; Linux x86_64; rv:109.0) Gecko/20100101 Firefox/115.0\r\n"
+                         "Accept: */*\r\n"
+                         "Accept-Language: en-US,en;q=0.5\r\n"
+                         "Accept-Encoding: gzip, deflate, br\r\n"
+                         "Connection: keep-alive\r\n"
+                         "\r\n";
+        char   reply[256];
+
+        bench.RunTimed( names[i], request.size( ), [&]( ) -> int64_t
+        {
+            steady_clock::time_point start    = steady_clock::now( );
+            size_t                   received = 0;
+
+            if ( send( sock, request.data( ), request.size( ), 0 ) != static_cast<ssize_t>( request.size( ) ) )
+            {
+                return -1;
+            }
+
+            // read till the body of the short reply is received
+            while ( ( received < 4 ) || ( memcmp( reply + received - 4, "\r\nok", 4 ) != 0 ) )
+            {
+                ssize_t ret = recv( sock, reply + received, sizeof( reply ) - received, 0 );
+
+                if ( ret <= 0 )
+                {
+                    return -1;
+                }
+                received += ret;
+            }
+
+            return duration_cast<nanoseconds>( steady_clock::now( ) - start ).count( );
+        } );
+
+        close( sock );
+    }
+
+    server.Stop( );
+}
+
+// Full path of a frame - from video source listener, through encoding, to a receiver on local host.
+// Every operation waits till the frame is received completely, so time per operation is latency.
+static void RunPipeline( XBenchmark& bench, const FrameSize& size )
+{
+    static const XPixelFormat formats[] = { XPixelFormat::RGB24, XPixelFormat::YUYV, XPixelFormat::JPEG };
+    static const char*        names[]   = { "rgb24", "yuyv", "jpeg" };
+
+    for ( size_t i = 0; i < sizeof( formats ) / sizeof( formats[0] ); i++ )
+    {
+        string name = string( "pipeline/" ) + names[i] + "-to-uplink/" + size.Name;
+
+        if ( !bench.IsSelected( name ) )
+        {
+            continue;
+        }
+
+        vector<shared_ptr<const XImage>> frames;
+        LocalSink                        sink;
+
+        // few different frames, so encoder does not see the same one all the time
+        for ( uint32_t f = 0; f < 4; f++ )
+        {
+            shared_ptr<XImage> frame;
+
+            if ( formats[i] == XPixelFormat::JPEG )
+            {
+                shared_ptr<XImage> rgb = MakeSyntheticFrame( size.Width, size.Height, XPixelFormat::RGB24, f );
+                vector<uint8_t>    buffer( size.Width * size.Height * 3 );
+                uint8_t*           data     = buffer.data( );
+                uint32_t           dataSize = static_cast<uint32_t>( buffer.size( ) );
+                XJpegEncoder       encoder( 85, true );
+
+                if ( encoder.EncodeToMemory( rgb, &data, &dataSize ) == XError::Success )
+                {
+                    frame = XImage::Allocate( dataSize, 1, XPixelFormat::JPEG );
+                    memcpy( frame->Data( ), data, dataSize );
+                }
+                if ( data != buffer.data( ) )
+                {
+                    free( data );
+                }
+            }
+            else
+            {
+                frame = MakeSyntheticFrame( size.Width, size.Height, formats[i], f );
+            }
+
+            if ( frame )
+            {
+                frames.push_back( frame );
+            }
+        }
+
+        if ( ( frames.empty( ) ) || ( !sink.Start( ) ) )
+        {
+            fprintf( stderr, "%s - failed preparing \n", name.c_str( ) );
+            continue;
+        }
+
+        XVideoSourceToWeb         video2web;
+        shared_ptr<XUplinkSender> uplink = make_shared<XUplinkSender>( "127.0.0.1", sink.LocalPort( ) );
+        IVideoSourceListener*     listener = video2web.VideoSourceListener( );
+        uint32_t                  counter  = 0;
+
+        uplink->SetName( "benchmark" );
+        uplink->Start( );
+        video2web.SetJpegThreadCount( Settings.EncoderThreads );
+        video2web.AddUplink( uplink );
+
+        bench.RunTimed( name, ImageBytes( const_pointer_cast<XImage>( frames[0] ) ), [&]( ) -> int64_t
+        {
+            uint64_t                 expected = sink.Received( ) + 1;
+            steady_clock::time_point start    = steady_clock::now( );
+
+            listener->OnNewImage( frames[counter++ % frames.size( )] );
+
+            if ( !sink.WaitForFrames( expected, 5000 ) )
+            {
+                return -1;
+            }
+
+            return duration_cast<nanoseconds>( steady_clock::now( ) - start ).count( );
+        } );
+
+        video2web.RemoveUplink( uplink );
+        uplink->SignalToStop( );
+        uplink->WaitForStop( );
+    }
+}
+
+// Parse command line and override default settings
+static bool ParseCommandLine( int argc, char* argv[] )
+{
+    bool sizesSpecified = false;
+    int  i;
+
+    Settings.Sizes.assign( StandardSizes, StandardSizes + 3 );
+    Settings.TimeMs         = 1000;
+    Settings.EncoderThreads = thread::hardware_concurrency( );
+
+    for ( i = 1; i < argc; i++ )
+    {
+        char* ptrDelimiter = strchr( argv[i], ':' );
+
+        if ( ( ptrDelimiter == nullptr ) || ( argv[i][0] != '-' ) )
+        {
+            break;
+        }
+
+        string key   = string( argv[i] + 1, ptrDelimiter - argv[i] - 1 );
+        string value = string( ptrDelimiter + 1 );
+
+        if ( ( key.empty( ) ) || ( value.empty( ) ) )
+            break;
+
+        if ( key == "filter" )
+        {
+            Settings.Filter = value;
+        }
+        else if ( key == "sizes" )
+        {
+            size_t start = 0;
+
+            if ( !sizesSpecified )
+            {
+                Settings.Sizes.clear( );
+                sizesSpecified = true;
+            }
+
+            while ( start != string::npos )
+            {
+                size_t end  = value.find( ',', start );
+                string name = value.substr( start, ( end == string::npos ) ? string::npos : end - start );
+                bool   found = false;
+
+                for ( const FrameSize& size : StandardSizes )
+                {
+                    if ( name == size.Name )
+                    {
+                        Settings.Sizes.push_back( size );
+                        found = true;
+                    }
+                }
+
+                if ( !found )
+                    break;
+
+                start = ( end == string::npos ) ? string::npos : end + 1;
+            }
+
+            if ( start != string::npos )
+                break;
+        }
+        else if ( key == "time" )
+        {
+            if ( ( sscanf( value.c_str( ), "%u", &Settings.TimeMs ) != 1 ) || ( Settings.TimeMs == 0 ) )
+                break;
+        }
+        else if ( key == "threads" )
+        {
+            if ( ( sscanf( value.c_str( ), "%u", &Settings.EncoderThreads ) != 1 ) ||
+                 ( Settings.EncoderThreads < 1 ) || ( Settings.EncoderThreads > 16 ) )
+                break;
+        }
+        else if ( key == "json" )
+        {
+            Settings.JsonFileName = value;
+        }
+        else if ( key == "csv" )
+        {
+            Settings.CsvFileName = value;
+        }
+        else
+        {
+            break;
+        }
+    }
+
+    if ( i != argc )
+    {
+        printf( "cam2web benchmarks \n\n" );
+        printf( "Available command line options: \n" );
+        printf( "  -filter:<?>  Run only benchmarks with names containing the value. \n" );
+        printf( "  -sizes:<?>   Comma separated list of frame sizes: vga, hd, fhd, uhd. \n" );
+        printf( "               Default is 'vga,hd,fhd'. \n" );
+        printf( "  -time:<ms>   Time to run every benchmark for. Default is 1000. \n" );
+        printf( "  -threads:<1-16> Number of threads for parallel JPEG encoding. \n" );
+        printf( "               Default is number of CPUs. \n" );
+        printf( "  -json:<?>    Write results as JSON to the file ('-' for standard output). \n" );
+        printf( "  -csv:<?>     Write results as CSV to the file ('-' for standard output). \n" );
+        printf( "\n" );
+
+        return false;
+    }
+
+    return true;
+}
+
+// Write results into the file with the specified name (or standard output)
+static bool WriteResults( const XBenchmark& bench, const string& fileName, bool json )
+{
+    FILE* file = ( fileName == "-" ) ? stdout : fopen( fileName.c_str( ), "w" );
+
+    if ( file == nullptr )
+    {
+        fprintf( stderr, "Failed creating file: %s \n", fileName.c_str( ) );
+        return false;
+    }
+
+    if ( json )
+    {
+        bench.WriteJson( file );
+    }
+    else
+    {
+        bench.WriteCsv( file );
+    }
+
+    if ( file != stdout )
+    {
+        fclose( file );
+    }
+
+    return true;
+}
+
+int main( int argc, char* argv[] )
+{
+    XBenchmark bench;
+    size_t     printed = 0;
+    bool       ok      = true;
+
+    if ( !ParseCommandLine( argc, argv ) )
+    {
+        return -1;
+    }
+
+    bench.SetLimits( Settings.TimeMs, 10, 1000000 );
+    bench.SetFilter( Settings.Filter );
+
+    // table goes to standard error if machine readable results go to standard output
+    FILE* table = ( ( Settings.JsonFileName == "-" ) || ( Settings.CsvFileName == "-" ) ) ? stderr : stdout;
+
+    XBenchmark::PrintHeader( table );
+
+    auto printNew = [&]( )
+    {
+        for ( ; printed < bench.Results( ).size( ); printed++ )
+        {
+            XBenchmark::PrintResult( table, bench.Results( )[printed] );
+        }
+        fflush( table );
+    };
+
+    for ( const FrameSize& size : Settings.Sizes )
+    {
+        RunYuyvToRgb( bench, size );
+        printNew( );
+        RunJpegEncoder( bench, size );
+        printNew( );
+        RunImageCopy( bench, size );
+        printNew( );
+    }
+
+    RunJsonParser( bench );
+    printNew( );
+    RunWebDispatch( bench );
+    printNew( );
+
+    for ( const FrameSize& size : Settings.Sizes )
+    {
+        RunPipeline( bench, size );
+        printNew( );
+    }
+
+    if ( !Settings.JsonFileName.empty( ) )
+    {
+        ok = WriteResults( bench, Settings.JsonFileName, true ) && ok;
+    }
+    if ( !Settings.CsvFileName.empty( ) )
+    {
+        ok = WriteResults( bench, Settings.CsvFileName, false ) && ok;
+    }
+
+    return ( ok ) ? 0 : 1;
+}
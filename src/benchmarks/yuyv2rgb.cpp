@@ -0,0 +1,177 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+#include <vector>
+#include <chrono>
+
+#include "XYuyvToRgb.hpp"
+
+using namespace std;
+using namespace std::chrono;
+
+// Checks all YUYV to RGB implementations supported by the CPU against the scalar one,
+// then measures their speed in mega pixels per second.
+//
+// Usage: yuyv2rgb [width height [iterations]]
+
+static const XYuyvToRgbImplementation Implementations[] =
+{
+    XYuyvToRgbImplementation::Scalar, XYuyvToRgbImplementation::SSE2, XYuyvToRgbImplementation::SSSE3,
+    XYuyvToRgbImplementation::AVX2, XYuyvToRgbImplementation::NEON
+};
+
+// Fill buffer with pseudo random data (same sequence every run)
+static void FillRandom( vector<uint8_t>& buffer, uint32_t seed )
+{
+    for ( size_t i = 0; i < buffer.size( ); i++ )
+    {
+        seed = seed * 1103515245 + 12345;
+        buffer[i] = static_cast<uint8_t>( seed >> 16 );
+    }
+}
+
+// Compare the specified implementation with the scalar one for the given image size. Output
+// buffers have guard bytes after every row, which must stay untouched.
+static bool CheckImplementation( XYuyvToRgbImplementation implementation, int32_t width, int32_t height )
+{
+    const uint8_t guard      = 0xA5;
+    int32_t       yuyvStride = width * 2 + 6;
+    int32_t       rgbStride  = width * 3 + 7;
+    vector<uint8_t> yuyv( yuyvStride * height );
+    vector<uint8_t> expected( rgbStride * height, guard );
+    vector<uint8_t> actual( rgbStride * height, guard );
+
+    FillRandom( yuyv, static_cast<uint32_t>( width * 31 + height ) );
+
+    // make sure extreme values are covered (saturation)
+    if ( width >= 4 )
+    {
+        const uint8_t extremes[] = { 255, 0, 255, 255, 0, 255, 0, 0 };
+
+        memcpy( yuyv.data( ), extremes, sizeof( extremes ) );
+    }
+
+    XYuyvToRgb::Convert( XYuyvToRgbImplementation::Scalar, yuyv.data( ), yuyvStride, expected.data( ), rgbStride, width, height );
+    XYuyvToRgb::Convert( implementation, yuyv.data( ), yuyvStride, actual.data( ), rgbStride, width, height );
+
+    if ( memcmp( expected.data( ), actual.data( ), expected.size( ) ) != 0 )
+    {
+        for ( size_t i = 0; i < expected.size( ); i++ )
+        {
+            if ( expected[i] != actual[i] )
+            {
+                printf( "%s: mismatch for %dx%d image at row %d, byte %d: %u instead of %u \n",
+                        XYuyvToRgb::Name( implementation ), width, height,
+                        static_cast<int>( i / rgbStride ), static_cast<int>( i % rgbStride ),
+                        actual[i], expected[i] );
+                break;
+            }
+        }
+
+        return false;
+    }
+
+    return true;
+}
+
+// Measure speed of the specified implementation, mega pixels per second
+static double MeasureImplementation( XYuyvToRgbImplementation implementation, int32_t width, int32_t height, uint32_t iterations )
+{
+    vector<uint8_t> yuyv( width * 2 * height );
+    vector<uint8_t> rgb( width * 3 * height );
+
+    FillRandom( yuyv, 1 );
+
+    // warm up caches
+    XYuyvToRgb::Convert( implementation, yuyv.data( ), width * 2, rgb.data( ), width * 3, width, height );
+
+    steady_clock::time_point start = steady_clock::now( );
+
+    for ( uint32_t i = 0; i < iterations; i++ )
+    {
+        XYuyvToRgb::Convert( implementation, yuyv.data( ), width * 2, rgb.data( ), width * 3, width, height );
+    }
+
+    double seconds = duration_cast<duration<double>>( steady_clock::now( ) - start ).count( );
+
+    return ( static_cast<double>( width ) * height * iterations ) / seconds / 1000000.0;
+}
+
+int main( int argc, char* argv[] )
+{
+    int32_t  width      = 1280;
+    int32_t  height     = 720;
+    uint32_t iterations = 200;
+    bool     allGood    = true;
+
+    if ( argc >= 3 )
+    {
+        width  = atoi( argv[1] ) & ~1;
+        height = atoi( argv[2] );
+    }
+    if ( argc >= 4 )
+    {
+        iterations = static_cast<uint32_t>( atoi( argv[3] ) );
+    }
+
+    if ( ( width <= 0 ) || ( height <= 0 ) || ( iterations == 0 ) )
+    {
+        printf( "Usage: yuyv2rgb [width height [iterations]] \n" );
+        return 1;
+    }
+
+    printf( "Best implementation: %s \n\n", XYuyvToRgb::Name( XYuyvToRgb::Best( ) ) );
+
+    // check correctness for all widths up to a few vector sizes, so all tails are covered
+    for ( XYuyvToRgbImplementation implementation : Implementations )
+    {
+        if ( ( implementation != XYuyvToRgbImplementation::Scalar ) && ( XYuyvToRgb::IsSupported( implementation ) ) )
+        {
+            bool good = true;
+
+            for ( int32_t w = 2; ( w <= 130 ) && ( good ); w += 2 )
+            {
+                good = CheckImplementation( implementation, w, 3 );
+            }
+
+            good = good && CheckImplementation( implementation, width, height );
+
+            printf( "%-8s %s \n", XYuyvToRgb::Name( implementation ), ( good ) ? "matches scalar" : "FAILED" );
+            allGood = allGood && good;
+        }
+    }
+
+    printf( "\n%dx%d, %u iterations \n", width, height, iterations );
+
+    for ( XYuyvToRgbImplementation implementation : Implementations )
+    {
+        if ( XYuyvToRgb::IsSupported( implementation ) )
+        {
+            printf( "%-8s %8.1f MP/s \n", XYuyvToRgb::Name( implementation ),
+                    MeasureImplementation( implementation, width, height, iterations ) );
+        }
+    }
+
+    return ( allGood ) ? 0 : 2;
+}
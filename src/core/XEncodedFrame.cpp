@@ -0,0 +1,70 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <new>
+#include <chrono>
+
+#include "XEncodedFrame.hpp"
+
+using namespace std;
+using namespace std::chrono;
+
+// Create encoded frame
+XEncodedFrame::XEncodedFrame( const shared_ptr<const XImage>& buffer, uint32_t size, uint64_t sequence, uint64_t timestamp,
+                              int32_t width, int32_t height, uint64_t sourceSequence, const XFrameCheckpoints& checkpoints ) :
+    mBuffer( buffer ), mSize( size ), mSequence( sequence ), mTimestamp( timestamp ), mWidth( width ), mHeight( height ),
+    mSourceSequence( sourceSequence ), mCheckpoints( checkpoints )
+{
+}
+
+XEncodedFrame::~XEncodedFrame( )
+{
+}
+
+// Create encoded frame keeping reference to the buffer holding its data
+shared_ptr<const XEncodedFrame> XEncodedFrame::Create( const shared_ptr<const XImage>& buffer, uint32_t size,
+                                                       uint64_t sequence, uint64_t timestamp, int32_t width, int32_t height,
+                                                       uint64_t sourceSequence, const XFrameCheckpoints& checkpoints )
+{
+    shared_ptr<const XEncodedFrame> frame;
+
+    if ( ( buffer ) && ( buffer->Data( ) != nullptr ) )
+    {
+        frame = shared_ptr<const XEncodedFrame>( new (nothrow) XEncodedFrame( buffer, size, sequence, timestamp, width, height,
+                                                                                 sourceSequence, checkpoints ) );
+    }
+
+    return frame;
+}
+
+// Time passed since capture of the frame till now
+uint64_t XEncodedFrame::Age( ) const
+{
+    uint64_t now = Now( );
+
+    // system clock may be stepped back, which must not look like a huge delay
+    return ( now > mTimestamp ) ? now - mTimestamp : 0;
+}
+
+// Current time as used for frame timestamps
+uint64_t XEncodedFrame::Now( )
+{
+    return static_cast<uint64_t>( duration_cast<microseconds>( system_clock::now( ).time_since_epoch( ) ).count( ) );
+}
@@ -0,0 +1,91 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef XENCODED_FRAME_HPP
+#define XENCODED_FRAME_HPP
+
+#include <stdint.h>
+#include <memory>
+
+#include "XInterfaces.hpp"
+#include "XImage.hpp"
+
+// Times a frame passed stages of processing on its way to consumers - microseconds since epoch (0 if unknown).
+// Capture time is the frame's timestamp.
+struct XFrameCheckpoints
+{
+    uint64_t Received;      // image was provided by video source
+    uint64_t Encoded;       // image was encoded and the frame published to consumers
+
+    XFrameCheckpoints( ) : Received( 0 ), Encoded( 0 ) { }
+};
+
+// Class encapsulating an encoded (JPEG) video frame. Once created, the frame is never
+// modified, so it can be shared between any number of consumers/threads.
+class XEncodedFrame : private Uncopyable
+{
+private:
+    XEncodedFrame( const std::shared_ptr<const XImage>& buffer, uint32_t size, uint64_t sequence, uint64_t timestamp,
+                   int32_t width, int32_t height, uint64_t sourceSequence, const XFrameCheckpoints& checkpoints );
+
+public:
+    ~XEncodedFrame( );
+
+    // Create encoded frame keeping reference to the buffer (JPEG image) holding its data,
+    // which is released together with the frame
+    static std::shared_ptr<const XEncodedFrame> Create( const std::shared_ptr<const XImage>& buffer, uint32_t size,
+                                                        uint64_t sequence, uint64_t timestamp,
+                                                        int32_t width = 0, int32_t height = 0, uint64_t sourceSequence = 0,
+                                                        const XFrameCheckpoints& checkpoints = XFrameCheckpoints( ) );
+
+    // Encoded data of the frame and its size
+    const uint8_t* Data( ) const { return mBuffer->Data( ); }
+    uint32_t Size( )       const { return mSize; }
+
+    // Sequence number of the frame, which increases with every new frame
+    uint64_t Sequence( )   const { return mSequence; }
+    // Capture time of the frame - microseconds since epoch
+    uint64_t Timestamp( )  const { return mTimestamp; }
+    // Sequence number of the image given by video source (0 if unknown) - gaps tell about frames lost before encoding
+    uint64_t SourceSequence( ) const { return mSourceSequence; }
+    // Times the frame passed stages of processing
+    const XFrameCheckpoints& Checkpoints( ) const { return mCheckpoints; }
+
+    // Time passed since capture of the frame till now - microseconds
+    uint64_t Age( ) const;
+    // Current time as used for frame timestamps - microseconds since epoch
+    static uint64_t Now( );
+
+    // Size of the encoded image (0 if unknown)
+    int32_t Width( )       const { return mWidth; }
+    int32_t Height( )      const { return mHeight; }
+
+private:
+    std::shared_ptr<const XImage> mBuffer;
+    uint32_t mSize;
+    uint64_t mSequence;
+    uint64_t mTimestamp;
+    int32_t  mWidth;
+    int32_t  mHeight;
+    uint64_t mSourceSequence;
+    XFrameCheckpoints mCheckpoints;
+};
+
+#endif // XENCODED_FRAME_HPP
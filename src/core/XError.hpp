@@ -42,7 +42,8 @@ public:
         ReadOnlyProperty,           // Specified property is read only
         UnsupportedPixelFormat,     // Pixel format (of an image) is not supported
         ImageParametersMismatch,    // Parameters of images (width/height/format) don't match
-        FailedImageEncoding         // Failed image encoding
+        FailedImageEncoding,        // Failed image encoding
+        FailedImageDecoding         // Failed image decoding (or image data is corrupted)
     };
 
 public:
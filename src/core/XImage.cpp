@@ -25,15 +25,40 @@
 
 using namespace std;
 
-// Returns number of bits required for pixel in certain format
+// Returns number of bits required for pixel in certain format (in luma plane for planar formats)
 uint32_t XImageBitsPerPixel( XPixelFormat format )
 {
-    static int sizes[]     = { 0, 8, 24, 32, 8 };
+    static int sizes[]     = { 0, 8, 24, 32, 8, 16, 8, 8 };
     int        formatIndex = static_cast<int>( format );
 
     return ( formatIndex >= ( sizeof( sizes ) / sizeof( sizes[0] ) ) ) ? 0 : sizes[formatIndex];
 }
 
+// Returns number of planes in certain format
+uint32_t XImagePlaneCount( XPixelFormat format )
+{
+    return ( ( format == XPixelFormat::YUV422P ) || ( format == XPixelFormat::YUV420P ) ) ? 3 : 1;
+}
+
+// Returns height of chroma planes for planar formats
+static int32_t XImageChromaHeight( XPixelFormat format, int32_t height )
+{
+    return ( format == XPixelFormat::YUV420P ) ? ( height + 1 ) / 2 : height;
+}
+
+// Returns number of bytes required for image data in certain format (stride of the first plane is given)
+uint32_t XImageDataSize( XPixelFormat format, int32_t height, int32_t stride )
+{
+    uint32_t size = static_cast<uint32_t>( height ) * stride;
+
+    if ( XImagePlaneCount( format ) == 3 )
+    {
+        size += 2 * static_cast<uint32_t>( XImageChromaHeight( format, height ) ) * ( stride / 2 );
+    }
+
+    return size;
+}
+
 // Returns number of bytes per stride when number of bits per line is known (stride is always 32 bit aligned)
 static uint32_t XImageBytesPerStride( uint32_t bitsPerLine )
 {
@@ -47,8 +72,10 @@ static uint32_t XImageBytesPerLine( uint32_t bitsPerLine )
 }
 
 // Create empty image
-XImage::XImage( uint8_t* data, int32_t width, int32_t height, int32_t stride, XPixelFormat format, bool ownMemory ) :
-    mData( data ), mWidth( width ), mHeight( height ), mStride( stride ), mFormat( format ), mOwnMemory( ownMemory )
+XImage::XImage( uint8_t* data, int32_t width, int32_t height, int32_t stride, XPixelFormat format, bool ownMemory,
+                const function<void( )>& release ) :
+    mData( data ), mWidth( width ), mHeight( height ), mStride( stride ), mFormat( format ), mOwnMemory( ownMemory ),
+    mTimestamp( 0 ), mSequence( 0 ), mRelease( release )
 {
 }
 
@@ -59,22 +86,28 @@ XImage::~XImage( )
     {
         free( mData );
     }
+
+    if ( mRelease )
+    {
+        mRelease( );
+    }
 }
 
 // Allocate image of the specified size and format
 shared_ptr<XImage> XImage::Allocate( int32_t width, int32_t height, XPixelFormat format, bool zeroInitialize )
 {
     int32_t  stride = (int32_t) XImageBytesPerStride( width * XImageBitsPerPixel( format ) );
+    uint32_t size   = XImageDataSize( format, height, stride );
     XImage*  image  = nullptr;
     uint8_t* data   = nullptr;
 
     if ( zeroInitialize )
     {
-        data = (uint8_t*) calloc( 1, height * stride );
+        data = (uint8_t*) calloc( 1, size );
     }
     else
     {
-        data = (uint8_t*) malloc( height * stride );
+        data = (uint8_t*) malloc( size );
     }
 
     if ( data != nullptr )
@@ -91,6 +124,43 @@ shared_ptr<XImage> XImage::Create( uint8_t* data, int32_t width, int32_t height,
     return shared_ptr<XImage>( new (nothrow) XImage( data, width, height, stride, format, false ) );
 }
 
+// Create image by wrapping memory buffer leased from its owner
+shared_ptr<XImage> XImage::Lease( uint8_t* data, int32_t width, int32_t height, int32_t stride, XPixelFormat format,
+                                  const function<void( )>& release )
+{
+    return shared_ptr<XImage>( new (nothrow) XImage( data, width, height, stride, format, false, release ) );
+}
+
+// Get pointer to the specified plane of the image
+uint8_t* XImage::PlaneData( uint32_t plane ) const
+{
+    uint8_t* data = nullptr;
+
+    if ( plane < XImagePlaneCount( mFormat ) )
+    {
+        data = mData;
+
+        if ( plane != 0 )
+        {
+            data += mHeight * mStride + ( plane - 1 ) * XImageChromaHeight( mFormat, mHeight ) * ( mStride / 2 );
+        }
+    }
+
+    return data;
+}
+
+// Get stride of the specified plane
+int32_t XImage::PlaneStride( uint32_t plane ) const
+{
+    return ( plane == 0 ) ? mStride : ( ( plane < XImagePlaneCount( mFormat ) ) ? mStride / 2 : 0 );
+}
+
+// Get height of the specified plane
+int32_t XImage::PlaneHeight( uint32_t plane ) const
+{
+    return ( plane == 0 ) ? mHeight : ( ( plane < XImagePlaneCount( mFormat ) ) ? XImageChromaHeight( mFormat, mHeight ) : 0 );
+}
+
 // Clone image - make a deep copy of it
 shared_ptr<XImage> XImage::Clone( ) const
 {
@@ -134,17 +204,32 @@ XError XImage::CopyData( const shared_ptr<XImage>& copyTo ) const
     }
     else
     {
-        uint32_t lineSize  = XImageBytesPerLine( mWidth * XImageBitsPerPixel( mFormat ) );
-        uint8_t* srcPtr    = mData;
-        uint8_t* dstPtr    = copyTo->mData;
-        int32_t  dstStride = copyTo->mStride;
+        uint32_t lineSize = XImageBytesPerLine( mWidth * XImageBitsPerPixel( mFormat ) );
 
-        for ( int y = 0; y < mHeight; y++ )
+        for ( uint32_t plane = 0; plane < XImagePlaneCount( mFormat ); plane++ )
         {
-            memcpy( dstPtr, srcPtr, lineSize );
-            srcPtr += mStride;
-            dstPtr += dstStride;
+            uint8_t* srcPtr    = PlaneData( plane );
+            uint8_t* dstPtr    = copyTo->PlaneData( plane );
+            int32_t  srcStride = PlaneStride( plane );
+            int32_t  dstStride = copyTo->PlaneStride( plane );
+            int32_t  height    = PlaneHeight( plane );
+
+            // chroma planes have half of the width
+            if ( plane == 1 )
+            {
+                lineSize = ( mWidth + 1 ) / 2;
+            }
+
+            for ( int y = 0; y < height; y++ )
+            {
+                memcpy( dstPtr, srcPtr, lineSize );
+                srcPtr += srcStride;
+                dstPtr += dstStride;
+            }
         }
+
+        copyTo->mTimestamp = mTimestamp;
+        copyTo->mSequence  = mSequence;
     }
 
     return ret;
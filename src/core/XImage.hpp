@@ -22,6 +22,7 @@
 #define XIMAGE_HPP
 
 #include <memory>
+#include <functional>
 
 #include "XInterfaces.hpp"
 #include "XError.hpp"
@@ -34,6 +35,13 @@ enum class XPixelFormat
     RGBA32,
 
     JPEG,
+
+    // YUV formats. YUYV is packed 4:2:2 - Y0 U Y1 V for every pair of pixels. Planar formats keep
+    // Y plane followed by U (Cb) and V (Cr) planes, which have half of luma plane's width and stride;
+    // for 4:2:0 chroma planes have half of its height as well.
+    YUYV,
+    YUV422P,
+    YUV420P
     // Enough for this project
 };
 
@@ -44,11 +52,19 @@ enum
     BlueIndex  = 2
 };
 
+// Returns number of bits required for pixel in certain format (in luma plane for planar formats)
+uint32_t XImageBitsPerPixel( XPixelFormat format );
+// Returns number of planes in certain format
+uint32_t XImagePlaneCount( XPixelFormat format );
+// Returns number of bytes required for image data in certain format (stride of the first plane is given)
+uint32_t XImageDataSize( XPixelFormat format, int32_t height, int32_t stride );
+
 // Class encapsulating image data
 class XImage : private Uncopyable
 {
 private:
-    XImage( uint8_t* data, int32_t width, int32_t height, int32_t stride, XPixelFormat format, bool ownMemory );
+    XImage( uint8_t* data, int32_t width, int32_t height, int32_t stride, XPixelFormat format, bool ownMemory,
+            const std::function<void( )>& release = nullptr );
 
 public:
     ~XImage( );
@@ -57,6 +73,11 @@ public:
     static std::shared_ptr<XImage> Allocate( int32_t width, int32_t height, XPixelFormat format, bool zeroInitialize = false );
     // Create image by wrapping existing memory buffer
     static std::shared_ptr<XImage> Create( uint8_t* data, int32_t width, int32_t height, int32_t stride, XPixelFormat format );
+    // Create image by wrapping memory buffer, which is leased from its owner - the specified function is
+    // called to hand it back once the image is destroyed. Owner does not modify leased memory, so such
+    // images can be kept by consumers instead of copying them. Nothing is released if creation fails.
+    static std::shared_ptr<XImage> Lease( uint8_t* data, int32_t width, int32_t height, int32_t stride, XPixelFormat format,
+                                          const std::function<void( )>& release );
 
     // Clone image - make a deep copy of it
     std::shared_ptr<XImage> Clone( ) const;
@@ -73,6 +94,21 @@ public:
     // Raw data of the image
     uint8_t* Data( )       const { return mData;   }
 
+    // Planes of the image - planar formats have 3 of them (Y, U, V), others have just one
+    uint8_t* PlaneData( uint32_t plane ) const;
+    int32_t  PlaneStride( uint32_t plane ) const;
+    int32_t  PlaneHeight( uint32_t plane ) const;
+
+    // Check if image's memory is leased, so the image can be kept instead of copied
+    bool IsLeased( )       const { return static_cast<bool>( mRelease ); }
+
+    // Capture time of the image - microseconds since epoch (0 if unknown)
+    uint64_t Timestamp( )  const { return mTimestamp; }
+    void SetTimestamp( uint64_t timestamp ) { mTimestamp = timestamp; }
+    // Sequence number given to the image by video source (like frame counter of camera's driver, 0 if unknown)
+    uint64_t Sequence( )   const { return mSequence; }
+    void SetSequence( uint64_t sequence ) { mSequence = sequence; }
+
 private:
     uint8_t*     mData;
     int32_t      mWidth;
@@ -80,6 +116,9 @@ private:
     int32_t      mStride;
     XPixelFormat mFormat;
     bool         mOwnMemory;
+    uint64_t     mTimestamp;
+    uint64_t     mSequence;
+    std::function<void( )> mRelease;
 };
 
 #endif // XIMAGE_HPP
@@ -0,0 +1,256 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <stdlib.h>
+#include <map>
+#include <vector>
+#include <mutex>
+#include <atomic>
+
+#include "XImagePool.hpp"
+
+using namespace std;
+
+namespace Private
+{
+    #define MIN_CLASS_SIZE (4096)
+
+    // Private details of the implementation
+    class XImagePoolData
+    {
+    private:
+        mutable mutex                   Sync;
+        map<uint32_t, vector<uint8_t*>> FreeLists;
+        uint32_t                        MaxFreePerClass;
+
+    public:
+        atomic<uint64_t>                Hits;
+        atomic<uint64_t>                Misses;
+        uint32_t                        FreeBuffers;
+        uint64_t                        FreeBytes;
+
+    public:
+        XImagePoolData( uint32_t maxFreePerClass ) :
+            Sync( ), FreeLists( ), MaxFreePerClass( maxFreePerClass ),
+            Hits( 0 ), Misses( 0 ), FreeBuffers( 0 ), FreeBytes( 0 )
+        {
+        }
+
+        ~XImagePoolData( )
+        {
+            Clear( );
+        }
+
+        static uint32_t SizeClass( uint32_t size );
+
+        uint8_t* Get( uint32_t classSize );
+        void Put( uint8_t* buffer, uint32_t classSize );
+        void Clear( );
+        uint32_t FreeBuffersCount( ) const;
+        uint64_t FreeBytesCount( ) const;
+    };
+}
+
+XImagePool::XImagePool( uint32_t maxFreeBuffersPerClass ) :
+    mData( make_shared<Private::XImagePoolData>( maxFreeBuffersPerClass ) )
+{
+}
+
+XImagePool::~XImagePool( )
+{
+}
+
+// Get image of the specified size and format
+shared_ptr<XImage> XImagePool::Acquire( int32_t width, int32_t height, XPixelFormat format )
+{
+    shared_ptr<XImage> image;
+    uint32_t           bitsPerPixel = XImageBitsPerPixel( format );
+
+    if ( ( width > 0 ) && ( height > 0 ) && ( bitsPerPixel != 0 ) &&
+         ( ( format != XPixelFormat::JPEG ) || ( height == 1 ) ) )
+    {
+        // stride is always 32 bit aligned, same as for XImage::Allocate()
+        int32_t  stride    = static_cast<int32_t>( ( ( width * bitsPerPixel + 31 ) & ~31 ) >> 3 );
+        uint32_t classSize = Private::XImagePoolData::SizeClass( XImageDataSize( format, height, stride ) );
+        uint8_t* buffer    = mData->Get( classSize );
+
+        if ( buffer != nullptr )
+        {
+            // JPEG buffers can use everything up to the class size
+            if ( format == XPixelFormat::JPEG )
+            {
+                stride = static_cast<int32_t>( classSize );
+            }
+
+            weak_ptr<Private::XImagePoolData> pool = mData;
+
+            // buffer goes back to the pool when image is released, or freed if the pool is gone
+            image = XImage::Lease( buffer, width, height, stride, format, [pool, buffer, classSize]( )
+            {
+                shared_ptr<Private::XImagePoolData> poolData = pool.lock( );
+
+                if ( poolData )
+                {
+                    poolData->Put( buffer, classSize );
+                }
+                else
+                {
+                    free( buffer );
+                }
+            } );
+
+            if ( !image )
+            {
+                mData->Put( buffer, classSize );
+            }
+        }
+    }
+
+    return image;
+}
+
+// Release all free buffers kept by the pool
+void XImagePool::Clear( )
+{
+    mData->Clear( );
+}
+
+// Number of requests served with a recycled buffer
+uint64_t XImagePool::Hits( ) const
+{
+    return mData->Hits;
+}
+
+// Number of requests which required allocating new buffer
+uint64_t XImagePool::Misses( ) const
+{
+    return mData->Misses;
+}
+
+// Number of free buffers kept in the pool and their total size
+uint32_t XImagePool::FreeBuffers( ) const
+{
+    return mData->FreeBuffersCount( );
+}
+uint64_t XImagePool::FreeBytes( ) const
+{
+    return mData->FreeBytesCount( );
+}
+
+namespace Private
+{
+
+// Round buffer size up to the closest size class - classes are quarter of power of two apart
+uint32_t XImagePoolData::SizeClass( uint32_t size )
+{
+    uint32_t topBit = 31;
+    uint32_t step;
+
+    if ( size <= MIN_CLASS_SIZE )
+    {
+        return MIN_CLASS_SIZE;
+    }
+
+    while ( ( size & ( 1u << topBit ) ) == 0 )
+    {
+        topBit--;
+    }
+
+    step = 1u << ( topBit - 2 );
+
+    return ( size + step - 1 ) & ~( step - 1 );
+}
+
+// Get buffer of the specified class - recycled one if available
+uint8_t* XImagePoolData::Get( uint32_t classSize )
+{
+    {
+        lock_guard<mutex> lock( Sync );
+        map<uint32_t, vector<uint8_t*>>::iterator itClass = FreeLists.find( classSize );
+
+        if ( ( itClass != FreeLists.end( ) ) && ( !itClass->second.empty( ) ) )
+        {
+            uint8_t* buffer = itClass->second.back( );
+
+            itClass->second.pop_back( );
+            FreeBuffers--;
+            FreeBytes -= classSize;
+            Hits++;
+
+            return buffer;
+        }
+    }
+
+    Misses++;
+
+    return static_cast<uint8_t*>( malloc( classSize ) );
+}
+
+// Put buffer back into the pool or free it if there are enough buffers of its class already
+void XImagePoolData::Put( uint8_t* buffer, uint32_t classSize )
+{
+    {
+        lock_guard<mutex> lock( Sync );
+        vector<uint8_t*>& freeList = FreeLists[classSize];
+
+        if ( freeList.size( ) < MaxFreePerClass )
+        {
+            freeList.push_back( buffer );
+            FreeBuffers++;
+            FreeBytes += classSize;
+
+            return;
+        }
+    }
+
+    free( buffer );
+}
+
+// Release all free buffers
+void XImagePoolData::Clear( )
+{
+    lock_guard<mutex> lock( Sync );
+
+    for ( auto& freeList : FreeLists )
+    {
+        for ( uint8_t* buffer : freeList.second )
+        {
+            free( buffer );
+        }
+    }
+
+    FreeLists.clear( );
+    FreeBuffers = 0;
+    FreeBytes   = 0;
+}
+
+// Get number of free buffers and their size
+uint32_t XImagePoolData::FreeBuffersCount( ) const
+{
+    lock_guard<mutex> lock( Sync );
+    return FreeBuffers;
+}
+uint64_t XImagePoolData::FreeBytesCount( ) const
+{
+    lock_guard<mutex> lock( Sync );
+    return FreeBytes;
+}
+
+} // namespace Private
@@ -0,0 +1,64 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef XIMAGE_POOL_HPP
+#define XIMAGE_POOL_HPP
+
+#include <stdint.h>
+#include <memory>
+
+#include "XInterfaces.hpp"
+#include "XImage.hpp"
+
+namespace Private
+{
+    class XImagePoolData;
+}
+
+// Pool of recyclable image buffers. Buffers are grouped by size classes, which are a quarter
+// of power of two apart - this gives up to 25% of headroom, so images of slightly varying
+// size (like JPEGs) reuse same buffers. A buffer returns to the pool when the last reference
+// to its image is released (even if the pool itself is already destroyed by that time).
+class XImagePool : private Uncopyable
+{
+public:
+    XImagePool( uint32_t maxFreeBuffersPerClass = 8 );
+    ~XImagePool( );
+
+    // Get image of the specified size and format. For JPEG format, width is the number of bytes
+    // needed and height must be 1; stride of the provided image is the real size of the buffer.
+    std::shared_ptr<XImage> Acquire( int32_t width, int32_t height, XPixelFormat format );
+
+    // Release all free buffers kept by the pool
+    void Clear( );
+
+    // Number of requests served with a recycled buffer
+    uint64_t Hits( ) const;
+    // Number of requests which required allocating new buffer
+    uint64_t Misses( ) const;
+    // Number of free buffers kept in the pool and their total size
+    uint32_t FreeBuffers( ) const;
+    uint64_t FreeBytes( ) const;
+
+private:
+    std::shared_ptr<Private::XImagePoolData> mData;
+};
+
+#endif // XIMAGE_POOL_HPP
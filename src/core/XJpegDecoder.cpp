@@ -0,0 +1,157 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#include "XJpegDecoder.hpp"
+
+#include <stdio.h>
+#include <jpeglib.h>
+
+using namespace std;
+
+namespace Private
+{
+    class JpegDecoderException : public exception
+    {
+    public:
+        virtual const char* what( ) const throw( )
+        {
+            return "JPEG decoding failure";
+        }
+    };
+
+    static void decoder_error_exit( j_common_ptr /* cinfo */ )
+    {
+        throw JpegDecoderException( );
+    }
+
+    static void decoder_output_message( j_common_ptr /* cinfo */ )
+    {
+        // do nothing - kill the message
+    }
+
+    class XJpegDecoderData
+    {
+    public:
+        struct jpeg_decompress_struct cinfo;
+        struct jpeg_error_mgr         jerr;
+
+    public:
+        XJpegDecoderData( )
+        {
+            // allocate and initialize JPEG decompression object
+            cinfo.err           = jpeg_std_error( &jerr );
+            jerr.error_exit     = decoder_error_exit;
+            jerr.output_message = decoder_output_message;
+
+            jpeg_create_decompress( &cinfo );
+        }
+
+        ~XJpegDecoderData( )
+        {
+            jpeg_destroy_decompress( &cinfo );
+        }
+
+        XError Decode( const uint8_t* jpegData, uint32_t jpegSize, uint32_t scaleDown, shared_ptr<XImage>& image );
+    };
+}
+
+XJpegDecoder::XJpegDecoder( ) :
+    mData( new Private::XJpegDecoderData( ) )
+{
+}
+
+XJpegDecoder::~XJpegDecoder( )
+{
+    delete mData;
+}
+
+// Decompress the specified JPEG image
+XError XJpegDecoder::DecodeToImage( const uint8_t* jpegData, uint32_t jpegSize, uint32_t scaleDown, shared_ptr<XImage>& image )
+{
+    if ( jpegData == nullptr )
+    {
+        return XError::NullPointer;
+    }
+    if ( ( scaleDown != 1 ) && ( scaleDown != 2 ) && ( scaleDown != 4 ) && ( scaleDown != 8 ) )
+    {
+        return XError::ConfigurationNotSupported;
+    }
+
+    return mData->Decode( jpegData, jpegSize, scaleDown, image );
+}
+
+namespace Private
+{
+
+XError XJpegDecoderData::Decode( const uint8_t* jpegData, uint32_t jpegSize, uint32_t scaleDown, shared_ptr<XImage>& image )
+{
+    XError ret = XError::Success;
+
+    try
+    {
+        XPixelFormat format;
+
+        jpeg_mem_src( &cinfo, const_cast<uint8_t*>( jpegData ), jpegSize );
+        jpeg_read_header( &cinfo, TRUE );
+
+        format = ( cinfo.num_components == 1 ) ? XPixelFormat::Grayscale8 : XPixelFormat::RGB24;
+
+        cinfo.out_color_space     = ( format == XPixelFormat::Grayscale8 ) ? JCS_GRAYSCALE : JCS_RGB;
+        cinfo.scale_num           = 1;
+        cinfo.scale_denom         = scaleDown;
+        cinfo.dct_method          = JDCT_IFAST;
+        cinfo.do_fancy_upsampling = FALSE;
+
+        jpeg_start_decompress( &cinfo );
+
+        if ( ( !image ) || ( image->Format( ) != format ) ||
+             ( image->Width( ) != static_cast<int32_t>( cinfo.output_width ) ) ||
+             ( image->Height( ) != static_cast<int32_t>( cinfo.output_height ) ) )
+        {
+            image = XImage::Allocate( cinfo.output_width, cinfo.output_height, format );
+        }
+
+        if ( !image )
+        {
+            jpeg_abort_decompress( &cinfo );
+            ret = XError::OutOfMemory;
+        }
+        else
+        {
+            while ( cinfo.output_scanline < cinfo.output_height )
+            {
+                JSAMPROW row = image->Data( ) + cinfo.output_scanline * image->Stride( );
+
+                jpeg_read_scanlines( &cinfo, &row, 1 );
+            }
+
+            jpeg_finish_decompress( &cinfo );
+        }
+    }
+    catch ( const JpegDecoderException& )
+    {
+        jpeg_abort_decompress( &cinfo );
+        ret = XError::FailedImageDecoding;
+    }
+
+    return ret;
+}
+
+} // namespace Private
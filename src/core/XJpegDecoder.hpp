@@ -0,0 +1,56 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef XJPEG_DECODER_HPP
+#define XJPEG_DECODER_HPP
+
+#include <stdint.h>
+#include <memory>
+
+#include "XInterfaces.hpp"
+#include "XImage.hpp"
+#include "XError.hpp"
+
+namespace Private
+{
+    class XJpegDecoderData;
+}
+
+class XJpegDecoder : private Uncopyable
+{
+public:
+    XJpegDecoder( );
+    ~XJpegDecoder( );
+
+    /* Decompress the specified JPEG image
+
+       Scale down factor must be 1, 2, 4 or 8. Scaling is done by libjpeg while decoding
+       (reduced size inverse DCT), so scaled down images are much cheaper to get than full ones.
+
+       Color images are decoded as RGB24 and grayscale as Grayscale8. The provided image is
+       reused if its size and format match the decoded image, or re-allocated otherwise.
+    */
+    XError DecodeToImage( const uint8_t* jpegData, uint32_t jpegSize, uint32_t scaleDown, std::shared_ptr<XImage>& image );
+
+private:
+    Private::XJpegDecoderData* mData;
+};
+
+#endif // XJPEG_DECODER_HPP
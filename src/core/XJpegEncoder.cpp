@@ -21,12 +21,24 @@
 #include "XJpegEncoder.hpp"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 #include <jpeglib.h>
 
 using namespace std;
 
 namespace Private
 {
+    #define MAX_THREAD_COUNT        (16)
+    // minimum height of a strip in MCU rows, so tiny strips don't waste more time than they save
+    #define MIN_STRIP_MCU_ROWS      (4)
+    // restart interval is a 16 bit value
+    #define MAX_RESTART_INTERVAL    (65535)
+
     class JpegException : public exception
     {
     public:
@@ -46,24 +58,17 @@ namespace Private
         // do nothing - kill the message
     }
 
-    class XJpegEncoderData
+    // Wrapper of libjpeg compressor, which encodes an image or a strip of its rows
+    class XJpegCompressor
     {
-    public:
-        uint16_t                    Quality;
-        bool                        FasterCompression;
     private:
         struct jpeg_compress_struct cinfo;
         struct jpeg_error_mgr       jerr;
+        std::vector<uint8_t>        RawBuffer;
 
     public:
-        XJpegEncoderData( uint16_t quality, bool fasterCompression) :
-            Quality( quality ), FasterCompression( fasterCompression  )
+        XJpegCompressor( )
         {
-            if ( Quality > 100 )
-            {
-                Quality = 100;
-            }
-
             // allocate and initialize JPEG compression object
             cinfo.err           = jpeg_std_error( &jerr );
             jerr.error_exit     = my_error_exit;
@@ -72,11 +77,94 @@ namespace Private
             jpeg_create_compress( &cinfo );
         }
 
-        ~XJpegEncoderData( )
+        ~XJpegCompressor( )
         {
             jpeg_destroy_compress( &cinfo );
         }
 
+        XError Compress( const XImage* image, int32_t firstRow, int32_t rowCount, uint16_t quality, bool fasterCompression,
+                         uint32_t restartInterval, uint8_t** buffer, unsigned long* bufferSize );
+
+        static bool IsSupportedFormat( XPixelFormat format );
+        static void GetMcuSize( XPixelFormat format, int32_t* mcuWidth, int32_t* mcuHeight );
+
+    private:
+        void WriteRawData( const XImage* image, int32_t firstRow, int32_t rowCount );
+        static bool IsYuvFormat( XPixelFormat format );
+    };
+
+    // Encoded strip of an image
+    struct XJpegStrip
+    {
+        uint8_t*      Buffer;
+        unsigned long Capacity;
+        unsigned long Size;
+        XError        Error;
+
+        XJpegStrip( ) : Buffer( nullptr ), Capacity( 0 ), Size( 0 ), Error( XError::Success ) { }
+    };
+
+    // Pool of threads, which compress horizontal strips of an image in parallel. Strips are aligned
+    // to MCU rows and every strip is a restart interval of the final image, so strips' entropy coded
+    // data are joined with restart markers in between.
+    class XJpegStripEncoder
+    {
+    private:
+        mutex                   Sync;
+        condition_variable      JobAvailable;
+        condition_variable      JobCompleted;
+        vector<thread>          Threads;
+        vector<XJpegCompressor*> Compressors;
+        bool                    NeedToStop;
+        uint64_t                JobCounter;
+
+        // current job
+        const XImage*           Image;
+        uint16_t                Quality;
+        bool                    FasterCompression;
+        uint32_t                RestartInterval;
+        int32_t                 StripHeight;
+        uint32_t                StripCount;
+        uint32_t                NextStrip;
+        uint32_t                StripsDone;
+        vector<XJpegStrip>      Strips;
+
+    public:
+        XJpegStripEncoder( uint32_t threadCount );
+        ~XJpegStripEncoder( );
+
+        uint32_t ThreadCount( ) const { return static_cast<uint32_t>( Threads.size( ) ) + 1; }
+
+        XError Encode( XJpegCompressor* compressor, const XImage* image, uint16_t quality, bool fasterCompression,
+                       uint8_t** buffer, uint32_t* bufferSize );
+
+    private:
+        static void WorkerThread( XJpegStripEncoder* me, uint32_t index );
+        void EncodeStrips( unique_lock<mutex>& lock, XJpegCompressor* compressor );
+        XError JoinStrips( int32_t height, uint8_t** buffer, uint32_t* bufferSize );
+    };
+
+    class XJpegEncoderData
+    {
+    public:
+        uint16_t                    Quality;
+        bool                        FasterCompression;
+        uint32_t                    ThreadCount;
+    private:
+        XJpegCompressor             Compressor;
+        unique_ptr<XJpegStripEncoder> StripEncoder;
+
+    public:
+        XJpegEncoderData( uint16_t quality, bool fasterCompression) :
+            Quality( quality ), FasterCompression( fasterCompression  ), ThreadCount( 1 ),
+            Compressor( ), StripEncoder( )
+        {
+            if ( Quality > 100 )
+            {
+                Quality = 100;
+            }
+        }
+
         XError EncodeToMemory( const shared_ptr<const XImage>& image, uint8_t** buffer, uint32_t* bufferSize );
     };
 }
@@ -114,82 +202,664 @@ void XJpegEncoder::SetFasterCompression( bool faster )
     mData->FasterCompression = faster;
 }
 
+// Set/get number of threads used to compress an image
+uint32_t XJpegEncoder::ThreadCount( ) const
+{
+    return mData->ThreadCount;
+}
+void XJpegEncoder::SetThreadCount( uint32_t threadCount )
+{
+    mData->ThreadCount = threadCount;
+    if ( mData->ThreadCount > MAX_THREAD_COUNT ) mData->ThreadCount = MAX_THREAD_COUNT;
+    if ( mData->ThreadCount < 1 ) mData->ThreadCount = 1;
+}
+
 // Compress the specified image into provided buffer
 XError XJpegEncoder::EncodeToMemory( const shared_ptr<const XImage>& image, uint8_t** buffer, uint32_t* bufferSize )
 {
     return mData->EncodeToMemory( image, buffer, bufferSize );
 }
 
+// Get size of the JPEG image by parsing its SOF marker
+XError XJpegEncoder::GetImageSize( const uint8_t* jpegData, uint32_t jpegSize, int32_t* width, int32_t* height )
+{
+    XError   ret = XError::FailedImageDecoding;
+    uint32_t pos = 2;
+
+    if ( ( jpegData == nullptr ) || ( width == nullptr ) || ( height == nullptr ) )
+    {
+        return XError::NullPointer;
+    }
+
+    if ( ( jpegSize < 4 ) || ( jpegData[0] != 0xFF ) || ( jpegData[1] != 0xD8 ) )
+    {
+        return ret;
+    }
+
+    // walk through markers till SOFn is found; each segment is 0xFF, marker, 2 bytes length
+    while ( pos + 4 <= jpegSize )
+    {
+        uint8_t  marker;
+        uint32_t segmentLength;
+
+        if ( jpegData[pos] != 0xFF )
+        {
+            break;
+        }
+
+        marker = jpegData[pos + 1];
+
+        // fill bytes
+        if ( marker == 0xFF )
+        {
+            pos++;
+            continue;
+        }
+        // markers without payload
+        if ( ( marker == 0x01 ) || ( ( marker >= 0xD0 ) && ( marker <= 0xD7 ) ) )
+        {
+            pos += 2;
+            continue;
+        }
+        // start of scan or end of image - too late for frame header
+        if ( ( marker == 0xDA ) || ( marker == 0xD9 ) )
+        {
+            break;
+        }
+
+        segmentLength = ( static_cast<uint32_t>( jpegData[pos + 2] ) << 8 ) | jpegData[pos + 3];
+
+        // SOF0-SOF15, excluding DHT (C4), JPG (C8) and DAC (CC)
+        if ( ( marker >= 0xC0 ) && ( marker <= 0xCF ) && ( marker != 0xC4 ) && ( marker != 0xC8 ) && ( marker != 0xCC ) )
+        {
+            if ( ( segmentLength >= 7 ) && ( pos + 9 <= jpegSize ) )
+            {
+                *height = ( static_cast<int32_t>( jpegData[pos + 5] ) << 8 ) | jpegData[pos + 6];
+                *width  = ( static_cast<int32_t>( jpegData[pos + 7] ) << 8 ) | jpegData[pos + 8];
+                ret     = XError::Success;
+            }
+            break;
+        }
+
+        pos += 2 + segmentLength;
+    }
+
+    return ret;
+}
+
+
 namespace Private
 {
 
 XError XJpegEncoderData::EncodeToMemory( const shared_ptr<const XImage>& image, uint8_t** buffer, uint32_t* bufferSize )
 {
-    JSAMPROW    row_pointer[1];
-    XError      ret = XError::Success;
+    XError ret = XError::Success;
 
     if ( ( !image ) || ( image->Data( ) == nullptr ) || ( buffer == nullptr ) || ( *buffer == nullptr ) || ( bufferSize == nullptr ) )
     {
         ret = XError::NullPointer;
     }
-    else if ( ( image->Format( ) != XPixelFormat::RGB24 ) && ( image->Format( ) != XPixelFormat::Grayscale8 ) )
+    else if ( !XJpegCompressor::IsSupportedFormat( image->Format( ) ) )
     {
         ret = XError::UnsupportedPixelFormat;
     }
+    else if ( ThreadCount > 1 )
+    {
+        // thread pool is re-created only when thread count changes
+        if ( ( !StripEncoder ) || ( StripEncoder->ThreadCount( ) != ThreadCount ) )
+        {
+            StripEncoder.reset( );
+            StripEncoder.reset( new XJpegStripEncoder( ThreadCount ) );
+        }
+
+        ret = StripEncoder->Encode( &Compressor, image.get( ), Quality, FasterCompression, buffer, bufferSize );
+    }
     else
     {
-        try
+        unsigned long mem_buffer_size = *bufferSize;
+
+        StripEncoder.reset( );
+
+        ret = Compressor.Compress( image.get( ), 0, image->Height( ), Quality, FasterCompression, 0, buffer, &mem_buffer_size );
+
+        if ( ret == XError::Success )
         {
-            // 1 - specify data destination
-            unsigned long mem_buffer_size = *bufferSize;
-            jpeg_mem_dest( &cinfo, buffer, &mem_buffer_size );
+            *bufferSize = (uint32_t) mem_buffer_size;
+        }
+    }
+
+    return ret;
+}
+
+// Check if the pixel format can be compressed
+bool XJpegCompressor::IsSupportedFormat( XPixelFormat format )
+{
+    return ( ( format == XPixelFormat::RGB24 ) || ( format == XPixelFormat::Grayscale8 ) || ( IsYuvFormat( format ) ) );
+}
 
-            // 2 - set parameters for compression
-            cinfo.image_width  = image->Width( );
-            cinfo.image_height = image->Height( );
+// Check if the pixel format is one of YUV formats, which are compressed as raw data
+bool XJpegCompressor::IsYuvFormat( XPixelFormat format )
+{
+    return ( ( format == XPixelFormat::YUYV ) || ( format == XPixelFormat::YUV422P ) || ( format == XPixelFormat::YUV420P ) );
+}
 
-            if ( image->Format( ) == XPixelFormat::RGB24 )
+// Get size of MCU (minimum coded unit) used to compress images of the specified format
+void XJpegCompressor::GetMcuSize( XPixelFormat format, int32_t* mcuWidth, int32_t* mcuHeight )
+{
+    // grayscale has no subsampling, 4:2:2 is subsampled horizontally only, all others are 4:2:0
+    *mcuWidth  = ( format == XPixelFormat::Grayscale8 ) ? DCTSIZE : DCTSIZE * 2;
+    *mcuHeight = ( ( format == XPixelFormat::Grayscale8 ) || ( format == XPixelFormat::YUV422P ) ) ? DCTSIZE : DCTSIZE * 2;
+}
+
+// Compress the specified rows of an image (all rows are compressed if first row is 0 and row count is image height)
+XError XJpegCompressor::Compress( const XImage* image, int32_t firstRow, int32_t rowCount, uint16_t quality, bool fasterCompression,
+                                  uint32_t restartInterval, uint8_t** buffer, unsigned long* bufferSize )
+{
+    JSAMPROW    row_pointer[1];
+    XError      ret = XError::Success;
+
+    try
+    {
+        // 1 - specify data destination
+        jpeg_mem_dest( &cinfo, buffer, bufferSize );
+
+        // 2 - set parameters for compression
+        cinfo.image_width  = image->Width( );
+        cinfo.image_height = rowCount;
+
+        if ( image->Format( ) == XPixelFormat::RGB24 )
+        {
+            cinfo.input_components = 3;
+            cinfo.in_color_space   = JCS_RGB;
+        }
+        else if ( image->Format( ) == XPixelFormat::Grayscale8 )
+        {
+            cinfo.input_components = 1;
+            cinfo.in_color_space   = JCS_GRAYSCALE;
+        }
+        else
+        {
+            // YUV images are given to compressor as they are, without color conversion
+            cinfo.input_components = 3;
+            cinfo.in_color_space   = JCS_YCbCr;
+        }
+
+        // set default compression parameters
+        jpeg_set_defaults( &cinfo );
+        // set quality
+        jpeg_set_quality( &cinfo, (int) quality, TRUE /* limit to baseline-JPEG values */ );
+
+        // use faster, but less accurate compressions
+        cinfo.dct_method = ( fasterCompression ) ? JDCT_FASTEST : JDCT_DEFAULT;
+
+        // number of MCUs between restart markers (0 - none)
+        cinfo.restart_interval = restartInterval;
+
+        if ( IsYuvFormat( image->Format( ) ) )
+        {
+            // provide already downsampled data - luma is 2x1 (4:2:2) or 2x2 (4:2:0) of chroma;
+            // YUYV is compressed as 4:2:0, same as RGB images get compressed by default
+            cinfo.raw_data_in = TRUE;
+        #if JPEG_LIB_VERSION >= 70
+            cinfo.do_fancy_downsampling = FALSE;
+        #endif
+
+            cinfo.comp_info[0].h_samp_factor = 2;
+            cinfo.comp_info[0].v_samp_factor = ( image->Format( ) == XPixelFormat::YUV422P ) ? 1 : 2;
+            cinfo.comp_info[1].h_samp_factor = cinfo.comp_info[1].v_samp_factor = 1;
+            cinfo.comp_info[2].h_samp_factor = cinfo.comp_info[2].v_samp_factor = 1;
+        }
+
+        // 3 - start compressor
+        jpeg_start_compress( &cinfo, TRUE );
+
+        // 4 - do compression
+        if ( cinfo.raw_data_in )
+        {
+            WriteRawData( image, firstRow, rowCount );
+        }
+        else
+        {
+            while ( cinfo.next_scanline < cinfo.image_height )
             {
-                cinfo.input_components = 3;
-                cinfo.in_color_space   = JCS_RGB;
+                row_pointer[0] = image->Data( ) + image->Stride( ) * ( firstRow + cinfo.next_scanline );
+
+                jpeg_write_scanlines( &cinfo, row_pointer, 1 );
             }
-            else
+        }
+
+        // 5 - finish compression
+        jpeg_finish_compress( &cinfo );
+    }
+    catch ( const JpegException& )
+    {
+        // get compressor ready for the next image
+        jpeg_abort_compress( &cinfo );
+        ret = XError::FailedImageEncoding;
+    }
+
+    return ret;
+}
+
+// Feed YUV image to compressor, one row of MCUs at a time
+void XJpegCompressor::WriteRawData( const XImage* image, int32_t firstRow, int32_t rowCount )
+{
+    /*
+        Compressor reads component rows rounded up to a multiple of DCT block size (8), so rows
+        are either used directly from the image, when its stride allows that, or copied into
+        temporary buffer with the edge pixel replicated. Packed YUYV rows are always split into
+        temporary planar rows, averaging chroma of every two rows. Rows below the last one to
+        compress repeat it.
+    */
+
+    const bool yuyv         = ( image->Format( ) == XPixelFormat::YUYV );
+    const int  width        = image->Width( );
+    const int  lastRow      = firstRow + rowCount - 1;
+    const int  chromaWidth  = ( width + 1 ) / 2;
+    const int  lumaRows     = DCTSIZE * cinfo.max_v_samp_factor;
+    const int  chromaRows   = DCTSIZE;
+    const int  lumaLength   = ( width + DCTSIZE * 2 - 1 ) & ~( DCTSIZE * 2 - 1 );
+    const int  chromaLength = lumaLength / 2;
+    const bool lumaCopy     = ( ( yuyv ) || ( image->Stride( ) < lumaLength ) );
+    const bool chromaCopy   = ( ( yuyv ) || ( image->PlaneStride( 1 ) < chromaLength ) );
+
+    JSAMPROW   yRows[DCTSIZE * 2];
+    JSAMPROW   uRows[DCTSIZE];
+    JSAMPROW   vRows[DCTSIZE];
+    JSAMPARRAY planes[3] = { yRows, uRows, vRows };
+
+    RawBuffer.resize( lumaRows * lumaLength + chromaRows * chromaLength * 2 );
+
+    for ( int i = 0; i < lumaRows; i++ )
+    {
+        yRows[i] = RawBuffer.data( ) + i * lumaLength;
+    }
+    for ( int i = 0; i < chromaRows; i++ )
+    {
+        uRows[i] = RawBuffer.data( ) + lumaRows * lumaLength + i * chromaLength;
+        vRows[i] = uRows[i] + chromaRows * chromaLength;
+    }
+
+    while ( cinfo.next_scanline < cinfo.image_height )
+    {
+        int mcuRow = firstRow + static_cast<int>( cinfo.next_scanline );
+
+        if ( yuyv )
+        {
+            // every chroma row is made of two YUYV rows
+            for ( int i = 0; i < chromaRows; i++ )
             {
-                cinfo.input_components = 1;
-                cinfo.in_color_space   = JCS_GRAYSCALE;
+                int            row0 = ( mcuRow + i * 2 <= lastRow ) ? mcuRow + i * 2 : lastRow;
+                int            row1 = ( row0 + 1 <= lastRow ) ? row0 + 1 : lastRow;
+                const uint8_t* src0 = image->Data( ) + row0 * image->Stride( );
+                const uint8_t* src1 = image->Data( ) + row1 * image->Stride( );
+                uint8_t*       y0   = yRows[i * 2];
+                uint8_t*       y1   = yRows[i * 2 + 1];
+                uint8_t*       u    = uRows[i];
+                uint8_t*       v    = vRows[i];
+
+                for ( int x = 0; x < chromaWidth; x++, src0 += 4, src1 += 4 )
+                {
+                    y0[x * 2]     = src0[0];
+                    y0[x * 2 + 1] = src0[2];
+                    y1[x * 2]     = src1[0];
+                    y1[x * 2 + 1] = src1[2];
+                    u[x]          = static_cast<uint8_t>( ( src0[1] + src1[1] + 1 ) >> 1 );
+                    v[x]          = static_cast<uint8_t>( ( src0[3] + src1[3] + 1 ) >> 1 );
+                }
+
+                memset( y0 + chromaWidth * 2, y0[chromaWidth * 2 - 1], lumaLength - chromaWidth * 2 );
+                memset( y1 + chromaWidth * 2, y1[chromaWidth * 2 - 1], lumaLength - chromaWidth * 2 );
+                memset( u + chromaWidth, u[chromaWidth - 1], chromaLength - chromaWidth );
+                memset( v + chromaWidth, v[chromaWidth - 1], chromaLength - chromaWidth );
             }
+        }
+        else
+        {
+            int chromaRow     = mcuRow / cinfo.max_v_samp_factor;
+            int lastChromaRow = lastRow / cinfo.max_v_samp_factor;
 
-            // set default compression parameters
-            jpeg_set_defaults( &cinfo );
-            // set quality
-            jpeg_set_quality( &cinfo, (int) Quality, TRUE /* limit to baseline-JPEG values */ );
+            for ( int i = 0; i < lumaRows; i++ )
+            {
+                int      row = ( mcuRow + i <= lastRow ) ? mcuRow + i : lastRow;
+                uint8_t* src = image->PlaneData( 0 ) + row * image->PlaneStride( 0 );
+
+                if ( !lumaCopy )
+                {
+                    yRows[i] = src;
+                }
+                else
+                {
+                    memcpy( yRows[i], src, width );
+                    memset( yRows[i] + width, src[width - 1], lumaLength - width );
+                }
+            }
 
-            // use faster, but less accurate compressions
-            cinfo.dct_method = ( FasterCompression ) ? JDCT_FASTEST : JDCT_DEFAULT;
+            for ( int plane = 1; plane <= 2; plane++ )
+            {
+                JSAMPROW* rows = planes[plane];
+
+                for ( int i = 0; i < chromaRows; i++ )
+                {
+                    int      row = ( chromaRow + i <= lastChromaRow ) ? chromaRow + i : lastChromaRow;
+                    uint8_t* src = image->PlaneData( plane ) + row * image->PlaneStride( plane );
+
+                    if ( !chromaCopy )
+                    {
+                        rows[i] = src;
+                    }
+                    else
+                    {
+                        memcpy( rows[i], src, chromaWidth );
+                        memset( rows[i] + chromaWidth, src[chromaWidth - 1], chromaLength - chromaWidth );
+                    }
+                }
+            }
+        }
 
-            // 3 - start compressor
-            jpeg_start_compress( &cinfo, TRUE );
+        jpeg_write_raw_data( &cinfo, planes, lumaRows );
+    }
+}
 
-            // 4 - do compression
-            while ( cinfo.next_scanline < cinfo.image_height )
+// Find frame header (SOF) and the beginning of entropy coded data (right after SOS header) in JPEG image
+// produced by the compressor; the image must end with EOI marker
+static bool FindJpegScanData( const uint8_t* jpegData, uint32_t jpegSize, uint32_t* sofOffset, uint32_t* scanOffset )
+{
+    uint32_t pos      = 2;
+    bool     sofFound = false;
+
+    if ( ( jpegSize < 4 ) || ( jpegData[jpegSize - 2] != 0xFF ) || ( jpegData[jpegSize - 1] != 0xD9 ) )
+    {
+        return false;
+    }
+
+    while ( pos + 4 <= jpegSize )
+    {
+        uint8_t  marker;
+        uint32_t segmentLength;
+
+        if ( jpegData[pos] != 0xFF )
+        {
+            break;
+        }
+
+        marker = jpegData[pos + 1];
+
+        // fill bytes
+        if ( marker == 0xFF )
+        {
+            pos++;
+            continue;
+        }
+
+        segmentLength = ( static_cast<uint32_t>( jpegData[pos + 2] ) << 8 ) | jpegData[pos + 3];
+
+        if ( ( marker == 0xC0 ) || ( marker == 0xC1 ) )
+        {
+            *sofOffset = pos;
+            sofFound   = true;
+        }
+        else if ( marker == 0xDA )
+        {
+            *scanOffset = pos + 2 + segmentLength;
+            return ( ( sofFound ) && ( *scanOffset <= jpegSize - 2 ) );
+        }
+
+        pos += 2 + segmentLength;
+    }
+
+    return false;
+}
+
+XJpegStripEncoder::XJpegStripEncoder( uint32_t threadCount ) :
+    Sync( ), JobAvailable( ), JobCompleted( ), Threads( ), Compressors( ), NeedToStop( false ), JobCounter( 0 ),
+    Image( nullptr ), Quality( 0 ), FasterCompression( false ), RestartInterval( 0 ),
+    StripHeight( 0 ), StripCount( 0 ), NextStrip( 0 ), StripsDone( 0 ), Strips( )
+{
+    // calling thread does its share of work as well, so one thread less is needed
+    for ( uint32_t i = 1; i < threadCount; i++ )
+    {
+        Compressors.push_back( new XJpegCompressor( ) );
+    }
+    for ( uint32_t i = 1; i < threadCount; i++ )
+    {
+        Threads.push_back( thread( WorkerThread, this, i - 1 ) );
+    }
+}
+
+XJpegStripEncoder::~XJpegStripEncoder( )
+{
+    {
+        lock_guard<mutex> lock( Sync );
+        NeedToStop = true;
+    }
+
+    JobAvailable.notify_all( );
+
+    for ( thread& worker : Threads )
+    {
+        worker.join( );
+    }
+
+    for ( XJpegCompressor* compressor : Compressors )
+    {
+        delete compressor;
+    }
+
+    for ( XJpegStrip& strip : Strips )
+    {
+        free( strip.Buffer );
+    }
+}
+
+// Compress image in strips and join them into the provided buffer (re-allocated if too small)
+XError XJpegStripEncoder::Encode( XJpegCompressor* compressor, const XImage* image, uint16_t quality, bool fasterCompression,
+                                  uint8_t** buffer, uint32_t* bufferSize )
+{
+    XError   ret = XError::Success;
+    int32_t  mcuWidth, mcuHeight;
+    uint32_t mcusPerRow, mcuRows, stripMcuRows;
+
+    XJpegCompressor::GetMcuSize( image->Format( ), &mcuWidth, &mcuHeight );
+
+    mcusPerRow   = ( image->Width( )  + mcuWidth  - 1 ) / mcuWidth;
+    mcuRows      = ( image->Height( ) + mcuHeight - 1 ) / mcuHeight;
+    stripMcuRows = ( mcuRows + ThreadCount( ) - 1 ) / ThreadCount( );
+
+    if ( stripMcuRows < MIN_STRIP_MCU_ROWS )
+    {
+        stripMcuRows = MIN_STRIP_MCU_ROWS;
+    }
+    // strip is a restart interval, so its number of MCUs must fit into 16 bits
+    if ( stripMcuRows * mcusPerRow > MAX_RESTART_INTERVAL )
+    {
+        stripMcuRows = MAX_RESTART_INTERVAL / mcusPerRow;
+    }
+
+    if ( ( stripMcuRows == 0 ) || ( stripMcuRows >= mcuRows ) )
+    {
+        // image is too small to split (or too wide) - compress it as a whole
+        unsigned long mem_buffer_size = *bufferSize;
+
+        ret = compressor->Compress( image, 0, image->Height( ), quality, fasterCompression, 0, buffer, &mem_buffer_size );
+
+        if ( ret == XError::Success )
+        {
+            *bufferSize = (uint32_t) mem_buffer_size;
+        }
+    }
+    else
+    {
+        {
+            unique_lock<mutex> lock( Sync );
+
+            Image             = image;
+            Quality           = quality;
+            FasterCompression = fasterCompression;
+            RestartInterval   = stripMcuRows * mcusPerRow;
+            StripHeight       = static_cast<int32_t>( stripMcuRows ) * mcuHeight;
+            StripCount        = ( mcuRows + stripMcuRows - 1 ) / stripMcuRows;
+            NextStrip         = 0;
+            StripsDone        = 0;
+
+            if ( Strips.size( ) < StripCount )
             {
-                row_pointer[0] = image->Data( ) + image->Stride( ) * cinfo.next_scanline;
+                Strips.resize( StripCount );
+            }
 
-                jpeg_write_scanlines( &cinfo, row_pointer, 1 );
+            JobCounter++;
+            JobAvailable.notify_all( );
+
+            // do our part of the job and wait for the rest
+            EncodeStrips( lock, compressor );
+
+            while ( StripsDone != StripCount )
+            {
+                JobCompleted.wait( lock );
             }
 
-            // 5 - finish compression
-            jpeg_finish_compress( &cinfo );
+            Image = nullptr;
+        }
 
-            *bufferSize = (uint32_t) mem_buffer_size;
+        for ( uint32_t i = 0; ( i < StripCount ) && ( ret == XError::Success ); i++ )
+        {
+            ret = Strips[i].Error;
         }
-        catch ( const JpegException& )
+
+        if ( ret == XError::Success )
         {
-            ret = XError::FailedImageEncoding;
+            ret = JoinStrips( image->Height( ), buffer, bufferSize );
         }
     }
 
     return ret;
 }
 
+// Wait for strips to compress and do them till told to stop
+void XJpegStripEncoder::WorkerThread( XJpegStripEncoder* me, uint32_t index )
+{
+    unique_lock<mutex> lock( me->Sync );
+    uint64_t           lastJob = me->JobCounter;
+
+    while ( true )
+    {
+        while ( ( !me->NeedToStop ) && ( me->JobCounter == lastJob ) )
+        {
+            me->JobAvailable.wait( lock );
+        }
+
+        if ( me->NeedToStop )
+        {
+            break;
+        }
+
+        lastJob = me->JobCounter;
+        me->EncodeStrips( lock, me->Compressors[index] );
+    }
+}
+
+// Take strips of the current job one by one and compress them (lock is held only while picking a strip)
+void XJpegStripEncoder::EncodeStrips( unique_lock<mutex>& lock, XJpegCompressor* compressor )
+{
+    while ( NextStrip < StripCount )
+    {
+        uint32_t      stripIndex = NextStrip++;
+        XJpegStrip&   strip      = Strips[stripIndex];
+        int32_t       firstRow   = static_cast<int32_t>( stripIndex ) * StripHeight;
+        int32_t       rowCount   = ( firstRow + StripHeight <= Image->Height( ) ) ? StripHeight : Image->Height( ) - firstRow;
+        uint8_t*      buffer     = strip.Buffer;
+        unsigned long size       = strip.Capacity;
+
+        lock.unlock( );
+
+        strip.Error = compressor->Compress( Image, firstRow, rowCount, Quality, FasterCompression, RestartInterval, &buffer, &size );
+
+        // compressor allocates new buffer if there is none yet or it is too small
+        if ( buffer != strip.Buffer )
+        {
+            free( strip.Buffer );
+            strip.Buffer   = buffer;
+            strip.Capacity = size;
+        }
+        strip.Size = size;
+
+        lock.lock( );
+
+        if ( ++StripsDone == StripCount )
+        {
+            JobCompleted.notify_all( );
+        }
+    }
+}
+
+// Join compressed strips into a single JPEG image - headers of the first strip (with image height updated)
+// followed by entropy coded data of all strips separated by restart markers
+XError XJpegStripEncoder::JoinStrips( int32_t height, uint8_t** buffer, uint32_t* bufferSize )
+{
+    vector<uint32_t> scanOffsets( StripCount );
+    uint32_t         sofOffset = 0;
+    uint32_t         totalSize = 2;
+    uint8_t*         output    = *buffer;
+    uint8_t*         ptr;
+
+    for ( uint32_t i = 0; i < StripCount; i++ )
+    {
+        const XJpegStrip& strip = Strips[i];
+        uint32_t          stripSofOffset = 0;
+
+        if ( !FindJpegScanData( strip.Buffer, static_cast<uint32_t>( strip.Size ), &stripSofOffset, &scanOffsets[i] ) )
+        {
+            return XError::FailedImageEncoding;
+        }
+
+        if ( i == 0 )
+        {
+            sofOffset  = stripSofOffset;
+            totalSize += static_cast<uint32_t>( strip.Size ) - 2;
+        }
+        else
+        {
+            totalSize += 2 + static_cast<uint32_t>( strip.Size ) - 2 - scanOffsets[i];
+        }
+    }
+
+    if ( totalSize > *bufferSize )
+    {
+        output = static_cast<uint8_t*>( malloc( totalSize ) );
+
+        if ( output == nullptr )
+        {
+            return XError::OutOfMemory;
+        }
+    }
+
+    memcpy( output, Strips[0].Buffer, Strips[0].Size - 2 );
+    ptr = output + Strips[0].Size - 2;
+
+    for ( uint32_t i = 1; i < StripCount; i++ )
+    {
+        uint32_t dataSize = static_cast<uint32_t>( Strips[i].Size ) - 2 - scanOffsets[i];
+
+        // RST0-RST7 markers go in cycle
+        *ptr++ = 0xFF;
+        *ptr++ = static_cast<uint8_t>( 0xD0 + ( ( i - 1 ) & 7 ) );
+
+        memcpy( ptr, Strips[i].Buffer + scanOffsets[i], dataSize );
+        ptr += dataSize;
+    }
+
+    // EOI
+    *ptr++ = 0xFF;
+    *ptr++ = 0xD9;
+
+    // height of the whole image
+    output[sofOffset + 5] = static_cast<uint8_t>( height >> 8 );
+    output[sofOffset + 6] = static_cast<uint8_t>( height & 0xFF );
+
+    *buffer     = output;
+    *bufferSize = totalSize;
+
+    return XError::Success;
+}
+
 } // namespace Private
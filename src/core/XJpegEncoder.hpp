@@ -46,14 +46,26 @@ public:
     bool FasterCompression( ) const;
     void SetFasterCompression( bool faster );
 
+    // Set/get number of threads used to compress an image, [1, 16]. With more than one thread,
+    // image is split into horizontal strips (aligned to MCU rows), which are compressed in parallel
+    // and joined using restart markers. Small images are still compressed by a single thread.
+    uint32_t ThreadCount( ) const;
+    void SetThreadCount( uint32_t threadCount );
+
     /* Compress the specified image into provided buffer
 
        On input, buffer size must be set to the size of provided buffer.
        On output, it is set to the size of encoded JPEG image. If provided
        buffer is too small, it will be re-allocated (realloc).
+
+       Supported formats are RGB24, Grayscale8 and YUV ones - YUYV, YUV422P, YUV420P. YUV
+       images are compressed as they are, without converting them to RGB and back.
     */
     XError EncodeToMemory( const std::shared_ptr<const XImage>& image, uint8_t** buffer, uint32_t* bufferSize );
 
+    // Get size of the JPEG image by parsing its SOF marker (without decoding the image)
+    static XError GetImageSize( const uint8_t* jpegData, uint32_t jpegSize, int32_t* width, int32_t* height );
+
 private:
     Private::XJpegEncoderData* mData;
 };
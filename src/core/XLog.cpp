@@ -0,0 +1,277 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include <time.h>
+#include <chrono>
+#include <limits>
+#include <memory>
+#include <thread>
+
+#include "XLog.hpp"
+#include "XManualResetEvent.hpp"
+
+using namespace std;
+using namespace std::chrono;
+
+// number of messages the buffer can hold (power of 2)
+#define LOG_BUFFER_SLOTS    (256)
+// maximum length of a message - longer ones are truncated
+#define LOG_MESSAGE_SIZE    (240)
+// interval to write out buffered messages, ms
+#define LOG_WRITE_INTERVAL  (50)
+
+namespace Private
+{
+    // Slot of the ring buffer holding one message. Its sequence tells if the slot is free for the message
+    // number N (sequence == N) or it holds message N, which is ready to be written (sequence == N + 1).
+    struct LogSlot
+    {
+        atomic<uint64_t> Sequence;
+        XLogLevel        Level;
+        uint64_t         Time;
+        char             Text[LOG_MESSAGE_SIZE];
+    };
+
+    class XLogData
+    {
+    public:
+        unique_ptr<LogSlot[]> Slots;
+        atomic<uint64_t>      Tail;         // number of the next message to put
+        atomic<uint64_t>      Head;         // number of the next message to write out
+        atomic<uint64_t>      Dropped;
+        XManualResetEvent     NeedToStop;
+        thread                WriterThread;
+
+    public:
+        XLogData( ) :
+            Slots( new LogSlot[LOG_BUFFER_SLOTS] ), Tail( 0 ), Head( 0 ), Dropped( 0 ), NeedToStop( ), WriterThread( )
+        {
+            for ( uint64_t i = 0; i < LOG_BUFFER_SLOTS; i++ )
+            {
+                Slots[i].Sequence.store( i, memory_order_relaxed );
+            }
+
+            WriterThread = thread( WriterThreadHandler, this );
+        }
+
+        ~XLogData( )
+        {
+            NeedToStop.Signal( );
+            WriterThread.join( );
+        }
+
+        LogSlot* Acquire( uint64_t* number );
+        void WriteOut( );
+
+    private:
+        static void WriterThreadHandler( XLogData* me );
+    };
+}
+
+XLog::XLog( ) :
+    mLevel( XLOG_MIN_LEVEL ), mData( new Private::XLogData( ) )
+{
+}
+
+XLog::~XLog( )
+{
+    delete mData;
+}
+
+// Logger shared by all components of the application
+XLog& XLog::Instance( )
+{
+    static XLog log;
+
+    return log;
+}
+
+// Get/Set minimum level of messages to write
+XLogLevel XLog::Level( ) const
+{
+    return static_cast<XLogLevel>( mLevel.load( ) );
+}
+void XLog::SetLevel( XLogLevel level )
+{
+    mLevel = static_cast<int>( level );
+}
+
+// Put formatted message into the buffer
+void XLog::Write( XLogLevel level, uint32_t suppressed, const char* fmt, ... )
+{
+    uint64_t          number;
+    Private::LogSlot* slot = mData->Acquire( &number );
+
+    if ( slot != nullptr )
+    {
+        va_list list;
+        int     length;
+
+        slot->Level = level;
+        slot->Time  = static_cast<uint64_t>( duration_cast<microseconds>( system_clock::now( ).time_since_epoch( ) ).count( ) );
+
+        va_start( list, fmt );
+        length = vsnprintf( slot->Text, LOG_MESSAGE_SIZE, fmt, list );
+        va_end( list );
+
+        if ( ( suppressed != 0 ) && ( length >= 0 ) && ( length < LOG_MESSAGE_SIZE ) )
+        {
+            snprintf( slot->Text + length, LOG_MESSAGE_SIZE - length, " (%u similar suppressed)", suppressed );
+        }
+
+        // let the writer have it
+        slot->Sequence.store( number + 1, memory_order_release );
+    }
+}
+
+// Wait till all messages put so far are written
+void XLog::Flush( )
+{
+    uint64_t tail = mData->Tail.load( );
+
+    while ( mData->Head.load( ) < tail )
+    {
+        this_thread::sleep_for( milliseconds( 1 ) );
+    }
+}
+
+// Number of messages dropped because the buffer was full
+uint64_t XLog::DroppedMessages( ) const
+{
+    return mData->Dropped.load( );
+}
+
+// Create rate limiter of a call site
+XLogRateLimiter::XLogRateLimiter( uint32_t intervalMs ) :
+    mInterval( intervalMs ), mNextTime( numeric_limits<int64_t>::min( ) ), mSuppressed( 0 )
+{
+}
+
+// Check if a message can be written now
+bool XLogRateLimiter::Allow( uint32_t* suppressed )
+{
+    int64_t now  = duration_cast<milliseconds>( steady_clock::now( ).time_since_epoch( ) ).count( );
+    int64_t next = mNextTime.load( memory_order_relaxed );
+
+    // only one of the threads getting here at the same time wins
+    if ( ( now >= next ) && ( mNextTime.compare_exchange_strong( next, now + mInterval, memory_order_relaxed ) ) )
+    {
+        *suppressed = mSuppressed.exchange( 0, memory_order_relaxed );
+        return true;
+    }
+
+    mSuppressed.fetch_add( 1, memory_order_relaxed );
+    return false;
+}
+
+namespace Private
+{
+
+// Get free slot for a new message - null if the buffer is full
+LogSlot* XLogData::Acquire( uint64_t* number )
+{
+    uint64_t tail = Tail.load( memory_order_relaxed );
+
+    for ( ; ; )
+    {
+        LogSlot* slot     = &Slots[tail & ( LOG_BUFFER_SLOTS - 1 )];
+        uint64_t sequence = slot->Sequence.load( memory_order_acquire );
+
+        if ( sequence == tail )
+        {
+            if ( Tail.compare_exchange_weak( tail, tail + 1, memory_order_relaxed ) )
+            {
+                *number = tail;
+                return slot;
+            }
+        }
+        else if ( sequence < tail )
+        {
+            // the slot still holds message from the previous round, which was not written out yet
+            Dropped.fetch_add( 1, memory_order_relaxed );
+            return nullptr;
+        }
+        else
+        {
+            // another thread took the slot
+            tail = Tail.load( memory_order_relaxed );
+        }
+    }
+}
+
+// Write out all messages, which are ready
+void XLogData::WriteOut( )
+{
+    static const char* levelNames[] = { "Debug", "Info", "Warning", "Error" };
+    uint64_t           head         = Head.load( memory_order_relaxed );
+    bool               wrote        = false;
+
+    for ( ; ; )
+    {
+        LogSlot* slot = &Slots[head & ( LOG_BUFFER_SLOTS - 1 )];
+
+        if ( slot->Sequence.load( memory_order_acquire ) != head + 1 )
+        {
+            break;
+        }
+
+        time_t    seconds = static_cast<time_t>( slot->Time / 1000000 );
+        struct tm localTime;
+        char      strTime[32] = "";
+
+#ifdef _WIN32
+        if ( localtime_s( &localTime, &seconds ) == 0 )
+#else
+        if ( localtime_r( &seconds, &localTime ) != nullptr )
+#endif
+        {
+            strftime( strTime, sizeof( strTime ), "%Y-%m-%d %H:%M:%S", &localTime );
+        }
+
+        printf( "%s.%03u [%s] %s \n", strTime, static_cast<uint32_t>( slot->Time / 1000 % 1000 ),
+                levelNames[static_cast<int>( slot->Level ) & 3], slot->Text );
+
+        // free the slot for the message, which comes one round later
+        slot->Sequence.store( head + LOG_BUFFER_SLOTS, memory_order_release );
+        Head.store( ++head, memory_order_release );
+        wrote = true;
+    }
+
+    if ( wrote )
+    {
+        fflush( stdout );
+    }
+}
+
+// Background thread writing out messages
+void XLogData::WriterThreadHandler( XLogData* me )
+{
+    while ( !me->NeedToStop.Wait( LOG_WRITE_INTERVAL ) )
+    {
+        me->WriteOut( );
+    }
+
+    me->WriteOut( );
+}
+
+} // namespace Private
@@ -0,0 +1,178 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef XLOG_HPP
+#define XLOG_HPP
+
+#include <stdint.h>
+#include <atomic>
+
+#include "XInterfaces.hpp"
+
+namespace Private
+{
+    class XLogData;
+}
+
+// Severity of log messages
+enum class XLogLevel
+{
+    Debug = 0,
+    Info,
+    Warning,
+    Error,
+    None        // used as minimum level to disable logging
+};
+
+// Minimum level of messages compiled in - debug messages are dropped from release builds
+#ifndef XLOG_MIN_LEVEL
+    #ifdef NDEBUG
+        #define XLOG_MIN_LEVEL (1)
+    #else
+        #define XLOG_MIN_LEVEL (0)
+    #endif
+#endif
+
+// Logger, which never blocks its callers. Messages are formatted by the caller into a fixed size slot of
+// a lock-free ring buffer, which is written out by a background thread. If the buffer is full, messages
+// are dropped (and counted) instead of waiting. Use XLOG_* macros rather than calling it directly.
+class XLog : private Uncopyable
+{
+private:
+    XLog( );
+
+public:
+    ~XLog( );
+
+    // Logger shared by all components of the application
+    static XLog& Instance( );
+
+    // Get/Set minimum level of messages to write (compiled in debug messages are not written by default)
+    XLogLevel Level( ) const;
+    void SetLevel( XLogLevel level );
+
+    // Check if messages of the specified level are written
+    bool IsEnabled( XLogLevel level ) const
+    {
+        return ( static_cast<int>( level ) >= mLevel.load( std::memory_order_relaxed ) );
+    }
+
+    // Put formatted message into the buffer (printf style format). Number of messages suppressed at the
+    // same call site by rate limiting is reported together with the message.
+    void Write( XLogLevel level, uint32_t suppressed, const char* fmt, ... )
+#ifdef __GNUC__
+        __attribute__( ( format( printf, 4, 5 ) ) )
+#endif
+        ;
+
+    // Wait till all messages put so far are written
+    void Flush( );
+
+    // Number of messages dropped because the buffer was full
+    uint64_t DroppedMessages( ) const;
+
+private:
+    std::atomic<int>  mLevel;
+    Private::XLogData* mData;
+};
+
+// Rate limiter of a single call site - lets one message through per the specified interval and counts
+// the ones suppressed in between
+class XLogRateLimiter : private Uncopyable
+{
+public:
+    XLogRateLimiter( uint32_t intervalMs );
+
+    // Check if a message can be written now - provides number of messages suppressed since the last one
+    bool Allow( uint32_t* suppressed );
+
+private:
+    int64_t               mInterval;
+    std::atomic<int64_t>  mNextTime;
+    std::atomic<uint32_t> mSuppressed;
+};
+
+// Write message if its level is enabled. Arguments are not evaluated for disabled levels.
+#define XLOG_WRITE( level, ... ) \
+    do \
+    { \
+        if ( XLog::Instance( ).IsEnabled( level ) ) \
+        { \
+            XLog::Instance( ).Write( level, 0, __VA_ARGS__ ); \
+        } \
+    } \
+    while ( false )
+
+// Write message no more often than once in the specified interval (milliseconds) from the call site
+#define XLOG_WRITE_LIMITED( level, intervalMs, ... ) \
+    do \
+    { \
+        if ( XLog::Instance( ).IsEnabled( level ) ) \
+        { \
+            static XLogRateLimiter xlogLimiter( intervalMs ); \
+            uint32_t               xlogSuppressed; \
+            \
+            if ( xlogLimiter.Allow( &xlogSuppressed ) ) \
+            { \
+                XLog::Instance( ).Write( level, xlogSuppressed, __VA_ARGS__ ); \
+            } \
+        } \
+    } \
+    while ( false )
+
+// Compiled out level - the arguments still get checked by compiler, but no code is generated
+#define XLOG_ELIDED( ... ) \
+    do \
+    { \
+        if ( false ) \
+        { \
+            XLog::Instance( ).Write( XLogLevel::Debug, 0, __VA_ARGS__ ); \
+        } \
+    } \
+    while ( false )
+
+#if XLOG_MIN_LEVEL <= 0
+    #define XLOG_DEBUG( ... )                     XLOG_WRITE( XLogLevel::Debug, __VA_ARGS__ )
+    #define XLOG_DEBUG_LIMITED( intervalMs, ... ) XLOG_WRITE_LIMITED( XLogLevel::Debug, intervalMs, __VA_ARGS__ )
+#else
+    #define XLOG_DEBUG( ... )                     XLOG_ELIDED( __VA_ARGS__ )
+    #define XLOG_DEBUG_LIMITED( intervalMs, ... ) XLOG_ELIDED( __VA_ARGS__ )
+#endif
+
+#if XLOG_MIN_LEVEL <= 1
+    #define XLOG_INFO( ... )                      XLOG_WRITE( XLogLevel::Info, __VA_ARGS__ )
+    #define XLOG_INFO_LIMITED( intervalMs, ... )  XLOG_WRITE_LIMITED( XLogLevel::Info, intervalMs, __VA_ARGS__ )
+#else
+    #define XLOG_INFO( ... )                      XLOG_ELIDED( __VA_ARGS__ )
+    #define XLOG_INFO_LIMITED( intervalMs, ... )  XLOG_ELIDED( __VA_ARGS__ )
+#endif
+
+#if XLOG_MIN_LEVEL <= 2
+    #define XLOG_WARNING( ... )                     XLOG_WRITE( XLogLevel::Warning, __VA_ARGS__ )
+    #define XLOG_WARNING_LIMITED( intervalMs, ... ) XLOG_WRITE_LIMITED( XLogLevel::Warning, intervalMs, __VA_ARGS__ )
+#else
+    #define XLOG_WARNING( ... )                     XLOG_ELIDED( __VA_ARGS__ )
+    #define XLOG_WARNING_LIMITED( intervalMs, ... ) XLOG_ELIDED( __VA_ARGS__ )
+#endif
+
+#define XLOG_ERROR( ... )                         XLOG_WRITE( XLogLevel::Error, __VA_ARGS__ )
+#define XLOG_ERROR_LIMITED( intervalMs, ... )     XLOG_WRITE_LIMITED( XLogLevel::Error, intervalMs, __VA_ARGS__ )
+
+#endif // XLOG_HPP
@@ -0,0 +1,429 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <stdio.h>
+#include <algorithm>
+#include <map>
+#include <mutex>
+
+#include "XMetrics.hpp"
+
+using namespace std;
+
+namespace Private
+{
+    enum class MetricType
+    {
+        Counter,
+        Gauge,
+        Histogram
+    };
+
+    // A metric of a family - one combination of labels
+    class MetricEntry
+    {
+    public:
+        string                       Labels;
+        shared_ptr<XMetricCounter>   Counter;
+        shared_ptr<XMetricGauge>     Gauge;
+        shared_ptr<XMetricHistogram> Histogram;
+        double                       Unit;
+
+    public:
+        MetricEntry( const string& labels ) :
+            Labels( labels ), Counter( ), Gauge( ), Histogram( ), Unit( 1.0 )
+        { }
+    };
+
+    // All metrics of the same name
+    class MetricFamily
+    {
+    public:
+        string              Help;
+        MetricType          Type;
+        vector<MetricEntry> Entries;
+
+    public:
+        MetricFamily( ) : Help( ), Type( MetricType::Counter ), Entries( ) { }
+    };
+
+    // Private details of the implementation
+    class XMetricsRegistryData
+    {
+    public:
+        mutable mutex               Sync;
+        map<string, MetricFamily>   Families;
+        // metrics requested with a type different from the family's - kept alive, but not exposed
+        vector<MetricEntry>         Mismatched;
+
+    public:
+        XMetricsRegistryData( ) : Sync( ), Families( ), Mismatched( ) { }
+
+        MetricEntry& GetEntry( const string& name, const string& help, MetricType type, const string& labels, bool* pCreated );
+    };
+}
+
+// Append label set to the metric name - optional extra label goes last (used for bucket bounds)
+static void AppendLabels( string& text, const string& labels, const char* extraLabel = nullptr )
+{
+    if ( ( !labels.empty( ) ) || ( extraLabel != nullptr ) )
+    {
+        text += '{';
+        text += labels;
+
+        if ( extraLabel != nullptr )
+        {
+            if ( !labels.empty( ) )
+            {
+                text += ',';
+            }
+            text += extraLabel;
+        }
+
+        text += '}';
+    }
+}
+
+XMetricHistogram::XMetricHistogram( const vector<uint64_t>& bounds ) :
+    mBounds( bounds ), mCounts( new atomic<uint64_t>[bounds.size( ) + 1] ), mSum( 0 ), mMax( 0 )
+{
+    for ( size_t i = 0; i <= mBounds.size( ); i++ )
+    {
+        mCounts[i].store( 0 );
+    }
+}
+
+// Number of values in the bucket (not cumulative)
+uint64_t XMetricHistogram::BucketCount( size_t bucket ) const
+{
+    return ( bucket <= mBounds.size( ) ) ? mCounts[bucket].load( memory_order_relaxed ) : 0;
+}
+
+// Number of observed values
+uint64_t XMetricHistogram::Count( ) const
+{
+    uint64_t count = 0;
+
+    for ( size_t i = 0; i <= mBounds.size( ); i++ )
+    {
+        count += mCounts[i].load( memory_order_relaxed );
+    }
+
+    return count;
+}
+
+// Sum of all observed values
+uint64_t XMetricHistogram::Sum( ) const
+{
+    return mSum.load( memory_order_relaxed );
+}
+
+// The biggest observed value
+uint64_t XMetricHistogram::Max( ) const
+{
+    return mMax.load( memory_order_relaxed );
+}
+
+// Estimate value, which the specified fraction of observations do not exceed
+uint64_t XMetricHistogram::Quantile( double fraction ) const
+{
+    vector<uint64_t> counts( mBounds.size( ) + 1 );
+    uint64_t         biggest = mMax.load( memory_order_relaxed );
+    uint64_t         total   = 0;
+    uint64_t         ret     = 0;
+
+    // take a snapshot first, since other threads keep observing values
+    for ( size_t i = 0; i < counts.size( ); i++ )
+    {
+        counts[i] = mCounts[i].load( memory_order_relaxed );
+        total    += counts[i];
+    }
+
+    if ( total != 0 )
+    {
+        double   rank       = max( 1.0, min( fraction, 1.0 ) * total );
+        uint64_t cumulative = 0;
+        size_t   bucket     = 0;
+
+        while ( ( bucket < counts.size( ) - 1 ) && ( cumulative + counts[bucket] < rank ) )
+        {
+            cumulative += counts[bucket];
+            bucket++;
+        }
+
+        uint64_t lower = ( bucket == 0 ) ? 0 : mBounds[bucket - 1];
+        uint64_t upper = ( bucket < mBounds.size( ) ) ? mBounds[bucket] : biggest;
+
+        ret = ( upper <= lower ) ? upper :
+              lower + static_cast<uint64_t>( ( upper - lower ) * ( rank - cumulative ) / max( counts[bucket], static_cast<uint64_t>( 1 ) ) );
+        ret = min( ret, biggest );
+    }
+
+    return ret;
+}
+
+XMetricsRegistry::XMetricsRegistry( ) :
+    mData( new Private::XMetricsRegistryData( ) )
+{
+}
+
+XMetricsRegistry::~XMetricsRegistry( )
+{
+    delete mData;
+}
+
+// Registry shared by all components of the application
+XMetricsRegistry& XMetricsRegistry::Instance( )
+{
+    static XMetricsRegistry registry;
+
+    return registry;
+}
+
+// Get counter with the specified name and labels, creating it if needed
+XMetricCounter& XMetricsRegistry::Counter( const string& name, const string& help, const string& labels )
+{
+    lock_guard<mutex>     lock( mData->Sync );
+    bool                  created;
+    Private::MetricEntry& entry = mData->GetEntry( name, help, Private::MetricType::Counter, labels, &created );
+
+    if ( created )
+    {
+        entry.Counter = make_shared<XMetricCounter>( );
+    }
+
+    return *entry.Counter;
+}
+
+// Get gauge with the specified name and labels, creating it if needed
+XMetricGauge& XMetricsRegistry::Gauge( const string& name, const string& help, const string& labels )
+{
+    lock_guard<mutex>     lock( mData->Sync );
+    bool                  created;
+    Private::MetricEntry& entry = mData->GetEntry( name, help, Private::MetricType::Gauge, labels, &created );
+
+    if ( created )
+    {
+        entry.Gauge = make_shared<XMetricGauge>( );
+    }
+
+    return *entry.Gauge;
+}
+
+// Get histogram with the specified name and labels, creating it if needed (existing one keeps its buckets)
+XMetricHistogram& XMetricsRegistry::Histogram( const string& name, const string& help, const vector<uint64_t>& bounds,
+                                               double unit, const string& labels )
+{
+    lock_guard<mutex>     lock( mData->Sync );
+    bool                  created;
+    Private::MetricEntry& entry = mData->GetEntry( name, help, Private::MetricType::Histogram, labels, &created );
+
+    if ( created )
+    {
+        entry.Histogram = make_shared<XMetricHistogram>( bounds );
+        entry.Unit      = unit;
+    }
+
+    return *entry.Histogram;
+}
+
+// Format label with the specified value, escaping backslash, double quote and new line
+string XMetricsRegistry::Label( const string& name, const string& value )
+{
+    string label = name + "=\"";
+
+    for ( char c : value )
+    {
+        if ( c == '\n' )
+        {
+            label += "\\n";
+        }
+        else
+        {
+            if ( ( c == '\\' ) || ( c == '"' ) )
+            {
+                label += '\\';
+            }
+            label += c;
+        }
+    }
+
+    label += '"';
+
+    return label;
+}
+
+// Buckets for time measured in microseconds
+const vector<uint64_t>& XMetricsRegistry::TimeBuckets( )
+{
+    static const uint64_t         bounds[] = { 100, 250, 500, 1000, 2500, 5000, 10000, 25000, 50000, 100000, 250000, 500000, 1000000 };
+    static const vector<uint64_t> buckets( bounds, bounds + sizeof( bounds ) / sizeof( bounds[0] ) );
+
+    return buckets;
+}
+
+// Buckets for latency measured in microseconds
+const vector<uint64_t>& XMetricsRegistry::LatencyBuckets( )
+{
+    static const uint64_t         bounds[] = { 1000, 2500, 5000, 10000, 20000, 35000, 50000, 75000, 100000, 150000,
+                                               250000, 500000, 1000000, 2500000, 5000000, 10000000 };
+    static const vector<uint64_t> buckets( bounds, bounds + sizeof( bounds ) / sizeof( bounds[0] ) );
+
+    return buckets;
+}
+
+// Get all metrics in Prometheus text exposition format
+string XMetricsRegistry::ToText( ) const
+{
+    lock_guard<mutex> lock( mData->Sync );
+    string            text;
+    char              buffer[64];
+
+    text.reserve( 4096 );
+
+    for ( const auto& family : mData->Families )
+    {
+        const string& name = family.first;
+
+        text += "# HELP " + name + ' ' + family.second.Help + '\n';
+        text += "# TYPE " + name + ' ';
+        text += ( family.second.Type == Private::MetricType::Counter ) ? "counter\n" :
+                ( family.second.Type == Private::MetricType::Gauge   ) ? "gauge\n"   : "histogram\n";
+
+        for ( const Private::MetricEntry& entry : family.second.Entries )
+        {
+            if ( entry.Counter )
+            {
+                snprintf( buffer, sizeof( buffer ), " %llu\n", static_cast<unsigned long long>( entry.Counter->Value( ) ) );
+                text += name;
+                AppendLabels( text, entry.Labels );
+                text += buffer;
+            }
+            else if ( entry.Gauge )
+            {
+                snprintf( buffer, sizeof( buffer ), " %lld\n", static_cast<long long>( entry.Gauge->Value( ) ) );
+                text += name;
+                AppendLabels( text, entry.Labels );
+                text += buffer;
+            }
+            else if ( entry.Histogram )
+            {
+                const vector<uint64_t>& bounds     = entry.Histogram->Bounds( );
+                uint64_t                cumulative = 0;
+
+                // buckets are cumulative in the exposition format; values are read one by one without stopping
+                // updates, so the total may be slightly behind the sum (it gets consistent on next scrape)
+                for ( size_t i = 0; i <= bounds.size( ); i++ )
+                {
+                    char bound[48];
+
+                    cumulative += entry.Histogram->BucketCount( i );
+
+                    if ( i < bounds.size( ) )
+                    {
+                        snprintf( bound, sizeof( bound ), "le=\"%.9g\"", bounds[i] * entry.Unit );
+                    }
+                    else
+                    {
+                        snprintf( bound, sizeof( bound ), "le=\"+Inf\"" );
+                    }
+
+                    snprintf( buffer, sizeof( buffer ), " %llu\n", static_cast<unsigned long long>( cumulative ) );
+                    text += name + "_bucket";
+                    AppendLabels( text, entry.Labels, bound );
+                    text += buffer;
+                }
+
+                snprintf( buffer, sizeof( buffer ), " %.9g\n", entry.Histogram->Sum( ) * entry.Unit );
+                text += name + "_sum";
+                AppendLabels( text, entry.Labels );
+                text += buffer;
+
+                snprintf( buffer, sizeof( buffer ), " %llu\n", static_cast<unsigned long long>( cumulative ) );
+                text += name + "_count";
+                AppendLabels( text, entry.Labels );
+                text += buffer;
+            }
+        }
+    }
+
+    return text;
+}
+
+namespace Private
+{
+
+// Find metric entry of the specified family or add new one (registry must be locked)
+MetricEntry& XMetricsRegistryData::GetEntry( const string& name, const string& help, MetricType type, const string& labels, bool* pCreated )
+{
+    auto it = Families.find( name );
+
+    if ( it == Families.end( ) )
+    {
+        it = Families.insert( make_pair( name, MetricFamily( ) ) ).first;
+        it->second.Help = help;
+        it->second.Type = type;
+    }
+
+    MetricFamily& family = it->second;
+
+    *pCreated = false;
+
+    if ( family.Type != type )
+    {
+        Mismatched.push_back( MetricEntry( labels ) );
+        *pCreated = true;
+        return Mismatched.back( );
+    }
+
+    for ( MetricEntry& entry : family.Entries )
+    {
+        if ( entry.Labels == labels )
+        {
+            return entry;
+        }
+    }
+
+    family.Entries.push_back( MetricEntry( labels ) );
+    *pCreated = true;
+
+    return family.Entries.back( );
+}
+
+} // namespace Private
+
+XMetricsRequestHandler::XMetricsRequestHandler( const string& uri, XMetricsRegistry& registry ) :
+    IWebRequestHandler( uri, false ), Registry( registry )
+{
+}
+
+// Provide current values of all metrics
+void XMetricsRequestHandler::HandleHttpRequest( const IWebRequest& /* request */, IWebResponse& response )
+{
+    string text = Registry.ToText( );
+
+    response.Printf( "HTTP/1.1 200 OK\r\n"
+                     "Content-Type: text/plain; version=0.0.4; charset=utf-8\r\n"
+                     "Content-Length: %u\r\n"
+                     "Cache-Control: no-store, must-revalidate\r\nPragma: no-cache\r\nExpires: 0\r\n"
+                     "\r\n",
+                     static_cast<unsigned int>( text.length( ) ) );
+    response.Send( reinterpret_cast<const uint8_t*>( text.data( ) ), text.length( ) );
+}
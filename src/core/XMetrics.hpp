@@ -0,0 +1,179 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef XMETRICS_HPP
+#define XMETRICS_HPP
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include <memory>
+#include <atomic>
+
+#include "XInterfaces.hpp"
+#include "XWebServer.hpp"
+
+namespace Private
+{
+    class XMetricsRegistryData;
+}
+
+// Counter, which only goes up (frames, bytes, failures, etc.). Updating is a relaxed atomic increment,
+// so it can be done from any thread on the hot path.
+class XMetricCounter : private Uncopyable
+{
+public:
+    XMetricCounter( ) : mValue( 0 ) { }
+
+    void Increment( uint64_t value = 1 )
+    {
+        mValue.fetch_add( value, std::memory_order_relaxed );
+    }
+
+    uint64_t Value( ) const
+    {
+        return mValue.load( std::memory_order_relaxed );
+    }
+
+private:
+    std::atomic<uint64_t> mValue;
+};
+
+// Value, which may go up and down (clients connected, frames queued, etc.)
+class XMetricGauge : private Uncopyable
+{
+public:
+    XMetricGauge( ) : mValue( 0 ) { }
+
+    void Set( int64_t value )
+    {
+        mValue.store( value, std::memory_order_relaxed );
+    }
+
+    void Add( int64_t value )
+    {
+        mValue.fetch_add( value, std::memory_order_relaxed );
+    }
+
+    int64_t Value( ) const
+    {
+        return mValue.load( std::memory_order_relaxed );
+    }
+
+private:
+    std::atomic<int64_t> mValue;
+};
+
+// Histogram of integer values (like times in microseconds) with fixed buckets. Observing a value finds its
+// bucket and does relaxed increments of bucket's count and of the sum - no locks, no allocations.
+class XMetricHistogram : private Uncopyable
+{
+public:
+    // Upper bounds (inclusive) of buckets in ascending order; bigger values go to the last (+Inf) bucket
+    XMetricHistogram( const std::vector<uint64_t>& bounds );
+
+    void Observe( uint64_t value )
+    {
+        size_t bucket = 0;
+
+        while ( ( bucket < mBounds.size( ) ) && ( value > mBounds[bucket] ) )
+        {
+            bucket++;
+        }
+
+        mCounts[bucket].fetch_add( 1, std::memory_order_relaxed );
+        mSum.fetch_add( value, std::memory_order_relaxed );
+
+        // new maximum is rare, so it is mostly just a load
+        uint64_t max = mMax.load( std::memory_order_relaxed );
+
+        while ( ( value > max ) && ( !mMax.compare_exchange_weak( max, value, std::memory_order_relaxed ) ) )
+        {
+        }
+    }
+
+    // Upper bounds of buckets (not including the +Inf one)
+    const std::vector<uint64_t>& Bounds( ) const { return mBounds; }
+    // Number of values in the bucket (not cumulative); bucket Bounds( ).size( ) is the +Inf one
+    uint64_t BucketCount( size_t bucket ) const;
+    // Number of observed values
+    uint64_t Count( ) const;
+    // Sum of all observed values
+    uint64_t Sum( ) const;
+    // The biggest observed value
+    uint64_t Max( ) const;
+
+    // Estimate value, which the specified fraction (0.5 for median) of observations do not exceed. It is interpolated
+    // inside the bucket the fraction gets into, so its precision depends on buckets. 0 if nothing was observed.
+    uint64_t Quantile( double fraction ) const;
+
+private:
+    std::vector<uint64_t>                    mBounds;
+    std::unique_ptr<std::atomic<uint64_t>[]> mCounts;
+    std::atomic<uint64_t>                    mSum;
+    std::atomic<uint64_t>                    mMax;
+};
+
+// Registry of metrics, which provides them in Prometheus text format. Metrics are created on first request
+// and are never removed, so components look them up once and keep the reference for updating.
+class XMetricsRegistry : private Uncopyable
+{
+public:
+    XMetricsRegistry( );
+    ~XMetricsRegistry( );
+
+    // Registry shared by all components of the application
+    static XMetricsRegistry& Instance( );
+
+    // Get metric with the specified name and labels (like: endpoint="/camera/mjpeg"), creating it if needed.
+    // All metrics of the same name must be of the same type - a metric of another type is not exposed.
+    XMetricCounter& Counter( const std::string& name, const std::string& help, const std::string& labels = std::string( ) );
+    XMetricGauge& Gauge( const std::string& name, const std::string& help, const std::string& labels = std::string( ) );
+    // Histogram's values and bounds are exposed multiplied by the unit (1e-6 exposes microseconds as seconds)
+    XMetricHistogram& Histogram( const std::string& name, const std::string& help, const std::vector<uint64_t>& bounds,
+                                 double unit = 1.0, const std::string& labels = std::string( ) );
+
+    // Format label with the specified value for the above calls, escaping the value as needed
+    static std::string Label( const std::string& name, const std::string& value );
+    // Buckets for time measured in microseconds - from 100 microseconds to 1 second
+    static const std::vector<uint64_t>& TimeBuckets( );
+    // Buckets for latency measured in microseconds - from 1 millisecond to 10 seconds
+    static const std::vector<uint64_t>& LatencyBuckets( );
+
+    // Get all metrics in Prometheus text exposition format
+    std::string ToText( ) const;
+
+private:
+    Private::XMetricsRegistryData* mData;
+};
+
+// Web request handler providing metrics in Prometheus text format
+class XMetricsRequestHandler : public IWebRequestHandler
+{
+public:
+    XMetricsRequestHandler( const std::string& uri, XMetricsRegistry& registry = XMetricsRegistry::Instance( ) );
+
+    void HandleHttpRequest( const IWebRequest& request, IWebResponse& response );
+
+private:
+    XMetricsRegistry& Registry;
+};
+
+#endif // XMETRICS_HPP
@@ -0,0 +1,73 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef XSTRING_VIEW_HPP
+#define XSTRING_VIEW_HPP
+
+#include <string.h>
+#include <string>
+
+// Non-owning view of a string (pointer and length), which is valid only while the viewed data is.
+// Allows looking at parts of bigger buffers without copying them into new strings.
+class XStringView
+{
+public:
+    XStringView( ) : mData( "" ), mLength( 0 ) { }
+    XStringView( const char* data, size_t length ) : mData( data ), mLength( length ) { }
+    XStringView( const char* str ) : mData( str ), mLength( strlen( str ) ) { }
+    XStringView( const std::string& str ) : mData( str.data( ) ), mLength( str.length( ) ) { }
+
+    const char* Data( )   const { return mData; }
+    size_t      Length( ) const { return mLength; }
+    bool        IsEmpty( ) const { return ( mLength == 0 ); }
+
+    char operator[]( size_t index ) const { return mData[index]; }
+
+    // Get part of the view (limited to its end)
+    XStringView SubView( size_t start, size_t length = std::string::npos ) const
+    {
+        start = ( start > mLength ) ? mLength : start;
+        return XStringView( mData + start, ( length > mLength - start ) ? mLength - start : length );
+    }
+
+    // Check if the view starts with the specified prefix
+    bool StartsWith( const XStringView& prefix ) const
+    {
+        return ( prefix.mLength <= mLength ) && ( memcmp( mData, prefix.mData, prefix.mLength ) == 0 );
+    }
+
+    bool operator==( const XStringView& rhs ) const
+    {
+        return ( mLength == rhs.mLength ) && ( memcmp( mData, rhs.mData, mLength ) == 0 );
+    }
+    bool operator!=( const XStringView& rhs ) const
+    {
+        return !( *this == rhs );
+    }
+
+    // Make a copy of the viewed string
+    std::string ToString( ) const { return std::string( mData, mLength ); }
+
+private:
+    const char* mData;
+    size_t      mLength;
+};
+
+#endif // XSTRING_VIEW_HPP
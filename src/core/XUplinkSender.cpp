@@ -0,0 +1,934 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <stdio.h>
+#include <string.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+#include <sys/types.h>
+#include <sys/socket.h>
+#include <sys/time.h>
+#include <sys/uio.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <netdb.h>
+#include <endian.h>
+#include <linux/errqueue.h>
+
+#include "XUplinkSender.hpp"
+#include "XManualResetEvent.hpp"
+#include "XMetrics.hpp"
+#include "XLog.hpp"
+
+using namespace std;
+using namespace std::chrono;
+
+namespace Private
+{
+    #define SEND_TIMEOUT_SEC            (5)
+    #define CONNECT_TIMEOUT_MS          (3000)
+    #define CONNECT_POLL_INTERVAL_MS    (100)
+    #define DEFAULT_MIN_RECONNECT_DELAY (250)
+    #define DEFAULT_MAX_RECONNECT_DELAY (30000)
+    #define MAX_HEADER_SIZE             (64)
+    #define HEADER_MAGIC                (0x43325746)
+    #define HEADER_VERSION              (1)
+    #define HEADER_V1_SIZE              (40)
+    #define HEADER_FLAG_STREAM_ID       (0x0001)
+    #define MAX_FRAMES_IN_FLIGHT        (16)
+    #define COMPLETION_WAIT_MS          (100)
+    #define DISCONNECT_DRAIN_MS         (500)
+
+    #ifndef SO_ZEROCOPY
+        #define SO_ZEROCOPY             (60)
+    #endif
+    #ifndef MSG_ZEROCOPY
+        #define MSG_ZEROCOPY            (0x4000000)
+    #endif
+
+    // Frame being sent/kept till the kernel is done with its memory
+    struct InFlightFrame
+    {
+        shared_ptr<const XEncodedFrame> Frame;
+        uint8_t                         Header[MAX_HEADER_SIZE];
+        uint32_t                        HeaderSize;
+        bool                            HasNotification;
+        uint32_t                        LastNotification;
+    };
+
+    // Private details of the implementation
+    class XUplinkSenderData
+    {
+    private:
+        mutable mutex                     Sync;
+        condition_variable                QueueChanged;
+        deque<shared_ptr<const XEncodedFrame>> Queue;
+        thread                            SenderThread;
+        XManualResetEvent                 NeedToStop;
+        bool                              Running;
+        int                               Socket;
+        uint32_t                          ReconnectDelay;
+        bool                              ZeroCopyActive;
+        XUplinkProtocol                   ActiveProtocol;
+        deque<InFlightFrame>              InFlight;
+        uint32_t                          NextNotification;
+        uint32_t                          CompletedNotifications;
+
+        // metrics of the sink - registered when the sender starts, since its name is known by then
+        XMetricGauge*                     QueueDepthMetric;
+        XMetricHistogram*                 SendTimeMetric;
+        XMetricCounter*                   SentBytesMetric;
+        XMetricCounter*                   FramesSentMetric;
+        XMetricCounter*                   FramesDroppedMetric;
+        XMetricCounter*                   FramesFailedMetric;
+        XMetricHistogram*                 FrameLatencyMetric;
+
+    public:
+        string                            Name;
+        string                            Address;
+        uint16_t                          Port;
+        uint32_t                          QueueLength;
+        XUplinkDropPolicy                 DropPolicy;
+        uint32_t                          MinReconnectDelay;
+        uint32_t                          MaxReconnectDelay;
+        volatile bool                     ZeroCopyEnabled;
+        atomic<XUplinkProtocol>           Protocol;
+        atomic<uint32_t>                  StreamId;
+
+        atomic<XUplinkState>              State;
+        atomic<uint64_t>                  FramesSent;
+        atomic<uint64_t>                  FramesDropped;
+        atomic<uint64_t>                  FramesFailed;
+        atomic<uint64_t>                  ConnectFailures;
+
+    public:
+        XUplinkSenderData( const string& address, uint16_t port, uint32_t queueLength, XUplinkDropPolicy dropPolicy, XUplinkProtocol protocol ) :
+            Sync( ), QueueChanged( ), Queue( ), SenderThread( ), NeedToStop( ), Running( false ), Socket( -1 ),
+            ReconnectDelay( DEFAULT_MIN_RECONNECT_DELAY ), ZeroCopyActive( false ), ActiveProtocol( protocol ), InFlight( ), NextNotification( 0 ), CompletedNotifications( 0 ),
+            QueueDepthMetric( nullptr ), SendTimeMetric( nullptr ), SentBytesMetric( nullptr ),
+            FramesSentMetric( nullptr ), FramesDroppedMetric( nullptr ), FramesFailedMetric( nullptr ),
+            FrameLatencyMetric( nullptr ), Name( ), Address( address ), Port( port ), QueueLength( ( queueLength == 0 ) ? 1 : queueLength ), DropPolicy( dropPolicy ),
+            MinReconnectDelay( DEFAULT_MIN_RECONNECT_DELAY ), MaxReconnectDelay( DEFAULT_MAX_RECONNECT_DELAY ), ZeroCopyEnabled( false ),
+            Protocol( protocol ), StreamId( 0 ),
+            State( XUplinkState::Disconnected ), FramesSent( 0 ), FramesDropped( 0 ), FramesFailed( 0 ), ConnectFailures( 0 )
+        {
+            char strPort[16];
+
+            sprintf( strPort, ":%u", Port );
+            Name = Address + strPort;
+        }
+
+        bool Start( );
+        void SignalToStop( );
+        void WaitForStop( );
+        bool IsRunning( );
+
+        void Enqueue( const shared_ptr<const XEncodedFrame>& frame );
+        void SetName( const string& name );
+        void SetQueueLength( uint32_t queueLength );
+        void SetDropPolicy( XUplinkDropPolicy dropPolicy );
+        void SetReconnectDelay( uint32_t minDelay, uint32_t maxDelay );
+        uint32_t QueueDepth( ) const;
+        const XMetricHistogram* FrameLatency( ) const;
+
+    private:
+        static void SenderThreadHandler( XUplinkSenderData* me );
+
+        void RegisterMetrics( );
+        void DropFrame( );
+        bool WaitForFrames( );
+        shared_ptr<const XEncodedFrame> NextFrame( );
+        bool Connect( );
+        void Disconnect( );
+        void WaitToReconnect( );
+        uint32_t PrepareHeader( const shared_ptr<const XEncodedFrame>& frame, uint8_t* header );
+        bool SendFrame( const shared_ptr<const XEncodedFrame>& frame );
+        bool SendAll( struct iovec* iov, int iovCount, InFlightFrame* inFlight );
+        void ReadCompletions( uint32_t waitMsec );
+    };
+}
+
+XUplinkSender::XUplinkSender( const string& address, uint16_t port, uint32_t queueLength, XUplinkDropPolicy dropPolicy,
+                              XUplinkProtocol protocol ) :
+    mData( new Private::XUplinkSenderData( address, port, queueLength, dropPolicy, protocol ) )
+{
+}
+
+XUplinkSender::~XUplinkSender( )
+{
+    mData->WaitForStop( );
+    delete mData;
+}
+
+// Start the sender's thread
+bool XUplinkSender::Start( )
+{
+    return mData->Start( );
+}
+
+// Signal sender to stop
+void XUplinkSender::SignalToStop( )
+{
+    mData->SignalToStop( );
+}
+
+// Wait till the sender's thread stops
+void XUplinkSender::WaitForStop( )
+{
+    mData->WaitForStop( );
+}
+
+// Check if the sender is still running
+bool XUplinkSender::IsRunning( )
+{
+    return mData->IsRunning( );
+}
+
+// Put the specified frame into the sending queue
+void XUplinkSender::Enqueue( const shared_ptr<const XEncodedFrame>& frame )
+{
+    mData->Enqueue( frame );
+}
+
+// Get/Set name of the sink
+string XUplinkSender::Name( ) const
+{
+    return mData->Name;
+}
+void XUplinkSender::SetName( const string& name )
+{
+    mData->SetName( name );
+}
+
+// Address/port of the receiver
+string XUplinkSender::Address( ) const
+{
+    return mData->Address;
+}
+uint16_t XUplinkSender::Port( ) const
+{
+    return mData->Port;
+}
+
+// Get/Set maximum number of frames waiting to be sent
+uint32_t XUplinkSender::QueueLength( ) const
+{
+    return mData->QueueLength;
+}
+void XUplinkSender::SetQueueLength( uint32_t queueLength )
+{
+    mData->SetQueueLength( queueLength );
+}
+
+// Get/Set policy to use when the queue is full
+XUplinkDropPolicy XUplinkSender::DropPolicy( ) const
+{
+    return mData->DropPolicy;
+}
+void XUplinkSender::SetDropPolicy( XUplinkDropPolicy dropPolicy )
+{
+    mData->SetDropPolicy( dropPolicy );
+}
+
+// Get/Set initial and maximum delay between reconnection attempts
+uint32_t XUplinkSender::MinReconnectDelay( ) const
+{
+    return mData->MinReconnectDelay;
+}
+uint32_t XUplinkSender::MaxReconnectDelay( ) const
+{
+    return mData->MaxReconnectDelay;
+}
+void XUplinkSender::SetReconnectDelay( uint32_t minDelay, uint32_t maxDelay )
+{
+    mData->SetReconnectDelay( minDelay, maxDelay );
+}
+
+// Get/Set format of the data sent to the receiver
+XUplinkProtocol XUplinkSender::Protocol( ) const
+{
+    return mData->Protocol;
+}
+void XUplinkSender::SetProtocol( XUplinkProtocol protocol )
+{
+    mData->Protocol = protocol;
+}
+
+// Get/Set stream id sent with every frame
+uint32_t XUplinkSender::StreamId( ) const
+{
+    return mData->StreamId;
+}
+void XUplinkSender::SetStreamId( uint32_t streamId )
+{
+    mData->StreamId = streamId;
+}
+
+// Enable/disable sending frames with MSG_ZEROCOPY
+bool XUplinkSender::IsZeroCopyEnabled( ) const
+{
+    return mData->ZeroCopyEnabled;
+}
+void XUplinkSender::EnableZeroCopy( bool enable )
+{
+    mData->ZeroCopyEnabled = enable;
+}
+
+// Current state of the connection to the receiver
+XUplinkState XUplinkSender::State( ) const
+{
+    return mData->State;
+}
+
+// Number of frames currently waiting in the queue
+uint32_t XUplinkSender::QueueDepth( ) const
+{
+    return mData->QueueDepth( );
+}
+
+// Number of frames sent to the receiver
+uint64_t XUplinkSender::FramesSent( ) const
+{
+    return mData->FramesSent;
+}
+
+// Number of frames discarded because the queue was full
+uint64_t XUplinkSender::FramesDropped( ) const
+{
+    return mData->FramesDropped;
+}
+
+// Number of frames lost because of connection/sending errors
+uint64_t XUplinkSender::FramesFailed( ) const
+{
+    return mData->FramesFailed;
+}
+
+// Number of failed connection attempts
+uint64_t XUplinkSender::ConnectFailures( ) const
+{
+    return mData->ConnectFailures;
+}
+
+// Latency of frames sent to the receiver
+const XMetricHistogram* XUplinkSender::FrameLatency( ) const
+{
+    return mData->FrameLatency( );
+}
+
+namespace Private
+{
+
+// Start the sender's background thread
+bool XUplinkSenderData::Start( )
+{
+    lock_guard<mutex> lock( Sync );
+
+    if ( !Running )
+    {
+        if ( SenderThread.joinable( ) )
+        {
+            SenderThread.join( );
+        }
+
+        NeedToStop.Reset( );
+        Running        = true;
+        ReconnectDelay = MinReconnectDelay;
+
+        RegisterMetrics( );
+
+        SenderThread = thread( SenderThreadHandler, this );
+    }
+
+    return true;
+}
+
+// Signal the sender's thread to stop
+void XUplinkSenderData::SignalToStop( )
+{
+    lock_guard<mutex> lock( Sync );
+
+    NeedToStop.Signal( );
+    QueueChanged.notify_all( );
+}
+
+// Wait till the sender's thread stops
+void XUplinkSenderData::WaitForStop( )
+{
+    SignalToStop( );
+
+    if ( SenderThread.joinable( ) )
+    {
+        SenderThread.join( );
+    }
+}
+
+// Check if the sender's thread is still running
+bool XUplinkSenderData::IsRunning( )
+{
+    lock_guard<mutex> lock( Sync );
+    return Running;
+}
+
+// Put new frame into the queue, dropping something if it is full
+void XUplinkSenderData::Enqueue( const shared_ptr<const XEncodedFrame>& frame )
+{
+    lock_guard<mutex> lock( Sync );
+
+    if ( ( Queue.size( ) >= QueueLength ) && ( DropPolicy == XUplinkDropPolicy::DropNewest ) )
+    {
+        DropFrame( );
+        return;
+    }
+
+    while ( Queue.size( ) >= QueueLength )
+    {
+        Queue.pop_front( );
+        DropFrame( );
+    }
+
+    Queue.push_back( frame );
+    QueueChanged.notify_one( );
+
+    if ( QueueDepthMetric != nullptr )
+    {
+        QueueDepthMetric->Set( static_cast<int64_t>( Queue.size( ) ) );
+    }
+}
+
+// Count frame discarded because the queue is full (must be called with the queue locked)
+void XUplinkSenderData::DropFrame( )
+{
+    FramesDropped++;
+
+    if ( FramesDroppedMetric != nullptr )
+    {
+        FramesDroppedMetric->Increment( );
+    }
+}
+
+// Register metrics of the sink labelled with its name (must be called with the queue locked)
+void XUplinkSenderData::RegisterMetrics( )
+{
+    XMetricsRegistry& metrics = XMetricsRegistry::Instance( );
+    string            label   = XMetricsRegistry::Label( "uplink", Name );
+
+    QueueDepthMetric    = &metrics.Gauge( "cam2web_uplink_queue_depth", "Frames waiting to be sent to the uplink sink.", label );
+    SendTimeMetric      = &metrics.Histogram( "cam2web_uplink_send_seconds", "Time to send a frame to the uplink sink.",
+                                              XMetricsRegistry::TimeBuckets( ), 1e-6, label );
+    SentBytesMetric     = &metrics.Counter( "cam2web_uplink_sent_bytes_total", "Bytes sent to the uplink sink.", label );
+    FramesSentMetric    = &metrics.Counter( "cam2web_uplink_frames_sent_total", "Frames sent to the uplink sink.", label );
+    FramesDroppedMetric = &metrics.Counter( "cam2web_uplink_frames_dropped_total", "Frames discarded because the uplink queue was full.", label );
+    FramesFailedMetric  = &metrics.Counter( "cam2web_uplink_frames_failed_total", "Frames lost because of uplink connection errors.", label );
+    FrameLatencyMetric  = &metrics.Histogram( "cam2web_frame_latency_seconds", "Time from capture of a frame till its last byte was sent to the consumer.",
+                                              XMetricsRegistry::LatencyBuckets( ), 1e-6, label );
+}
+
+// Set name of the sink - the sender's thread uses it without locking, so it is not changed while running
+void XUplinkSenderData::SetName( const string& name )
+{
+    lock_guard<mutex> lock( Sync );
+
+    if ( !Running )
+    {
+        Name = name;
+    }
+}
+
+// Set maximum number of frames waiting to be sent
+void XUplinkSenderData::SetQueueLength( uint32_t queueLength )
+{
+    lock_guard<mutex> lock( Sync );
+    QueueLength = ( queueLength == 0 ) ? 1 : queueLength;
+}
+
+// Set policy to use when the queue is full
+void XUplinkSenderData::SetDropPolicy( XUplinkDropPolicy dropPolicy )
+{
+    lock_guard<mutex> lock( Sync );
+    DropPolicy = dropPolicy;
+}
+
+// Set initial and maximum delay between reconnection attempts
+void XUplinkSenderData::SetReconnectDelay( uint32_t minDelay, uint32_t maxDelay )
+{
+    lock_guard<mutex> lock( Sync );
+
+    MinReconnectDelay = ( minDelay == 0 ) ? 1 : minDelay;
+    MaxReconnectDelay = ( maxDelay < MinReconnectDelay ) ? MinReconnectDelay : maxDelay;
+}
+
+// Get number of frames waiting in the queue
+uint32_t XUplinkSenderData::QueueDepth( ) const
+{
+    lock_guard<mutex> lock( Sync );
+    return static_cast<uint32_t>( Queue.size( ) );
+}
+
+// Latency of frames sent to the receiver (metrics are registered on start, under the same lock)
+const XMetricHistogram* XUplinkSenderData::FrameLatency( ) const
+{
+    lock_guard<mutex> lock( Sync );
+    return FrameLatencyMetric;
+}
+
+// Wait till there is something in the queue - returns false if the sender needs to stop
+bool XUplinkSenderData::WaitForFrames( )
+{
+    unique_lock<mutex> lock( Sync );
+
+    while ( ( !NeedToStop.IsSignaled( ) ) && ( Queue.empty( ) ) )
+    {
+        QueueChanged.wait( lock );
+    }
+
+    return !NeedToStop.IsSignaled( );
+}
+
+// Take next frame from the queue
+shared_ptr<const XEncodedFrame> XUplinkSenderData::NextFrame( )
+{
+    lock_guard<mutex>               lock( Sync );
+    shared_ptr<const XEncodedFrame> frame;
+
+    if ( !Queue.empty( ) )
+    {
+        frame = Queue.front( );
+        Queue.pop_front( );
+        QueueDepthMetric->Set( static_cast<int64_t>( Queue.size( ) ) );
+    }
+
+    return frame;
+}
+
+// Connect to the receiver. Connection is done in non-blocking mode, so that it
+// could be interrupted when the sender is asked to stop.
+bool XUplinkSenderData::Connect( )
+{
+    struct addrinfo  hints;
+    struct addrinfo* addresses = nullptr;
+    char             strPort[16];
+    bool             connected = false;
+
+    memset( &hints, 0, sizeof( hints ) );
+    hints.ai_family   = AF_INET;
+    hints.ai_socktype = SOCK_STREAM;
+
+    sprintf( strPort, "%u", Port );
+
+    if ( getaddrinfo( Address.c_str( ), strPort, &hints, &addresses ) != 0 )
+    {
+        XLOG_WARNING_LIMITED( 10000, "Uplink [%s] - failed resolving address %s", Name.c_str( ), Address.c_str( ) );
+        return false;
+    }
+
+    Socket = socket( AF_INET, SOCK_STREAM, 0 );
+
+    if ( Socket == -1 )
+    {
+        XLOG_ERROR_LIMITED( 10000, "Uplink [%s] - failed to create socket", Name.c_str( ) );
+    }
+    else
+    {
+        int flags = fcntl( Socket, F_GETFL, 0 );
+
+        fcntl( Socket, F_SETFL, flags | O_NONBLOCK );
+
+        if ( connect( Socket, addresses->ai_addr, addresses->ai_addrlen ) == 0 )
+        {
+            connected = true;
+        }
+        else if ( errno == EINPROGRESS )
+        {
+            steady_clock::time_point giveUpTime = steady_clock::now( ) + milliseconds( CONNECT_TIMEOUT_MS );
+
+            while ( ( !NeedToStop.IsSignaled( ) ) && ( steady_clock::now( ) < giveUpTime ) )
+            {
+                struct pollfd pollData = { Socket, POLLOUT, 0 };
+                int           ready    = poll( &pollData, 1, CONNECT_POLL_INTERVAL_MS );
+
+                if ( ready > 0 )
+                {
+                    int       error    = 0;
+                    socklen_t errorLen = sizeof( error );
+
+                    getsockopt( Socket, SOL_SOCKET, SO_ERROR, &error, &errorLen );
+                    connected = ( error == 0 );
+                    break;
+                }
+                else if ( ( ready < 0 ) && ( errno != EINTR ) )
+                {
+                    break;
+                }
+            }
+        }
+
+        if ( connected )
+        {
+            struct timeval timeout = { SEND_TIMEOUT_SEC, 0 };
+            int            optval  = 1;
+
+            // frames are sent in blocking mode, but don't let a stuck receiver block the sender forever
+            fcntl( Socket, F_SETFL, flags );
+            setsockopt( Socket, SOL_SOCKET, SO_SNDTIMEO, &timeout, sizeof( timeout ) );
+
+            if ( setsockopt( Socket, IPPROTO_TCP, TCP_NODELAY, &optval, sizeof( int ) ) < 0 )
+            {
+                XLOG_WARNING( "Uplink [%s] - cannot set TCP_NODELAY option", Name.c_str( ) );
+            }
+
+            // protocol can not change in the middle of a connection
+            ActiveProtocol = Protocol;
+            ZeroCopyActive = false;
+
+            if ( ZeroCopyEnabled )
+            {
+                if ( setsockopt( Socket, SOL_SOCKET, SO_ZEROCOPY, &optval, sizeof( int ) ) == 0 )
+                {
+                    ZeroCopyActive = true;
+                }
+                else
+                {
+                    XLOG_INFO( "Uplink [%s] - zero copy is not supported, using normal send", Name.c_str( ) );
+                }
+            }
+        }
+        else
+        {
+            Disconnect( );
+        }
+    }
+
+    freeaddrinfo( addresses );
+
+    return connected;
+}
+
+// Close connection to the receiver
+void XUplinkSenderData::Disconnect( )
+{
+    if ( Socket != -1 )
+    {
+        steady_clock::time_point drainEnd = steady_clock::now( ) + milliseconds( DISCONNECT_DRAIN_MS );
+
+        // zero copy frames can still be sent from socket's queue even after it is closed gracefully,
+        // so give the kernel some time to complete them
+        ReadCompletions( 0 );
+        while ( ( !InFlight.empty( ) ) && ( steady_clock::now( ) < drainEnd ) )
+        {
+            ReadCompletions( COMPLETION_WAIT_MS );
+        }
+
+        // if some frames are still in use, abort the connection so the send queue is discarded
+        // and nothing is sent any more from frames' memory after they are released
+        if ( !InFlight.empty( ) )
+        {
+            struct linger lingerOption = { 1, 0 };
+
+            XLOG_WARNING( "Uplink [%s] - aborting connection with %u frames still being sent", Name.c_str( ),
+                          static_cast<uint32_t>( InFlight.size( ) ) );
+            setsockopt( Socket, SOL_SOCKET, SO_LINGER, &lingerOption, sizeof( lingerOption ) );
+        }
+
+        close( Socket );
+        Socket = -1;
+    }
+
+    InFlight.clear( );
+    NextNotification       = 0;
+    CompletedNotifications = 0;
+}
+
+// Wait for the current back-off delay and increase it for the next attempt
+void XUplinkSenderData::WaitToReconnect( )
+{
+    State = XUplinkState::WaitingToReconnect;
+
+    NeedToStop.Wait( ReconnectDelay );
+
+    ReconnectDelay = ( ReconnectDelay >= MaxReconnectDelay / 2 ) ? MaxReconnectDelay : ReconnectDelay * 2;
+    State          = XUplinkState::Disconnected;
+}
+
+// Put header of the specified frame into the buffer and return its size
+uint32_t XUplinkSenderData::PrepareHeader( const shared_ptr<const XEncodedFrame>& frame, uint8_t* header )
+{
+    uint32_t headerSize;
+
+    if ( ActiveProtocol == XUplinkProtocol::Legacy )
+    {
+        uint32_t imgSize = frame->Size( );
+
+        memcpy( header, &imgSize, sizeof( imgSize ) );
+        headerSize = sizeof( imgSize );
+    }
+    else
+    {
+        uint32_t magic     = htobe32( HEADER_MAGIC );
+        uint16_t flags     = htobe16( ( StreamId != 0 ) ? HEADER_FLAG_STREAM_ID : 0 );
+        uint32_t imgSize   = htobe32( frame->Size( ) );
+        uint64_t sequence  = htobe64( frame->Sequence( ) );
+        uint64_t timestamp = htobe64( frame->Timestamp( ) );
+        uint16_t width     = htobe16( static_cast<uint16_t>( frame->Width( ) ) );
+        uint16_t height    = htobe16( static_cast<uint16_t>( frame->Height( ) ) );
+        uint32_t streamId  = htobe32( StreamId );
+
+        memcpy( header,      &magic, 4 );
+        header[4] = HEADER_VERSION;
+        header[5] = HEADER_V1_SIZE;
+        memcpy( header +  6, &flags, 2 );
+        memcpy( header +  8, &imgSize, 4 );
+        memcpy( header + 12, &sequence, 8 );
+        memcpy( header + 20, &timestamp, 8 );
+        memcpy( header + 28, "MJPG", 4 );
+        memcpy( header + 32, &width, 2 );
+        memcpy( header + 34, &height, 2 );
+        memcpy( header + 36, &streamId, 4 );
+
+        headerSize = HEADER_V1_SIZE;
+    }
+
+    return headerSize;
+}
+
+// Send the specified frame prefixed with its header - both go out with a single system call
+bool XUplinkSenderData::SendFrame( const shared_ptr<const XEncodedFrame>& frame )
+{
+    InFlightFrame  localFrame;
+    InFlightFrame* toSend   = &localFrame;
+    uint32_t       imgSize  = frame->Size( );
+    bool           ret;
+
+    if ( ZeroCopyActive )
+    {
+        // don't let too many frames wait for the kernel to release them
+        ReadCompletions( 0 );
+        while ( ( InFlight.size( ) >= MAX_FRAMES_IN_FLIGHT ) && ( !NeedToStop.IsSignaled( ) ) )
+        {
+            ReadCompletions( COMPLETION_WAIT_MS );
+        }
+
+        InFlight.push_back( InFlightFrame( ) );
+        toSend = &InFlight.back( );
+    }
+
+    toSend->Frame           = frame;
+    toSend->HasNotification = false;
+    toSend->HeaderSize      = PrepareHeader( frame, toSend->Header );
+
+    struct iovec iov[2] =
+    {
+        { toSend->Header, toSend->HeaderSize },
+        { const_cast<uint8_t*>( frame->Data( ) ), imgSize }
+    };
+
+    ret = SendAll( iov, 2, toSend );
+
+    if ( ZeroCopyActive )
+    {
+        ReadCompletions( 0 );
+    }
+
+    return ret;
+}
+
+// Send all the specified buffers, continuing after short writes
+bool XUplinkSenderData::SendAll( struct iovec* iov, int iovCount, InFlightFrame* inFlight )
+{
+    struct msghdr message;
+
+    memset( &message, 0, sizeof( message ) );
+
+    while ( iovCount > 0 )
+    {
+        int     flags = MSG_NOSIGNAL | ( ( ZeroCopyActive ) ? MSG_ZEROCOPY : 0 );
+        ssize_t sent;
+
+        message.msg_iov    = iov;
+        message.msg_iovlen = iovCount;
+
+        sent = sendmsg( Socket, &message, flags );
+
+        if ( ( sent < 0 ) && ( errno == ENOBUFS ) && ( ZeroCopyActive ) )
+        {
+            // out of memory for pinning pages - send this part with normal copy
+            flags &= ~MSG_ZEROCOPY;
+            sent   = sendmsg( Socket, &message, flags );
+        }
+
+        if ( sent < 0 )
+        {
+            if ( errno == EINTR )
+            {
+                continue;
+            }
+            return false;
+        }
+
+        SentBytesMetric->Increment( static_cast<uint64_t>( sent ) );
+
+        // every successful zero copy call gets its own completion notification
+        if ( flags & MSG_ZEROCOPY )
+        {
+            inFlight->HasNotification  = true;
+            inFlight->LastNotification = NextNotification++;
+        }
+
+        while ( ( iovCount > 0 ) && ( static_cast<size_t>( sent ) >= iov->iov_len ) )
+        {
+            sent -= iov->iov_len;
+            iov++;
+            iovCount--;
+        }
+
+        if ( iovCount > 0 )
+        {
+            iov->iov_base = static_cast<uint8_t*>( iov->iov_base ) + sent;
+            iov->iov_len -= sent;
+        }
+    }
+
+    return true;
+}
+
+// Read zero copy completion notifications and release frames the kernel no longer needs
+void XUplinkSenderData::ReadCompletions( uint32_t waitMsec )
+{
+    if ( waitMsec != 0 )
+    {
+        struct pollfd pollData = { Socket, 0, 0 };
+
+        // POLLERR is always reported, no need to ask for it
+        poll( &pollData, 1, waitMsec );
+    }
+
+    for ( ; ; )
+    {
+        struct msghdr   message;
+        uint8_t         control[128];
+        struct cmsghdr* cmsg;
+
+        memset( &message, 0, sizeof( message ) );
+        message.msg_control    = control;
+        message.msg_controllen = sizeof( control );
+
+        if ( recvmsg( Socket, &message, MSG_ERRQUEUE | MSG_DONTWAIT ) < 0 )
+        {
+            break;
+        }
+
+        for ( cmsg = CMSG_FIRSTHDR( &message ); cmsg != nullptr; cmsg = CMSG_NXTHDR( &message, cmsg ) )
+        {
+            if ( ( ( cmsg->cmsg_level == SOL_IP ) && ( cmsg->cmsg_type == IP_RECVERR ) ) ||
+                 ( ( cmsg->cmsg_level == SOL_IPV6 ) && ( cmsg->cmsg_type == IPV6_RECVERR ) ) )
+            {
+                struct sock_extended_err* error = reinterpret_cast<struct sock_extended_err*>( CMSG_DATA( cmsg ) );
+
+                // TCP completes notifications in order, so [ee_info, ee_data] range
+                // means everything up to ee_data is done
+                if ( ( error->ee_errno == 0 ) && ( error->ee_origin == SO_EE_ORIGIN_ZEROCOPY ) )
+                {
+                    CompletedNotifications = error->ee_data + 1;
+                }
+            }
+        }
+    }
+
+    while ( ( !InFlight.empty( ) ) &&
+            ( ( !InFlight.front( ).HasNotification ) ||
+              ( static_cast<int32_t>( CompletedNotifications - InFlight.front( ).LastNotification ) > 0 ) ) )
+    {
+        InFlight.pop_front( );
+    }
+}
+
+// Background thread connecting to the receiver and sending queued frames. Frames stay
+// in the (bounded) queue while waiting to reconnect, so the drop policy still applies.
+void XUplinkSenderData::SenderThreadHandler( XUplinkSenderData* me )
+{
+    // don't bother connecting until there is something to send
+    while ( me->WaitForFrames( ) )
+    {
+        if ( me->State != XUplinkState::Connected )
+        {
+            me->State = XUplinkState::Connecting;
+
+            if ( me->Connect( ) )
+            {
+                XLOG_INFO( "Uplink [%s] - connected", me->Name.c_str( ) );
+                me->State          = XUplinkState::Connected;
+                me->ReconnectDelay = me->MinReconnectDelay;
+            }
+            else if ( !me->NeedToStop.IsSignaled( ) )
+            {
+                XLOG_WARNING_LIMITED( 10000, "Uplink [%s] - failed connecting, retrying in %u ms", me->Name.c_str( ), me->ReconnectDelay );
+                me->ConnectFailures++;
+                me->WaitToReconnect( );
+            }
+        }
+        else
+        {
+            shared_ptr<const XEncodedFrame> frame = me->NextFrame( );
+
+            if ( !frame )
+            {
+                continue;
+            }
+
+            steady_clock::time_point sendStart = steady_clock::now( );
+
+            if ( me->SendFrame( frame ) )
+            {
+                me->FramesSent++;
+                me->FramesSentMetric->Increment( );
+                me->SendTimeMetric->Observe( static_cast<uint64_t>( duration_cast<microseconds>( steady_clock::now( ) - sendStart ).count( ) ) );
+                me->FrameLatencyMetric->Observe( frame->Age( ) );
+            }
+            else
+            {
+                XLOG_WARNING_LIMITED( 1000, "Uplink [%s] - failed sending frame, error code %d", me->Name.c_str( ), errno );
+                me->FramesFailed++;
+                me->FramesFailedMetric->Increment( );
+                me->Disconnect( );
+                me->WaitToReconnect( );
+            }
+        }
+    }
+
+    me->Disconnect( );
+    me->State = XUplinkState::Disconnected;
+
+    {
+        lock_guard<mutex> lock( me->Sync );
+        me->Queue.clear( );
+        me->QueueDepthMetric->Set( 0 );
+        me->Running = false;
+    }
+}
+
+} // namespace Private
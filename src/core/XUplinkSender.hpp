@@ -0,0 +1,153 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef XUPLINK_SENDER_HPP
+#define XUPLINK_SENDER_HPP
+
+#include <stdint.h>
+#include <string>
+#include <memory>
+
+#include "XInterfaces.hpp"
+#include "XEncodedFrame.hpp"
+
+class XMetricHistogram;
+
+namespace Private
+{
+    class XUplinkSenderData;
+}
+
+// What to do with a new frame when the uplink queue is full
+enum class XUplinkDropPolicy
+{
+    DropOldest = 0,     // discard the oldest queued frame to make room for the new one
+    DropNewest          // discard the new frame, keeping what is already queued
+};
+
+// Format of the data sent to the receiver
+//
+// Legacy   - 4 bytes JPEG size (host byte order), followed by JPEG data.
+// Version1 - 40 bytes header followed by JPEG data. All header fields are in network byte order:
+//     0: magic 'C2WF' (0x43325746)    4: version (1), 1 byte      5: header size (40), 1 byte
+//     6: flags, 16 bit (bit 0 - stream id is set)                 8: payload size, 32 bit
+//    12: frame sequence number, 64 bit                           20: capture time, microseconds since epoch, 64 bit
+//    28: payload's pixel format as FourCC characters ('MJPG')    32: width, 16 bit    34: height, 16 bit
+//    36: stream id, 32 bit (0 if not set)
+// Receivers should use header size field to skip any fields added by later versions.
+enum class XUplinkProtocol
+{
+    Legacy = 0,
+    Version1
+};
+
+// State of the connection to the receiver
+enum class XUplinkState
+{
+    Disconnected = 0,   // not connected, will connect as soon as there is a frame to send
+    Connecting,         // connection is in progress
+    Connected,          // connected and sending frames
+    WaitingToReconnect  // last attempt failed, waiting for the back-off delay to expire
+};
+
+// Class which sends encoded frames to a TCP receiver (sink) from its own background thread.
+// Frames are put into a bounded queue, so the caller (video source thread) never waits
+// for the network. Every sender has its own connection, queue and thread, so a dead or
+// slow receiver does not affect any other sender.
+class XUplinkSender : private Uncopyable
+{
+public:
+    XUplinkSender( const std::string& address, uint16_t port, uint32_t queueLength = 8,
+                   XUplinkDropPolicy dropPolicy = XUplinkDropPolicy::DropOldest,
+                   XUplinkProtocol protocol = XUplinkProtocol::Version1 );
+    ~XUplinkSender( );
+
+    // Start the sender's thread
+    bool Start( );
+    // Signal sender to stop, so it could finalize and clean-up
+    void SignalToStop( );
+    // Wait till the sender's thread stops
+    void WaitForStop( );
+    // Check if the sender is still running
+    bool IsRunning( );
+
+    // Put the specified frame into the sending queue (never blocks)
+    void Enqueue( const std::shared_ptr<const XEncodedFrame>& frame );
+
+    // Get/Set name of the sink, which is used in log messages (can be changed only when the sender is not running)
+    std::string Name( ) const;
+    void SetName( const std::string& name );
+
+    // Address/port of the receiver
+    std::string Address( ) const;
+    uint16_t Port( ) const;
+
+    // Get/Set maximum number of frames waiting to be sent
+    uint32_t QueueLength( ) const;
+    void SetQueueLength( uint32_t queueLength );
+
+    // Get/Set policy to use when the queue is full
+    XUplinkDropPolicy DropPolicy( ) const;
+    void SetDropPolicy( XUplinkDropPolicy dropPolicy );
+
+    // Get/Set initial and maximum delay (milliseconds) between reconnection attempts.
+    // The delay doubles after every failed attempt and resets once connected.
+    uint32_t MinReconnectDelay( ) const;
+    uint32_t MaxReconnectDelay( ) const;
+    void SetReconnectDelay( uint32_t minDelay, uint32_t maxDelay );
+
+    // Get/Set format of the data sent to the receiver (takes effect on the next connection)
+    XUplinkProtocol Protocol( ) const;
+    void SetProtocol( XUplinkProtocol protocol );
+
+    // Get/Set stream id sent with every frame, which allows receivers to tell cameras
+    // apart when several of them share connection/port (0 - not set)
+    uint32_t StreamId( ) const;
+    void SetStreamId( uint32_t streamId );
+
+    // Enable/disable sending frames with MSG_ZEROCOPY (Linux 4.14+). In this mode the kernel
+    // sends directly from the frame's memory, so the frame is kept alive till the kernel
+    // reports completion. Falls back to normal sending if not supported by the system.
+    // Takes effect on the next connection.
+    bool IsZeroCopyEnabled( ) const;
+    void EnableZeroCopy( bool enable );
+
+    // Current state of the connection to the receiver
+    XUplinkState State( ) const;
+
+    // Number of frames currently waiting in the queue
+    uint32_t QueueDepth( ) const;
+    // Number of frames sent to the receiver
+    uint64_t FramesSent( ) const;
+    // Number of frames discarded because the queue was full
+    uint64_t FramesDropped( ) const;
+    // Number of frames lost because of connection/sending errors
+    uint64_t FramesFailed( ) const;
+    // Number of failed connection attempts
+    uint64_t ConnectFailures( ) const;
+    // Latency of frames sent to the receiver - time from capture till the frame was handed to the system
+    // for sending, microseconds (also provided as metric). Null till the sender is started for the first time.
+    const XMetricHistogram* FrameLatency( ) const;
+
+private:
+    Private::XUplinkSenderData* mData;
+};
+
+#endif // XUPLINK_SENDER_HPP
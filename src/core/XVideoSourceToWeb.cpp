@@ -3,36 +3,55 @@
 #include <stdlib.h>
 #include <unistd.h>
 #include <mutex>
+#include <atomic>
 #include <chrono>
-#include <iostream>
-#include <fstream>
 #include <string>
-
-#include <sys/types.h>
-#include <sys/socket.h>
-#include <netinet/in.h>
-#include <netdb.h>
-#include <fcntl.h>
-#include <netinet/tcp.h>
-
-// If we have C++14, then shared_timed_mutex is a better option for BufferGuard,
-// so it could allow one writer and multiple readers. However mongoose web server
-// is single threaded anyway, so we'll live with normal mutex for now.
-// shared_lock<shared_timed_mutex> for readers and
-// unique_lock<shared_timed_mutex> for writer
-// #include <shared_mutex>
+#include <vector>
+#include <deque>
+#include <algorithm>
 
 #include "XVideoSourceToWeb.hpp"
 #include "XJpegEncoder.hpp"
+#include "XJpegDecoder.hpp"
+#include "XEncodedFrame.hpp"
+#include "XImagePool.hpp"
+#include "XUplinkSender.hpp"
+#include "XMetrics.hpp"
+#include "XStringTools.hpp"
+#include "XLog.hpp"
 
 using namespace std;
 using namespace std::chrono;
 
-int file_name = 0;
-
 namespace Private
 {
 #define JPEG_BUFFER_SIZE (1024 * 1024)
+// interval to check for video source errors while clients wait for frames, ms
+#define ERROR_CHECK_INTERVAL (1000)
+// maximum time a JPEG request waits for a frame newer than the one the client has, ms
+#define LONG_POLL_TIMEOUT (10000)
+// default JPEG quality of reduced frames
+#define DEFAULT_REDUCED_QUALITY (50)
+// reduced frames are half the size of full frames
+#define REDUCED_SCALE_DOWN (2)
+// reduced frames are encoded while some client asked for them within this time, ms
+#define REDUCED_DEMAND_TIMEOUT (1000)
+
+// Flow control of MJPEG clients:
+// maximum time a client may need to receive the data queued for it (including the frame to send), ms
+#define MAX_CLIENT_LAG (300)
+// time without congestion after which a client on reduced quality tries full quality again - initial and maximum, ms
+#define MIN_UPGRADE_DELAY (2000)
+#define MAX_UPGRADE_DELAY (32000)
+// maximum interval between frames a client is slowed down to, ms
+#define MAX_ADAPTIVE_INTERVAL (2000)
+// minimum time to measure client's receive rate over - sockets are drained in bursts, ms
+#define DRAIN_RATE_WINDOW (250)
+
+// size of the header describing a frame, which precedes its JPEG data in WebSocket messages
+#define WS_FRAME_HEADER_SIZE (24)
+// version of the header
+#define WS_FRAME_HEADER_VERSION (1)
 
 // Listener for video source events
 class VideoListener : public IVideoSourceListener
@@ -45,78 +64,293 @@ class VideoListener : public IVideoSourceListener
     void OnError(const string &errorMessage, bool fatal);
 };
 
-// Web request handler providing camera images as JPEGs
-class JpegRequestHandler : public IWebRequestHandler
+// State of a client, which is counted by the gauge of its handler till the client's connection closes
+class CountedClientData : public IWebClientData
+{
+  private:
+    XMetricGauge *ActiveClients;
+  public:
+    CountedClientData(XMetricGauge *activeClients) : ActiveClients(activeClients)
+    {
+        ActiveClients->Add(1);
+    }
+    ~CountedClientData()
+    {
+        ActiveClients->Add(-1);
+    }
+};
+
+// State of a client receiving stream of frames. Statistics are guarded, since they are read by other threads.
+class StreamClientData : public CountedClientData
+{
+  public:
+    mutex StatsGuard;
+    XStreamClientStats Stats;
+
+  public:
+    StreamClientData(uint32_t id, XMetricGauge *activeClients) : CountedClientData(activeClients), StatsGuard(), Stats()
+    {
+        Stats.Id = id;
+        Stats.Quality = XStreamQuality::Full;
+    }
+
+    XStreamClientStats GetStats()
+    {
+        lock_guard<mutex> lock(StatsGuard);
+        return Stats;
+    }
+};
+
+// Web request handler, which gets notified about every published frame, since its clients wait for them
+class StreamRequestHandler : public IWebRequestHandler
+{
+  private:
+    mutex ClientsGuard;
+    vector<weak_ptr<StreamClientData>> Clients;
+    XMetricHistogram *FrameLatency;
+    XMetricHistogram *SendDelay;
+  protected:
+    XMetricGauge *ActiveClients;
+    XMetricCounter *FramesDropped;
+  public:
+    StreamRequestHandler(const string &uri) : IWebRequestHandler(uri, false), ClientsGuard(), Clients()
+    {
+        XMetricsRegistry &metrics = XMetricsRegistry::Instance();
+        string label = XMetricsRegistry::Label("endpoint", uri);
+
+        ActiveClients = &metrics.Gauge("cam2web_stream_clients", "Clients receiving frames from the endpoint (waiting for a new one, for JPEG endpoint).", label);
+        FramesDropped = &metrics.Counter("cam2web_stream_frames_dropped_total", "Frames skipped for clients of the endpoint, which could not keep up.", label);
+        FrameLatency = &metrics.Histogram("cam2web_frame_latency_seconds", "Time from capture of a frame till its last byte was sent to the consumer.",
+                                          XMetricsRegistry::LatencyBuckets(), 1e-6, label);
+        SendDelay = &metrics.Histogram("cam2web_frame_send_delay_seconds", "Time from publishing a frame till its last byte was sent to the consumer.",
+                                       XMetricsRegistry::LatencyBuckets(), 1e-6, label);
+    }
+    void HandleSharedSent(const shared_ptr<const void> &owner);
+    void CollectStats(vector<XStreamClientStats> &stats);
+    void CollectLatency(vector<XFrameLatencyStats> &latencies);
+  protected:
+    void AddClient(const shared_ptr<StreamClientData> &client);
+};
+
+// State of a client waiting for a frame newer than the one it already has
+class JpegClientData : public CountedClientData
+{
+  public:
+    uint64_t After;
+    steady_clock::time_point Deadline;
+
+  public:
+    JpegClientData(uint64_t after, steady_clock::time_point deadline, XMetricGauge *activeClients) :
+        CountedClientData(activeClients), After(after), Deadline(deadline)
+    {
+    }
+};
+
+// Web request handler providing camera images as JPEGs. If the request specifies sequence number of the
+// frame the client already has (the "after" variable), it is held till a newer frame gets published or
+// till it times out (long polling), so clients get every new frame as soon as possible without polling.
+class JpegRequestHandler : public StreamRequestHandler
+{
+  private:
+    XVideoSourceToWebData *Owner;
+  public:
+    JpegRequestHandler(const string &uri, XVideoSourceToWebData *owner) : StreamRequestHandler(uri), Owner(owner)
+    {
+    }
+    void HandleHttpRequest(const IWebRequest &request, IWebResponse &response);
+    void HandleNotification(IWebResponse &response);
+    void HandleTimer(IWebResponse &response);
+  private:
+    void SendFrame(IWebResponse &response, const shared_ptr<const XEncodedFrame> &frame);
+    void StopWaiting(IWebResponse &response);
+};
+
+// State of a client receiving MJPEG stream - its flow controller and statistics. Everything is updated
+// by the web server thread serving the client.
+class MjpegClientData : public StreamClientData
+{
+  public:
+    uint64_t LastSequence;
+    steady_clock::time_point NextFrameTime;
+
+    // flow control
+    steady_clock::time_point MeasureStartTime;
+    steady_clock::time_point LastCongestionTime;
+    steady_clock::time_point LastUpgradeTime;
+    microseconds AdaptiveInterval;
+    milliseconds UpgradeDelay;
+    uint32_t MeasureStartBacklog;
+    uint32_t BytesQueued; // since the start of measurement
+    double DrainRate;     // bytes per second
+
+  public:
+    MjpegClientData(uint32_t id, XMetricGauge *activeClients) : StreamClientData(id, activeClients), LastSequence(0), NextFrameTime(),
+                                   MeasureStartTime(), LastCongestionTime(), LastUpgradeTime(),
+                                   AdaptiveInterval(0), UpgradeDelay(MIN_UPGRADE_DELAY),
+                                   MeasureStartBacklog(0), BytesQueued(0), DrainRate(0)
+    {
+    }
+
+    void UpdateDrainRate(steady_clock::time_point now, uint32_t backlog);
+    bool IsCongested(uint32_t backlog, uint32_t frameSize);
+    bool IsNearlyCongested(uint32_t backlog, uint32_t frameSize);
+};
+
+// Web request handler providing camera images as MJPEG stream. New frames are pushed to all
+// clients as soon as they are published, optionally limiting the rate for each client.
+// Clients slower than the video source are handled by their flow controller, which estimates how fast a client
+// receives data. When queued data would take too long to deliver, the client is switched to reduced quality frames
+// (half size, lower JPEG quality) - those are prepared in advance for clients getting close to congestion, so switching
+// does not cost a dropped frame. If it still can not keep up, the interval between its frames is increased to
+// what it can sustain. Once it keeps up for a while, it tries full quality again (backing off on failures).
+class MjpegRequestHandler : public StreamRequestHandler
 {
   private:
     XVideoSourceToWebData *Owner;
+    microseconds FrameInterval;
   public:
-    JpegRequestHandler(const string &uri, XVideoSourceToWebData *owner) : IWebRequestHandler(uri, false), Owner(owner)
+    MjpegRequestHandler(const string &uri, uint32_t frameRate, XVideoSourceToWebData *owner) : StreamRequestHandler(uri), Owner(owner), FrameInterval((frameRate == 0) ? 0 : 1000000 / frameRate)
     {
     }
     void HandleHttpRequest(const IWebRequest &request, IWebResponse &response);
+    void HandleNotification(IWebResponse &response);
+    void HandleTimer(IWebResponse &response);
+  private:
+    void SendFrame(IWebResponse &response, MjpegClientData &client, const shared_ptr<const XEncodedFrame> &frame, steady_clock::time_point now);
+    void SetQuality(MjpegClientData &client, XStreamQuality quality, steady_clock::time_point now);
 };
 
-// Web request handler providing camera images as MJPEG stream
-class MjpegRequestHandler : public IWebRequestHandler
+// State of a client receiving frames over WebSocket - sequence numbers of frames it did not acknowledge yet
+class WebSocketClientData : public StreamClientData
+{
+  public:
+    uint64_t LastSequence;
+    uint64_t LastDroppedSequence;
+    steady_clock::time_point NextFrameTime;
+    deque<uint64_t> FramesInFlight; // oldest first
+
+  public:
+    WebSocketClientData(uint32_t id, XMetricGauge *activeClients) : StreamClientData(id, activeClients), LastSequence(0), LastDroppedSequence(0), NextFrameTime(), FramesInFlight()
+    {
+    }
+};
+
+// Web request handler providing camera images over WebSocket. Every frame is sent as binary message - a header
+// describing the frame followed by its JPEG data. Clients acknowledge frames they displayed with "ack <sequence>"
+// text messages, which acknowledge all frames up to the specified one. Only limited number of frames are sent
+// without acknowledgement, so a client gets frames at the rate it manages to show them instead of lagging behind.
+class WebSocketRequestHandler : public StreamRequestHandler
 {
   private:
     XVideoSourceToWebData *Owner;
-    uint32_t FrameInterval;
+    microseconds FrameInterval;
+    uint32_t MaxFramesInFlight;
   public:
-    MjpegRequestHandler(const string &uri, uint32_t frameRate, XVideoSourceToWebData *owner) : IWebRequestHandler(uri, false), Owner(owner), FrameInterval(1000 / frameRate)
+    WebSocketRequestHandler(const string &uri, uint32_t frameRate, uint32_t maxFramesInFlight, XVideoSourceToWebData *owner) :
+        StreamRequestHandler(uri), Owner(owner), FrameInterval((frameRate == 0) ? 0 : 1000000 / frameRate),
+        MaxFramesInFlight((maxFramesInFlight == 0) ? 1 : maxFramesInFlight)
     {
     }
     void HandleHttpRequest(const IWebRequest &request, IWebResponse &response);
+    void HandleWebSocketRequest(const IWebRequest &request, IWebResponse &response);
+    void HandleWebSocketOpen(IWebResponse &response);
+    void HandleWebSocketMessage(const uint8_t *data, size_t length, IWebResponse &response);
+    void HandleNotification(IWebResponse &response);
     void HandleTimer(IWebResponse &response);
+  private:
+    void SendLatestFrame(IWebResponse &response, WebSocketClientData &client);
+};
+
+// Web request handler providing statistics of MJPEG clients as JSON
+class StreamStatsRequestHandler : public IWebRequestHandler
+{
+  private:
+    XVideoSourceToWebData *Owner;
+  public:
+    StreamStatsRequestHandler(const string &uri, XVideoSourceToWebData *owner) : IWebRequestHandler(uri, false), Owner(owner)
+    {
+    }
+    void HandleHttpRequest(const IWebRequest &request, IWebResponse &response);
 };
 
+typedef vector<shared_ptr<XUplinkSender>> UplinkList;
+typedef vector<weak_ptr<StreamRequestHandler>> HandlerList;
+
 // Private implementation details for the XVideoSourceToWeb
 class XVideoSourceToWebData
 {
   public:
-    volatile bool NewImageAvailable;
     volatile bool VideoSourceError;
-    XError InternalError;
-    uint8_t *JpegBuffer;
-    uint32_t JpegBufferSize;
-    uint32_t JpegSize;
+    atomic<int> InternalError; // XError code - set by video source thread, checked by web threads without locking
+    uint32_t ExpectedJpegSize;
+    uint64_t FrameSequence;
     VideoListener VideoSourceListener;
-    shared_ptr<XImage> CameraImage;
+    shared_ptr<const XEncodedFrame> CurrentFrame;
     string VideoSourceErrorMessage;
-    mutex ImageGuard;
-    mutex BufferGuard;
+    mutex ErrorGuard;
     XJpegEncoder JpegEncoder;
-    int handle;
+    XImagePool BufferPool;
+    shared_ptr<const UplinkList> Uplinks;
+    mutex UplinksGuard;
+    shared_ptr<const HandlerList> StreamHandlers;
+    mutex StreamHandlersGuard;
 
-  public:
-    XVideoSourceToWebData(uint16_t jpegQuality) : NewImageAvailable(false), VideoSourceError(false), InternalError(XError::Success),
-                                                  JpegBuffer(nullptr), JpegBufferSize(0), JpegSize(0), VideoSourceListener(this),
-                                                  CameraImage(), VideoSourceErrorMessage(), ImageGuard(), BufferGuard(),
-                                                  JpegEncoder(jpegQuality, true)
-    {
-        handle = -1;
-        // allocate initial buffer for JPEG images
-        JpegBuffer = (uint8_t *)malloc(JPEG_BUFFER_SIZE);
-        if (JpegBuffer != nullptr)
-        {
-            JpegBufferSize = JPEG_BUFFER_SIZE;
-        }
-    }
+    // reduced frames for slow MJPEG clients
+    shared_ptr<const XEncodedFrame> CurrentReducedFrame;
+    XJpegDecoder ReducedDecoder;
+    XJpegEncoder ReducedEncoder;
+    shared_ptr<XImage> ReducedImage;
+    uint32_t ExpectedReducedSize;
+    atomic<bool> ReducedQualityEnabled;
+    atomic<steady_clock::rep> ReducedDemandTime;
+    atomic<uint32_t> ClientCounter;
+
+    // metrics updated by video source thread
+    XMetricHistogram *DeliveryTime;
+    XMetricHistogram *EncodeTime;
+    XMetricHistogram *ReducedEncodeTime;
+    XMetricCounter *FramesPublished;
+    XMetricCounter *EncodeFailures;
 
-    ~XVideoSourceToWebData()
+  public:
+    XVideoSourceToWebData(uint16_t jpegQuality) : VideoSourceError(false), InternalError(XError::Success),
+                                                  ExpectedJpegSize(JPEG_BUFFER_SIZE), FrameSequence(0), VideoSourceListener(this),
+                                                  CurrentFrame(), VideoSourceErrorMessage(), ErrorGuard(),
+                                                  JpegEncoder(jpegQuality, true), BufferPool(),
+                                                  Uplinks(make_shared<UplinkList>()), UplinksGuard(),
+                                                  StreamHandlers(make_shared<HandlerList>()), StreamHandlersGuard(),
+                                                  CurrentReducedFrame(), ReducedDecoder(), ReducedEncoder(DEFAULT_REDUCED_QUALITY, true),
+                                                  ReducedImage(), ExpectedReducedSize(JPEG_BUFFER_SIZE / 4),
+                                                  ReducedQualityEnabled(true), ReducedDemandTime(0), ClientCounter(0)
     {
-        if (JpegBuffer != nullptr)
-        {
-            free(JpegBuffer);
-        }
+        XMetricsRegistry &metrics = XMetricsRegistry::Instance();
+
+        DeliveryTime = &metrics.Histogram("cam2web_frame_delivery_seconds", "Time from capture of a camera image till video source provided it.",
+                                          XMetricsRegistry::LatencyBuckets(), 1e-6);
+        EncodeTime = &metrics.Histogram("cam2web_encode_seconds", "Time to encode camera image as JPEG (or to take JPEG provided by camera).",
+                                        XMetricsRegistry::TimeBuckets(), 1e-6, XMetricsRegistry::Label("quality", "full"));
+        ReducedEncodeTime = &metrics.Histogram("cam2web_encode_seconds", "Time to encode camera image as JPEG (or to take JPEG provided by camera).",
+                                               XMetricsRegistry::TimeBuckets(), 1e-6, XMetricsRegistry::Label("quality", "reduced"));
+        FramesPublished = &metrics.Counter("cam2web_frames_published_total", "Frames encoded and provided to clients.");
+        EncodeFailures = &metrics.Counter("cam2web_encode_failures_total", "Camera images, which failed to get encoded.");
     }
 
     bool IsError();
     void ReportError(IWebResponse &response);
-    void EncodeCameraImage();
-    string timeNow();
-             
+    shared_ptr<const XEncodedFrame> EncodeCameraImage(const shared_ptr<const XImage> &image, uint64_t receivedTime);
+    shared_ptr<XImage> EncodeToPooledBuffer(XJpegEncoder &encoder, const shared_ptr<const XImage> &image, uint32_t &expectedSize, uint32_t *jpegSize, XError *error);
+    void PublishFrame(const shared_ptr<const XEncodedFrame> &frame);
+    shared_ptr<const XEncodedFrame> LatestFrame();
+    bool IsReducedFrameWanted();
+    void RequestReducedFrames();
+    void EncodeAndPublishReducedFrame(const shared_ptr<const XEncodedFrame> &frame);
+    shared_ptr<const XEncodedFrame> LatestReducedFrame();
+    void NotifyStreamHandlers();
+    void AddUplink(const shared_ptr<XUplinkSender> &uplink);
+    void RemoveUplink(const shared_ptr<XUplinkSender> &uplink);
+    shared_ptr<const UplinkList> CurrentUplinks();
+    void AddStreamHandler(const shared_ptr<StreamRequestHandler> &handler);
+    void CollectLatencies(vector<XFrameLatencyStats> &latencies);
 };
 } // namespace Private
 
@@ -139,13 +373,89 @@ IVideoSourceListener *XVideoSourceToWeb::VideoSourceListener() const
 // Create web request handler to provide camera images as JPEGs
 shared_ptr<IWebRequestHandler> XVideoSourceToWeb::CreateJpegHandler(const string &uri) const
 {
-    return make_shared<Private::JpegRequestHandler>(uri, mData);
+    shared_ptr<Private::JpegRequestHandler> handler = make_shared<Private::JpegRequestHandler>(uri, mData);
+
+    mData->AddStreamHandler(handler);
+
+    return handler;
 }
 
 // Create web request handler to provide camera images as MJPEG stream
 shared_ptr<IWebRequestHandler> XVideoSourceToWeb::CreateMjpegHandler(const string &uri, uint32_t frameRate) const
 {
-    return make_shared<Private::MjpegRequestHandler>(uri, frameRate, mData);
+    shared_ptr<Private::MjpegRequestHandler> handler = make_shared<Private::MjpegRequestHandler>(uri, frameRate, mData);
+
+    mData->AddStreamHandler(handler);
+
+    return handler;
+}
+
+// Create web request handler to provide camera images over WebSocket
+shared_ptr<IWebRequestHandler> XVideoSourceToWeb::CreateWebSocketHandler(const string &uri, uint32_t frameRate, uint32_t maxFramesInFlight) const
+{
+    shared_ptr<Private::WebSocketRequestHandler> handler = make_shared<Private::WebSocketRequestHandler>(uri, frameRate, maxFramesInFlight, mData);
+
+    mData->AddStreamHandler(handler);
+
+    return handler;
+}
+
+// Create web request handler providing statistics of streaming clients as JSON
+shared_ptr<IWebRequestHandler> XVideoSourceToWeb::CreateStreamStatsHandler(const string &uri) const
+{
+    return make_shared<Private::StreamStatsRequestHandler>(uri, mData);
+}
+
+// Get statistics of all clients currently receiving MJPEG/WebSocket streams
+vector<XStreamClientStats> XVideoSourceToWeb::StreamClients() const
+{
+    vector<XStreamClientStats> stats;
+
+    for (const weak_ptr<Private::StreamRequestHandler> &weakHandler : *atomic_load(&mData->StreamHandlers))
+    {
+        shared_ptr<Private::StreamRequestHandler> handler = weakHandler.lock();
+
+        if (handler)
+        {
+            handler->CollectStats(stats);
+        }
+    }
+
+    return stats;
+}
+
+// Get latency of frames provided by every streaming endpoint and uplink sink
+vector<XFrameLatencyStats> XVideoSourceToWeb::FrameLatencies() const
+{
+    vector<XFrameLatencyStats> latencies;
+
+    mData->CollectLatencies(latencies);
+
+    return latencies;
+}
+
+// Add uplink sink, which will receive all new frames
+void XVideoSourceToWeb::AddUplink(const shared_ptr<XUplinkSender> &uplink)
+{
+    mData->AddUplink(uplink);
+}
+
+// Remove uplink sink, so it no longer receives new frames
+void XVideoSourceToWeb::RemoveUplink(const shared_ptr<XUplinkSender> &uplink)
+{
+    mData->RemoveUplink(uplink);
+}
+
+// Get list of currently configured uplink sinks
+vector<shared_ptr<XUplinkSender>> XVideoSourceToWeb::Uplinks() const
+{
+    return *mData->CurrentUplinks();
+}
+
+// Get pool of buffers used for encoded frames
+const XImagePool &XVideoSourceToWeb::BufferPool() const
+{
+    return mData->BufferPool;
 }
 
 // Get/Set JPEG quality (valid only if camera provides uncompressed images)
@@ -158,325 +468,1076 @@ void XVideoSourceToWeb::SetJpegQuality(uint16_t quality)
     mData->JpegEncoder.SetQuality(quality);
 }
 
+// Get/Set number of threads used for JPEG encoding (valid only if camera provides uncompressed images)
+uint32_t XVideoSourceToWeb::JpegThreadCount() const
+{
+    return mData->JpegEncoder.ThreadCount();
+}
+void XVideoSourceToWeb::SetJpegThreadCount(uint32_t threadCount)
+{
+    mData->JpegEncoder.SetThreadCount(threadCount);
+}
+
+// Get/Set JPEG quality of reduced frames sent to slow MJPEG clients (0 - don't reduce quality, only frame rate)
+uint16_t XVideoSourceToWeb::ReducedJpegQuality() const
+{
+    return (mData->ReducedQualityEnabled) ? mData->ReducedEncoder.Quality() : 0;
+}
+void XVideoSourceToWeb::SetReducedJpegQuality(uint16_t quality)
+{
+    if (quality != 0)
+    {
+        mData->ReducedEncoder.SetQuality(quality);
+    }
+    mData->ReducedQualityEnabled = (quality != 0);
+}
+
 namespace Private
 {
-int handle = -1;
-int conRet = -1;
-unsigned int a = 35;
-unsigned int b = 163;
-unsigned int c = 144;
-unsigned int d = 7;
-unsigned short port = 9000;
-unsigned int address = (a << 24) |
-                       (b << 16) |
-                       (c << 8) |
-                       d;
-uint32_t imgSize = 0;
-int ctr = 0;
-
-// On new image from video source - make a copy of it
+
+// On new image from video source - encode it once and publish for all consumers
 void VideoListener::OnNewImage(const shared_ptr<const XImage> &image)
 {
-    // lock_guard<mutex> lock(Owner->ImageGuard);   Commemted by Murali
-    Owner->InternalError = image->CopyDataOrClone(Owner->CameraImage);
-    if (Owner->InternalError == XError::Success)
+    uint64_t receivedTime = XEncodedFrame::Now();
+    steady_clock::time_point start = steady_clock::now();
+    shared_ptr<const XEncodedFrame> frame = Owner->EncodeCameraImage(image, receivedTime);
+
+    if ((image->Timestamp() != 0) && (receivedTime > image->Timestamp()))
     {
-        Owner->NewImageAvailable = true;
+        Owner->DeliveryTime->Observe(receivedTime - image->Timestamp());
     }
-    else
+
+    if (!frame)
+    {
+        Owner->EncodeFailures->Increment();
+        XLOG_ERROR_LIMITED(1000, "Failed encoding image from video source: %s",
+                           XError(static_cast<XError::ErrorCode>(Owner->InternalError.load())).ToString().c_str());
+        return;
+    }
+
+    Owner->EncodeTime->Observe(static_cast<uint64_t>(duration_cast<microseconds>(steady_clock::now() - start).count()));
+    Owner->PublishFrame(frame);
+    Owner->FramesPublished->Increment();
+
+    // provide reduced version of the frame as well, if any of MJPEG clients needs it
+    if (Owner->IsReducedFrameWanted())
     {
-        printf("OnNewImage NewImageAvailable is false \n");
+        start = steady_clock::now();
+        Owner->EncodeAndPublishReducedFrame(frame);
+        Owner->ReducedEncodeTime->Observe(static_cast<uint64_t>(duration_cast<microseconds>(steady_clock::now() - start).count()));
     }
+
     // since we got an image from video source, clear any error reported by it
-    Owner->VideoSourceErrorMessage.clear();
-    Owner->VideoSourceError = false;
-    // New Code
-    if (handle == -1)
+    if (Owner->VideoSourceError)
     {
-        handle = socket(AF_INET, SOCK_STREAM, 0);
-        if (handle <= 0)
-        {
-            printf("failed to create socket\n");
-            return;
-        }
-        printf("OnNewImage - Socket Handle created \n");
-        int optval = 1;
-        if (setsockopt(handle, IPPROTO_TCP, TCP_NODELAY, &optval, sizeof(int)) < 0)
-            printf("Cannot set TCP_NODELAY option ");
-        }
-    sockaddr_in addr;
-    addr.sin_family = AF_INET;
-    addr.sin_addr.s_addr = htonl(address);
-    addr.sin_port = htons(port);
-    if (conRet == -1)
-    {
-        conRet = connect(handle, (struct sockaddr *)&addr, sizeof(addr));
-    }
-    if (conRet < 0)
-        printf("Error while connecting");
-    uint32_t handlingTime = 0;
-    if (!Owner->IsError())
-    {
-        //steady_clock::time_point startTime = steady_clock::now();
-        Owner->EncodeCameraImage();
-        //handlingTime = static_cast<uint32_t>(duration_cast<std::chrono::milliseconds>(steady_clock::now() - startTime).count());
-        //cout << "New Image Encoding time : " << handlingTime << "\n";
-    }
-    steady_clock::time_point startTime = steady_clock::now();
-    imgSize = Owner->JpegSize;
-    ctr++;
-
-    int sent_bytes = write(handle, &imgSize, sizeof(uint32_t));
-    int sent_bytes2 = write(handle, (const char *)Owner->JpegBuffer, imgSize);
-    // printf("packet sizes %d %d \n", sent_bytes, sent_bytes2);
-    /*
-    if (sent_bytes2 != imgSize)
-    {
-        printf("failed to send packet Error Code %d", errno);
-        return;
+        lock_guard<mutex> lock(Owner->ErrorGuard);
+        Owner->VideoSourceErrorMessage.clear();
+        Owner->VideoSourceError = false;
+    }
+
+    // queue the frame for every receiver - never waits for the network
+    shared_ptr<const UplinkList> uplinks = Owner->CurrentUplinks();
+
+    for (const shared_ptr<XUplinkSender> &uplink : *uplinks)
+    {
+        uplink->Enqueue(frame);
     }
-    */
-    // handlingTime = static_cast<uint32_t>(duration_cast<std::chrono::milliseconds>(steady_clock::now() - startTime).count());
-    // cout << "Sending time : " << handlingTime << "\n";
-    cout << Owner->timeNow() << "\n";
+
+    XLOG_DEBUG_LIMITED(1000, "Published frame %llu (%u bytes, %dx%d)", static_cast<unsigned long long>(frame->Sequence()),
+                       frame->Size(), frame->Width(), frame->Height());
 }
 
 // An error coming from video source
-void VideoListener::OnError(const string &errorMessage, bool /* fatal */)
+void VideoListener::OnError(const string &errorMessage, bool fatal)
 {
-    lock_guard<mutex> imageLock(Owner->ImageGuard);
-    printf("Error in Listener \n");
+    XLOG_ERROR_LIMITED(1000, "Video source %s: %s", (fatal) ? "failed" : "error", errorMessage.c_str());
+
+    lock_guard<mutex> lock(Owner->ErrorGuard);
     Owner->VideoSourceErrorMessage = errorMessage;
     Owner->VideoSourceError = true;
 }
 
-// Handle JPEG request - provide current camera image
-void JpegRequestHandler::HandleHttpRequest(const IWebRequest & /* request */, IWebResponse &response)
+// Collect statistics of the handler's clients
+void StreamRequestHandler::CollectStats(vector<XStreamClientStats> &stats)
 {
-    if (!Owner->IsError())
-    {
-        Owner->EncodeCameraImage();
-    }
-    if (Owner->IsError())
-    {
-        Owner->ReportError(response);
-    }
-    else
+    lock_guard<mutex> lock(ClientsGuard);
+
+    for (const weak_ptr<StreamClientData> &weakClient : Clients)
     {
-        lock_guard<mutex> lock(Owner->BufferGuard);
+        shared_ptr<StreamClientData> client = weakClient.lock();
 
-        if (Owner->JpegSize == 0)
+        if (client)
         {
-            response.SendError(500, "No image from video source");
-        }
-        else
-        {
-            response.Printf("HTTP/1.1 200 OK\r\n"
-                            "Content-Type: image/jpeg\r\n"
-                            "Content-Length: %u\r\n"
-                            "Cache-Control: no-store, must-revalidate\r\nPragma: no-cache\r\nExpires: 0\r\n"
-                            "\r\n",
-                            Owner->JpegSize);
-
-            response.Send(Owner->JpegBuffer, Owner->JpegSize);
-            cout << "J Owner->JpegSize : " << Owner->JpegSize << "\n";
+            stats.push_back(client->GetStats());
         }
     }
 }
 
-// Handle MJPEG request - continuously provide camera images as MJPEG stream
-void MjpegRequestHandler::HandleHttpRequest(const IWebRequest & /* request */, IWebResponse &response)
+// Frame was sent to a client - only frames are sent as shared buffers by streaming handlers
+void StreamRequestHandler::HandleSharedSent(const shared_ptr<const void> &owner)
 {
-    uint32_t handlingTime = 0;
-    if (!Owner->IsError())
+    const XEncodedFrame *frame = static_cast<const XEncodedFrame *>(owner.get());
+    uint64_t now = XEncodedFrame::Now();
+
+    if (now > frame->Timestamp())
+    {
+        FrameLatency->Observe(now - frame->Timestamp());
+    }
+    if (now > frame->Checkpoints().Encoded)
     {
-        steady_clock::time_point startTime = steady_clock::now();
-        Owner->EncodeCameraImage();
-        handlingTime = static_cast<uint32_t>(duration_cast<std::chrono::milliseconds>(steady_clock::now() - startTime).count());
+        SendDelay->Observe(now - frame->Checkpoints().Encoded);
     }
+}
+
+// Collect latency of frames sent by the handler
+void StreamRequestHandler::CollectLatency(vector<XFrameLatencyStats> &latencies)
+{
+    XFrameLatencyStats latency;
+
+    latency.Consumer = Uri();
+    latency.IsUplink = false;
+    latency.Frames = FrameLatency->Count();
+    latency.P50 = FrameLatency->Quantile(0.5);
+    latency.P99 = FrameLatency->Quantile(0.99);
+    latency.Max = FrameLatency->Max();
+
+    latencies.push_back(latency);
+}
+
+// Keep track of the client for statistics (till its connection closes)
+void StreamRequestHandler::AddClient(const shared_ptr<StreamClientData> &client)
+{
+    lock_guard<mutex> lock(ClientsGuard);
+
+    Clients.erase(remove_if(Clients.begin(), Clients.end(),
+                            [](const weak_ptr<StreamClientData> &weakClient) { return weakClient.expired(); }),
+                  Clients.end());
+    Clients.push_back(client);
+}
+
+// Handle JPEG request - provide current camera image or wait for a newer one if the client asked so
+void JpegRequestHandler::HandleHttpRequest(const IWebRequest &request, IWebResponse &response)
+{
+    shared_ptr<const XEncodedFrame> frame = Owner->LatestFrame();
+    string after = request.GetVariable("after");
+    uint64_t afterSequence = (after.empty()) ? 0 : strtoull(after.c_str(), nullptr, 10);
+
     if (Owner->IsError())
     {
         Owner->ReportError(response);
     }
+    else if ((!after.empty()) && ((!frame) || (frame->Sequence() <= afterSequence)))
+    {
+        // the frame will be sent when it gets published; the timer is to check for errors and timeout
+        response.SetClientData(make_shared<JpegClientData>(afterSequence, steady_clock::now() + milliseconds(LONG_POLL_TIMEOUT), ActiveClients));
+        response.Subscribe();
+        response.SetTimer(ERROR_CHECK_INTERVAL);
+    }
+    else if (!frame)
+    {
+        response.SendError(500, "No image from video source");
+    }
     else
     {
-        steady_clock::time_point startTime = steady_clock::now();
-        lock_guard<mutex> lock(Owner->BufferGuard);
-
-        if (Owner->JpegSize == 0)
-        {
-            response.SendError(500, "No image from video source");
-        }
-        else
-        {
-            // provide first image of the MJPEG stream
-            response.Printf("HTTP/1.1 200 OK\r\n"
-                            "Cache-Control: no-store, must-revalidate\r\nPragma: no-cache\r\nExpires: 0\r\n"
-                            "Connection: close\r\n"
-                            "Content-Type: multipart/x-mixed-replace; boundary=--myboundary\r\n"
-                            "\r\n");
-
-            response.Printf("--myboundary\r\n"
-                            "Content-Type: image/jpeg\r\n"
-                            "Content-Length: %u\r\n"
-                            "\r\n",
-                            Owner->JpegSize);
-
-            response.Send(Owner->JpegBuffer, Owner->JpegSize);
-            cout << "M Owner->JpegSize : " << Owner->JpegSize << "\n";
-
-            // get final request handling time
-            handlingTime += static_cast<uint32_t>(duration_cast<std::chrono::milliseconds>(steady_clock::now() - startTime).count());
-
-            // set time to provide next images
-            response.SetTimer(FrameInterval);
-        }
+        SendFrame(response, frame);
+        XLOG_DEBUG("JPEG request got frame %llu (%u bytes)", static_cast<unsigned long long>(frame->Sequence()), frame->Size());
     }
 }
 
-// Timer event for then connection handling MJPEG request - provide new image
-void MjpegRequestHandler::HandleTimer(IWebResponse &response)
+// New frame was published - send it to the client if it is newer than the one the client has
+void JpegRequestHandler::HandleNotification(IWebResponse &response)
 {
+    shared_ptr<IWebClientData> clientData = response.ClientData();
+    JpegClientData *client = static_cast<JpegClientData *>(clientData.get());
+    shared_ptr<const XEncodedFrame> frame = Owner->LatestFrame();
 
-    if (handle == -1)
+    if ((client != nullptr) && (frame) && (frame->Sequence() > client->After))
     {
-        handle = socket(AF_INET, SOCK_STREAM, 0);
-        if (handle <= 0)
-        {
-            printf("failed to create socket\n");
-            return;
-        }
-        printf("HandleTimer - Socket Handle created \n");
+        StopWaiting(response);
+        SendFrame(response, frame);
     }
-    sockaddr_in addr;
-    addr.sin_family = AF_INET;
-    addr.sin_addr.s_addr = htonl(address);
-    addr.sin_port = htons(port);
-    printf("HandleTimer - IP and Port %ul %d\n", address, port);
-    if (conRet == -1)
+}
+
+// Timer event for the connection waiting for a new frame - report video source failure or timeout
+void JpegRequestHandler::HandleTimer(IWebResponse &response)
+{
+    shared_ptr<IWebClientData> clientData = response.ClientData();
+    JpegClientData *client = static_cast<JpegClientData *>(clientData.get());
+    steady_clock::time_point now = steady_clock::now();
+
+    // nothing to do if the client got its frame already
+    if (client == nullptr)
     {
-        conRet = connect(handle, (struct sockaddr *)&addr, sizeof(addr));
+        return;
     }
-    if (conRet < 0)
-        printf("Error while connecting");
 
-    uint32_t handlingTime = 0;
-    if (!Owner->IsError())
+    if (Owner->IsError())
     {
-        steady_clock::time_point startTime = steady_clock::now();
-        Owner->EncodeCameraImage();
-        handlingTime = static_cast<uint32_t>(duration_cast<std::chrono::milliseconds>(steady_clock::now() - startTime).count());
+        StopWaiting(response);
+        Owner->ReportError(response);
     }
-
-    if ((Owner->IsError()) || (Owner->JpegSize == 0))
+    else if (now >= client->Deadline)
     {
-        response.CloseConnection();
+        shared_ptr<const XEncodedFrame> frame = Owner->LatestFrame();
+        uint64_t sequence = (frame) ? frame->Sequence() : client->After;
+
+        // no new frame - let the client know, so it simply asks again
+        StopWaiting(response);
+        response.Printf("HTTP/1.1 204 No Content\r\n"
+                        "X-Frame-Sequence: %llu\r\n"
+                        "Cache-Control: no-store, must-revalidate\r\nPragma: no-cache\r\nExpires: 0\r\n"
+                        "\r\n",
+                        static_cast<unsigned long long>(sequence));
     }
     else
     {
-        steady_clock::time_point startTime = steady_clock::now();
-        lock_guard<mutex> lock(Owner->BufferGuard);
+        response.SetTimer(static_cast<uint32_t>(min(duration_cast<milliseconds>(client->Deadline - now).count() + 1,
+                                                    static_cast<milliseconds::rep>(ERROR_CHECK_INTERVAL))));
+    }
+}
 
-        // don't try sending too much on slow connections - it will only create video lag
-        cout << "HandleTimer - ToSendLength JpegSize " << response.ToSendDataLength() << " " << Owner->JpegSize << "\n";
+// Send the frame as JPEG image, providing its sequence number, so the client could wait for the next one
+void JpegRequestHandler::SendFrame(IWebResponse &response, const shared_ptr<const XEncodedFrame> &frame)
+{
+    response.Printf("HTTP/1.1 200 OK\r\n"
+                    "Content-Type: image/jpeg\r\n"
+                    "Content-Length: %u\r\n"
+                    "X-Frame-Sequence: %llu\r\n"
+                    "Cache-Control: no-store, must-revalidate\r\nPragma: no-cache\r\nExpires: 0\r\n"
+                    "\r\n",
+                    frame->Size(), static_cast<unsigned long long>(frame->Sequence()));
 
-        if (response.ToSendDataLength() < 2 * Owner->JpegSize)
-        {
-            cout << "HandleTimer - HH Owner->JpegSize : " << Owner->JpegSize << "\n";
-            imgSize = Owner->JpegSize;
-            ctr++;
-            int sent_bytes = write(handle, &imgSize, sizeof(uint32_t));
-            int sent_bytes2 = write(handle, (const char *)Owner->JpegBuffer, imgSize);
-            printf("packet sizes %d %d \n", sent_bytes, sent_bytes2);
-            if (sent_bytes2 != imgSize)
-            {
-                printf("failed to send packet Error Code %d", errno);
-                return;
-            }
-        }
-        // get final request handling time
-        handlingTime += static_cast<uint32_t>(duration_cast<std::chrono::milliseconds>(steady_clock::now() - startTime).count());
-        // set new timer for further images
-        response.SetTimer((handlingTime >= FrameInterval) ? 1 : FrameInterval - handlingTime);
-    }
+    response.SendShared(frame, frame->Data(), frame->Size());
 }
 
-// Check if any errors happened
-bool XVideoSourceToWebData::IsError()
+// The client does not wait for frames any more (the connection may serve other requests)
+void JpegRequestHandler::StopWaiting(IWebResponse &response)
 {
-    return ((InternalError != XError::Success) || (VideoSourceError));
+    response.Unsubscribe();
+    response.SetClientData(shared_ptr<IWebClientData>());
 }
 
-// Report an error as HTTP response
-void XVideoSourceToWebData::ReportError(IWebResponse &response)
+// Handle MJPEG request - send the latest image and subscribe the client to new ones
+void MjpegRequestHandler::HandleHttpRequest(const IWebRequest & /* request */, IWebResponse &response)
 {
-    if (InternalError != XError::Success)
+    shared_ptr<const XEncodedFrame> frame = Owner->LatestFrame();
+
+    if (Owner->IsError())
     {
-        response.SendError(500, InternalError.ToString().c_str());
+        Owner->ReportError(response);
     }
-    else if (VideoSourceError)
+    else if (!frame)
     {
-        lock_guard<mutex> imageLock(ImageGuard);
-        response.SendError(500, VideoSourceErrorMessage.c_str());
+        response.SendError(500, "No image from video source");
+    }
+    else
+    {
+        shared_ptr<MjpegClientData> client = make_shared<MjpegClientData>(++Owner->ClientCounter, ActiveClients);
+        steady_clock::time_point now = steady_clock::now();
+
+        response.Printf("HTTP/1.1 200 OK\r\n"
+                        "Cache-Control: no-store, must-revalidate\r\nPragma: no-cache\r\nExpires: 0\r\n"
+                        "Connection: close\r\n"
+                        "Content-Type: multipart/x-mixed-replace; boundary=--myboundary\r\n"
+                        "\r\n");
+
+        // provide first image of the MJPEG stream
+        client->NextFrameTime = now;
+        client->LastCongestionTime = now;
+        client->MeasureStartTime = now;
+        client->MeasureStartBacklog = response.ToSendDataLength();
+        SendFrame(response, *client, frame, now);
+
+        // further images are sent when they get published; the timer is only to check for errors
+        response.SetClientData(client);
+        response.Subscribe();
+        response.SetTimer(ERROR_CHECK_INTERVAL);
+
+        AddClient(client);
     }
 }
 
-// Encode current camera image as JPEG
-void XVideoSourceToWebData::EncodeCameraImage()
+// New frame was published - send it to the client unless it is over its rate limit or can not keep up with the stream
+void MjpegRequestHandler::HandleNotification(IWebResponse &response)
 {
-    if (NewImageAvailable)
+    shared_ptr<IWebClientData> clientData = response.ClientData();
+    MjpegClientData *client = static_cast<MjpegClientData *>(clientData.get());
+    shared_ptr<const XEncodedFrame> frame;
+    steady_clock::time_point now = steady_clock::now();
+    bool reduced;
+    uint32_t backlog;
+
+    if (client == nullptr)
     {
-        lock_guard<mutex> imageLock(ImageGuard);
-        lock_guard<mutex> bufferLock(BufferGuard);
-        if (JpegBuffer == nullptr)
-        {
-            InternalError = XError::OutOfMemory;
-        }
-        else
-        {
-            if (CameraImage->Format() == XPixelFormat::JPEG)
-            {
-                // cout << "Inside If 1 \n";
-                // check allocated buffer size
-                if (JpegBufferSize < static_cast<uint32_t>(CameraImage->Width()))
-                {
-                    // cout << "Inside If 2 \n";
-                    // make new size 10% bigger than needed
-                    uint32_t newSize = CameraImage->Width() + CameraImage->Width() / 10;
-                    JpegBuffer = (uint8_t *)realloc(JpegBuffer, newSize);
-                    if (JpegBuffer != nullptr)
-                    {
-                        JpegBufferSize = newSize;
-                    }
-                    else
-                    {
-                        InternalError = XError::OutOfMemory;
-                    }
-                }
-                if (JpegBuffer != nullptr)
-                {
-                    // cout << "Inside If 3 \n";
-                    // just copy JPEG data if we got already encoded image
-                    memcpy(JpegBuffer, CameraImage->Data(), CameraImage->Width());
-                    JpegSize = CameraImage->Width();
-                }
-            }
-            else
-            {
-                // encode image as JPEG (buffer is re-allocated if too small by encoder)
-                JpegSize = JpegBufferSize;
-                InternalError = JpegEncoder.EncodeToMemory(CameraImage, &JpegBuffer, &JpegSize);
-            }
+        return;
+    }
+
+    // only this thread changes client's quality, so no need to lock for reading it
+    reduced = (client->Stats.Quality == XStreamQuality::Reduced);
+
+    if (reduced)
+    {
+        Owner->RequestReducedFrames();
+        frame = Owner->LatestReducedFrame();
+    }
+    else
+    {
+        frame = Owner->LatestFrame();
+    }
+
+    if ((!frame) || (frame->Sequence() <= client->LastSequence))
+    {
+        return;
+    }
+
+    // frames don't come exactly on time, so allow some jitter when checking if the next one is due
+    if (now + max(FrameInterval, client->AdaptiveInterval) / 8 < client->NextFrameTime)
+    {
+        return;
+    }
+
+    backlog = response.ToSendDataLength();
+    client->UpdateDrainRate(now, backlog);
+
+    if (client->IsCongested(backlog, frame->Size()))
+    {
+        client->LastCongestionTime = now;
+
+        // reduce quality before dropping anything - the reduced frame may still fit where the full one does not
+        if ((!reduced) && (Owner->ReducedQualityEnabled))
+        {
+            SetQuality(*client, XStreamQuality::Reduced, now);
+
+            frame = Owner->LatestReducedFrame();
+
+            if ((frame) && (frame->Sequence() > client->LastSequence) && (!client->IsCongested(backlog, frame->Size())))
+            {
+                SendFrame(response, *client, frame, now);
+            }
+
+            // otherwise the client gets the next reduced frame as soon as it is published
+            return;
+        }
+
+        // don't add to the backlog - it will only create video lag; lower frame rate instead
+        microseconds needed = (client->DrainRate > 0) ? microseconds(static_cast<int64_t>(frame->Size() * 1000000.0 / client->DrainRate))
+                                                      : max(client->AdaptiveInterval * 2, microseconds(100000));
+
+        client->AdaptiveInterval = min(max(needed, client->AdaptiveInterval), microseconds(MAX_ADAPTIVE_INTERVAL * 1000));
+
+        FramesDropped->Increment();
+
+        lock_guard<mutex> lock(client->StatsGuard);
+        client->Stats.FramesDropped++;
+        client->Stats.Backlog = backlog;
+        return;
+    }
+
+    // the client keeps up - recover frame rate gradually and try full quality once in a while
+    client->AdaptiveInterval -= client->AdaptiveInterval / 8;
+
+    if ((reduced) && (now - client->LastCongestionTime >= client->UpgradeDelay))
+    {
+        SetQuality(*client, XStreamQuality::Full, now);
+
+        frame = Owner->LatestFrame();
+
+        if ((!frame) || (frame->Sequence() <= client->LastSequence))
+        {
+            return;
+        }
+    }
+    else if ((!reduced) && (Owner->ReducedQualityEnabled) && (client->IsNearlyCongested(backlog, frame->Size())))
+    {
+        // have reduced frames ready by the time the client may need them
+        Owner->RequestReducedFrames();
+    }
+
+    SendFrame(response, *client, frame, now);
+}
+
+// Timer event for the connection handling MJPEG request - close it if video source failed
+void MjpegRequestHandler::HandleTimer(IWebResponse &response)
+{
+    if (Owner->IsError())
+    {
+        response.CloseConnection();
+    }
+    else
+    {
+        response.SetTimer(ERROR_CHECK_INTERVAL);
+    }
+}
+
+// Send the frame as the next part of the MJPEG stream
+void MjpegRequestHandler::SendFrame(IWebResponse &response, MjpegClientData &client, const shared_ptr<const XEncodedFrame> &frame, steady_clock::time_point now)
+{
+    microseconds interval = max(FrameInterval, client.AdaptiveInterval);
+    uint32_t backlog = response.ToSendDataLength();
+
+    response.Printf("--myboundary\r\n"
+                    "Content-Type: image/jpeg\r\n"
+                    "Content-Length: %u\r\n"
+                    "\r\n",
+                    frame->Size());
+    response.SendShared(frame, frame->Data(), frame->Size());
+
+    client.LastSequence = frame->Sequence();
+    client.BytesQueued += frame->Size();
+
+    // schedule next frame one interval after this one was due, so the average rate does not exceed the limit;
+    // start over if the client fell behind (no frames for a while), so it does not get a burst of frames
+    client.NextFrameTime += interval;
+
+    if (client.NextFrameTime + interval < now)
+    {
+        client.NextFrameTime = now;
+    }
+
+    lock_guard<mutex> lock(client.StatsGuard);
+
+    client.Stats.FrameInterval = static_cast<uint32_t>(duration_cast<milliseconds>(interval).count());
+    client.Stats.DrainRate = static_cast<uint32_t>(client.DrainRate);
+    client.Stats.Backlog = backlog;
+    client.Stats.FramesSent++;
+    client.Stats.BytesSent += frame->Size();
+}
+
+// Switch client to the specified quality of frames
+void MjpegRequestHandler::SetQuality(MjpegClientData &client, XStreamQuality quality, steady_clock::time_point now)
+{
+    lock_guard<mutex> lock(client.StatsGuard);
+
+    if (quality == XStreamQuality::Reduced)
+    {
+        // if full quality did not work for long after the last try, wait longer before the next one
+        if ((client.Stats.Upgrades != 0) && (now - client.LastUpgradeTime < client.UpgradeDelay))
+        {
+            client.UpgradeDelay = min(client.UpgradeDelay * 2, milliseconds(MAX_UPGRADE_DELAY));
+        }
+        else
+        {
+            client.UpgradeDelay = milliseconds(MIN_UPGRADE_DELAY);
+        }
+
+        client.Stats.Downgrades++;
+        Owner->RequestReducedFrames();
+    }
+    else
+    {
+        client.LastUpgradeTime = now;
+        client.Stats.Upgrades++;
+    }
+
+    client.Stats.Quality = quality;
+}
+
+// Update estimate of how fast the client receives data - how much of the queued data was sent since the start of measurement
+void MjpegClientData::UpdateDrainRate(steady_clock::time_point now, uint32_t backlog)
+{
+    double elapsed = duration_cast<duration<double>>(now - MeasureStartTime).count();
+    double sample = (elapsed > 0) ? (static_cast<double>(MeasureStartBacklog) + BytesQueued - backlog) / elapsed : 0;
+    bool restart = true;
+
+    if (backlog == 0)
+    {
+        // everything was sent, so the client may be even faster than that
+        DrainRate = max(DrainRate, sample);
+    }
+    else if (elapsed * 1000 < DRAIN_RATE_WINDOW)
+    {
+        restart = false;
+    }
+    else if (DrainRate == 0)
+    {
+        DrainRate = sample;
+    }
+    else
+    {
+        DrainRate = (DrainRate * 3 + sample) / 4;
+    }
+
+    if (restart)
+    {
+        MeasureStartTime = now;
+        MeasureStartBacklog = backlog;
+        BytesQueued = 0;
+    }
+}
+
+// Check if client can not keep up - sending the frame will make it lag too much behind the video
+bool MjpegClientData::IsCongested(uint32_t backlog, uint32_t frameSize)
+{
+    bool congested = false;
+
+    if (backlog != 0)
+    {
+        congested = (backlog >= 2 * frameSize) ||
+                    ((DrainRate > 0) && ((backlog + frameSize) * 1000.0 / DrainRate > MAX_CLIENT_LAG));
+    }
+
+    return congested;
+}
+
+// Check if client gets close to congestion - half of the allowed backlog or lag is used already
+bool MjpegClientData::IsNearlyCongested(uint32_t backlog, uint32_t frameSize)
+{
+    bool congested = false;
+
+    if (backlog != 0)
+    {
+        congested = (backlog >= frameSize) ||
+                    ((DrainRate > 0) && ((backlog + frameSize) * 1000.0 / DrainRate > MAX_CLIENT_LAG / 2));
+    }
+
+    return congested;
+}
+
+// Plain HTTP request to WebSocket endpoint - nothing to provide
+void WebSocketRequestHandler::HandleHttpRequest(const IWebRequest & /* request */, IWebResponse &response)
+{
+    response.SendError(400, "WebSocket connection expected");
+}
+
+// Accept WebSocket connection if video source works - the client will get frames as soon as they are published
+void WebSocketRequestHandler::HandleWebSocketRequest(const IWebRequest & /* request */, IWebResponse &response)
+{
+    if (Owner->IsError())
+    {
+        Owner->ReportError(response);
+    }
+    else
+    {
+        shared_ptr<WebSocketClientData> client = make_shared<WebSocketClientData>(++Owner->ClientCounter, ActiveClients);
+
+        client->NextFrameTime = steady_clock::now();
+
+        // the timer is only to check for errors
+        response.SetClientData(client);
+        response.Subscribe();
+        response.SetTimer(ERROR_CHECK_INTERVAL);
+
+        AddClient(client);
+    }
+}
+
+// WebSocket connection is established - provide the latest frame right away
+void WebSocketRequestHandler::HandleWebSocketOpen(IWebResponse &response)
+{
+    shared_ptr<IWebClientData> clientData = response.ClientData();
+
+    if (clientData)
+    {
+        SendLatestFrame(response, *static_cast<WebSocketClientData *>(clientData.get()));
+    }
+}
+
+// Message from the client - acknowledgement of the frame it displayed, which may allow sending next frame
+void WebSocketRequestHandler::HandleWebSocketMessage(const uint8_t *data, size_t length, IWebResponse &response)
+{
+    shared_ptr<IWebClientData> clientData = response.ClientData();
+    WebSocketClientData *client = static_cast<WebSocketClientData *>(clientData.get());
+    string message(reinterpret_cast<const char *>(data), length);
+
+    if ((client == nullptr) || (message.compare(0, 4, "ack ") != 0))
+    {
+        return;
+    }
+
+    uint64_t sequence = strtoull(message.c_str() + 4, nullptr, 10);
+
+    while ((!client->FramesInFlight.empty()) && (client->FramesInFlight.front() <= sequence))
+    {
+        client->FramesInFlight.pop_front();
+    }
+
+    SendLatestFrame(response, *client);
+}
+
+// New frame was published - send it unless the client has too many frames to acknowledge or is over its rate limit
+void WebSocketRequestHandler::HandleNotification(IWebResponse &response)
+{
+    shared_ptr<IWebClientData> clientData = response.ClientData();
+
+    if (clientData)
+    {
+        SendLatestFrame(response, *static_cast<WebSocketClientData *>(clientData.get()));
+    }
+}
+
+// Timer event for WebSocket connection - close it if video source failed
+void WebSocketRequestHandler::HandleTimer(IWebResponse &response)
+{
+    if (Owner->IsError())
+    {
+        response.CloseConnection();
+    }
+    else
+    {
+        response.SetTimer(ERROR_CHECK_INTERVAL);
+    }
+}
+
+// Send the latest frame to the client if it is new to the client and the client can take it
+void WebSocketRequestHandler::SendLatestFrame(IWebResponse &response, WebSocketClientData &client)
+{
+    shared_ptr<const XEncodedFrame> frame = Owner->LatestFrame();
+    steady_clock::time_point now = steady_clock::now();
+    uint8_t header[WS_FRAME_HEADER_SIZE] = {0};
+
+    if ((!frame) || (frame->Sequence() <= client.LastSequence))
+    {
+        return;
+    }
+
+    if (client.FramesInFlight.size() >= MaxFramesInFlight)
+    {
+        // the frame may be sent later if acknowledgement comes before the next one, but count it only once
+        if (frame->Sequence() > client.LastDroppedSequence)
+        {
+            client.LastDroppedSequence = frame->Sequence();
+            FramesDropped->Increment();
+
+            lock_guard<mutex> lock(client.StatsGuard);
+            client.Stats.FramesDropped++;
+        }
+        return;
+    }
+
+    // frames don't come exactly on time, so allow some jitter when checking if the next one is due
+    if (now + FrameInterval / 8 < client.NextFrameTime)
+    {
+        return;
+    }
+
+    // all values are big endian: version, header size, width, height, reserved, sequence, timestamp (microseconds)
+    header[0] = WS_FRAME_HEADER_VERSION;
+    header[1] = WS_FRAME_HEADER_SIZE;
+    header[2] = static_cast<uint8_t>(frame->Width() >> 8);
+    header[3] = static_cast<uint8_t>(frame->Width());
+    header[4] = static_cast<uint8_t>(frame->Height() >> 8);
+    header[5] = static_cast<uint8_t>(frame->Height());
+
+    for (int i = 0; i < 8; i++)
+    {
+        header[8 + i] = static_cast<uint8_t>(frame->Sequence() >> (56 - i * 8));
+        header[16 + i] = static_cast<uint8_t>(frame->Timestamp() >> (56 - i * 8));
+    }
+
+    response.SendWebSocketMessage(header, sizeof(header), frame, frame->Data(), frame->Size());
+
+    client.LastSequence = frame->Sequence();
+    client.FramesInFlight.push_back(frame->Sequence());
+
+    // same scheduling as for MJPEG clients - keep the average rate within the limit without bursts
+    client.NextFrameTime += FrameInterval;
+
+    if (client.NextFrameTime + FrameInterval < now)
+    {
+        client.NextFrameTime = now;
+    }
+
+    lock_guard<mutex> lock(client.StatsGuard);
+
+    client.Stats.FrameInterval = static_cast<uint32_t>(duration_cast<milliseconds>(FrameInterval).count());
+    client.Stats.Backlog = response.ToSendDataLength();
+    client.Stats.FramesInFlight = static_cast<uint32_t>(client.FramesInFlight.size());
+    client.Stats.FramesSent++;
+    client.Stats.BytesSent += frame->Size();
+}
+
+// Handle request for statistics of streaming clients
+void StreamStatsRequestHandler::HandleHttpRequest(const IWebRequest & /* request */, IWebResponse &response)
+{
+    vector<XStreamClientStats> stats;
+    vector<XFrameLatencyStats> latencies;
+    string reply = "{\"status\":\"OK\",\"clients\":[";
+    char buffer[384];
+    bool first = true;
+
+    for (const weak_ptr<StreamRequestHandler> &weakHandler : *atomic_load(&Owner->StreamHandlers))
+    {
+        shared_ptr<StreamRequestHandler> handler = weakHandler.lock();
+
+        if (handler)
+        {
+            handler->CollectStats(stats);
+        }
+    }
+
+    for (const XStreamClientStats &client : stats)
+    {
+        snprintf(buffer, sizeof(buffer),
+                 "%s{\"id\":%u,\"quality\":\"%s\",\"interval\":%u,\"drainRate\":%u,\"backlog\":%u,\"inFlight\":%u,"
+                 "\"framesSent\":%llu,\"framesDropped\":%llu,\"bytesSent\":%llu,\"downgrades\":%u,\"upgrades\":%u}",
+                 (first) ? "" : ",", client.Id, (client.Quality == XStreamQuality::Full) ? "full" : "reduced",
+                 client.FrameInterval, client.DrainRate, client.Backlog, client.FramesInFlight,
+                 static_cast<unsigned long long>(client.FramesSent), static_cast<unsigned long long>(client.FramesDropped),
+                 static_cast<unsigned long long>(client.BytesSent), client.Downgrades, client.Upgrades);
+
+        reply += buffer;
+        first = false;
+    }
+
+    reply += "],\"latency\":[";
+    first = true;
+
+    Owner->CollectLatencies(latencies);
+
+    for (const XFrameLatencyStats &latency : latencies)
+    {
+        string consumer = latency.Consumer;
+
+        StringReplace(consumer, "\\", "\\\\");
+        StringReplace(consumer, "\"", "\\\"");
+
+        // names may be of any length, so they don't go through the buffer
+        reply += (first) ? "{\"consumer\":\"" : ",{\"consumer\":\"";
+        reply += consumer;
+
+        snprintf(buffer, sizeof(buffer), "\",\"uplink\":%s,\"frames\":%llu,\"p50\":%.1f,\"p99\":%.1f,\"max\":%.1f}",
+                 (latency.IsUplink) ? "true" : "false", static_cast<unsigned long long>(latency.Frames),
+                 latency.P50 / 1000.0, latency.P99 / 1000.0, latency.Max / 1000.0);
+
+        reply += buffer;
+        first = false;
+    }
+
+    reply += "]}";
+
+    response.Printf("HTTP/1.1 200 OK\r\n"
+                    "Content-Type: application/json\r\n"
+                    "Content-Length: %d\r\n"
+                    "Cache-Control: no-store, must-revalidate\r\nPragma: no-cache\r\nExpires: 0\r\n"
+                    "\r\n"
+                    "%s",
+                    (int)reply.length(), reply.c_str());
+}
+
+// Check if any errors happened
+bool XVideoSourceToWebData::IsError()
+{
+    return ((InternalError != XError::Success) || (VideoSourceError));
+}
+
+// Report an error as HTTP response
+void XVideoSourceToWebData::ReportError(IWebResponse &response)
+{
+    XError error = static_cast<XError::ErrorCode>(InternalError.load());
+
+    if (error != XError::Success)
+    {
+        response.SendError(500, error.ToString().c_str());
+    }
+    else if (VideoSourceError)
+    {
+        lock_guard<mutex> lock(ErrorGuard);
+        response.SendError(500, VideoSourceErrorMessage.c_str());
+    }
+}
+
+// Encode the specified camera image as JPEG into a new frame, which is not shared with anyone yet.
+// Only the video source thread calls this, so the encoder does not need any guarding.
+shared_ptr<const XEncodedFrame> XVideoSourceToWebData::EncodeCameraImage(const shared_ptr<const XImage> &image, uint64_t receivedTime)
+{
+    uint64_t timestamp = image->Timestamp();
+    XFrameCheckpoints checkpoints;
+    shared_ptr<const XEncodedFrame> frame;
+    shared_ptr<const XImage> frameData;
+    shared_ptr<XImage> buffer;
+    uint32_t jpegSize = 0;
+    int32_t width = image->Width();
+    int32_t height = image->Height();
+
+    // use time of arrival if video source did not provide capture time
+    if (timestamp == 0)
+    {
+        timestamp = receivedTime;
+    }
+
+    if (image->Format() == XPixelFormat::JPEG)
+    {
+        jpegSize = image->Width();
+
+        // leased images are not touched by video source, so they can be kept as they are - copy JPEG data otherwise
+        if (image->IsLeased())
+        {
+            frameData = image;
+        }
+        else
+        {
+            buffer = BufferPool.Acquire(jpegSize, 1, XPixelFormat::JPEG);
+
+            if (buffer)
+            {
+                memcpy(buffer->Data(), image->Data(), jpegSize);
+                frameData = buffer;
+            }
+        }
+
+        if (!frameData)
+        {
+            InternalError = XError::OutOfMemory;
+        }
+        else
+        {
+            InternalError = XError::Success;
+
+            // JPEG images don't tell their size, so look into the frame header
+            if (XJpegEncoder::GetImageSize(frameData->Data(), jpegSize, &width, &height) != XError::Success)
+            {
+                width = height = 0;
+            }
+        }
+    }
+    else
+    {
+        XError error;
+
+        frameData = EncodeToPooledBuffer(JpegEncoder, image, ExpectedJpegSize, &jpegSize, &error);
+        InternalError = error.Code();
+    }
+
+    if (frameData)
+    {
+        // the frame is published right after it is created
+        checkpoints.Received = receivedTime;
+        checkpoints.Encoded = XEncodedFrame::Now();
+
+        frame = XEncodedFrame::Create(frameData, jpegSize, FrameSequence + 1, timestamp, width, height, image->Sequence(), checkpoints);
+
+        if (!frame)
+        {
+            InternalError = XError::OutOfMemory;
+        }
+    }
+
+    return frame;
+}
+
+// Encode the image as JPEG into a buffer taken from the pool. The expected size is the size of buffer to acquire,
+// which gets updated to fit next images of similar size.
+shared_ptr<XImage> XVideoSourceToWebData::EncodeToPooledBuffer(XJpegEncoder &encoder, const shared_ptr<const XImage> &image, uint32_t &expectedSize, uint32_t *jpegSize, XError *error)
+{
+    shared_ptr<XImage> buffer = BufferPool.Acquire(expectedSize, 1, XPixelFormat::JPEG);
+    XError ret = XError::Success;
+
+    if (!buffer)
+    {
+        ret = XError::OutOfMemory;
+    }
+    else
+    {
+        uint8_t *encodedData = buffer->Data();
+
+        // encode image as JPEG using all space of the pooled buffer
+        *jpegSize = static_cast<uint32_t>(buffer->Stride());
+        ret = encoder.EncodeToMemory(image, &encodedData, jpegSize);
+
+        if (encodedData != buffer->Data())
+        {
+            // encoder allocated new buffer since the provided one was too small - move it into pool's buffer
+            buffer.reset();
+
+            if (ret == XError::Success)
+            {
+                buffer = BufferPool.Acquire(*jpegSize, 1, XPixelFormat::JPEG);
+
+                if (buffer)
+                {
+                    memcpy(buffer->Data(), encodedData, *jpegSize);
+                }
+                else
+                {
+                    ret = XError::OutOfMemory;
+                }
+            }
+
+            free(encodedData);
+        }
+
+        if (ret != XError::Success)
+        {
+            buffer.reset();
+        }
+        else
+        {
+            // make next buffer 25% bigger than the last image, so most frames fit into it
+            expectedSize = *jpegSize + *jpegSize / 4;
+        }
+    }
+
+    if (error != nullptr)
+    {
+        *error = ret;
+    }
+
+    return buffer;
+}
+
+// Make the specified frame the latest one available to all consumers
+void XVideoSourceToWebData::PublishFrame(const shared_ptr<const XEncodedFrame> &frame)
+{
+    FrameSequence = frame->Sequence();
+    atomic_store(&CurrentFrame, frame);
+
+    // wake streaming clients, so they get the frame right away
+    NotifyStreamHandlers();
+}
+
+// Check if reduced frames must be provided - some client asked for them recently
+bool XVideoSourceToWebData::IsReducedFrameWanted()
+{
+    steady_clock::rep demandTime = ReducedDemandTime;
+
+    return ((ReducedQualityEnabled) && (demandTime != 0) &&
+            (steady_clock::now().time_since_epoch().count() - demandTime < duration_cast<steady_clock::duration>(milliseconds(REDUCED_DEMAND_TIMEOUT)).count()));
+}
+
+// Let video thread know that reduced frames are needed by some client
+void XVideoSourceToWebData::RequestReducedFrames()
+{
+    ReducedDemandTime = steady_clock::now().time_since_epoch().count();
+}
+
+// Make reduced version of the frame (half size, lower quality) and publish it for slow MJPEG clients.
+// Only the video source thread calls this, so decoder/encoder do not need any guarding.
+void XVideoSourceToWebData::EncodeAndPublishReducedFrame(const shared_ptr<const XEncodedFrame> &frame)
+{
+    shared_ptr<const XEncodedFrame> reducedFrame;
+    shared_ptr<XImage> buffer;
+    uint32_t jpegSize = 0;
+
+    // scaled down decoding is done by libjpeg at DCT level, which is a lot cheaper than full decoding
+    if (ReducedDecoder.DecodeToImage(frame->Data(), frame->Size(), REDUCED_SCALE_DOWN, ReducedImage) == XError::Success)
+    {
+        buffer = EncodeToPooledBuffer(ReducedEncoder, ReducedImage, ExpectedReducedSize, &jpegSize, nullptr);
+    }
+
+    if (buffer)
+    {
+        XFrameCheckpoints checkpoints = frame->Checkpoints();
+
+        checkpoints.Encoded = XEncodedFrame::Now();
+
+        reducedFrame = XEncodedFrame::Create(buffer, jpegSize, frame->Sequence(), frame->Timestamp(),
+                                             ReducedImage->Width(), ReducedImage->Height(), frame->SourceSequence(), checkpoints);
+    }
+
+    if (reducedFrame)
+    {
+        atomic_store(&CurrentReducedFrame, reducedFrame);
+        NotifyStreamHandlers();
+    }
+}
+
+// Get the latest reduced frame (may be empty or older than the latest frame)
+shared_ptr<const XEncodedFrame> XVideoSourceToWebData::LatestReducedFrame()
+{
+    return atomic_load(&CurrentReducedFrame);
+}
+
+// Notify streaming request handlers about new frame
+void XVideoSourceToWebData::NotifyStreamHandlers()
+{
+    shared_ptr<const HandlerList> handlers = atomic_load(&StreamHandlers);
+
+    for (const weak_ptr<StreamRequestHandler> &weakHandler : *handlers)
+    {
+        shared_ptr<StreamRequestHandler> handler = weakHandler.lock();
+
+        if (handler)
+        {
+            handler->NotifySubscribers();
+        }
+    }
+}
+
+// Add handler, which needs to be notified about new frames - the list is replaced as a whole like the list of uplinks
+void XVideoSourceToWebData::AddStreamHandler(const shared_ptr<StreamRequestHandler> &handler)
+{
+    lock_guard<mutex> lock(StreamHandlersGuard);
+    shared_ptr<HandlerList> newList = make_shared<HandlerList>();
+
+    // forget handlers, which are gone already
+    for (const weak_ptr<StreamRequestHandler> &weakHandler : *atomic_load(&StreamHandlers))
+    {
+        if (!weakHandler.expired())
+        {
+            newList->push_back(weakHandler);
+        }
+    }
+
+    newList->push_back(handler);
+    atomic_store(&StreamHandlers, shared_ptr<const HandlerList>(newList));
+}
+
+// Collect latency of frames provided by streaming handlers and uplinks (started ones only)
+void XVideoSourceToWebData::CollectLatencies(vector<XFrameLatencyStats> &latencies)
+{
+    for (const weak_ptr<StreamRequestHandler> &weakHandler : *atomic_load(&StreamHandlers))
+    {
+        shared_ptr<StreamRequestHandler> handler = weakHandler.lock();
+
+        if (handler)
+        {
+            handler->CollectLatency(latencies);
+        }
+    }
+
+    for (const shared_ptr<XUplinkSender> &uplink : *CurrentUplinks())
+    {
+        const XMetricHistogram *frameLatency = uplink->FrameLatency();
+
+        if (frameLatency != nullptr)
+        {
+            XFrameLatencyStats latency;
+
+            latency.Consumer = uplink->Name();
+            latency.IsUplink = true;
+            latency.Frames = frameLatency->Count();
+            latency.P50 = frameLatency->Quantile(0.5);
+            latency.P99 = frameLatency->Quantile(0.99);
+            latency.Max = frameLatency->Max();
+
+            latencies.push_back(latency);
         }
-        NewImageAvailable = false;
     }
 }
-string XVideoSourceToWebData::timeNow() {
-    time_t t = time(0);
-    char buffer[9] = {0};
 
-    strftime(buffer, 9, "%H:%M:%S", localtime(&t));
-    return string(buffer);
+// Get the latest published frame (may be empty if nothing was published yet)
+shared_ptr<const XEncodedFrame> XVideoSourceToWebData::LatestFrame()
+{
+    return atomic_load(&CurrentFrame);
+}
+
+// Add uplink to the list - the list is replaced as a whole, so the video thread never waits for it
+void XVideoSourceToWebData::AddUplink(const shared_ptr<XUplinkSender> &uplink)
+{
+    lock_guard<mutex> lock(UplinksGuard);
+    shared_ptr<UplinkList> newList = make_shared<UplinkList>(*atomic_load(&Uplinks));
+
+    if (find(newList->begin(), newList->end(), uplink) == newList->end())
+    {
+        newList->push_back(uplink);
+        atomic_store(&Uplinks, shared_ptr<const UplinkList>(newList));
+    }
+}
+
+// Remove uplink from the list
+void XVideoSourceToWebData::RemoveUplink(const shared_ptr<XUplinkSender> &uplink)
+{
+    lock_guard<mutex> lock(UplinksGuard);
+    shared_ptr<UplinkList> newList = make_shared<UplinkList>(*atomic_load(&Uplinks));
+
+    newList->erase(remove(newList->begin(), newList->end(), uplink), newList->end());
+    atomic_store(&Uplinks, shared_ptr<const UplinkList>(newList));
+}
+
+// Get current list of uplinks
+shared_ptr<const UplinkList> XVideoSourceToWebData::CurrentUplinks()
+{
+    return atomic_load(&Uplinks);
 }
 
 } // namespace Private
@@ -23,16 +23,54 @@
 
 #include <string>
 #include <memory>
+#include <vector>
 
 #include "XInterfaces.hpp"
 #include "IVideoSourceListener.hpp"
 #include "XWebServer.hpp"
+#include "XUplinkSender.hpp"
+#include "XImagePool.hpp"
 
 namespace Private
 {
     class XVideoSourceToWebData;
 }
 
+// Quality of frames sent to streaming client
+enum class XStreamQuality
+{
+    Full = 0,
+    Reduced     // half size frames encoded with lower JPEG quality
+};
+
+// Statistics of a client receiving MJPEG or WebSocket stream
+struct XStreamClientStats
+{
+    uint32_t       Id;
+    XStreamQuality Quality;
+    uint32_t       FrameInterval;   // current interval between frames, ms (0 - every frame)
+    uint32_t       DrainRate;       // estimated rate the client receives data at, bytes/s
+    uint32_t       Backlog;         // bytes queued for the client
+    uint32_t       FramesInFlight;  // frames sent, but not acknowledged yet (WebSocket clients)
+    uint64_t       FramesSent;
+    uint64_t       FramesDropped;   // frames skipped since the client could not keep up
+    uint64_t       BytesSent;
+    uint32_t       Downgrades;
+    uint32_t       Upgrades;
+};
+
+// Latency of frames provided to a consumer - time from capture of a frame till its last byte was sent,
+// microseconds. Collected since start of the application.
+struct XFrameLatencyStats
+{
+    std::string    Consumer;        // URI of streaming endpoint or name of uplink sink
+    bool           IsUplink;
+    uint64_t       Frames;
+    uint64_t       P50;             // estimated from histogram buckets
+    uint64_t       P99;
+    uint64_t       Max;
+};
+
 class XVideoSourceToWeb : private Uncopyable
 {
 public:
@@ -42,16 +80,53 @@ public:
     // Get video source listener, which could be fed to some video source
     IVideoSourceListener* VideoSourceListener( ) const;
 
-    // Create web request handler to provide camera images as JPEGs
+    // Create web request handler to provide camera images as JPEGs. Requests with "after=<sequence>"
+    // wait for a frame newer than the specified one (or time out with 204 status); sequence number
+    // of the provided frame is reported by the X-Frame-Sequence header.
     std::shared_ptr<IWebRequestHandler> CreateJpegHandler( const std::string& uri ) const;
 
-    // Create web request handler to provide camera images as MJPEG stream
+    // Create web request handler to provide camera images as MJPEG stream. Every new frame is pushed
+    // to clients as soon as it is available; frame rate limits rate of each client (0 - no limit).
+    // Clients, which can not keep up, are switched to reduced quality and then to lower frame rate.
     std::shared_ptr<IWebRequestHandler> CreateMjpegHandler( const std::string& uri, uint32_t frameRate ) const;
 
+    // Create web request handler to provide camera images over WebSocket. Every frame is sent as binary
+    // message - 24 bytes header (big endian: version, header size, width and height as 8/8/16/16 bits,
+    // 16 bits reserved, 64 bits sequence number and capture time in microseconds) followed by JPEG data.
+    // Clients acknowledge shown frames sending "ack <sequence>" text messages; no more than the specified
+    // number of frames are sent ahead of acknowledgements. Frame rate limits rate of each client (0 - no limit).
+    std::shared_ptr<IWebRequestHandler> CreateWebSocketHandler( const std::string& uri, uint32_t frameRate,
+                                                                uint32_t maxFramesInFlight = 2 ) const;
+
+    // Create web request handler providing statistics of MJPEG/WebSocket clients and frames' latency as JSON
+    std::shared_ptr<IWebRequestHandler> CreateStreamStatsHandler( const std::string& uri ) const;
+    // Get statistics of all clients currently receiving MJPEG/WebSocket streams
+    std::vector<XStreamClientStats> StreamClients( ) const;
+    // Get latency of frames provided by every streaming endpoint and uplink sink
+    std::vector<XFrameLatencyStats> FrameLatencies( ) const;
+
+    // Add/Remove uplink sink receiving all new frames (can be done while video source is running).
+    // Sinks are started/stopped by the caller.
+    void AddUplink( const std::shared_ptr<XUplinkSender>& uplink );
+    void RemoveUplink( const std::shared_ptr<XUplinkSender>& uplink );
+    // Get list of currently configured uplink sinks
+    std::vector<std::shared_ptr<XUplinkSender>> Uplinks( ) const;
+
+    // Get pool of buffers used for encoded frames (to check its hit/miss statistics)
+    const XImagePool& BufferPool( ) const;
+
     // Get/Set JPEG quality (valid only if camera provides uncompressed images)
     uint16_t JpegQuality( ) const;
     void SetJpegQuality( uint16_t quality );
 
+    // Get/Set number of threads used for JPEG encoding (valid only if camera provides uncompressed images)
+    uint32_t JpegThreadCount( ) const;
+    void SetJpegThreadCount( uint32_t threadCount );
+
+    // Get/Set JPEG quality of reduced frames sent to slow MJPEG clients (0 - don't reduce quality, only frame rate)
+    uint16_t ReducedJpegQuality( ) const;
+    void SetReducedJpegQuality( uint16_t quality );
+
 private:
     Private::XVideoSourceToWebData* mData;
 };
@@ -20,10 +20,16 @@
 
 #include "XWebServer.hpp"
 #include "XManualResetEvent.hpp"
+#include "XStringTools.hpp"
+#include "XMetrics.hpp"
 
 #include <map>
 #include <list>
+#include <deque>
+#include <vector>
 #include <mutex>
+#include <atomic>
+#include <algorithm>
 
 #include <mongoose.h>
 
@@ -31,12 +37,158 @@
     #include <windows.h>
 #endif
 
+#ifdef __linux__
+    #include <sys/ioctl.h>
+    #include <linux/sockios.h>
+#endif
+
+#ifndef WIN32
+    #include <errno.h>
+    #include <sys/socket.h>
+    #include <sys/uio.h>
+#endif
+
 using namespace std;
 using namespace std::chrono;
 
 namespace Private
 {
     #define DEFAULT_AUTH_DOMAIN "cam2web"
+    #define MAX_THREAD_COUNT    (32)
+
+    // Several event loops can listen on the same port only if the system can balance connections between them
+    #if defined( SO_REUSEPORT ) && !defined( WIN32 )
+        #define XWEB_SERVER_SHARED_PORT
+    #endif
+
+    // Shared buffers are written to sockets with scatter/gather I/O instead of being copied into connections' buffers
+    #ifndef WIN32
+        #define XWEB_SERVER_SHARED_SEND
+    #endif
+
+    #ifndef MSG_NOSIGNAL
+        #define MSG_NOSIGNAL (0)
+    #endif
+
+    // maximum number of buffers to write with one system call
+    #define MAX_SEND_SEGMENTS   (16)
+    // amount of queued data to put into connection's buffer, so the event loop waits for the socket to become writable
+    #define PARKED_DATA_SIZE    (4096)
+
+    // interval mongoose pings idle WebSocket connections at (as it is set in mongoose.c)
+    #ifndef MG_WEBSOCKET_PING_INTERVAL_SECONDS
+        #define MG_WEBSOCKET_PING_INTERVAL_SECONDS (5)
+    #endif
+
+    // maximum number of digest authentication sessions to remember
+    #define MAX_DIGEST_SESSIONS (256)
+    // number of the latest nonce counts remembered by a session (requests may come out of order over several connections)
+    #define NONCE_COUNT_WINDOW  (64)
+
+    // Get next comma separated item of a header's value (trimmed) - returns false if there are no more
+    static bool NextHeaderItem( const string& value, size_t& offset, string& item )
+    {
+        size_t end;
+
+        if ( offset >= value.length( ) )
+        {
+            return false;
+        }
+
+        end = value.find( ',', offset );
+        if ( end == string::npos )
+        {
+            end = value.length( );
+        }
+
+        item   = value.substr( offset, end - offset );
+        offset = end + 1;
+
+        StringTrim( item );
+
+        return true;
+    }
+
+    // Compare strings ignoring case
+    static bool IsEqualNoCase( const string& s1, const char* s2 )
+    {
+        size_t length = strlen( s2 );
+
+        return ( ( s1.length( ) == length ) &&
+                 ( equal( s1.begin( ), s1.end( ), s2, [] ( char c1, char c2 ) { return tolower( c1 ) == tolower( c2 ); } ) ) );
+    }
+
+    // Check if the content coding is accepted according to value of Accept-Encoding header
+    static bool IsEncodingAccepted( const string& acceptEncoding, const char* coding )
+    {
+        size_t offset     = 0;
+        bool   isAccepted = false;
+        bool   isStar     = false;
+        string item;
+
+        while ( NextHeaderItem( acceptEncoding, offset, item ) )
+        {
+            size_t paramsStart = item.find( ';' );
+            string name        = item.substr( 0, paramsStart );
+            bool   isQualified = true;
+
+            StringTrim( name );
+
+            // codings with zero quality value are not acceptable
+            if ( paramsStart != string::npos )
+            {
+                size_t qualityStart = item.find( "q=", paramsStart );
+
+                if ( qualityStart != string::npos )
+                {
+                    isQualified = ( atof( item.c_str( ) + qualityStart + 2 ) > 0 );
+                }
+            }
+
+            if ( IsEqualNoCase( name, coding ) )
+            {
+                return isQualified;
+            }
+            else if ( name == "*" )
+            {
+                isStar     = true;
+                isAccepted = isQualified;
+            }
+        }
+
+        return ( ( isStar ) && ( isAccepted ) );
+    }
+
+    // Check if any of the entity tags listed in If-None-Match header is for the content with the specified hash
+    static bool IsEntityTagMatching( const string& ifNoneMatch, const char* hash )
+    {
+        size_t offset     = 0;
+        size_t hashLength = strlen( hash );
+        string item;
+
+        while ( NextHeaderItem( ifNoneMatch, offset, item ) )
+        {
+            if ( item == "*" )
+            {
+                return true;
+            }
+
+            // weak comparison is fine for GET requests
+            if ( item.compare( 0, 2, "W/" ) == 0 )
+            {
+                item.erase( 0, 2 );
+            }
+
+            // tags of compressed variants have the coding appended to the hash
+            if ( ( item.length( ) > hashLength + 1 ) && ( item[0] == '"' ) && ( item.compare( 1, hashLength, hash ) == 0 ) &&
+                 ( ( item[hashLength + 1] == '"' ) || ( item[hashLength + 1] == '-' ) ) )
+            {
+                return true;
+            }
+        }
+
+        return false;
+    }
 
     /* ================================================================= */
     /* Web request implementation using Mangoose APIs                    */
@@ -96,6 +248,12 @@ namespace Private
 
             return ret;
         }
+        string Header( const string& name ) const
+        {
+            struct mg_str* value = mg_get_http_header( mMessage, name.c_str( ) );
+
+            return ( value == nullptr ) ? string( ) : string( value->p, value->p + value->len );
+        }
         map<string, string> Headers( ) const
         {
             map<string, string> headers;
@@ -110,6 +268,102 @@ namespace Private
 
             return headers;
         }
+
+        XStringView UriView( ) const
+        {
+            return ToView( mMessage->uri );
+        }
+        XStringView MethodView( ) const
+        {
+            return ToView( mMessage->method );
+        }
+        XStringView QueryView( ) const
+        {
+            return ToView( mMessage->query_string );
+        }
+        XStringView BodyView( ) const
+        {
+            return ToView( mMessage->body );
+        }
+        XStringView HeaderView( const char* name ) const
+        {
+            struct mg_str* value = mg_get_http_header( mMessage, name );
+
+            return ( value == nullptr ) ? XStringView( ) : ToView( *value );
+        }
+
+    private:
+        // Mongoose leaves pointers of missing parts empty
+        static XStringView ToView( const struct mg_str& str )
+        {
+            return ( str.p == nullptr ) ? XStringView( ) : XStringView( str.p, str.len );
+        }
+    };
+
+    /* ================================================================= */
+    /* Data kept with every client connection                            */
+    /* ================================================================= */
+    class ConnectionContext
+    {
+    private:
+        // Part of a buffer queued for sending, which is referenced instead of copied
+        struct SendSegment
+        {
+            shared_ptr<const void> Owner;
+            const uint8_t*         Data;
+            size_t                 Length;
+            IWebRequestHandler*    Handler;         // told when the segment is sent (none for copied data)
+        };
+
+    public:
+        IWebRequestHandler*        Handler;
+        shared_ptr<IWebClientData> ClientData;
+        bool                       IsTimerSet;
+        bool                       IsSubscribed;
+        XMetricCounter*            SentBytes;       // bytes sent for the handler of the last request
+
+    private:
+        // Data to send after connection's own buffer. Only the first part of connection's buffer goes before the
+        // queue - anything added to it later is moved to the end of the queue, so the data is sent in order.
+        deque<SendSegment>         SendQueue;
+        size_t                     SendQueueLength;
+        size_t                     BufferedBeforeQueue;
+        bool                       CloseWhenSent;
+
+    public:
+        ConnectionContext( ) :
+            Handler( nullptr ), ClientData( ), IsTimerSet( false ), IsSubscribed( false ), SentBytes( nullptr ),
+            SendQueue( ), SendQueueLength( 0 ), BufferedBeforeQueue( 0 ), CloseWhenSent( false )
+        { }
+
+        // Amount of data queued in addition to connection's buffer
+        size_t QueuedLength( ) const
+        {
+            return SendQueueLength;
+        }
+
+        // Check if connection is going to be closed once all queued data is sent
+        bool IsClosing( ) const
+        {
+            return CloseWhenSent;
+        }
+
+        // Queue shared buffer for sending and send as much as possible right away
+        void QueueShared( struct mg_connection* connection, IWebRequestHandler* handler,
+                          const shared_ptr<const void>& owner, const uint8_t* data, size_t length );
+        // Queue copy of the data for sending after everything queued so far
+        void QueueCopy( struct mg_connection* connection, const uint8_t* data, size_t length );
+        // Move anything written into connection's buffer while data is queued to the end of the queue, so the
+        // event loop never sends it in the middle of queued data
+        void KeepOrder( struct mg_connection* connection );
+        // Handle data sent by the event loop from connection's buffer
+        void OnSent( size_t length );
+        // Send queued data until it is all sent or socket can not take more
+        void Flush( struct mg_connection* connection );
+
+    private:
+        void MoveBufferedToQueue( struct mg_connection* connection );
+        void PopSent( );
     };
 
     /* ================================================================= */
@@ -123,6 +377,17 @@ namespace Private
         struct mg_connection* mConnection;
         IWebRequestHandler*   mHandler;
 
+        // Get context of the connection, creating it if needed
+        ConnectionContext* Context( )
+        {
+            if ( mConnection->user_data == nullptr )
+            {
+                mConnection->user_data = new ConnectionContext( );
+            }
+
+            return static_cast<ConnectionContext*>( mConnection->user_data );
+        }
+
     private:
         MangooseWebResponse( struct mg_connection* connection, IWebRequestHandler* handler = nullptr ) :
             mConnection( connection ), mHandler( handler )
@@ -139,7 +404,24 @@ namespace Private
         // Length of data, which is still enqueued for sending
         size_t ToSendDataLength( ) const 
         {
-            return mConnection->send_mbuf.len;
+            size_t length = mConnection->send_mbuf.len;
+
+            if ( mConnection->user_data != nullptr )
+            {
+                length += static_cast<ConnectionContext*>( mConnection->user_data )->QueuedLength( );
+            }
+
+#ifdef __linux__
+            // socket's buffer may hold a lot of data on its own, which makes a difference for slow clients
+            int unsent = 0;
+
+            if ( ( ioctl( mConnection->sock, SIOCOUTQ, &unsent ) == 0 ) && ( unsent > 0 ) )
+            {
+                length += static_cast<size_t>( unsent );
+            }
+#endif
+
+            return length;
         }
 
         // Send the specified buffer into response
@@ -148,6 +430,22 @@ namespace Private
             mg_send( mConnection, buffer, static_cast<int>( length ) );
         }
 
+        // Send the specified buffer into response without copying it - the owner keeps it alive till it is sent
+        void SendShared( const shared_ptr<const void>& owner, const uint8_t* buffer, size_t length )
+        {
+#ifdef XWEB_SERVER_SHARED_SEND
+            Context( )->QueueShared( mConnection, mHandler, owner, buffer, length );
+#else
+            mg_send( mConnection, buffer, static_cast<int>( length ) );
+
+            // the data is copied into connection's buffer, which is as close to sending it as it gets here
+            if ( ( mHandler != nullptr ) && ( owner ) )
+            {
+                mHandler->HandleSharedSent( owner );
+            }
+#endif
+        }
+
         // Print formatted response
         void Printf( const char *fmt, ... )
         {
@@ -193,6 +491,66 @@ namespace Private
             mg_http_send_error( mConnection, errorCode, reason );
         }
 
+        // Send binary WebSocket message made of the specified header and shared buffer
+        void SendWebSocketMessage( const uint8_t* header, size_t headerLength,
+                                   const shared_ptr<const void>& owner, const uint8_t* buffer, size_t length )
+        {
+            uint64_t messageLength = headerLength + length;
+            uint8_t  frameHeader[10];
+            size_t   frameHeaderLength = 2;
+
+            // server's frames are not masked, so only the length needs encoding
+            frameHeader[0] = 0x80 | WEBSOCKET_OP_BINARY;
+
+            if ( messageLength < 126 )
+            {
+                frameHeader[1] = static_cast<uint8_t>( messageLength );
+            }
+            else if ( messageLength <= 0xFFFF )
+            {
+                frameHeader[1] = 126;
+                frameHeader[2] = static_cast<uint8_t>( messageLength >> 8 );
+                frameHeader[3] = static_cast<uint8_t>( messageLength );
+                frameHeaderLength = 4;
+            }
+            else
+            {
+                frameHeader[1] = 127;
+                for ( int i = 0; i < 8; i++ )
+                {
+                    frameHeader[2 + i] = static_cast<uint8_t>( messageLength >> ( 56 - i * 8 ) );
+                }
+                frameHeaderLength = 10;
+            }
+
+            mg_send( mConnection, frameHeader, static_cast<int>( frameHeaderLength ) );
+            mg_send( mConnection, header, static_cast<int>( headerLength ) );
+            SendShared( owner, buffer, length );
+        }
+
+        // Send formatted text WebSocket message
+        void PrintfWebSocketMessage( const char* fmt, ... )
+        {
+            char    mem[MG_VPRINTF_BUFFER_SIZE];
+            char*   buf = mem;
+            int     len;
+            va_list list;
+
+            va_start( list, fmt );
+            len = mg_avprintf( &buf, sizeof( mem ), fmt, list );
+            va_end( list );
+
+            if ( len >= 0 )
+            {
+                mg_send_websocket_frame( mConnection, WEBSOCKET_OP_TEXT, buf, len );
+            }
+
+            if ( ( buf != mem ) && ( buf != nullptr ) )
+            {
+                free( buf );
+            }
+        }
+
         // Close connection associated with the response
         void CloseConnection( )
         {
@@ -204,9 +562,38 @@ namespace Private
         // after the specified number of milliseconds
         void SetTimer( uint32_t msec )
         {
-            mConnection->user_data = mHandler;
+            ConnectionContext* context = Context( );
+
+            context->Handler    = mHandler;
+            context->IsTimerSet = true;
             mg_set_timer( mConnection, mg_time( ) + (double) msec / 1000 );
         }
+
+        // Subscribe the connection to notifications of its handler
+        void Subscribe( )
+        {
+            ConnectionContext* context = Context( );
+
+            context->Handler      = mHandler;
+            context->IsSubscribed = true;
+        }
+
+        // Stop delivering notifications to the connection
+        void Unsubscribe( )
+        {
+            Context( )->IsSubscribed = false;
+        }
+
+        // Get/Set data kept with the connection till it closes
+        shared_ptr<IWebClientData> ClientData( ) const
+        {
+            return ( mConnection->user_data == nullptr ) ? shared_ptr<IWebClientData>( ) :
+                   static_cast<ConnectionContext*>( mConnection->user_data )->ClientData;
+        }
+        void SetClientData( const shared_ptr<IWebClientData>& data )
+        {
+            Context( )->ClientData = data;
+        }
     };
 
     /* ================================================================= */
@@ -215,19 +602,181 @@ namespace Private
     class RequestHandlerData
     {
     public:
-        shared_ptr<IWebRequestHandler>  Handler;
-        UserGroup                       AllowedUserGroup;
-        steady_clock::time_point        LastAccessTime;
-        bool                            WasAccessed;
+        shared_ptr<IWebRequestHandler>   Handler;
+        UserGroup                        AllowedUserGroup;
+        // updated from all event loops of the server
+        atomic<steady_clock::time_point> LastAccessTime;
+        atomic<bool>                     WasAccessed;
+        XMetricCounter*                  Requests;
+        XMetricCounter*                  SentBytes;
     public:
         RequestHandlerData( ) :
             Handler( ), AllowedUserGroup( UserGroup::Anyone ),
-            LastAccessTime( ), WasAccessed( false )
+            LastAccessTime( steady_clock::time_point( ) ), WasAccessed( false ),
+            Requests( nullptr ), SentBytes( nullptr )
         { }
 
         RequestHandlerData( const shared_ptr<IWebRequestHandler>& handler, UserGroup allowedUserGroup ) :
-            Handler( handler), AllowedUserGroup( allowedUserGroup )
+            Handler( handler), AllowedUserGroup( allowedUserGroup ),
+            LastAccessTime( steady_clock::time_point( ) ), WasAccessed( false ),
+            Requests( nullptr ), SentBytes( nullptr )
+        {
+            XMetricsRegistry& metrics = XMetricsRegistry::Instance( );
+            string            label   = XMetricsRegistry::Label( "endpoint", handler->Uri( ) );
+
+            Requests  = &metrics.Counter( "cam2web_http_requests_total", "Requests handled by the endpoint.", label );
+            SentBytes = &metrics.Counter( "cam2web_http_sent_bytes_total", "Bytes sent to clients of the endpoint.", label );
+        }
+
+        RequestHandlerData( const RequestHandlerData& rhs ) :
+            Handler( rhs.Handler ), AllowedUserGroup( rhs.AllowedUserGroup ),
+            LastAccessTime( rhs.LastAccessTime.load( ) ), WasAccessed( rhs.WasAccessed.load( ) ),
+            Requests( rhs.Requests ), SentBytes( rhs.SentBytes )
         { }
+
+        RequestHandlerData& operator=( const RequestHandlerData& rhs )
+        {
+            Handler          = rhs.Handler;
+            AllowedUserGroup = rhs.AllowedUserGroup;
+            LastAccessTime   = rhs.LastAccessTime.load( );
+            WasAccessed      = rhs.WasAccessed.load( );
+            Requests         = rhs.Requests;
+            SentBytes        = rhs.SentBytes;
+            return *this;
+        }
+    };
+
+    /* ================================================================= */
+    /* Event loop of the web server - own manager, connections and thread */
+    /* ================================================================= */
+    class XWebServerData;
+
+    class WebServerWorker
+    {
+    public:
+        XWebServerData*             Owner;
+        struct mg_mgr               EventManager;
+        XManualResetEvent           IsStopped;
+        bool                        IsThreadStarted;
+
+        // handlers, which asked to notify their subscribers, and socket to wake the event loop with
+        mutex                       NotificationSync;
+        vector<IWebRequestHandler*> PendingNotifications;
+        sock_t                      WakeupSocket;
+
+    public:
+        WebServerWorker( XWebServerData* owner ) :
+            Owner( owner ), EventManager( { 0 } ), IsStopped( ), IsThreadStarted( false ),
+            NotificationSync( ), PendingNotifications( ), WakeupSocket( INVALID_SOCKET )
+        {
+            mg_mgr_init( &EventManager, owner );
+        }
+
+        ~WebServerWorker( )
+        {
+            mg_mgr_free( &EventManager );
+
+            if ( WakeupSocket != INVALID_SOCKET )
+            {
+                closesocket( WakeupSocket );
+            }
+        }
+
+        bool InitNotifications( mg_event_handler_t handler );
+        void Notify( IWebRequestHandler* handler );
+        vector<IWebRequestHandler*> TakeNotifications( );
+    };
+
+    /* ================================================================= */
+    /* Router finding handlers of request URIs                           */
+    /* ================================================================= */
+    // Routes are compiled into prefix tree (with chains of single children merged into one node), which
+    // is stored in flat arrays. So finding handler of a URI walks it once and does not allocate anything.
+    class HandlersRouter
+    {
+    private:
+        struct Route
+        {
+            string              Uri;
+            RequestHandlerData* Exact;          // handler of the URI
+            RequestHandlerData* Prefix;         // handler of URIs starting with the URI
+            uint32_t            PrefixOrder;    // the earliest added prefix handler wins if several match
+        };
+
+        struct Node
+        {
+            uint32_t            LabelStart;     // part of URI matched by the node (in Labels)
+            uint32_t            LabelLength;
+            uint32_t            FirstChild;     // children are stored next to each other
+            uint32_t            ChildCount;
+            RequestHandlerData* Exact;
+            RequestHandlerData* Prefix;
+            uint32_t            PrefixOrder;
+        };
+
+        vector<Route> Routes;
+        vector<Node>  Nodes;
+        string        Labels;
+
+    public:
+        HandlersRouter( ) : Routes( ), Nodes( ), Labels( ) { }
+
+        // Remove all routes
+        void Clear( );
+        // Add handler for the URI - for exact match or for all URIs starting with it
+        void Add( const string& uri, RequestHandlerData* handler, bool isPrefix );
+        // Compile the added routes into the form used for finding handlers
+        void Compile( );
+        // Find handler for the URI - exact match goes first, then the earliest added prefix
+        RequestHandlerData* Find( const XStringView& uri ) const;
+
+    private:
+        void BuildNode( size_t nodeIndex, size_t firstRoute, size_t lastRoute, size_t depth );
+    };
+
+    /* ================================================================= */
+    /* Digest authentication session of a client                         */
+    /* ================================================================= */
+    // Clients keep using the same server nonce and their cnonce for many requests, incrementing nonce count
+    // with each one. Session of a verified client remembers nonce counts seen, so replayed requests are rejected,
+    // and how the client calculates HA2, so a repeated request needs only one MD5 calculation.
+    class DigestSession
+    {
+    public:
+        UserGroup                Group;
+        string                   Ha1;
+        uint32_t                 MaxNonceCount;
+        uint64_t                 SeenNonceCounts;   // bit N is set if ( MaxNonceCount - N ) was seen
+        int                      QueryInDigestUri;  // 0 - client omits query string from digest URI, 1 - includes it
+        string                   Ha2Source;         // method and URI the HA2 below was calculated for
+        string                   Ha2;
+        steady_clock::time_point LastUseTime;
+
+    public:
+        DigestSession( ) :
+            Group( UserGroup::Anyone ), Ha1( ), MaxNonceCount( 0 ), SeenNonceCounts( 0 ), QueryInDigestUri( 1 ),
+            Ha2Source( ), Ha2( ), LastUseTime( )
+        { }
+
+        // Check if the nonce count was not used by the client yet
+        bool IsNonceCountFresh( uint32_t nonceCount ) const
+        {
+            return ( nonceCount > MaxNonceCount ) ||
+                   ( ( MaxNonceCount - nonceCount < NONCE_COUNT_WINDOW ) &&
+                     ( ( SeenNonceCounts & ( 1ull << ( MaxNonceCount - nonceCount ) ) ) == 0 ) );
+        }
+
+        // Remember the nonce count as used
+        void UseNonceCount( uint32_t nonceCount )
+        {
+            if ( nonceCount > MaxNonceCount )
+            {
+                SeenNonceCounts = ( nonceCount - MaxNonceCount >= NONCE_COUNT_WINDOW ) ? 0 : SeenNonceCounts << ( nonceCount - MaxNonceCount );
+                MaxNonceCount   = nonceCount;
+            }
+
+            SeenNonceCounts |= 1ull << ( MaxNonceCount - nonceCount );
+        }
     };
 
     /* ================================================================= */
@@ -240,19 +789,19 @@ namespace Private
         string                    DocumentRoot;
         string                    AuthDomain;
         uint16_t                  Port;
+        uint32_t                  ThreadCount;
 
-        steady_clock::time_point  LastAccessTime;
-        bool                      WasAccessed;
+        atomic<steady_clock::time_point> LastAccessTime;
+        atomic<bool>                     WasAccessed;
 
     private:
-        struct mg_mgr             EventManager;
+        vector<WebServerWorker*>  Workers;
         struct mg_serve_http_opts ServerOptions;
 
         char*                     ActiveDocumentRoot;
         string                    ActiveAuthDomain;
 
         XManualResetEvent         NeedToStop;
-        XManualResetEvent         IsStopped;
         recursive_mutex           StartSync;
         bool                      IsRunning;
 
@@ -262,20 +811,28 @@ namespace Private
         HandlersMap  FileHandlers;
         HandlersList FolderHandlers;
 
-        HandlersMap  ActiveFileHandlers;
-        HandlersList ActiveFolderHandlers;
+        HandlersMap    ActiveFileHandlers;
+        HandlersList   ActiveFolderHandlers;
+        HandlersRouter ActiveRouter;
 
         typedef map<string, pair<string, UserGroup>> UsersMap;
 
         UsersMap Users;
 
+        // verified digest authentication sessions - user:nonce:cnonce is the key
+        typedef map<string, DigestSession> SessionsMap;
+
+        SessionsMap Sessions;
+        mutex       SessionsSync;
+
     public:
         XWebServerData( const string& documentRoot, uint16_t port ) :
-            DataSync( ), DocumentRoot( documentRoot ), AuthDomain( DEFAULT_AUTH_DOMAIN ), Port( port ),
-            LastAccessTime( ), WasAccessed( false ),
-            EventManager( { 0 } ), ServerOptions( { 0 } ),
+            DataSync( ), DocumentRoot( documentRoot ), AuthDomain( DEFAULT_AUTH_DOMAIN ), Port( port ), ThreadCount( 1 ),
+            LastAccessTime( steady_clock::time_point( ) ), WasAccessed( false ),
+            Workers( ), ServerOptions( { 0 } ),
             ActiveDocumentRoot( nullptr ), ActiveAuthDomain( ),
-            NeedToStop( ), IsStopped( ), StartSync( ), IsRunning( false )
+            NeedToStop( ), StartSync( ), IsRunning( false ),
+            Users( ), Sessions( ), SessionsSync( )
         {
             ServerOptions.enable_directory_listing = "no";
         }
@@ -287,11 +844,15 @@ namespace Private
 
         bool Start( );
         void Stop( );
+        void StopWorkers( );
         void Cleanup( );
+        struct mg_connection* Bind( WebServerWorker* worker, const char* strPort, bool sharedPort );
+        void SetHandlersServer( XWebServerData* server );
+        void NotifySubscribers( IWebRequestHandler* handler );
         void AddHandler( const shared_ptr<IWebRequestHandler>& handler, UserGroup userGroup );
         void RemoveHandler( const shared_ptr<IWebRequestHandler>& handler );
         void ClearHandlers( );
-        RequestHandlerData* FindHandler( const string& uri );
+        RequestHandlerData* FindHandler( const XStringView& uri );
         steady_clock::time_point HandlerLastAccessTime( const string& handlerUri, bool* pWasAccessed = nullptr );
 
         void AddUser( const string& name, const string& digestHa1, UserGroup group );
@@ -300,10 +861,15 @@ namespace Private
         void ClearUsers( );
 
         UserGroup CheckDigestAuth( struct http_message* msg );
+        void ClearDigestSessions( );
 
         static void* pollHandler( void* param );
         static void eventHandler( struct mg_connection* connection, int event, void* param );
+        static void wakeupHandler( struct mg_connection* connection, int event, void* param );
     };
+
+    // Guards the link between request handlers and their running web server
+    static mutex HandlersServerSync;
 }
 
 /* ================================================================= */
@@ -311,7 +877,7 @@ namespace Private
 /* ================================================================= */
 
 IWebRequestHandler::IWebRequestHandler( const string& uri, bool canHandleSubContent ) :
-    mUri( uri ), mCanHandleSubContent( canHandleSubContent )
+    mUri( uri ), mCanHandleSubContent( canHandleSubContent ), mServer( nullptr )
 {
     // make sure all URIs start with /
     if ( mUri[0] != '/' )
@@ -326,23 +892,101 @@ IWebRequestHandler::IWebRequestHandler( const string& uri, bool canHandleSubCont
     }
 }
 
+// Wake all connections subscribed to the handler
+void IWebRequestHandler::NotifySubscribers( )
+{
+    lock_guard<mutex> lock( Private::HandlersServerSync );
+
+    if ( mServer != nullptr )
+    {
+        mServer->NotifySubscribers( this );
+    }
+}
+
 /* ================================================================= */
 /* Implementation of the XEmbeddedContentHandler                     */
 /* ================================================================= */
 
-XEmbeddedContentHandler::XEmbeddedContentHandler( const string& uri, const XEmbeddedContent* content ) :
-    IWebRequestHandler( uri, false ), mContent( content )
+XEmbeddedContentHandler::XEmbeddedContentHandler( const string& uri, const XEmbeddedContent* content, uint32_t maxAge ) :
+    IWebRequestHandler( uri, false ), mContent( content ), mMaxAge( maxAge )
 {
 }
 
 // Handle request providing given embedded content
-void XEmbeddedContentHandler::HandleHttpRequest( const IWebRequest& /* request */, IWebResponse& response )
+void XEmbeddedContentHandler::HandleHttpRequest( const IWebRequest& request, IWebResponse& response )
 {
-    response.Printf( "HTTP/1.1 200 OK\r\n"
-                     "Content-Type: %s\r\n"
-                     "Content-Length: %u\r\n"
-                     "\r\n", mContent->Type, mContent->Length );
-    response.Send( mContent->Body, mContent->Length );
+    const uint8_t* body     = mContent->Body;
+    uint32_t       length   = mContent->Length;
+    const char*    encoding = nullptr;
+    string         acceptEncoding = request.Header( "Accept-Encoding" );
+    string         headers;
+    char           buffer[128];
+
+    // use the smallest variant of the content client can take
+    if ( ( mContent->BrotliBody != nullptr ) && ( Private::IsEncodingAccepted( acceptEncoding, "br" ) ) )
+    {
+        body     = mContent->BrotliBody;
+        length   = mContent->BrotliLength;
+        encoding = "br";
+    }
+    else if ( ( mContent->GzipBody != nullptr ) && ( Private::IsEncodingAccepted( acceptEncoding, "gzip" ) ) )
+    {
+        body     = mContent->GzipBody;
+        length   = mContent->GzipLength;
+        encoding = "gzip";
+    }
+
+    if ( mMaxAge == 0 )
+    {
+        headers = "Cache-Control: no-cache\r\n";
+    }
+    else
+    {
+        sprintf( buffer, "Cache-Control: max-age=%u\r\n", mMaxAge );
+        headers = buffer;
+    }
+
+    if ( ( mContent->BrotliBody != nullptr ) || ( mContent->GzipBody != nullptr ) )
+    {
+        headers += "Vary: Accept-Encoding\r\n";
+    }
+
+    if ( mContent->Hash != nullptr )
+    {
+        // every variant needs its own tag, but any of them tells client has the latest content
+        headers += "ETag: \"";
+        headers += mContent->Hash;
+        if ( encoding != nullptr )
+        {
+            headers += "-";
+            headers += encoding;
+        }
+        headers += "\"\r\n";
+    }
+
+    if ( ( mContent->Hash != nullptr ) && ( Private::IsEntityTagMatching( request.Header( "If-None-Match" ), mContent->Hash ) ) )
+    {
+        response.Printf( "HTTP/1.1 304 Not Modified\r\n"
+                         "%s"
+                         "\r\n", headers.c_str( ) );
+    }
+    else
+    {
+        if ( encoding != nullptr )
+        {
+            sprintf( buffer, "Content-Encoding: %s\r\n", encoding );
+            headers += buffer;
+        }
+
+        response.Printf( "HTTP/1.1 200 OK\r\n"
+                         "Content-Type: %s\r\n"
+                         "Content-Length: %u\r\n"
+                         "%s"
+                         "\r\n", mContent->Type, length, headers.c_str( ) );
+
+        // embedded content never goes away, so there is no owner to keep
+        response.SendShared( shared_ptr<const void>( ), body, length );
+    }
 }
 
 /* ================================================================= */
@@ -402,6 +1046,18 @@ XWebServer& XWebServer::SetPort( uint16_t port )
 
 #pragma pop_macro( "SetPort" )
 
+// Get/Set number of threads (event loops) serving clients
+uint32_t XWebServer::ThreadCount( ) const
+{
+    return mData->ThreadCount;
+}
+XWebServer& XWebServer::SetThreadCount( uint32_t threadCount )
+{
+    lock_guard<recursive_mutex> lock( mData->DataSync );
+    mData->ThreadCount = ( threadCount < 1 ) ? 1 : ( ( threadCount > MAX_THREAD_COUNT ) ? MAX_THREAD_COUNT : threadCount );
+    return *this;
+}
+
 // Start/Stop the Web server
 bool XWebServer::Start( )
 {
@@ -493,80 +1149,476 @@ namespace Private
 bool XWebServerData::Start( )
 {
     lock_guard<recursive_mutex> lock( StartSync );
-    char strPort[16];
+    uint32_t threadCount;
+    char     strPort[16];
+
+    if ( IsRunning )
+    {
+        return true;
+    }
 
     {
         lock_guard<recursive_mutex> lock( DataSync );
 
         sprintf( strPort, "%u", Port );
 
-        // set document root
-        if ( !DocumentRoot.empty( ) )
+        // set document root
+        if ( !DocumentRoot.empty( ) )
+        {
+            ActiveDocumentRoot = new char[DocumentRoot.length( ) + 1];
+            strcpy( ActiveDocumentRoot, DocumentRoot.c_str( ) );
+
+            ServerOptions.document_root = ActiveDocumentRoot;
+        }
+
+        // get a copy of handlers, so we don't need to guard it while server is running
+        ActiveFileHandlers   = FileHandlers;
+        ActiveFolderHandlers = FolderHandlers;
+        ActiveAuthDomain     = AuthDomain;
+        threadCount          = ThreadCount;
+
+        ActiveRouter.Clear( );
+        for ( auto& fileHandlerData : ActiveFileHandlers )
+        {
+            ActiveRouter.Add( fileHandlerData.first, &fileHandlerData.second, false );
+        }
+        for ( auto& folderHandlerData : ActiveFolderHandlers )
+        {
+            ActiveRouter.Add( folderHandlerData.Handler->Uri( ), &folderHandlerData, true );
+        }
+        ActiveRouter.Compile( );
+    }
+
+#ifndef XWEB_SERVER_SHARED_PORT
+    threadCount = 1;
+#endif
+
+    NeedToStop.Reset( );
+
+    WasAccessed    = false;
+    LastAccessTime = steady_clock::time_point( );
+
+    // every event loop gets its own listening socket bound to the same port, so the system
+    // spreads incoming connections between them; all sockets are bound before any thread starts
+    bool allBound = true;
+
+    for ( uint32_t i = 0; ( i < threadCount ) && ( allBound ); i++ )
+    {
+        WebServerWorker* worker = new WebServerWorker( this );
+
+        Workers.push_back( worker );
+        allBound = ( Bind( worker, strPort, ( threadCount > 1 ) ) != nullptr ) &&
+                   ( worker->InitNotifications( wakeupHandler ) );
+    }
+
+    if ( allBound )
+    {
+        IsRunning = true;
+
+        for ( WebServerWorker* worker : Workers )
+        {
+            if ( mg_start_thread( pollHandler, worker ) == nullptr )
+            {
+                IsRunning = false;
+                break;
+            }
+
+            worker->IsThreadStarted = true;
+        }
+
+        if ( !IsRunning )
+        {
+            StopWorkers( );
+        }
+        else
+        {
+            SetHandlersServer( this );
+        }
+    }
+
+    if ( !IsRunning )
+    {
+        Cleanup( );
+    }
+
+    return IsRunning;
+}
+
+// Create listening connection for the specified event loop
+struct mg_connection* XWebServerData::Bind( WebServerWorker* worker, const char* strPort, bool sharedPort )
+{
+    struct mg_connection* connection = nullptr;
+
+    if ( !sharedPort )
+    {
+        connection = mg_bind( &worker->EventManager, strPort, eventHandler );
+    }
+#ifdef XWEB_SERVER_SHARED_PORT
+    else
+    {
+        struct sockaddr_in address;
+        int                on   = 1;
+        sock_t             sock = socket( AF_INET, SOCK_STREAM, 0 );
+
+        memset( &address, 0, sizeof( address ) );
+        address.sin_family      = AF_INET;
+        address.sin_addr.s_addr = htonl( INADDR_ANY );
+        address.sin_port        = htons( Port );
+
+        if ( ( sock != INVALID_SOCKET ) &&
+             ( setsockopt( sock, SOL_SOCKET, SO_REUSEADDR, (void*) &on, sizeof( on ) ) == 0 ) &&
+             ( setsockopt( sock, SOL_SOCKET, SO_REUSEPORT, (void*) &on, sizeof( on ) ) == 0 ) &&
+             ( bind( sock, (struct sockaddr*) &address, sizeof( address ) ) == 0 ) &&
+             ( listen( sock, SOMAXCONN ) == 0 ) )
+        {
+            connection = mg_add_sock( &worker->EventManager, sock, eventHandler );
+        }
+
+        if ( connection != nullptr )
+        {
+            connection->flags |= MG_F_LISTENING;
+        }
+        else if ( sock != INVALID_SOCKET )
+        {
+            closesocket( sock );
+        }
+    }
+#endif
+
+    if ( connection != nullptr )
+    {
+        mg_set_protocol_http_websocket( connection );
+    }
+
+    return connection;
+}
+
+// Stop running Web server
+void XWebServerData::Stop( )
+{
+    lock_guard<recursive_mutex> lock( StartSync );
+
+    if ( IsRunning )
+    {
+        SetHandlersServer( nullptr );
+        StopWorkers( );
+        Cleanup( );
+
+        IsRunning = false;
+    }
+}
+
+// Link active request handlers to the running server (or unlink them when stopping),
+// so they could notify their subscribers
+void XWebServerData::SetHandlersServer( XWebServerData* server )
+{
+    lock_guard<mutex> lock( HandlersServerSync );
+
+    for ( auto& fileHandlerData : ActiveFileHandlers )
+    {
+        fileHandlerData.second.Handler->mServer = server;
+    }
+    for ( auto& folderHandlerData : ActiveFolderHandlers )
+    {
+        folderHandlerData.Handler->mServer = server;
+    }
+}
+
+// Wake all event loops, so they notify connections subscribed to the handler.
+// Called with HandlersServerSync locked, which keeps the workers alive.
+void XWebServerData::NotifySubscribers( IWebRequestHandler* handler )
+{
+    for ( WebServerWorker* worker : Workers )
+    {
+        worker->Notify( handler );
+    }
+}
+
+// Queue shared buffer for sending and send as much as possible right away
+void ConnectionContext::QueueShared( struct mg_connection* connection, IWebRequestHandler* handler,
+                                     const shared_ptr<const void>& owner, const uint8_t* data, size_t length )
+{
+    if ( length != 0 )
+    {
+        if ( SendQueue.empty( ) )
+        {
+            // everything buffered so far goes before the new data
+            BufferedBeforeQueue = connection->send_mbuf.len;
+        }
+        else
+        {
+            MoveBufferedToQueue( connection );
+        }
+
+        SendQueue.push_back( { owner, data, length, ( owner ) ? handler : nullptr } );
+        SendQueueLength += length;
+
+        Flush( connection );
+    }
+}
+
+// Queue copy of the data for sending after everything queued so far
+void ConnectionContext::QueueCopy( struct mg_connection* connection, const uint8_t* data, size_t length )
+{
+    shared_ptr<vector<uint8_t>> copy = make_shared<vector<uint8_t>>( data, data + length );
+
+    QueueShared( connection, nullptr, copy, copy->data( ), length );
+}
+
+// Move data written into connection's buffer while something is queued to the end of the queue
+void ConnectionContext::KeepOrder( struct mg_connection* connection )
+{
+    if ( !SendQueue.empty( ) )
+    {
+        MoveBufferedToQueue( connection );
+    }
+}
+
+// Handle data sent by the event loop from connection's buffer
+void ConnectionContext::OnSent( size_t length )
+{
+    BufferedBeforeQueue -= min( BufferedBeforeQueue, length );
+}
+
+// Move data, which was buffered after the queue was started, to the end of the queue
+void ConnectionContext::MoveBufferedToQueue( struct mg_connection* connection )
+{
+    struct mbuf* buffer = &connection->send_mbuf;
+
+    if ( buffer->len > BufferedBeforeQueue )
+    {
+        size_t                     length = buffer->len - BufferedBeforeQueue;
+        shared_ptr<vector<uint8_t>> copy  = make_shared<vector<uint8_t>>( buffer->buf + BufferedBeforeQueue, buffer->buf + buffer->len );
+
+        SendQueue.push_back( { copy, copy->data( ), length, nullptr } );
+        SendQueueLength += length;
+        buffer->len      = BufferedBeforeQueue;
+    }
+}
+
+// Remove the first segment of the queue, which is sent, and let its handler know about it
+void ConnectionContext::PopSent( )
+{
+    IWebRequestHandler*    handler = SendQueue.front( ).Handler;
+    shared_ptr<const void> owner;
+
+    if ( handler != nullptr )
+    {
+        owner.swap( SendQueue.front( ).Owner );
+    }
+
+    SendQueue.pop_front( );
+
+    if ( handler != nullptr )
+    {
+        handler->HandleSharedSent( owner );
+    }
+}
+
+// Send queued data until it is all sent or socket can not take more
+void ConnectionContext::Flush( struct mg_connection* connection )
+{
+#ifdef XWEB_SERVER_SHARED_SEND
+    struct mbuf* buffer = &connection->send_mbuf;
+
+    if ( SendQueue.empty( ) )
+    {
+        return;
+    }
+
+    MoveBufferedToQueue( connection );
+
+    // the event loop would close connection once its buffer is empty, so postpone it till the queue is sent
+    if ( connection->flags & MG_F_SEND_AND_CLOSE )
+    {
+        connection->flags &= ~MG_F_SEND_AND_CLOSE;
+        CloseWhenSent = true;
+    }
+
+    while ( ( !SendQueue.empty( ) ) && ( ( connection->flags & MG_F_CLOSE_IMMEDIATELY ) == 0 ) )
+    {
+        struct iovec  segments[MAX_SEND_SEGMENTS + 1];
+        struct msghdr message = { 0 };
+        size_t        count   = 0;
+        ssize_t       sent;
+
+        if ( BufferedBeforeQueue != 0 )
+        {
+            segments[count].iov_base = buffer->buf;
+            segments[count].iov_len  = BufferedBeforeQueue;
+            count++;
+        }
+
+        for ( auto it = SendQueue.begin( ); ( it != SendQueue.end( ) ) && ( count < MAX_SEND_SEGMENTS ); ++it, ++count )
+        {
+            segments[count].iov_base = const_cast<uint8_t*>( it->Data );
+            segments[count].iov_len  = it->Length;
+        }
+
+        message.msg_iov    = segments;
+        message.msg_iovlen = count;
+
+        sent = sendmsg( connection->sock, &message, MSG_NOSIGNAL );
+
+        if ( sent < 0 )
+        {
+            if ( ( errno != EAGAIN ) && ( errno != EWOULDBLOCK ) && ( errno != EINTR ) )
+            {
+                connection->flags |= MG_F_CLOSE_IMMEDIATELY;
+            }
+            else if ( buffer->len == 0 )
+            {
+                // let the event loop wait till the socket is writable - it sends this part itself and tells about it
+                SendSegment& first  = SendQueue.front( );
+                size_t       parked = min( first.Length, static_cast<size_t>( PARKED_DATA_SIZE ) );
+
+                mbuf_append( buffer, first.Data, parked );
+                BufferedBeforeQueue = parked;
+
+                first.Data      += parked;
+                first.Length    -= parked;
+                SendQueueLength -= parked;
+
+                if ( first.Length == 0 )
+                {
+                    PopSent( );
+                }
+            }
+
+            break;
+        }
+
+        connection->last_io_time = static_cast<time_t>( mg_time( ) );
+
+        if ( SentBytes != nullptr )
+        {
+            SentBytes->Increment( static_cast<uint64_t>( sent ) );
+        }
+
+        // consume connection's own buffer first and then the queued segments
+        size_t fromBuffer = min( static_cast<size_t>( sent ), BufferedBeforeQueue );
+
+        mbuf_remove( buffer, fromBuffer );
+        BufferedBeforeQueue -= fromBuffer;
+        sent                -= fromBuffer;
+
+        while ( sent > 0 )
         {
-            ActiveDocumentRoot = new char[DocumentRoot.length( ) + 1];
-            strcpy( ActiveDocumentRoot, DocumentRoot.c_str( ) );
+            SendSegment& first = SendQueue.front( );
+            size_t       done  = min( static_cast<size_t>( sent ), first.Length );
 
-            ServerOptions.document_root = ActiveDocumentRoot;
+            first.Data      += done;
+            first.Length    -= done;
+            SendQueueLength -= done;
+            sent            -= done;
+
+            if ( first.Length == 0 )
+            {
+                PopSent( );
+            }
         }
+    }
 
-        // get a copy of handlers, so we don't need to guard it while server is running
-        ActiveFileHandlers   = FileHandlers;
-        ActiveFolderHandlers = FolderHandlers;
-        ActiveAuthDomain     = AuthDomain;
+    if ( connection->flags & MG_F_CLOSE_IMMEDIATELY )
+    {
+        SendQueue.clear( );
+        SendQueueLength = 0;
+    }
+    else if ( ( SendQueue.empty( ) ) && ( CloseWhenSent ) )
+    {
+        connection->flags |= MG_F_SEND_AND_CLOSE;
     }
+#else
+    (void) connection;
+#endif
+}
 
-    mg_mgr_init( &EventManager, this );
+// Create socket pair used to wake the event loop from other threads
+bool WebServerWorker::InitNotifications( mg_event_handler_t handler )
+{
+    sock_t                sockets[2];
+    struct mg_connection* connection = nullptr;
 
-    NeedToStop.Reset( );
-    IsStopped.Reset( );
+    if ( mg_socketpair( sockets, SOCK_STREAM ) != 0 )
+    {
+        WakeupSocket = sockets[0];
+        connection   = mg_add_sock( &EventManager, sockets[1], handler );
 
-    WasAccessed    = false;
-    LastAccessTime = steady_clock::time_point( );
+        if ( connection != nullptr )
+        {
+            connection->user_data = this;
+        }
+        else
+        {
+            closesocket( sockets[1] );
+        }
+    }
 
-    struct mg_connection* connection = mg_bind( &EventManager, strPort, eventHandler );
+    return ( connection != nullptr );
+}
+
+// Queue notification for subscribers of the handler and wake the event loop if it is not yet woken
+void WebServerWorker::Notify( IWebRequestHandler* handler )
+{
+    bool needsWakeup;
 
-    if ( connection != nullptr )
     {
-        mg_set_protocol_http_websocket( connection );
+        lock_guard<mutex> lock( NotificationSync );
+
+        needsWakeup = PendingNotifications.empty( );
 
-        if ( mg_start_thread( pollHandler, this ) != nullptr )
+        if ( find( PendingNotifications.begin( ), PendingNotifications.end( ), handler ) == PendingNotifications.end( ) )
         {
-            IsRunning = true;
+            PendingNotifications.push_back( handler );
         }
     }
 
-    if ( !IsRunning )
+    if ( needsWakeup )
     {
-        Cleanup( );
+        send( WakeupSocket, "n", 1, 0 );
     }
-
-    return IsRunning;
 }
 
-// Stop running Web server
-void XWebServerData::Stop( )
+// Take all queued notifications
+vector<IWebRequestHandler*> WebServerWorker::TakeNotifications( )
 {
-    lock_guard<recursive_mutex> lock( StartSync );
+    lock_guard<mutex> lock( NotificationSync );
+    vector<IWebRequestHandler*> notifications;
 
-    if ( IsRunning )
-    {
-        NeedToStop.Signal( );
-        IsStopped.Wait( );
+    notifications.swap( PendingNotifications );
 
-        Cleanup( );
+    return notifications;
+}
 
-        IsRunning = false;
+// Signal all event loops to stop and wait till their threads are done
+void XWebServerData::StopWorkers( )
+{
+    NeedToStop.Signal( );
+
+    for ( WebServerWorker* worker : Workers )
+    {
+        if ( worker->IsThreadStarted )
+        {
+            worker->IsStopped.Wait( );
+            worker->IsThreadStarted = false;
+        }
     }
 }
 
 // Clean-up resources
 void XWebServerData::Cleanup( )
 {
-    mg_mgr_free( &EventManager );
+    for ( WebServerWorker* worker : Workers )
+    {
+        delete worker;
+    }
+    Workers.clear( );
 
     if ( ActiveDocumentRoot != nullptr )
     {
         delete[] ActiveDocumentRoot;
+        ActiveDocumentRoot          = nullptr;
+        ServerOptions.document_root = nullptr;
     }
 }
 
@@ -612,28 +1664,176 @@ void XWebServerData::ClearHandlers( )
 }
 
 // Find request handler for the specified URI
-RequestHandlerData* XWebServerData::FindHandler( const string& uri )
+RequestHandlerData* XWebServerData::FindHandler( const XStringView& uri )
+{
+    return ActiveRouter.Find( uri );
+}
+
+/* ================================================================= */
+/* Implementation of the HandlersRouter                              */
+/* ================================================================= */
+
+// Remove all routes
+void HandlersRouter::Clear( )
+{
+    Routes.clear( );
+    Nodes.clear( );
+    Labels.clear( );
+}
+
+// Add handler for the URI - for exact match or for all URIs starting with it
+void HandlersRouter::Add( const string& uri, RequestHandlerData* handler, bool isPrefix )
 {
-    RequestHandlerData*   handler = nullptr;
-    HandlersMap::iterator fileIt  = ActiveFileHandlers.find( uri );
+    Route route = { uri, nullptr, nullptr, 0 };
 
-    if ( fileIt != ActiveFileHandlers.end( ) )
+    if ( isPrefix )
     {
-        handler = &fileIt->second;
+        route.Prefix      = handler;
+        route.PrefixOrder = static_cast<uint32_t>( Routes.size( ) );
     }
     else
     {
-        for ( auto& folderHandlerData : ActiveFolderHandlers )
+        route.Exact = handler;
+    }
+
+    Routes.push_back( route );
+}
+
+// Compile the added routes into prefix tree
+void HandlersRouter::Compile( )
+{
+    size_t count = 0;
+
+    stable_sort( Routes.begin( ), Routes.end( ), []( const Route& lhs, const Route& rhs ) { return lhs.Uri < rhs.Uri; } );
+
+    // the same URI may have both exact and prefix handlers - merge them into one route
+    for ( size_t i = 0; i < Routes.size( ); i++ )
+    {
+        if ( ( count != 0 ) && ( Routes[count - 1].Uri == Routes[i].Uri ) )
+        {
+            Route& merged = Routes[count - 1];
+
+            if ( merged.Exact == nullptr )
+            {
+                merged.Exact = Routes[i].Exact;
+            }
+            if ( ( Routes[i].Prefix != nullptr ) && ( ( merged.Prefix == nullptr ) || ( Routes[i].PrefixOrder < merged.PrefixOrder ) ) )
+            {
+                merged.Prefix      = Routes[i].Prefix;
+                merged.PrefixOrder = Routes[i].PrefixOrder;
+            }
+        }
+        else
+        {
+            Routes[count++] = Routes[i];
+        }
+    }
+    Routes.resize( count );
+
+    Nodes.clear( );
+    Labels.clear( );
+    Nodes.push_back( Node( { 0, 0, 0, 0, nullptr, nullptr, 0 } ) );
+
+    BuildNode( 0, 0, Routes.size( ), 0 );
+}
+
+// Build node for the sorted routes sharing the first "depth" characters (the node's path)
+void HandlersRouter::BuildNode( size_t nodeIndex, size_t firstRoute, size_t lastRoute, size_t depth )
+{
+    vector<pair<size_t, size_t>> groups;
+
+    // route equal to the node's path goes first, since it is the shortest one
+    if ( ( firstRoute < lastRoute ) && ( Routes[firstRoute].Uri.length( ) == depth ) )
+    {
+        Nodes[nodeIndex].Exact       = Routes[firstRoute].Exact;
+        Nodes[nodeIndex].Prefix      = Routes[firstRoute].Prefix;
+        Nodes[nodeIndex].PrefixOrder = Routes[firstRoute].PrefixOrder;
+        firstRoute++;
+    }
+
+    // the rest are grouped by their next character - every group makes a child
+    for ( size_t i = firstRoute, j; i < lastRoute; i = j )
+    {
+        for ( j = i + 1; ( j < lastRoute ) && ( Routes[j].Uri[depth] == Routes[i].Uri[depth] ); j++ );
+
+        groups.push_back( pair<size_t, size_t>( i, j ) );
+    }
+
+    Nodes[nodeIndex].FirstChild = static_cast<uint32_t>( Nodes.size( ) );
+    Nodes[nodeIndex].ChildCount = static_cast<uint32_t>( groups.size( ) );
+    Nodes.resize( Nodes.size( ) + groups.size( ), Node( { 0, 0, 0, 0, nullptr, nullptr, 0 } ) );
+
+    for ( size_t k = 0; k < groups.size( ); k++ )
+    {
+        // sorted routes of a group share as many characters as the first and the last of them do
+        const string& first      = Routes[groups[k].first].Uri;
+        const string& last       = Routes[groups[k].second - 1].Uri;
+        size_t        end        = depth + 1;
+        size_t        childIndex = Nodes[nodeIndex].FirstChild + k;
+
+        while ( ( end < first.length( ) ) && ( end < last.length( ) ) && ( first[end] == last[end] ) )
+        {
+            end++;
+        }
+
+        Nodes[childIndex].LabelStart  = static_cast<uint32_t>( Labels.length( ) );
+        Nodes[childIndex].LabelLength = static_cast<uint32_t>( end - depth );
+        Labels.append( first, depth, end - depth );
+
+        BuildNode( childIndex, groups[k].first, groups[k].second, end );
+    }
+}
+
+// Find handler for the URI - exact match goes first, then the earliest added prefix
+RequestHandlerData* HandlersRouter::Find( const XStringView& uri ) const
+{
+    RequestHandlerData* prefixHandler = nullptr;
+    uint32_t            prefixOrder   = 0;
+    size_t              position      = 0;
+    const Node*         node          = ( Nodes.empty( ) ) ? nullptr : &Nodes[0];
+
+    while ( node != nullptr )
+    {
+        const Node* next = nullptr;
+
+        if ( ( node->Prefix != nullptr ) && ( ( prefixHandler == nullptr ) || ( node->PrefixOrder < prefixOrder ) ) )
+        {
+            prefixHandler = node->Prefix;
+            prefixOrder   = node->PrefixOrder;
+        }
+
+        if ( position == uri.Length( ) )
+        {
+            if ( node->Exact != nullptr )
+            {
+                return node->Exact;
+            }
+            break;
+        }
+
+        for ( uint32_t i = node->FirstChild, end = node->FirstChild + node->ChildCount; i < end; i++ )
         {
-            if ( uri.compare( 0, folderHandlerData.Handler->Uri( ).length( ), folderHandlerData.Handler->Uri( ) ) == 0 )
+            if ( Labels[Nodes[i].LabelStart] == uri[position] )
             {
-                handler = &folderHandlerData;
+                next = &Nodes[i];
                 break;
             }
         }
+
+        if ( ( next != nullptr ) && ( uri.Length( ) - position >= next->LabelLength ) &&
+             ( memcmp( uri.Data( ) + position, Labels.data( ) + next->LabelStart, next->LabelLength ) == 0 ) )
+        {
+            position += next->LabelLength;
+        }
+        else
+        {
+            next = nullptr;
+        }
+
+        node = next;
     }
 
-    return handler;
+    return prefixHandler;
 }
 
 // Get time of the last access/request to the specified handler
@@ -663,12 +1863,14 @@ void XWebServerData::AddUser( const string& name, const string& digestHa1, UserG
     lock_guard<recursive_mutex> lock( DataSync );
 
     Users[name] = pair<string, UserGroup>( digestHa1, group );
+    ClearDigestSessions( );
 }
 void XWebServerData::RemoveUser( const string& name )
 {
     lock_guard<recursive_mutex> lock( DataSync );
 
     Users.erase( name );
+    ClearDigestSessions( );
 }
 
 // Load users from file having "htdigest" format
@@ -778,19 +1980,28 @@ void XWebServerData::ClearUsers( )
     lock_guard<recursive_mutex> lock( DataSync );
 
     Users.clear( );
+    ClearDigestSessions( );
+}
+
+// Forget all authenticated sessions, so clients get verified against the current list of users
+void XWebServerData::ClearDigestSessions( )
+{
+    lock_guard<mutex> lock( SessionsSync );
+
+    Sessions.clear( );
 }
 
-// Thread to poll web events
+// Thread to poll web events of an event loop
 void* XWebServerData::pollHandler( void* param )
 {
-    XWebServerData* self = (XWebServerData*) param;
+    WebServerWorker* worker = (WebServerWorker*) param;
 
-    while ( !self->NeedToStop.Wait( 0 ) )
+    while ( !worker->Owner->NeedToStop.Wait( 0 ) )
     {
-        mg_mgr_poll( &self->EventManager, 1000 );
+        mg_mgr_poll( &worker->EventManager, 1000 );
     }
 
-    self->IsStopped.Signal( );
+    worker->IsStopped.Signal( );
 
     return nullptr;
 }
@@ -812,14 +2023,48 @@ static bool check_nonce( const char* nonce )
     return ( now >= val ) && ( now - val < 3600 );
 }
 
+// Calculate HA2 = MD5( method:digestURI )
+static string calculate_digest_ha2( const struct mg_str& method, const char* uri, size_t uriLength )
+{
+    char ha2[33];
+
+    cs_md5( ha2, method.p, static_cast<size_t>( method.len ),
+                 ":", static_cast<size_t>( 1 ),
+                 uri, uriLength,
+                 nullptr );
+
+    return string( ha2 );
+}
+
+// Calculate response = MD5( HA1:nonce:nonceCount:cnonce:qop:HA2 )
+static string calculate_digest_response( const string& ha1, const char* nonce, const char* nc, const char* cnonce,
+                                         const char* qop, const string& ha2 )
+{
+    char response[33];
+
+    cs_md5( response,
+            ha1.c_str( ), ha1.length( ),
+            ":", static_cast<size_t>( 1 ),
+            nonce, strlen( nonce ),
+            ":", static_cast<size_t>( 1 ),
+            nc, strlen( nc ),
+            ":", static_cast<size_t>( 1 ),
+            cnonce, strlen( cnonce ),
+            ":", static_cast<size_t>( 1 ),
+            qop, strlen( qop ),
+            ":", static_cast<size_t>( 1 ),
+            ha2.c_str( ), ha2.length( ),
+            nullptr );
+
+    return string( response );
+}
+
 // Check digest authentication and resolve group of the incoming user
 UserGroup XWebServerData::CheckDigestAuth( struct http_message* msg )
 {
     UserGroup       userGroup = UserGroup::Anyone;
     struct mg_str*  hdr;
     char            user[50], cnonce[45], response[40], uri[200], qop[20], nc[20], nonce[30];
-    char            expectedResponse1[33];
-    char            expectedResponse2[33];
 
     /* parse "Authorization:" header */
     if ( ( msg != nullptr ) &&
@@ -832,69 +2077,129 @@ UserGroup XWebServerData::CheckDigestAuth( struct http_message* msg )
          ( mg_http_parse_header( hdr, "nc", nc, sizeof( nc ) ) != 0 ) &&
          ( mg_http_parse_header( hdr, "nonce", nonce, sizeof( nonce ) ) != 0 ) )
     {
+        uint32_t      nonceCount = static_cast<uint32_t>( strtoul( nc, nullptr, 16 ) );
+        string        sessionKey = string( user ) + ':' + nonce + ':' + cnonce;
+        DigestSession session;
+        bool          isKnownSession = false;
+        bool          isVerified     = false;
+
         // got some authentication data to check
-        if ( check_nonce( nonce ) )
+        if ( ( nonceCount == 0 ) || ( !check_nonce( nonce ) ) )
+        {
+            return userGroup;
+        }
+
+        // check if the client was verified already - then the request must not be a replayed one
+        {
+            lock_guard<mutex> lock( SessionsSync );
+            SessionsMap::const_iterator itSession = Sessions.find( sessionKey );
+
+            if ( itSession != Sessions.end( ) )
+            {
+                if ( !itSession->second.IsNonceCountFresh( nonceCount ) )
+                {
+                    return userGroup;
+                }
+
+                session        = itSession->second;
+                isKnownSession = true;
+            }
+        }
+
+        if ( !isKnownSession )
         {
             lock_guard<recursive_mutex> lock( DataSync );
 
             // first find the user
             UsersMap::const_iterator itUser = Users.find( user );
 
-            if ( itUser != Users.end( ) )
-            {
-                char ha2[33];
-
-                // HA2 = MD5( method:digestURI )
-                cs_md5( ha2, msg->method.p, static_cast<size_t>( msg->method.len ),
-                             ":", static_cast<size_t>( 1 ),
-                             msg->uri.p, static_cast<size_t>( msg->uri.len + ( msg->query_string.len ? msg->query_string.len + 1 : 0 ) ),
-                             nullptr );
-
-                // response = MD5( HA1:nonce:nonceCount:cnonce:qop:HA2 )
-                cs_md5( expectedResponse1, 
-                        itUser->second.first.c_str( ), itUser->second.first.length( ), // HA1 of the user
-                        ":", static_cast<size_t>( 1 ),
-                        nonce, strlen( nonce ),
-                        ":", static_cast<size_t>( 1 ),
-                        nc, strlen( nc ),
-                        ":", static_cast<size_t>( 1 ),
-                        cnonce, strlen( cnonce ),
-                        ":", static_cast<size_t>( 1 ),
-                        qop, strlen( qop ),
-                        ":", static_cast<size_t>( 1 ),
-                        ha2, static_cast<size_t>( 32 ),
-                        nullptr );
-
-                if ( msg->query_string.len != 0 )
+            if ( itUser == Users.end( ) )
+            {
+                return userGroup;
+            }
+
+            session.Ha1   = itUser->second.first;
+            session.Group = itUser->second.second;
+        }
+
+        // check response calculated over the specified URI, reusing HA2 if the client requests the same again
+        auto isValidResponse = [&]( size_t uriLength ) -> bool
+        {
+            string ha2Source = string( msg->method.p, msg->method.len ) + ' ' + string( msg->uri.p, uriLength );
+
+            if ( ha2Source != session.Ha2Source )
+            {
+                session.Ha2       = calculate_digest_ha2( msg->method, msg->uri.p, uriLength );
+                session.Ha2Source = ha2Source;
+            }
+
+            return ( calculate_digest_response( session.Ha1, nonce, nc, cnonce, qop, session.Ha2 ) == response );
+        };
+
+        if ( msg->query_string.len == 0 )
+        {
+            isVerified = isValidResponse( msg->uri.len );
+        }
+        else
+        {
+            // Found some clients (like .NET's HttpWebRequest), which calculate HA2 using URI without query part.
+            // So need to check both variants to make all clients happy, starting with the one the client used before.
+            size_t uriLengths[2] = { msg->uri.len, msg->uri.len + msg->query_string.len + 1 };
+            int    first         = ( session.QueryInDigestUri == 0 ) ? 0 : 1;
+
+            for ( int i = 0; ( i < 2 ) && ( !isVerified ); i++ )
+            {
+                int variant = ( i == 0 ) ? first : 1 - first;
+
+                isVerified = isValidResponse( uriLengths[variant] );
+
+                if ( isVerified )
                 {
-                    // Found some clients (like .NET's HttpWebRequest), which calculate HA2 using URI without query part.
-                    // So need to calculate both variant, to make all clients happy.
-
-                    cs_md5( ha2, msg->method.p, static_cast<size_t>( msg->method.len ),
-                            ":", static_cast<size_t>( 1 ),
-                            msg->uri.p, static_cast<size_t>( msg->uri.len ),
-                            nullptr );
-
-                    cs_md5( expectedResponse2,
-                            itUser->second.first.c_str( ), itUser->second.first.length( ), // HA1 of the user
-                            ":", static_cast<size_t>( 1 ),
-                            nonce, strlen( nonce ),
-                            ":", static_cast<size_t>( 1 ),
-                            nc, strlen( nc ),
-                            ":", static_cast<size_t>( 1 ),
-                            cnonce, strlen( cnonce ),
-                            ":", static_cast<size_t>( 1 ),
-                            qop, strlen( qop ),
-                            ":", static_cast<size_t>( 1 ),
-                            ha2, static_cast<size_t>( 32 ),
-                            nullptr );
+                    session.QueryInDigestUri = variant;
                 }
+            }
+        }
+
+        if ( isVerified )
+        {
+            lock_guard<mutex> lock( SessionsSync );
+            SessionsMap::iterator itSession = Sessions.find( sessionKey );
+
+            session.LastUseTime = steady_clock::now( );
 
-                if ( ( strcmp( response, expectedResponse1 ) == 0 ) ||
-                     ( ( msg->query_string.len != 0 ) && ( strcmp( response, expectedResponse2 ) == 0 ) ) )
+            if ( itSession != Sessions.end( ) )
+            {
+                // the same request could be verified concurrently by another thread
+                if ( itSession->second.IsNonceCountFresh( nonceCount ) )
+                {
+                    session.MaxNonceCount   = itSession->second.MaxNonceCount;
+                    session.SeenNonceCounts = itSession->second.SeenNonceCounts;
+                    session.UseNonceCount( nonceCount );
+                    itSession->second = session;
+                    userGroup         = session.Group;
+                }
+            }
+            else
+            {
+                // make room for the new session by dropping the least recently used one
+                if ( Sessions.size( ) >= MAX_DIGEST_SESSIONS )
                 {
-                    userGroup = itUser->second.second;
+                    SessionsMap::iterator itOldest = Sessions.begin( );
+
+                    for ( SessionsMap::iterator it = Sessions.begin( ); it != Sessions.end( ); ++it )
+                    {
+                        if ( it->second.LastUseTime < itOldest->second.LastUseTime )
+                        {
+                            itOldest = it;
+                        }
+                    }
+
+                    Sessions.erase( itOldest );
                 }
+
+                session.UseNonceCount( nonceCount );
+                Sessions[sessionKey] = session;
+                userGroup            = session.Group;
             }
         }
     }
@@ -909,18 +2214,17 @@ void XWebServerData::eventHandler( struct mg_connection* connection, int event,
 
     static bool isAuth = false;
 
-    if ( event == MG_EV_HTTP_REQUEST )
+    if ( ( event == MG_EV_HTTP_REQUEST ) || ( event == MG_EV_WEBSOCKET_HANDSHAKE_REQUEST ) )
     {
         struct http_message* message = static_cast<struct http_message*>( param );
         MangooseWebRequest   request( message );
         MangooseWebResponse  response( connection );
-        string               uri = request.Uri( );
-        UserGroup            authUserGroup = self->CheckDigestAuth( message );
+        XStringView          uri = request.UriView( );
 
         // make sure nothing finishes with / except the root
-        while ( ( uri.back( ) == '/' ) && ( uri.length( ) != 1 ) )
+        while ( ( uri.Length( ) > 1 ) && ( uri[uri.Length( ) - 1] == '/' ) )
         {
-            uri.pop_back( );
+            uri = uri.SubView( 0, uri.Length( ) - 1 );
         }
 
         // try finding handler for the URI
@@ -928,21 +2232,35 @@ void XWebServerData::eventHandler( struct mg_connection* connection, int event,
 
         if ( handlerData != nullptr )
         {
-            if ( static_cast<int>( authUserGroup ) < static_cast<int>( handlerData->AllowedUserGroup ) )
+            // authenticate only if the handler is not open to everyone
+            if ( ( handlerData->AllowedUserGroup != UserGroup::Anyone ) &&
+                 ( static_cast<int>( self->CheckDigestAuth( message ) ) < static_cast<int>( handlerData->AllowedUserGroup ) ) )
             {
                 http_send_digest_auth_request( connection, self->ActiveAuthDomain.c_str( ) );
             }
             else
             {
                 response.SetHandler( handlerData->Handler.get( ) );
+                response.Context( )->SentBytes = handlerData->SentBytes;
+                handlerData->Requests->Increment( );
+
                 // handle request with the found handler
-                handlerData->Handler->HandleHttpRequest( request, response );
+                if ( event == MG_EV_HTTP_REQUEST )
+                {
+                    handlerData->Handler->HandleHttpRequest( request, response );
+                }
+                else
+                {
+                    // the rest of WebSocket events go to the same handler
+                    response.Context( )->Handler = handlerData->Handler.get( );
+                    handlerData->Handler->HandleWebSocketRequest( request, response );
+                }
 
                 handlerData->WasAccessed    = true;
                 handlerData->LastAccessTime = steady_clock::now( );
             }
         }
-        else if ( self->ActiveDocumentRoot )
+        else if ( ( self->ActiveDocumentRoot ) && ( event == MG_EV_HTTP_REQUEST ) )
         {
             // use static content
             mg_serve_http( connection, message, self->ServerOptions );
@@ -952,17 +2270,113 @@ void XWebServerData::eventHandler( struct mg_connection* connection, int event,
             // send 404 error - not found
             response.SendError( 404 );
         }
+
+        // WebSocket connection is accepted only if nothing was sent in reply (like authentication request)
+        if ( ( event == MG_EV_WEBSOCKET_HANDSHAKE_REQUEST ) && ( connection->send_mbuf.len != 0 ) )
+        {
+            connection->flags |= MG_F_SEND_AND_CLOSE;
+        }
     }
     else if ( event == MG_EV_TIMER )
     {
-        if ( connection->user_data != nullptr )
+        ConnectionContext* context = static_cast<ConnectionContext*>( connection->user_data );
+
+        if ( ( context != nullptr ) && ( context->IsTimerSet ) )
+        {
+            MangooseWebResponse response( connection, context->Handler );
+
+            context->IsTimerSet = false;
+
+            context->Handler->HandleTimer( response );
+        }
+    }
+    else if ( ( event == MG_EV_WEBSOCKET_HANDSHAKE_DONE ) || ( event == MG_EV_WEBSOCKET_FRAME ) )
+    {
+        ConnectionContext* context = static_cast<ConnectionContext*>( connection->user_data );
+
+        if ( ( context != nullptr ) && ( context->Handler != nullptr ) )
+        {
+            MangooseWebResponse response( connection, context->Handler );
+
+            if ( event == MG_EV_WEBSOCKET_HANDSHAKE_DONE )
+            {
+                context->Handler->HandleWebSocketOpen( response );
+            }
+            else
+            {
+                struct websocket_message* message = static_cast<struct websocket_message*>( param );
+
+                context->Handler->HandleWebSocketMessage( message->data, message->size, response );
+            }
+        }
+    }
+    else if ( event == MG_EV_WEBSOCKET_CONTROL_FRAME )
+    {
+        struct websocket_message* message = static_cast<struct websocket_message*>( param );
+        ConnectionContext*        context = static_cast<ConnectionContext*>( connection->user_data );
+
+        // mongoose answers close requests, but not pings
+        if ( ( message->flags & 0x0F ) == WEBSOCKET_OP_PING )
+        {
+            if ( ( context != nullptr ) && ( context->QueuedLength( ) != 0 ) && ( message->size <= 125 ) )
+            {
+                // a frame is being sent from the queue - put the pong behind it instead of into connection's buffer
+                uint8_t pongFrame[2 + 125] = { 0x80 | WEBSOCKET_OP_PONG, static_cast<uint8_t>( message->size ) };
+
+                memcpy( pongFrame + 2, message->data, message->size );
+                context->QueueCopy( connection, pongFrame, 2 + message->size );
+            }
+            else
+            {
+                mg_send_websocket_frame( connection, WEBSOCKET_OP_PONG, message->data, message->size );
+            }
+        }
+    }
+    else if ( event == MG_EV_SEND )
+    {
+        ConnectionContext* context = static_cast<ConnectionContext*>( connection->user_data );
+
+        if ( ( context != nullptr ) && ( *static_cast<int*>( param ) > 0 ) )
+        {
+            context->OnSent( static_cast<size_t>( *static_cast<int*>( param ) ) );
+
+            if ( context->SentBytes != nullptr )
+            {
+                context->SentBytes->Increment( static_cast<uint64_t>( *static_cast<int*>( param ) ) );
+            }
+        }
+    }
+    else if ( event == MG_EV_CLOSE )
+    {
+        delete static_cast<ConnectionContext*>( connection->user_data );
+        connection->user_data = nullptr;
+    }
+
+    if ( connection->user_data != nullptr )
+    {
+        ConnectionContext* context = static_cast<ConnectionContext*>( connection->user_data );
+
+        // the event loop sends connection's buffer before polling the connection, so whatever handlers wrote
+        // into it must be queued right away to not get in the middle of a partly sent frame
+        context->KeepOrder( connection );
+
+        // continue sending queued data - the event loop polls every connection after handling its socket
+        if ( event == MG_EV_POLL )
         {
-            IWebRequestHandler* handler = static_cast<IWebRequestHandler*>( connection->user_data );
-            MangooseWebResponse response( connection, handler );
+            time_t now = *static_cast<time_t*>( param );
 
-            connection->user_data = nullptr;
+            context->Flush( connection );
 
-            handler->HandleTimer( response );
+            // mongoose pings idle WebSocket connections right after this event, writing into connection's buffer;
+            // while data is queued, send the ping through the queue instead and let mongoose know it is done
+            if ( ( connection->flags & MG_F_IS_WEBSOCKET ) && ( context->QueuedLength( ) != 0 ) &&
+                 ( now > connection->last_io_time + MG_WEBSOCKET_PING_INTERVAL_SECONDS ) )
+            {
+                static const uint8_t pingFrame[] = { 0x80 | WEBSOCKET_OP_PING, 0 };
+
+                context->QueueCopy( connection, pingFrame, sizeof( pingFrame ) );
+                connection->last_io_time = now;
+            }
         }
     }
 
@@ -973,4 +2387,31 @@ void XWebServerData::eventHandler( struct mg_connection* connection, int event,
     }
 }
 
+// Handler of the event loop's wakeup socket - delivers notifications to subscribed connections
+void XWebServerData::wakeupHandler( struct mg_connection* connection, int event, void* /* param */ )
+{
+    if ( event == MG_EV_RECV )
+    {
+        WebServerWorker*            worker        = static_cast<WebServerWorker*>( connection->user_data );
+        vector<IWebRequestHandler*> notifications = worker->TakeNotifications( );
+
+        mbuf_remove( &connection->recv_mbuf, connection->recv_mbuf.len );
+
+        for ( struct mg_connection* client = mg_next( connection->mgr, nullptr ); client != nullptr; client = mg_next( connection->mgr, client ) )
+        {
+            ConnectionContext* context = static_cast<ConnectionContext*>( client->user_data );
+
+            if ( ( client->handler == eventHandler ) && ( context != nullptr ) && ( context->IsSubscribed ) &&
+                 ( ( client->flags & ( MG_F_CLOSE_IMMEDIATELY | MG_F_SEND_AND_CLOSE ) ) == 0 ) && ( !context->IsClosing( ) ) &&
+                 ( find( notifications.begin( ), notifications.end( ), context->Handler ) != notifications.end( ) ) )
+            {
+                MangooseWebResponse response( client, context->Handler );
+
+                context->Handler->HandleNotification( response );
+                context->KeepOrder( client );
+            }
+        }
+    }
+}
+
 } // namespace Private
@@ -28,6 +28,7 @@
 #include <chrono>
 
 #include "XInterfaces.hpp"
+#include "XStringView.hpp"
 
 namespace Private
 {
@@ -58,7 +59,27 @@ public:
 
     virtual std::string GetVariable( const std::string& name ) const = 0;
 
+    // Get value of the header with the specified name (case insensitive) or empty string if there is no such header
+    virtual std::string Header( const std::string& name ) const = 0;
+
     virtual std::map<std::string, std::string> Headers( ) const = 0;
+
+    // Same as above, but the request's data is not copied - the views are valid only while the request
+    // is being handled. Header's view is empty if there is no such header.
+    virtual XStringView UriView( )    const = 0;
+    virtual XStringView MethodView( ) const = 0;
+    virtual XStringView QueryView( )  const = 0;
+    virtual XStringView BodyView( )   const = 0;
+    virtual XStringView HeaderView( const char* name ) const = 0;
+};
+
+/* ================================================================= */
+/* Data a request handler keeps for a client connection              */
+/* ================================================================= */
+class IWebClientData
+{
+public:
+    virtual ~IWebClientData( ) { }
 };
 
 /* ================================================================= */
@@ -69,10 +90,13 @@ class IWebResponse
 public:
     virtual ~IWebResponse( ) { }
 
-    // Length of data, which is still enqueued for sending
+    // Length of data, which is still enqueued for sending (including data in socket's buffer, if system tells it)
     virtual size_t ToSendDataLength( ) const = 0;
 
     virtual void Send( const uint8_t* buffer, size_t length ) = 0;
+    // Send the buffer without copying it - a reference to its owner is kept till the data is sent,
+    // so many connections can share one buffer (which must not change)
+    virtual void SendShared( const std::shared_ptr<const void>& owner, const uint8_t* buffer, size_t length ) = 0;
     virtual void Printf( const char* fmt, ... ) = 0;
 
     virtual void SendChunk( const uint8_t* buffer, size_t length ) = 0;
@@ -80,16 +104,37 @@ public:
 
     virtual void SendError( int errorCode, const char* reason = nullptr ) = 0;
 
+    // Send binary WebSocket message made of the specified header (copied) and shared buffer
+    // (kept by its owner till sent, see SendShared()). Only for WebSocket connections.
+    virtual void SendWebSocketMessage( const uint8_t* header, size_t headerLength,
+                                       const std::shared_ptr<const void>& owner, const uint8_t* buffer, size_t length ) = 0;
+    // Send formatted text WebSocket message
+    virtual void PrintfWebSocketMessage( const char* fmt, ... ) = 0;
+
     virtual void CloseConnection( ) = 0;
 
     // Generate timer event for the connection associated with the response
     // after the specified number of milliseconds
     virtual void SetTimer( uint32_t msec ) = 0;
+
+    // Subscribe the connection associated with the response to notifications of its
+    // handler (see IWebRequestHandler::NotifySubscribers()) till the connection closes
+    // or gets unsubscribed
+    virtual void Subscribe( ) = 0;
+    virtual void Unsubscribe( ) = 0;
+
+    // Get/Set data kept with the connection till it closes, so handlers can track
+    // state of their clients between events
+    virtual std::shared_ptr<IWebClientData> ClientData( ) const = 0;
+    virtual void SetClientData( const std::shared_ptr<IWebClientData>& data ) = 0;
 };
 
 /* ================================================================= */
 /* Handler of a web request                                          */
 /* ================================================================= */
+// When web server runs several threads, the same handler is called from all of them
+// concurrently, so handlers must be thread safe. Timer events of a connection are always
+// delivered on the thread which handled its request.
 class IWebRequestHandler
 {
 protected:
@@ -107,9 +152,35 @@ public:
     // Handle timer event
     virtual void HandleTimer( IWebResponse& ) { };
 
+    // Handle notification event of a subscribed connection
+    virtual void HandleNotification( IWebResponse& ) { };
+
+    // Handle request to open WebSocket connection. The connection is accepted unless the handler
+    // sends an error (which is what handlers not supporting WebSockets do). Nothing else can be sent
+    // at this point, but the handler may set client data, subscribe the connection, etc.
+    virtual void HandleWebSocketRequest( const IWebRequest&, IWebResponse& response ) { response.SendError( 404 ); };
+
+    // Handle WebSocket connection, which was accepted and is ready for sending messages
+    virtual void HandleWebSocketOpen( IWebResponse& ) { };
+
+    // Handle message (text or binary) received from WebSocket client
+    virtual void HandleWebSocketMessage( const uint8_t* /* data */, size_t /* length */, IWebResponse& ) { };
+
+    // Handle shared buffer (see IWebResponse::SendShared()) handed over to the system for sending - called
+    // with the buffer's owner once all its data is sent, from the thread serving the connection
+    virtual void HandleSharedSent( const std::shared_ptr<const void>& /* owner */ ) { };
+
+    // Wake all connections subscribed to the handler, so HandleNotification() is called for
+    // each of them from the thread serving it. Can be called from any thread, does not wait
+    // for the connections to be handled. Does nothing if the handler's web server is not running.
+    void NotifySubscribers( );
+
 private:
-    std::string mUri;
-    bool        mCanHandleSubContent;
+    friend class Private::XWebServerData;
+
+    std::string              mUri;
+    bool                     mCanHandleSubContent;
+    Private::XWebServerData* mServer;
 };
 
 /* ================================================================= */
@@ -120,6 +191,12 @@ typedef struct
     uint32_t       Length;
     const char*    Type;
     const uint8_t* Body;
+    // optional: hash of the content used as its entity tag; compressed variants of the content
+    const char*    Hash;
+    uint32_t       GzipLength;
+    const uint8_t* GzipBody;
+    uint32_t       BrotliLength;
+    const uint8_t* BrotliBody;
 }
 XEmbeddedContent;
 
@@ -129,13 +206,16 @@ XEmbeddedContent;
 class XEmbeddedContentHandler : public IWebRequestHandler
 {
 public:
-    XEmbeddedContentHandler( const std::string& uri, const XEmbeddedContent* content );
+    // Content is provided compressed if client accepts it. Clients may cache it for the specified
+    // number of seconds (0 - they must check if it changed, which is answered with 304 if it did not).
+    XEmbeddedContentHandler( const std::string& uri, const XEmbeddedContent* content, uint32_t maxAge = 0 );
 
     // Handle request providing given embedded content
     void HandleHttpRequest( const IWebRequest& request, IWebResponse& response );
 
 private:
     const XEmbeddedContent* mContent;
+    uint32_t                mMaxAge;
 };
 
 /* ================================================================= */
@@ -165,6 +245,13 @@ public:
     uint16_t Port( ) const;
     XWebServer& SetPort( uint16_t port );
 
+    // Get/Set number of threads serving clients (1-32, default 1). Every thread runs its
+    // own event loop with a listening socket bound to the same port (SO_REUSEPORT), so the
+    // system spreads new connections between them. Where the option is not available
+    // (Windows), a single thread is used.
+    uint32_t ThreadCount( ) const;
+    XWebServer& SetThreadCount( uint32_t threadCount );
+
     // Add/Remove web handler
     XWebServer& AddHandler( const std::shared_ptr<IWebRequestHandler>& handler, UserGroup allowedUserGroup = UserGroup::Anyone );
     void RemoveHandler( const std::shared_ptr<IWebRequestHandler>& handler );
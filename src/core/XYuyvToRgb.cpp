@@ -0,0 +1,440 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <string.h>
+
+#include "XYuyvToRgb.hpp"
+#include "XImage.hpp"
+
+#if defined( __GNUC__ ) && ( defined( __x86_64__ ) || defined( __i386__ ) )
+    #define XYUYV_X86
+    #include <immintrin.h>
+#elif defined( __aarch64__ ) || defined( __ARM_NEON )
+    #define XYUYV_NEON
+    #include <arm_neon.h>
+#endif
+
+/*
+    All implementations do YUYV to RGB conversion using the next coefficients.
+    However those are multiplied by 256 to get integer calculations.
+
+    r = y + (1.4065 * (cr - 128));
+    g = y - (0.3455 * (cb - 128)) - (0.7169 * (cr - 128));
+    b = y + (1.7790 * (cb - 128));
+
+    Since y is multiplied by 256 as well, the sum shifted right by 8 equals y plus the
+    arithmetically shifted chroma term. Vectorized versions rely on that, calculating chroma
+    terms once per pixel pair in 32 bit and adding them to luma with 16 bit precision (no
+    overflow is possible), then saturating to 8 bit. Vectorized versions write RGB only
+    (RedIndex = 0, GreenIndex = 1, BlueIndex = 2).
+*/
+
+namespace Private
+{
+    typedef void ( *YuyvToRgbRowFunction )( const uint8_t* yuyv, uint8_t* rgb, int32_t width );
+
+    // Scalar (reference) conversion of a single row
+    static void YuyvToRgbRowScalar( const uint8_t* yuyvPtr, uint8_t* rgbRow, int32_t width )
+    {
+        int r, g, b;
+        int y, u, v;
+        int z = 0;
+
+        for ( int32_t ix = 0; ix < width; ix++ )
+        {
+            y = ( ( z == 0 ) ? yuyvPtr[0] : yuyvPtr[2] ) << 8;
+            u = yuyvPtr[1] - 128;
+            v = yuyvPtr[3] - 128;
+
+            r = ( y + ( 360 * v ) ) >> 8;
+            g = ( y - ( 88  * u ) - ( 184 * v ) ) >> 8;
+            b = ( y + ( 455 * u ) ) >> 8;
+
+            rgbRow[RedIndex]   = (uint8_t) ( ( r > 255 ) ? 255 : ( ( r < 0 ) ? 0 : r ) );
+            rgbRow[GreenIndex] = (uint8_t) ( ( g > 255 ) ? 255 : ( ( g < 0 ) ? 0 : g ) );
+            rgbRow[BlueIndex]  = (uint8_t) ( ( b > 255 ) ? 255 : ( ( b < 0 ) ? 0 : b ) );
+
+            if ( z++ )
+            {
+                z = 0;
+                yuyvPtr += 4;
+            }
+
+            rgbRow += 3;
+        }
+    }
+
+#ifdef XYUYV_X86
+
+    // Calculate one color plane for 16 pixels, given luma and chroma (minus 128) of two halves
+    __attribute__(( target( "sse2" ) ))
+    static inline __m128i YuyvToPlaneSse2( __m128i y0, __m128i y1, __m128i uv0, __m128i uv1, __m128i coef )
+    {
+        // coefficients are for (u, v) pairs, so madd gives chroma term of every pixel pair
+        __m128i t0 = _mm_srai_epi32( _mm_madd_epi16( uv0, coef ), 8 );
+        __m128i t1 = _mm_srai_epi32( _mm_madd_epi16( uv1, coef ), 8 );
+        __m128i t  = _mm_packs_epi32( t0, t1 );
+
+        // duplicate chroma terms, so each pixel of a pair gets the same
+        t0 = _mm_unpacklo_epi16( t, t );
+        t1 = _mm_unpackhi_epi16( t, t );
+
+        return _mm_packus_epi16( _mm_add_epi16( y0, t0 ), _mm_add_epi16( y1, t1 ) );
+    }
+
+    // Convert 16 YUYV pixels (32 bytes) into separate R, G and B planes
+    __attribute__(( target( "sse2" ) ))
+    static inline void YuyvToPlanesSse2( const uint8_t* yuyv, __m128i& r, __m128i& g, __m128i& b )
+    {
+        const __m128i lowMask = _mm_set1_epi16( 0x00FF );
+        const __m128i offset  = _mm_set1_epi16( 128 );
+        const __m128i rCoef   = _mm_set1_epi32( static_cast<int32_t>( 360u << 16 ) );
+        const __m128i gCoef   = _mm_set1_epi32( static_cast<int32_t>( ( static_cast<uint32_t>( -184 ) << 16 ) | ( static_cast<uint32_t>( -88 ) & 0xFFFF ) ) );
+        const __m128i bCoef   = _mm_set1_epi32( 455 );
+
+        __m128i in0 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( yuyv ) );
+        __m128i in1 = _mm_loadu_si128( reinterpret_cast<const __m128i*>( yuyv + 16 ) );
+        __m128i y0  = _mm_and_si128( in0, lowMask );
+        __m128i y1  = _mm_and_si128( in1, lowMask );
+        __m128i uv0 = _mm_sub_epi16( _mm_srli_epi16( in0, 8 ), offset );
+        __m128i uv1 = _mm_sub_epi16( _mm_srli_epi16( in1, 8 ), offset );
+
+        r = YuyvToPlaneSse2( y0, y1, uv0, uv1, rCoef );
+        g = YuyvToPlaneSse2( y0, y1, uv0, uv1, gCoef );
+        b = YuyvToPlaneSse2( y0, y1, uv0, uv1, bCoef );
+    }
+
+    // Interleave 16 pixels of R, G and B planes into RGB. Writes 49 bytes - one byte past the
+    // last pixel, so caller must make sure there is at least one more pixel in the row.
+    __attribute__(( target( "sse2" ) ))
+    static inline void StoreRgbSse2( uint8_t* rgb, __m128i r, __m128i g, __m128i b )
+    {
+        const __m128i zero = _mm_setzero_si128( );
+        __m128i rg0 = _mm_unpacklo_epi8( r, g );
+        __m128i rg1 = _mm_unpackhi_epi8( r, g );
+        __m128i bz0 = _mm_unpacklo_epi8( b, zero );
+        __m128i bz1 = _mm_unpackhi_epi8( b, zero );
+        __m128i quads[4] =
+        {
+            _mm_unpacklo_epi16( rg0, bz0 ), _mm_unpackhi_epi16( rg0, bz0 ),
+            _mm_unpacklo_epi16( rg1, bz1 ), _mm_unpackhi_epi16( rg1, bz1 )
+        };
+
+        for ( int i = 0; i < 4; i++ )
+        {
+            for ( int j = 0; j < 4; j++ )
+            {
+                int32_t pixel = _mm_cvtsi128_si32( quads[i] );
+
+                memcpy( rgb, &pixel, 4 );
+                quads[i] = _mm_srli_si128( quads[i], 4 );
+                rgb += 3;
+            }
+        }
+    }
+
+    __attribute__(( target( "sse2" ) ))
+    static void YuyvToRgbRowSse2( const uint8_t* yuyv, uint8_t* rgb, int32_t width )
+    {
+        __m128i r, g, b;
+        int32_t ix = 0;
+
+        for ( ; ix + 16 < width; ix += 16 )
+        {
+            YuyvToPlanesSse2( yuyv, r, g, b );
+            StoreRgbSse2( rgb, r, g, b );
+
+            yuyv += 32;
+            rgb  += 48;
+        }
+
+        YuyvToRgbRowScalar( yuyv, rgb, width - ix );
+    }
+
+    // Interleave 16 pixels of R, G and B planes into RGB (48 bytes)
+    __attribute__(( target( "ssse3" ) ))
+    static inline void StoreRgbSsse3( uint8_t* rgb, __m128i r, __m128i g, __m128i b )
+    {
+        const __m128i r0 = _mm_setr_epi8(  0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1, -1,  5 );
+        const __m128i g0 = _mm_setr_epi8( -1,  0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1, -1 );
+        const __m128i b0 = _mm_setr_epi8( -1, -1,  0, -1, -1,  1, -1, -1,  2, -1, -1,  3, -1, -1,  4, -1 );
+        const __m128i r1 = _mm_setr_epi8( -1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1, 10, -1 );
+        const __m128i g1 = _mm_setr_epi8(  5, -1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1, 10 );
+        const __m128i b1 = _mm_setr_epi8( -1,  5, -1, -1,  6, -1, -1,  7, -1, -1,  8, -1, -1,  9, -1, -1 );
+        const __m128i r2 = _mm_setr_epi8( -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1, -1 );
+        const __m128i g2 = _mm_setr_epi8( -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15, -1 );
+        const __m128i b2 = _mm_setr_epi8( 10, -1, -1, 11, -1, -1, 12, -1, -1, 13, -1, -1, 14, -1, -1, 15 );
+
+        __m128i out0 = _mm_or_si128( _mm_or_si128( _mm_shuffle_epi8( r, r0 ), _mm_shuffle_epi8( g, g0 ) ), _mm_shuffle_epi8( b, b0 ) );
+        __m128i out1 = _mm_or_si128( _mm_or_si128( _mm_shuffle_epi8( r, r1 ), _mm_shuffle_epi8( g, g1 ) ), _mm_shuffle_epi8( b, b1 ) );
+        __m128i out2 = _mm_or_si128( _mm_or_si128( _mm_shuffle_epi8( r, r2 ), _mm_shuffle_epi8( g, g2 ) ), _mm_shuffle_epi8( b, b2 ) );
+
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( rgb ), out0 );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( rgb + 16 ), out1 );
+        _mm_storeu_si128( reinterpret_cast<__m128i*>( rgb + 32 ), out2 );
+    }
+
+    __attribute__(( target( "ssse3" ) ))
+    static void YuyvToRgbRowSsse3( const uint8_t* yuyv, uint8_t* rgb, int32_t width )
+    {
+        __m128i r, g, b;
+        int32_t ix = 0;
+
+        for ( ; ix + 16 <= width; ix += 16 )
+        {
+            YuyvToPlanesSse2( yuyv, r, g, b );
+            StoreRgbSsse3( rgb, r, g, b );
+
+            yuyv += 32;
+            rgb  += 48;
+        }
+
+        YuyvToRgbRowScalar( yuyv, rgb, width - ix );
+    }
+
+    // Same as YuyvToPlaneSse2(), but for 32 pixels. Works within 128 bit lanes.
+    __attribute__(( target( "avx2" ) ))
+    static inline __m256i YuyvToPlaneAvx2( __m256i y0, __m256i y1, __m256i uv0, __m256i uv1, __m256i coef )
+    {
+        __m256i t0 = _mm256_srai_epi32( _mm256_madd_epi16( uv0, coef ), 8 );
+        __m256i t1 = _mm256_srai_epi32( _mm256_madd_epi16( uv1, coef ), 8 );
+        __m256i t  = _mm256_packs_epi32( t0, t1 );
+
+        t0 = _mm256_unpacklo_epi16( t, t );
+        t1 = _mm256_unpackhi_epi16( t, t );
+
+        // lanes hold pixels 0-7, 16-23 | 8-15, 24-31 - put them back in order
+        return _mm256_permute4x64_epi64( _mm256_packus_epi16( _mm256_add_epi16( y0, t0 ), _mm256_add_epi16( y1, t1 ) ), 0xD8 );
+    }
+
+    __attribute__(( target( "avx2" ) ))
+    static void YuyvToRgbRowAvx2( const uint8_t* yuyv, uint8_t* rgb, int32_t width )
+    {
+        const __m256i lowMask = _mm256_set1_epi16( 0x00FF );
+        const __m256i offset  = _mm256_set1_epi16( 128 );
+        const __m256i rCoef   = _mm256_set1_epi32( static_cast<int32_t>( 360u << 16 ) );
+        const __m256i gCoef   = _mm256_set1_epi32( static_cast<int32_t>( ( static_cast<uint32_t>( -184 ) << 16 ) | ( static_cast<uint32_t>( -88 ) & 0xFFFF ) ) );
+        const __m256i bCoef   = _mm256_set1_epi32( 455 );
+        int32_t       ix      = 0;
+
+        for ( ; ix + 32 <= width; ix += 32 )
+        {
+            __m256i in0 = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( yuyv ) );
+            __m256i in1 = _mm256_loadu_si256( reinterpret_cast<const __m256i*>( yuyv + 32 ) );
+            __m256i y0  = _mm256_and_si256( in0, lowMask );
+            __m256i y1  = _mm256_and_si256( in1, lowMask );
+            __m256i uv0 = _mm256_sub_epi16( _mm256_srli_epi16( in0, 8 ), offset );
+            __m256i uv1 = _mm256_sub_epi16( _mm256_srli_epi16( in1, 8 ), offset );
+
+            __m256i r = YuyvToPlaneAvx2( y0, y1, uv0, uv1, rCoef );
+            __m256i g = YuyvToPlaneAvx2( y0, y1, uv0, uv1, gCoef );
+            __m256i b = YuyvToPlaneAvx2( y0, y1, uv0, uv1, bCoef );
+
+            StoreRgbSsse3( rgb,      _mm256_castsi256_si128( r ), _mm256_castsi256_si128( g ), _mm256_castsi256_si128( b ) );
+            StoreRgbSsse3( rgb + 48, _mm256_extracti128_si256( r, 1 ), _mm256_extracti128_si256( g, 1 ), _mm256_extracti128_si256( b, 1 ) );
+
+            yuyv += 64;
+            rgb  += 96;
+        }
+
+        // let SSSE3 version do the rest, which finishes with scalar code
+        YuyvToRgbRowSsse3( yuyv, rgb, width - ix );
+    }
+
+#endif // XYUYV_X86
+
+#ifdef XYUYV_NEON
+
+    // Calculate one color plane for 16 pixels, given luma of even/odd pixels and chroma term
+    static inline uint8x16_t YuyvToPlaneNeon( int16x8_t yEven, int16x8_t yOdd, int32x4_t tLow, int32x4_t tHigh )
+    {
+        int16x8_t  t    = vcombine_s16( vshrn_n_s32( tLow, 8 ), vshrn_n_s32( tHigh, 8 ) );
+        uint8x8x2_t out = vzip_u8( vqmovun_s16( vaddq_s16( yEven, t ) ), vqmovun_s16( vaddq_s16( yOdd, t ) ) );
+
+        return vcombine_u8( out.val[0], out.val[1] );
+    }
+
+    static void YuyvToRgbRowNeon( const uint8_t* yuyv, uint8_t* rgb, int32_t width )
+    {
+        const uint8x8_t offset = vdup_n_u8( 128 );
+        int32_t         ix     = 0;
+
+        for ( ; ix + 16 <= width; ix += 16 )
+        {
+            // Y0, U, Y1, V of 8 pixel pairs
+            uint8x8x4_t in     = vld4_u8( yuyv );
+            int16x8_t   yEven  = vreinterpretq_s16_u16( vmovl_u8( in.val[0] ) );
+            int16x8_t   yOdd   = vreinterpretq_s16_u16( vmovl_u8( in.val[2] ) );
+            int16x8_t   u      = vreinterpretq_s16_u16( vsubl_u8( in.val[1], offset ) );
+            int16x8_t   v      = vreinterpretq_s16_u16( vsubl_u8( in.val[3], offset ) );
+            int16x4_t   uLow   = vget_low_s16( u ), uHigh = vget_high_s16( u );
+            int16x4_t   vLow   = vget_low_s16( v ), vHigh = vget_high_s16( v );
+            uint8x16x3_t out;
+
+            out.val[0] = YuyvToPlaneNeon( yEven, yOdd, vmull_n_s16( vLow, 360 ), vmull_n_s16( vHigh, 360 ) );
+            out.val[1] = YuyvToPlaneNeon( yEven, yOdd,
+                                          vmlal_n_s16( vmull_n_s16( uLow, -88 ), vLow, -184 ),
+                                          vmlal_n_s16( vmull_n_s16( uHigh, -88 ), vHigh, -184 ) );
+            out.val[2] = YuyvToPlaneNeon( yEven, yOdd, vmull_n_s16( uLow, 455 ), vmull_n_s16( uHigh, 455 ) );
+
+            vst3q_u8( rgb, out );
+
+            yuyv += 32;
+            rgb  += 48;
+        }
+
+        YuyvToRgbRowScalar( yuyv, rgb, width - ix );
+    }
+
+#endif // XYUYV_NEON
+
+    // Get row conversion function of the specified implementation (scalar if not supported)
+    static YuyvToRgbRowFunction GetRowFunction( XYuyvToRgbImplementation implementation )
+    {
+        YuyvToRgbRowFunction rowFunction = YuyvToRgbRowScalar;
+
+        if ( XYuyvToRgb::IsSupported( implementation ) )
+        {
+            switch ( implementation )
+            {
+#ifdef XYUYV_X86
+            case XYuyvToRgbImplementation::SSE2:
+                rowFunction = YuyvToRgbRowSse2;
+                break;
+            case XYuyvToRgbImplementation::SSSE3:
+                rowFunction = YuyvToRgbRowSsse3;
+                break;
+            case XYuyvToRgbImplementation::AVX2:
+                rowFunction = YuyvToRgbRowAvx2;
+                break;
+#endif
+#ifdef XYUYV_NEON
+            case XYuyvToRgbImplementation::NEON:
+                rowFunction = YuyvToRgbRowNeon;
+                break;
+#endif
+            default:
+                break;
+            }
+        }
+
+        return rowFunction;
+    }
+
+    // Convert image row by row using the specified function
+    static void ConvertRows( YuyvToRgbRowFunction rowFunction, const uint8_t* yuyv, int32_t yuyvStride,
+                             uint8_t* rgb, int32_t rgbStride, int32_t width, int32_t height )
+    {
+        for ( int32_t iy = 0; iy < height; iy++ )
+        {
+            rowFunction( yuyv, rgb, width );
+
+            yuyv += yuyvStride;
+            rgb  += rgbStride;
+        }
+    }
+}
+
+// Convert YUYV image into RGB24 using the best implementation available
+void XYuyvToRgb::Convert( const uint8_t* yuyv, int32_t yuyvStride, uint8_t* rgb, int32_t rgbStride,
+                          int32_t width, int32_t height )
+{
+    // CPU features are checked only once
+    static const Private::YuyvToRgbRowFunction rowFunction = Private::GetRowFunction( Best( ) );
+
+    Private::ConvertRows( rowFunction, yuyv, yuyvStride, rgb, rgbStride, width, height );
+}
+
+// Convert using the specified implementation
+void XYuyvToRgb::Convert( XYuyvToRgbImplementation implementation,
+                          const uint8_t* yuyv, int32_t yuyvStride, uint8_t* rgb, int32_t rgbStride,
+                          int32_t width, int32_t height )
+{
+    Private::ConvertRows( Private::GetRowFunction( implementation ), yuyv, yuyvStride, rgb, rgbStride, width, height );
+}
+
+// Get the best implementation supported by the running CPU
+XYuyvToRgbImplementation XYuyvToRgb::Best( )
+{
+    static const XYuyvToRgbImplementation order[] =
+    {
+        XYuyvToRgbImplementation::AVX2, XYuyvToRgbImplementation::SSSE3,
+        XYuyvToRgbImplementation::SSE2, XYuyvToRgbImplementation::NEON
+    };
+
+    for ( XYuyvToRgbImplementation implementation : order )
+    {
+        if ( IsSupported( implementation ) )
+        {
+            return implementation;
+        }
+    }
+
+    return XYuyvToRgbImplementation::Scalar;
+}
+
+// Check if the specified implementation is built in and supported by the running CPU
+bool XYuyvToRgb::IsSupported( XYuyvToRgbImplementation implementation )
+{
+    bool ret = false;
+
+    switch ( implementation )
+    {
+    case XYuyvToRgbImplementation::Scalar:
+        ret = true;
+        break;
+
+#ifdef XYUYV_X86
+    case XYuyvToRgbImplementation::SSE2:
+        __builtin_cpu_init( );
+        ret = __builtin_cpu_supports( "sse2" );
+        break;
+    case XYuyvToRgbImplementation::SSSE3:
+        __builtin_cpu_init( );
+        ret = __builtin_cpu_supports( "ssse3" );
+        break;
+    case XYuyvToRgbImplementation::AVX2:
+        __builtin_cpu_init( );
+        ret = __builtin_cpu_supports( "avx2" );
+        break;
+#endif
+
+#ifdef XYUYV_NEON
+    // NEON is mandatory on AArch64; 32 bit ARM builds get it only if compiled with NEON enabled
+    case XYuyvToRgbImplementation::NEON:
+        ret = true;
+        break;
+#endif
+
+    default:
+        break;
+    }
+
+    return ret;
+}
+
+// Get name of the specified implementation
+const char* XYuyvToRgb::Name( XYuyvToRgbImplementation implementation )
+{
+    static const char* names[] = { "Scalar", "SSE2", "SSSE3", "AVX2", "NEON" };
+    uint32_t index = static_cast<uint32_t>( implementation );
+
+    return ( index < sizeof( names ) / sizeof( names[0] ) ) ? names[index] : "Unknown";
+}
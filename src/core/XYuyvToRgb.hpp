@@ -0,0 +1,64 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef XYUYV_TO_RGB_HPP
+#define XYUYV_TO_RGB_HPP
+
+#include <stdint.h>
+
+// Implementations of YUYV to RGB conversion
+enum class XYuyvToRgbImplementation
+{
+    Scalar = 0,     // plain C++, the reference all other implementations must match bit for bit
+    SSE2,
+    SSSE3,
+    AVX2,
+    NEON
+};
+
+// Conversion of packed YUYV (YUV 4:2:2) images into RGB24. Vectorized implementations are
+// picked at run time, depending on what the CPU supports, and produce exactly the same
+// result as the scalar one (fixed point BT.601, full range).
+class XYuyvToRgb
+{
+private:
+    XYuyvToRgb( );
+
+public:
+    // Convert YUYV image into RGB24 using the best implementation available.
+    // Width must be even; strides are in bytes.
+    static void Convert( const uint8_t* yuyv, int32_t yuyvStride, uint8_t* rgb, int32_t rgbStride,
+                         int32_t width, int32_t height );
+
+    // Convert using the specified implementation - it falls back to the scalar one,
+    // if the requested implementation is not supported
+    static void Convert( XYuyvToRgbImplementation implementation,
+                         const uint8_t* yuyv, int32_t yuyvStride, uint8_t* rgb, int32_t rgbStride,
+                         int32_t width, int32_t height );
+
+    // Get the best implementation supported by the running CPU
+    static XYuyvToRgbImplementation Best( );
+    // Check if the specified implementation is built in and supported by the running CPU
+    static bool IsSupported( XYuyvToRgbImplementation implementation );
+    // Get name of the specified implementation
+    static const char* Name( XYuyvToRgbImplementation implementation );
+};
+
+#endif // XYUYV_TO_RGB_HPP
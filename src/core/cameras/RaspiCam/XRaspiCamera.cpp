@@ -20,6 +20,7 @@
 
 #include <mutex>
 #include <thread>
+#include <chrono>
 
 #include <bcm_host.h>
 #include <interface/vcos/vcos.h>
@@ -33,8 +34,10 @@
 
 #include "XRaspiCamera.hpp"
 #include "XManualResetEvent.hpp"
+#include "XMetrics.hpp"
 
 using namespace std;
+using namespace std::chrono;
 
 namespace Private
 {
@@ -60,6 +63,11 @@ namespace Private
         MMAL_POOL_T*            VideoBufferPool;
     
         static bool             HostInitDone;
+
+        XMetricCounter*         FramesCapturedMetric;
+        XMetricCounter*         FramesDroppedMetric;
+        XMetricCounter*         RequeueFailuresMetric;
+        XMetricHistogram*       CaptureTimeMetric;
         
     public:
         uint32_t                FramesReceived;
@@ -96,6 +104,13 @@ namespace Private
             CameraImageEffect( ImageEffect::None ),
             TextAnnotation( ), TextBlackBackground( true )
         {
+            XMetricsRegistry& metrics = XMetricsRegistry::Instance( );
+
+            FramesCapturedMetric  = &metrics.Counter( "cam2web_frames_captured_total", "Frames received from camera." );
+            FramesDroppedMetric   = &metrics.Counter( "cam2web_frames_dropped_total", "Frames lost before getting to clients - skipped by camera driver or failed to get an image for." );
+            RequeueFailuresMetric = &metrics.Counter( "cam2web_capture_requeue_failures_total", "Capture buffers, which failed to get back into camera's queue." );
+            CaptureTimeMetric     = &metrics.Histogram( "cam2web_capture_seconds", "Time to handle a captured frame - from getting it from camera to giving its buffer back.",
+                                                        XMetricsRegistry::TimeBuckets( ), 1e-6 );
         }
                 
         bool Start( );
@@ -1130,7 +1145,8 @@ void XRaspiCameraData::CameraControlCallback( MMAL_PORT_T* port, MMAL_BUFFER_HEA
 // Callback signalling availability of a new video frame
 void XRaspiCameraData::VideoBufferCallback( MMAL_PORT_T* port, MMAL_BUFFER_HEADER_T* buffer )
 {
-    XRaspiCameraData* me = reinterpret_cast<XRaspiCameraData*>( port->userdata );
+    XRaspiCameraData*        me        = reinterpret_cast<XRaspiCameraData*>( port->userdata );
+    steady_clock::time_point startTime = steady_clock::now( );
     
     if ( buffer->length != 0 )
     {
@@ -1142,13 +1158,16 @@ void XRaspiCameraData::VideoBufferCallback( MMAL_PORT_T* port, MMAL_BUFFER_HEADE
                 XImage::Create( buffer->data + buffer->offset, buffer->length, 1, buffer->length, XPixelFormat::JPEG );
                 
             me->FramesReceived++;
+            me->FramesCapturedMetric->Increment( );
 
             if ( image )
             {
+                image->SetSequence( me->FramesReceived );
                 me->NotifyNewImage( image );
             }
             else
             {
+                me->FramesDroppedMetric->Increment( );
                 me->NotifyError( "Failed allocating an image" );
             }
         }
@@ -1171,9 +1190,12 @@ void XRaspiCameraData::VideoBufferCallback( MMAL_PORT_T* port, MMAL_BUFFER_HEADE
         
         if ( ( !newBuffer ) || ( status != MMAL_SUCCESS ) )
         {
+            me->RequeueFailuresMetric->Increment( );
             me->NotifyError( "Unable to return buffer to video port" );
         }
     }
+
+    me->CaptureTimeMetric->Observe( static_cast<uint64_t>( duration_cast<microseconds>( steady_clock::now( ) - startTime ).count( ) ) );
 }
 
 } // namespace Private
@@ -0,0 +1,801 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <endian.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <vector>
+
+#include "XReplayVideoSource.hpp"
+#include "XManualResetEvent.hpp"
+#include "XImage.hpp"
+#include "XMetrics.hpp"
+#include "XLog.hpp"
+
+using namespace std;
+using namespace std::chrono;
+
+// magic number and minimum header size of version 1 uplink frames
+#define UPLINK_MAGIC          "C2WF"
+#define UPLINK_V1_HEADER_SIZE (40)
+
+namespace Private
+{
+    // Recording mapped into memory - unmapped when the last frame leased from it is released
+    class XMappedRecording : private Uncopyable
+    {
+    public:
+        uint8_t* Data;
+        size_t   Size;
+
+    public:
+        XMappedRecording( uint8_t* data, size_t size ) : Data( data ), Size( size ) { }
+        ~XMappedRecording( ) { munmap( Data, Size ); }
+    };
+
+    // Location of a frame within the recording and its capture time (microseconds since epoch, 0 if unknown)
+    struct XRecordedFrame
+    {
+        size_t   Offset;
+        uint32_t Size;
+        uint64_t Timestamp;
+    };
+
+    class XReplayVideoSourceData
+    {
+    private:
+        mutable recursive_mutex Sync;
+        thread                  SourceThread;
+        XManualResetEvent       NeedToStop;
+        IVideoSourceListener*   Listener;
+        bool                    Running;
+
+        XMetricCounter*         FramesCapturedMetric;
+
+    public:
+        atomic<uint32_t>        FramesReceived;
+        atomic<uint32_t>        FramesLate;
+        atomic<XReplayFormat>   Format;
+        atomic<uint32_t>        RecordedFrames;
+        string                  FileName;
+        float                   Speed;
+        uint32_t                FrameRate;
+        bool                    Looped;
+
+    public:
+        XReplayVideoSourceData( ) :
+            Sync( ), SourceThread( ), NeedToStop( ), Listener( nullptr ), Running( false ),
+            FramesReceived( 0 ), FramesLate( 0 ), Format( XReplayFormat::Unknown ), RecordedFrames( 0 ),
+            FileName( ), Speed( 1.0f ), FrameRate( 30 ), Looped( false )
+        {
+            FramesCapturedMetric = &XMetricsRegistry::Instance( ).Counter( "cam2web_frames_captured_total", "Frames received from camera." );
+        }
+
+        bool Start( );
+        void SignalToStop( );
+        void WaitForStop( );
+        bool IsRunning( );
+        IVideoSourceListener* SetListener( IVideoSourceListener* listener );
+
+        void NotifyNewImage( const shared_ptr<const XImage>& image );
+        void NotifyError( const string& errorMessage, bool fatal = false );
+
+        template <typename T> void SetProperty( T& property, T value );
+
+    private:
+        static void SourceThreadHandler( XReplayVideoSourceData* me );
+
+        void Run( );
+        bool WaitTill( steady_clock::time_point time );
+        nanoseconds ScaleTime( uint64_t time ) const;
+
+        shared_ptr<XMappedRecording> MapRecording( );
+        static XReplayFormat DetectFormat( const uint8_t* data, size_t size );
+        static void IndexJpegFrames( const uint8_t* data, size_t size, vector<XRecordedFrame>& frames );
+        static void IndexMultipartFrames( const uint8_t* data, size_t size, vector<XRecordedFrame>& frames );
+        static void IndexUplinkFrames( const uint8_t* data, size_t size, vector<XRecordedFrame>& frames );
+        static size_t FindJpegEnd( const uint8_t* data, size_t size );
+    };
+}
+
+const shared_ptr<XReplayVideoSource> XReplayVideoSource::Create( )
+{
+    return shared_ptr<XReplayVideoSource>( new XReplayVideoSource );
+}
+
+XReplayVideoSource::XReplayVideoSource( ) :
+    mData( new Private::XReplayVideoSourceData( ) )
+{
+}
+
+XReplayVideoSource::~XReplayVideoSource( )
+{
+    mData->WaitForStop( );
+    delete mData;
+}
+
+// Start video source
+bool XReplayVideoSource::Start( )
+{
+    return mData->Start( );
+}
+
+// Signal video source to stop
+void XReplayVideoSource::SignalToStop( )
+{
+    mData->SignalToStop( );
+}
+
+// Wait till video source stops
+void XReplayVideoSource::WaitForStop( )
+{
+    mData->WaitForStop( );
+}
+
+// Check if video source is running
+bool XReplayVideoSource::IsRunning( )
+{
+    return mData->IsRunning( );
+}
+
+// Get number of frames received since the start of the video source
+uint32_t XReplayVideoSource::FramesReceived( )
+{
+    return mData->FramesReceived;
+}
+
+// Get number of frames, which could not be provided in time
+uint32_t XReplayVideoSource::FramesLate( )
+{
+    return mData->FramesLate;
+}
+
+// Get format of the recording and number of frames in it
+XReplayFormat XReplayVideoSource::RecordingFormat( ) const
+{
+    return mData->Format;
+}
+uint32_t XReplayVideoSource::RecordedFrames( ) const
+{
+    return mData->RecordedFrames;
+}
+
+// Set video source listener
+IVideoSourceListener* XReplayVideoSource::SetListener( IVideoSourceListener* listener )
+{
+    return mData->SetListener( listener );
+}
+
+// Get/Set name of the file to replay
+string XReplayVideoSource::FileName( ) const
+{
+    return mData->FileName;
+}
+void XReplayVideoSource::SetFileName( const string& fileName )
+{
+    mData->SetProperty( mData->FileName, fileName );
+}
+
+// Get/Set replay speed
+float XReplayVideoSource::Speed( ) const
+{
+    return mData->Speed;
+}
+void XReplayVideoSource::SetSpeed( float speed )
+{
+    mData->SetProperty( mData->Speed, ( speed < 0.0f ) ? 0.0f : speed );
+}
+
+// Get/Set frame rate for recordings without capture times
+uint32_t XReplayVideoSource::FrameRate( ) const
+{
+    return mData->FrameRate;
+}
+void XReplayVideoSource::SetFrameRate( uint32_t frameRate )
+{
+    mData->SetProperty( mData->FrameRate, frameRate );
+}
+
+// Get/Set if the recording is replayed in a loop
+bool XReplayVideoSource::IsLooped( ) const
+{
+    return mData->Looped;
+}
+void XReplayVideoSource::SetLooped( bool looped )
+{
+    mData->SetProperty( mData->Looped, looped );
+}
+
+namespace Private
+{
+
+// Start the video source's thread
+bool XReplayVideoSourceData::Start( )
+{
+    lock_guard<recursive_mutex> lock( Sync );
+
+    if ( !IsRunning( ) )
+    {
+        NeedToStop.Reset( );
+        Running        = true;
+        FramesReceived = 0;
+        FramesLate     = 0;
+
+        SourceThread = thread( SourceThreadHandler, this );
+    }
+
+    return true;
+}
+
+// Signal video source to stop
+void XReplayVideoSourceData::SignalToStop( )
+{
+    lock_guard<recursive_mutex> lock( Sync );
+
+    if ( IsRunning( ) )
+    {
+        NeedToStop.Signal( );
+    }
+}
+
+// Wait till video source (its thread) stops
+void XReplayVideoSourceData::WaitForStop( )
+{
+    SignalToStop( );
+
+    if ( ( IsRunning( ) ) || ( SourceThread.joinable( ) ) )
+    {
+        SourceThread.join( );
+    }
+}
+
+// Check if video source is still running
+bool XReplayVideoSourceData::IsRunning( )
+{
+    lock_guard<recursive_mutex> lock( Sync );
+
+    if ( ( !Running ) && ( SourceThread.joinable( ) ) )
+    {
+        SourceThread.join( );
+    }
+
+    return Running;
+}
+
+// Set video source listener
+IVideoSourceListener* XReplayVideoSourceData::SetListener( IVideoSourceListener* listener )
+{
+    lock_guard<recursive_mutex> lock( Sync );
+    IVideoSourceListener* oldListener = Listener;
+
+    Listener = listener;
+
+    return oldListener;
+}
+
+// Notify listener with a new image
+void XReplayVideoSourceData::NotifyNewImage( const shared_ptr<const XImage>& image )
+{
+    IVideoSourceListener* myListener;
+
+    {
+        lock_guard<recursive_mutex> lock( Sync );
+        myListener = Listener;
+    }
+
+    if ( myListener != nullptr )
+    {
+        myListener->OnNewImage( image );
+    }
+}
+
+// Notify listener about error
+void XReplayVideoSourceData::NotifyError( const string& errorMessage, bool fatal )
+{
+    IVideoSourceListener* myListener;
+
+    {
+        lock_guard<recursive_mutex> lock( Sync );
+        myListener = Listener;
+    }
+
+    if ( myListener != nullptr )
+    {
+        myListener->OnError( errorMessage, fatal );
+    }
+}
+
+// Set property of the video source if it is not running
+template <typename T> void XReplayVideoSourceData::SetProperty( T& property, T value )
+{
+    lock_guard<recursive_mutex> lock( Sync );
+
+    if ( !IsRunning( ) )
+    {
+        property = value;
+    }
+}
+
+// Background thread replaying frames
+void XReplayVideoSourceData::SourceThreadHandler( XReplayVideoSourceData* me )
+{
+    me->Run( );
+
+    {
+        lock_guard<recursive_mutex> lock( me->Sync );
+        me->Running = false;
+    }
+}
+
+// Replay frames of the recording till its end or till the video source is asked to stop
+void XReplayVideoSourceData::Run( )
+{
+    shared_ptr<XMappedRecording> recording = MapRecording( );
+    vector<XRecordedFrame>       frames;
+    vector<uint64_t>             frameTimes;
+    bool                         haveTimestamps = true;
+
+    if ( !recording )
+    {
+        return;
+    }
+
+    Format = DetectFormat( recording->Data, recording->Size );
+
+    switch ( Format )
+    {
+    case XReplayFormat::Jpeg:
+        IndexJpegFrames( recording->Data, recording->Size, frames );
+        break;
+    case XReplayFormat::Multipart:
+        IndexMultipartFrames( recording->Data, recording->Size, frames );
+        break;
+    case XReplayFormat::Uplink:
+        IndexUplinkFrames( recording->Data, recording->Size, frames );
+        break;
+    default:
+        NotifyError( "Unknown format of the recorded stream: " + FileName, true );
+        return;
+    }
+
+    RecordedFrames = static_cast<uint32_t>( frames.size( ) );
+
+    if ( frames.empty( ) )
+    {
+        NotifyError( "No frames found in the recorded stream: " + FileName, true );
+        return;
+    }
+
+    // time of every frame relative to the first one, microseconds - clock jumps back are ignored
+    for ( const XRecordedFrame& frame : frames )
+    {
+        haveTimestamps &= ( frame.Timestamp != 0 );
+    }
+
+    frameTimes.resize( frames.size( ) );
+
+    for ( size_t i = 1; i < frames.size( ); i++ )
+    {
+        if ( haveTimestamps )
+        {
+            frameTimes[i] = max( frameTimes[i - 1], frames[i].Timestamp - min( frames[i].Timestamp, frames[0].Timestamp ) );
+        }
+        else if ( FrameRate != 0 )
+        {
+            frameTimes[i] = static_cast<uint64_t>( i ) * 1000000 / FrameRate;
+        }
+    }
+
+    XLOG_INFO( "Replaying %u frames from %s", static_cast<uint32_t>( frames.size( ) ), FileName.c_str( ) );
+
+    // the loop restarts after average interval between frames
+    uint64_t loopGap = ( frames.size( ) > 1 ) ? frameTimes.back( ) / ( frames.size( ) - 1 ) :
+                       ( FrameRate != 0 )      ? 1000000 / FrameRate : 0;
+    bool     paced   = ( Speed > 0.0f ) && ( ( haveTimestamps ) || ( FrameRate != 0 ) );
+
+    steady_clock::time_point startTime = steady_clock::now( );
+    uint64_t                 sequence  = 0;
+    size_t                   index     = 0;
+
+    while ( !NeedToStop.IsSignaled( ) )
+    {
+        if ( index == frames.size( ) )
+        {
+            if ( !Looped )
+            {
+                break;
+            }
+
+            startTime += ScaleTime( frameTimes.back( ) + loopGap );
+            index      = 0;
+        }
+
+        if ( paced )
+        {
+            steady_clock::time_point dueTime = startTime + ScaleTime( frameTimes[index] );
+            steady_clock::time_point now     = steady_clock::now( );
+
+            // don't try catching up if the listener was too slow - it would replay a burst never recorded
+            if ( ( sequence != 0 ) && ( now > dueTime ) )
+            {
+                FramesLate++;
+                startTime += now - dueTime;
+            }
+            else if ( !WaitTill( dueTime ) )
+            {
+                break;
+            }
+        }
+
+        const XRecordedFrame& frame = frames[index++];
+
+        // the mapping stays alive while any of its frames is still in use
+        shared_ptr<XImage> image = XImage::Lease( recording->Data + frame.Offset, static_cast<int32_t>( frame.Size ), 1,
+                                                  static_cast<int32_t>( frame.Size ), XPixelFormat::JPEG, [recording]( ) { } );
+
+        FramesReceived++;
+        FramesCapturedMetric->Increment( );
+
+        if ( image )
+        {
+            image->SetTimestamp( static_cast<uint64_t>( duration_cast<microseconds>( system_clock::now( ).time_since_epoch( ) ).count( ) ) );
+            image->SetSequence( ++sequence );
+            NotifyNewImage( image );
+        }
+        else
+        {
+            NotifyError( "Failed allocating an image" );
+        }
+    }
+}
+
+// Wait till the specified time - returns false if video source needs to stop
+bool XReplayVideoSourceData::WaitTill( steady_clock::time_point time )
+{
+    steady_clock::time_point now = steady_clock::now( );
+
+    // the event can not wait with better than millisecond precision, so sleep the rest
+    if ( time - now > milliseconds( 2 ) )
+    {
+        if ( NeedToStop.Wait( static_cast<uint32_t>( duration_cast<milliseconds>( time - now ).count( ) - 1 ) ) )
+        {
+            return false;
+        }
+    }
+
+    this_thread::sleep_until( time );
+
+    return true;
+}
+
+// Convert time of a recorded frame (microseconds) to replay time
+nanoseconds XReplayVideoSourceData::ScaleTime( uint64_t time ) const
+{
+    return nanoseconds( static_cast<int64_t>( static_cast<double>( time ) * 1000.0 / Speed ) );
+}
+
+// Map the recording into memory
+shared_ptr<XMappedRecording> XReplayVideoSourceData::MapRecording( )
+{
+    shared_ptr<XMappedRecording> recording;
+    struct stat                  fileStat;
+    int                          fd = open( FileName.c_str( ), O_RDONLY );
+
+    if ( fd == -1 )
+    {
+        NotifyError( "Failed opening recorded stream: " + FileName, true );
+    }
+    else
+    {
+        if ( ( fstat( fd, &fileStat ) != 0 ) || ( fileStat.st_size == 0 ) )
+        {
+            NotifyError( "Recorded stream is empty: " + FileName, true );
+        }
+        else
+        {
+            // private mapping makes leased images writable like any others without changing the file;
+            // populating it in advance leaves no page faults for the replay
+            void* data = mmap( nullptr, static_cast<size_t>( fileStat.st_size ), PROT_READ | PROT_WRITE,
+                               MAP_PRIVATE | MAP_POPULATE, fd, 0 );
+
+            if ( data == MAP_FAILED )
+            {
+                NotifyError( "Failed mapping recorded stream into memory: " + FileName, true );
+            }
+            else
+            {
+                recording = make_shared<XMappedRecording>( static_cast<uint8_t*>( data ), static_cast<size_t>( fileStat.st_size ) );
+            }
+        }
+
+        close( fd );
+    }
+
+    return recording;
+}
+
+// Detect format of the recording by its first bytes
+XReplayFormat XReplayVideoSourceData::DetectFormat( const uint8_t* data, size_t size )
+{
+    XReplayFormat format = XReplayFormat::Unknown;
+
+    if ( ( size >= 2 ) && ( data[0] == 0xFF ) && ( data[1] == 0xD8 ) )
+    {
+        format = XReplayFormat::Jpeg;
+    }
+    else if ( ( size >= 4 ) && ( memcmp( data, UPLINK_MAGIC, 4 ) == 0 ) )
+    {
+        format = XReplayFormat::Uplink;
+    }
+    else if ( ( size >= 5 ) && ( ( memcmp( data, "--", 2 ) == 0 ) || ( memcmp( data, "HTTP/", 5 ) == 0 ) ) )
+    {
+        format = XReplayFormat::Multipart;
+    }
+    else if ( ( size >= 6 ) && ( data[4] == 0xFF ) && ( data[5] == 0xD8 ) )
+    {
+        // legacy uplink frames start with their size
+        format = XReplayFormat::Uplink;
+    }
+
+    return format;
+}
+
+// Index concatenated JPEG images
+void XReplayVideoSourceData::IndexJpegFrames( const uint8_t* data, size_t size, vector<XRecordedFrame>& frames )
+{
+    size_t offset = 0;
+
+    while ( offset + 2 <= size )
+    {
+        // skip anything between images, like padding
+        if ( ( data[offset] != 0xFF ) || ( data[offset + 1] != 0xD8 ) )
+        {
+            offset++;
+            continue;
+        }
+
+        size_t jpegSize = FindJpegEnd( data + offset, size - offset );
+
+        if ( jpegSize == 0 )
+        {
+            XLOG_WARNING( "Replay - skipping truncated JPEG image at offset %zu", offset );
+            break;
+        }
+
+        frames.push_back( { offset, static_cast<uint32_t>( jpegSize ), 0 } );
+        offset += jpegSize;
+    }
+}
+
+// Index JPEG images of a multipart stream - parts are found by their boundary lines, while images take
+// Content-Length bytes or are scanned till their end if the header is missing
+void XReplayVideoSourceData::IndexMultipartFrames( const uint8_t* data, size_t size, vector<XRecordedFrame>& frames )
+{
+    const uint8_t* end = data + size;
+    const uint8_t* ptr = data;
+
+    // skip HTTP response headers if those were saved as well
+    if ( memcmp( data, "HTTP/", 5 ) == 0 )
+    {
+        static const char headersEnd[] = "\r\n\r\n";
+
+        ptr = static_cast<const uint8_t*>( memmem( data, size, headersEnd, 4 ) );
+        ptr = ( ptr == nullptr ) ? end : ptr + 4;
+    }
+
+    while ( ptr < end )
+    {
+        while ( ( ptr < end ) && ( ( *ptr == '\r' ) || ( *ptr == '\n' ) || ( *ptr == ' ' ) ) )
+        {
+            ptr++;
+        }
+
+        if ( ( end - ptr < 2 ) || ( ptr[0] != '-' ) || ( ptr[1] != '-' ) )
+        {
+            if ( ptr != end )
+            {
+                XLOG_WARNING( "Replay - no part boundary at offset %zu of multipart stream", static_cast<size_t>( ptr - data ) );
+            }
+            break;
+        }
+
+        uint32_t contentLength = 0;
+        uint64_t timestamp     = 0;
+        bool     headersEnded  = false;
+        bool     lastPart      = false;
+
+        // boundary line and the part's headers till an empty line
+        for ( bool boundaryLine = true; ( ptr < end ) && ( !headersEnded ); boundaryLine = false )
+        {
+            const uint8_t* lineEnd = static_cast<const uint8_t*>( memchr( ptr, '\n', end - ptr ) );
+            string         line( reinterpret_cast<const char*>( ptr ), ( ( lineEnd == nullptr ) ? end : lineEnd ) - ptr );
+
+            ptr = ( lineEnd == nullptr ) ? end : lineEnd + 1;
+
+            if ( ( !line.empty( ) ) && ( line.back( ) == '\r' ) )
+            {
+                line.pop_back( );
+            }
+
+            if ( boundaryLine )
+            {
+                lastPart = ( line.size( ) > 4 ) && ( line.compare( line.size( ) - 2, 2, "--" ) == 0 );
+            }
+            else if ( line.empty( ) )
+            {
+                headersEnded = true;
+            }
+            else if ( strncasecmp( line.c_str( ), "Content-Length:", 15 ) == 0 )
+            {
+                contentLength = static_cast<uint32_t>( strtoul( line.c_str( ) + 15, nullptr, 10 ) );
+            }
+            else if ( strncasecmp( line.c_str( ), "X-Timestamp:", 12 ) == 0 )
+            {
+                timestamp = static_cast<uint64_t>( strtod( line.c_str( ) + 12, nullptr ) * 1000000.0 );
+            }
+        }
+
+        if ( lastPart )
+        {
+            break;
+        }
+
+        size_t offset    = ptr - data;
+        size_t frameSize = ( ( contentLength != 0 ) && ( contentLength <= size - offset ) ) ? contentLength :
+                                                                                             FindJpegEnd( ptr, size - offset );
+
+        if ( ( !headersEnded ) || ( frameSize == 0 ) )
+        {
+            XLOG_WARNING( "Replay - skipping truncated part at offset %zu of multipart stream", offset );
+            break;
+        }
+
+        frames.push_back( { offset, static_cast<uint32_t>( frameSize ), timestamp } );
+        ptr += frameSize;
+    }
+}
+
+// Index frames sent by uplink sender - every frame has either legacy or version 1 header
+void XReplayVideoSourceData::IndexUplinkFrames( const uint8_t* data, size_t size, vector<XRecordedFrame>& frames )
+{
+    size_t offset = 0;
+
+    while ( offset + 4 <= size )
+    {
+        uint32_t frameSize;
+        uint64_t timestamp  = 0;
+        uint32_t headerSize = 4;
+
+        if ( memcmp( data + offset, UPLINK_MAGIC, 4 ) == 0 )
+        {
+            // header size comes from the file, so make sure the whole header is there
+            if ( ( size - offset < UPLINK_V1_HEADER_SIZE ) || ( data[offset + 5] < UPLINK_V1_HEADER_SIZE ) ||
+                 ( data[offset + 5] > size - offset ) )
+            {
+                XLOG_WARNING( "Replay - skipping truncated or unknown uplink frame at offset %zu", offset );
+                break;
+            }
+
+            headerSize = data[offset + 5];
+            memcpy( &frameSize, data + offset + 8, 4 );
+            memcpy( &timestamp, data + offset + 20, 8 );
+
+            frameSize = be32toh( frameSize );
+            timestamp = be64toh( timestamp );
+        }
+        else
+        {
+            memcpy( &frameSize, data + offset, 4 );
+        }
+
+        // the header is known to fit, so this can not overflow
+        if ( ( frameSize > size - offset - headerSize ) || ( frameSize < 2 ) ||
+             ( data[offset + headerSize] != 0xFF ) || ( data[offset + headerSize + 1] != 0xD8 ) )
+        {
+            XLOG_WARNING( "Replay - skipping truncated or unknown uplink frame at offset %zu", offset );
+            break;
+        }
+
+        frames.push_back( { offset + headerSize, frameSize, timestamp } );
+        offset += headerSize + frameSize;
+    }
+}
+
+// Find size of the JPEG image starting at the specified pointer - walks its marker segments and scans entropy
+// coded data for the end of image marker. Returns 0 if the image is truncated or malformed.
+size_t XReplayVideoSourceData::FindJpegEnd( const uint8_t* data, size_t size )
+{
+    size_t offset = 2;
+
+    if ( ( size < 4 ) || ( data[0] != 0xFF ) || ( data[1] != 0xD8 ) )
+    {
+        return 0;
+    }
+
+    while ( offset + 2 <= size )
+    {
+        if ( data[offset] != 0xFF )
+        {
+            return 0;
+        }
+
+        uint8_t marker = data[offset + 1];
+
+        if ( marker == 0xD9 )
+        {
+            return offset + 2;
+        }
+        else if ( ( marker == 0xFF ) || ( ( marker >= 0xD0 ) && ( marker <= 0xD7 ) ) || ( marker == 0x01 ) )
+        {
+            // fill byte or marker without segment
+            offset += ( marker == 0xFF ) ? 1 : 2;
+            continue;
+        }
+
+        if ( offset + 4 > size )
+        {
+            return 0;
+        }
+
+        offset += 2 + ( ( static_cast<size_t>( data[offset + 2] ) << 8 ) | data[offset + 3] );
+
+        if ( marker == 0xDA )
+        {
+            // entropy coded data ends with the first marker, which is not a stuffed zero or a restart marker
+            for ( ; ; )
+            {
+                const uint8_t* next = ( offset < size ) ? static_cast<const uint8_t*>( memchr( data + offset, 0xFF, size - offset ) ) : nullptr;
+
+                if ( ( next == nullptr ) || ( next + 1 >= data + size ) )
+                {
+                    return 0;
+                }
+
+                offset = next - data;
+
+                if ( ( next[1] == 0x00 ) || ( ( next[1] >= 0xD0 ) && ( next[1] <= 0xD7 ) ) )
+                {
+                    offset += 2;
+                }
+                else if ( next[1] == 0xFF )
+                {
+                    offset += 1;
+                }
+                else
+                {
+                    break;
+                }
+            }
+        }
+    }
+
+    return 0;
+}
+
+} // namespace Private
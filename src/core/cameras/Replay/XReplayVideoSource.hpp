@@ -0,0 +1,109 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef XREPLAY_VIDEO_SOURCE_HPP
+#define XREPLAY_VIDEO_SOURCE_HPP
+
+#include <memory>
+#include <string>
+
+#include "IVideoSource.hpp"
+#include "XInterfaces.hpp"
+
+namespace Private
+{
+    class XReplayVideoSourceData;
+}
+
+// Formats of recorded streams the replay video source can read
+enum class XReplayFormat
+{
+    Unknown = 0,
+    Jpeg,           // JPEG images concatenated one after another (like ffmpeg's "-f mjpeg" output)
+    Multipart,      // multipart MJPEG stream as sent by web server (like saved with "curl http://host/camera/mjpeg")
+    Uplink          // frames as sent by uplink sender - legacy size prefix or version 1 headers
+};
+
+// Video source replaying a recorded MJPEG stream from a file, so frame sizes and timing of a camera can be reproduced
+// as many times as needed. Format of the recording is detected automatically.
+//
+// The file is memory mapped and its frames are provided as leased JPEG images pointing into the mapping - nothing is
+// copied or decoded while replaying. Provided images are time stamped with the time they were replayed and numbered
+// from 1, so the rest of the pipeline sees them as frames of a live camera.
+//
+// Original timing is taken from capture times of version 1 uplink headers or X-Timestamp headers of multipart
+// recordings (seconds since epoch). Recordings without capture times are replayed at the configured frame rate.
+class XReplayVideoSource : public IVideoSource, private Uncopyable
+{
+protected:
+    XReplayVideoSource( );
+
+public:
+    ~XReplayVideoSource( );
+
+    static const std::shared_ptr<XReplayVideoSource> Create( );
+
+    // Start video source so it initializes and begins providing video frames
+    bool Start( );
+    // Signal source video to stop, so it could finalize and clean-up
+    void SignalToStop( );
+    // Wait till video source (its thread) stops
+    void WaitForStop( );
+    // Check if video source is still running (it stops by itself after the last frame, unless looped)
+    bool IsRunning( );
+
+    // Get number of frames received since the start of the video source
+    uint32_t FramesReceived( );
+    // Get number of frames, which could not be provided in time since the listener took too long with
+    // previous frames (the source does not try catching up on those, but moves its schedule)
+    uint32_t FramesLate( );
+
+    // Get format of the recording and number of frames in it (known after the video source starts)
+    XReplayFormat RecordingFormat( ) const;
+    uint32_t RecordedFrames( ) const;
+
+    // Set video source listener returning the old one
+    IVideoSourceListener* SetListener( IVideoSourceListener* listener );
+
+public: // Set of properties, which can be set only when video source is NOT running.
+        // If it is running, then setting these properties is silently ignored.
+
+    // Get/Set name of the file to replay
+    std::string FileName( ) const;
+    void SetFileName( const std::string& fileName );
+
+    // Get/Set replay speed relative to the original timing: 1 - original timing, 2 - twice faster, etc.
+    // 0 - provide frames as fast as the listener takes them.
+    float Speed( ) const;
+    void SetSpeed( float speed );
+
+    // Get/Set frame rate to replay recordings without capture times at (0 - as fast as possible). Default is 30.
+    uint32_t FrameRate( ) const;
+    void SetFrameRate( uint32_t frameRate );
+
+    // Get/Set if the recording is replayed in a loop
+    bool IsLooped( ) const;
+    void SetLooped( bool looped );
+
+private:
+    Private::XReplayVideoSourceData* mData;
+};
+
+#endif // XREPLAY_VIDEO_SOURCE_HPP
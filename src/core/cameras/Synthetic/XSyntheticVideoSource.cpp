@@ -0,0 +1,651 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include <mutex>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <vector>
+#include <algorithm>
+
+#include "XSyntheticVideoSource.hpp"
+#include "XManualResetEvent.hpp"
+#include "XImagePool.hpp"
+#include "XJpegEncoder.hpp"
+#include "XMetrics.hpp"
+
+using namespace std;
+using namespace std::chrono;
+
+// number of bits encoded by every row of blocks
+#define CODE_BITS (32)
+
+namespace Private
+{
+    typedef vector<vector<uint8_t>> JpegFrameList;
+
+    class XSyntheticVideoSourceData
+    {
+    private:
+        mutable recursive_mutex Sync;
+        thread                  SourceThread;
+        XManualResetEvent       NeedToStop;
+        IVideoSourceListener*   Listener;
+        bool                    Running;
+
+        XMetricCounter*         FramesCapturedMetric;
+
+        // state of the pattern generator
+        vector<uint8_t>         PatternLine;
+        uint64_t                NoiseState;
+
+    public:
+        XImagePool              ImagePool;
+        atomic<uint32_t>        FramesReceived;
+        atomic<uint32_t>        FramesLate;
+        uint32_t                FrameWidth;
+        uint32_t                FrameHeight;
+        uint32_t                FrameRate;
+        XPixelFormat            Format;
+        XSyntheticPattern       Pattern;
+        uint16_t                JpegQuality;
+        uint32_t                JpegLoopLength;
+
+    public:
+        XSyntheticVideoSourceData( ) :
+            Sync( ), SourceThread( ), NeedToStop( ), Listener( nullptr ), Running( false ),
+            PatternLine( ), NoiseState( 0x9E3779B97F4A7C15ull ),
+            ImagePool( ), FramesReceived( 0 ), FramesLate( 0 ), FrameWidth( 640 ), FrameHeight( 480 ), FrameRate( 30 ),
+            Format( XPixelFormat::JPEG ), Pattern( XSyntheticPattern::Gradient ), JpegQuality( 85 ), JpegLoopLength( 30 )
+        {
+            FramesCapturedMetric = &XMetricsRegistry::Instance( ).Counter( "cam2web_frames_captured_total", "Frames received from camera." );
+        }
+
+        bool Start( );
+        void SignalToStop( );
+        void WaitForStop( );
+        bool IsRunning( );
+        IVideoSourceListener* SetListener( IVideoSourceListener* listener );
+
+        void NotifyNewImage( const shared_ptr<const XImage>& image );
+        void NotifyError( const string& errorMessage, bool fatal = false );
+
+        template <typename T> void SetProperty( T& property, T value );
+
+    private:
+        static void SourceThreadHandler( XSyntheticVideoSourceData* me );
+
+        void Run( );
+        bool WaitTill( steady_clock::time_point time );
+        void PreparePattern( XPixelFormat format );
+        void DrawFrame( const shared_ptr<XImage>& image, uint32_t sequence, uint64_t timestamp );
+        void DrawCode( const shared_ptr<XImage>& image, int32_t y, int32_t blockSize, uint32_t code );
+        bool EncodeFrame( XJpegEncoder& encoder, const shared_ptr<const XImage>& image, uint8_t** buffer, uint32_t* bufferSize, uint32_t* jpegSize );
+    };
+}
+
+const shared_ptr<XSyntheticVideoSource> XSyntheticVideoSource::Create( )
+{
+    return shared_ptr<XSyntheticVideoSource>( new XSyntheticVideoSource );
+}
+
+XSyntheticVideoSource::XSyntheticVideoSource( ) :
+    mData( new Private::XSyntheticVideoSourceData( ) )
+{
+}
+
+XSyntheticVideoSource::~XSyntheticVideoSource( )
+{
+    mData->WaitForStop( );
+    delete mData;
+}
+
+// Start video source
+bool XSyntheticVideoSource::Start( )
+{
+    return mData->Start( );
+}
+
+// Signal video source to stop
+void XSyntheticVideoSource::SignalToStop( )
+{
+    mData->SignalToStop( );
+}
+
+// Wait till video source stops
+void XSyntheticVideoSource::WaitForStop( )
+{
+    mData->WaitForStop( );
+}
+
+// Check if video source is running
+bool XSyntheticVideoSource::IsRunning( )
+{
+    return mData->IsRunning( );
+}
+
+// Get number of frames received since the start of the video source
+uint32_t XSyntheticVideoSource::FramesReceived( )
+{
+    return mData->FramesReceived;
+}
+
+// Get number of frames, which could not be provided in time
+uint32_t XSyntheticVideoSource::FramesLate( )
+{
+    return mData->FramesLate;
+}
+
+// Set video source listener
+IVideoSourceListener* XSyntheticVideoSource::SetListener( IVideoSourceListener* listener )
+{
+    return mData->SetListener( listener );
+}
+
+// Get/Set video size
+uint32_t XSyntheticVideoSource::Width( ) const
+{
+    return mData->FrameWidth;
+}
+uint32_t XSyntheticVideoSource::Height( ) const
+{
+    return mData->FrameHeight;
+}
+void XSyntheticVideoSource::SetVideoSize( uint32_t width, uint32_t height )
+{
+    if ( ( width != 0 ) && ( height != 0 ) )
+    {
+        mData->SetProperty( mData->FrameWidth, width );
+        mData->SetProperty( mData->FrameHeight, height );
+    }
+}
+
+// Get/Set frame rate
+uint32_t XSyntheticVideoSource::FrameRate( ) const
+{
+    return mData->FrameRate;
+}
+void XSyntheticVideoSource::SetFrameRate( uint32_t frameRate )
+{
+    mData->SetProperty( mData->FrameRate, frameRate );
+}
+
+// Get/Set format of provided frames
+XPixelFormat XSyntheticVideoSource::PixelFormat( ) const
+{
+    return mData->Format;
+}
+void XSyntheticVideoSource::SetPixelFormat( XPixelFormat format )
+{
+    if ( ( format == XPixelFormat::RGB24 ) || ( format == XPixelFormat::Grayscale8 ) ||
+         ( format == XPixelFormat::YUYV )  || ( format == XPixelFormat::JPEG ) )
+    {
+        mData->SetProperty( mData->Format, format );
+    }
+}
+
+// Get/Set test pattern
+XSyntheticPattern XSyntheticVideoSource::Pattern( ) const
+{
+    return mData->Pattern;
+}
+void XSyntheticVideoSource::SetPattern( XSyntheticPattern pattern )
+{
+    mData->SetProperty( mData->Pattern, pattern );
+}
+
+// Get/Set quality of JPEG frames
+uint16_t XSyntheticVideoSource::JpegQuality( ) const
+{
+    return mData->JpegQuality;
+}
+void XSyntheticVideoSource::SetJpegQuality( uint16_t quality )
+{
+    mData->SetProperty( mData->JpegQuality, static_cast<uint16_t>( ( quality > 100 ) ? 100 : quality ) );
+}
+
+// Get/Set number of JPEG frames encoded on start and provided in a loop
+uint32_t XSyntheticVideoSource::JpegLoopLength( ) const
+{
+    return mData->JpegLoopLength;
+}
+void XSyntheticVideoSource::SetJpegLoopLength( uint32_t length )
+{
+    mData->SetProperty( mData->JpegLoopLength, length );
+}
+
+namespace Private
+{
+
+// Start the video source's thread
+bool XSyntheticVideoSourceData::Start( )
+{
+    lock_guard<recursive_mutex> lock( Sync );
+
+    if ( !IsRunning( ) )
+    {
+        NeedToStop.Reset( );
+        Running        = true;
+        FramesReceived = 0;
+        FramesLate     = 0;
+
+        SourceThread = thread( SourceThreadHandler, this );
+    }
+
+    return true;
+}
+
+// Signal video source to stop
+void XSyntheticVideoSourceData::SignalToStop( )
+{
+    lock_guard<recursive_mutex> lock( Sync );
+
+    if ( IsRunning( ) )
+    {
+        NeedToStop.Signal( );
+    }
+}
+
+// Wait till video source (its thread) stops
+void XSyntheticVideoSourceData::WaitForStop( )
+{
+    SignalToStop( );
+
+    if ( ( IsRunning( ) ) || ( SourceThread.joinable( ) ) )
+    {
+        SourceThread.join( );
+    }
+}
+
+// Check if video source is still running
+bool XSyntheticVideoSourceData::IsRunning( )
+{
+    lock_guard<recursive_mutex> lock( Sync );
+
+    if ( ( !Running ) && ( SourceThread.joinable( ) ) )
+    {
+        SourceThread.join( );
+    }
+
+    return Running;
+}
+
+// Set video source listener
+IVideoSourceListener* XSyntheticVideoSourceData::SetListener( IVideoSourceListener* listener )
+{
+    lock_guard<recursive_mutex> lock( Sync );
+    IVideoSourceListener* oldListener = Listener;
+
+    Listener = listener;
+
+    return oldListener;
+}
+
+// Notify listener with a new image
+void XSyntheticVideoSourceData::NotifyNewImage( const shared_ptr<const XImage>& image )
+{
+    IVideoSourceListener* myListener;
+
+    {
+        lock_guard<recursive_mutex> lock( Sync );
+        myListener = Listener;
+    }
+
+    if ( myListener != nullptr )
+    {
+        myListener->OnNewImage( image );
+    }
+}
+
+// Notify listener about error
+void XSyntheticVideoSourceData::NotifyError( const string& errorMessage, bool fatal )
+{
+    IVideoSourceListener* myListener;
+
+    {
+        lock_guard<recursive_mutex> lock( Sync );
+        myListener = Listener;
+    }
+
+    if ( myListener != nullptr )
+    {
+        myListener->OnError( errorMessage, fatal );
+    }
+}
+
+// Set property of the video source if it is not running
+template <typename T> void XSyntheticVideoSourceData::SetProperty( T& property, T value )
+{
+    lock_guard<recursive_mutex> lock( Sync );
+
+    if ( !IsRunning( ) )
+    {
+        property = value;
+    }
+}
+
+// Background thread generating frames
+void XSyntheticVideoSourceData::SourceThreadHandler( XSyntheticVideoSourceData* me )
+{
+    me->Run( );
+
+    {
+        lock_guard<recursive_mutex> lock( me->Sync );
+        me->Running = false;
+    }
+}
+
+// Generate frames till the video source is asked to stop
+void XSyntheticVideoSourceData::Run( )
+{
+    XPixelFormat              drawFormat   = ( Format == XPixelFormat::JPEG ) ? XPixelFormat::RGB24 : Format;
+    nanoseconds               interval     = ( FrameRate == 0 ) ? nanoseconds( 0 ) : nanoseconds( 1000000000 / FrameRate );
+    shared_ptr<JpegFrameList> loopFrames   = make_shared<JpegFrameList>( );
+    XJpegEncoder              encoder( JpegQuality, true );
+    shared_ptr<XImage>        drawImage;
+    uint8_t*                  jpegBuffer   = nullptr;
+    uint32_t                  jpegCapacity = 0;
+    uint32_t                  jpegSize     = 0;
+    uint32_t                  sequence     = 0;
+    steady_clock::time_point  nextTime;
+
+    PreparePattern( drawFormat );
+
+    if ( Format == XPixelFormat::JPEG )
+    {
+        jpegCapacity = FrameWidth * FrameHeight + 1024;
+        jpegBuffer   = static_cast<uint8_t*>( malloc( jpegCapacity ) );
+        drawImage    = XImage::Allocate( FrameWidth, FrameHeight, drawFormat );
+
+        if ( ( jpegBuffer == nullptr ) || ( !drawImage ) )
+        {
+            NotifyError( "Failed allocating buffers of synthetic video source", true );
+            NeedToStop.Signal( );
+        }
+
+        // encode frames to loop in advance, so providing them costs nothing
+        for ( uint32_t i = 0; ( i < JpegLoopLength ) && ( !NeedToStop.IsSignaled( ) ); i++ )
+        {
+            DrawFrame( drawImage, i + 1, 0 );
+
+            if ( !EncodeFrame( encoder, drawImage, &jpegBuffer, &jpegCapacity, &jpegSize ) )
+            {
+                NeedToStop.Signal( );
+            }
+            else
+            {
+                loopFrames->push_back( vector<uint8_t>( jpegBuffer, jpegBuffer + jpegSize ) );
+            }
+        }
+    }
+
+    nextTime = steady_clock::now( );
+
+    while ( !NeedToStop.IsSignaled( ) )
+    {
+        if ( ( interval.count( ) != 0 ) && ( !WaitTill( nextTime ) ) )
+        {
+            break;
+        }
+
+        uint64_t           timestamp = static_cast<uint64_t>( duration_cast<microseconds>( system_clock::now( ).time_since_epoch( ) ).count( ) );
+        shared_ptr<XImage> image;
+
+        sequence++;
+
+        if ( !loopFrames->empty( ) )
+        {
+            vector<uint8_t>& frame = ( *loopFrames )[( sequence - 1 ) % loopFrames->size( )];
+
+            // looped frames never change, so they are leased to avoid copying them
+            image = XImage::Lease( frame.data( ), static_cast<int32_t>( frame.size( ) ), 1, static_cast<int32_t>( frame.size( ) ),
+                                   XPixelFormat::JPEG, [loopFrames]( ) { } );
+        }
+        else if ( Format == XPixelFormat::JPEG )
+        {
+            DrawFrame( drawImage, sequence, timestamp );
+
+            if ( EncodeFrame( encoder, drawImage, &jpegBuffer, &jpegCapacity, &jpegSize ) )
+            {
+                image = ImagePool.Acquire( static_cast<int32_t>( jpegSize ), 1, XPixelFormat::JPEG );
+
+                if ( image )
+                {
+                    memcpy( image->Data( ), jpegBuffer, jpegSize );
+                }
+            }
+        }
+        else
+        {
+            image = ImagePool.Acquire( FrameWidth, FrameHeight, Format );
+
+            if ( image )
+            {
+                DrawFrame( image, sequence, timestamp );
+            }
+        }
+
+        FramesReceived++;
+        FramesCapturedMetric->Increment( );
+
+        if ( image )
+        {
+            image->SetTimestamp( timestamp );
+            image->SetSequence( sequence );
+            NotifyNewImage( image );
+        }
+        else
+        {
+            NotifyError( "Failed allocating an image" );
+        }
+
+        if ( interval.count( ) != 0 )
+        {
+            steady_clock::time_point now = steady_clock::now( );
+
+            nextTime += interval;
+
+            // don't try catching up if the listener was too slow - it would only make things worse
+            if ( now > nextTime )
+            {
+                FramesLate++;
+                nextTime = now;
+            }
+        }
+    }
+
+    free( jpegBuffer );
+}
+
+// Wait till the specified time - returns false if video source needs to stop
+bool XSyntheticVideoSourceData::WaitTill( steady_clock::time_point time )
+{
+    steady_clock::time_point now = steady_clock::now( );
+
+    // the event can not wait with better than millisecond precision, so sleep the rest
+    if ( time - now > milliseconds( 2 ) )
+    {
+        if ( NeedToStop.Wait( static_cast<uint32_t>( duration_cast<milliseconds>( time - now ).count( ) - 1 ) ) )
+        {
+            return false;
+        }
+    }
+
+    this_thread::sleep_until( time );
+
+    return true;
+}
+
+// Prepare line of the gradient pattern - every row is its part starting at another offset
+void XSyntheticVideoSourceData::PreparePattern( XPixelFormat format )
+{
+    uint32_t pixelCount = FrameWidth + 256;
+
+    if ( format == XPixelFormat::RGB24 )
+    {
+        PatternLine.resize( pixelCount * 3 );
+
+        for ( uint32_t i = 0; i < pixelCount; i++ )
+        {
+            PatternLine[i * 3]     = static_cast<uint8_t>( i );
+            PatternLine[i * 3 + 1] = static_cast<uint8_t>( i + 85 );
+            PatternLine[i * 3 + 2] = static_cast<uint8_t>( 255 - i );
+        }
+    }
+    else if ( format == XPixelFormat::YUYV )
+    {
+        PatternLine.resize( pixelCount * 2 );
+
+        for ( uint32_t i = 0; i < pixelCount; i++ )
+        {
+            PatternLine[i * 2]     = static_cast<uint8_t>( i );
+            PatternLine[i * 2 + 1] = static_cast<uint8_t>( ( i & 1 ) ? 192 - ( i & 127 ) : 64 + ( i & 127 ) );
+        }
+    }
+    else
+    {
+        PatternLine.resize( pixelCount );
+
+        for ( uint32_t i = 0; i < pixelCount; i++ )
+        {
+            PatternLine[i] = static_cast<uint8_t>( i );
+        }
+    }
+}
+
+// Draw frame of the selected pattern with blocks encoding its sequence number and time
+void XSyntheticVideoSourceData::DrawFrame( const shared_ptr<XImage>& image, uint32_t sequence, uint64_t timestamp )
+{
+    int32_t  width         = image->Width( );
+    int32_t  height        = image->Height( );
+    int32_t  stride        = image->Stride( );
+    uint32_t bytesPerPixel = XImageBitsPerPixel( image->Format( ) ) / 8;
+    uint32_t lineSize      = width * bytesPerPixel;
+    uint8_t* data          = image->Data( );
+    int32_t  blockSize     = max( width / CODE_BITS, 1 );
+
+    if ( Pattern == XSyntheticPattern::Noise )
+    {
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            uint8_t* row = data + y * stride;
+
+            // xorshift generator is much faster than anything from standard library
+            for ( uint32_t x = 0; x < lineSize; x += 8 )
+            {
+                NoiseState ^= NoiseState >> 12;
+                NoiseState ^= NoiseState << 25;
+                NoiseState ^= NoiseState >> 27;
+
+                uint64_t value = NoiseState * 0x2545F4914F6CDD1Dull;
+
+                memcpy( row + x, &value, min( 8u, lineSize - x ) );
+            }
+        }
+    }
+    else
+    {
+        for ( int32_t y = 0; y < height; y++ )
+        {
+            uint32_t offset = ( y + sequence ) & 0xFF;
+
+            // pairs of YUYV pixels share chroma, so the line can only move by two pixels
+            if ( image->Format( ) == XPixelFormat::YUYV )
+            {
+                offset &= ~1u;
+            }
+
+            memcpy( data + y * stride, PatternLine.data( ) + offset * bytesPerPixel, lineSize );
+        }
+    }
+
+    if ( height >= 2 )
+    {
+        blockSize = min( blockSize, height / 2 );
+
+        DrawCode( image, 0, blockSize, sequence );
+        DrawCode( image, blockSize, blockSize, static_cast<uint32_t>( timestamp / 1000 ) );
+    }
+}
+
+// Draw row of blocks encoding the specified number in binary
+void XSyntheticVideoSourceData::DrawCode( const shared_ptr<XImage>& image, int32_t y, int32_t blockSize, uint32_t code )
+{
+    XPixelFormat format        = image->Format( );
+    uint32_t     bytesPerPixel = XImageBitsPerPixel( format ) / 8;
+    int32_t      width         = image->Width( );
+
+    for ( int32_t bit = 0; ( bit < CODE_BITS ) && ( bit * blockSize < width ); bit++ )
+    {
+        uint8_t value  = ( ( code >> ( CODE_BITS - 1 - bit ) ) & 1 ) ? 255 : 0;
+        int32_t xStart = bit * blockSize;
+        int32_t xEnd   = min( xStart + blockSize, width );
+
+        for ( int32_t by = y; by < y + blockSize; by++ )
+        {
+            uint8_t* ptr = image->Data( ) + by * image->Stride( ) + xStart * bytesPerPixel;
+
+            if ( format == XPixelFormat::YUYV )
+            {
+                // luma of the block and neutral chroma
+                for ( int32_t x = xStart; x < xEnd; x++, ptr += 2 )
+                {
+                    ptr[0] = value;
+                    ptr[1] = 128;
+                }
+            }
+            else
+            {
+                memset( ptr, value, ( xEnd - xStart ) * bytesPerPixel );
+            }
+        }
+    }
+}
+
+// Encode the frame as JPEG into the work buffer (which may get reallocated by the encoder)
+bool XSyntheticVideoSourceData::EncodeFrame( XJpegEncoder& encoder, const shared_ptr<const XImage>& image,
+                                             uint8_t** buffer, uint32_t* bufferSize, uint32_t* jpegSize )
+{
+    uint8_t* oldBuffer = *buffer;
+    uint32_t size      = *bufferSize;
+    XError   error     = encoder.EncodeToMemory( image, buffer, &size );
+
+    // encoder allocates new buffer if the provided one is too small
+    if ( *buffer != oldBuffer )
+    {
+        free( oldBuffer );
+    }
+
+    if ( error != XError::Success )
+    {
+        NotifyError( string( "Failed encoding synthetic frame: " ) + error.ToString( ), true );
+        return false;
+    }
+
+    // size of the new buffer is not known, but it fits the encoded image at least
+    *bufferSize = ( *buffer != oldBuffer ) ? size : *bufferSize;
+    *jpegSize   = size;
+
+    return true;
+}
+
+} // namespace Private
@@ -0,0 +1,106 @@
+/*
+    cam2web - streaming camera to web
+
+    Copyright (C) 2017, cvsandbox, cvsandbox@gmail.com
+
+    This program is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 2 of the License, or
+    (at your option) any later version.
+
+    This program is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License along
+    with this program; if not, write to the Free Software Foundation, Inc.,
+    51 Franklin Street, Fifth Floor, Boston, MA 02110-1301 USA
+*/
+
+#ifndef XSYNTHETIC_VIDEO_SOURCE_HPP
+#define XSYNTHETIC_VIDEO_SOURCE_HPP
+
+#include <memory>
+
+#include "IVideoSource.hpp"
+#include "XInterfaces.hpp"
+#include "XImage.hpp"
+
+namespace Private
+{
+    class XSyntheticVideoSourceData;
+}
+
+// Test patterns provided by synthetic video source
+enum class XSyntheticPattern
+{
+    Gradient = 0,   // diagonal gradient moving by one pixel every frame
+    Noise           // new random noise every frame - the hardest to compress
+};
+
+// Video source generating test patterns, which does not need any camera - for load tests and benchmarks.
+// Every frame has two rows of blocks at its top, which encode frame's sequence number and capture time
+// (milliseconds, lower 32 bits) in binary - most significant bit first, white block for 1 and black for 0.
+class XSyntheticVideoSource : public IVideoSource, private Uncopyable
+{
+protected:
+    XSyntheticVideoSource( );
+
+public:
+    ~XSyntheticVideoSource( );
+
+    static const std::shared_ptr<XSyntheticVideoSource> Create( );
+
+    // Start video source so it initializes and begins providing video frames
+    bool Start( );
+    // Signal source video to stop, so it could finalize and clean-up
+    void SignalToStop( );
+    // Wait till video source (its thread) stops
+    void WaitForStop( );
+    // Check if video source is still running
+    bool IsRunning( );
+
+    // Get number of frames received since the start of the video source
+    uint32_t FramesReceived( );
+    // Get number of frames, which could not be provided in time since the listener took too long with
+    // previous frames (the source does not try catching up on those, but moves its schedule)
+    uint32_t FramesLate( );
+
+    // Set video source listener returning the old one
+    IVideoSourceListener* SetListener( IVideoSourceListener* listener );
+
+public: // Set of properties, which can be set only when video source is NOT running.
+        // If it is running, then setting these properties is silently ignored.
+
+    // Get/Set video size
+    uint32_t Width( ) const;
+    uint32_t Height( ) const;
+    void SetVideoSize( uint32_t width, uint32_t height );
+
+    // Get/Set frame rate (0 - provide frames as fast as the listener takes them)
+    uint32_t FrameRate( ) const;
+    void SetFrameRate( uint32_t frameRate );
+
+    // Get/Set format of provided frames: RGB24, Grayscale8, YUYV or JPEG. Other formats are ignored.
+    XPixelFormat PixelFormat( ) const;
+    void SetPixelFormat( XPixelFormat format );
+
+    // Get/Set test pattern
+    XSyntheticPattern Pattern( ) const;
+    void SetPattern( XSyntheticPattern pattern );
+
+    // Get/Set quality of JPEG frames
+    uint16_t JpegQuality( ) const;
+    void SetJpegQuality( uint16_t quality );
+
+    // Get/Set number of JPEG frames encoded on start and then provided in a loop, so encoding does not limit
+    // frame rate (blocks of looped frames repeat as well). 0 - encode every frame. Default is 30.
+    uint32_t JpegLoopLength( ) const;
+    void SetJpegLoopLength( uint32_t length );
+
+private:
+    Private::XSyntheticVideoSourceData* mData;
+};
+
+#endif // XSYNTHETIC_VIDEO_SOURCE_HPP
@@ -19,7 +19,9 @@
 */
 
 #include <map>
+#include <vector>
 #include <mutex>
+#include <atomic>
 #include <thread>
 #include <chrono>
 #include <stdio.h>
@@ -28,19 +30,60 @@
 #include <string.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <time.h>
 #include <sys/ioctl.h>
 #include <sys/mman.h>
 #include <linux/videodev2.h>
 
 #include "XV4LCamera.hpp"
 #include "XManualResetEvent.hpp"
+#include "XImagePool.hpp"
+#include "XYuyvToRgb.hpp"
+#include "XMetrics.hpp"
 
 using namespace std;
 using namespace std::chrono;
 
 namespace Private
 {
-    #define BUFFER_COUNT        (4)
+    #define DEFAULT_BUFFER_COUNT    (4)
+    #define MIN_BUFFER_COUNT        (2)
+    #define MAX_BUFFER_COUNT        (32)
+    // number of buffers, which must stay with the driver (not leased), so it does not starve
+    #define MIN_QUEUED_BUFFERS      (2)
+
+    // Set of memory mapped capture buffers. It is shared with all leased images, so buffers
+    // stay mapped till the last lease is released, even if the camera is stopped by then.
+    class XV4LBufferSet
+    {
+    private:
+        mutex            Sync;
+        int              VideoFd;
+        bool             Active;
+        vector<uint8_t*> Buffers;
+        vector<uint32_t> Lengths;
+
+    public:
+        atomic<uint32_t> Leased;
+        atomic<uint32_t> RequeueFailures;
+
+    public:
+        XV4LBufferSet( int videoFd ) :
+            Sync( ), VideoFd( videoFd ), Active( true ), Buffers( ), Lengths( ), Leased( 0 ), RequeueFailures( 0 )
+        {
+        }
+        ~XV4LBufferSet( );
+
+        bool Map( uint32_t count );
+        bool Enqueue( uint32_t index );
+        void Deactivate( );
+
+        uint32_t Count( ) const { return static_cast<uint32_t>( Buffers.size( ) ); }
+        uint8_t* Buffer( uint32_t index ) const { return Buffers[index]; }
+
+        shared_ptr<XImage> Lease( const shared_ptr<XV4LBufferSet>& self, uint32_t index,
+                                  int32_t width, int32_t height, int32_t stride, XPixelFormat format );
+    };
 
     // Private details of the implementation
     class XV4LCameraData
@@ -55,26 +98,44 @@ namespace Private
 
         int                     VideoFd;
         bool                    VideoStreamingActive;
-        uint8_t*                MappedBuffers[BUFFER_COUNT];
-        uint32_t                MappedBufferLength[BUFFER_COUNT];
+        shared_ptr<XV4LBufferSet> CaptureBuffers;
 
         map<XVideoProperty, int32_t> PropertiesToSet;
 
+        XMetricCounter*         FramesCapturedMetric;
+        XMetricCounter*         FramesDroppedMetric;
+        XMetricCounter*         RequeueFailuresMetric;
+        XMetricHistogram*       CaptureTimeMetric;
+
     public:
+        XImagePool              ImagePool;
         uint32_t                VideoDevice;
         uint32_t                FramesReceived;
         uint32_t                FrameWidth;
         uint32_t                FrameHeight;
+        uint32_t                FrameStride;
         uint32_t                FrameRate;
         bool                    JpegEncoding;
+        bool                    YuyvDecoding;
+        uint32_t                BufferCount;
+        bool                    BufferLeasing;
 
     public:
         XV4LCameraData( ) :
             Sync( ), ConfigSync( ), ControlThread( ), NeedToStop( ), Listener( nullptr ), Running( false ),
-            VideoFd( -1 ), VideoStreamingActive( false ), MappedBuffers( ), MappedBufferLength( ), PropertiesToSet( ),
-            VideoDevice( 0 ),
-            FramesReceived( 0 ), FrameWidth( 640 ), FrameHeight( 480 ), FrameRate( 20 ), JpegEncoding( true )
+            VideoFd( -1 ), VideoStreamingActive( false ), CaptureBuffers( ), PropertiesToSet( ),
+            ImagePool( ), VideoDevice( 0 ),
+            FramesReceived( 0 ), FrameWidth( 640 ), FrameHeight( 480 ), FrameStride( 0 ), FrameRate( 20 ),
+            JpegEncoding( true ), YuyvDecoding( false ),
+            BufferCount( DEFAULT_BUFFER_COUNT ), BufferLeasing( true )
         {
+            XMetricsRegistry& metrics = XMetricsRegistry::Instance( );
+
+            FramesCapturedMetric  = &metrics.Counter( "cam2web_frames_captured_total", "Frames received from camera." );
+            FramesDroppedMetric   = &metrics.Counter( "cam2web_frames_dropped_total", "Frames lost before getting to clients - skipped by camera driver or failed to get an image for." );
+            RequeueFailuresMetric = &metrics.Counter( "cam2web_capture_requeue_failures_total", "Capture buffers, which failed to get back into camera's queue." );
+            CaptureTimeMetric     = &metrics.Histogram( "cam2web_capture_seconds", "Time to handle a captured frame - from getting it from camera to giving its buffer back.",
+                                                        XMetricsRegistry::TimeBuckets( ), 1e-6 );
         }
 
         bool Start( );
@@ -92,6 +153,9 @@ namespace Private
         void SetVideoSize( uint32_t width, uint32_t height );
         void SetFrameRate( uint32_t frameRate );
         void EnableJpegEncoding( bool enable );
+        void EnableYuyvDecoding( bool enable );
+        void SetBufferCount( uint32_t count );
+        void EnableBufferLeasing( bool enable );
 
         XError SetVideoProperty( XVideoProperty property, int32_t value );
         XError GetVideoProperty( XVideoProperty property, int32_t* value ) const;
@@ -150,6 +214,12 @@ uint32_t XV4LCamera::FramesReceived( )
     return mData->FramesReceived;
 }
 
+// Get pool of images used for decoded video frames
+const XImagePool& XV4LCamera::ImagePool( ) const
+{
+    return mData->ImagePool;
+}
+
 // Set video source listener
 IVideoSourceListener* XV4LCamera::SetListener( IVideoSourceListener* listener )
 {
@@ -200,6 +270,36 @@ void XV4LCamera::EnableJpegEncoding( bool enable )
     mData->EnableJpegEncoding( enable );
 }
 
+// Enable/Disable decoding of YUYV frames into RGB
+bool XV4LCamera::IsYuyvDecodingEnabled( ) const
+{
+    return mData->YuyvDecoding;
+}
+void XV4LCamera::EnableYuyvDecoding( bool enable )
+{
+    mData->EnableYuyvDecoding( enable );
+}
+
+// Get/Set number of capture buffers
+uint32_t XV4LCamera::BufferCount( ) const
+{
+    return mData->BufferCount;
+}
+void XV4LCamera::SetBufferCount( uint32_t count )
+{
+    mData->SetBufferCount( count );
+}
+
+// Enable/Disable leasing of capture buffers
+bool XV4LCamera::IsBufferLeasingEnabled( ) const
+{
+    return mData->BufferLeasing;
+}
+void XV4LCamera::EnableBufferLeasing( bool enable )
+{
+    mData->EnableBufferLeasing( enable );
+}
+
 // Set the specified video property
 XError XV4LCamera::SetVideoProperty( XVideoProperty property, int32_t value )
 {
@@ -385,6 +485,7 @@ bool XV4LCameraData::Init( )
             // update width/height in case camera does not support what was requested
             FrameWidth  = videoFormat.fmt.pix.width;
             FrameHeight = videoFormat.fmt.pix.height;
+            FrameStride = ( videoFormat.fmt.pix.bytesperline != 0 ) ? videoFormat.fmt.pix.bytesperline : FrameWidth * 2;
         }
     }
 
@@ -393,7 +494,7 @@ bool XV4LCameraData::Init( )
     {
         v4l2_requestbuffers requestBuffers = { 0 };
 
-        requestBuffers.count  = BUFFER_COUNT;
+        requestBuffers.count  = BufferCount;
         requestBuffers.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
         requestBuffers.memory = V4L2_MEMORY_MMAP;
 
@@ -403,7 +504,7 @@ bool XV4LCameraData::Init( )
             NotifyError( "Unable to allocate capture buffers", true );
             ret = false;
         }
-        else if ( requestBuffers.count < BUFFER_COUNT )
+        else if ( requestBuffers.count < BufferCount )
         {
             NotifyError( "Not enough memory to allocate capture buffers", true );
             ret = false;
@@ -413,55 +514,25 @@ bool XV4LCameraData::Init( )
     // map capture buffers
     if ( ret )
     {
-        v4l2_buffer videoBuffer;
+        CaptureBuffers = make_shared<XV4LBufferSet>( VideoFd );
 
-        for ( int i = 0; i < BUFFER_COUNT; i++ )
+        if ( !CaptureBuffers->Map( BufferCount ) )
         {
-            memset( &videoBuffer, 0, sizeof( videoBuffer ) );
-
-            videoBuffer.index  = i;
-            videoBuffer.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-            videoBuffer.memory = V4L2_MEMORY_MMAP;
-
-            ecode = ioctl( VideoFd, VIDIOC_QUERYBUF, &videoBuffer );
-            if ( ecode < 0 )
-            {
-                NotifyError( "Unable to query capture buffer", true );
-                ret = false;
-                break;
-            }
-
-            MappedBuffers[i]      = (uint8_t*) mmap( 0, videoBuffer.length, PROT_READ, MAP_SHARED, VideoFd, videoBuffer.m.offset );
-            MappedBufferLength[i] = videoBuffer.length;
-
-            if ( MappedBuffers[i] == nullptr )
-            {
-                NotifyError( "Unable to map capture buffer", true );
-                ret = false;
-                break;
-            }
+            NotifyError( "Unable to map capture buffers", true );
+            ret = false;
         }
     }
 
     // enqueue capture buffers
     if ( ret )
     {
-        v4l2_buffer videoBuffer;
-
-        for ( int i = 0; i < BUFFER_COUNT; i++ )
+        for ( uint32_t i = 0; i < BufferCount; i++ )
         {
-            memset( &videoBuffer, 0, sizeof( videoBuffer ) );
-        
-            videoBuffer.index  = i;
-            videoBuffer.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
-            videoBuffer.memory = V4L2_MEMORY_MMAP;
-        
-            ecode = ioctl( VideoFd, VIDIOC_QBUF, &videoBuffer );
-        
-            if ( ecode < 0 )
+            if ( !CaptureBuffers->Enqueue( i ) )
             {
                 NotifyError( "Unable to enqueue capture buffer", true );
                 ret = false;
+                break;
             }
         }
     }
@@ -517,15 +588,12 @@ void XV4LCameraData::Cleanup( )
         VideoStreamingActive = false;
     }
 
-    // unmap capture buffers
-    for ( int i = 0; i < BUFFER_COUNT; i++ )
+    // capture buffers get unmapped once all leased images are released - just make sure
+    // nobody tries queuing them back after the device is closed
+    if ( CaptureBuffers )
     {
-        if ( MappedBuffers[i] != nullptr )
-        {
-            munmap( MappedBuffers[i], MappedBufferLength[i] );
-            MappedBuffers[i]      = nullptr;
-            MappedBufferLength[i] = 0;
-        }
+        CaptureBuffers->Deactivate( );
+        CaptureBuffers.reset( );
     }
 
     // close the video device
@@ -536,83 +604,48 @@ void XV4LCameraData::Cleanup( )
     }
 }
 
-// Helper function to decode YUYV data into RGB
-static void DecodeYuyvToRgb( const uint8_t* yuyvPtr, uint8_t* rgbPtr, int32_t width, int32_t height, int32_t rgbStride )
+// Convert timestamp of a captured buffer into microseconds since epoch. Most drivers stamp
+// buffers with monotonic clock, so the age of the buffer is added to current real time.
+static uint64_t BufferTimestampToEpoch( const v4l2_buffer& buffer )
 {
-    /* 
-        The code below does YUYV to RGB conversion using the next coefficients.
-        However those are multiplied by 256 to get integer calculations.
-     
-        r = y + (1.4065 * (cr - 128));
-        g = y - (0.3455 * (cb - 128)) - (0.7169 * (cr - 128));
-        b = y + (1.7790 * (cb - 128));
-    */
+    uint64_t bufferTime = static_cast<uint64_t>( buffer.timestamp.tv_sec ) * 1000000 + buffer.timestamp.tv_usec;
+    uint64_t realNow    = static_cast<uint64_t>( duration_cast<microseconds>( system_clock::now( ).time_since_epoch( ) ).count( ) );
 
-    int r, g, b;
-    int y, u, v;
-    int z = 0;
-
-    for ( int32_t iy = 0; iy < height; iy++ )
+    if ( ( bufferTime != 0 ) &&
+         ( ( buffer.flags & V4L2_BUF_FLAG_TIMESTAMP_MASK ) == V4L2_BUF_FLAG_TIMESTAMP_MONOTONIC ) )
     {
-        uint8_t* rgbRow = rgbPtr + iy * rgbStride;
-
-        for ( int32_t ix = 0; ix < width; ix++ )
-        {
-            y = ( ( z == 0 ) ? yuyvPtr[0] : yuyvPtr[2] ) << 8;
-            u = yuyvPtr[1] - 128;
-            v = yuyvPtr[3] - 128;
-
-            r = ( y + ( 360 * v ) ) >> 8;
-            g = ( y - ( 88  * u ) - ( 184 * v ) ) >> 8;
-            b = ( y + ( 455 * u ) ) >> 8;
-
-            rgbRow[RedIndex]   = (uint8_t) ( r > 255 ) ? 255 : ( ( r < 0 ) ? 0 : r );
-            rgbRow[GreenIndex] = (uint8_t) ( g > 255 ) ? 255 : ( ( g < 0 ) ? 0 : g );
-            rgbRow[BlueIndex]  = (uint8_t) ( b > 255 ) ? 255 : ( ( b < 0 ) ? 0 : b );
+        struct timespec monotonicNow;
+        uint64_t        monotonicTime;
 
-            if ( z++ )
-            {
-                z = 0;
-                yuyvPtr += 4;
-            }
+        clock_gettime( CLOCK_MONOTONIC, &monotonicNow );
+        monotonicTime = static_cast<uint64_t>( monotonicNow.tv_sec ) * 1000000 + monotonicNow.tv_nsec / 1000;
 
-            rgbRow += 3;
+        if ( monotonicTime >= bufferTime )
+        {
+            return realNow - ( monotonicTime - bufferTime );
         }
     }
+
+    return realNow;
 }
 
 // Do video capture in an end-less loop until signalled to stop
 void XV4LCameraData::VideoCaptureLoop( )
 {
     v4l2_buffer videoBuffer;
-    uint32_t    sleepTime = 0;
-    uint32_t    frameTime = 1000 / FrameRate;
-    uint32_t    handlingTime ;
-    uint32_t    handlingTime1 ;
-    uint32_t    handlingTime2 ;
-    uint32_t    handlingTime3 ;
     int         ecode;
+    uint32_t    requeueFailures = 0;
+    uint32_t    lastSequence    = 0;
+    bool        gotFrames       = false;
 
-    // If JPEG encoding is used, client is notified with an image wrapping a mapped buffer.
-    // If not used howver, we decode YUYV data into RGB.
-    shared_ptr<XImage> rgbImage;
-    
-    if ( !JpegEncoding )
-    {
-        rgbImage = XImage::Allocate( FrameWidth, FrameHeight, XPixelFormat::RGB24 );
-
-        if ( !rgbImage )
-        {
-            NotifyError( "Failed allocating an image", true );
-            return;
-        }
-    }
+    // Client is notified with an image leasing a mapped buffer - JPEG or YUYV (or its copy if too
+    // many buffers are leased already). If YUYV decoding is enabled however, we decode YUYV data
+    // into RGB image taken from the pool - every frame gets its own image, which goes back to
+    // the pool once all clients release it.
 
     // acquire images untill we've been told to stop
-    while ( !NeedToStop.Wait( sleepTime ) )
+    while ( !NeedToStop.Wait( 0 ) )
     {
-        // steady_clock::time_point startTime = steady_clock::now( );
-
         // dequeue buffer
         memset( &videoBuffer, 0, sizeof( videoBuffer ) );
 
@@ -620,7 +653,10 @@ void XV4LCameraData::VideoCaptureLoop( )
         videoBuffer.memory = V4L2_MEMORY_MMAP;
 
         ecode = ioctl( VideoFd, VIDIOC_DQBUF, &videoBuffer );
-        // handlingTime1 = static_cast<uint32_t>( duration_cast<milliseconds>( steady_clock::now( ) - startTime ).count( ) );
+
+        // dequeuing waits for the frame, so handling time starts after it
+        steady_clock::time_point startTime = steady_clock::now( );
+
         if ( ecode < 0 )
         {
             NotifyError( "Failed to dequeue capture buffer" );
@@ -628,40 +664,200 @@ void XV4LCameraData::VideoCaptureLoop( )
         else
         {
             shared_ptr<XImage> image;
+            bool               leased = false;
+            uint8_t*           buffer = CaptureBuffers->Buffer( videoBuffer.index );
+
             FramesReceived++;
-            if ( JpegEncoding )
+            FramesCapturedMetric->Increment( );
+
+            // driver numbers frames it captured, so a gap means it had no free buffer for some
+            if ( ( gotFrames ) && ( videoBuffer.sequence > lastSequence + 1 ) )
             {
-                image = XImage::Create( MappedBuffers[videoBuffer.index], videoBuffer.bytesused, 1, videoBuffer.bytesused, XPixelFormat::JPEG );
-                // handlingTime2 = static_cast<uint32_t>( duration_cast<milliseconds>( steady_clock::now( ) - startTime ).count( ) );
+                FramesDroppedMetric->Increment( videoBuffer.sequence - lastSequence - 1 );
+            }
+            lastSequence = videoBuffer.sequence;
+            gotFrames    = true;
+
+            if ( ( !JpegEncoding ) && ( YuyvDecoding ) )
+            {
+                image = ImagePool.Acquire( FrameWidth, FrameHeight, XPixelFormat::RGB24 );
+
+                if ( image )
+                {
+                    XYuyvToRgb::Convert( buffer, FrameStride, image->Data( ), image->Stride( ), FrameWidth, FrameHeight );
+                }
             }
             else
             {
-                DecodeYuyvToRgb( MappedBuffers[videoBuffer.index], rgbImage->Data( ), FrameWidth, FrameHeight, rgbImage->Stride( ) );
-                image = rgbImage;
+                if ( ( BufferLeasing ) && ( CaptureBuffers->Leased + MIN_QUEUED_BUFFERS < CaptureBuffers->Count( ) ) )
+                {
+                    if ( JpegEncoding )
+                    {
+                        image = CaptureBuffers->Lease( CaptureBuffers, videoBuffer.index, videoBuffer.bytesused, 1,
+                                                       videoBuffer.bytesused, XPixelFormat::JPEG );
+                    }
+                    else
+                    {
+                        image = CaptureBuffers->Lease( CaptureBuffers, videoBuffer.index, FrameWidth, FrameHeight,
+                                                       FrameStride, XPixelFormat::YUYV );
+                    }
+                    leased = static_cast<bool>( image );
+                }
+
+                if ( !leased )
+                {
+                    if ( JpegEncoding )
+                    {
+                        image = ImagePool.Acquire( videoBuffer.bytesused, 1, XPixelFormat::JPEG );
+
+                        if ( image )
+                        {
+                            memcpy( image->Data( ), buffer, videoBuffer.bytesused );
+                        }
+                    }
+                    else
+                    {
+                        image = ImagePool.Acquire( FrameWidth, FrameHeight, XPixelFormat::YUYV );
+
+                        if ( image )
+                        {
+                            for ( uint32_t y = 0; y < FrameHeight; y++ )
+                            {
+                                memcpy( image->Data( ) + y * image->Stride( ), buffer + y * FrameStride, FrameWidth * 2 );
+                            }
+                        }
+                    }
+                }
             }
 
             if ( image )
             {
+                image->SetTimestamp( BufferTimestampToEpoch( videoBuffer ) );
+                image->SetSequence( videoBuffer.sequence );
                 NotifyNewImage( image );
-                // handlingTime3 = static_cast<uint32_t>( duration_cast<milliseconds>( steady_clock::now( ) - startTime ).count( ) );
             }
             else
             {
+                FramesDroppedMetric->Increment( );
                 NotifyError( "Failed allocating an image" );
             }
 
-            // put the buffer back into the queue
-            ecode = ioctl( VideoFd, VIDIOC_QBUF, &videoBuffer );
-            if ( ecode < 0 )
+            // put the buffer back into the queue (leased buffer is queued when the last client releases it)
+            image.reset( );
+
+            if ( ( !leased ) && ( !CaptureBuffers->Enqueue( videoBuffer.index ) ) )
             {
+                RequeueFailuresMetric->Increment( );
                 NotifyError( "Failed to requeue capture buffer" );
             }
+
+            CaptureTimeMetric->Observe( static_cast<uint64_t>( duration_cast<microseconds>( steady_clock::now( ) - startTime ).count( ) ) );
+        }
+
+        // report buffers, which failed to get back into the queue after their lease
+        if ( CaptureBuffers->RequeueFailures != requeueFailures )
+        {
+            RequeueFailuresMetric->Increment( CaptureBuffers->RequeueFailures - requeueFailures );
+            requeueFailures = CaptureBuffers->RequeueFailures;
+            NotifyError( "Failed to requeue leased capture buffer" );
         }
+    }
+}
+
+// Unmap all capture buffers
+XV4LBufferSet::~XV4LBufferSet( )
+{
+    for ( size_t i = 0; i < Buffers.size( ); i++ )
+    {
+        munmap( Buffers[i], Lengths[i] );
+    }
+}
+
+// Query and map the specified number of capture buffers
+bool XV4LBufferSet::Map( uint32_t count )
+{
+    v4l2_buffer videoBuffer;
+
+    for ( uint32_t i = 0; i < count; i++ )
+    {
+        memset( &videoBuffer, 0, sizeof( videoBuffer ) );
+
+        videoBuffer.index  = i;
+        videoBuffer.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        videoBuffer.memory = V4L2_MEMORY_MMAP;
+
+        if ( ioctl( VideoFd, VIDIOC_QUERYBUF, &videoBuffer ) < 0 )
+        {
+            return false;
+        }
+
+        void* mappedBuffer = mmap( 0, videoBuffer.length, PROT_READ, MAP_SHARED, VideoFd, videoBuffer.m.offset );
+
+        if ( mappedBuffer == MAP_FAILED )
+        {
+            return false;
+        }
+
+        Buffers.push_back( static_cast<uint8_t*>( mappedBuffer ) );
+        Lengths.push_back( videoBuffer.length );
+    }
+
+    return true;
+}
+
+// Put the specified buffer into driver's queue
+bool XV4LBufferSet::Enqueue( uint32_t index )
+{
+    lock_guard<mutex> lock( Sync );
+    v4l2_buffer       videoBuffer;
+    bool              ret = true;
+
+    // no need to queue anything for a stopped device
+    if ( Active )
+    {
+        memset( &videoBuffer, 0, sizeof( videoBuffer ) );
+
+        videoBuffer.index  = index;
+        videoBuffer.type   = V4L2_BUF_TYPE_VIDEO_CAPTURE;
+        videoBuffer.memory = V4L2_MEMORY_MMAP;
+
+        ret = ( ioctl( VideoFd, VIDIOC_QBUF, &videoBuffer ) == 0 );
+    }
+
+    return ret;
+}
+
+// Stop queuing buffers - the device is about to be closed
+void XV4LBufferSet::Deactivate( )
+{
+    lock_guard<mutex> lock( Sync );
+    Active = false;
+}
+
+// Provide image leasing the specified buffer, which is queued back once the image is released
+shared_ptr<XImage> XV4LBufferSet::Lease( const shared_ptr<XV4LBufferSet>& self, uint32_t index,
+                                         int32_t width, int32_t height, int32_t stride, XPixelFormat format )
+{
+    shared_ptr<XImage> image;
+
+    Leased++;
+
+    image = XImage::Lease( Buffers[index], width, height, stride, format, [self, index]( )
+    {
+        self->Leased--;
 
-        // handlingTime = static_cast<uint32_t>( duration_cast<milliseconds>( steady_clock::now( ) - startTime ).count( ) );
-        sleepTime    = 0; // ( handlingTime > frameTime ) ? 0 : ( frameTime - handlingTime );
-        // cout << "Handling Times > [" << handlingTime1 << "][" << handlingTime2 << "][" << handlingTime3 << "][" << handlingTime << "]\n";
+        if ( !self->Enqueue( index ) )
+        {
+            self->RequeueFailures++;
+        }
+    } );
+
+    if ( !image )
+    {
+        Leased--;
     }
+
+    return image;
 }
 
 // Background control thread - performs camera init/clean-up and runs video loop
@@ -714,6 +910,28 @@ void XV4LCameraData::SetFrameRate( uint32_t frameRate )
     }
 }
 
+// Set number of capture buffers to request
+void XV4LCameraData::SetBufferCount( uint32_t count )
+{
+    lock_guard<recursive_mutex> lock( Sync );
+
+    if ( !IsRunning( ) )
+    {
+        BufferCount = ( count < MIN_BUFFER_COUNT ) ? MIN_BUFFER_COUNT : ( ( count > MAX_BUFFER_COUNT ) ? MAX_BUFFER_COUNT : count );
+    }
+}
+
+// Enable/disable leasing of capture buffers
+void XV4LCameraData::EnableBufferLeasing( bool enable )
+{
+    lock_guard<recursive_mutex> lock( Sync );
+
+    if ( !IsRunning( ) )
+    {
+        BufferLeasing = enable;
+    }
+}
+
 // Enable/disable JPEG encoding
 void XV4LCameraData::EnableJpegEncoding( bool enable )
 {
@@ -725,6 +943,17 @@ void XV4LCameraData::EnableJpegEncoding( bool enable )
     }
 }
 
+// Enable/Disable decoding of YUYV frames into RGB
+void XV4LCameraData::EnableYuyvDecoding( bool enable )
+{
+    lock_guard<recursive_mutex> lock( Sync );
+
+    if ( !IsRunning( ) )
+    {
+        YuyvDecoding = enable;
+    }
+}
+
 static const uint32_t nativeVideoProperties[] =
 {
     V4L2_CID_BRIGHTNESS,
@@ -25,6 +25,7 @@
 
 #include "IVideoSource.hpp"
 #include "XInterfaces.hpp"
+#include "XImagePool.hpp"
 
 namespace Private
 {
@@ -70,6 +71,9 @@ public:
     // Get number of frames received since the start of the video source
     uint32_t FramesReceived( );
 
+    // Get pool of images used for decoded video frames (to check its hit/miss statistics)
+    const XImagePool& ImagePool( ) const;
+
     // Set video source listener returning the old one
     IVideoSourceListener* SetListener( IVideoSourceListener* listener );
 
@@ -93,6 +97,22 @@ public: // Set of poperties, which can be set only when device is NOT running.
     bool IsJpegEncodingEnabled( ) const;
     void EnableJpegEncoding( bool enable );
 
+    // Enable/Disable decoding of YUYV frames into RGB (when JPEG encoding is disabled). If disabled,
+    // clients get YUYV frames as they are, which XJpegEncoder can compress without color conversion.
+    // Disabled by default.
+    bool IsYuyvDecodingEnabled( ) const;
+    void EnableYuyvDecoding( bool enable );
+
+    // Get/Set number of capture buffers to request from the driver, [2, 32]. Default is 4.
+    uint32_t BufferCount( ) const;
+    void SetBufferCount( uint32_t count );
+
+    // Enable/Disable leasing of capture buffers. When enabled, JPEG/YUYV frames are provided to clients
+    // directly in the mapped capture buffers, which get back to the driver once all clients release
+    // them. If too few buffers are left for the driver, frames are copied instead. Enabled by default.
+    bool IsBufferLeasingEnabled( ) const;
+    void EnableBufferLeasing( bool enable );
+
 public:
 
     // Set the specified video property. The device does not have to be running. If it is not,
@@ -22,10 +22,23 @@
 #include <stdlib.h>
 #include <string.h>
 #include <stdint.h>
+#include <vector>
+
+#ifdef WEB2H_WITH_ZLIB
+    #include <zlib.h>
+#endif
+#ifdef WEB2H_WITH_BROTLI
+    #include <brotli/encode.h>
+#endif
 
 void ShowUsage( );
 int GenerateHeaderFile( const char* inputFileName, const char* outputFileName, const char* mimeType );
 const char* ResolveMimeType( const char* fileName );
+bool IsCompressibleType( const char* mimeType );
+uint64_t CalculateHash( const std::vector<uint8_t>& data );
+bool CompressGzip( const std::vector<uint8_t>& data, std::vector<uint8_t>& compressed );
+bool CompressBrotli( const std::vector<uint8_t>& data, std::vector<uint8_t>& compressed );
+void WriteDataArray( FILE* outputFile, const char* name, const std::vector<uint8_t>& data );
 
 // suported MIME types
 const char* STR_TEXT_HTML  = "text/html";
@@ -112,6 +125,8 @@ void ShowUsage( )
     printf( "Usage: web2h -i input [-o output] \n\n" );
     printf( "       -i input web file to convert (%s); \n", STR_EXTENSIONS );
     printf( "       -o output header file name to create. \n\n" );
+    printf( "Text files (html, css, js) are also embedded compressed with gzip/brotli, \n" );
+    printf( "if web2h is built with zlib/brotli libraries. \n\n" );
 }
 
 int GenerateHeaderFile( const char* inputFileName, const char* outputFileName, const char* mimeType )
@@ -164,10 +179,30 @@ int GenerateHeaderFile( const char* inputFileName, const char* outputFileName, c
                 }
             }
 
-            // get input file's size
-            fseek( inputFile, 0L, SEEK_END );
-            int inputFileSize = ftell( inputFile );
-            rewind( inputFile );
+            // read entire input file
+            std::vector<uint8_t> content;
+            std::vector<uint8_t> gzipContent;
+            std::vector<uint8_t> brotliContent;
+            uint8_t              buffer[4096];
+            size_t               read;
+
+            while ( ( read = fread( buffer, 1, sizeof( buffer ), inputFile ) ) != 0 )
+            {
+                content.insert( content.end( ), buffer, buffer + read );
+            }
+
+            // compressed variants are kept only if they are worth it (images are compressed already)
+            if ( IsCompressibleType( mimeType ) )
+            {
+                if ( ( !CompressGzip( content, gzipContent ) ) || ( gzipContent.size( ) >= content.size( ) ) )
+                {
+                    gzipContent.clear( );
+                }
+                if ( ( !CompressBrotli( content, brotliContent ) ) || ( brotliContent.size( ) >= content.size( ) ) )
+                {
+                    brotliContent.clear( );
+                }
+            }
 
             // write output file
             fprintf( outputFile, "/*\n" );
@@ -181,32 +216,51 @@ int GenerateHeaderFile( const char* inputFileName, const char* outputFileName, c
 
             fprintf( outputFile, "#include \"XWebServer.hpp\"\n\n" );
 
-            fprintf( outputFile, "uint8_t %s_data[]\n", outVarName );
-            fprintf( outputFile, "{\n" );
+            std::vector<char> arrayName( strlen( outVarName ) + 16 );
 
-            uint8_t buffer[20];
-            size_t  read;
+            sprintf( arrayName.data( ), "%s_data", outVarName );
+            WriteDataArray( outputFile, arrayName.data( ), content );
 
-            while ( ( read = fread( buffer, 1, 20, inputFile ) ) != 0 )
+            if ( !gzipContent.empty( ) )
             {
-                fprintf( outputFile, "    " );
-
-                for ( size_t i = 0; i < read; i++ )
-                {
-                    fprintf( outputFile, "0x%02X, ", buffer[i] );
-                }
-
-                fprintf( outputFile, "\n" );
+                sprintf( arrayName.data( ), "%s_gzip_data", outVarName );
+                WriteDataArray( outputFile, arrayName.data( ), gzipContent );
+            }
+            if ( !brotliContent.empty( ) )
+            {
+                sprintf( arrayName.data( ), "%s_br_data", outVarName );
+                WriteDataArray( outputFile, arrayName.data( ), brotliContent );
             }
-
-            fprintf( outputFile, "};\n\n" );
-
 
             fprintf( outputFile, "XEmbeddedContent web_%s =\n", outVarName );
             fprintf( outputFile, "{\n" );
-            fprintf( outputFile, "    %d,\n", inputFileSize );
+            fprintf( outputFile, "    %u,\n", static_cast<uint32_t>( content.size( ) ) );
             fprintf( outputFile, "    \"%s\",\n", mimeType );
             fprintf( outputFile, "    %s_data,\n", outVarName );
+            fprintf( outputFile, "    \"%016llx\",\n", static_cast<unsigned long long>( CalculateHash( content ) ) );
+
+            if ( !gzipContent.empty( ) )
+            {
+                fprintf( outputFile, "    %u,\n", static_cast<uint32_t>( gzipContent.size( ) ) );
+                fprintf( outputFile, "    %s_gzip_data,\n", outVarName );
+            }
+            else
+            {
+                fprintf( outputFile, "    0,\n" );
+                fprintf( outputFile, "    nullptr,\n" );
+            }
+
+            if ( !brotliContent.empty( ) )
+            {
+                fprintf( outputFile, "    %u,\n", static_cast<uint32_t>( brotliContent.size( ) ) );
+                fprintf( outputFile, "    %s_br_data,\n", outVarName );
+            }
+            else
+            {
+                fprintf( outputFile, "    0,\n" );
+                fprintf( outputFile, "    nullptr,\n" );
+            }
+
             fprintf( outputFile, "};\n\n" );
 
             fprintf( outputFile, "#endif\n" );
@@ -214,7 +268,9 @@ int GenerateHeaderFile( const char* inputFileName, const char* outputFileName, c
             free( outVarName );
             fclose( outputFile );
 
-            printf( "Generated header file: %s \n\n", outputFileName );
+            printf( "Generated header file: %s (%u bytes, gzip: %u, brotli: %u) \n\n", outputFileName,
+                    static_cast<uint32_t>( content.size( ) ), static_cast<uint32_t>( gzipContent.size( ) ),
+                    static_cast<uint32_t>( brotliContent.size( ) ) );
         }
 
         fclose( inputFile );
@@ -256,3 +312,105 @@ const char* ResolveMimeType( const char* fileName )
 
     return ret;
 }
+
+// Check if files of the MIME type are worth compressing
+bool IsCompressibleType( const char* mimeType )
+{
+    return ( ( mimeType == STR_TEXT_HTML ) || ( mimeType == STR_TEXT_CSS ) || ( mimeType == STR_APP_JS ) );
+}
+
+// Calculate 64-bit FNV-1a hash of the data - it is used to tell if web content has changed
+uint64_t CalculateHash( const std::vector<uint8_t>& data )
+{
+    uint64_t hash = 0xCBF29CE484222325ull;
+
+    for ( uint8_t byte : data )
+    {
+        hash ^= byte;
+        hash *= 0x100000001B3ull;
+    }
+
+    return hash;
+}
+
+// Compress data into gzip format
+bool CompressGzip( const std::vector<uint8_t>& data, std::vector<uint8_t>& compressed )
+{
+    bool ret = false;
+
+#ifdef WEB2H_WITH_ZLIB
+    z_stream stream;
+
+    memset( &stream, 0, sizeof( stream ) );
+
+    // 16 added to window bits asks for gzip header instead of zlib's
+    if ( deflateInit2( &stream, Z_BEST_COMPRESSION, Z_DEFLATED, 15 + 16, 9, Z_DEFAULT_STRATEGY ) == Z_OK )
+    {
+        compressed.resize( deflateBound( &stream, static_cast<uLong>( data.size( ) ) ) );
+
+        stream.next_in   = const_cast<Bytef*>( data.data( ) );
+        stream.avail_in  = static_cast<uInt>( data.size( ) );
+        stream.next_out  = compressed.data( );
+        stream.avail_out = static_cast<uInt>( compressed.size( ) );
+
+        if ( deflate( &stream, Z_FINISH ) == Z_STREAM_END )
+        {
+            compressed.resize( stream.total_out );
+            ret = true;
+        }
+
+        deflateEnd( &stream );
+    }
+#else
+    (void) data;
+    (void) compressed;
+#endif
+
+    return ret;
+}
+
+// Compress data into brotli format
+bool CompressBrotli( const std::vector<uint8_t>& data, std::vector<uint8_t>& compressed )
+{
+    bool ret = false;
+
+#ifdef WEB2H_WITH_BROTLI
+    size_t compressedSize = BrotliEncoderMaxCompressedSize( data.size( ) );
+
+    compressed.resize( compressedSize );
+
+    if ( ( compressedSize != 0 ) &&
+         ( BrotliEncoderCompress( BROTLI_MAX_QUALITY, BROTLI_DEFAULT_WINDOW, BROTLI_MODE_TEXT,
+                                  data.size( ), data.data( ), &compressedSize, compressed.data( ) ) ) )
+    {
+        compressed.resize( compressedSize );
+        ret = true;
+    }
+#else
+    (void) data;
+    (void) compressed;
+#endif
+
+    return ret;
+}
+
+// Write data as C array
+void WriteDataArray( FILE* outputFile, const char* name, const std::vector<uint8_t>& data )
+{
+    fprintf( outputFile, "uint8_t %s[]\n", name );
+    fprintf( outputFile, "{\n" );
+
+    for ( size_t offset = 0; offset < data.size( ); offset += 20 )
+    {
+        fprintf( outputFile, "    " );
+
+        for ( size_t i = offset; ( i < offset + 20 ) && ( i < data.size( ) ); i++ )
+        {
+            fprintf( outputFile, "0x%02X, ", data[i] );
+        }
+
+        fprintf( outputFile, "\n" );
+    }
+
+    fprintf( outputFile, "};\n\n" );
+}
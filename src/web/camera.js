@@ -2,48 +2,189 @@ var Camera = (function ()
 {
     var jpegUrl       = '/camera/jpeg';
     var mjpegUrl      = '/camera/mjpeg';
-    var mjpegMode;
+    var wsUrl         = '/camera/ws';
+    var mode;           // 'ws', 'mjpeg' or 'jpeg'
     var frameInterval;
     var imageElement;
     var timeStart;
+    var lastSequence  = 0;
+    var imageObjectUrl;
+    var socket;
+    var imageLoading  = false;
+    var pendingFrame;
 
     function refreshImage( )
     {
-        if ( mjpegMode )
+        if ( mode == 'ws' )
+        {
+            openSocket( );
+        }
+        else if ( mode == 'mjpeg' )
         {
             imageElement.src = mjpegUrl;
         }
         else
         {
-            timeStart = new Date( ).getTime( );
-            imageElement.src = jpegUrl + '?t=' + timeStart;
+            requestNextImage( );
+        }
+    }
+
+    function showImage( blob )
+    {
+        if ( imageObjectUrl )
+        {
+            URL.revokeObjectURL( imageObjectUrl );
+        }
+        imageObjectUrl   = URL.createObjectURL( blob );
+        imageElement.src = imageObjectUrl;
+    }
+
+    // get frames over WebSocket - server sends new ones only after we tell which were shown
+    function openSocket( )
+    {
+        var gotFrames = false;
+
+        socket = new WebSocket( ( ( location.protocol == 'https:' ) ? 'wss://' : 'ws://' ) + location.host + wsUrl );
+        socket.binaryType = 'arraybuffer';
+
+        socket.onmessage = function( event )
+        {
+            if ( event.data instanceof ArrayBuffer )
+            {
+                // header: version, header size, width, height, reserved, sequence, timestamp
+                var view  = new DataView( event.data );
+                var frame = {
+                    sequence: view.getUint32( 8 ) * 4294967296 + view.getUint32( 12 ),
+                    blob:     new Blob( [ new Uint8Array( event.data, view.getUint8( 1 ) ) ], { type: 'image/jpeg' } )
+                };
+
+                gotFrames = true;
+
+                // show only the latest frame if they come faster than browser decodes them
+                if ( imageLoading )
+                {
+                    pendingFrame = frame;
+                }
+                else
+                {
+                    showFrame( frame );
+                }
+            }
+        };
+
+        socket.onclose = function( )
+        {
+            socket       = null;
+            imageLoading = false;
+            pendingFrame = null;
+
+            // fall back to MJPEG if WebSocket does not work at all, otherwise reconnect
+            if ( !gotFrames )
+            {
+                mode = 'mjpeg';
+            }
+            setTimeout( refreshImage, 1000 );
+        };
+    }
+
+    function showFrame( frame )
+    {
+        imageLoading = true;
+        lastSequence = frame.sequence;
+        showImage( frame.blob );
+    }
+
+    // let server know the frame was shown, so it can send more
+    function acknowledgeFrame( )
+    {
+        imageLoading = false;
+
+        if ( ( socket ) && ( socket.readyState == WebSocket.OPEN ) )
+        {
+            socket.send( 'ack ' + lastSequence );
         }
+
+        if ( pendingFrame )
+        {
+            var frame = pendingFrame;
+
+            pendingFrame = null;
+            showFrame( frame );
+        }
+    }
+
+    // ask for an image newer than the one shown - server holds the request till it gets one
+    function requestNextImage( )
+    {
+        var request = new XMLHttpRequest( );
+
+        timeStart = new Date( ).getTime( );
+
+        request.open( 'GET', jpegUrl + '?after=' + lastSequence + '&t=' + timeStart );
+        request.responseType = 'blob';
+        request.onload = function( )
+        {
+            var sequence = parseInt( request.getResponseHeader( 'X-Frame-Sequence' ) );
+
+            if ( !isNaN( sequence ) )
+            {
+                lastSequence = sequence;
+            }
+
+            if ( request.status == 200 )
+            {
+                showImage( request.response );
+            }
+            else if ( request.status == 204 )
+            {
+                // no new image for a while - simply wait again
+                requestNextImage( );
+            }
+            else
+            {
+                onImageError( );
+            }
+        };
+        request.onerror = onImageError;
+        request.send( );
     }
-    
+
     function onImageError( )
     {
-        // try rotating between MJPEG/JPEG modes - browsers like IE don't get MJPEG at all
-        mjpegMode = !mjpegMode;
-        // also give it a small pause on error
-        setTimeout( refreshImage, 1000 );
+        if ( mode == 'ws' )
+        {
+            // skip broken frame
+            acknowledgeFrame( );
+        }
+        else
+        {
+            // try rotating between MJPEG/JPEG modes - browsers like IE don't get MJPEG at all
+            mode = ( mode == 'mjpeg' ) ? 'jpeg' : 'mjpeg';
+            // also give it a small pause on error
+            setTimeout( refreshImage, 1000 );
+        }
     }
 
     function onImageLoaded( )
     {
-        if ( !mjpegMode )
+        if ( mode == 'ws' )
+        {
+            acknowledgeFrame( );
+        }
+        else if ( mode == 'jpeg' )
         {
             var timeTaken = new Date( ).getTime( ) - timeStart;
             setTimeout( refreshImage, ( timeTaken > frameInterval ) ? 0 : frameInterval - timeTaken );
         }
     }
-    
+
     var start = function( fps )
     {
         imageElement = document.getElementById( 'camera' );
-        
+
         imageElement.onload  = onImageLoaded;
         imageElement.onerror = onImageError;
-        
+
         if ( ( typeof fps == 'number' ) &&  ( fps != 0 ) )
         {
             frameInterval = 1000 / fps;
@@ -52,10 +193,10 @@ var Camera = (function ()
         {
             frameInterval = 100;
         }
-        
-        // always try capturing in MJPEG mode
-        mjpegMode = true;
-        
+
+        // prefer WebSocket, which lets server know what was shown; otherwise try capturing in MJPEG mode
+        mode = ( typeof WebSocket != 'undefined' ) ? 'ws' : 'mjpeg';
+
         refreshImage( );
     };
 